@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <sys/cdefs.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -18,9 +19,16 @@
 #include "esp_log.h"
 #include "esp_check.h"
 #include "esp_timer.h"
+#include "esp_attr.h"
 
 #define ESP_RA8875_TIMEOUT_US   (10*1000)
 
+// Shadowed registers: active window 0x30..0x37 and memory write cursor 0x46..0x49
+#define RA8875_SHADOW_WINDOW    0
+#define RA8875_SHADOW_CURSOR    8
+#define RA8875_SHADOW_SIZE      12
+#define RA8875_SHADOW_UNKNOWN   (-1)
+
 static const char *TAG = "ra8875";
 
 static esp_err_t panel_ra8875_del(esp_lcd_panel_t *panel);
@@ -32,6 +40,7 @@ static esp_err_t panel_ra8875_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 static esp_err_t panel_ra8875_swap_xy(esp_lcd_panel_t *panel, bool swap_axes);
 static esp_err_t panel_ra8875_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap);
 static esp_err_t panel_ra8875_disp_on_off(esp_lcd_panel_t *panel, bool off);
+static void panel_ra8875_wait_isr(void *arg);
 
 typedef struct {
     esp_lcd_panel_t base;
@@ -46,8 +55,26 @@ typedef struct {
     uint16_t lcd_height;
     uint8_t sysr; // save surrent value of System Configuration Register (Color Depth settings and 8-bit/16-bit interface)
     bool swap_axes;
+    int16_t shadow[RA8875_SHADOW_SIZE]; // last value written to window/cursor registers, -1 when unknown
+    esp_lcd_ra8875_stats_t stats;
+    bool engine_busy; // drawing engine started, the next access must wait for it even without register writes
+    bool engine_poll; // the panel IO can read DCR, false: the WAIT line tells when the drawing engine is done
+    volatile TaskHandle_t wait_task; // task sleeping until WAIT goes high, NULL when none
+    bool wait_isr_added;
 } ra8875_panel_t;
 
+typedef struct {
+    uint8_t reg;
+    uint8_t value;
+} ra8875_reg_t;
+
+static void panel_ra8875_invalidate_shadow(ra8875_panel_t *ra8875)
+{
+    for (int i = 0; i < RA8875_SHADOW_SIZE; i++) {
+        ra8875->shadow[i] = RA8875_SHADOW_UNKNOWN;
+    }
+}
+
 esp_err_t esp_lcd_new_panel_ra8875(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
 {
     esp_err_t ret = ESP_OK;
@@ -67,13 +94,23 @@ esp_err_t esp_lcd_new_panel_ra8875(const esp_lcd_panel_io_handle_t io, const esp
         ESP_GOTO_ON_ERROR(gpio_config(&io_conf), err, TAG, "configure GPIO for RST line failed");
     }
 
-    // Wait GPIO config
+    // Wait GPIO config, WAIT is low while the controller is busy: the rising edge wakes the waiting task
     if (vendor_cfg->wait_gpio_num >= 0) {
         gpio_config_t io_conf = {
             .mode = GPIO_MODE_INPUT,
             .pin_bit_mask = 1ULL << vendor_cfg->wait_gpio_num,
+            .intr_type = GPIO_INTR_POSEDGE,
         };
         ESP_GOTO_ON_ERROR(gpio_config(&io_conf), err, TAG, "configure GPIO for WAIT line failed");
+        ret = gpio_install_isr_service(0);
+        ESP_GOTO_ON_FALSE(ret == ESP_OK || ret == ESP_ERR_INVALID_STATE, ret, err, TAG, "install GPIO ISR service failed");
+        ra8875->wait_gpio_num = vendor_cfg->wait_gpio_num;
+        ESP_GOTO_ON_ERROR(gpio_isr_handler_add(vendor_cfg->wait_gpio_num, panel_ra8875_wait_isr, ra8875), err, TAG, "add WAIT ISR handler failed");
+        ra8875->wait_isr_added = true;
+        // gpio_config() and the handler armed it, but WAIT toggles with every access:
+        // panel_ra8875_wait() arms it only while a task waits
+        gpio_intr_disable(vendor_cfg->wait_gpio_num);
+        ret = ESP_OK;
     }
 
     // The RA8875 supports only RGB endian
@@ -117,6 +154,8 @@ esp_err_t esp_lcd_new_panel_ra8875(const esp_lcd_panel_io_handle_t io, const esp
     ra8875->bits_per_pixel = panel_dev_config->bits_per_pixel;
     ra8875->reset_gpio_num = panel_dev_config->reset_gpio_num;
     ra8875->reset_level = panel_dev_config->flags.reset_active_high;
+    panel_ra8875_invalidate_shadow(ra8875);
+    ra8875->engine_poll = true;
     ra8875->base.del = panel_ra8875_del;
     ra8875->base.reset = panel_ra8875_reset;
     ra8875->base.init = panel_ra8875_init;
@@ -137,6 +176,9 @@ esp_err_t esp_lcd_new_panel_ra8875(const esp_lcd_panel_io_handle_t io, const esp
 
 err:
     if (ra8875) {
+        if (ra8875->wait_isr_added) {
+            gpio_isr_handler_remove(vendor_cfg->wait_gpio_num);
+        }
         if (panel_dev_config->reset_gpio_num >= 0) {
             gpio_reset_pin(panel_dev_config->reset_gpio_num);
         }
@@ -152,6 +194,9 @@ static esp_err_t panel_ra8875_del(esp_lcd_panel_t *panel)
     if (ra8875->reset_gpio_num >= 0) {
         gpio_reset_pin(ra8875->reset_gpio_num);
     }
+    if (ra8875->wait_isr_added) {
+        gpio_isr_handler_remove(ra8875->wait_gpio_num);
+    }
     ESP_LOGD(TAG, "del ra8875 panel @%p", ra8875);
     free(ra8875);
     return ESP_OK;
@@ -220,18 +265,100 @@ static const lcd_init_cmd_t vendor_specific_init[] = {
     {0, {0}, 0xff},
 };
 
-static void panel_ra8875_wait(esp_lcd_panel_t *panel)
+static void IRAM_ATTR panel_ra8875_wait_isr(void *arg)
+{
+    ra8875_panel_t *ra8875 = (ra8875_panel_t *)arg;
+    TaskHandle_t task = ra8875->wait_task;
+    BaseType_t need_yield = pdFALSE;
+
+    // one edge per wait, armed again if the waiting task still sees WAIT low
+    gpio_intr_disable(ra8875->wait_gpio_num);
+    if (task != NULL) {
+        vTaskNotifyGiveFromISR(task, &need_yield);
+    }
+    if (need_yield) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+// Counts a wait that started at start, the controller still busy is a timeout
+static esp_err_t panel_ra8875_wait_end(ra8875_panel_t *ra8875, int64_t start, bool busy)
+{
+    uint32_t waited = esp_timer_get_time() - start;
+
+    ra8875->stats.waits++;
+    ra8875->stats.wait_us_total += waited;
+    if (waited > ra8875->stats.wait_us_max) {
+        ra8875->stats.wait_us_max = waited;
+    }
+
+    if (busy) {
+        // controller state is unknown now, next draw sends all window/cursor registers again
+        ra8875->stats.wait_timeouts++;
+        panel_ra8875_invalidate_shadow(ra8875);
+        ESP_LOGW(TAG, "RA8875 busy timeout (%u us)", (unsigned)waited);
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+// Drawing engine: DCR bit 7 stays set until the fill is done, a few register reads for the
+// fills the game makes. ESP_ERR_NOT_SUPPORTED when the panel IO cannot read.
+static esp_err_t panel_ra8875_wait_engine(ra8875_panel_t *ra8875)
+{
+    uint8_t dcr = 0;
+    esp_err_t ret = esp_lcd_panel_io_rx_param(ra8875->io, 0x90, &dcr, 1);
+    if (ret != ESP_OK || !(dcr & 0x80)) {
+        return ret;
+    }
+
+    int64_t start = esp_timer_get_time();
+    do {
+        ret = esp_lcd_panel_io_rx_param(ra8875->io, 0x90, &dcr, 1);
+    } while (ret == ESP_OK && (dcr & 0x80) && (esp_timer_get_time() - start) < ESP_RA8875_TIMEOUT_US);
+    ESP_RETURN_ON_ERROR(ret, TAG, "read DCR failed");
+
+    return panel_ra8875_wait_end(ra8875, start, (dcr & 0x80) != 0);
+}
+
+static esp_err_t panel_ra8875_wait(esp_lcd_panel_t *panel)
 {
     ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
-    if (ra8875->wait_gpio_num >= 0) {
-        uint64_t start = esp_timer_get_time();
-        uint64_t now = start;
-        while (gpio_get_level(ra8875->wait_gpio_num) == 0 && ((now = esp_timer_get_time()) - start) < ESP_RA8875_TIMEOUT_US);
-        if ((now - start) > ESP_RA8875_TIMEOUT_US) {
-            ESP_LOGE(TAG, "RA8875 Timeout!");
-            ESP_ERROR_CHECK(ESP_ERR_TIMEOUT);
+
+    if (ra8875->engine_busy && ra8875->engine_poll) {
+        esp_err_t ret = panel_ra8875_wait_engine(ra8875);
+        if (ret != ESP_ERR_NOT_SUPPORTED) {
+            return ret;
+        }
+        ESP_LOGI(TAG, "panel IO cannot read, the WAIT line tells when the drawing engine is done");
+        ra8875->engine_poll = false;
+    }
+
+    // not busy (or no WAIT line): nothing to wait for
+    if (ra8875->wait_gpio_num < 0 || gpio_get_level(ra8875->wait_gpio_num) != 0) {
+        return ESP_OK;
+    }
+
+    int64_t start = esp_timer_get_time();
+
+    // sleep until the WAIT rising edge, the interrupt is armed before the level is checked again
+    // so an edge in between is not lost
+    ra8875->wait_task = xTaskGetCurrentTaskHandle();
+    while ((esp_timer_get_time() - start) < ESP_RA8875_TIMEOUT_US) {
+        if (ra8875->wait_isr_added) {
+            gpio_intr_enable(ra8875->wait_gpio_num);
+        }
+        if (gpio_get_level(ra8875->wait_gpio_num) != 0) {
+            break;
         }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ESP_RA8875_TIMEOUT_US / 1000) + 1);
+    }
+    if (ra8875->wait_isr_added) {
+        gpio_intr_disable(ra8875->wait_gpio_num);
     }
+    ra8875->wait_task = NULL;
+
+    return panel_ra8875_wait_end(ra8875, start, gpio_get_level(ra8875->wait_gpio_num) == 0);
 }
 
 static esp_err_t panel_ra8875_tx_param(esp_lcd_panel_t *panel, int lcd_cmd, uint8_t param)
@@ -239,12 +366,52 @@ static esp_err_t panel_ra8875_tx_param(esp_lcd_panel_t *panel, int lcd_cmd, uint
     ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
     esp_lcd_panel_io_handle_t io = ra8875->io;
 
-    panel_ra8875_wait(panel);
+    ESP_RETURN_ON_ERROR(panel_ra8875_wait(panel), TAG, "controller busy");
+    ra8875->engine_busy = false;
+    ra8875->stats.reg_writes++;
     return esp_lcd_panel_io_tx_param(io, lcd_cmd, (uint8_t[]) {
         param,
     }, 1);
 }
 
+// Queue a shadowed register write, dropped when the controller already holds the value
+static void panel_ra8875_burst_add(ra8875_panel_t *ra8875, ra8875_reg_t *burst, int *count, int index, uint8_t reg, uint8_t value)
+{
+    if (ra8875->shadow[index] == value) {
+        ra8875->stats.reg_skipped++;
+        return;
+    }
+    ra8875->shadow[index] = value;
+    burst[*count].reg = reg;
+    burst[*count].value = value;
+    (*count)++;
+}
+
+// Register writes don't start a controller operation, one WAIT check covers the whole burst
+static esp_err_t panel_ra8875_burst_send(esp_lcd_panel_t *panel, const ra8875_reg_t *burst, int count)
+{
+    ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
+    esp_lcd_panel_io_handle_t io = ra8875->io;
+
+    if (count == 0 && !ra8875->engine_busy) {
+        return ESP_OK;
+    }
+
+    ESP_RETURN_ON_ERROR(panel_ra8875_wait(panel), TAG, "controller busy");
+    ra8875->engine_busy = false;
+    ra8875->stats.bursts++;
+    for (int i = 0; i < count; i++) {
+        esp_err_t ret = esp_lcd_panel_io_tx_param(io, burst[i].reg, &burst[i].value, 1);
+        if (ret != ESP_OK) {
+            // the shadow already holds the whole burst, the controller may not
+            panel_ra8875_invalidate_shadow(ra8875);
+            return ret;
+        }
+        ra8875->stats.reg_writes++;
+    }
+    return ESP_OK;
+}
+
 static esp_err_t panel_ra8875_init(esp_lcd_panel_t *panel)
 {
     ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
@@ -269,10 +436,13 @@ static esp_err_t panel_ra8875_init(esp_lcd_panel_t *panel)
     panel_ra8875_tx_param(panel, 0x19, (vdhr & 0xFF));
     panel_ra8875_tx_param(panel, 0x1a, ((vdhr >> 8) & 0xFF));
 
+    // window registers were written above without the shadow
+    panel_ra8875_invalidate_shadow(ra8875);
+
     return ESP_OK;
 }
 
-static void panel_ra8875_set_window(esp_lcd_panel_t *panel, int x_start, int y_start, int x_end, int y_end)
+static void panel_ra8875_set_window(esp_lcd_panel_t *panel, ra8875_reg_t *burst, int *count, int x_start, int y_start, int x_end, int y_end)
 {
     ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
 
@@ -287,17 +457,16 @@ static void panel_ra8875_set_window(esp_lcd_panel_t *panel, int x_start, int y_s
         y_end = xe;
     }
 
-    panel_ra8875_tx_param(panel, 0x30, x_start);
-    panel_ra8875_tx_param(panel, 0x31, (x_start >> 8));
-    panel_ra8875_tx_param(panel, 0x32, y_start);
-    panel_ra8875_tx_param(panel, 0x33, (y_start >> 8));
-    panel_ra8875_tx_param(panel, 0x34, (x_end - 1));
-    panel_ra8875_tx_param(panel, 0x35, ((x_end - 1) >> 8));
-    panel_ra8875_tx_param(panel, 0x36, (y_end - 1));
-    panel_ra8875_tx_param(panel, 0x37, ((y_end - 1) >> 8));
+    const uint8_t values[8] = {
+        x_start, (x_start >> 8), y_start, (y_start >> 8),
+        (x_end - 1), ((x_end - 1) >> 8), (y_end - 1), ((y_end - 1) >> 8),
+    };
+    for (int i = 0; i < 8; i++) {
+        panel_ra8875_burst_add(ra8875, burst, count, RA8875_SHADOW_WINDOW + i, 0x30 + i, values[i]);
+    }
 }
 
-static void panel_ra8875_set_cursor(esp_lcd_panel_t *panel, int x_start, int y_start, int x_end, int y_end)
+static void panel_ra8875_set_cursor(esp_lcd_panel_t *panel, ra8875_reg_t *burst, int *count, int x_start, int y_start, int x_end, int y_end)
 {
     ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
 
@@ -308,10 +477,12 @@ static void panel_ra8875_set_cursor(esp_lcd_panel_t *panel, int x_start, int y_s
         y_start = xs;
     }
 
-    panel_ra8875_tx_param(panel, 0x46, x_start);
-    panel_ra8875_tx_param(panel, 0x47, (x_start >> 8));
-    panel_ra8875_tx_param(panel, 0x48, y_start);
-    panel_ra8875_tx_param(panel, 0x49, y_start >> 8);
+    const uint8_t values[4] = {
+        x_start, (x_start >> 8), y_start, (y_start >> 8),
+    };
+    for (int i = 0; i < 4; i++) {
+        panel_ra8875_burst_add(ra8875, burst, count, RA8875_SHADOW_CURSOR + i, 0x46 + i, values[i]);
+    }
 }
 
 static esp_err_t panel_ra8875_draw_bitmap(esp_lcd_panel_t *panel, int x_start, int y_start, int x_end, int y_end, const void *color_data)
@@ -325,15 +496,26 @@ static esp_err_t panel_ra8875_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     y_start += ra8875->y_gap;
     y_end += ra8875->y_gap;
 
+    ra8875_reg_t burst[RA8875_SHADOW_SIZE];
+    int count = 0;
+
     // define an area of frame memory where MCU can access
-    panel_ra8875_set_window(panel, x_start, y_start, x_end, y_end);
+    panel_ra8875_set_window(panel, burst, &count, x_start, y_start, x_end, y_end);
 
     // set cursor
-    panel_ra8875_set_cursor(panel, x_start, y_start, x_end, y_end);
+    panel_ra8875_set_cursor(panel, burst, &count, x_start, y_start, x_end, y_end);
+
+    // only the registers that changed since the previous rectangle
+    ESP_RETURN_ON_ERROR(panel_ra8875_burst_send(panel, burst, count), TAG, "set window failed");
 
     /* Write to graphic RAM */
     size_t len = (x_end - x_start) * (y_end - y_start) * ra8875->bits_per_pixel / 8;
-    esp_lcd_panel_io_tx_color(io, 0x02, color_data, len);
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, 0x02, color_data, len), TAG, "send pixels failed");
+
+    // the whole window was written: the auto-incremented cursor wrapped back to the window start
+    for (int i = 0; i < 4; i++) {
+        ra8875->shadow[RA8875_SHADOW_CURSOR + i] = ra8875->shadow[RA8875_SHADOW_WINDOW + i];
+    }
 
     return ESP_OK;
 }
@@ -364,6 +546,7 @@ static esp_err_t panel_ra8875_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
     ra8875->swap_axes = swap_axes;
+    panel_ra8875_invalidate_shadow(ra8875);
 
     // Graphic mode
     if (ra8875->swap_axes) {
@@ -401,3 +584,76 @@ static esp_err_t panel_ra8875_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
     panel_ra8875_tx_param(panel, 0x01, param);
     return ESP_OK;
 }
+
+esp_err_t esp_lcd_ra8875_fill_rect(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, uint16_t color)
+{
+    ESP_RETURN_ON_FALSE(panel && (x_start < x_end) && (y_start < y_end), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
+
+    x_start += ra8875->x_gap;
+    x_end += ra8875->x_gap;
+    y_start += ra8875->y_gap;
+    y_end += ra8875->y_gap;
+
+    ra8875_reg_t burst[RA8875_SHADOW_SIZE + 12];
+    int count = 0;
+
+    // drawing is clipped to the active window
+    panel_ra8875_set_window(panel, burst, &count, x_start, y_start, x_end, y_end);
+
+    if (ra8875->swap_axes) {
+        int xs = x_start;
+        int xe = x_end;
+
+        x_start = y_start;
+        y_start = xs;
+
+        x_end = y_end;
+        y_end = xe;
+    }
+
+    // square start/end point (inclusive), not shadowed: only the drawing engine uses them
+    const uint8_t values[8] = {
+        x_start, (x_start >> 8), y_start, (y_start >> 8),
+        (x_end - 1), ((x_end - 1) >> 8), (y_end - 1), ((y_end - 1) >> 8),
+    };
+    for (int i = 0; i < 8; i++) {
+        burst[count].reg = 0x91 + i;
+        burst[count].value = values[i];
+        count++;
+    }
+
+    // foreground color, RGB565 split in the 5/6/5 bit registers (65K colors: the engine takes
+    // plain red, green and blue, whatever order the memory write pixels use)
+    const uint8_t rgb[3] = { (color >> 11) & 0x1F, (color >> 5) & 0x3F, color & 0x1F };
+    for (int i = 0; i < 3; i++) {
+        burst[count].reg = 0x63 + i;
+        burst[count].value = rgb[i];
+        count++;
+    }
+
+    // Draw Line/Circle/Square Control Register: start, square, filled
+    burst[count].reg = 0x90;
+    burst[count].value = 0xB0;
+    count++;
+
+    ESP_RETURN_ON_ERROR(panel_ra8875_burst_send(panel, burst, count), TAG, "fill failed");
+
+    // runs in the controller, the next access waits for it (DCR bit 7, or the WAIT line)
+    ra8875->engine_busy = true;
+    ra8875->stats.fills++;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_ra8875_get_stats(esp_lcd_panel_handle_t panel, esp_lcd_ra8875_stats_t *stats, bool reset)
+{
+    ESP_RETURN_ON_FALSE(panel && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ra8875_panel_t *ra8875 = __containerof(panel, ra8875_panel_t, base);
+
+    *stats = ra8875->stats;
+    if (reset) {
+        memset(&ra8875->stats, 0, sizeof(ra8875->stats));
+    }
+    return ESP_OK;
+}
@@ -21,6 +21,20 @@ typedef struct {
     int mcu_bit_interface;  /*!< Selection between 8-bit and 16-bit MCU interface */
 } esp_lcd_panel_ra8875_config_t;
 
+/**
+ * @brief Register traffic and WAIT (busy) counters of the panel
+ */
+typedef struct {
+    uint32_t reg_writes;    /*!< Register writes sent to the controller */
+    uint32_t reg_skipped;   /*!< Window/cursor register writes skipped, value already in the controller */
+    uint32_t bursts;        /*!< Register bursts sent with a single WAIT check */
+    uint32_t waits;         /*!< Times the controller was busy (WAIT low, drawing engine running) when it was addressed */
+    uint32_t wait_timeouts; /*!< Waits that ran into the timeout */
+    uint64_t wait_us_total; /*!< Cumulative time spent waiting for the controller */
+    uint32_t wait_us_max;   /*!< Longest single wait */
+    uint32_t fills;         /*!< Rectangles filled by the drawing engine */
+} esp_lcd_ra8875_stats_t;
+
 /**
  * @brief Create LCD panel for model RA8875
  *
@@ -34,6 +48,40 @@ typedef struct {
  */
 esp_err_t esp_lcd_new_panel_ra8875(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel);
 
+/**
+ * @brief Fill a rectangle with one color using the RA8875 drawing engine
+ *
+ * No pixel data goes over the bus. The function returns once the fill is started, the next
+ * access to the panel polls the drawing engine busy bit (DCR bit 7). When the panel IO cannot
+ * read, it waits for the WAIT line instead.
+ *
+ * @param[in] panel LCD panel handle returned by esp_lcd_new_panel_ra8875()
+ * @param[in] x_start Start index on x-axis (x_start included)
+ * @param[in] y_start Start index on y-axis (y_start included)
+ * @param[in] x_end End index on x-axis (x_end not included)
+ * @param[in] y_end End index on y-axis (y_end not included)
+ * @param[in] color RGB565 color (red in the top bits), not the pixel format of the memory writes
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_TIMEOUT       if the controller stayed busy
+ *          - ESP_OK                on success
+ */
+esp_err_t esp_lcd_ra8875_fill_rect(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, uint16_t color);
+
+/**
+ * @brief Get register traffic and WAIT counters of a RA8875 panel
+ *
+ * Call it with reset once per frame to get the register writes per frame.
+ *
+ * @param[in] panel LCD panel handle returned by esp_lcd_new_panel_ra8875()
+ * @param[out] stats Returned counters
+ * @param[in] reset Clear the counters after reading them
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t esp_lcd_ra8875_get_stats(esp_lcd_panel_handle_t panel, esp_lcd_ra8875_stats_t *stats, bool reset);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <sys/cdefs.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -16,6 +17,11 @@
 #include "driver/gpio.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_lcd_rm68120.h"
+
+// Cached address bytes: column 0x2A00..0x2A03 then row 0x2B00..0x2B03
+#define RM68120_ADDR_CACHE_SIZE     8
+#define RM68120_ADDR_UNKNOWN        (-1)
 
 static const char *TAG = "rm68120";
 
@@ -39,8 +45,17 @@ typedef struct {
     unsigned int bits_per_pixel;
     uint8_t madctl_val; // save current value of LCD_CMD_MADCTL register
     uint8_t colmod_cal; // save surrent value of LCD_CMD_COLMOD register
+    int16_t addr_cache[RM68120_ADDR_CACHE_SIZE]; // address bytes in the controller, -1 when unknown
+    esp_lcd_rm68120_stats_t stats;
 } rm68120_panel_t;
 
+static void panel_rm68120_invalidate_window(rm68120_panel_t *rm68120)
+{
+    for (int i = 0; i < RM68120_ADDR_CACHE_SIZE; i++) {
+        rm68120->addr_cache[i] = RM68120_ADDR_UNKNOWN;
+    }
+}
+
 esp_err_t esp_lcd_new_panel_rm68120(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
 {
     esp_err_t ret = ESP_OK;
@@ -85,6 +100,7 @@ esp_err_t esp_lcd_new_panel_rm68120(const esp_lcd_panel_io_handle_t io, const es
     rm68120->bits_per_pixel = panel_dev_config->bits_per_pixel;
     rm68120->reset_gpio_num = panel_dev_config->reset_gpio_num;
     rm68120->reset_level = panel_dev_config->flags.reset_active_high;
+    panel_rm68120_invalidate_window(rm68120);
     rm68120->base.del = panel_rm68120_del;
     rm68120->base.reset = panel_rm68120_reset;
     rm68120->base.init = panel_rm68120_init;
@@ -140,6 +156,7 @@ static esp_err_t panel_rm68120_reset(esp_lcd_panel_t *panel)
         esp_lcd_panel_io_tx_param(io, LCD_CMD_SWRESET, NULL, 0);
         vTaskDelay(pdMS_TO_TICKS(20)); // spec, wait at least 5ms before sending new command
     }
+    panel_rm68120_invalidate_window(rm68120);
 
     return ESP_OK;
 }
@@ -192,7 +209,36 @@ static esp_err_t panel_rm68120_init(esp_lcd_panel_t *panel)
         esp_lcd_panel_io_tx_param(io, vendor_specific_init[cmd].cmd, vendor_specific_init[cmd].data, vendor_specific_init[cmd].data_bytes & 0x1F);
         cmd++;
     }
+    panel_rm68120_invalidate_window(rm68120);
+
+    return ESP_OK;
+}
 
+// Each address byte is its own 16-bit command, only the bytes that differ from the controller are sent
+static esp_err_t panel_rm68120_set_window(rm68120_panel_t *rm68120, int x_start, int y_start, int x_end, int y_end)
+{
+    esp_lcd_panel_io_handle_t io = rm68120->io;
+    const uint8_t addr[RM68120_ADDR_CACHE_SIZE] = {
+        (x_start >> 8), x_start, ((x_end - 1) >> 8), (x_end - 1),
+        (y_start >> 8), y_start, ((y_end - 1) >> 8), (y_end - 1),
+    };
+
+    for (int i = 0; i < RM68120_ADDR_CACHE_SIZE; i++) {
+        if (rm68120->addr_cache[i] == addr[i]) {
+            rm68120->stats.cmd_skipped++;
+            continue;
+        }
+        int cmd = (i < 4) ? (0x2A00 + i) : (0x2B00 + i - 4);
+        esp_err_t ret = esp_lcd_panel_io_tx_param(io, cmd, &addr[i], 1);
+        if (ret != ESP_OK) {
+            // what the controller holds is unknown now, the next window is sent in full
+            panel_rm68120_invalidate_window(rm68120);
+            return ret;
+        }
+        rm68120->addr_cache[i] = addr[i];
+        rm68120->stats.cmd_writes++;
+        rm68120->stats.cmd_bytes += 3; // 16-bit command + 1 parameter byte
+    }
     return ESP_OK;
 }
 
@@ -207,18 +253,12 @@ static esp_err_t panel_rm68120_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     y_start += rm68120->y_gap;
     y_end += rm68120->y_gap;
 
-    esp_lcd_panel_io_tx_param(io, 0x2A00,   (uint8_t[]){(x_start>>8)}, 1);
-    esp_lcd_panel_io_tx_param(io, 0x2A00+1, (uint8_t[]){x_start}, 1);
-    esp_lcd_panel_io_tx_param(io, 0x2A00+2, (uint8_t[]){((x_end-1)>>8)}, 1);
-    esp_lcd_panel_io_tx_param(io, 0x2A00+3, (uint8_t[]){(x_end-1)}, 1);
-    esp_lcd_panel_io_tx_param(io, 0x2B00,   (uint8_t[]){(y_start>>8)}, 1);
-    esp_lcd_panel_io_tx_param(io, 0x2B00+1, (uint8_t[]){y_start}, 1);
-    esp_lcd_panel_io_tx_param(io, 0x2B00+2, (uint8_t[]){((y_end-1)>>8)}, 1);
-    esp_lcd_panel_io_tx_param(io, 0x2B00+3, (uint8_t[]){(y_end-1)}, 1);
+    ESP_RETURN_ON_ERROR(panel_rm68120_set_window(rm68120, x_start, y_start, x_end, y_end), TAG, "set window failed");
 
-    // transfer frame buffer
+    // transfer frame buffer, memory write restarts at the window start
     size_t len = (x_end - x_start) * (y_end - y_start) * rm68120->bits_per_pixel / 8;
-    esp_lcd_panel_io_tx_color(io, 0x2C00, color_data, len);
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, 0x2C00, color_data, len), TAG, "send pixels failed");
+    rm68120->stats.cmd_bytes += 2;
 
     return ESP_OK;
 }
@@ -264,3 +304,75 @@ static esp_err_t panel_rm68120_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
     esp_lcd_panel_io_tx_param(io, 0x2900, NULL, 0);
     return ESP_OK;
 }
+
+esp_err_t esp_lcd_rm68120_draw_bitmaps(esp_lcd_panel_handle_t panel, const esp_lcd_rm68120_rect_t *rects, size_t count, size_t *queued)
+{
+    esp_err_t ret = ESP_OK;
+    size_t i = 0;
+
+    if (queued) {
+        *queued = 0;
+    }
+    ESP_RETURN_ON_FALSE(panel && (rects || count == 0), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    // the i80 IO finishes the queued pixels before each address command, so the rectangles go out one after another:
+    // what this saves is the address bytes that did not change
+    for (; i < count; i++) {
+        const esp_lcd_rm68120_rect_t *r = &rects[i];
+        ret = panel_rm68120_draw_bitmap(panel, r->x_start, r->y_start, r->x_end, r->y_end, r->color_data);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "draw rect %d failed", (int)i);
+            break;
+        }
+    }
+    if (queued) {
+        *queued = i;
+    }
+    return ret;
+}
+
+esp_err_t esp_lcd_rm68120_fill_rect(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, const void *pattern, size_t pattern_size, size_t *queued)
+{
+    if (queued) {
+        *queued = 0;
+    }
+    ESP_RETURN_ON_FALSE(panel && pattern && pattern_size && (x_start < x_end) && (y_start < y_end), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    rm68120_panel_t *rm68120 = __containerof(panel, rm68120_panel_t, base);
+    esp_lcd_panel_io_handle_t io = rm68120->io;
+
+    x_start += rm68120->x_gap;
+    x_end += rm68120->x_gap;
+    y_start += rm68120->y_gap;
+    y_end += rm68120->y_gap;
+
+    ESP_RETURN_ON_ERROR(panel_rm68120_set_window(rm68120, x_start, y_start, x_end, y_end), TAG, "set window failed");
+
+    // memory write wraps at the window edges: the same buffer is streamed until the window is full,
+    // the first chunk restarts at the window start, the next ones continue where the previous ended
+    size_t len = (x_end - x_start) * (y_end - y_start) * rm68120->bits_per_pixel / 8;
+    int cmd = 0x2C00;
+    while (len > 0) {
+        size_t chunk = (len < pattern_size) ? len : pattern_size;
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, cmd, pattern, chunk), TAG, "send pixels failed");
+        if (queued) {
+            (*queued)++;
+        }
+        rm68120->stats.cmd_bytes += 2;
+        len -= chunk;
+        cmd = 0x3C00;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rm68120_get_stats(esp_lcd_panel_handle_t panel, esp_lcd_rm68120_stats_t *stats, bool reset)
+{
+    ESP_RETURN_ON_FALSE(panel && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    rm68120_panel_t *rm68120 = __containerof(panel, rm68120_panel_t, base);
+
+    *stats = rm68120->stats;
+    if (reset) {
+        memset(&rm68120->stats, 0, sizeof(rm68120->stats));
+    }
+    return ESP_OK;
+}
@@ -11,6 +11,26 @@
 extern "C" {
 #endif
 
+/**
+ * @brief One rectangle of a multi-rectangle draw
+ */
+typedef struct {
+    int x_start;            /*!< Start index on x-axis (x_start included) */
+    int y_start;            /*!< Start index on y-axis (y_start included) */
+    int x_end;              /*!< End index on x-axis (x_end not included) */
+    int y_end;              /*!< End index on y-axis (y_end not included) */
+    const void *color_data; /*!< RGB color data, must stay valid until its transfer is done */
+} esp_lcd_rm68120_rect_t;
+
+/**
+ * @brief Command traffic counters of the panel
+ */
+typedef struct {
+    uint32_t cmd_writes;    /*!< Address commands sent (0x2A0x/0x2B0x) */
+    uint32_t cmd_skipped;   /*!< Address commands skipped, byte already in the controller */
+    uint32_t cmd_bytes;     /*!< Command and parameter bytes sent, memory write commands included */
+} esp_lcd_rm68120_stats_t;
+
 /**
  * @brief Create LCD panel for model RM68120
  *
@@ -24,6 +44,63 @@ extern "C" {
  */
 esp_err_t esp_lcd_new_panel_rm68120(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel);
 
+/**
+ * @brief Draw several rectangles, one after another
+ *
+ * Only the address bytes that changed are sent between rectangles: order them column by column
+ * so vertically adjacent rectangles share the column window. The panel IO finishes the queued
+ * pixels before each command, so a rectangle's address does not overlap the previous one's
+ * transfer: the gain is the command bytes left out, not bus concurrency.
+ *
+ * @param[in] panel LCD panel handle returned by esp_lcd_new_panel_rm68120()
+ * @param[in] rects Rectangles to draw
+ * @param[in] count Number of rectangles
+ * @param[out] queued Returned number of rectangles queued, each one reported by on_color_trans_done.
+ *                    On error the ones before the failing rectangle. Can be NULL.
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ *          - the panel IO error of the first rectangle that failed, the ones after it are not drawn
+ */
+esp_err_t esp_lcd_rm68120_draw_bitmaps(esp_lcd_panel_handle_t panel, const esp_lcd_rm68120_rect_t *rects, size_t count, size_t *queued);
+
+/**
+ * @brief Fill a rectangle by streaming the same buffer again and again
+ *
+ * The controller has no fill command: the window is written with one memory write (0x2C00)
+ * and continued with memory write continue (0x3C00) until it is full, so a few lines of one
+ * color cover the whole screen. It makes (area bytes + pattern_size - 1) / pattern_size color
+ * transfers, each one reported by on_color_trans_done.
+ *
+ * @param[in] panel LCD panel handle returned by esp_lcd_new_panel_rm68120()
+ * @param[in] x_start Start index on x-axis (x_start included)
+ * @param[in] y_start Start index on y-axis (y_start included)
+ * @param[in] x_end End index on x-axis (x_end not included)
+ * @param[in] y_end End index on y-axis (y_end not included)
+ * @param[in] pattern Pixels of one color, must stay valid until the last transfer is done
+ * @param[in] pattern_size Size of pattern in bytes, not more than the bus max_transfer_bytes
+ * @param[out] queued Returned number of color transfers queued, also on error. Can be NULL.
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ *          - the panel IO error of the first transfer that failed, the rest is not sent
+ */
+esp_err_t esp_lcd_rm68120_fill_rect(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, const void *pattern, size_t pattern_size, size_t *queued);
+
+/**
+ * @brief Get command traffic counters of a RM68120 panel
+ *
+ * Call it with reset once per frame to get the command bytes per frame.
+ *
+ * @param[in] panel LCD panel handle returned by esp_lcd_new_panel_rm68120()
+ * @param[out] stats Returned counters
+ * @param[in] reset Clear the counters after reading them
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t esp_lcd_rm68120_get_stats(esp_lcd_panel_handle_t panel, esp_lcd_rm68120_stats_t *stats, bool reset);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,8 @@
 #include "esp_system.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_check.h"
+#include "esp_attr.h"
 #include "esp_lcd_touch.h"
 
 /*******************************************************************************
@@ -20,6 +22,17 @@
 * Local variables
 *******************************************************************************/
 
+static const char *TAG = "TP";
+
+static void IRAM_ATTR esp_lcd_touch_isr(void *arg)
+{
+    esp_lcd_touch_handle_t tp = (esp_lcd_touch_handle_t)arg;
+
+    if (tp->config.interrupt_callback) {
+        tp->config.interrupt_callback(tp);
+    }
+}
+
 /*******************************************************************************
 * Public API functions
 *******************************************************************************/
@@ -189,3 +202,27 @@ esp_err_t esp_lcd_touch_del(esp_lcd_touch_handle_t tp)
 
     return ESP_OK;
 }
+
+esp_err_t esp_lcd_touch_register_interrupt_callback(esp_lcd_touch_handle_t tp, void (*callback)(esp_lcd_touch_handle_t tp))
+{
+    esp_err_t ret;
+
+    assert(tp != NULL);
+    ESP_RETURN_ON_FALSE(tp->config.int_gpio_num != GPIO_NUM_NC, ESP_ERR_INVALID_ARG, TAG, "interrupt pin not set");
+
+    tp->config.interrupt_callback = callback;
+
+    if (callback == NULL) {
+        gpio_isr_handler_remove(tp->config.int_gpio_num);
+        return gpio_set_intr_type(tp->config.int_gpio_num, GPIO_INTR_DISABLE);
+    }
+
+    /* The controller pulls the pin to its active level when new data is ready */
+    ESP_RETURN_ON_ERROR(gpio_set_intr_type(tp->config.int_gpio_num, tp->config.levels.interrupt ? GPIO_INTR_POSEDGE : GPIO_INTR_NEGEDGE), TAG, "GPIO interrupt type failed");
+
+    /* The service can be installed already (other drivers) */
+    ret = gpio_install_isr_service(0);
+    ESP_RETURN_ON_FALSE(ret == ESP_OK || ret == ESP_ERR_INVALID_STATE, ret, TAG, "install GPIO ISR service failed");
+
+    return gpio_isr_handler_add(tp->config.int_gpio_num, esp_lcd_touch_isr, tp);
+}
@@ -47,6 +47,8 @@ typedef struct {
 
     /* User callback called after get coordinates from touch controller for apply user adjusting */
     void (*process_coordinates)(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
+    /* User callback called from the ISR when the interrupt pin becomes active (new touch data), needs int_gpio_num */
+    void (*interrupt_callback)(esp_lcd_touch_handle_t tp);
 } esp_lcd_touch_config_t;
 
 typedef struct {
@@ -336,6 +338,21 @@ esp_err_t esp_lcd_touch_get_mirror_y(esp_lcd_touch_handle_t tp, bool *mirror);
  */
 esp_err_t esp_lcd_touch_del(esp_lcd_touch_handle_t tp);
 
+/**
+ * @brief Register a user callback for the touch interrupt
+ *
+ * The callback runs in the GPIO ISR on the active edge of the interrupt pin: it should only
+ * signal a task, which then calls esp_lcd_touch_read_data(). NULL disables the interrupt.
+ *
+ * @param tp: Touch handler
+ * @param callback: Interrupt callback
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG when the interrupt pin is not set
+ */
+esp_err_t esp_lcd_touch_register_interrupt_callback(esp_lcd_touch_handle_t tp, void (*callback)(esp_lcd_touch_handle_t tp));
+
 
 
 #ifdef __cplusplus
@@ -54,6 +54,9 @@ static const char *TAG = "FT5x06";
 #define FT5x06_TOUCH5_YH        (0x1D)
 #define FT5x06_TOUCH5_YL        (0x1E)
 
+/* Points read together with the count (FT5x06 reports up to 5, 6 bytes each) */
+#define FT5x06_READ_POINTS (CONFIG_ESP_LCD_TOUCH_MAX_POINTS > 5 ? 5 : CONFIG_ESP_LCD_TOUCH_MAX_POINTS)
+
 #define FT5x06_ID_G_THGROUP             (0x80)
 #define FT5x06_ID_G_THPEAK              (0x81)
 #define FT5x06_ID_G_THCAL               (0x82)
@@ -126,6 +129,12 @@ esp_err_t esp_lcd_touch_new_i2c_ft5x06(const esp_lcd_panel_io_handle_t io, const
         };
         ret = gpio_config(&int_gpio_config);
         ESP_GOTO_ON_ERROR(ret, err, TAG, "GPIO config failed");
+
+        /* Read only when the controller signals new data */
+        if (esp_lcd_touch_ft5x06->config.interrupt_callback) {
+            ret = esp_lcd_touch_register_interrupt_callback(esp_lcd_touch_ft5x06, esp_lcd_touch_ft5x06->config.interrupt_callback);
+            ESP_GOTO_ON_ERROR(ret, err, TAG, "Interrupt callback register failed");
+        }
     }
 
     /* Prepare pin for touch controller reset */
@@ -158,24 +167,23 @@ err:
 static esp_err_t esp_lcd_touch_ft5x06_read_data(esp_lcd_touch_handle_t tp)
 {
     esp_err_t err;
-    uint8_t data[30];
+    uint8_t data[1 + 6 * 5];
     uint8_t points;
     size_t i = 0;
 
     assert(tp != NULL);
 
-    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH_POINTS, &points, 1);
+    /* Count and points in one read (registers are consecutive) */
+    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH_POINTS, data, 1 + 6 * FT5x06_READ_POINTS);
     ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
+    points = data[0] & 0x0f;
     if (points > 5 || points == 0) {
         return ESP_OK;
     }
 
     /* Number of touched points */
-    points = (points > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : points);
-
-    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH1_XH, data, 6 * points);
-    ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+    points = (points > FT5x06_READ_POINTS ? FT5x06_READ_POINTS : points);
 
     taskENTER_CRITICAL(&tp->data.lock);
 
@@ -184,8 +192,8 @@ static esp_err_t esp_lcd_touch_ft5x06_read_data(esp_lcd_touch_handle_t tp)
 
     /* Fill all coordinates */
     for (i = 0; i < points; i++) {
-        tp->data.coords[i].x = (((uint16_t)data[(i * 6) + 0] & 0x0f) << 8) + data[(i * 6) + 1];
-        tp->data.coords[i].y = (((uint16_t)data[(i * 6) + 2] & 0x0f) << 8) + data[(i * 6) + 3];
+        tp->data.coords[i].x = (((uint16_t)data[(i * 6) + 1] & 0x0f) << 8) + data[(i * 6) + 2];
+        tp->data.coords[i].y = (((uint16_t)data[(i * 6) + 3] & 0x0f) << 8) + data[(i * 6) + 4];
     }
 
     taskEXIT_CRITICAL(&tp->data.lock);
@@ -229,6 +237,9 @@ static esp_err_t esp_lcd_touch_ft5x06_del(esp_lcd_touch_handle_t tp)
 
     /* Reset GPIO pin settings */
     if (tp->config.int_gpio_num != GPIO_NUM_NC) {
+        if (tp->config.interrupt_callback) {
+            gpio_isr_handler_remove(tp->config.int_gpio_num);
+        }
         gpio_reset_pin(tp->config.int_gpio_num);
     }
 
@@ -277,6 +288,12 @@ static esp_err_t touch_ft5x06_init(esp_lcd_touch_handle_t tp)
     // Timer to enter 'idle' when in 'Monitor' (ms)
     ret |= touch_ft5x06_i2c_write(tp, FT5x06_ID_G_PERIODMONITOR, 40);
 
+    // Trigger mode: a pulse on INT for every report while touched. In the default polling mode INT
+    // stays low during the whole touch, the interrupt callback would see only its first edge.
+    if (tp->config.interrupt_callback) {
+        ret |= touch_ft5x06_i2c_write(tp, FT5x06_ID_G_MODE, 0x01);
+    }
+
     return ret;
 }
 
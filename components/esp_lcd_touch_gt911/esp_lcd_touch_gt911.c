@@ -24,6 +24,9 @@ static const char *TAG = "GT911";
 #define ESP_LCD_TOUCH_GT911_CONFIG_REG  (0x8047)
 #define ESP_LCD_TOUCH_GT911_PRODUCT_ID_REG (0x8140)
 
+/* Points read together with the status (GT911 reports up to 5, 8 bytes each) */
+#define ESP_LCD_TOUCH_GT911_READ_POINTS (CONFIG_ESP_LCD_TOUCH_MAX_POINTS > 5 ? 5 : CONFIG_ESP_LCD_TOUCH_MAX_POINTS)
+
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
@@ -78,6 +81,12 @@ esp_err_t esp_lcd_touch_new_i2c_gt911(const esp_lcd_panel_io_handle_t io, const
         };
         ret = gpio_config(&int_gpio_config);
         ESP_GOTO_ON_ERROR(ret, err, TAG, "GPIO config failed");
+
+        /* Read only when the controller signals new data */
+        if (esp_lcd_touch_gt911->config.interrupt_callback) {
+            ret = esp_lcd_touch_register_interrupt_callback(esp_lcd_touch_gt911, esp_lcd_touch_gt911->config.interrupt_callback);
+            ESP_GOTO_ON_ERROR(ret, err, TAG, "Interrupt callback register failed");
+        }
     }
 
     /* Prepare pin for touch controller reset */
@@ -120,32 +129,27 @@ static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
 
     assert(tp != NULL);
 
-    err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, buf, 1);
+    /* Status and all points in one read, the points are ignored when the status says there are none */
+    err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, buf, 1 + ESP_LCD_TOUCH_GT911_READ_POINTS * 8);
     ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-    /* Any touch data? */
-    if ((buf[0] & 0x80) == 0x00) {
-        touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
-    } else {
+    /* Any touch data? Nothing to clear when not */
+    if ((buf[0] & 0x80) != 0x00) {
         /* Count of touched points */
         touch_cnt = buf[0] & 0x0f;
+
+        /* Clear all, the controller prepares the next report */
+        err = touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
+        ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
+
         if (touch_cnt > 5 || touch_cnt == 0) {
-            touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
             return ESP_OK;
         }
 
-        /* Read all points */
-        err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG + 1, &buf[1], touch_cnt * 8);
-        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
-
-        /* Clear all */
-        err = touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
-        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
-
         taskENTER_CRITICAL(&tp->data.lock);
 
         /* Number of touched points */
-        touch_cnt = (touch_cnt > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : touch_cnt);
+        touch_cnt = (touch_cnt > ESP_LCD_TOUCH_GT911_READ_POINTS ? ESP_LCD_TOUCH_GT911_READ_POINTS : touch_cnt);
         tp->data.points = touch_cnt;
 
         /* Fill all coordinates */
@@ -197,6 +201,9 @@ static esp_err_t esp_lcd_touch_gt911_del(esp_lcd_touch_handle_t tp)
 
     /* Reset GPIO pin settings */
     if (tp->config.int_gpio_num != GPIO_NUM_NC) {
+        if (tp->config.interrupt_callback) {
+            gpio_isr_handler_remove(tp->config.int_gpio_num);
+        }
         gpio_reset_pin(tp->config.int_gpio_num);
     }
 
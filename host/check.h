@@ -0,0 +1,28 @@
+/* Minimal checks for the host tests: a failed CHECK prints where and carries on, the test
+   returns check_result() so that make stops at the first failing program. */
+#pragma once
+
+#include <stdio.h>
+
+static int check_failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            check_failures++; \
+        } \
+    } while (0)
+
+#define CHECK_EQ(a, b) do { \
+        long long _a = (long long)(a), _b = (long long)(b); \
+        if (_a != _b) { \
+            printf("%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, _a, _b); \
+            check_failures++; \
+        } \
+    } while (0)
+
+static inline int check_result(const char *name)
+{
+    printf("%s: %s\n", name, check_failures ? "FAILED" : "ok");
+    return check_failures ? 1 : 0;
+}
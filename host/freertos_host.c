@@ -0,0 +1,306 @@
+/* FreeRTOS on pthreads, see host/include/freertos/FreeRTOS.h */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+struct host_task_s {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notify;
+    TaskFunction_t fn;
+    void *arg;
+};
+
+struct host_queue_s {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t count;
+    UBaseType_t head;
+    uint8_t *items;
+};
+
+static pthread_mutex_t critical = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static __thread int isr_depth;
+static __thread struct host_task_s *current_task;
+
+void host_critical_enter(void *mux)
+{
+    pthread_mutex_lock(&critical);
+}
+
+void host_critical_exit(void *mux)
+{
+    pthread_mutex_unlock(&critical);
+}
+
+void host_isr_enter(void)
+{
+    isr_depth++;
+}
+
+void host_isr_exit(void)
+{
+    isr_depth--;
+}
+
+BaseType_t xPortInIsrContext(void)
+{
+    return isr_depth > 0;
+}
+
+/* Absolute deadline for a wait of ticks (milliseconds), NULL for portMAX_DELAY */
+static struct timespec *deadline(struct timespec *ts, TickType_t ticks)
+{
+    if (ticks == portMAX_DELAY) {
+        return NULL;
+    }
+    clock_gettime(CLOCK_REALTIME, ts);
+    ts->tv_sec += ticks / 1000;
+    ts->tv_nsec += (long)(ticks % 1000) * 1000000;
+    if (ts->tv_nsec >= 1000000000) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+    return ts;
+}
+
+/* false when the deadline passed */
+static bool wait(pthread_cond_t *cond, pthread_mutex_t *lock, const struct timespec *until)
+{
+    if (until == NULL) {
+        pthread_cond_wait(cond, lock);
+        return true;
+    }
+    return pthread_cond_timedwait(cond, lock, until) != ETIMEDOUT;
+}
+
+static struct host_task_s *task_new(TaskFunction_t fn, void *arg)
+{
+    struct host_task_s *task = calloc(1, sizeof(*task));
+    assert(task != NULL);
+    pthread_mutex_init(&task->lock, NULL);
+    pthread_cond_init(&task->cond, NULL);
+    task->fn = fn;
+    task->arg = arg;
+    return task;
+}
+
+static void *task_main(void *arg)
+{
+    current_task = arg;
+    current_task->fn(current_task->arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *ret, BaseType_t core)
+{
+    pthread_t thread;
+    struct host_task_s *task = task_new(fn, arg);
+
+    (void)name;
+    (void)stack;
+    (void)prio;
+    (void)core;
+    if (pthread_create(&thread, NULL, task_main, task) != 0) {
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    if (ret) {
+        *ret = task;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *ret)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, ret, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    /* only a task ending itself, the handle stays valid for late notifications */
+    if (task == NULL || task == current_task) {
+        pthread_exit(NULL);
+    }
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    usleep((useconds_t)ticks * 1000);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() / 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (current_task == NULL) {
+        current_task = task_new(NULL, NULL);
+    }
+    return current_task;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    struct host_task_s *task = xTaskGetCurrentTaskHandle();
+    struct timespec ts;
+    const struct timespec *until = deadline(&ts, ticks);
+
+    pthread_mutex_lock(&task->lock);
+    while (task->notify == 0 && ticks != 0 && wait(&task->cond, &task->lock, until)) {
+    }
+    uint32_t value = task->notify;
+    if (value > 0) {
+        task->notify = clear ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notify++;
+    pthread_cond_broadcast(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken)
+{
+    xTaskNotifyGive(task);
+    if (woken) {
+        *woken = pdTRUE;
+    }
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct host_queue_s *queue = calloc(1, sizeof(*queue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->items = calloc(length, item_size ? item_size : 1);
+    if (queue->items == NULL) {
+        free(queue);
+        return NULL;
+    }
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial)
+{
+    QueueHandle_t queue = xQueueCreate(max, 0);
+    if (queue != NULL) {
+        queue->count = initial;
+    }
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    if (queue != NULL) {
+        pthread_mutex_destroy(&queue->lock);
+        pthread_cond_destroy(&queue->changed);
+        free(queue->items);
+        free(queue);
+    }
+}
+
+static BaseType_t queue_send(QueueHandle_t queue, const void *item, TickType_t ticks, bool front)
+{
+    struct timespec ts;
+    const struct timespec *until = deadline(&ts, ticks);
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == queue->length) {
+        if (ticks == 0 || !wait(&queue->changed, &queue->lock, until)) {
+            pthread_mutex_unlock(&queue->lock);
+            return pdFAIL;
+        }
+    }
+    UBaseType_t slot;
+    if (front) {
+        queue->head = (queue->head + queue->length - 1) % queue->length;
+        slot = queue->head;
+    } else {
+        slot = (queue->head + queue->count) % queue->length;
+    }
+    if (queue->item_size) {
+        memcpy(queue->items + slot * queue->item_size, item, queue->item_size);
+    }
+    queue->count++;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return queue_send(queue, item, ticks, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return queue_send(queue, item, ticks, true);
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *woken)
+{
+    BaseType_t ret = queue_send(queue, item, 0, false);
+    if (woken && ret == pdPASS) {
+        *woken = pdTRUE;
+    }
+    return ret;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    struct timespec ts;
+    const struct timespec *until = deadline(&ts, ticks);
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == 0) {
+        if (ticks == 0 || !wait(&queue->changed, &queue->lock, until)) {
+            pthread_mutex_unlock(&queue->lock);
+            return pdFAIL;
+        }
+    }
+    if (queue->item_size) {
+        memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+    }
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
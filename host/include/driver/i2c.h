@@ -0,0 +1,35 @@
+#pragma once
+
+/* I2C master command links: the calls build, nothing is on the host bus. The checks give
+   bsp_i2c_start() a simulated device (host/mock_i2c.h) instead of the driver. */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef int i2c_port_t;
+typedef void *i2c_cmd_handle_t;
+
+typedef enum { I2C_MASTER_WRITE = 0, I2C_MASTER_READ } i2c_rw_t;
+typedef enum { I2C_MASTER_ACK = 0, I2C_MASTER_NACK, I2C_MASTER_LAST_NACK } i2c_ack_type_t;
+
+#define I2C_LINK_RECOMMENDED_SIZE(TRANSACTIONS)     (2 * (TRANSACTIONS) * 32)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t *buffer, uint32_t size);
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd_handle, uint8_t data, bool ack_en);
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd_handle, const uint8_t *data, size_t data_len, bool ack_en);
+esp_err_t i2c_master_read(i2c_cmd_handle_t cmd_handle, uint8_t *data, size_t data_len, i2c_ack_type_t ack);
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd_handle);
+/* No driver installed on the host: ESP_ERR_INVALID_STATE */
+esp_err_t i2c_master_cmd_begin(i2c_port_t i2c_num, i2c_cmd_handle_t cmd_handle, TickType_t ticks_to_wait);
+
+#ifdef __cplusplus
+}
+#endif
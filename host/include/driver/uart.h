@@ -0,0 +1,26 @@
+#pragma once
+
+/* UART driver: a port reads from a file descriptor the test gives it (host/mock_uart.h), e.g. a
+   pseudo terminal standing in for the console */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+typedef int uart_port_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ESP_FAIL when the test gave the port no file descriptor */
+esp_err_t uart_driver_install(uart_port_t uart_num, int rx_buffer_size, int tx_buffer_size, int queue_size, QueueHandle_t *uart_queue, int intr_alloc_flags);
+bool uart_is_driver_installed(uart_port_t uart_num);
+/* Never waits on the host, whatever ticks_to_wait */
+int uart_read_bytes(uart_port_t uart_num, void *buf, uint32_t length, TickType_t ticks_to_wait);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,5 @@
+#pragma once
+
+/* The host API follows v5.0: panel IO reads and disp_on_off */
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 0, 0)
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "esp_err.h"
+
+typedef struct esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t;
+typedef struct esp_lcd_panel_t *esp_lcd_panel_handle_t;
+
+typedef enum {
+    ESP_LCD_COLOR_SPACE_RGB,
+    ESP_LCD_COLOR_SPACE_BGR,
+    ESP_LCD_COLOR_SPACE_MONOCHROME,
+} esp_lcd_color_space_t;
+
+typedef enum {
+    LCD_CLK_SRC_PLL160M = 1,
+    LCD_CLK_SRC_XTAL,
+} lcd_clock_source_t;
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdio.h>
+#include "esp_err.h"
+
+/* Errors and warnings always, info only with -DHOST_LOG_INFO=1: the checks print their own results */
+#ifndef HOST_LOG_INFO
+#define HOST_LOG_INFO 0
+#endif
+
+#define ESP_LOGE(tag, fmt, ...) printf("E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) printf("W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) do { if (HOST_LOG_INFO) printf("I %s: " fmt "\n", tag, ##__VA_ARGS__); } while (0)
+#define ESP_LOGD(tag, fmt, ...) do { } while (0)
+#define ESP_LOGV(tag, fmt, ...) do { } while (0)
@@ -0,0 +1,55 @@
+#pragma once
+
+/* FreeRTOS on pthreads: tasks are threads, a tick is a millisecond, critical sections share one
+   recursive mutex. "ISR" code is whatever the mocks call with host_isr_enter() in effect. */
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE          1
+#define pdFALSE         0
+#define pdPASS          pdTRUE
+#define pdFAIL          pdFALSE
+#define portMAX_DELAY   ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ  1000
+#define portTICK_PERIOD_MS  1
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+#define configMAX_PRIORITIES 25
+#define tskNO_AFFINITY  0x7FFFFFFF
+
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { 0 }
+#define portMUX_INITIALIZE(mux)         ((void)(mux))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The mux is not used, all critical sections are one */
+void host_critical_enter(void *mux);
+void host_critical_exit(void *mux);
+/* Mocks bracket their interrupt handlers with these, xPortInIsrContext() tells */
+void host_isr_enter(void);
+void host_isr_exit(void);
+BaseType_t xPortInIsrContext(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define portENTER_CRITICAL(mux)         host_critical_enter((void *)(mux))
+#define portEXIT_CRITICAL(mux)          host_critical_exit((void *)(mux))
+#define portENTER_CRITICAL_ISR(mux)     host_critical_enter((void *)(mux))
+#define portEXIT_CRITICAL_ISR(mux)      host_critical_exit((void *)(mux))
+#define portENTER_CRITICAL_SAFE(mux)    host_critical_enter((void *)(mux))
+#define portEXIT_CRITICAL_SAFE(mux)     host_critical_exit((void *)(mux))
+#define taskENTER_CRITICAL(mux)         host_critical_enter((void *)(mux))
+#define taskEXIT_CRITICAL(mux)          host_critical_exit((void *)(mux))
+#define portYIELD_FROM_ISR(...)         do { } while (0)
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+/* Semaphores are queues of empty items, as in FreeRTOS */
+typedef QueueHandle_t SemaphoreHandle_t;
+
+typedef struct {
+    SemaphoreHandle_t handle;
+} StaticSemaphore_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define xSemaphoreCreateBinary()            xQueueCreate(1, 0)
+#define xSemaphoreCreateBinaryStatic(buf)   ((buf)->handle = xQueueCreate(1, 0))
+#define xSemaphoreCreateMutex()             xSemaphoreCreateCounting(1, 1)
+#define vSemaphoreDelete(sem)               vQueueDelete(sem)
+#define xSemaphoreTake(sem, ticks)          xQueueReceive((sem), NULL, (ticks))
+#define xSemaphoreGive(sem)                 xQueueSend((sem), NULL, 0)
+#define xSemaphoreGiveFromISR(sem, woken)   xQueueSendFromISR((sem), NULL, (woken))
@@ -0,0 +1,9 @@
+#pragma once
+
+/* lwIP sockets are BSD sockets: the host ones */
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
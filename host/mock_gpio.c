@@ -0,0 +1,219 @@
+/* Simulated pins, see mock_gpio.h */
+
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "mock_gpio.h"
+
+typedef struct {
+    int level;
+    gpio_mode_t mode;
+    gpio_isr_t isr;
+    void *isr_arg;
+    mock_gpio_read_hook_t hook;
+    void *hook_ctx;
+    mock_gpio_stats_t stats;
+} mock_pin_t;
+
+static mock_pin_t pins[GPIO_NUM_MAX];
+
+static mock_pin_t *pin(gpio_num_t gpio_num)
+{
+    return (gpio_num >= 0 && gpio_num < GPIO_NUM_MAX) ? &pins[gpio_num] : NULL;
+}
+
+static bool edge_matches(gpio_int_type_t type, int from, int to)
+{
+    switch (type) {
+    case GPIO_INTR_POSEDGE: return !from && to;
+    case GPIO_INTR_NEGEDGE: return from && !to;
+    case GPIO_INTR_ANYEDGE: return from != to;
+    case GPIO_INTR_LOW_LEVEL: return !to;
+    case GPIO_INTR_HIGH_LEVEL: return to;
+    default: return false;
+    }
+}
+
+void mock_gpio_reset(void)
+{
+    memset(pins, 0, sizeof(pins));
+}
+
+void mock_gpio_set_input(gpio_num_t gpio_num, int level)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return;
+    }
+
+    int from = p->level;
+    p->level = level ? 1 : 0;
+    if (!edge_matches(p->stats.intr_type, from, p->level)) {
+        return;
+    }
+    if (!p->stats.intr_enabled || p->isr == NULL) {
+        p->stats.edges_ignored++;
+        return;
+    }
+    p->stats.isr_calls++;
+    host_isr_enter();
+    p->isr(p->isr_arg);
+    host_isr_exit();
+}
+
+int mock_gpio_get_output(gpio_num_t gpio_num)
+{
+    mock_pin_t *p = pin(gpio_num);
+    return p ? p->level : 0;
+}
+
+void mock_gpio_set_read_hook(gpio_num_t gpio_num, mock_gpio_read_hook_t hook, void *ctx)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p) {
+        p->hook = hook;
+        p->hook_ctx = ctx;
+    }
+}
+
+void mock_gpio_get_stats(gpio_num_t gpio_num, mock_gpio_stats_t *stats)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p) {
+        *stats = p->stats;
+    } else {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+esp_err_t gpio_config(const gpio_config_t *conf)
+{
+    for (int i = 0; i < GPIO_NUM_MAX; i++) {
+        if (!(conf->pin_bit_mask & BIT64(i))) {
+            continue;
+        }
+        pins[i].mode = conf->mode;
+        pins[i].stats.intr_type = conf->intr_type;
+        /* as in ESP-IDF: an interrupt type enables the interrupt right away */
+        pins[i].stats.intr_enabled = (conf->intr_type != GPIO_INTR_DISABLE);
+        if (pins[i].stats.intr_enabled) {
+            pins[i].stats.intr_enables++;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->mode = GPIO_MODE_DISABLE;
+    p->stats.intr_enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->mode = mode;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (p->mode & GPIO_MODE_OUTPUT) {
+        p->level = level ? 1 : 0;
+    }
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return 0;
+    }
+    p->stats.reads++;
+    if (p->hook) {
+        /* the hook may change the level, with an edge */
+        mock_gpio_set_input(gpio_num, p->hook(gpio_num, p->hook_ctx));
+    }
+    return p->level;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->stats.intr_type = intr_type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->stats.intr_enabled = true;
+    p->stats.intr_enables++;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->stats.intr_enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    static bool installed = false;
+
+    (void)intr_alloc_flags;
+    if (installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    installed = true;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->isr = isr_handler;
+    p->isr_arg = args;
+    /* as in ESP-IDF: adding the handler enables the interrupt too */
+    p->stats.intr_enabled = true;
+    p->stats.intr_enables++;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    mock_pin_t *p = pin(gpio_num);
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->isr = NULL;
+    p->isr_arg = NULL;
+    return ESP_OK;
+}
@@ -0,0 +1,40 @@
+/* Simulated pins behind host/include/driver/gpio.h */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "driver/gpio.h"
+
+/* Called when the pin is read, e.g. a controller model that drives its busy line */
+typedef int (*mock_gpio_read_hook_t)(gpio_num_t gpio_num, void *ctx);
+
+typedef struct {
+    bool intr_enabled;          /* interrupt armed */
+    gpio_int_type_t intr_type;
+    uint32_t intr_enables;      /* gpio_intr_enable() calls, gpio_config() with an interrupt type included */
+    uint32_t isr_calls;         /* handler calls */
+    uint32_t edges_ignored;     /* edges of the interrupt type while it was disabled */
+    uint32_t reads;
+} mock_gpio_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Forget all levels, handlers and counters */
+void mock_gpio_reset(void);
+
+/* Drives an input: an edge of the configured type calls the handler, as an ISR, if the interrupt is enabled */
+void mock_gpio_set_input(gpio_num_t gpio_num, int level);
+
+/* Level the code under test drove on an output */
+int mock_gpio_get_output(gpio_num_t gpio_num);
+
+void mock_gpio_set_read_hook(gpio_num_t gpio_num, mock_gpio_read_hook_t hook, void *ctx);
+
+void mock_gpio_get_stats(gpio_num_t gpio_num, mock_gpio_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
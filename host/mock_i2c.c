@@ -0,0 +1,145 @@
+/* Simulated I2C bus, see mock_i2c.h */
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mock_i2c.h"
+
+/* 9 clocks per byte (ACK included) at 400 kHz */
+#define MOCK_I2C_BYTE_NS    22500
+
+typedef struct {
+    mock_i2c_dev_cfg_t cfg;
+    uint8_t regs[256];
+    uint8_t ptr;
+} mock_i2c_dev_t;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t changed = PTHREAD_COND_INITIALIZER;
+static mock_i2c_dev_t devs[MOCK_I2C_MAX_DEVICES];
+static size_t dev_count;
+static int hold_addr = -1;
+static bool held;
+static mock_i2c_entry_t log_entries[MOCK_I2C_LOG_DEPTH];
+static size_t log_count;
+
+static mock_i2c_dev_t *find_dev(uint8_t addr)
+{
+    for (size_t i = 0; i < dev_count; i++) {
+        if (devs[i].cfg.addr == addr) {
+            return &devs[i];
+        }
+    }
+    return NULL;
+}
+
+void mock_i2c_set_dev(const mock_i2c_dev_cfg_t *cfg)
+{
+    pthread_mutex_lock(&lock);
+    mock_i2c_dev_t *dev = find_dev(cfg->addr);
+    if (dev == NULL) {
+        assert(dev_count < MOCK_I2C_MAX_DEVICES);
+        dev = &devs[dev_count++];
+        memset(dev, 0, sizeof(*dev));
+    }
+    dev->cfg = *cfg;
+    pthread_mutex_unlock(&lock);
+}
+
+uint8_t *mock_i2c_regs(uint8_t addr)
+{
+    mock_i2c_dev_t *dev = find_dev(addr);
+    return dev ? dev->regs : NULL;
+}
+
+void mock_i2c_hold(uint8_t addr)
+{
+    pthread_mutex_lock(&lock);
+    hold_addr = addr;
+    held = false;
+    pthread_mutex_unlock(&lock);
+}
+
+void mock_i2c_wait_held(void)
+{
+    pthread_mutex_lock(&lock);
+    while (!held) {
+        pthread_cond_wait(&changed, &lock);
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+void mock_i2c_release(void)
+{
+    pthread_mutex_lock(&lock);
+    hold_addr = -1;
+    pthread_cond_broadcast(&changed);
+    pthread_mutex_unlock(&lock);
+}
+
+const mock_i2c_entry_t *mock_i2c_log(size_t *count)
+{
+    *count = log_count;
+    return log_entries;
+}
+
+void mock_i2c_log_clear(void)
+{
+    pthread_mutex_lock(&lock);
+    log_count = 0;
+    pthread_mutex_unlock(&lock);
+}
+
+esp_err_t mock_i2c_xfer(int port, const bsp_i2c_xfer_t *xfer, uint32_t timeout_ms, void *bus_ctx)
+{
+    size_t write_len = xfer->head_len + xfer->data_len;
+    esp_err_t err = ESP_OK;
+
+    pthread_mutex_lock(&lock);
+    if (hold_addr == xfer->addr) {
+        held = true;
+        pthread_cond_broadcast(&changed);
+        while (hold_addr == xfer->addr) {
+            pthread_cond_wait(&changed, &lock);
+        }
+    }
+
+    mock_i2c_dev_t *dev = find_dev(xfer->addr);
+    uint32_t stretch_ms = dev ? dev->cfg.stretch_ms : 0;
+    if (dev == NULL || dev->cfg.nak) {
+        err = ESP_FAIL;
+    } else if (stretch_ms > timeout_ms) {
+        err = ESP_ERR_TIMEOUT;
+        stretch_ms = timeout_ms;
+    } else {
+        for (size_t i = 0; i < write_len; i++) {
+            uint8_t b = (i < xfer->head_len) ? xfer->head[i] : xfer->data[i - xfer->head_len];
+            if (i == 0) {
+                dev->ptr = b;
+            } else {
+                dev->regs[dev->ptr++] = b;
+            }
+        }
+        for (size_t i = 0; i < xfer->rx_len; i++) {
+            xfer->rx[i] = dev->regs[dev->ptr++];
+        }
+    }
+
+    if (log_count < MOCK_I2C_LOG_DEPTH) {
+        mock_i2c_entry_t *e = &log_entries[log_count++];
+        memset(e, 0, sizeof(*e));
+        e->addr = xfer->addr;
+        e->write_len = write_len;
+        e->rx_len = xfer->rx_len;
+        e->err = err;
+        for (size_t i = 0; i < write_len && i < sizeof(e->bytes); i++) {
+            e->bytes[i] = (i < xfer->head_len) ? xfer->head[i] : xfer->data[i - xfer->head_len];
+        }
+    }
+    pthread_mutex_unlock(&lock);
+
+    /* address bytes included, a NAK ends after the address */
+    size_t bytes = (err == ESP_FAIL) ? 1 : 1 + write_len + (xfer->rx_len ? 1 + xfer->rx_len : 0);
+    usleep((useconds_t)(bytes * MOCK_I2C_BYTE_NS / 1000 + stretch_ms * 1000));
+    return err;
+}
@@ -0,0 +1,58 @@
+/* Simulated I2C bus for bsp_i2c_start() (main/bsp/bsp_i2c.h)
+
+   Devices are register files: the first byte written sets the register pointer, the next ones
+   are written from there on, a read returns the registers from the pointer on. A transfer takes
+   the time of its bytes at 400 kHz. A device can NAK, stretch the clock past the timeout, or hold
+   the bus until the test releases it, so that jobs queue up behind it. */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bsp_i2c.h"
+
+#define MOCK_I2C_MAX_DEVICES    8
+#define MOCK_I2C_LOG_DEPTH      64
+
+typedef struct {
+    uint8_t addr;
+    bool nak;               /* nobody answers: every transfer fails with ESP_FAIL */
+    uint32_t stretch_ms;    /* clock stretching per transfer, longer than the timeout is ESP_ERR_TIMEOUT */
+} mock_i2c_dev_cfg_t;
+
+/* One transfer as the device saw it */
+typedef struct {
+    uint8_t addr;
+    uint8_t bytes[16];      /* head then data, first bytes */
+    uint32_t write_len;
+    uint32_t rx_len;
+    esp_err_t err;
+} mock_i2c_entry_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The bsp_i2c_bus_fn_t of the simulated bus */
+esp_err_t mock_i2c_xfer(int port, const bsp_i2c_xfer_t *xfer, uint32_t timeout_ms, void *bus_ctx);
+
+/* Adds a device, or changes one already there */
+void mock_i2c_set_dev(const mock_i2c_dev_cfg_t *cfg);
+
+/* Registers of a device, 256 of them */
+uint8_t *mock_i2c_regs(uint8_t addr);
+
+/* The next transfer to addr waits on the bus until mock_i2c_release(), mock_i2c_wait_held() returns
+   once it is there */
+void mock_i2c_hold(uint8_t addr);
+void mock_i2c_wait_held(void);
+void mock_i2c_release(void);
+
+/* Transfers since the previous clear, in bus order */
+const mock_i2c_entry_t *mock_i2c_log(size_t *count);
+void mock_i2c_log_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
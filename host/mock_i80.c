@@ -0,0 +1,75 @@
+/* Intel 8080 bus stand-in, see mock_i80.h */
+#include <stdlib.h>
+
+#include "lcd_trace.h"
+#include "mock_i80.h"
+
+struct esp_lcd_i80_bus_t {
+    int bus_width;
+};
+
+static mock_panel_io_cfg_t panel_cfg;
+static uint32_t overhead_ns;
+static esp_lcd_panel_io_handle_t panel_io;
+static esp_lcd_panel_io_handle_t trace_io;
+
+void mock_i80_set_panel(const mock_panel_io_cfg_t *cfg, uint32_t trans_overhead_ns)
+{
+    panel_cfg = *cfg;
+    overhead_ns = trans_overhead_ns;
+}
+
+esp_lcd_panel_io_handle_t mock_i80_panel_io(void)
+{
+    return panel_io;
+}
+
+esp_lcd_panel_io_handle_t mock_i80_trace_io(void)
+{
+    return trace_io;
+}
+
+esp_err_t esp_lcd_new_i80_bus(const esp_lcd_i80_bus_config_t *bus_config, esp_lcd_i80_bus_handle_t *ret_bus)
+{
+    if (bus_config == NULL || ret_bus == NULL || (bus_config->bus_width != 8 && bus_config->bus_width != 16)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct esp_lcd_i80_bus_t *bus = calloc(1, sizeof(*bus));
+    if (bus == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    bus->bus_width = (int)bus_config->bus_width;
+    *ret_bus = bus;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_io_i80(esp_lcd_i80_bus_handle_t bus, const esp_lcd_panel_io_i80_config_t *io_config, esp_lcd_panel_io_handle_t *ret_io)
+{
+    if (bus == NULL || io_config == NULL || ret_io == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    mock_panel_io_cfg_t cfg = panel_cfg;
+    cfg.swap_color_bytes = io_config->flags.swap_color_bytes;
+    cfg.on_color_trans_done = io_config->on_color_trans_done;
+    cfg.user_ctx = io_config->user_ctx;
+    esp_err_t ret = mock_panel_io_new(&cfg, &panel_io);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    const lcd_trace_cfg_t trace_cfg = {
+        .pclk_hz = io_config->pclk_hz,
+        .bus_width = bus->bus_width,
+        .cmd_bits = io_config->lcd_cmd_bits,
+        .param_bits = io_config->lcd_param_bits,
+        .trans_overhead_ns = overhead_ns,
+    };
+    ret = lcd_trace_new_io(panel_io, &trace_cfg, &trace_io);
+    if (ret != ESP_OK) {
+        esp_lcd_panel_io_del(panel_io);
+        return ret;
+    }
+    *ret_io = trace_io;
+    return ESP_OK;
+}
@@ -0,0 +1,28 @@
+/* Intel 8080 bus stand-in for code that creates its own bus (main/display/lcd_parallel.c)
+
+   esp_lcd_new_panel_io_i80() returns a mock panel (host/mock_panel_io.h) behind a tracer
+   (main/display/lcd_trace.h) set up from the bus and IO config: the pixels land in the mock panel
+   RAM, the bus time is modeled from the pixel clock, bus width and transaction overhead. */
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_lcd_panel_io.h"
+#include "mock_panel_io.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Panel of the next esp_lcd_new_panel_io_i80(), the completion callback and byte swap come from the IO config */
+void mock_i80_set_panel(const mock_panel_io_cfg_t *cfg, uint32_t trans_overhead_ns);
+
+/* The mock panel of the last created IO: RAM, log, counters */
+esp_lcd_panel_io_handle_t mock_i80_panel_io(void);
+
+/* The tracer in front of it: modeled bus time (lcd_trace_frame()) */
+esp_lcd_panel_io_handle_t mock_i80_trace_io(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,446 @@
+/* Mock esp_lcd_panel_io with a panel controller model, see mock_panel_io.h */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_lcd_panel_io_interface.h"
+#include "freertos/FreeRTOS.h"
+#include "mock_gpio.h"
+#include "mock_panel_io.h"
+
+#define MOCK_PANEL_QUEUE    64
+
+/* RA8875 registers of the model */
+#define RA8875_MWCR0    0x40    /* memory write direction in bits 3:2 */
+#define RA8875_MRWC     0x02    /* memory read/write command */
+#define RA8875_FGCR0    0x63    /* foreground color red, then green and blue */
+#define RA8875_DCR      0x90    /* draw control: bit 7 start/busy, bit 5 fill, bit 4 square */
+#define RA8875_DLHSR0   0x91    /* square start x, y and end x, y (inclusive), 0x91..0x98 */
+
+/* RM68120 address and memory write commands */
+#define RM68120_CASET   0x2A00
+#define RM68120_RASET   0x2B00
+#define RM68120_RAMWR   0x2C00
+#define RM68120_RAMWRC  0x3C00
+
+/* ST7789 (MIPI DCS) */
+#define DCS_CASET       0x2A
+#define DCS_RASET       0x2B
+#define DCS_RAMWR       0x2C
+#define DCS_RAMWRC      0x3C
+
+typedef struct {
+    int cmd;
+    const void *color;
+    size_t size;
+} mock_panel_xfer_t;
+
+typedef struct {
+    esp_lcd_panel_io_t base;
+    mock_panel_io_cfg_t cfg;
+    uint16_t *ram;
+    mock_panel_io_stats_t stats;
+    mock_panel_entry_t *log;
+    size_t log_count;
+    size_t log_size;
+    mock_panel_xfer_t queue[MOCK_PANEL_QUEUE];
+    size_t queue_head;
+    size_t queue_count;
+    int fail_after;
+    int fail_colors;
+    /* RA8875 */
+    uint8_t regs[256];
+    uint32_t engine_left;
+    /* RM68120 and ST7789 address bytes, column start/end then row start/end */
+    uint8_t addr[8];
+    /* memory write position */
+    int cur_x;
+    int cur_y;
+} mock_panel_t;
+
+static void _log(mock_panel_t *mock, mock_panel_op_t op, int cmd, const void *data, size_t size)
+{
+    if (mock->log_count == mock->log_size) {
+        size_t n = mock->log_size ? mock->log_size * 2 : 256;
+        mock_panel_entry_t *log = realloc(mock->log, n * sizeof(*log));
+        if (log == NULL) {
+            return;
+        }
+        mock->log = log;
+        mock->log_size = n;
+    }
+    mock_panel_entry_t *e = &mock->log[mock->log_count++];
+    memset(e, 0, sizeof(*e));
+    e->op = op;
+    e->cmd = cmd;
+    e->size = size;
+    if (op == MOCK_PANEL_CMD && data != NULL) {
+        memcpy(e->data, data, (size < sizeof(e->data)) ? size : sizeof(e->data));
+    }
+}
+
+static int _reg16(const mock_panel_t *mock, int reg)
+{
+    return mock->regs[reg] | (mock->regs[reg + 1] << 8);
+}
+
+/* Write window, inclusive: RA8875 active window 0x30..0x37, RM68120 and ST7789 column/row address */
+static void _window(const mock_panel_t *mock, int *x1, int *y1, int *x2, int *y2)
+{
+    if (mock->cfg.model == MOCK_PANEL_RA8875) {
+        *x1 = _reg16(mock, 0x30);
+        *y1 = _reg16(mock, 0x32);
+        *x2 = _reg16(mock, 0x34);
+        *y2 = _reg16(mock, 0x36);
+    } else {
+        *x1 = (mock->addr[0] << 8) | mock->addr[1];
+        *x2 = (mock->addr[2] << 8) | mock->addr[3];
+        *y1 = (mock->addr[4] << 8) | mock->addr[5];
+        *y2 = (mock->addr[6] << 8) | mock->addr[7];
+    }
+}
+
+static void _put(mock_panel_t *mock, int x, int y, uint16_t pixel)
+{
+    if (x >= 0 && x < mock->cfg.width && y >= 0 && y < mock->cfg.height) {
+        mock->ram[y * mock->cfg.width + x] = pixel;
+        mock->stats.pixels++;
+    }
+}
+
+/* Memory write from the current position, wrapping inside the window */
+static void _write_pixels(mock_panel_t *mock, const void *color, size_t size)
+{
+    int x1, y1, x2, y2;
+    _window(mock, &x1, &y1, &x2, &y2);
+    /* RA8875 MWCR0 bits 3:2 = 10: top to bottom first */
+    bool columns = (mock->cfg.model == MOCK_PANEL_RA8875) && ((mock->regs[RA8875_MWCR0] & 0x0C) == 0x08);
+    const uint8_t *bytes = color;
+
+    for (size_t i = 0; i + 1 < size; i += 2) {
+        uint16_t pixel = bytes[i] | (bytes[i + 1] << 8);
+        if (mock->cfg.swap_color_bytes) {
+            pixel = (uint16_t)((pixel >> 8) | (pixel << 8));
+        }
+        _put(mock, mock->cur_x, mock->cur_y, pixel);
+
+        if (columns) {
+            if (++mock->cur_y > y2) {
+                mock->cur_y = y1;
+                if (++mock->cur_x > x2) {
+                    mock->cur_x = x1;
+                }
+            }
+        } else if (++mock->cur_x > x2) {
+            mock->cur_x = x1;
+            if (++mock->cur_y > y2) {
+                mock->cur_y = y1;
+            }
+        }
+    }
+
+    if (mock->cfg.model == MOCK_PANEL_RA8875) {
+        /* the cursor registers follow the auto-increment */
+        mock->regs[0x46] = mock->cur_x & 0xFF;
+        mock->regs[0x47] = mock->cur_x >> 8;
+        mock->regs[0x48] = mock->cur_y & 0xFF;
+        mock->regs[0x49] = mock->cur_y >> 8;
+    }
+}
+
+static void _engine_done(mock_panel_t *mock)
+{
+    mock->engine_left = 0;
+    mock->regs[RA8875_DCR] &= ~0x80;
+    if (mock->cfg.wait_gpio_num != GPIO_NUM_NC) {
+        mock_gpio_set_input(mock->cfg.wait_gpio_num, 1);
+    }
+}
+
+/* One look at the busy state (DCR read or WAIT line), the engine finishes after engine_reads */
+static void _engine_poll(mock_panel_t *mock)
+{
+    if (mock->engine_left > 0 && --mock->engine_left == 0) {
+        _engine_done(mock);
+    }
+}
+
+static int _wait_line(gpio_num_t gpio_num, void *ctx)
+{
+    mock_panel_t *mock = ctx;
+
+    _engine_poll(mock);
+    return mock->engine_left == 0;
+}
+
+/* Square from 0x91..0x98, clipped to the active window, in the foreground color */
+static void _engine_start(mock_panel_t *mock, uint8_t dcr)
+{
+    int wx1, wy1, wx2, wy2;
+    _window(mock, &wx1, &wy1, &wx2, &wy2);
+    int x1 = _reg16(mock, RA8875_DLHSR0);
+    int y1 = _reg16(mock, RA8875_DLHSR0 + 2);
+    int x2 = _reg16(mock, RA8875_DLHSR0 + 4);
+    int y2 = _reg16(mock, RA8875_DLHSR0 + 6);
+    /* 65K colors: red and blue 5 bits, green 6 bits, as R5 G6 B5 in the panel RAM */
+    uint16_t pixel = (uint16_t)(((mock->regs[RA8875_FGCR0] & 0x1F) << 11) |
+                                ((mock->regs[RA8875_FGCR0 + 1] & 0x3F) << 5) |
+                                (mock->regs[RA8875_FGCR0 + 2] & 0x1F));
+
+    if (dcr & 0x10) {
+        for (int y = y1; y <= y2; y++) {
+            for (int x = x1; x <= x2; x++) {
+                bool edge = (x == x1 || x == x2 || y == y1 || y == y2);
+                if ((edge || (dcr & 0x20)) && x >= wx1 && x <= wx2 && y >= wy1 && y <= wy2) {
+                    _put(mock, x, y, pixel);
+                }
+            }
+        }
+    }
+    mock->stats.fills++;
+
+    mock->engine_left = mock->cfg.engine_reads;
+    if (mock->engine_left == 0) {
+        _engine_done(mock);
+        return;
+    }
+    if (mock->cfg.wait_gpio_num != GPIO_NUM_NC) {
+        mock_gpio_set_input(mock->cfg.wait_gpio_num, 0);
+    }
+}
+
+static void _finish(mock_panel_t *mock, const mock_panel_xfer_t *xfer)
+{
+    int ramwr = (mock->cfg.model == MOCK_PANEL_ST7789) ? DCS_RAMWR : RM68120_RAMWR;
+    int ramwrc = (mock->cfg.model == MOCK_PANEL_ST7789) ? DCS_RAMWRC : RM68120_RAMWRC;
+
+    if (mock->cfg.model == MOCK_PANEL_RA8875 || xfer->cmd == ramwr) {
+        if (mock->cfg.model != MOCK_PANEL_RA8875) {
+            int x1, y1, x2, y2;
+            _window(mock, &x1, &y1, &x2, &y2);
+            mock->cur_x = x1;
+            mock->cur_y = y1;
+        }
+        _write_pixels(mock, xfer->color, xfer->size);
+    } else if (xfer->cmd == ramwrc) {
+        _write_pixels(mock, xfer->color, xfer->size);
+    }
+
+    if (mock->cfg.on_color_trans_done) {
+        host_isr_enter();
+        mock->cfg.on_color_trans_done(&mock->base, NULL, mock->cfg.user_ctx);
+        host_isr_exit();
+    }
+}
+
+static size_t _complete(mock_panel_t *mock, size_t max)
+{
+    size_t n = 0;
+    while (n < max && mock->queue_count > 0) {
+        mock_panel_xfer_t xfer = mock->queue[mock->queue_head];
+        mock->queue_head = (mock->queue_head + 1) % MOCK_PANEL_QUEUE;
+        mock->queue_count--;
+        _finish(mock, &xfer);
+        n++;
+    }
+    return n;
+}
+
+/* A transaction that finishes the queued color transfers first */
+static void _drain(mock_panel_t *mock)
+{
+    if (mock->queue_count > 0) {
+        mock->stats.waits++;
+        _complete(mock, SIZE_MAX);
+    }
+}
+
+static esp_err_t _rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+
+    if (mock->cfg.no_rx) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    _drain(mock);
+    _log(mock, MOCK_PANEL_RX, lcd_cmd, NULL, param_size);
+    mock->stats.reads++;
+
+    memset(param, 0, param_size);
+    if (mock->cfg.model == MOCK_PANEL_RA8875 && param_size > 0) {
+        if (lcd_cmd == RA8875_DCR) {
+            _engine_poll(mock);
+        }
+        ((uint8_t *)param)[0] = mock->regs[lcd_cmd & 0xFF];
+    }
+    return ESP_OK;
+}
+
+static esp_err_t _tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+    const uint8_t *p = param;
+
+    /* as the i80 and SPI IO: queued color transfers are finished first */
+    _drain(mock);
+    _log(mock, MOCK_PANEL_CMD, lcd_cmd, param, param_size);
+    mock->stats.cmds++;
+    mock->stats.param_bytes += param_size;
+
+    if (mock->cfg.model == MOCK_PANEL_RA8875) {
+        if (mock->engine_left > 0) {
+            mock->stats.busy_access++;
+            return ESP_OK;
+        }
+        if (param_size > 0) {
+            mock->regs[lcd_cmd & 0xFF] = p[0];
+            if (lcd_cmd >= 0x46 && lcd_cmd <= 0x49) {
+                mock->cur_x = _reg16(mock, 0x46);
+                mock->cur_y = _reg16(mock, 0x48);
+            }
+            if (lcd_cmd == RA8875_DCR && (p[0] & 0x80)) {
+                _engine_start(mock, p[0]);
+            }
+        }
+    } else if (mock->cfg.model == MOCK_PANEL_ST7789) {
+        if ((lcd_cmd == DCS_CASET || lcd_cmd == DCS_RASET) && param_size == 4) {
+            memcpy(&mock->addr[(lcd_cmd == DCS_CASET) ? 0 : 4], p, 4);
+        }
+    } else if (param_size > 0) {
+        if (lcd_cmd >= RM68120_CASET && lcd_cmd < RM68120_CASET + 4) {
+            mock->addr[lcd_cmd - RM68120_CASET] = p[0];
+        } else if (lcd_cmd >= RM68120_RASET && lcd_cmd < RM68120_RASET + 4) {
+            mock->addr[4 + lcd_cmd - RM68120_RASET] = p[0];
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t _tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+
+    if (mock->fail_colors > 0 && mock->fail_after-- <= 0) {
+        mock->fail_colors--;
+        return ESP_FAIL;
+    }
+    if (mock->cfg.color_cmd_waits) {
+        _drain(mock);
+    }
+    _log(mock, MOCK_PANEL_COLOR, lcd_cmd, color, color_size);
+    mock->stats.colors++;
+    mock->stats.color_bytes += color_size;
+    if (mock->cfg.model == MOCK_PANEL_RA8875 && mock->engine_left > 0) {
+        mock->stats.busy_access++;
+    }
+
+    /* a full queue waits for the oldest transfer, as the i80 IO does */
+    if (mock->queue_count == MOCK_PANEL_QUEUE) {
+        _complete(mock, 1);
+    }
+    mock->queue[(mock->queue_head + mock->queue_count) % MOCK_PANEL_QUEUE] = (mock_panel_xfer_t) {
+        .cmd = lcd_cmd, .color = color, .size = color_size,
+    };
+    mock->queue_count++;
+    if (!mock->cfg.defer_done) {
+        _complete(mock, SIZE_MAX);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t _del(esp_lcd_panel_io_t *io)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+
+    if (mock->cfg.wait_gpio_num != GPIO_NUM_NC) {
+        mock_gpio_set_read_hook(mock->cfg.wait_gpio_num, NULL, NULL);
+    }
+    free(mock->ram);
+    free(mock->log);
+    free(mock);
+    return ESP_OK;
+}
+
+esp_err_t mock_panel_io_new(const mock_panel_io_cfg_t *cfg, esp_lcd_panel_io_handle_t *ret_io)
+{
+    mock_panel_t *mock = calloc(1, sizeof(mock_panel_t));
+    if (mock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    mock->ram = calloc((size_t)cfg->width * cfg->height, sizeof(uint16_t));
+    if (mock->ram == NULL) {
+        free(mock);
+        return ESP_ERR_NO_MEM;
+    }
+    mock->cfg = *cfg;
+    mock->base.rx_param = _rx_param;
+    mock->base.tx_param = _tx_param;
+    mock->base.tx_color = _tx_color;
+    mock->base.del = _del;
+
+    if (cfg->wait_gpio_num != GPIO_NUM_NC) {
+        /* idle: WAIT high */
+        mock_gpio_set_input(cfg->wait_gpio_num, 1);
+        mock_gpio_set_read_hook(cfg->wait_gpio_num, _wait_line, mock);
+    }
+
+    *ret_io = &mock->base;
+    return ESP_OK;
+}
+
+const uint16_t *mock_panel_io_ram(esp_lcd_panel_io_handle_t io)
+{
+    return __containerof(io, mock_panel_t, base)->ram;
+}
+
+uint16_t mock_panel_io_pixel(esp_lcd_panel_io_handle_t io, int x, int y)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+    return mock->ram[y * mock->cfg.width + x];
+}
+
+uint8_t mock_panel_io_reg(esp_lcd_panel_io_handle_t io, int reg)
+{
+    return __containerof(io, mock_panel_t, base)->regs[reg & 0xFF];
+}
+
+void mock_panel_io_get_stats(esp_lcd_panel_io_handle_t io, mock_panel_io_stats_t *stats, bool reset)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+
+    *stats = mock->stats;
+    if (reset) {
+        memset(&mock->stats, 0, sizeof(mock->stats));
+    }
+}
+
+const mock_panel_entry_t *mock_panel_io_log(esp_lcd_panel_io_handle_t io, size_t *count)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+
+    *count = mock->log_count;
+    return mock->log;
+}
+
+void mock_panel_io_log_clear(esp_lcd_panel_io_handle_t io)
+{
+    __containerof(io, mock_panel_t, base)->log_count = 0;
+}
+
+size_t mock_panel_io_complete(esp_lcd_panel_io_handle_t io, size_t max)
+{
+    return _complete(__containerof(io, mock_panel_t, base), max);
+}
+
+size_t mock_panel_io_pending(esp_lcd_panel_io_handle_t io)
+{
+    return __containerof(io, mock_panel_t, base)->queue_count;
+}
+
+void mock_panel_io_fail_colors(esp_lcd_panel_io_handle_t io, int after, int n)
+{
+    mock_panel_t *mock = __containerof(io, mock_panel_t, base);
+
+    mock->fail_after = after;
+    mock->fail_colors = n;
+}
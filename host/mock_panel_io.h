@@ -0,0 +1,95 @@
+/* Mock esp_lcd_panel_io for the host checks
+
+   Stands in for the i80 or SPI bus and the panel controller behind it: every command, parameter and
+   color transfer is logged and counted, and a model of the controller (RA8875 registers, window,
+   cursor and drawing engine, RM68120 or ST7789 address window) writes the pixels into a virtual
+   panel RAM.
+   Put lcd_trace in front of it for the modeled bus time. */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "driver/gpio.h"
+#include "esp_lcd_panel_io.h"
+
+typedef enum {
+    MOCK_PANEL_RA8875,
+    MOCK_PANEL_RM68120,
+    MOCK_PANEL_ST7789,      /* MIPI DCS on SPI: 8-bit CASET/RASET with 4 parameter bytes, RAMWR */
+} mock_panel_model_t;
+
+typedef enum {
+    MOCK_PANEL_CMD,     /* command with or without parameters */
+    MOCK_PANEL_COLOR,   /* command followed by color data */
+    MOCK_PANEL_RX,      /* read */
+} mock_panel_op_t;
+
+/* One logged transaction */
+typedef struct {
+    uint8_t op;         /* mock_panel_op_t */
+    uint8_t data[3];    /* first parameter bytes */
+    int cmd;
+    uint32_t size;      /* parameter or color bytes */
+} mock_panel_entry_t;
+
+typedef struct {
+    mock_panel_model_t model;
+    int width;
+    int height;
+    bool swap_color_bytes;      /* as the i80 IO flag: the panel RAM gets the pixels byte swapped */
+    bool defer_done;            /* color transfers stay queued until mock_panel_io_complete() or the next
+                                   command, which waits for them as the i80 IO does */
+    bool color_cmd_waits;       /* the command of a color transfer waits for the queued ones too, as the
+                                   SPI IO sends it polled */
+    gpio_num_t wait_gpio_num;   /* RA8875 WAIT line, low while the drawing engine runs, GPIO_NUM_NC for none */
+    uint32_t engine_reads;      /* RA8875: reads (DCR or WAIT line) until the drawing engine is done, 0 = at once */
+    bool no_rx;                 /* rx_param returns ESP_ERR_NOT_SUPPORTED, as a panel IO that cannot read */
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void *user_ctx;
+} mock_panel_io_cfg_t;
+
+typedef struct {
+    uint32_t cmds;          /* command transactions */
+    uint32_t param_bytes;
+    uint32_t colors;        /* color transactions */
+    uint32_t color_bytes;
+    uint32_t reads;
+    uint32_t pixels;        /* panel RAM pixels written, by the bus or the drawing engine */
+    uint32_t fills;         /* RA8875 drawing engine runs */
+    uint32_t busy_access;   /* RA8875 writes while the drawing engine was running: the controller drops them */
+    uint32_t waits;         /* transactions that had to wait for queued color transfers to finish */
+} mock_panel_io_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_err_t mock_panel_io_new(const mock_panel_io_cfg_t *cfg, esp_lcd_panel_io_handle_t *ret_io);
+
+/* Panel RAM, width * height pixels as the controller holds them */
+const uint16_t *mock_panel_io_ram(esp_lcd_panel_io_handle_t io);
+uint16_t mock_panel_io_pixel(esp_lcd_panel_io_handle_t io, int x, int y);
+
+/* RA8875 register as last written (or as the model set it) */
+uint8_t mock_panel_io_reg(esp_lcd_panel_io_handle_t io, int reg);
+
+/* Counters since the previous reset */
+void mock_panel_io_get_stats(esp_lcd_panel_io_handle_t io, mock_panel_io_stats_t *stats, bool reset);
+
+/* Every transaction since the previous clear */
+const mock_panel_entry_t *mock_panel_io_log(esp_lcd_panel_io_handle_t io, size_t *count);
+void mock_panel_io_log_clear(esp_lcd_panel_io_handle_t io);
+
+/* With defer_done: finishes up to max queued color transfers, oldest first, and calls
+   on_color_trans_done for each (as an ISR). Returns how many were finished. */
+size_t mock_panel_io_complete(esp_lcd_panel_io_handle_t io, size_t max);
+size_t mock_panel_io_pending(esp_lcd_panel_io_handle_t io);
+
+/* After the next `after` color transfers, n of them fail without being queued */
+void mock_panel_io_fail_colors(esp_lcd_panel_io_handle_t io, int after, int n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,115 @@
+/* SPI bus stand-in, see mock_spi.h */
+#include <stdlib.h>
+
+#include "driver/spi_master.h"
+#include "esp_lcd_panel_interface.h"
+#include "esp_lcd_panel_vendor.h"
+#include "lcd_trace.h"
+#include "mock_spi.h"
+
+static mock_panel_io_cfg_t panel_cfg;
+static uint32_t overhead_ns;
+static esp_lcd_panel_io_handle_t panel_io;
+static esp_lcd_panel_io_handle_t trace_io;
+
+void mock_spi_set_panel(const mock_panel_io_cfg_t *cfg, uint32_t trans_overhead_ns)
+{
+    panel_cfg = *cfg;
+    overhead_ns = trans_overhead_ns;
+}
+
+esp_lcd_panel_io_handle_t mock_spi_panel_io(void)
+{
+    return panel_io;
+}
+
+esp_lcd_panel_io_handle_t mock_spi_trace_io(void)
+{
+    return trace_io;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t *bus_config, spi_dma_chan_t dma_chan)
+{
+    return (bus_config == NULL) ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_io_spi(esp_lcd_spi_bus_handle_t bus, const esp_lcd_panel_io_spi_config_t *io_config, esp_lcd_panel_io_handle_t *ret_io)
+{
+    if (io_config == NULL || ret_io == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* the SPI IO sends the buffer in memory order, the panel takes the first byte as the high one */
+    mock_panel_io_cfg_t cfg = panel_cfg;
+    cfg.swap_color_bytes = true;
+    cfg.color_cmd_waits = true;
+    cfg.on_color_trans_done = io_config->on_color_trans_done;
+    cfg.user_ctx = io_config->user_ctx;
+    esp_err_t ret = mock_panel_io_new(&cfg, &panel_io);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    const lcd_trace_cfg_t trace_cfg = {
+        .pclk_hz = io_config->pclk_hz,
+        .bus_width = 1,
+        .cmd_bits = io_config->lcd_cmd_bits,
+        .param_bits = io_config->lcd_param_bits,
+        .trans_overhead_ns = overhead_ns,
+    };
+    ret = lcd_trace_new_io(panel_io, &trace_cfg, &trace_io);
+    if (ret != ESP_OK) {
+        esp_lcd_panel_io_del(panel_io);
+        return ret;
+    }
+    *ret_io = trace_io;
+    return ESP_OK;
+}
+
+/* The panel ops only set up the controller, which the mock panel IO does not model */
+static esp_err_t _panel_nop(esp_lcd_panel_t *panel)
+{
+    return ESP_OK;
+}
+
+static esp_err_t _panel_del(esp_lcd_panel_t *panel)
+{
+    free(panel);
+    return ESP_OK;
+}
+
+static esp_err_t _panel_bool(esp_lcd_panel_t *panel, bool on)
+{
+    return ESP_OK;
+}
+
+static esp_err_t _panel_mirror(esp_lcd_panel_t *panel, bool x_axis, bool y_axis)
+{
+    return ESP_OK;
+}
+
+static esp_err_t _panel_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_st7789(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
+{
+    if (io == NULL || panel_dev_config == NULL || ret_panel == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_lcd_panel_t *panel = calloc(1, sizeof(*panel));
+    if (panel == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    panel->reset = _panel_nop;
+    panel->init = _panel_nop;
+    panel->del = _panel_del;
+    panel->mirror = _panel_mirror;
+    panel->swap_xy = _panel_bool;
+    panel->set_gap = _panel_set_gap;
+    panel->invert_color = _panel_bool;
+    panel->disp_on_off = _panel_bool;
+    *ret_panel = panel;
+    return ESP_OK;
+}
@@ -0,0 +1,29 @@
+/* SPI bus stand-in for code that creates its own bus and ST7789 panel (main/display/lcd_spi.c)
+
+   esp_lcd_new_panel_io_spi() returns a mock panel (host/mock_panel_io.h) behind a tracer
+   (main/display/lcd_trace.h) set up from the IO config, one data line: the pixels land in the mock
+   panel RAM, the bus time is modeled from the pixel clock and transaction overhead. As the SPI panel
+   IO, every command waits for the queued color transfers, also the one in front of the pixels. */
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_lcd_panel_io.h"
+#include "mock_panel_io.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Panel of the next esp_lcd_new_panel_io_spi(), the completion callback comes from the IO config */
+void mock_spi_set_panel(const mock_panel_io_cfg_t *cfg, uint32_t trans_overhead_ns);
+
+/* The mock panel of the last created IO: RAM, log, counters */
+esp_lcd_panel_io_handle_t mock_spi_panel_io(void);
+
+/* The tracer in front of it: modeled bus time (lcd_trace_frame()) */
+esp_lcd_panel_io_handle_t mock_spi_trace_io(void);
+
+#ifdef __cplusplus
+}
+#endif
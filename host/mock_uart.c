@@ -0,0 +1,57 @@
+/* UART ports, see mock_uart.h */
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "mock_uart.h"
+
+#define MOCK_UART_PORTS     3
+
+typedef struct {
+    int fd;
+    bool installed;
+} mock_uart_t;
+
+static mock_uart_t uarts[MOCK_UART_PORTS] = { { -1, false }, { -1, false }, { -1, false } };
+
+static mock_uart_t *uart(uart_port_t uart_num)
+{
+    return (uart_num >= 0 && uart_num < MOCK_UART_PORTS) ? &uarts[uart_num] : NULL;
+}
+
+void mock_uart_set_fd(uart_port_t uart_num, int fd)
+{
+    mock_uart_t *u = uart(uart_num);
+    assert(u != NULL);
+    u->fd = fd;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+esp_err_t uart_driver_install(uart_port_t uart_num, int rx_buffer_size, int tx_buffer_size, int queue_size, QueueHandle_t *uart_queue, int intr_alloc_flags)
+{
+    mock_uart_t *u = uart(uart_num);
+    if (u == NULL || u->fd < 0) {
+        return ESP_FAIL;
+    }
+    u->installed = true;
+    return ESP_OK;
+}
+
+bool uart_is_driver_installed(uart_port_t uart_num)
+{
+    mock_uart_t *u = uart(uart_num);
+    return u != NULL && u->installed;
+}
+
+int uart_read_bytes(uart_port_t uart_num, void *buf, uint32_t length, TickType_t ticks_to_wait)
+{
+    mock_uart_t *u = uart(uart_num);
+    if (u == NULL || !u->installed) {
+        return -1;
+    }
+    ssize_t n = read(u->fd, buf, length);
+    if (n < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    }
+    return (int)n;
+}
@@ -0,0 +1,15 @@
+/* UART ports behind host/include/driver/uart.h */
+#pragma once
+
+#include "driver/uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The port reads from fd from now on (made non-blocking), the driver install succeeds */
+void mock_uart_set_fd(uart_port_t uart_num, int fd);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,190 @@
+/* bsp_i2c.c on a simulated bus: register writes and reads, the panel IO protocol, priorities
+   between queued jobs, a batch keeping the bus, and the backoff of a device that NAKs */
+#include <string.h>
+#include <unistd.h>
+
+#include "bsp_i2c.h"
+#include "mock_i2c.h"
+#include "check.h"
+
+#define EXPANDER    0x20    /* IO expander */
+#define TOUCH       0x38
+#define HUD         0x3C    /* SSD1306 display */
+#define MISSING     0x50
+#define STRETCH     0x51
+#define FAILING     0x52
+
+static uint8_t done_order[16];
+static size_t done_count;
+static int color_done_calls;
+
+static void job_done(esp_err_t err, void *ctx)
+{
+    done_order[done_count++] = (uint8_t)(uintptr_t)ctx;
+}
+
+static bool color_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    color_done_calls++;
+    return false;
+}
+
+static const bsp_i2c_dev_stats_t *dev_stats(uint8_t addr)
+{
+    static bsp_i2c_dev_stats_t stats[BSP_I2C_MAX_DEVICES];
+    size_t n = bsp_i2c_get_stats(stats, BSP_I2C_MAX_DEVICES);
+
+    for (size_t i = 0; i < n; i++) {
+        if (stats[i].addr == addr) {
+            return &stats[i];
+        }
+    }
+    return NULL;
+}
+
+/* Bus order of the transfers since the previous call */
+static size_t logged(uint8_t *addrs, size_t max)
+{
+    size_t n;
+    const mock_i2c_entry_t *log = mock_i2c_log(&n);
+
+    for (size_t i = 0; i < n && i < max; i++) {
+        addrs[i] = log[i].addr;
+    }
+    mock_i2c_log_clear();
+    return n;
+}
+
+int main(void)
+{
+    static const uint8_t devices[] = { EXPANDER, TOUCH, HUD };
+    for (size_t i = 0; i < sizeof(devices); i++) {
+        mock_i2c_set_dev(&(mock_i2c_dev_cfg_t) { .addr = devices[i] });
+    }
+    mock_i2c_set_dev(&(mock_i2c_dev_cfg_t) { .addr = MISSING, .nak = true });
+    mock_i2c_set_dev(&(mock_i2c_dev_cfg_t) { .addr = STRETCH, .stretch_ms = 2 * BSP_I2C_TIMEOUT_MS });
+    mock_i2c_set_dev(&(mock_i2c_dev_cfg_t) { .addr = FAILING, .nak = true });
+    ESP_ERROR_CHECK(bsp_i2c_start(0, mock_i2c_xfer, NULL));
+
+    /* register write, then read back with a repeated start */
+    static const uint8_t out[] = { 0x02, 0x5A, 0xA5 };
+    ESP_ERROR_CHECK(bsp_i2c_write(BSP_I2C_PRIO_NORMAL, EXPANDER, out, sizeof(out)));
+    CHECK_EQ(mock_i2c_regs(EXPANDER)[2], 0x5A);
+    CHECK_EQ(mock_i2c_regs(EXPANDER)[3], 0xA5);
+    uint8_t reg = 0x02, in[2] = { 0 };
+    const bsp_i2c_xfer_t read = { .addr = EXPANDER, .head = &reg, .head_len = 1, .rx = in, .rx_len = 2 };
+    ESP_ERROR_CHECK(bsp_i2c_run(BSP_I2C_PRIO_NORMAL, &read, 1));
+    CHECK_EQ(in[0], 0x5A);
+    CHECK_EQ(in[1], 0xA5);
+
+    /* the panel IO sends the control byte (D/C# in bit 6) before the command and the pixels */
+    const esp_lcd_panel_io_i2c_config_t io_config = {
+        .dev_addr = HUD,
+        .control_phase_bytes = 1,
+        .dc_bit_offset = 6,
+        .lcd_cmd_bits = 8,
+        .lcd_param_bits = 8,
+        .on_color_trans_done = color_done,
+    };
+    esp_lcd_panel_io_handle_t io;
+    ESP_ERROR_CHECK(bsp_i2c_new_panel_io(&io_config, BSP_I2C_PRIO_LOW, &io));
+    mock_i2c_log_clear();
+    static const uint8_t contrast = 0x7F;
+    static uint8_t page[128];
+    memset(page, 0xF0, sizeof(page));
+    ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io, 0xAF, NULL, 0));
+    ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io, 0x81, &contrast, 1));
+    ESP_ERROR_CHECK(esp_lcd_panel_io_tx_color(io, -1, page, sizeof(page)));
+    size_t n;
+    const mock_i2c_entry_t *log = mock_i2c_log(&n);
+    CHECK_EQ(n, 3);
+    CHECK_EQ(log[0].write_len, 2);
+    CHECK_EQ(log[0].bytes[0], 0x00);
+    CHECK_EQ(log[0].bytes[1], 0xAF);
+    CHECK_EQ(log[1].write_len, 3);
+    CHECK_EQ(log[1].bytes[2], 0x7F);
+    CHECK_EQ(log[2].write_len, 1 + sizeof(page));
+    CHECK_EQ(log[2].bytes[0], 0x40);
+    CHECK_EQ(log[2].bytes[1], 0xF0);
+    CHECK_EQ(color_done_calls, 1);
+    mock_i2c_log_clear();
+
+    /* jobs queued behind a busy bus run high priority first, FIFO within a priority */
+    uint8_t addrs[16];
+    const uint8_t touch_reg = 0x02;
+    uint8_t touch_data[5];
+    const bsp_i2c_xfer_t touch = { .addr = TOUCH, .head = &touch_reg, .head_len = 1, .rx = touch_data, .rx_len = 5 };
+    const bsp_i2c_xfer_t expander = { .addr = EXPANDER, .data = out, .data_len = sizeof(out) };
+    const bsp_i2c_xfer_t hud = { .addr = HUD, .data = page, .data_len = 17 };
+    done_count = 0;
+    mock_i2c_hold(EXPANDER);
+    ESP_ERROR_CHECK(bsp_i2c_submit(BSP_I2C_PRIO_NORMAL, &expander, 1, job_done, (void *)1));
+    mock_i2c_wait_held();
+    ESP_ERROR_CHECK(bsp_i2c_submit(BSP_I2C_PRIO_LOW, &hud, 1, job_done, (void *)2));
+    ESP_ERROR_CHECK(bsp_i2c_submit(BSP_I2C_PRIO_NORMAL, &expander, 1, job_done, (void *)3));
+    ESP_ERROR_CHECK(bsp_i2c_submit(BSP_I2C_PRIO_HIGH, &touch, 1, job_done, (void *)4));
+    usleep(5000);
+    mock_i2c_release();
+    ESP_ERROR_CHECK(bsp_i2c_run(BSP_I2C_PRIO_LOW, &hud, 1));
+    CHECK_EQ(done_count, 4);
+    CHECK_EQ(done_order[0], 1);
+    CHECK_EQ(done_order[1], 4);
+    CHECK_EQ(done_order[2], 3);
+    CHECK_EQ(done_order[3], 2);
+    CHECK_EQ(logged(addrs, 16), 5);
+    CHECK_EQ(addrs[1], TOUCH);
+    /* the touch job waited for the held transfer */
+    CHECK(dev_stats(TOUCH)->wait_us_max >= 5000);
+
+    /* a batch keeps the bus: the touch job submitted during its first transfer goes after it */
+    const bsp_i2c_xfer_t batch[3] = { hud, hud, hud };
+    done_count = 0;
+    mock_i2c_hold(HUD);
+    ESP_ERROR_CHECK(bsp_i2c_submit(BSP_I2C_PRIO_LOW, batch, 3, job_done, (void *)5));
+    mock_i2c_wait_held();
+    ESP_ERROR_CHECK(bsp_i2c_submit(BSP_I2C_PRIO_HIGH, &touch, 1, job_done, (void *)6));
+    mock_i2c_release();
+    ESP_ERROR_CHECK(bsp_i2c_run(BSP_I2C_PRIO_LOW, &hud, 1));
+    CHECK_EQ(done_order[0], 5);
+    CHECK_EQ(done_order[1], 6);
+    CHECK_EQ(logged(addrs, 16), 5);
+    CHECK_EQ(addrs[2], HUD);
+    CHECK_EQ(addrs[3], TOUCH);
+
+    /* a failing transfer ends its batch with its error */
+    const bsp_i2c_xfer_t failing[3] = { expander, { .addr = FAILING, .data = out, .data_len = 1 }, expander };
+    CHECK_EQ(bsp_i2c_run(BSP_I2C_PRIO_NORMAL, failing, 3), ESP_FAIL);
+    CHECK_EQ(logged(addrs, 16), 2);
+
+    /* clock stretching past the timeout */
+    CHECK_EQ(bsp_i2c_write(BSP_I2C_PRIO_NORMAL, STRETCH, out, 1), ESP_ERR_TIMEOUT);
+    CHECK_EQ(dev_stats(STRETCH)->timeouts, 1);
+    CHECK(dev_stats(STRETCH)->bus_us_max >= BSP_I2C_TIMEOUT_MS * 1000);
+    CHECK_EQ(logged(addrs, 16), 1);
+
+    /* a device that NAKs is skipped after BSP_I2C_BACKOFF_ERRORS, the others are not */
+    for (int i = 0; i < BSP_I2C_BACKOFF_ERRORS; i++) {
+        CHECK_EQ(bsp_i2c_write(BSP_I2C_PRIO_NORMAL, MISSING, out, 1), ESP_FAIL);
+    }
+    CHECK_EQ(bsp_i2c_write(BSP_I2C_PRIO_NORMAL, MISSING, out, 1), ESP_ERR_INVALID_STATE);
+    ESP_ERROR_CHECK(bsp_i2c_write(BSP_I2C_PRIO_NORMAL, EXPANDER, out, 1));
+    CHECK_EQ(logged(addrs, 16), BSP_I2C_BACKOFF_ERRORS + 1);
+    const bsp_i2c_dev_stats_t *s = dev_stats(MISSING);
+    CHECK_EQ(s->xfers, BSP_I2C_BACKOFF_ERRORS);
+    CHECK_EQ(s->errors, BSP_I2C_BACKOFF_ERRORS);
+    CHECK_EQ(s->skipped, 1);
+
+    /* answering again after the backoff */
+    mock_i2c_set_dev(&(mock_i2c_dev_cfg_t) { .addr = MISSING });
+    usleep((BSP_I2C_BACKOFF_MS + 20) * 1000);
+    ESP_ERROR_CHECK(bsp_i2c_write(BSP_I2C_PRIO_NORMAL, MISSING, out, 1));
+
+    /* bus time of a page: 130 bytes at 400 kHz */
+    s = dev_stats(HUD);
+    CHECK(s->bus_us_max >= 130 * 22);
+    printf("bsp_i2c: page %u us on the bus, touch waited up to %u us\n",
+           (unsigned)s->bus_us_max, (unsigned)dev_stats(TOUCH)->wait_us_max);
+
+    esp_lcd_panel_io_del(io);
+    return check_result("bsp_i2c");
+}
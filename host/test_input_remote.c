@@ -0,0 +1,215 @@
+/* input_remote.c: the packet parser on its own (typed keys, sequence gaps, late and malformed
+   packets, the sender clock moved to the local one), then the console on a pseudo terminal and
+   UDP on the loopback interface (also a datagram too long), polled as the game does */
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "esp_timer.h"
+#include "input_remote.h"
+#include "mock_uart.h"
+#include "check.h"
+
+static input_event_t evs[16];
+
+static int parse(input_remote_parser_t *parser, const char *s, uint32_t rx_us, int max)
+{
+    return input_remote_parse(parser, (const uint8_t *)s, strlen(s), rx_us, evs, max);
+}
+
+/* Polls as the game does once per tick, until want events came or 200 ms passed */
+static int poll_events(int want)
+{
+    int n = 0;
+
+    for (int i = 0; i < 200 && n < want; i++) {
+        n += input_remote_poll(evs + n, 16 - n);
+        if (n < want) {
+            usleep(1000);
+        }
+    }
+    return n;
+}
+
+static void parser_checks(void)
+{
+    input_remote_stats_t stats = { 0 };
+    input_remote_parser_t parser;
+    input_remote_parser_init(&parser, &stats);
+
+    /* typed keys carry the time of arrival, other bytes are ignored */
+    CHECK_EQ(parse(&parser, "8q4\r6", 1000, 16), 3);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_UP);
+    CHECK_EQ(evs[1].button, INPUT_BUTTON_LEFT);
+    CHECK_EQ(evs[2].button, INPUT_BUTTON_RIGHT);
+    CHECK_EQ(evs[2].t_us, 1000);
+
+    /* the first packet sets the clock offset (4000) */
+    CHECK_EQ(parse(&parser, "#0 5000 2z\n", 9000, 16), 2);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_DOWN);
+    CHECK_EQ(evs[1].button, INPUT_BUTTON_A);
+    CHECK_EQ(evs[1].t_us, 9000);
+    /* a packet that waited somewhere keeps the offset: the time of the press, not of arrival */
+    CHECK_EQ(parse(&parser, "#1 6000 8\n", 10500, 16), 1);
+    CHECK_EQ(evs[0].t_us, 10000);
+    /* a faster one lowers it */
+    CHECK_EQ(parse(&parser, "#2 7000 4\n", 10800, 16), 1);
+    CHECK_EQ(evs[0].t_us, 10800);
+    CHECK_EQ(stats.packets, 3);
+    CHECK_EQ(stats.dropped, 0);
+
+    /* two packets lost, then one of them arrives late */
+    CHECK_EQ(parse(&parser, "#5 8000 6\n", 11900, 16), 1);
+    CHECK_EQ(stats.dropped, 2);
+    CHECK_EQ(parse(&parser, "#4 7900 6\n", 12000, 16), 0);
+    CHECK_EQ(stats.late, 1);
+
+    /* the sender restarts at 0 */
+    CHECK_EQ(parse(&parser, "#0 100 x\n", 12100, 16), 1);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_B);
+    CHECK_EQ(stats.late, 1);
+
+    /* a packet split over two reads */
+    CHECK_EQ(parse(&parser, "#1 2", 12200, 16), 0);
+    CHECK_EQ(parse(&parser, "00 8\n", 12300, 16), 1);
+    CHECK_EQ(stats.packets, 6);
+
+    /* no sequence, no time, too long */
+    CHECK_EQ(parse(&parser, "#abc 8\n#2 8\n", 12400, 16), 0);
+    char line[INPUT_REMOTE_LINE_MAX + 8] = "#3 ";
+    memset(line + 3, '1', INPUT_REMOTE_LINE_MAX);
+    strcpy(line + 3 + INPUT_REMOTE_LINE_MAX, " 8\n");
+    CHECK_EQ(parse(&parser, line, 12500, 16), 0);
+    CHECK_EQ(stats.malformed, 3);
+    /* the parser is in sync again after a bad line */
+    CHECK_EQ(parse(&parser, "#2 300 6\n", 12600, 16), 1);
+
+    /* more keys than room: the rest are counted, not written */
+    uint32_t keys = stats.keys;
+    CHECK_EQ(parse(&parser, "#3 400 8888\n", 12700, 2), 2);
+    CHECK_EQ(stats.keys - keys, 4);
+
+    /* a sender clock that falls 200 us behind: every 16 ms the offset rises by 3 us, up to the new one */
+    input_remote_parser_init(&parser, &stats);
+    CHECK_EQ(parse(&parser, "#0 1000 8\n", 2000, 16), 1);
+    char packet[32];
+    for (int i = 1; i <= 100; i++) {
+        uint32_t rx_us = 2000 + i * 16000;
+        snprintf(packet, sizeof(packet), "#%d %u 8\n", i, (unsigned)(rx_us - 1200));
+        CHECK_EQ(parse(&parser, packet, rx_us, 16), 1);
+        if (i == 1) {
+            CHECK_EQ(rx_us - evs[0].t_us, 197);
+        }
+    }
+    CHECK_EQ(evs[0].t_us, 2000 + 100 * 16000);
+}
+
+/* The console: a pseudo terminal in raw mode, as the UART gets every byte as typed */
+static int open_console(void)
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        return -1;
+    }
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (slave < 0) {
+        return -1;
+    }
+    struct termios tio;
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    mock_uart_set_fd(0, slave);
+    return master;
+}
+
+static void send_udp(int fd, const char *s)
+{
+    struct sockaddr_in to = {
+        .sin_family = AF_INET,
+        .sin_port = htons(INPUT_REMOTE_UDP_PORT),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    CHECK(sendto(fd, s, strlen(s), 0, (struct sockaddr *)&to, sizeof(to)) == (ssize_t)strlen(s));
+}
+
+int main(void)
+{
+    parser_checks();
+
+    int console = open_console();
+    CHECK(console >= 0);
+    CHECK(input_remote_start());
+    CHECK_EQ(input_remote_poll(evs, 16), 0);
+
+    /* typed keys on the console */
+    uint32_t t0 = (uint32_t)esp_timer_get_time();
+    CHECK_EQ(write(console, "8", 1), 1);
+    CHECK_EQ(poll_events(1), 1);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_UP);
+    CHECK(evs[0].t_us >= t0 && evs[0].t_us <= (uint32_t)esp_timer_get_time());
+    CHECK_EQ(write(console, "#7 500 4x\n", 10), 10);
+    CHECK_EQ(poll_events(2), 2);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_LEFT);
+    CHECK_EQ(evs[1].button, INPUT_BUTTON_B);
+    /* half a packet gives nothing until the rest arrives */
+    CHECK_EQ(write(console, "#8 600 ", 7), 7);
+    CHECK_EQ(poll_events(1), 0);
+    CHECK_EQ(write(console, "6\n", 2), 2);
+    CHECK_EQ(poll_events(1), 1);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_RIGHT);
+
+    /* UDP: a datagram is a packet, no newline needed */
+    int udp = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    CHECK(udp >= 0);
+    input_remote_stats_t stats;
+    input_remote_get_stats(&stats);
+    send_udp(udp, "#0 1000 86");
+    CHECK_EQ(poll_events(2), 2);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_UP);
+    CHECK_EQ(evs[1].button, INPUT_BUTTON_RIGHT);
+    send_udp(udp, "#1 1100 2");
+    send_udp(udp, "#3 1200 z");
+    CHECK_EQ(poll_events(2), 2);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_DOWN);
+    CHECK_EQ(evs[1].button, INPUT_BUTTON_A);
+    CHECK(evs[1].t_us <= (uint32_t)esp_timer_get_time());
+
+    /* both sources in one poll, more than fits: the rest comes with the next poll */
+    for (int i = 0; i < 3; i++) {
+        CHECK_EQ(write(console, "8888", 4), 4);
+    }
+    send_udp(udp, "#4 1300 2222");
+    usleep(20000);
+    CHECK_EQ(input_remote_poll(evs, 8), 8);
+    CHECK_EQ(poll_events(8), 8);
+
+    /* a datagram too long for the buffer is dropped: cut, its last packet would look complete */
+    char big[101] = "#5 1400 8888888888888888888888\n#6 1410 ";
+    size_t head = strlen(big);
+    memset(big + head, '4', sizeof(big) - 1 - head);
+    big[sizeof(big) - 1] = '\0';
+    send_udp(udp, big);
+    send_udp(udp, "#7 1500 4");
+    CHECK_EQ(poll_events(1), 1);
+    CHECK_EQ(evs[0].button, INPUT_BUTTON_LEFT);
+    CHECK_EQ(input_remote_poll(evs, 16), 0);
+
+    input_remote_stats_t after;
+    input_remote_get_stats(&after);
+    CHECK_EQ(after.packets - stats.packets, 5);
+    CHECK_EQ(after.dropped - stats.dropped, 3);
+    CHECK_EQ(after.keys - stats.keys, 4 + 16 + 1);
+    CHECK_EQ(after.malformed, 1);
+
+    close(udp);
+    close(console);
+    return check_result("input_remote");
+}
@@ -0,0 +1,90 @@
+/* lcd_fb_copy_rect(): clipping, row and full line copies, returned pixel count */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd_fb.h"
+#include "check.h"
+
+#define FB_W 32
+#define FB_H 20
+
+static uint16_t fb[FB_W * FB_H];
+static uint16_t src[64 * 64];
+
+/* Source pixel value: where it was in the unclipped rectangle */
+static uint16_t pix(int x, int y)
+{
+    return (uint16_t)(0x8000 | (y << 7) | x);
+}
+
+static void fill_src(int w, int h)
+{
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            src[y * w + x] = pix(x, y);
+        }
+    }
+}
+
+/* Copies x1..x2-1, y1..y2-1 and checks every frame buffer pixel: inside the clipped
+   rectangle from the source, outside untouched */
+static void check_copy(int x1, int y1, int x2, int y2)
+{
+    int w = x2 - x1, h = y2 - y1;
+    fill_src(w, h);
+    memset(fb, 0, sizeof(fb));
+
+    int n = lcd_fb_copy_rect(fb, FB_W, FB_H, x1, y1, x2, y2, src);
+
+    int expected = 0;
+    int bad = 0;
+    for (int y = 0; y < FB_H; y++) {
+        for (int x = 0; x < FB_W; x++) {
+            bool inside = x >= x1 && x < x2 && y >= y1 && y < y2;
+            uint16_t want = inside ? pix(x - x1, y - y1) : 0;
+            expected += inside;
+            bad += fb[y * FB_W + x] != want;
+        }
+    }
+    if (bad) {
+        printf("rect %d,%d-%d,%d: %d wrong pixels\n", x1, y1, x2, y2, bad);
+    }
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(n, expected);
+}
+
+int main(void)
+{
+    /* inside, partial lines */
+    check_copy(3, 4, 11, 9);
+    check_copy(0, 0, 1, 1);
+    check_copy(FB_W - 1, FB_H - 1, FB_W, FB_H);
+    /* full lines, one memcpy */
+    check_copy(0, 5, FB_W, 12);
+    check_copy(0, 0, FB_W, FB_H);
+    /* clipped on every side, the source stride stays the unclipped width */
+    check_copy(-5, 2, 7, 6);
+    check_copy(2, -3, 9, 4);
+    check_copy(25, 15, 40, 30);
+    check_copy(-4, -4, FB_W + 4, FB_H + 4);
+    /* clipped to full lines, still a row copy: the source is wider than the frame buffer */
+    check_copy(-1, 3, FB_W + 1, 6);
+
+    /* nothing to copy */
+    fill_src(8, 8);
+    memset(fb, 0, sizeof(fb));
+    CHECK_EQ(lcd_fb_copy_rect(fb, FB_W, FB_H, 40, 0, 48, 8, src), 0);
+    CHECK_EQ(lcd_fb_copy_rect(fb, FB_W, FB_H, 0, -8, 8, 0, src), 0);
+    CHECK_EQ(lcd_fb_copy_rect(fb, FB_W, FB_H, 5, 5, 5, 9, src), 0);
+    CHECK_EQ(lcd_fb_copy_rect(fb, FB_W, FB_H, 9, 5, 5, 9, src), 0);
+    CHECK_EQ(lcd_fb_copy_rect(NULL, FB_W, FB_H, 0, 0, 8, 8, src), 0);
+    CHECK_EQ(lcd_fb_copy_rect(fb, FB_W, FB_H, 0, 0, 8, 8, NULL), 0);
+    int touched = 0;
+    for (int i = 0; i < FB_W * FB_H; i++) {
+        touched += fb[i] != 0;
+    }
+    CHECK_EQ(touched, 0);
+
+    return check_result("lcd_fb");
+}
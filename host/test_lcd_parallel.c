@@ -0,0 +1,221 @@
+/* lcd_parallel.c on the i80 stand-in, built once per parallel display board (BOARD_TYPE):
+   one flush ready callback per batch and only after its last transfer, also when transfers fail,
+   and the modeled bus throughput of the game's 16 tile batches */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "board.h"
+#include "bsp_i2c.h"
+#include "lcd.h"
+#include "lcd_buf.h"
+#include "lcd_trace.h"
+#include "mock_i80.h"
+#include "check.h"
+
+#define TILE    16
+#define BATCH   16
+#define FRAMES  200
+
+/* The board's pixel format, as the game builds its colors (main/pacman.ino.cpp) */
+#define C16(_rr, _gg, _bb)  ((uint16_t)((((_bb) & 0xF8) << 8) | (((_rr) & 0xF8) << 3) | (((_gg) & 0xFC) >> 2)))
+
+#if (BOARD_DISP_PARALLEL_CONTROLLER == BOARD_DISP_LCD_RM68120)
+#define NAME    "lcd_parallel rm68120"
+#define DRIVER  LCD_DRIVER_RM68120
+#define MODEL   MOCK_PANEL_RM68120
+#else
+#define NAME    "lcd_parallel ra8875"
+#define DRIVER  LCD_DRIVER_RA8875
+#define MODEL   MOCK_PANEL_RA8875
+#endif
+
+static int ready_calls;
+static size_t pending_at_ready;
+static uint16_t tiles[BATCH][TILE * TILE];
+static lcd_rect_t rects[BATCH];
+static void *buffers[BATCH];
+
+/* The display init talks to the IO expander: nothing answers on the host */
+esp_err_t bsp_i2c_write(bsp_i2c_prio_t prio, uint8_t addr, const uint8_t *data, size_t len)
+{
+    return ESP_OK;
+}
+
+void *lcd_buf_alloc(size_t size)
+{
+    return malloc(size);
+}
+
+void lcd_buf_free(void *buf)
+{
+    free(buf);
+}
+
+static void flush_ready(lcd_disp_t *disp)
+{
+    ready_calls++;
+    pending_at_ready = mock_panel_io_pending(mock_i80_panel_io());
+}
+
+/* 16 tiles of a frame: around a sprite and along a row, as the game's dirty tiles */
+static void make_batch(int frame)
+{
+    int x0 = 64 + (frame * 24) % 560;
+    int y0 = 32 + (frame * 40) % 320;
+
+    for (int i = 0; i < BATCH; i++) {
+        int x = (i < 9) ? x0 + (i % 3) * TILE : x0 + (i - 6) * TILE;
+        int y = (i < 9) ? y0 + (i / 3) * TILE : y0 + 4 * TILE;
+        rects[i] = (lcd_rect_t) { x, y, x + TILE, y + TILE };
+        for (int p = 0; p < TILE * TILE; p++) {
+            tiles[i][p] = (uint16_t)(frame * 31 + i * 977 + p);
+        }
+        buffers[i] = tiles[i];
+    }
+}
+
+static int bad_pixels(int first, int count)
+{
+    esp_lcd_panel_io_handle_t io = mock_i80_panel_io();
+    int bad = 0;
+
+    for (int i = first; i < first + count; i++) {
+        for (int p = 0; p < TILE * TILE; p++) {
+            uint16_t want = tiles[i][p];
+#if (BOARD_DISP_PARALLEL_CONTROLLER == BOARD_DISP_LCD_RA8875)
+            want = (uint16_t)((want << 8) | (want >> 8));   /* swap_color_bytes */
+#endif
+            bad += mock_panel_io_pixel(io, rects[i].x1 + p % TILE, rects[i].y1 + p / TILE) != want;
+        }
+    }
+    return bad;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int main(void)
+{
+    const mock_panel_io_cfg_t panel_cfg = {
+        .model = MODEL,
+        .width = BOARD_DISP_PARALLEL_HRES,
+        .height = BOARD_DISP_PARALLEL_VRES,
+        .defer_done = true,
+        .wait_gpio_num = BOARD_DISP_PARALLEL_WAIT,
+    };
+    mock_i80_set_panel(&panel_cfg, 1000);
+
+    lcd_cfg_t cfg = {
+        .driver = DRIVER,
+        .flush_ready_cb = flush_ready,
+    };
+    lcd_disp_t *disp = lcd_parallel8080_init(&cfg);
+    CHECK(disp != NULL);
+    esp_lcd_panel_io_handle_t io = mock_i80_panel_io();
+    mock_panel_io_complete(io, SIZE_MAX);
+
+    /* a batch: the callback comes once, when the bus has finished the last transfer */
+    make_batch(0);
+    ready_calls = 0;
+    lcd_parallel8080_draw_batch(disp, rects, buffers, BATCH);
+    CHECK_EQ(ready_calls, 0);
+    CHECK(mock_panel_io_pending(io) > 0);
+    mock_panel_io_complete(io, SIZE_MAX);
+    CHECK_EQ(ready_calls, 1);
+    CHECK_EQ(pending_at_ready, 0);
+    CHECK_EQ(bad_pixels(0, BATCH), 0);
+
+    /* transfers done while the batch is still queued (a full queue, or a command that waits for
+       the bus) don't end it early */
+    make_batch(1);
+    ready_calls = 0;
+    for (int i = 0; i < 4; i++) {
+        lcd_parallel8080_draw_batch(disp, rects + i * 4, buffers + i * 4, 4);
+        CHECK_EQ(ready_calls, i);
+        mock_panel_io_complete(io, SIZE_MAX);
+        CHECK_EQ(ready_calls, i + 1);
+    }
+    CHECK_EQ(bad_pixels(0, BATCH), 0);
+
+    /* a color transfer fails in the middle (the RA8875 goes on with the next rectangle, the RM68120
+       stops): still one callback, once the ones that were queued are done */
+    make_batch(2);
+    ready_calls = 0;
+    mock_panel_io_fail_colors(io, 5, 1);
+    lcd_parallel8080_draw_batch(disp, rects, buffers, BATCH);
+    mock_panel_io_complete(io, SIZE_MAX);
+    CHECK_EQ(ready_calls, 1);
+    CHECK_EQ(pending_at_ready, 0);
+    CHECK_EQ(bad_pixels(0, 5), 0);
+
+    /* a single draw, then one that fails: nothing queued, the callback comes right away */
+    make_batch(3);
+    ready_calls = 0;
+    lcd_parallel8080_draw(disp, rects[0].x1, rects[0].y1, rects[0].x2, rects[0].y2, tiles[0]);
+    mock_panel_io_complete(io, SIZE_MAX);
+    CHECK_EQ(ready_calls, 1);
+    CHECK_EQ(bad_pixels(0, 1), 0);
+    mock_panel_io_fail_colors(io, 0, 1);
+    lcd_parallel8080_draw(disp, rects[1].x1, rects[1].y1, rects[1].x2, rects[1].y2, tiles[1]);
+    CHECK_EQ(ready_calls, 2);
+    CHECK_EQ(mock_panel_io_pending(io), 0);
+
+    /* fills take the board's pixel format: the RA8875 drawing engine gets plain red, green and blue,
+       the RM68120 streams the pixel as it is */
+    static const struct {
+        uint16_t color;
+        uint8_t r, g, b;
+    } fills[] = {
+        { C16(255, 0, 0), 31, 0, 0 },
+        { C16(0, 255, 0), 0, 63, 0 },
+        { C16(0, 0, 255), 0, 0, 31 },
+        { C16(255, 184, 81), 31, 46, 10 },
+    };
+    for (int i = 0; i < sizeof(fills) / sizeof(fills[0]); i++) {
+        const lcd_rect_t rect = { 96, 64, 96 + 32, 64 + 24 };
+        ready_calls = 0;
+        lcd_parallel8080_fill(disp, &rect, fills[i].color);
+        mock_panel_io_complete(io, SIZE_MAX);
+        CHECK_EQ(ready_calls, 1);
+#if (BOARD_DISP_PARALLEL_CONTROLLER == BOARD_DISP_LCD_RA8875)
+        CHECK_EQ(mock_panel_io_reg(io, 0x63), fills[i].r);
+        CHECK_EQ(mock_panel_io_reg(io, 0x64), fills[i].g);
+        CHECK_EQ(mock_panel_io_reg(io, 0x65), fills[i].b);
+#else
+        CHECK_EQ(mock_panel_io_pixel(io, rect.x1, rect.y1), fills[i].color);
+        CHECK_EQ(mock_panel_io_pixel(io, rect.x2 - 1, rect.y2 - 1), fills[i].color);
+#endif
+    }
+
+    /* throughput: batches of 16 tiles, each one waited for as bsp_lcd_flush_batch() does */
+    lcd_trace_stats_t bus;
+    lcd_trace_frame(mock_i80_trace_io(), &bus, NULL);
+    ready_calls = 0;
+    uint64_t cpu_ns = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        make_batch(f);
+        uint64_t t0 = now_ns();
+        lcd_parallel8080_draw_batch(disp, rects, buffers, BATCH);
+        cpu_ns += now_ns() - t0;
+        mock_panel_io_complete(io, SIZE_MAX);
+    }
+    lcd_trace_frame(mock_i80_trace_io(), &bus, NULL);
+    CHECK_EQ(ready_calls, FRAMES);
+    CHECK_EQ(bus.colors, FRAMES * BATCH);
+
+    double bus_us = (double)bus.bus_ns / FRAMES / 1000;
+    double mpix = (double)FRAMES * BATCH * TILE * TILE / ((double)bus.bus_ns / 1000);
+    printf("%s: %d tiles per batch, %u commands, %.1f us on the bus (%.1f Mpixel/s), %.1f us CPU on the host\n",
+           NAME, BATCH, (unsigned)(bus.cmds / FRAMES), bus_us, mpix, (double)cpu_ns / FRAMES / 1000);
+    /* the pixels take most of the bus, not the window commands */
+    uint64_t pixel_ns = (uint64_t)bus.color_bytes * 8 / BOARD_DISP_PARALLEL_WIDTH * 1000000000ULL /
+                        (DRIVER == LCD_DRIVER_RM68120 ? 40000000ULL : 20000000ULL);
+    CHECK(pixel_ns * 100 / bus.bus_ns >= 60);
+
+    return check_result(NAME);
+}
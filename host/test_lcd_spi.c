@@ -0,0 +1,174 @@
+/* lcd_spi.c on the SPI stand-in (ESP box board): one flush ready callback per batch and only after
+   its last transfer, also when transfers fail, the window commands that are left out, and how much
+   of a batch's bus time the caller gets back, since the SPI IO waits for the queue on every command */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "board.h"
+#include "lcd.h"
+#include "lcd_trace.h"
+#include "mock_spi.h"
+#include "check.h"
+
+#define NAME    "lcd_spi st7789"
+#define TILE    16
+#define BATCH   16
+#define FRAMES  200
+
+/* Landscape, as lcd_spi_init() sets the panel up */
+#define WIDTH   BOARD_DISP_SPI_VRES
+#define HEIGHT  BOARD_DISP_SPI_HRES
+
+static int ready_calls;
+static size_t pending_at_ready;
+static uint16_t tiles[BATCH][TILE * TILE];
+static lcd_rect_t rects[BATCH];
+static void *buffers[BATCH];
+
+static void flush_ready(lcd_disp_t *disp)
+{
+    ready_calls++;
+    pending_at_ready = mock_panel_io_pending(mock_spi_panel_io());
+}
+
+/* 16 tiles of a frame: around a sprite and along a row, as the game's dirty tiles */
+static void make_batch(int frame)
+{
+    int x0 = 16 + (frame * 24) % 160;
+    int y0 = 16 + (frame * 40) % 144;
+
+    for (int i = 0; i < BATCH; i++) {
+        int x = (i < 9) ? x0 + (i % 3) * TILE : x0 + (i - 6) * TILE;
+        int y = (i < 9) ? y0 + (i / 3) * TILE : y0 + 4 * TILE;
+        rects[i] = (lcd_rect_t) { x, y, x + TILE, y + TILE };
+        for (int p = 0; p < TILE * TILE; p++) {
+            tiles[i][p] = (uint16_t)(frame * 31 + i * 977 + p);
+        }
+        buffers[i] = tiles[i];
+    }
+}
+
+static int bad_pixels(int first, int count)
+{
+    esp_lcd_panel_io_handle_t io = mock_spi_panel_io();
+    int bad = 0;
+
+    for (int i = first; i < first + count; i++) {
+        for (int p = 0; p < TILE * TILE; p++) {
+            uint16_t want = tiles[i][p];
+            want = (uint16_t)((want << 8) | (want >> 8));   /* sent in memory order */
+            bad += mock_panel_io_pixel(io, rects[i].x1 + p % TILE, rects[i].y1 + p / TILE) != want;
+        }
+    }
+    return bad;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int main(void)
+{
+    const mock_panel_io_cfg_t panel_cfg = {
+        .model = MOCK_PANEL_ST7789,
+        .width = WIDTH,
+        .height = HEIGHT,
+        .defer_done = true,
+        .wait_gpio_num = GPIO_NUM_NC,
+    };
+    mock_spi_set_panel(&panel_cfg, 1000);
+
+    lcd_cfg_t cfg = {
+        .driver = LCD_DRIVER_ST7789,
+        .flush_ready_cb = flush_ready,
+    };
+    lcd_disp_t *disp = lcd_spi_init(&cfg);
+    CHECK(disp != NULL);
+    esp_lcd_panel_io_handle_t io = mock_spi_panel_io();
+    mock_panel_io_complete(io, SIZE_MAX);
+
+    /* a batch: the callback comes once, when the bus has finished the last transfer. Every window
+       command waited for the tile before it, so only the last one is still on the bus. */
+    mock_panel_io_stats_t stats;
+    make_batch(0);
+    ready_calls = 0;
+    mock_panel_io_get_stats(io, &stats, true);
+    lcd_spi_draw_batch(disp, rects, buffers, BATCH);
+    CHECK_EQ(ready_calls, 0);
+    CHECK_EQ(mock_panel_io_pending(io), 1);
+    mock_panel_io_complete(io, SIZE_MAX);
+    CHECK_EQ(ready_calls, 1);
+    CHECK_EQ(pending_at_ready, 0);
+    CHECK_EQ(bad_pixels(0, BATCH), 0);
+    mock_panel_io_get_stats(io, &stats, true);
+    CHECK_EQ(stats.colors, BATCH);
+    CHECK_EQ(stats.waits, BATCH - 1);
+    /* a column address for every tile, a row address only when the row changes (4 rows) */
+    CHECK_EQ(stats.cmds, BATCH + 4);
+
+    /* the same rectangle again: no window commands, the pixel command waits instead */
+    lcd_spi_draw(disp, rects[BATCH - 1].x1, rects[BATCH - 1].y1, rects[BATCH - 1].x2, rects[BATCH - 1].y2, tiles[0]);
+    lcd_spi_draw(disp, rects[BATCH - 1].x1, rects[BATCH - 1].y1, rects[BATCH - 1].x2, rects[BATCH - 1].y2, tiles[BATCH - 1]);
+    mock_panel_io_complete(io, SIZE_MAX);
+    mock_panel_io_get_stats(io, &stats, true);
+    CHECK_EQ(stats.cmds, 0);
+    CHECK_EQ(stats.waits, 1);
+    CHECK_EQ(bad_pixels(BATCH - 1, 1), 0);
+
+    /* a color transfer fails in the middle: still one callback, once the ones that were queued are done */
+    make_batch(1);
+    ready_calls = 0;
+    mock_panel_io_fail_colors(io, 5, 1);
+    lcd_spi_draw_batch(disp, rects, buffers, BATCH);
+    mock_panel_io_complete(io, SIZE_MAX);
+    CHECK_EQ(ready_calls, 1);
+    CHECK_EQ(pending_at_ready, 0);
+    CHECK_EQ(bad_pixels(0, 5), 0);
+    CHECK_EQ(bad_pixels(6, BATCH - 6), 0);
+
+    /* a single draw that fails: nothing queued, the callback comes right away */
+    ready_calls = 0;
+    mock_panel_io_fail_colors(io, 0, 1);
+    lcd_spi_draw(disp, rects[0].x1, rects[0].y1, rects[0].x2, rects[0].y2, tiles[0]);
+    CHECK_EQ(ready_calls, 1);
+    CHECK_EQ(mock_panel_io_pending(io), 0);
+
+    /* bus time of one tile's pixels: the same rectangle again, so no window commands */
+    lcd_trace_stats_t bus;
+    lcd_spi_draw(disp, rects[0].x1, rects[0].y1, rects[0].x2, rects[0].y2, tiles[0]);
+    mock_panel_io_complete(io, SIZE_MAX);
+    lcd_trace_frame(mock_spi_trace_io(), &bus, NULL);
+    lcd_spi_draw(disp, rects[0].x1, rects[0].y1, rects[0].x2, rects[0].y2, tiles[0]);
+    mock_panel_io_complete(io, SIZE_MAX);
+    lcd_trace_frame(mock_spi_trace_io(), &bus, NULL);
+    CHECK_EQ(bus.cmds, 0);
+    uint64_t tile_ns = bus.bus_ns;
+
+    /* throughput: batches of 16 tiles, each one waited for as bsp_lcd_flush_batch() does */
+    ready_calls = 0;
+    uint64_t cpu_ns = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        make_batch(f);
+        uint64_t t0 = now_ns();
+        lcd_spi_draw_batch(disp, rects, buffers, BATCH);
+        cpu_ns += now_ns() - t0;
+        mock_panel_io_complete(io, SIZE_MAX);
+    }
+    lcd_trace_frame(mock_spi_trace_io(), &bus, NULL);
+    CHECK_EQ(ready_calls, FRAMES);
+    CHECK_EQ(bus.colors, FRAMES * BATCH);
+
+    double bus_us = (double)bus.bus_ns / FRAMES / 1000;
+    double mpix = (double)FRAMES * BATCH * TILE * TILE / ((double)bus.bus_ns / 1000);
+    printf("%s: %d tiles per batch, %u commands, %.1f us on the bus (%.1f Mpixel/s), %.1f us CPU on the host\n",
+           NAME, BATCH, (unsigned)(bus.cmds / FRAMES), bus_us, mpix, (double)cpu_ns / FRAMES / 1000);
+    /* the caller waits for all tiles but the last: that one is all it gets back */
+    printf("%s: the caller waits %.1f us of it, %.1f us (the last tile) overlap\n",
+           NAME, bus_us - (double)tile_ns / 1000, (double)tile_ns / 1000);
+
+    return check_result(NAME);
+}
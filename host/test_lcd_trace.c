@@ -0,0 +1,196 @@
+/* lcd_trace in front of the mock panel IO: transactions pass through unchanged, the counters
+   of a frame match what reached the panel, and the modeled bus time follows the pixel clock, bus
+   width and per transaction overhead */
+#include <string.h>
+
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_rm68120.h"
+#include "lcd_trace.h"
+#include "mock_panel_io.h"
+#include "check.h"
+
+#define HRES        800
+#define VRES        480
+#define TILE        16
+#define TILES       45
+#define OVERHEAD    1000
+
+static int hook_calls;
+static uint32_t hook_bytes;
+static int done_calls;
+
+static void hook(lcd_trace_type_t type, int cmd, const void *data, size_t size, void *user_ctx)
+{
+    hook_calls++;
+    hook_bytes += size;
+}
+
+static bool color_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    done_calls++;
+    return false;
+}
+
+/* Bus time of one transaction, written out from the model: the command word, then the parameters
+   (a cycle per param_bits) or the pixels (a cycle per bus word) */
+static uint64_t model_ns(const lcd_trace_cfg_t *cfg, int op, uint32_t size)
+{
+    int unit_bits = (op == MOCK_PANEL_COLOR) ? cfg->bus_width : cfg->param_bits;
+    uint64_t cycles = (cfg->cmd_bits + cfg->bus_width - 1) / cfg->bus_width +
+                      ((uint64_t)size * 8 + unit_bits - 1) / unit_bits;
+    return cycles * 1000000000ULL / cfg->pclk_hz + cfg->trans_overhead_ns;
+}
+
+static esp_lcd_panel_io_handle_t new_mock(void)
+{
+    const mock_panel_io_cfg_t cfg = {
+        .model = MOCK_PANEL_RM68120,
+        .width = HRES,
+        .height = VRES,
+        .wait_gpio_num = GPIO_NUM_NC,
+    };
+    esp_lcd_panel_io_handle_t io;
+    ESP_ERROR_CHECK(mock_panel_io_new(&cfg, &io));
+    return io;
+}
+
+int main(void)
+{
+    /* single transactions, numbers worked out by hand */
+    lcd_trace_stats_t frame, total;
+    {
+        /* 16-bit bus at 40 MHz (25 ns a cycle), 16-bit commands, 8-bit parameters as the RM68120 board */
+        const lcd_trace_cfg_t cfg = {
+            .pclk_hz = 40000000,
+            .bus_width = 16,
+            .cmd_bits = 16,
+            .param_bits = 8,
+            .trans_overhead_ns = OVERHEAD,
+            .on_color_trans_done = color_done,
+        };
+        esp_lcd_panel_io_handle_t io;
+        ESP_ERROR_CHECK(lcd_trace_new_io(NULL, &cfg, &io));
+        static const uint8_t param[4] = { 1, 2, 3, 4 };
+        static uint16_t pixels[TILE * TILE];
+
+        ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io, 0x2A00, param, 1));
+        lcd_trace_frame(io, &frame, NULL);
+        CHECK_EQ(frame.cmds, 1);
+        CHECK_EQ(frame.param_bytes, 1);
+        CHECK_EQ(frame.bus_ns, 2 * 25 + OVERHEAD);          /* command, one parameter */
+
+        ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io, 0x2900, NULL, 0));
+        ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io, 0x3A00, param, 4));
+        lcd_trace_frame(io, &frame, NULL);
+        CHECK_EQ(frame.cmds, 2);
+        CHECK_EQ(frame.bus_ns, 1 * 25 + 5 * 25 + 2 * OVERHEAD);
+
+        /* no inner IO: the color transfer is done at once */
+        done_calls = 0;
+        ESP_ERROR_CHECK(esp_lcd_panel_io_tx_color(io, 0x2C00, pixels, sizeof(pixels)));
+        CHECK_EQ(done_calls, 1);
+        lcd_trace_frame(io, &frame, &total);
+        CHECK_EQ(frame.cmds, 0);
+        CHECK_EQ(frame.colors, 1);
+        CHECK_EQ(frame.color_bytes, sizeof(pixels));
+        CHECK_EQ(frame.bus_ns, (1 + TILE * TILE) * 25 + OVERHEAD);
+        CHECK_EQ(total.cmds, 3);
+        CHECK_EQ(total.colors, 1);
+        CHECK_EQ(total.bus_ns, 2 * 25 + 6 * 25 + (1 + TILE * TILE) * 25 + 4 * OVERHEAD);
+        esp_lcd_panel_io_del(io);
+    }
+    {
+        /* 8-bit bus at 20 MHz (50 ns), 8-bit commands: a pixel takes two cycles */
+        const lcd_trace_cfg_t cfg = {
+            .pclk_hz = 20000000,
+            .bus_width = 8,
+            .cmd_bits = 8,
+            .param_bits = 8,
+        };
+        esp_lcd_panel_io_handle_t io;
+        ESP_ERROR_CHECK(lcd_trace_new_io(NULL, &cfg, &io));
+        static uint16_t pixels[100];
+        ESP_ERROR_CHECK(esp_lcd_panel_io_tx_color(io, 0x2C, pixels, sizeof(pixels)));
+        lcd_trace_frame(io, &frame, NULL);
+        CHECK_EQ(frame.bus_ns, (1 + 200) * 50);
+        esp_lcd_panel_io_del(io);
+    }
+
+    /* the RM68120 driver through the tracer: pixels reach the panel as drawn directly, the frame
+       counters match the transactions the panel got, the bus time is their sum under the model */
+    esp_lcd_panel_io_handle_t mock = new_mock();
+    esp_lcd_panel_io_handle_t ref = new_mock();
+    const lcd_trace_cfg_t cfg = {
+        .pclk_hz = 40000000,
+        .bus_width = 16,
+        .cmd_bits = 16,
+        .param_bits = 8,
+        .trans_overhead_ns = OVERHEAD,
+        .log_depth = 8,
+        .hook = hook,
+    };
+    esp_lcd_panel_io_handle_t io;
+    ESP_ERROR_CHECK(lcd_trace_new_io(mock, &cfg, &io));
+
+    const esp_lcd_panel_dev_config_t panel_config = {
+        .reset_gpio_num = -1,
+        .color_space = ESP_LCD_COLOR_SPACE_RGB,
+        .bits_per_pixel = 16,
+    };
+    esp_lcd_panel_handle_t panel, ref_panel;
+    ESP_ERROR_CHECK(esp_lcd_new_panel_rm68120(io, &panel_config, &panel));
+    ESP_ERROR_CHECK(esp_lcd_new_panel_rm68120(ref, &panel_config, &ref_panel));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(panel));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(ref_panel));
+
+    static uint16_t tiles[TILES][TILE * TILE];
+    for (int f = 0; f < 3; f++) {
+        lcd_trace_frame(io, NULL, NULL);
+        mock_panel_io_log_clear(mock);
+        hook_calls = 0;
+        hook_bytes = 0;
+        for (int i = 0; i < TILES; i++) {
+            int x = 64 + ((i + f * 7) % 15) * 48;
+            int y = 32 + ((i / 15) + f) * 64;
+            for (int p = 0; p < TILE * TILE; p++) {
+                tiles[i][p] = (uint16_t)(f * 4099 + i * 977 + p);
+            }
+            ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, x, y, x + TILE, y + TILE, tiles[i]));
+            ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(ref_panel, x, y, x + TILE, y + TILE, tiles[i]));
+        }
+        lcd_trace_frame(io, &frame, NULL);
+        CHECK(memcmp(mock_panel_io_ram(mock), mock_panel_io_ram(ref), HRES * VRES * sizeof(uint16_t)) == 0);
+
+        size_t n;
+        const mock_panel_entry_t *log = mock_panel_io_log(mock, &n);
+        uint32_t cmds = 0, colors = 0, param_bytes = 0, color_bytes = 0;
+        uint64_t bus_ns = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (log[i].op == MOCK_PANEL_COLOR) {
+                colors++;
+                color_bytes += log[i].size;
+            } else {
+                cmds++;
+                param_bytes += log[i].size;
+            }
+            bus_ns += model_ns(&cfg, log[i].op, log[i].size);
+        }
+        CHECK_EQ(frame.cmds, cmds);
+        CHECK_EQ(frame.colors, TILES);
+        CHECK_EQ(frame.colors, colors);
+        CHECK_EQ(frame.param_bytes, param_bytes);
+        CHECK_EQ(frame.color_bytes, color_bytes);
+        CHECK_EQ(frame.color_bytes, TILES * TILE * TILE * sizeof(uint16_t));
+        CHECK_EQ(frame.bus_ns, bus_ns);
+        CHECK_EQ(hook_calls, n);
+        CHECK_EQ(hook_bytes, param_bytes + color_bytes);
+        printf("lcd_trace: frame %d, %u commands, %u colors, %.1f us on the bus\n",
+               f, (unsigned)frame.cmds, (unsigned)frame.colors, (double)frame.bus_ns / 1000);
+    }
+
+    esp_lcd_panel_del(panel);
+    esp_lcd_panel_del(ref_panel);
+    esp_lcd_panel_io_del(io);       /* deletes the mock too */
+    esp_lcd_panel_io_del(ref);
+    return check_result("lcd_trace");
+}
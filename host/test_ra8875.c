@@ -0,0 +1,223 @@
+/* RA8875 driver against the mock panel IO: the window/cursor shadow only sends the register bytes
+   that changed, the controller (model) still ends up with the right window, cursor and pixels */
+#include <string.h>
+
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_ra8875.h"
+#include "mock_gpio.h"
+#include "mock_panel_io.h"
+#include "check.h"
+
+#define HRES    800
+#define VRES    480
+#define TILE    16
+#define WAIT    GPIO_NUM_1
+
+static esp_lcd_panel_io_handle_t io;
+static esp_lcd_panel_handle_t panel;
+static uint16_t tile[TILE * TILE];
+
+static void fill_tile(int seed)
+{
+    for (int i = 0; i < TILE * TILE; i++) {
+        tile[i] = (uint16_t)(seed * 977 + i);
+    }
+}
+
+static int reg16(int reg)
+{
+    return mock_panel_io_reg(io, reg) | (mock_panel_io_reg(io, reg + 1) << 8);
+}
+
+/* Register writes in the log, also checks they only go to the window and cursor registers */
+static int logged_regs(void)
+{
+    size_t n;
+    const mock_panel_entry_t *log = mock_panel_io_log(io, &n);
+    int regs = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        if (log[i].op == MOCK_PANEL_CMD) {
+            CHECK((log[i].cmd >= 0x30 && log[i].cmd <= 0x37) || (log[i].cmd >= 0x46 && log[i].cmd <= 0x49));
+            CHECK_EQ(log[i].size, 1);
+            regs++;
+        }
+    }
+    return regs;
+}
+
+/* Draws one tile and checks what the controller got, returns the register writes it took */
+static int draw(int x, int y)
+{
+    mock_panel_io_log_clear(io);
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, x, y, x + TILE, y + TILE, tile));
+
+    size_t n;
+    const mock_panel_entry_t *log = mock_panel_io_log(io, &n);
+    CHECK(n > 0);
+    CHECK_EQ(log[n - 1].op, MOCK_PANEL_COLOR);
+    CHECK_EQ(log[n - 1].cmd, 0x02);
+    CHECK_EQ(log[n - 1].size, sizeof(tile));
+
+    /* window of this tile, the cursor wrapped back to its start after the full window */
+    CHECK_EQ(reg16(0x30), x);
+    CHECK_EQ(reg16(0x32), y);
+    CHECK_EQ(reg16(0x34), x + TILE - 1);
+    CHECK_EQ(reg16(0x36), y + TILE - 1);
+    CHECK_EQ(reg16(0x46), x);
+    CHECK_EQ(reg16(0x48), y);
+
+    int bad = 0;
+    for (int ty = 0; ty < TILE; ty++) {
+        for (int tx = 0; tx < TILE; tx++) {
+            bad += mock_panel_io_pixel(io, x + tx, y + ty) != tile[ty * TILE + tx];
+        }
+    }
+    CHECK_EQ(bad, 0);
+
+    return logged_regs();
+}
+
+/* Mock bus and panel, no_rx: a panel IO that cannot read, the driver falls back to the WAIT line */
+static void new_panel(bool no_rx)
+{
+    const mock_panel_io_cfg_t io_cfg = {
+        .model = MOCK_PANEL_RA8875,
+        .width = HRES,
+        .height = VRES,
+        .wait_gpio_num = WAIT,
+        .engine_reads = 2,
+        .no_rx = no_rx,
+    };
+    ESP_ERROR_CHECK(mock_panel_io_new(&io_cfg, &io));
+
+    const esp_lcd_panel_ra8875_config_t vendor_config = {
+        .wait_gpio_num = WAIT,
+        .lcd_width = HRES,
+        .lcd_height = VRES,
+        .mcu_bit_interface = 16,
+    };
+    const esp_lcd_panel_dev_config_t panel_config = {
+        .reset_gpio_num = -1,
+        .color_space = ESP_LCD_COLOR_SPACE_RGB,
+        .bits_per_pixel = 16,
+        .vendor_config = (void *)&vendor_config,
+    };
+    ESP_ERROR_CHECK(esp_lcd_new_panel_ra8875(io, &panel_config, &panel));
+    ESP_ERROR_CHECK(esp_lcd_panel_reset(panel));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(panel));
+}
+
+int main(void)
+{
+    mock_gpio_reset();
+    new_panel(false);
+
+    esp_lcd_ra8875_stats_t stats;
+    esp_lcd_ra8875_get_stats(panel, &stats, true);
+
+    /* WAIT toggles with every access: its interrupt is not armed while nobody waits */
+    mock_gpio_stats_t wait;
+    mock_gpio_get_stats(WAIT, &wait);
+    CHECK(!wait.intr_enabled);
+    mock_gpio_set_input(WAIT, 0);
+    mock_gpio_set_input(WAIT, 1);
+    mock_gpio_get_stats(WAIT, &wait);
+    CHECK_EQ(wait.isr_calls, 0);
+    CHECK_EQ(wait.edges_ignored, 1);
+
+    /* first tile: nothing known, the whole window and cursor */
+    fill_tile(1);
+    CHECK_EQ(draw(32, 16), 12);
+    /* next one to the right: x start, x end and cursor x low bytes */
+    fill_tile(2);
+    CHECK_EQ(draw(48, 16), 3);
+    /* same place again: nothing, the cursor wrapped back */
+    fill_tile(3);
+    CHECK_EQ(draw(48, 16), 0);
+    /* below: the y bytes */
+    fill_tile(4);
+    CHECK_EQ(draw(48, 32), 3);
+    /* x crosses 256: the end high byte first, then the start and cursor high bytes */
+    fill_tile(5);
+    CHECK_EQ(draw(240, 32), 3);
+    CHECK_EQ(draw(248, 32), 4);
+    CHECK_EQ(draw(256, 32), 5);
+
+    esp_lcd_ra8875_get_stats(panel, &stats, true);
+    CHECK_EQ(stats.reg_writes, 12 + 3 + 0 + 3 + 3 + 4 + 5);
+    CHECK_EQ(stats.reg_skipped, 7 * 12 - stats.reg_writes);
+
+    /* register writes per frame: a frame of 50 tiles in rows, as the game draws its dirty tiles */
+    mock_panel_io_stats_t io_stats;
+    mock_panel_io_get_stats(io, &io_stats, true);
+    int frame_regs = 0;
+    for (int i = 0; i < 50; i++) {
+        fill_tile(100 + i);
+        frame_regs += draw(64 + (i % 10) * TILE, 128 + (i / 10) * TILE);
+    }
+    esp_lcd_ra8875_get_stats(panel, &stats, true);
+    mock_panel_io_get_stats(io, &io_stats, true);
+    CHECK_EQ(stats.reg_writes, frame_regs);
+    CHECK_EQ(io_stats.cmds, stats.reg_writes);
+    CHECK_EQ(io_stats.colors, 50);
+    printf("ra8875: 50 tiles, %u register writes per frame (%u without the shadow), %u bursts\n",
+           (unsigned)stats.reg_writes, 50 * 12, (unsigned)stats.bursts);
+    CHECK(stats.reg_writes < 50 * 12 / 2);
+
+    /* a fill runs in the drawing engine with plain R, G, B in 0x63..0x65, the next draw polls
+       DCR bit 7 until it is done: two reads, no WAIT interrupt */
+    mock_panel_io_get_stats(io, &io_stats, true);
+    ESP_ERROR_CHECK(esp_lcd_ra8875_fill_rect(panel, 0, 0, 32, 32, 0xF800));
+    CHECK_EQ(mock_panel_io_reg(io, 0x63), 31);
+    CHECK_EQ(mock_panel_io_reg(io, 0x64), 0);
+    CHECK_EQ(mock_panel_io_reg(io, 0x65), 0);
+    CHECK_EQ(mock_panel_io_pixel(io, 0, 0), 0xF800);
+    CHECK_EQ(mock_panel_io_pixel(io, 31, 31), 0xF800);
+    CHECK_EQ(mock_panel_io_pixel(io, 32, 0), 0);
+    fill_tile(200);
+    draw(64, 64);
+    esp_lcd_ra8875_get_stats(panel, &stats, true);
+    CHECK_EQ(stats.fills, 1);
+    CHECK_EQ(stats.waits, 1);
+    CHECK_EQ(stats.wait_timeouts, 0);
+    mock_panel_io_get_stats(io, &io_stats, true);
+    CHECK_EQ(io_stats.reads, 2);
+    CHECK_EQ(io_stats.busy_access, 0);
+    mock_gpio_get_stats(WAIT, &wait);
+    CHECK_EQ(wait.isr_calls, 0);
+    CHECK(!wait.intr_enabled);
+
+    /* swapped axes: all registers are unknown again, then shadowed in the swapped order */
+    ESP_ERROR_CHECK(esp_lcd_panel_swap_xy(panel, true));
+    mock_panel_io_log_clear(io);
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, 16, 32, 32, 48, tile));
+    CHECK_EQ(logged_regs(), 12);
+    CHECK_EQ(reg16(0x30), 32);
+    CHECK_EQ(reg16(0x32), 16);
+
+    esp_lcd_panel_del(panel);
+    esp_lcd_panel_io_del(io);
+
+    /* a panel IO that cannot read: the draw after a fill sleeps until the WAIT edge, one interrupt,
+       disarmed again after the wake-up */
+    new_panel(true);
+    mock_gpio_get_stats(WAIT, &wait);
+    uint32_t isr_calls = wait.isr_calls;
+    CHECK(!wait.intr_enabled);
+    ESP_ERROR_CHECK(esp_lcd_ra8875_fill_rect(panel, 0, 0, 32, 32, 0x07E0));
+    CHECK_EQ(mock_panel_io_pixel(io, 0, 0), 0x07E0);
+    esp_lcd_ra8875_get_stats(panel, &stats, true);
+    fill_tile(201);
+    draw(64, 64);
+    esp_lcd_ra8875_get_stats(panel, &stats, true);
+    CHECK_EQ(stats.waits, 1);
+    CHECK_EQ(stats.wait_timeouts, 0);
+    mock_gpio_get_stats(WAIT, &wait);
+    CHECK_EQ(wait.isr_calls - isr_calls, 1);
+    CHECK(!wait.intr_enabled);
+
+    esp_lcd_panel_del(panel);
+    esp_lcd_panel_io_del(io);
+    return check_result("ra8875");
+}
@@ -0,0 +1,164 @@
+/* RM68120 driver against the mock panel IO: command bytes per frame with the address cache, and
+   without it (every window sent in full, as the driver did before) for the same pixels */
+#include <string.h>
+
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_rm68120.h"
+#include "mock_panel_io.h"
+#include "check.h"
+
+#define HRES    800
+#define VRES    480
+#define TILE    16
+#define TILES   45      /* 5 sprites, 3 x 3 dirty tiles each */
+
+static uint16_t tiles[TILES][TILE * TILE];
+static int tile_x[TILES];
+static int tile_y[TILES];
+
+/* 16-bit commands: 2 bytes each, color transfers included */
+static uint32_t bus_cmd_bytes(esp_lcd_panel_io_handle_t io)
+{
+    mock_panel_io_stats_t s;
+    mock_panel_io_get_stats(io, &s, true);
+    return 2 * (s.cmds + s.colors) + s.param_bytes;
+}
+
+static esp_lcd_panel_io_handle_t new_io(void)
+{
+    const mock_panel_io_cfg_t cfg = {
+        .model = MOCK_PANEL_RM68120,
+        .width = HRES,
+        .height = VRES,
+        .wait_gpio_num = GPIO_NUM_NC,
+    };
+    esp_lcd_panel_io_handle_t io;
+    ESP_ERROR_CHECK(mock_panel_io_new(&cfg, &io));
+    return io;
+}
+
+/* Address commands in the log since the last clear */
+static int logged_addr(esp_lcd_panel_io_handle_t io)
+{
+    size_t n;
+    const mock_panel_entry_t *log = mock_panel_io_log(io, &n);
+    int cmds = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        if (log[i].op == MOCK_PANEL_CMD) {
+            CHECK((log[i].cmd >= 0x2A00 && log[i].cmd <= 0x2A03) || (log[i].cmd >= 0x2B00 && log[i].cmd <= 0x2B03));
+            cmds++;
+        }
+    }
+    mock_panel_io_log_clear(io);
+    return cmds;
+}
+
+/* The window of every tile in full, then the pixels: the stream without the address cache */
+static void draw_uncached(esp_lcd_panel_io_handle_t io, int x, int y, const uint16_t *pixels)
+{
+    const uint8_t addr[8] = {
+        x >> 8, x, (x + TILE - 1) >> 8, x + TILE - 1,
+        y >> 8, y, (y + TILE - 1) >> 8, y + TILE - 1,
+    };
+    for (int i = 0; i < 8; i++) {
+        int cmd = (i < 4) ? (0x2A00 + i) : (0x2B00 + i - 4);
+        esp_lcd_panel_io_tx_param(io, cmd, &addr[i], 1);
+    }
+    esp_lcd_panel_io_tx_color(io, 0x2C00, pixels, TILE * TILE * sizeof(uint16_t));
+}
+
+int main(void)
+{
+    esp_lcd_panel_io_handle_t io = new_io();
+    esp_lcd_panel_io_handle_t ref = new_io();
+    esp_lcd_panel_handle_t panel;
+    const esp_lcd_panel_dev_config_t panel_config = {
+        .reset_gpio_num = -1,
+        .color_space = ESP_LCD_COLOR_SPACE_RGB,
+        .bits_per_pixel = 16,
+    };
+    ESP_ERROR_CHECK(esp_lcd_new_panel_rm68120(io, &panel_config, &panel));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(panel));
+    mock_panel_io_log_clear(io);
+    bus_cmd_bytes(io);
+
+    /* first tile: all 8 address bytes, the right neighbour: x low bytes, below: y low bytes,
+       around x = 256: the high byte of the end, then of the start */
+    static uint16_t tile[TILE * TILE];
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, 32, 16, 32 + TILE, 16 + TILE, tile));
+    CHECK_EQ(logged_addr(io), 8);
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, 48, 16, 48 + TILE, 16 + TILE, tile));
+    CHECK_EQ(logged_addr(io), 2);
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, 48, 16, 48 + TILE, 16 + TILE, tile));
+    CHECK_EQ(logged_addr(io), 0);
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, 48, 32, 48 + TILE, 32 + TILE, tile));
+    CHECK_EQ(logged_addr(io), 2);
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, 248, 32, 248 + TILE, 32 + TILE, tile));
+    CHECK_EQ(logged_addr(io), 3);
+    ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, 256, 32, 256 + TILE, 32 + TILE, tile));
+    CHECK_EQ(logged_addr(io), 3);
+
+    /* a frame: the tiles around 5 sprites, in the game's row by row order */
+    static const int sprite_x[5] = { 96, 208, 352, 480, 624 };
+    static const int sprite_y[5] = { 64, 224, 128, 320, 176 };
+    int n = 0;
+    for (int s = 0; s < 5; s++) {
+        for (int ty = 0; ty < 3; ty++) {
+            for (int tx = 0; tx < 3; tx++, n++) {
+                tile_x[n] = sprite_x[s] + tx * TILE;
+                tile_y[n] = sprite_y[s] + ty * TILE;
+                for (int i = 0; i < TILE * TILE; i++) {
+                    tiles[n][i] = (uint16_t)(n * 977 + i);
+                }
+            }
+        }
+    }
+
+    esp_lcd_rm68120_stats_t stats;
+    esp_lcd_rm68120_get_stats(panel, &stats, true);
+    bus_cmd_bytes(io);
+    bus_cmd_bytes(ref);
+    for (int i = 0; i < TILES; i++) {
+        ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, tile_x[i], tile_y[i], tile_x[i] + TILE, tile_y[i] + TILE, tiles[i]));
+        draw_uncached(ref, tile_x[i], tile_y[i], tiles[i]);
+    }
+    uint32_t cached = bus_cmd_bytes(io);
+    uint32_t uncached = bus_cmd_bytes(ref);
+    esp_lcd_rm68120_get_stats(panel, &stats, true);
+
+    /* same pixels on both panels, the driver counted what went on the bus */
+    CHECK(memcmp(mock_panel_io_ram(io), mock_panel_io_ram(ref), HRES * VRES * sizeof(uint16_t)) == 0);
+    CHECK_EQ(stats.cmd_bytes, cached);
+    CHECK_EQ(uncached, TILES * (8 * 3 + 2));
+    printf("rm68120: %d tiles, %u command bytes per frame (%u without the address cache)\n",
+           TILES, (unsigned)cached, (unsigned)uncached);
+    CHECK(cached < uncached / 2);
+
+    /* the same tiles column by column with esp_lcd_rm68120_draw_bitmaps(): tiles above each other
+       share the column window */
+    esp_lcd_rm68120_rect_t rects[TILES];
+    n = 0;
+    for (int s = 0; s < 5; s++) {
+        for (int tx = 0; tx < 3; tx++) {
+            for (int ty = 0; ty < 3; ty++, n++) {
+                int i = s * 9 + ty * 3 + tx;
+                rects[n] = (esp_lcd_rm68120_rect_t) {
+                    tile_x[i], tile_y[i], tile_x[i] + TILE, tile_y[i] + TILE, tiles[i],
+                };
+            }
+        }
+    }
+    size_t queued;
+    ESP_ERROR_CHECK(esp_lcd_rm68120_draw_bitmaps(panel, rects, TILES, &queued));
+    CHECK_EQ(queued, TILES);
+    uint32_t columns = bus_cmd_bytes(io);
+    printf("rm68120: %u command bytes column by column\n", (unsigned)columns);
+    CHECK(memcmp(mock_panel_io_ram(io), mock_panel_io_ram(ref), HRES * VRES * sizeof(uint16_t)) == 0);
+    CHECK(columns <= cached);
+
+    esp_lcd_panel_del(panel);
+    esp_lcd_panel_io_del(io);
+    esp_lcd_panel_io_del(ref);
+    return check_result("rm68120");
+}
@@ -1,327 +1,327 @@
-#include "Adafruit_GFX_Simple.h"
-#include "TFT_16bits.h"
-#include "bsp.h"
-
-#ifndef min
-#define min(a, b) (((a) < (b)) ? (a) : (b))
-#endif
-
-#ifndef _swap_int16_t
-#define _swap_int16_t(a, b)                                                    \
-  {                                                                            \
-    int16_t t = a;                                                             \
-    a = b;                                                                     \
-    b = t;                                                                     \
-  }
-#endif
-
-
-/**************************************************************************/
-/*!
-   @brief    Instatiate a GFX 16-bit canvas context for graphics
-   @param    w   Display width, in pixels
-   @param    h   Display height, in pixels
-*/
-/**************************************************************************/
-TFT_16bits::TFT_16bits(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
-  buffer = NULL;
-}
-
-/**************************************************************************/
-/*!
-   @brief    Delete the canvas, free memory
-*/
-/**************************************************************************/
-TFT_16bits::~TFT_16bits(void) {
-  if (buffer)
-    free(buffer);
-}
-
-/**************************************************************************/
-/*!
-   @brief    Create the canvas screen buffer, using PSRAM memory
-*/
-/**************************************************************************/
-size_t TFT_16bits::createPSRAMFrameBuffer(void) {
-  size_t scrBuffLen = width() * height() * sizeof(uint16_t);
-
-  buffer = (uint16_t *)heap_caps_malloc(scrBuffLen, MALLOC_CAP_SPIRAM);
-  if (buffer == NULL) {
-    log_e("Can't allocate the screen buffer - check PSRAM.");
-    return 0;
-  }
-  memset(buffer, 0, scrBuffLen);
-  return scrBuffLen;
-}
-
-/**************************************************************************/
-/*!
-    @brief  Draw a pixel to the canvas framebuffer
-    @param  x   x coordinate
-    @param  y   y coordinate
-    @param  color 16-bit 5-6-5 Color to fill with
-*/
-/**************************************************************************/
-void TFT_16bits::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if (buffer != NULL) {
-    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
-      return;
-
-    int16_t t;
-    switch (rotation) {
-    case 1:
-      t = x;
-      x = WIDTH - 1 - y;
-      y = t;
-      break;
-    case 2:
-      x = WIDTH - 1 - x;
-      y = HEIGHT - 1 - y;
-      break;
-    case 3:
-      t = x;
-      x = y;
-      y = HEIGHT - 1 - t;
-      break;
-    }
-
-    buffer[x + y * WIDTH] = color;
-  }
-}
-
-/**********************************************************************/
-/*!
-        @brief    Get the pixel color value at a given coordinate
-        @param    x   x coordinate
-        @param    y   y coordinate
-        @returns  The desired pixel's 16-bit 5-6-5 color value
-*/
-/**********************************************************************/
-uint16_t TFT_16bits::getPixel(int16_t x, int16_t y) const {
-  int16_t t;
-  switch (rotation) {
-  case 1:
-    t = x;
-    x = WIDTH - 1 - y;
-    y = t;
-    break;
-  case 2:
-    x = WIDTH - 1 - x;
-    y = HEIGHT - 1 - y;
-    break;
-  case 3:
-    t = x;
-    x = y;
-    y = HEIGHT - 1 - t;
-    break;
-  }
-  return getRawPixel(x, y);
-}
-
-/**********************************************************************/
-/*!
-        @brief    Get the pixel color value at a given, unrotated coordinate.
-              This method is intended for hardware drivers to get pixel value
-              in physical coordinates.
-        @param    x   x coordinate
-        @param    y   y coordinate
-        @returns  The desired pixel's 16-bit 5-6-5 color value
-*/
-/**********************************************************************/
-uint16_t TFT_16bits::getRawPixel(int16_t x, int16_t y) const {
-  if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT))
-    return 0;
-  if (buffer != NULL) {
-    return buffer[x + y * WIDTH];
-  }
-  return 0;
-}
-
-/**************************************************************************/
-/*!
-    @brief  Fill the framebuffer completely with one color
-    @param  color 16-bit 5-6-5 Color to fill with
-*/
-/**************************************************************************/
-void TFT_16bits::fillScreen(uint16_t color) {
-  if (buffer != NULL) {
-    uint8_t hi = color >> 8, lo = color & 0xFF;
-    if (hi == lo) {
-      memset(buffer, lo, WIDTH * HEIGHT * 2);
-    } else {
-      uint32_t i, pixels = WIDTH * HEIGHT;
-      for (i = 0; i < pixels; i++)
-        buffer[i] = color;
-    }
-  }
-}
-
-/**************************************************************************/
-/*!
-    @brief  Reverses the "endian-ness" of each 16-bit pixel within the
-            canvas; little-endian to big-endian, or big-endian to little.
-            Most microcontrollers (such as SAMD) are little-endian, while
-            most displays tend toward big-endianness. All the drawing
-            functions (including RGB bitmap drawing) take care of this
-            automatically, but some specialized code (usually involving
-            DMA) can benefit from having pixel data already in the
-            display-native order. Note that this does NOT convert to a
-            SPECIFIC endian-ness, it just flips the bytes within each word.
-*/
-/**************************************************************************/
-void TFT_16bits::byteSwap(void) {
-  if (buffer != NULL) {
-    uint32_t i, pixels = WIDTH * HEIGHT;
-    for (i = 0; i < pixels; i++)
-      buffer[i] = __builtin_bswap16(buffer[i]);
-  }
-}
-
-/**************************************************************************/
-/*!
-   @brief    Speed optimized vertical line drawing
-   @param    x   Line horizontal start point
-   @param    y   Line vertical start point
-   @param    h   length of vertical line to be drawn, including first point
-   @param    color   color 16-bit 5-6-5 Color to draw line with
-*/
-/**************************************************************************/
-void TFT_16bits::drawFastVLine(int16_t x, int16_t y, int16_t h,
-                                uint16_t color) {
-  if (h < 0) { // Convert negative heights to positive equivalent
-    h *= -1;
-    y -= h - 1;
-    if (y < 0) {
-      h += y;
-      y = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
-    return;
-  }
-
-  if (y < 0) { // Clip top
-    h += y;
-    y = 0;
-  }
-  if (y + h > height()) { // Clip bottom
-    h = height() - y;
-  }
-
-  if (getRotation() == 0) {
-    drawFastRawVLine(x, y, h, color);
-  } else if (getRotation() == 1) {
-    int16_t t = x;
-    x = WIDTH - 1 - y;
-    y = t;
-    x -= h - 1;
-    drawFastRawHLine(x, y, h, color);
-  } else if (getRotation() == 2) {
-    x = WIDTH - 1 - x;
-    y = HEIGHT - 1 - y;
-
-    y -= h - 1;
-    drawFastRawVLine(x, y, h, color);
-  } else if (getRotation() == 3) {
-    int16_t t = x;
-    x = y;
-    y = HEIGHT - 1 - t;
-    drawFastRawHLine(x, y, h, color);
-  }
-}
-
-/**************************************************************************/
-/*!
-   @brief  Speed optimized horizontal line drawing
-   @param  x      Line horizontal start point
-   @param  y      Line vertical start point
-   @param  w      Length of horizontal line to be drawn, including 1st point
-   @param  color  Color 16-bit 5-6-5 Color to draw line with
-*/
-/**************************************************************************/
-void TFT_16bits::drawFastHLine(int16_t x, int16_t y, int16_t w,
-                                uint16_t color) {
-  if (w < 0) { // Convert negative widths to positive equivalent
-    w *= -1;
-    x -= w - 1;
-    if (x < 0) {
-      w += x;
-      x = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
-    return;
-  }
-
-  if (x < 0) { // Clip left
-    w += x;
-    x = 0;
-  }
-  if (x + w >= width()) { // Clip right
-    w = width() - x;
-  }
-
-  if (getRotation() == 0) {
-    drawFastRawHLine(x, y, w, color);
-  } else if (getRotation() == 1) {
-    int16_t t = x;
-    x = WIDTH - 1 - y;
-    y = t;
-    drawFastRawVLine(x, y, w, color);
-  } else if (getRotation() == 2) {
-    x = WIDTH - 1 - x;
-    y = HEIGHT - 1 - y;
-
-    x -= w - 1;
-    drawFastRawHLine(x, y, w, color);
-  } else if (getRotation() == 3) {
-    int16_t t = x;
-    x = y;
-    y = HEIGHT - 1 - t;
-    y -= w - 1;
-    drawFastRawVLine(x, y, w, color);
-  }
-}
-
-/**************************************************************************/
-/*!
-   @brief    Speed optimized vertical line drawing into the raw canvas buffer
-   @param    x   Line horizontal start point
-   @param    y   Line vertical start point
-   @param    h   length of vertical line to be drawn, including first point
-   @param    color   color 16-bit 5-6-5 Color to draw line with
-*/
-/**************************************************************************/
-void TFT_16bits::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
-                                   uint16_t color) {
-  // x & y already in raw (rotation 0) coordinates, no need to transform.
-  if (buffer == NULL) return;
-  uint16_t *buffer_ptr = buffer + y * WIDTH + x;
-  for (int16_t i = 0; i < h; i++) {
-    (*buffer_ptr) = color;
-    buffer_ptr += WIDTH;
-  }
-}
-
-/**************************************************************************/
-/*!
-   @brief    Speed optimized horizontal line drawing into the raw canvas buffer
-   @param    x   Line horizontal start point
-   @param    y   Line vertical start point
-   @param    w   length of horizontal line to be drawn, including first point
-   @param    color   color 16-bit 5-6-5 Color to draw line with
-*/
-/**************************************************************************/
-void TFT_16bits::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
-                                   uint16_t color) {
-  // x & y already in raw (rotation 0) coordinates, no need to transform.
-  if (buffer == NULL) return;
-  uint32_t buffer_index = y * WIDTH + x;
-  for (uint32_t i = buffer_index; i < buffer_index + w; i++) {
-    buffer[i] = color;
-  }
-}
+#include "Adafruit_GFX_Simple.h"
+#include "TFT_16bits.h"
+#include "bsp.h"
+
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef _swap_int16_t
+#define _swap_int16_t(a, b)                                                    \
+  {                                                                            \
+    int16_t t = a;                                                             \
+    a = b;                                                                     \
+    b = t;                                                                     \
+  }
+#endif
+
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a GFX 16-bit canvas context for graphics
+   @param    w   Display width, in pixels
+   @param    h   Display height, in pixels
+*/
+/**************************************************************************/
+TFT_16bits::TFT_16bits(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+  buffer = NULL;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the canvas, free memory
+*/
+/**************************************************************************/
+TFT_16bits::~TFT_16bits(void) {
+  if (buffer)
+    free(buffer);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Create the canvas screen buffer, using PSRAM memory
+*/
+/**************************************************************************/
+size_t TFT_16bits::createPSRAMFrameBuffer(void) {
+  size_t scrBuffLen = width() * height() * sizeof(uint16_t);
+
+  buffer = (uint16_t *)heap_caps_malloc(scrBuffLen, MALLOC_CAP_SPIRAM);
+  if (buffer == NULL) {
+    log_e("Can't allocate the screen buffer - check PSRAM.");
+    return 0;
+  }
+  memset(buffer, 0, scrBuffLen);
+  return scrBuffLen;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a pixel to the canvas framebuffer
+    @param  x   x coordinate
+    @param  y   y coordinate
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void TFT_16bits::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (buffer != NULL) {
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+      return;
+
+    int16_t t;
+    switch (rotation) {
+    case 1:
+      t = x;
+      x = WIDTH - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - 1 - t;
+      break;
+    }
+
+    buffer[x + y * WIDTH] = color;
+  }
+}
+
+/**********************************************************************/
+/*!
+        @brief    Get the pixel color value at a given coordinate
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  The desired pixel's 16-bit 5-6-5 color value
+*/
+/**********************************************************************/
+uint16_t TFT_16bits::getPixel(int16_t x, int16_t y) const {
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    break;
+  }
+  return getRawPixel(x, y);
+}
+
+/**********************************************************************/
+/*!
+        @brief    Get the pixel color value at a given, unrotated coordinate.
+              This method is intended for hardware drivers to get pixel value
+              in physical coordinates.
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  The desired pixel's 16-bit 5-6-5 color value
+*/
+/**********************************************************************/
+uint16_t TFT_16bits::getRawPixel(int16_t x, int16_t y) const {
+  if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT))
+    return 0;
+  if (buffer != NULL) {
+    return buffer[x + y * WIDTH];
+  }
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fill the framebuffer completely with one color
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void TFT_16bits::fillScreen(uint16_t color) {
+  if (buffer != NULL) {
+    uint8_t hi = color >> 8, lo = color & 0xFF;
+    if (hi == lo) {
+      memset(buffer, lo, WIDTH * HEIGHT * 2);
+    } else {
+      uint32_t i, pixels = WIDTH * HEIGHT;
+      for (i = 0; i < pixels; i++)
+        buffer[i] = color;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reverses the "endian-ness" of each 16-bit pixel within the
+            canvas; little-endian to big-endian, or big-endian to little.
+            Most microcontrollers (such as SAMD) are little-endian, while
+            most displays tend toward big-endianness. All the drawing
+            functions (including RGB bitmap drawing) take care of this
+            automatically, but some specialized code (usually involving
+            DMA) can benefit from having pixel data already in the
+            display-native order. Note that this does NOT convert to a
+            SPECIFIC endian-ness, it just flips the bytes within each word.
+*/
+/**************************************************************************/
+void TFT_16bits::byteSwap(void) {
+  if (buffer != NULL) {
+    uint32_t i, pixels = WIDTH * HEIGHT;
+    for (i = 0; i < pixels; i++)
+      buffer[i] = __builtin_bswap16(buffer[i]);
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Speed optimized vertical line drawing
+   @param    x   Line horizontal start point
+   @param    y   Line vertical start point
+   @param    h   length of vertical line to be drawn, including first point
+   @param    color   color 16-bit 5-6-5 Color to draw line with
+*/
+/**************************************************************************/
+void TFT_16bits::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                uint16_t color) {
+  if (h < 0) { // Convert negative heights to positive equivalent
+    h *= -1;
+    y -= h - 1;
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+  }
+
+  // Edge rejection (no-draw if totally off canvas)
+  if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+    return;
+  }
+
+  if (y < 0) { // Clip top
+    h += y;
+    y = 0;
+  }
+  if (y + h > height()) { // Clip bottom
+    h = height() - y;
+  }
+
+  if (getRotation() == 0) {
+    drawFastRawVLine(x, y, h, color);
+  } else if (getRotation() == 1) {
+    int16_t t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    x -= h - 1;
+    drawFastRawHLine(x, y, h, color);
+  } else if (getRotation() == 2) {
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+
+    y -= h - 1;
+    drawFastRawVLine(x, y, h, color);
+  } else if (getRotation() == 3) {
+    int16_t t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    drawFastRawHLine(x, y, h, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief  Speed optimized horizontal line drawing
+   @param  x      Line horizontal start point
+   @param  y      Line vertical start point
+   @param  w      Length of horizontal line to be drawn, including 1st point
+   @param  color  Color 16-bit 5-6-5 Color to draw line with
+*/
+/**************************************************************************/
+void TFT_16bits::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                uint16_t color) {
+  if (w < 0) { // Convert negative widths to positive equivalent
+    w *= -1;
+    x -= w - 1;
+    if (x < 0) {
+      w += x;
+      x = 0;
+    }
+  }
+
+  // Edge rejection (no-draw if totally off canvas)
+  if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+    return;
+  }
+
+  if (x < 0) { // Clip left
+    w += x;
+    x = 0;
+  }
+  if (x + w >= width()) { // Clip right
+    w = width() - x;
+  }
+
+  if (getRotation() == 0) {
+    drawFastRawHLine(x, y, w, color);
+  } else if (getRotation() == 1) {
+    int16_t t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    drawFastRawVLine(x, y, w, color);
+  } else if (getRotation() == 2) {
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+
+    x -= w - 1;
+    drawFastRawHLine(x, y, w, color);
+  } else if (getRotation() == 3) {
+    int16_t t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    y -= w - 1;
+    drawFastRawVLine(x, y, w, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Speed optimized vertical line drawing into the raw canvas buffer
+   @param    x   Line horizontal start point
+   @param    y   Line vertical start point
+   @param    h   length of vertical line to be drawn, including first point
+   @param    color   color 16-bit 5-6-5 Color to draw line with
+*/
+/**************************************************************************/
+void TFT_16bits::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
+                                   uint16_t color) {
+  // x & y already in raw (rotation 0) coordinates, no need to transform.
+  if (buffer == NULL) return;
+  uint16_t *buffer_ptr = buffer + y * WIDTH + x;
+  for (int16_t i = 0; i < h; i++) {
+    (*buffer_ptr) = color;
+    buffer_ptr += WIDTH;
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Speed optimized horizontal line drawing into the raw canvas buffer
+   @param    x   Line horizontal start point
+   @param    y   Line vertical start point
+   @param    w   length of horizontal line to be drawn, including first point
+   @param    color   color 16-bit 5-6-5 Color to draw line with
+*/
+/**************************************************************************/
+void TFT_16bits::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
+                                   uint16_t color) {
+  // x & y already in raw (rotation 0) coordinates, no need to transform.
+  if (buffer == NULL) return;
+  uint32_t buffer_index = y * WIDTH + x;
+  for (uint32_t i = buffer_index; i < buffer_index + w; i++) {
+    buffer[i] = color;
+  }
+}
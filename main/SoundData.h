@@ -1,5154 +1,5154 @@
-// sound in WAV format, we're not concernet with most of the header bytes
-// just samples per second and data size, we will always save in 8bit 
-// unsigned pcm
-// sample rate is at offset 24, data size at
-
-/* C:\Users\barto\Downloads\pacman_beginning8.wav (2/8/2018 12:53:34 PM)
-   StartOffset: 00000000, EndOffset: 00008439, Length: 0000843A */
-
-uint8_t pacman[33850] = {
-  0x52, 0x49, 0x46, 0x46, 0x32, 0x84, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-  0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0x40, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-  0x64, 0x61, 0x74, 0x61, 0xC6, 0x83, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F,
-  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x80, 0x7E, 0x80, 0x7E, 0x80,
-  0x7E, 0x80, 0x7D, 0x84, 0xA2, 0x9F, 0xAF, 0xC0, 0xCE, 0xE1, 0xED, 0xF1,
-  0xED, 0xE8, 0xDC, 0xCB, 0xB5, 0xA4, 0x95, 0x92, 0x91, 0x94, 0x9D, 0xB1,
-  0xB6, 0xB5, 0xB9, 0xBB, 0x99, 0x7D, 0x66, 0x51, 0x64, 0x65, 0x5E, 0x74,
-  0x9D, 0xAF, 0xC9, 0xC4, 0xB8, 0xC1, 0xBB, 0xA3, 0x89, 0x73, 0x54, 0x3B,
-  0x2E, 0x30, 0x35, 0x42, 0x56, 0x70, 0x7F, 0x89, 0x8E, 0x8C, 0x86, 0x77,
-  0x5E, 0x49, 0x3E, 0x34, 0x31, 0x42, 0x5A, 0x72, 0x91, 0xB1, 0xC2, 0xC1,
-  0xBE, 0xBC, 0xAE, 0x92, 0x82, 0x7B, 0x71, 0x71, 0x7F, 0x91, 0xA7, 0xC0,
-  0xD4, 0xDD, 0xDF, 0xD7, 0xC5, 0xAF, 0x90, 0x76, 0x63, 0x5D, 0x5F, 0x62,
-  0x6B, 0x83, 0x92, 0x96, 0x9C, 0x9F, 0x8F, 0x72, 0x5D, 0x43, 0x29, 0x17,
-  0x14, 0x18, 0x20, 0x31, 0x4C, 0x66, 0x7A, 0x83, 0x83, 0x84, 0x7F, 0x6B,
-  0x57, 0x57, 0x53, 0x4C, 0x55, 0x73, 0x8A, 0xA4, 0xC2, 0xD9, 0xDF, 0xDC,
-  0xD3, 0xC3, 0xA6, 0x8A, 0x70, 0x60, 0x5E, 0x60, 0x65, 0x76, 0x93, 0x99,
-  0x99, 0x9F, 0x9D, 0x6F, 0x4D, 0x30, 0x20, 0x38, 0x3B, 0x39, 0x55, 0x7C,
-  0x8E, 0xA9, 0xA3, 0x9B, 0xA1, 0x9A, 0x84, 0x6E, 0x5A, 0x3F, 0x2B, 0x20,
-  0x22, 0x28, 0x35, 0x4A, 0x65, 0x72, 0x7C, 0x80, 0x7E, 0x78, 0x6B, 0x53,
-  0x41, 0x38, 0x2F, 0x2E, 0x3F, 0x55, 0x6C, 0x8C, 0xAB, 0xBA, 0xB9, 0xB8,
-  0xB5, 0xA3, 0x88, 0x7A, 0x72, 0x69, 0x6B, 0x79, 0x8C, 0xA5, 0xBF, 0xD2,
-  0xDC, 0xDE, 0xD4, 0xC1, 0xA8, 0x88, 0x6F, 0x5E, 0x59, 0x5C, 0x5F, 0x6B,
-  0x83, 0x93, 0x97, 0x9D, 0xA0, 0x8D, 0x71, 0x5C, 0x41, 0x26, 0x17, 0x14,
-  0x1A, 0x23, 0x36, 0x52, 0x6D, 0x81, 0x89, 0x89, 0x88, 0x82, 0x6D, 0x5A,
-  0x5A, 0x55, 0x4E, 0x5A, 0x78, 0x8F, 0xAB, 0xC9, 0xDD, 0xE1, 0xDE, 0xD5,
-  0xC3, 0xA7, 0x8A, 0x73, 0x67, 0x64, 0x67, 0x6D, 0x81, 0x9C, 0xA0, 0xA1,
-  0xA7, 0xA2, 0x71, 0x53, 0x33, 0x2A, 0x3F, 0x3C, 0x3D, 0x5B, 0x82, 0x96,
-  0xAF, 0xA5, 0xA4, 0xA9, 0xA0, 0x89, 0x72, 0x5B, 0x3F, 0x2B, 0x22, 0x25,
-  0x2B, 0x3A, 0x52, 0x6C, 0x79, 0x85, 0x87, 0x84, 0x7E, 0x6D, 0x56, 0x45,
-  0x3B, 0x31, 0x33, 0x45, 0x5D, 0x77, 0x96, 0xB4, 0xC0, 0xBE, 0xBC, 0xB7,
-  0xA4, 0x8A, 0x7D, 0x74, 0x6D, 0x70, 0x80, 0x93, 0xAB, 0xC5, 0xD7, 0xDE,
-  0xE0, 0xD5, 0xC1, 0xAA, 0x8B, 0x72, 0x61, 0x5E, 0x60, 0x64, 0x72, 0x8B,
-  0x99, 0x9D, 0xA4, 0xA5, 0x8E, 0x75, 0x5F, 0x41, 0x27, 0x18, 0x17, 0x1C,
-  0x27, 0x3C, 0x5B, 0x75, 0x87, 0x8E, 0x8E, 0x8D, 0x85, 0x6D, 0x5B, 0x5B,
-  0x56, 0x50, 0x61, 0x7D, 0x94, 0xB2, 0xCD, 0xE0, 0xE3, 0xDF, 0xD5, 0xC3,
-  0xA5, 0x8A, 0x74, 0x69, 0x67, 0x6A, 0x72, 0x88, 0xA1, 0xA4, 0xA7, 0xAE,
-  0xA2, 0x72, 0x58, 0x37, 0x32, 0x45, 0x41, 0x43, 0x66, 0x8A, 0x9F, 0xB6,
-  0xAA, 0xAA, 0xAF, 0xA4, 0x8B, 0x75, 0x5B, 0x3F, 0x2B, 0x23, 0x27, 0x2F,
-  0x3F, 0x59, 0x74, 0x80, 0x8B, 0x8E, 0x8A, 0x81, 0x6F, 0x55, 0x44, 0x3A,
-  0x31, 0x35, 0x49, 0x60, 0x7B, 0x9D, 0xB9, 0xC2, 0xBF, 0xBD, 0xB6, 0xA1,
-  0x87, 0x7B, 0x72, 0x6A, 0x70, 0x7F, 0x94, 0xAE, 0xC6, 0xD7, 0xDE, 0xDE,
-  0xD2, 0xBF, 0xA6, 0x87, 0x6F, 0x60, 0x5D, 0x61, 0x66, 0x77, 0x90, 0x9E,
-  0xA3, 0xAB, 0xA9, 0x92, 0x79, 0x61, 0x42, 0x28, 0x1A, 0x1A, 0x20, 0x2D,
-  0x44, 0x63, 0x7C, 0x8E, 0x93, 0x92, 0x90, 0x85, 0x6B, 0x5B, 0x59, 0x53,
-  0x4F, 0x61, 0x7D, 0x95, 0xB4, 0xCE, 0xDF, 0xE1, 0xDC, 0xD1, 0xBE, 0x9F,
-  0x84, 0x6F, 0x65, 0x64, 0x69, 0x72, 0x8B, 0xA4, 0xA8, 0xAB, 0xB2, 0xA2,
-  0x75, 0x5D, 0x3A, 0x37, 0x46, 0x40, 0x47, 0x6C, 0x8A, 0xA2, 0xB9, 0xAC,
-  0xAF, 0xB2, 0xA4, 0x8C, 0x76, 0x5A, 0x3D, 0x28, 0x20, 0x23, 0x2C, 0x3F,
-  0x5D, 0x79, 0x85, 0x90, 0x94, 0x98, 0x9B, 0x9A, 0x99, 0x9A, 0x9C, 0x9B,
-  0x9D, 0xA5, 0xA7, 0xA5, 0xAA, 0xB3, 0xB2, 0xB0, 0xB6, 0xBB, 0xB8, 0xB7,
-  0xBD, 0xBE, 0xBB, 0xBB, 0xBC, 0xBC, 0xB9, 0xBA, 0xBC, 0xBA, 0xB9, 0xB4,
-  0xB1, 0xB1, 0xAF, 0xAB, 0xA8, 0xA9, 0xA3, 0x99, 0x97, 0x95, 0x8C, 0x83,
-  0x83, 0x80, 0x70, 0x68, 0x69, 0x65, 0x5D, 0x5B, 0x5C, 0x59, 0x57, 0x56,
-  0x58, 0x5C, 0x61, 0x60, 0x64, 0x6D, 0x72, 0x6F, 0x79, 0x88, 0x89, 0x88,
-  0x94, 0xA0, 0x9E, 0x9E, 0xA4, 0xA7, 0xA3, 0xA5, 0xA6, 0xA7, 0xA4, 0xA1,
-  0x9B, 0x9C, 0x99, 0x92, 0x8B, 0x8C, 0x85, 0x76, 0x6F, 0x73, 0x63, 0x46,
-  0x44, 0x43, 0x5E, 0x75, 0x75, 0x78, 0x93, 0x9F, 0x9F, 0x96, 0x77, 0x73,
-  0x73, 0x6B, 0x5F, 0x60, 0x60, 0x58, 0x53, 0x54, 0x54, 0x51, 0x51, 0x52,
-  0x51, 0x4D, 0x4F, 0x4F, 0x54, 0x59, 0x59, 0x5A, 0x60, 0x63, 0x63, 0x67,
-  0x70, 0x73, 0x72, 0x7A, 0x86, 0x86, 0x85, 0x8E, 0x94, 0x93, 0x94, 0x9B,
-  0x9D, 0x9B, 0x9D, 0x9F, 0x9E, 0x9D, 0x9E, 0xA0, 0x9F, 0x9D, 0x99, 0x96,
-  0x96, 0x94, 0x8E, 0x8C, 0x8D, 0x87, 0x7F, 0x7E, 0x7D, 0x75, 0x6D, 0x6F,
-  0x6B, 0x5D, 0x57, 0x5A, 0x57, 0x4F, 0x4E, 0x50, 0x4D, 0x4C, 0x4D, 0x4E,
-  0x54, 0x58, 0x58, 0x5C, 0x65, 0x69, 0x68, 0x73, 0x81, 0x81, 0x82, 0x8F,
-  0x98, 0x96, 0x98, 0x9D, 0x9F, 0x9E, 0x9F, 0xA0, 0xA0, 0x9E, 0x9B, 0x96,
-  0x96, 0x93, 0x8D, 0x86, 0x88, 0x81, 0x74, 0x6E, 0x71, 0x60, 0x47, 0x47,
-  0x46, 0x62, 0x75, 0x74, 0x79, 0x93, 0x9B, 0x9C, 0x90, 0x75, 0x73, 0x72,
-  0x6B, 0x60, 0x63, 0x61, 0x5A, 0x57, 0x58, 0x58, 0x56, 0x55, 0x58, 0x56,
-  0x54, 0x55, 0x55, 0x5B, 0x5F, 0x5F, 0x61, 0x66, 0x68, 0x68, 0x6C, 0x75,
-  0x77, 0x77, 0x80, 0x8A, 0x89, 0x8A, 0x93, 0x99, 0x96, 0x99, 0xA1, 0xA2,
-  0xA0, 0xA1, 0xA4, 0xA3, 0xA2, 0xA2, 0xA1, 0xA0, 0x9E, 0x9A, 0x98, 0x98,
-  0x95, 0x91, 0x90, 0x8F, 0x89, 0x82, 0x82, 0x80, 0x78, 0x72, 0x74, 0x6F,
-  0x61, 0x5E, 0x60, 0x5B, 0x55, 0x55, 0x56, 0x54, 0x52, 0x53, 0x55, 0x5A,
-  0x5E, 0x5E, 0x63, 0x6B, 0x6E, 0x6E, 0x79, 0x85, 0x85, 0x86, 0x93, 0x9A,
-  0x99, 0x9A, 0xA0, 0xA1, 0x9F, 0xA1, 0xA2, 0xA2, 0xA0, 0x9D, 0x99, 0x9A,
-  0x96, 0x90, 0x8B, 0x8D, 0x85, 0x78, 0x74, 0x77, 0x62, 0x4F, 0x4F, 0x50,
-  0x6B, 0x79, 0x78, 0x80, 0x98, 0x9C, 0x9D, 0x8F, 0x78, 0x77, 0x75, 0x6D,
-  0x65, 0x68, 0x65, 0x5F, 0x5C, 0x5E, 0x5C, 0x5B, 0x5B, 0x5D, 0x5A, 0x58,
-  0x59, 0x5A, 0x5F, 0x62, 0x63, 0x65, 0x6A, 0x6B, 0x6B, 0x71, 0x79, 0x7A,
-  0x7B, 0x85, 0x8C, 0x8B, 0x8E, 0x96, 0x99, 0x98, 0x9B, 0xA2, 0xA2, 0xA1,
-  0xA3, 0xA4, 0xA3, 0xA3, 0xA5, 0xA5, 0xA4, 0xA2, 0x9E, 0x9C, 0x9B, 0x98,
-  0x94, 0x93, 0x92, 0x8C, 0x86, 0x83, 0x80, 0x78, 0x75, 0x76, 0x71, 0x67,
-  0x64, 0x65, 0x61, 0x5D, 0x5E, 0x5E, 0x5C, 0x5B, 0x5C, 0x5E, 0x62, 0x64,
-  0x64, 0x69, 0x6F, 0x71, 0x71, 0x7B, 0x83, 0x83, 0x85, 0x90, 0x94, 0x93,
-  0x95, 0x99, 0x9A, 0x99, 0x9A, 0x9B, 0x9C, 0x9A, 0x97, 0x94, 0x95, 0x92,
-  0x8D, 0x8A, 0x8B, 0x83, 0x7A, 0x78, 0x79, 0x67, 0x59, 0x59, 0x5D, 0x74,
-  0x7C, 0x7C, 0x83, 0x96, 0x98, 0x99, 0x8D, 0x7B, 0x7B, 0x79, 0x72, 0x6C,
-  0x6D, 0x6B, 0x66, 0x64, 0x65, 0x63, 0x62, 0x62, 0x63, 0x61, 0x60, 0x61,
-  0x62, 0x66, 0x68, 0x68, 0x6A, 0x6E, 0x6F, 0x6F, 0x74, 0x7A, 0x7A, 0x7C,
-  0x83, 0x89, 0x88, 0x8A, 0x91, 0x94, 0x92, 0x96, 0x9A, 0x9B, 0x9A, 0x9C,
-  0x9E, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9C, 0x98, 0x97, 0x96, 0x94, 0x91,
-  0x91, 0x8F, 0x89, 0x85, 0x86, 0x83, 0x7C, 0x79, 0x7B, 0x74, 0x6B, 0x6C,
-  0x6D, 0x69, 0x66, 0x67, 0x66, 0x63, 0x4B, 0x20, 0x05, 0x0A, 0x2D, 0x5B,
-  0x77, 0x74, 0x50, 0x2A, 0x25, 0x3D, 0x69, 0x8D, 0x99, 0x83, 0x59, 0x41,
-  0x48, 0x6C, 0x9A, 0xB0, 0xA3, 0x75, 0x4C, 0x40, 0x58, 0x8C, 0xAD, 0xAA,
-  0x85, 0x53, 0x33, 0x37, 0x64, 0x94, 0x94, 0x78, 0x45, 0x24, 0x32, 0x57,
-  0x8B, 0xB2, 0xBD, 0x95, 0x65, 0x45, 0x49, 0x79, 0xA3, 0xA8, 0x8B, 0x5A,
-  0x35, 0x31, 0x53, 0x89, 0xA2, 0x97, 0x6A, 0x3A, 0x28, 0x3E, 0x73, 0x9D,
-  0xA6, 0x88, 0x54, 0x36, 0x3D, 0x68, 0x9C, 0xB4, 0xA9, 0x79, 0x50, 0x4B,
-  0x6A, 0x9E, 0xC3, 0xC8, 0xA6, 0x73, 0x5C, 0x6A, 0x97, 0xC5, 0xD5, 0xC2,
-  0x91, 0x68, 0x64, 0x84, 0xB7, 0xD3, 0xCC, 0xA5, 0x72, 0x5A, 0x68, 0x99,
-  0xC2, 0xC8, 0xAE, 0x7A, 0x53, 0x4C, 0x70, 0xA4, 0xB7, 0xA8, 0x7A, 0x47,
-  0x31, 0x45, 0x7C, 0xA4, 0xA8, 0x89, 0x53, 0x33, 0x3C, 0x69, 0x9C, 0xB5,
-  0xAB, 0x7D, 0x51, 0x4E, 0x6E, 0xA1, 0xC6, 0xCE, 0xAC, 0x78, 0x5D, 0x69,
-  0x98, 0xC7, 0xD8, 0xC5, 0x92, 0x67, 0x5E, 0x7C, 0xB1, 0xCB, 0xC4, 0x9D,
-  0x6A, 0x4C, 0x56, 0x87, 0xB1, 0xAE, 0x91, 0x5A, 0x39, 0x48, 0x72, 0xA6,
-  0xCA, 0xCD, 0xA1, 0x6D, 0x4E, 0x5C, 0x91, 0xB8, 0xBA, 0x99, 0x63, 0x3F,
-  0x40, 0x69, 0x9E, 0xB2, 0xA3, 0x73, 0x42, 0x32, 0x4E, 0x87, 0xAE, 0xB2,
-  0x8F, 0x58, 0x3D, 0x48, 0x78, 0xAA, 0xBD, 0xAE, 0x7B, 0x52, 0x50, 0x73,
-  0xA8, 0xC9, 0xC9, 0xA3, 0x6F, 0x5A, 0x6C, 0x9C, 0xC8, 0xD3, 0xBC, 0x88,
-  0x62, 0x62, 0x85, 0xB8, 0xD2, 0xC8, 0x9C, 0x69, 0x55, 0x69, 0x9B, 0xC1,
-  0xC5, 0xA6, 0x70, 0x4A, 0x4A, 0x73, 0xA6, 0xB7, 0xA4, 0x73, 0x41, 0x31,
-  0x4A, 0x83, 0xA7, 0xA8, 0x85, 0x4F, 0x33, 0x3F, 0x6F, 0xA2, 0xB6, 0xA6,
-  0x73, 0x4C, 0x4C, 0x6E, 0xA4, 0xC7, 0xCA, 0xA3, 0x6F, 0x5A, 0x6B, 0x9C,
-  0xC9, 0xD7, 0xBF, 0x89, 0x61, 0x5A, 0x7B, 0xB0, 0xC8, 0xBD, 0x91, 0x5E,
-  0x45, 0x54, 0x89, 0xB0, 0xAB, 0x8B, 0x52, 0x35, 0x45, 0x72, 0xA7, 0xC7,
-  0xC2, 0x91, 0x60, 0x47, 0x5B, 0x91, 0xB6, 0xB4, 0x8F, 0x59, 0x39, 0x3E,
-  0x6D, 0xA0, 0xB0, 0x9E, 0x6A, 0x3B, 0x31, 0x53, 0x8B, 0xAE, 0xAD, 0x86,
-  0x51, 0x38, 0x48, 0x7C, 0xAC, 0xBC, 0xA6, 0x70, 0x4A, 0x4B, 0x73, 0xA9,
-  0xC7, 0xC3, 0x97, 0x63, 0x52, 0x69, 0x9D, 0xC6, 0xCF, 0xB2, 0x7B, 0x58,
-  0x5C, 0x86, 0xB9, 0xCE, 0xC0, 0x90, 0x5D, 0x4D, 0x67, 0x9C, 0xBF, 0xBF,
-  0x9B, 0x65, 0x43, 0x48, 0x76, 0xA7, 0xB4, 0x9E, 0x6A, 0x3C, 0x30, 0x4F,
-  0x88, 0xA8, 0xA5, 0x7E, 0x48, 0x30, 0x41, 0x73, 0xA3, 0xB4, 0x9F, 0x69,
-  0x45, 0x47, 0x6E, 0xA4, 0xC5, 0xC4, 0x98, 0x65, 0x54, 0x69, 0x9C, 0xC8,
-  0xD2, 0xB4, 0x7C, 0x57, 0x58, 0x80, 0xB4, 0xC8, 0xB9, 0x89, 0x57, 0x43,
-  0x59, 0x8F, 0xB2, 0xA9, 0x84, 0x4C, 0x35, 0x46, 0x76, 0xAA, 0xC4, 0xB8,
-  0x82, 0x53, 0x41, 0x5D, 0x95, 0xB7, 0xB2, 0x89, 0x53, 0x37, 0x42, 0x74,
-  0xA5, 0xB3, 0x9A, 0x64, 0x3A, 0x35, 0x5A, 0x92, 0xB2, 0xAC, 0x7F, 0x4B,
-  0x38, 0x4C, 0x81, 0xAF, 0xBB, 0x9F, 0x67, 0x44, 0x49, 0x73, 0xAA, 0xC5,
-  0xBB, 0x8B, 0x58, 0x4B, 0x65, 0x9C, 0xC4, 0xC8, 0xA6, 0x6E, 0x4F, 0x56,
-  0x85, 0xB8, 0xCA, 0xB8, 0x84, 0x54, 0x4A, 0x67, 0x9E, 0xC0, 0xBD, 0x95,
-  0x5E, 0x41, 0x4B, 0x7E, 0xAD, 0xB7, 0x9E, 0x68, 0x3B, 0x34, 0x59, 0x91,
-  0xAE, 0xA8, 0x7C, 0x46, 0x32, 0x46, 0x7C, 0xAA, 0xB6, 0x9C, 0x64, 0x40,
-  0x46, 0x71, 0xA8, 0xC4, 0xBB, 0x8B, 0x59, 0x4A, 0x64, 0x9B, 0xC4, 0xC9,
-  0xA7, 0x6E, 0x4C, 0x52, 0x81, 0xB4, 0xC7, 0xB4, 0x81, 0x50, 0x41, 0x5E,
-  0x96, 0xB6, 0xAC, 0x85, 0x4B, 0x34, 0x4B, 0x7E, 0xB3, 0xCC, 0xB7, 0x7D,
-  0x4D, 0x3E, 0x64, 0x9F, 0xC0, 0xB4, 0x9D, 0x98, 0x94, 0x92, 0x91, 0x90,
-  0x8F, 0x8E, 0x8D, 0x8D, 0x8B, 0x8B, 0x8A, 0x8A, 0x8B, 0x8B, 0x8A, 0x8A,
-  0x8B, 0x8A, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8E, 0x8E, 0x8D, 0x8F, 0x91,
-  0x90, 0x8F, 0x91, 0x91, 0x90, 0x90, 0x91, 0x90, 0x8F, 0x90, 0x90, 0x8F,
-  0x8F, 0x8E, 0x8C, 0x8D, 0x8C, 0x8A, 0x89, 0x89, 0x87, 0x85, 0x85, 0x84,
-  0x82, 0x80, 0x80, 0x7F, 0x7C, 0x79, 0x7A, 0x79, 0x77, 0x76, 0x77, 0x76,
-  0x76, 0x75, 0x76, 0x77, 0x78, 0x77, 0x78, 0x79, 0x7A, 0x7A, 0x7C, 0x7F,
-  0x7E, 0x7F, 0x81, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84, 0x85, 0x86, 0x85,
-  0x84, 0x84, 0x83, 0x83, 0x82, 0x80, 0x7F, 0x80, 0x7E, 0x7B, 0x79, 0x7A,
-  0x76, 0x70, 0x70, 0x6F, 0x76, 0x7B, 0x7B, 0x7D, 0x83, 0x85, 0x86, 0x83,
-  0x7C, 0x7C, 0x7B, 0x79, 0x77, 0x77, 0x76, 0x76, 0x74, 0x75, 0x74, 0x73,
-  0x73, 0x74, 0x74, 0x73, 0x73, 0x73, 0x76, 0x78, 0x78, 0x79, 0x78, 0x7A,
-  0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7F, 0x7E,
-  0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B,
-  0x7A, 0x7B, 0x7B, 0x79, 0x78, 0x79, 0x78, 0x77, 0x77, 0x78, 0x77, 0x78,
-  0x77, 0x78, 0x78, 0x79, 0x78, 0x79, 0x7A, 0x7B, 0x7A, 0x7C, 0x7E, 0x7D,
-  0x7E, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7B, 0x7A, 0x7B, 0x79,
-  0x76, 0x75, 0x76, 0x79, 0x7B, 0x7B, 0x7C, 0x7F, 0x80, 0x80, 0x7F, 0x7C,
-  0x7C, 0x7B, 0x7B, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A, 0x7A,
-  0x7B, 0x7A, 0x79, 0x7A, 0x7A, 0x7B, 0x7A, 0x7A, 0x7B, 0x7C, 0x7B, 0x7B,
-  0x7C, 0x7E, 0x7D, 0x7E, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
-  0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7D, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x80,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7F, 0x81, 0x7E, 0x8A, 0x86, 0x63, 0x52, 0x55, 0x6D,
-  0x94, 0xB7, 0xC6, 0xC2, 0xAA, 0x81, 0x5E, 0x4E, 0x52, 0x6D, 0x94, 0xB5,
-  0xC2, 0xBC, 0xA2, 0x79, 0x58, 0x4A, 0x51, 0x6D, 0x95, 0xB5, 0xBF, 0xB8,
-  0x9C, 0x74, 0x53, 0x47, 0x50, 0x6E, 0x96, 0xB4, 0xBD, 0xB4, 0x96, 0x6F,
-  0x50, 0x45, 0x51, 0x71, 0x99, 0xB6, 0xBD, 0xB3, 0x93, 0x6B, 0x4D, 0x45,
-  0x53, 0x74, 0x9C, 0xB6, 0xBC, 0xAF, 0x8E, 0x65, 0x4B, 0x44, 0x54, 0x77,
-  0x9E, 0xB6, 0xBB, 0xAC, 0x89, 0x62, 0x48, 0x44, 0x56, 0x79, 0xA1, 0xB7,
-  0xB9, 0xA8, 0x84, 0x5D, 0x45, 0x43, 0x56, 0x7B, 0xA1, 0xB6, 0xB7, 0xA3,
-  0x7F, 0x59, 0x42, 0x43, 0x59, 0x7F, 0xA4, 0xB7, 0xB5, 0xA1, 0x7B, 0x56,
-  0x42, 0x43, 0x5C, 0x83, 0xA6, 0xB7, 0xB4, 0x9E, 0x77, 0x54, 0x42, 0x47,
-  0x61, 0x88, 0xAB, 0xB9, 0xB5, 0x9D, 0x75, 0x52, 0x43, 0x48, 0x64, 0x8D,
-  0xAD, 0xBA, 0xB3, 0x99, 0x70, 0x4F, 0x41, 0x47, 0x64, 0x8E, 0xAC, 0xB8,
-  0xB0, 0x93, 0x6B, 0x4A, 0x3E, 0x49, 0x67, 0x91, 0xAF, 0xB8, 0xAE, 0x90,
-  0x67, 0x48, 0x3E, 0x4B, 0x6B, 0x94, 0xB1, 0xB8, 0xAD, 0x8C, 0x64, 0x46,
-  0x3F, 0x4D, 0x6F, 0x99, 0xB2, 0xB8, 0xAA, 0x89, 0x60, 0x45, 0x3F, 0x50,
-  0x74, 0x9C, 0xB5, 0xB8, 0xA8, 0x86, 0x5D, 0x45, 0x42, 0x54, 0x79, 0xA0,
-  0xB6, 0xB9, 0xA7, 0x83, 0x5C, 0x44, 0x43, 0x57, 0x7D, 0xA3, 0xB7, 0xB8,
-  0xA4, 0x7E, 0x59, 0x43, 0x44, 0x5A, 0x81, 0xA6, 0xB8, 0xB7, 0xA2, 0x7B,
-  0x55, 0x41, 0x44, 0x5C, 0x83, 0xA7, 0xB8, 0xB5, 0x9D, 0x75, 0x51, 0x40,
-  0x45, 0x5F, 0x87, 0xAA, 0xB8, 0xB4, 0x9B, 0x72, 0x4F, 0x40, 0x47, 0x63,
-  0x8C, 0xAD, 0xB8, 0xB3, 0x97, 0x6E, 0x4E, 0x40, 0x49, 0x67, 0x90, 0xAF,
-  0xBA, 0xB3, 0x95, 0x6D, 0x4D, 0x41, 0x4D, 0x6D, 0x96, 0xB3, 0xBB, 0xB1,
-  0x92, 0x69, 0x4C, 0x42, 0x4F, 0x71, 0x99, 0xB4, 0xBA, 0xAE, 0x8D, 0x64,
-  0x46, 0x40, 0x4F, 0x72, 0x9B, 0xB5, 0xBA, 0xAC, 0x89, 0x60, 0x46, 0x40,
-  0x51, 0x75, 0x9E, 0xB5, 0xB9, 0xA9, 0x85, 0x5C, 0x44, 0x41, 0x54, 0x7A,
-  0xA1, 0xB7, 0xB9, 0xA6, 0x81, 0x5A, 0x43, 0x41, 0x57, 0x7E, 0xA4, 0xB8,
-  0xB9, 0xA4, 0x7D, 0x58, 0x43, 0x43, 0x5B, 0x82, 0xA8, 0xBB, 0xB9, 0xA3,
-  0x7A, 0x55, 0x42, 0x45, 0x5E, 0x87, 0xAB, 0xBB, 0xB7, 0x9F, 0x77, 0x53,
-  0x42, 0x48, 0x62, 0x8B, 0xAD, 0xBB, 0xB7, 0x9C, 0x73, 0x50, 0x41, 0x49,
-  0x65, 0x8F, 0xB0, 0xBB, 0xB3, 0x98, 0x6D, 0x4C, 0x40, 0x49, 0x67, 0x91,
-  0xB0, 0xBA, 0xB2, 0x93, 0x6A, 0x4A, 0x3F, 0x4B, 0x6B, 0x95, 0xB2, 0xBB,
-  0xB0, 0x90, 0x67, 0x49, 0x40, 0x4E, 0x70, 0x99, 0xB4, 0xBC, 0xAE, 0x8D,
-  0x64, 0x48, 0x42, 0x52, 0x76, 0x9E, 0xB8, 0xBC, 0xAE, 0x8B, 0x62, 0x48,
-  0x43, 0x55, 0x79, 0xA1, 0xB9, 0xBB, 0xAB, 0x85, 0x5B, 0x42, 0x40, 0x53,
-  0x7A, 0xA3, 0xB8, 0xB9, 0xA7, 0x81, 0x59, 0x42, 0x41, 0x57, 0x7F, 0xA6,
-  0xB9, 0xB9, 0xA4, 0x7C, 0x55, 0x41, 0x42, 0x5A, 0x82, 0xA8, 0xBA, 0xB8,
-  0xA1, 0x78, 0x53, 0x3F, 0x43, 0x5D, 0x86, 0xAB, 0xBB, 0xB7, 0x9E, 0x75,
-  0x51, 0x40, 0x46, 0x61, 0x8B, 0xAE, 0xBC, 0xB6, 0x9C, 0x73, 0x4F, 0x41,
-  0x49, 0x66, 0x91, 0xB2, 0xBD, 0xB5, 0x98, 0x6E, 0x4D, 0x40, 0x4A, 0x6A,
-  0x94, 0xB3, 0xBD, 0xB4, 0x95, 0x6A, 0x4B, 0x41, 0x4C, 0x6E, 0x98, 0xB5,
-  0xBD, 0xB2, 0x92, 0x66, 0x49, 0x40, 0x4E, 0x71, 0x9A, 0xB5, 0xBB, 0xAE,
-  0x8C, 0x62, 0x46, 0x3F, 0x50, 0x74, 0x9D, 0xB7, 0xBB, 0xAC, 0x89, 0x5F,
-  0x44, 0x40, 0x52, 0x78, 0xA1, 0xB8, 0xBB, 0xAA, 0x85, 0x5C, 0x44, 0x42,
-  0x57, 0x7D, 0xA6, 0xBA, 0xBC, 0xA9, 0x83, 0x5C, 0x46, 0x47, 0x5C, 0x83,
-  0xA9, 0xBB, 0xBA, 0xA6, 0x7E, 0x58, 0x44, 0x43, 0x46, 0x48, 0x4A, 0x4B,
-  0x4E, 0x4F, 0x50, 0x51, 0x53, 0x54, 0x56, 0x57, 0x58, 0x5A, 0x5B, 0x5D,
-  0x5D, 0x5E, 0x60, 0x61, 0x61, 0x63, 0x63, 0x65, 0x65, 0x66, 0x67, 0x68,
-  0x69, 0x6A, 0x6B, 0x6C, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x70, 0x71, 0x72,
-  0x73, 0x73, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x78, 0x79, 0x7A,
-  0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x82, 0x83,
-  0x83, 0x82, 0x83, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
-  0x83, 0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85,
-  0x84, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x87, 0x86, 0x87,
-  0x86, 0x87, 0x86, 0x87, 0x87, 0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x88,
-  0x89, 0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x87, 0x85, 0x86, 0x85, 0x86,
-  0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x87,
-  0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86,
-  0x85, 0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x85, 0x86, 0x86, 0x86, 0x85,
-  0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87,
-  0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x86, 0x87, 0x86,
-  0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86,
-  0x87, 0x86, 0x87, 0x86, 0x85, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x84,
-  0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
-  0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
-  0x84, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x85, 0x86, 0x85, 0x86, 0x85,
-  0x86, 0x85, 0x86, 0x86, 0x85, 0x84, 0x85, 0x84, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
-  0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x82, 0x83, 0x82, 0x82,
-  0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81, 0x7B, 0x79, 0x79, 0x7A,
-  0x7B, 0x7A, 0x7B, 0x7A, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7D,
-  0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F,
-  0x80, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x85, 0x95, 0xA1, 0xBF, 0xC3,
-  0xC6, 0xC3, 0xAD, 0x99, 0x73, 0x57, 0x4C, 0x50, 0x5D, 0x7D, 0x9A, 0xB8,
-  0xD0, 0xD1, 0xD6, 0xC5, 0xAF, 0x9F, 0x92, 0x95, 0xA0, 0xAF, 0xC3, 0xD3,
-  0xD1, 0xCE, 0xB2, 0x96, 0x73, 0x47, 0x31, 0x4E, 0x6F, 0x8F, 0xC5, 0xD9,
-  0xC8, 0xB0, 0x9F, 0x77, 0x5B, 0x3F, 0x31, 0x38, 0x46, 0x63, 0x79, 0x87,
-  0x8F, 0x8D, 0x7C, 0x65, 0x4A, 0x3E, 0x44, 0x52, 0x76, 0x97, 0xB7, 0xD2,
-  0xD5, 0xD4, 0xBF, 0xA2, 0x8C, 0x7C, 0x7E, 0x8B, 0x9D, 0xB7, 0xCB, 0xD0,
-  0xCD, 0xB7, 0x98, 0x79, 0x54, 0x45, 0x38, 0x3B, 0x53, 0x67, 0x7A, 0x7F,
-  0x79, 0x6D, 0x5B, 0x3D, 0x32, 0x2D, 0x39, 0x61, 0x7E, 0xAE, 0xCB, 0xD6,
-  0xD8, 0xC5, 0xAB, 0x8C, 0x78, 0x69, 0x73, 0x78, 0x98, 0xAB, 0xAB, 0xAA,
-  0x7D, 0x54, 0x4F, 0x51, 0x46, 0x61, 0x7E, 0x7E, 0x83, 0x99, 0x97, 0x95,
-  0x83, 0x62, 0x43, 0x23, 0x16, 0x14, 0x24, 0x3E, 0x67, 0x7E, 0x8E, 0x90,
-  0x85, 0x79, 0x5C, 0x52, 0x50, 0x55, 0x73, 0x8C, 0xB3, 0xD0, 0xDC, 0xDB,
-  0xC8, 0xAC, 0x8E, 0x79, 0x6A, 0x70, 0x7B, 0x93, 0xAC, 0xB2, 0xB8, 0xA4,
-  0x8F, 0x69, 0x3A, 0x26, 0x14, 0x1E, 0x33, 0x50, 0x6C, 0x80, 0x86, 0x83,
-  0x7A, 0x5E, 0x58, 0x4D, 0x57, 0x71, 0x86, 0xB0, 0xC9, 0xDF, 0xE4, 0xD7,
-  0xB5, 0x90, 0x6D, 0x58, 0x54, 0x4F, 0x67, 0x71, 0x6A, 0x85, 0xA4, 0x9B,
-  0x97, 0x90, 0x6F, 0x43, 0x3F, 0x44, 0x59, 0x79, 0x81, 0x8D, 0x81, 0x70,
-  0x4F, 0x2C, 0x16, 0x15, 0x25, 0x3D, 0x62, 0x7F, 0x9B, 0xA4, 0xA4, 0x9E,
-  0x81, 0x72, 0x64, 0x64, 0x77, 0x8A, 0xB0, 0xCD, 0xE1, 0xE7, 0xD5, 0xB6,
-  0x93, 0x77, 0x64, 0x61, 0x63, 0x77, 0x8C, 0x9B, 0xA3, 0x8F, 0x81, 0x62,
-  0x3B, 0x22, 0x0E, 0x12, 0x2A, 0x4C, 0x6E, 0x8F, 0x9A, 0xA6, 0xA2, 0x8E,
-  0x84, 0x71, 0x70, 0x77, 0x88, 0xA3, 0xBE, 0xCC, 0xD3, 0xC7, 0xAC, 0x90,
-  0x63, 0x4D, 0x36, 0x24, 0x37, 0x72, 0x98, 0xB2, 0xD0, 0xC3, 0x99, 0x73,
-  0x54, 0x37, 0x34, 0x35, 0x4A, 0x65, 0x7A, 0x87, 0x85, 0x7A, 0x68, 0x4E,
-  0x35, 0x2C, 0x2D, 0x46, 0x65, 0x87, 0xAB, 0xBB, 0xC4, 0xBD, 0xA4, 0x8E,
-  0x78, 0x6F, 0x73, 0x84, 0xA2, 0xC2, 0xD5, 0xDB, 0xD3, 0xB9, 0x9C, 0x75,
-  0x5B, 0x4C, 0x47, 0x5A, 0x66, 0x7D, 0x8A, 0x89, 0x82, 0x6D, 0x4E, 0x33,
-  0x24, 0x1E, 0x36, 0x50, 0x7B, 0xA7, 0xB8, 0xCD, 0xC5, 0xB5, 0x9B, 0x82,
-  0x76, 0x74, 0x7C, 0x8D, 0xAB, 0xB9, 0xC9, 0xB8, 0xA1, 0x81, 0x46, 0x28,
-  0x33, 0x47, 0x5F, 0x93, 0xB7, 0xB4, 0xAC, 0xA6, 0x89, 0x71, 0x4B, 0x30,
-  0x24, 0x27, 0x3A, 0x51, 0x6D, 0x80, 0x90, 0x8B, 0x81, 0x67, 0x4E, 0x44,
-  0x3D, 0x55, 0x6D, 0x8F, 0xB6, 0xC8, 0xDA, 0xD3, 0xC0, 0xA2, 0x87, 0x79,
-  0x75, 0x7C, 0x8D, 0xAB, 0xC0, 0xCD, 0xC8, 0xB4, 0x9D, 0x6E, 0x53, 0x35,
-  0x27, 0x36, 0x45, 0x68, 0x7D, 0x87, 0x89, 0x82, 0x6C, 0x54, 0x41, 0x37,
-  0x4D, 0x5E, 0x88, 0xB3, 0xCD, 0xE3, 0xE0, 0xD4, 0xB3, 0x8D, 0x6F, 0x63,
-  0x5F, 0x71, 0x86, 0x9B, 0xAC, 0x98, 0x7C, 0x7C, 0x77, 0x5E, 0x63, 0x6A,
-  0x60, 0x5C, 0x7D, 0x90, 0x9E, 0x9F, 0x8B, 0x76, 0x4A, 0x2C, 0x15, 0x11,
-  0x25, 0x46, 0x6A, 0x89, 0x9B, 0x9E, 0x9D, 0x88, 0x73, 0x62, 0x55, 0x61,
-  0x70, 0x8F, 0xB5, 0xCF, 0xE3, 0xE0, 0xD1, 0xB5, 0x92, 0x77, 0x69, 0x68,
-  0x76, 0x8D, 0xA3, 0xB5, 0xB4, 0xAB, 0x95, 0x6A, 0x47, 0x27, 0x18, 0x1F,
-  0x33, 0x54, 0x78, 0x8C, 0x99, 0x9A, 0x8A, 0x7D, 0x64, 0x5B, 0x62, 0x6D,
-  0x89, 0xA8, 0xC8, 0xDB, 0xE2, 0xD0, 0xB8, 0x8E, 0x6E, 0x58, 0x44, 0x4E,
-  0x52, 0x5A, 0x80, 0xAB, 0xB2, 0xB8, 0xB4, 0x8A, 0x59, 0x42, 0x3A, 0x42,
-  0x5C, 0x73, 0x8A, 0x93, 0x90, 0x7F, 0x61, 0x3E, 0x2D, 0x29, 0x2C, 0x32,
-  0x34, 0x3E, 0x43, 0x4B, 0x5A, 0x5C, 0x6A, 0x6F, 0x75, 0x7E, 0x7E, 0x84,
-  0x85, 0x87, 0x8B, 0x8A, 0x86, 0x85, 0x82, 0x7F, 0x7E, 0x73, 0x72, 0x6A,
-  0x62, 0x5F, 0x4D, 0x4C, 0x45, 0x40, 0x41, 0x3D, 0x3E, 0x45, 0x4A, 0x4D,
-  0x5B, 0x5C, 0x6D, 0x79, 0x7E, 0x92, 0x92, 0x9B, 0x9E, 0xA0, 0xA3, 0xA3,
-  0x9E, 0x9C, 0x98, 0x8F, 0x8F, 0x7C, 0x77, 0x66, 0x4A, 0x4B, 0x6C, 0x7A,
-  0x89, 0xA5, 0xA4, 0x89, 0x7A, 0x74, 0x67, 0x69, 0x5E, 0x5D, 0x5B, 0x59,
-  0x5A, 0x56, 0x56, 0x5B, 0x60, 0x61, 0x68, 0x69, 0x72, 0x79, 0x7C, 0x8C,
-  0x8E, 0x97, 0xA0, 0xA1, 0xAB, 0xAA, 0xAD, 0xAF, 0xAF, 0xB1, 0xB1, 0xAC,
-  0xA9, 0xA6, 0xA1, 0xA0, 0x96, 0x91, 0x8C, 0x80, 0x7F, 0x6E, 0x66, 0x63,
-  0x5A, 0x5B, 0x57, 0x56, 0x5A, 0x60, 0x61, 0x6D, 0x71, 0x7B, 0x8C, 0x8E,
-  0xA2, 0xA6, 0xAB, 0xB0, 0xB1, 0xB5, 0xB4, 0xB1, 0xAB, 0xA7, 0x9B, 0x9B,
-  0x8D, 0x83, 0x79, 0x5D, 0x54, 0x6E, 0x82, 0x8A, 0xA5, 0xAC, 0x95, 0x83,
-  0x80, 0x72, 0x71, 0x69, 0x65, 0x64, 0x61, 0x62, 0x5E, 0x5E, 0x60, 0x66,
-  0x67, 0x6C, 0x6E, 0x73, 0x7C, 0x7D, 0x8A, 0x8F, 0x95, 0x9F, 0x9F, 0xA8,
-  0xAA, 0xAC, 0xAE, 0xAD, 0xB0, 0xB0, 0xAC, 0xA8, 0xA8, 0xA1, 0xA0, 0x9A,
-  0x91, 0x90, 0x82, 0x81, 0x76, 0x6A, 0x69, 0x5F, 0x5E, 0x5B, 0x5A, 0x5C,
-  0x63, 0x64, 0x6D, 0x73, 0x78, 0x8A, 0x8C, 0x9A, 0xA3, 0xA4, 0xAC, 0xAB,
-  0xAF, 0xAF, 0xAD, 0xA7, 0xA7, 0x9D, 0x9B, 0x91, 0x83, 0x7E, 0x64, 0x53,
-  0x65, 0x7E, 0x86, 0x9F, 0xAD, 0x9B, 0x83, 0x80, 0x72, 0x6E, 0x69, 0x60,
-  0x62, 0x5D, 0x5F, 0x5C, 0x5A, 0x5B, 0x61, 0x64, 0x67, 0x6B, 0x6E, 0x78,
-  0x79, 0x84, 0x8D, 0x8F, 0x9B, 0x9C, 0xA3, 0xA8, 0xA7, 0xAC, 0xAA, 0xAD,
-  0xAE, 0xAC, 0xA7, 0xA6, 0xA1, 0x9F, 0x9B, 0x91, 0x90, 0x83, 0x7E, 0x78,
-  0x69, 0x68, 0x5F, 0x5D, 0x5C, 0x59, 0x5A, 0x5F, 0x62, 0x68, 0x70, 0x72,
-  0x82, 0x87, 0x8F, 0x9D, 0x9D, 0xA5, 0xA5, 0xA8, 0xA8, 0xA8, 0xA2, 0xA2,
-  0x9B, 0x96, 0x91, 0x81, 0x7D, 0x6A, 0x54, 0x5B, 0x77, 0x7F, 0x92, 0xA6,
-  0x9C, 0x84, 0x7E, 0x75, 0x6C, 0x6B, 0x62, 0x63, 0x5F, 0x5F, 0x5E, 0x5B,
-  0x5B, 0x60, 0x64, 0x66, 0x6B, 0x6C, 0x74, 0x78, 0x7F, 0x8A, 0x8B, 0x96,
-  0x9A, 0x9D, 0xA4, 0xA4, 0xA7, 0xA7, 0xA8, 0xAA, 0xA9, 0xA4, 0xA2, 0x9E,
-  0x9A, 0x99, 0x8F, 0x8D, 0x86, 0x7D, 0x7B, 0x6B, 0x68, 0x62, 0x5D, 0x5D,
-  0x59, 0x59, 0x5D, 0x62, 0x64, 0x6F, 0x70, 0x7D, 0x86, 0x89, 0x99, 0x9A,
-  0xA0, 0xA3, 0xA4, 0xA5, 0xA6, 0xA1, 0x9F, 0x9B, 0x92, 0x92, 0x82, 0x7D,
-  0x70, 0x56, 0x56, 0x72, 0x7C, 0x89, 0xA1, 0xA0, 0x88, 0x7D, 0x77, 0x6B,
-  0x6C, 0x63, 0x62, 0x60, 0x5F, 0x5E, 0x5C, 0x5C, 0x5F, 0x65, 0x66, 0x6B,
-  0x6B, 0x72, 0x77, 0x79, 0x84, 0x85, 0x8B, 0x91, 0x92, 0x99, 0x99, 0x9C,
-  0x9C, 0x9C, 0x9F, 0x9E, 0x9B, 0x98, 0x97, 0x93, 0x92, 0x8B, 0x88, 0x85,
-  0x7D, 0x7B, 0x70, 0x6A, 0x67, 0x61, 0x62, 0x5F, 0x5E, 0x61, 0x64, 0x66,
-  0x6E, 0x70, 0x77, 0x83, 0x85, 0x92, 0x95, 0x97, 0x9B, 0x9C, 0x9E, 0x9D,
-  0x9B, 0x98, 0x98, 0x8F, 0x8F, 0x85, 0x7E, 0x77, 0x62, 0x5B, 0x6E, 0x7C,
-  0x82, 0x97, 0x9D, 0x8D, 0x7F, 0x7C, 0x72, 0x70, 0x6B, 0x67, 0x67, 0x65,
-  0x66, 0x63, 0x62, 0x64, 0x68, 0x69, 0x6D, 0x6E, 0x73, 0x79, 0x7A, 0x84,
-  0x88, 0x8B, 0x93, 0x94, 0x9A, 0x9C, 0x9D, 0x9E, 0x9D, 0x9F, 0x9F, 0x9C,
-  0x99, 0x98, 0x93, 0x93, 0x8E, 0x88, 0x86, 0x7D, 0x7C, 0x73, 0x6A, 0x6A,
-  0x62, 0x62, 0x60, 0x5E, 0x60, 0x65, 0x66, 0x6B, 0x72, 0x74, 0x82, 0x83,
-  0x8E, 0x94, 0x95, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x97, 0xA8, 0xB3, 0xC3,
-  0xE5, 0xF4, 0xDF, 0xB5, 0x8D, 0x7A, 0x67, 0x7F, 0x9C, 0xAD, 0xB9, 0x97,
-  0x79, 0x89, 0xBB, 0xDF, 0xF4, 0xD5, 0x9F, 0x78, 0x66, 0x6A, 0x8D, 0xAF,
-  0xAD, 0x8B, 0x5C, 0x44, 0x44, 0x65, 0x8D, 0x9F, 0x8D, 0x5E, 0x32, 0x2A,
-  0x4C, 0x81, 0x9F, 0xA2, 0x87, 0x59, 0x41, 0x54, 0x85, 0xAB, 0xBA, 0xB4,
-  0x91, 0x6C, 0x6E, 0x93, 0xBE, 0xD3, 0xD4, 0xBA, 0x90, 0x7E, 0x8E, 0xB5,
-  0xD5, 0xDE, 0xCD, 0xA2, 0x83, 0x7F, 0x96, 0xBE, 0xD1, 0xC5, 0x9D, 0x76,
-  0x65, 0x6D, 0x90, 0xB0, 0xAF, 0x8A, 0x5D, 0x45, 0x3C, 0x50, 0x7A, 0x89,
-  0x74, 0x46, 0x23, 0x18, 0x2C, 0x58, 0x78, 0x7C, 0x64, 0x3B, 0x26, 0x37,
-  0x64, 0x8A, 0x99, 0x9B, 0x7B, 0x56, 0x59, 0x85, 0xB4, 0xCD, 0xCE, 0xB1,
-  0x84, 0x70, 0x80, 0xAC, 0xD0, 0xD6, 0xBA, 0x8C, 0x6B, 0x65, 0x7C, 0xA5,
-  0xBA, 0xA1, 0x71, 0x47, 0x37, 0x25, 0x47, 0x66, 0x7E, 0x86, 0x5D, 0x42,
-  0x5B, 0x96, 0xBC, 0xCD, 0xA3, 0x6F, 0x4C, 0x3E, 0x49, 0x6D, 0x8C, 0x86,
-  0x63, 0x3A, 0x26, 0x2B, 0x4E, 0x75, 0x82, 0x6D, 0x45, 0x23, 0x20, 0x40,
-  0x6F, 0x89, 0x89, 0x6D, 0x44, 0x32, 0x47, 0x76, 0x9A, 0xA8, 0xA0, 0x79,
-  0x57, 0x5C, 0x87, 0xB5, 0xCA, 0xCA, 0xA9, 0x7C, 0x6C, 0x83, 0xB3, 0xD4,
-  0xDA, 0xC3, 0x91, 0x72, 0x72, 0x91, 0xBC, 0xCE, 0xBD, 0x8F, 0x68, 0x5B,
-  0x67, 0x8F, 0xAE, 0xA8, 0x81, 0x54, 0x3E, 0x38, 0x53, 0x7C, 0x88, 0x70,
-  0x41, 0x20, 0x18, 0x31, 0x5F, 0x7A, 0x7B, 0x61, 0x37, 0x27, 0x3D, 0x6C,
-  0x8E, 0x9E, 0x9A, 0x77, 0x56, 0x5E, 0x8B, 0xB8, 0xD0, 0xCE, 0xAC, 0x7E,
-  0x70, 0x83, 0xB0, 0xD3, 0xD7, 0xB6, 0x87, 0x66, 0x67, 0x88, 0xB1, 0xB9,
-  0x98, 0x63, 0x43, 0x2F, 0x2C, 0x5A, 0x71, 0x88, 0x80, 0x53, 0x46, 0x71,
-  0xA7, 0xCB, 0xCB, 0x95, 0x64, 0x47, 0x40, 0x52, 0x7D, 0x93, 0x84, 0x5A,
-  0x34, 0x27, 0x35, 0x60, 0x83, 0x86, 0x69, 0x3C, 0x20, 0x2A, 0x52, 0x7F,
-  0x92, 0x8A, 0x65, 0x3E, 0x37, 0x57, 0x89, 0xA6, 0xAE, 0x9B, 0x6F, 0x59,
-  0x69, 0x9A, 0xC2, 0xD0, 0xC6, 0x9D, 0x77, 0x72, 0x92, 0xC1, 0xDA, 0xD8,
-  0xB5, 0x86, 0x71, 0x7A, 0xA2, 0xC7, 0xCF, 0xB5, 0x85, 0x64, 0x5E, 0x75,
-  0x9F, 0xB4, 0xA3, 0x76, 0x4E, 0x3C, 0x3F, 0x65, 0x89, 0x89, 0x67, 0x38,
-  0x1C, 0x1E, 0x42, 0x70, 0x83, 0x7D, 0x59, 0x32, 0x2C, 0x4D, 0x7D, 0x99,
-  0xA6, 0x96, 0x6D, 0x55, 0x6B, 0x9D, 0xC5, 0xD4, 0xC9, 0xA0, 0x79, 0x74,
-  0x93, 0xC1, 0xDA, 0xD3, 0xAB, 0x7E, 0x66, 0x6E, 0x91, 0xB8, 0xBB, 0x97,
-  0x63, 0x46, 0x32, 0x36, 0x64, 0x79, 0x8E, 0x7E, 0x50, 0x49, 0x79, 0xAE,
-  0xCF, 0xCA, 0x92, 0x61, 0x46, 0x42, 0x59, 0x85, 0x96, 0x83, 0x55, 0x32,
-  0x27, 0x3B, 0x67, 0x87, 0x86, 0x64, 0x38, 0x20, 0x2D, 0x5B, 0x87, 0x98,
-  0x8C, 0x64, 0x3E, 0x3C, 0x60, 0x91, 0xAC, 0xB1, 0x99, 0x6C, 0x59, 0x6F,
-  0xA0, 0xC6, 0xD1, 0xC3, 0x96, 0x73, 0x73, 0x96, 0xC4, 0xDA, 0xD5, 0xAF,
-  0x82, 0x70, 0x7D, 0xA7, 0xCB, 0xCF, 0xB1, 0x80, 0x62, 0x5E, 0x7A, 0xA6,
-  0xB8, 0xA3, 0x73, 0x4C, 0x3B, 0x43, 0x6E, 0x90, 0x8D, 0x67, 0x36, 0x1D,
-  0x24, 0x4C, 0x79, 0x8A, 0x7E, 0x56, 0x31, 0x2F, 0x53, 0x85, 0x9F, 0xA8,
-  0x93, 0x68, 0x54, 0x6E, 0xA2, 0xC8, 0xD5, 0xC6, 0x98, 0x74, 0x74, 0x96,
-  0xC5, 0xDB, 0xD0, 0xA4, 0x79, 0x65, 0x70, 0x98, 0xBD, 0xBA, 0x95, 0x60,
-  0x45, 0x33, 0x41, 0x6F, 0x84, 0x97, 0x7C, 0x50, 0x4C, 0x7F, 0xB3, 0xD4,
-  0xC7, 0x8E, 0x5F, 0x44, 0x43, 0x60, 0x8D, 0x99, 0x83, 0x53, 0x31, 0x29,
-  0x41, 0x6F, 0x8D, 0x88, 0x63, 0x35, 0x21, 0x33, 0x62, 0x8C, 0x99, 0x88,
-  0x5E, 0x3D, 0x3F, 0x67, 0x96, 0xB0, 0xB3, 0x94, 0x68, 0x5A, 0x6E, 0x92,
-  0xB4, 0xCF, 0xDA, 0xCC, 0xAB, 0x88, 0x72, 0x6E, 0x7D, 0xA1, 0xC6, 0xD9,
-  0xD7, 0xC3, 0xA1, 0x7E, 0x66, 0x5F, 0x70, 0x93, 0xB0, 0xBA, 0xBA, 0xA7,
-  0x7E, 0x56, 0x45, 0x3D, 0x40, 0x62, 0x88, 0x94, 0x8C, 0x7A, 0x56, 0x32,
-  0x21, 0x24, 0x3B, 0x63, 0x87, 0x95, 0x9A, 0x8D, 0x69, 0x49, 0x46, 0x56,
-  0x6B, 0x91, 0xBC, 0xCF, 0xCC, 0xB9, 0x9B, 0x7A, 0x69, 0x71, 0x8D, 0xB1,
-  0xCD, 0xD4, 0xCB, 0xB4, 0x8C, 0x67, 0x58, 0x61, 0x71, 0x8A, 0xA3, 0xAE,
-  0x8F, 0x66, 0x43, 0x2A, 0x3B, 0x4F, 0x68, 0x9A, 0xCD, 0xD4, 0xCC, 0xA0,
-  0x67, 0x4E, 0x44, 0x45, 0x5A, 0x81, 0x96, 0x97, 0x8B, 0x70, 0x49, 0x2F,
-  0x28, 0x34, 0x50, 0x73, 0x8C, 0x94, 0x8C, 0x6E, 0x47, 0x31, 0x33, 0x44,
-  0x65, 0x8E, 0xAC, 0xB0, 0xA5, 0x8E, 0x6F, 0x56, 0x56, 0x71, 0x95, 0xB6,
-  0xCF, 0xD7, 0xC9, 0xA7, 0x83, 0x6F, 0x6E, 0x80, 0xA6, 0xC9, 0xD7, 0xD3,
-  0xBE, 0x9A, 0x77, 0x61, 0x5D, 0x72, 0x96, 0xB2, 0xBB, 0xBA, 0xA2, 0x77,
-  0x53, 0x42, 0x3B, 0x44, 0x69, 0x8D, 0x96, 0x8F, 0x7A, 0x54, 0x31, 0x21,
-  0x27, 0x41, 0x6C, 0x8C, 0x9B, 0x9C, 0x8C, 0x66, 0x47, 0x48, 0x57, 0x6E,
-  0x95, 0xC0, 0xCF, 0xCA, 0xB5, 0x94, 0x73, 0x65, 0x70, 0x8E, 0xB3, 0xCD,
-  0xD2, 0xC8, 0xAE, 0x84, 0x61, 0x55, 0x5F, 0x72, 0x8D, 0xA6, 0xAE, 0x8D,
-  0x65, 0x41, 0x2B, 0x3C, 0x4F, 0x6C, 0xA0, 0xCE, 0xD3, 0xC9, 0x9A, 0x64,
-  0x4C, 0x41, 0x46, 0x61, 0x87, 0x9A, 0x9A, 0x8B, 0x6D, 0x46, 0x2F, 0x29,
-  0x38, 0x56, 0x7B, 0x93, 0x99, 0x8E, 0x6C, 0x46, 0x32, 0x35, 0x49, 0x6C,
-  0x97, 0xB1, 0xB2, 0xA5, 0x8B, 0x6A, 0x52, 0x57, 0x73, 0x97, 0xB9, 0xCF,
-  0xD6, 0xC4, 0xA0, 0x7D, 0x6B, 0x6A, 0x80, 0xA8, 0xC9, 0xD7, 0xD1, 0xBA,
-  0x95, 0x73, 0x5F, 0x5D, 0x74, 0x99, 0xB3, 0xBB, 0xB8, 0x9D, 0x71, 0x4E,
-  0x3F, 0x3A, 0x47, 0x6F, 0x92, 0x9A, 0x90, 0x79, 0x52, 0x2F, 0x23, 0x2A,
-  0x47, 0x72, 0x92, 0x9E, 0x9E, 0x8A, 0x62, 0x46, 0x47, 0x57, 0x72, 0x9B,
-  0xC2, 0xCF, 0xC8, 0xB1, 0x8E, 0x6E, 0x63, 0x6F, 0x90, 0xB5, 0xCE, 0xD1,
-  0xC6, 0xA9, 0x7E, 0x5D, 0x54, 0x60, 0x73, 0x91, 0xAA, 0xAE, 0x8B, 0x65,
-  0x3E, 0x2E, 0x3E, 0x51, 0x71, 0xA5, 0xCF, 0xD0, 0xC3, 0x8F, 0x5E, 0x47,
-  0x3F, 0x47, 0x65, 0x8B, 0x9C, 0x9B, 0x8B, 0x6B, 0x43, 0x2C, 0x2A, 0x3C,
-  0x5B, 0x82, 0x98, 0x9B, 0x8E, 0x69, 0x44, 0x32, 0x37, 0x4D, 0x71, 0x9B,
-  0xB3, 0xB3, 0xA3, 0x87, 0x66, 0x51, 0x58, 0x76, 0x9C, 0xBD, 0xD1, 0xD5,
-  0xC1, 0x9A, 0x78, 0x68, 0x6A, 0x82, 0xAB, 0xCB, 0xD6, 0xD0, 0xB4, 0x8E,
-  0x6C, 0x5A, 0x5C, 0x76, 0x9C, 0xB4, 0xBC, 0xB6, 0x99, 0x6D, 0x4B, 0x3F,
-  0x3A, 0x4C, 0x75, 0x93, 0x99, 0x8E, 0x74, 0x4C, 0x2C, 0x22, 0x2E, 0x4E,
-  0x79, 0x99, 0xA3, 0xA1, 0x88, 0x5E, 0x44, 0x45, 0x55, 0x73, 0x9E, 0xC3,
-  0xCC, 0xC3, 0xA8, 0x82, 0x62, 0x5A, 0x69, 0x8C, 0xB4, 0xCC, 0xCE, 0xC2,
-  0xA0, 0x74, 0x56, 0x4F, 0x5D, 0x77, 0x98, 0xB0, 0xB1, 0x90, 0x68, 0x41,
-  0x32, 0x3E, 0x52, 0x76, 0xAA, 0xCC, 0xCD, 0xBD, 0x89, 0x5A, 0x43, 0x3E,
-  0x49, 0x6C, 0x93, 0xA3, 0xA1, 0x8F, 0x6B, 0x44, 0x2E, 0x2E, 0x42, 0x65,
-  0x8D, 0xA0, 0xA2, 0x90, 0x69, 0x43, 0x33, 0x39, 0x51, 0x79, 0xA2, 0xB7,
-  0xB5, 0xA3, 0x81, 0x5F, 0x4D, 0x55, 0x74, 0x9C, 0xBD, 0xD0, 0xD0, 0xB8,
-  0x8F, 0x6D, 0x5E, 0x63, 0x7F, 0xAA, 0xC9, 0xD4, 0xCC, 0xB0, 0x88, 0x65,
-  0x54, 0x59, 0x78, 0x9F, 0xB8, 0xBF, 0xB7, 0x96, 0x69, 0x4A, 0x3D, 0x3D,
-  0x54, 0x7F, 0x9C, 0xA1, 0x95, 0x78, 0x4D, 0x2E, 0x25, 0x33, 0x56, 0x80,
-  0x9C, 0xA3, 0x9E, 0x84, 0x5E, 0x47, 0x4A, 0x5B, 0x78, 0xA2, 0xBD, 0xBF,
-  0xC0, 0xC3, 0xC5, 0xC2, 0xC1, 0xC1, 0xC1, 0xBF, 0xBD, 0xB9, 0xB9, 0xB7,
-  0xB2, 0xAD, 0xAC, 0xAB, 0xA1, 0x9B, 0x9D, 0x96, 0x82, 0x7F, 0x7C, 0x87,
-  0x98, 0x98, 0x98, 0xA6, 0xAF, 0xAD, 0xAB, 0x98, 0x90, 0x90, 0x8B, 0x83,
-  0x81, 0x81, 0x7C, 0x78, 0x77, 0x76, 0x75, 0x73, 0x72, 0x72, 0x6F, 0x6E,
-  0x6F, 0x71, 0x73, 0x74, 0x74, 0x76, 0x78, 0x77, 0x79, 0x7E, 0x80, 0x7F,
-  0x83, 0x8A, 0x8B, 0x8A, 0x8F, 0x93, 0x92, 0x93, 0x97, 0x99, 0x98, 0x98,
-  0x99, 0x99, 0x98, 0x99, 0x9A, 0x98, 0x98, 0x95, 0x92, 0x91, 0x90, 0x8C,
-  0x8A, 0x8B, 0x87, 0x82, 0x80, 0x80, 0x7A, 0x75, 0x75, 0x74, 0x6A, 0x65,
-  0x66, 0x63, 0x5F, 0x5D, 0x5F, 0x5E, 0x5C, 0x5B, 0x5C, 0x5F, 0x61, 0x61,
-  0x63, 0x69, 0x6C, 0x6B, 0x71, 0x7A, 0x7C, 0x7B, 0x82, 0x8B, 0x8A, 0x8A,
-  0x8E, 0x90, 0x8F, 0x8F, 0x90, 0x91, 0x90, 0x8E, 0x8A, 0x8B, 0x89, 0x83,
-  0x7F, 0x7F, 0x7C, 0x74, 0x71, 0x73, 0x6C, 0x5D, 0x5C, 0x5B, 0x68, 0x74,
-  0x75, 0x77, 0x84, 0x8C, 0x8C, 0x88, 0x78, 0x75, 0x74, 0x71, 0x6B, 0x6A,
-  0x6B, 0x67, 0x64, 0x65, 0x64, 0x63, 0x63, 0x64, 0x63, 0x61, 0x62, 0x62,
-  0x64, 0x67, 0x67, 0x68, 0x6B, 0x6C, 0x6C, 0x6E, 0x73, 0x75, 0x75, 0x78,
-  0x7F, 0x7F, 0x7F, 0x84, 0x88, 0x87, 0x87, 0x8C, 0x8D, 0x8C, 0x8D, 0x8E,
-  0x8F, 0x8D, 0x8E, 0x8F, 0x8F, 0x8E, 0x8C, 0x8A, 0x8A, 0x89, 0x86, 0x85,
-  0x85, 0x82, 0x7E, 0x7E, 0x7D, 0x79, 0x74, 0x75, 0x73, 0x6B, 0x68, 0x68,
-  0x67, 0x63, 0x62, 0x64, 0x62, 0x60, 0x61, 0x62, 0x65, 0x67, 0x67, 0x6A,
-  0x6F, 0x71, 0x71, 0x77, 0x7E, 0x7F, 0x7F, 0x86, 0x8C, 0x8B, 0x8B, 0x8D,
-  0x8F, 0x8E, 0x8E, 0x8F, 0x8F, 0x8E, 0x8D, 0x8A, 0x8A, 0x89, 0x86, 0x82,
-  0x83, 0x80, 0x78, 0x74, 0x76, 0x6E, 0x5F, 0x5E, 0x5E, 0x6C, 0x77, 0x78,
-  0x79, 0x85, 0x8B, 0x8B, 0x87, 0x7A, 0x78, 0x78, 0x75, 0x71, 0x72, 0x71,
-  0x6E, 0x6C, 0x6D, 0x6C, 0x6B, 0x6B, 0x6C, 0x6B, 0x69, 0x6A, 0x6B, 0x6D,
-  0x6E, 0x6F, 0x70, 0x71, 0x73, 0x73, 0x75, 0x79, 0x7B, 0x7A, 0x7E, 0x83,
-  0x83, 0x84, 0x88, 0x8A, 0x8A, 0x8A, 0x8E, 0x8F, 0x8E, 0x8E, 0x90, 0x8F,
-  0x8E, 0x8F, 0x90, 0x8F, 0x8E, 0x8D, 0x8B, 0x8B, 0x89, 0x88, 0x86, 0x87,
-  0x84, 0x80, 0x80, 0x7F, 0x7B, 0x78, 0x79, 0x77, 0x70, 0x6E, 0x6E, 0x6D,
-  0x6A, 0x69, 0x6A, 0x69, 0x69, 0x69, 0x6A, 0x6D, 0x6E, 0x6E, 0x71, 0x75,
-  0x77, 0x76, 0x7B, 0x82, 0x82, 0x82, 0x89, 0x8D, 0x8C, 0x8D, 0x8F, 0x91,
-  0x8F, 0x90, 0x91, 0x91, 0x90, 0x8E, 0x8C, 0x8C, 0x8B, 0x88, 0x85, 0x85,
-  0x82, 0x7B, 0x78, 0x7A, 0x6F, 0x65, 0x65, 0x65, 0x72, 0x7B, 0x7A, 0x7E,
-  0x8B, 0x8D, 0x8E, 0x88, 0x7C, 0x7A, 0x79, 0x76, 0x71, 0x72, 0x72, 0x71,
-  0x70, 0x71, 0x71, 0x70, 0x70, 0x71, 0x70, 0x6F, 0x70, 0x71, 0x73, 0x76,
-  0x75, 0x76, 0x77, 0x78, 0x78, 0x79, 0x7C, 0x7D, 0x7D, 0x80, 0x83, 0x83,
-  0x84, 0x86, 0x88, 0x88, 0x89, 0x8B, 0x8C, 0x8B, 0x8C, 0x8C, 0x8B, 0x8B,
-  0x8C, 0x8D, 0x8C, 0x8B, 0x8A, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x83,
-  0x81, 0x81, 0x80, 0x7C, 0x7B, 0x7B, 0x79, 0x75, 0x73, 0x74, 0x72, 0x70,
-  0x70, 0x71, 0x70, 0x70, 0x6F, 0x70, 0x72, 0x73, 0x73, 0x75, 0x78, 0x79,
-  0x7A, 0x7E, 0x81, 0x81, 0x82, 0x87, 0x8A, 0x89, 0x8A, 0x8C, 0x8D, 0x8B,
-  0x8C, 0x8D, 0x8D, 0x8C, 0x8A, 0x89, 0x8A, 0x89, 0x86, 0x84, 0x85, 0x82,
-  0x7E, 0x7D, 0x7D, 0x76, 0x6E, 0x6F, 0x6F, 0x79, 0x7E, 0x7E, 0x81, 0x89,
-  0x8B, 0x8B, 0x85, 0x7C, 0x7C, 0x7B, 0x78, 0x75, 0x76, 0x75, 0x73, 0x72,
-  0x73, 0x72, 0x72, 0x71, 0x72, 0x71, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-  0x78, 0x7A, 0x7B, 0x7A, 0x7C, 0x7E, 0x7E, 0x7E, 0x81, 0x83, 0x83, 0x84,
-  0x87, 0x88, 0x87, 0x88, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A,
-  0x8A, 0x89, 0x89, 0x88, 0x88, 0x87, 0x86, 0x85, 0x86, 0x85, 0x83, 0x82,
-  0x82, 0x81, 0x7F, 0x7E, 0x7E, 0x7D, 0x79, 0x78, 0x79, 0x77, 0x75, 0x76,
-  0x76, 0x75, 0x74, 0x75, 0x75, 0x76, 0x78, 0x77, 0x79, 0x7B, 0x7B, 0x7C,
-  0x7F, 0x81, 0x81, 0x82, 0x85, 0x86, 0x86, 0x87, 0x88, 0x88, 0x87, 0x88,
-  0x89, 0x88, 0x88, 0x87, 0x86, 0x87, 0x86, 0x85, 0x83, 0x84, 0x81, 0x7F,
-  0x7E, 0x7E, 0x79, 0x74, 0x75, 0x75, 0x7C, 0x7F, 0x7F, 0x81, 0x87, 0x87,
-  0x89, 0x84, 0x7E, 0x7F, 0x7E, 0x7C, 0x7A, 0x7B, 0x79, 0x78, 0x77, 0x78,
-  0x77, 0x76, 0x77, 0x76, 0x75, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x78,
-  0x79, 0x7A, 0x79, 0x7B, 0x7D, 0x7D, 0x7E, 0x80, 0x82, 0x81, 0x83, 0x83,
-  0x82, 0x82, 0x83, 0x84, 0x83, 0x83, 0x84, 0x85, 0x84, 0x85, 0x85, 0x84,
-  0x85, 0x86, 0x85, 0x85, 0x85, 0x84, 0x83, 0x84, 0x83, 0x82, 0x82, 0x81,
-  0x82, 0x80, 0x7F, 0x80, 0x7F, 0x7D, 0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7C,
-  0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F,
-  0x81, 0x80, 0x81, 0x82, 0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83,
-  0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7E, 0x7F,
-  0x7E, 0x7B, 0x79, 0x79, 0x7A, 0x7E, 0x7F, 0x7F, 0x81, 0x84, 0x85, 0x84,
-  0x82, 0x7F, 0x80, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C,
-  0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C, 0x7D, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x82,
-  0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x81,
-  0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x80, 0x78,
-  0x60, 0x57, 0x4D, 0x39, 0x24, 0x17, 0x12, 0x1B, 0x2C, 0x46, 0x60, 0x6F,
-  0x76, 0x71, 0x64, 0x4F, 0x3C, 0x30, 0x2D, 0x37, 0x47, 0x60, 0x77, 0x85,
-  0x89, 0x80, 0x6F, 0x53, 0x3D, 0x31, 0x30, 0x3E, 0x54, 0x73, 0x8A, 0x9A,
-  0x9B, 0x8E, 0x76, 0x56, 0x3F, 0x33, 0x36, 0x48, 0x64, 0x85, 0x9E, 0xAC,
-  0xA8, 0x98, 0x7A, 0x57, 0x42, 0x36, 0x3F, 0x54, 0x73, 0x96, 0xAC, 0xB6,
-  0xAF, 0x9C, 0x7B, 0x5A, 0x45, 0x3E, 0x49, 0x60, 0x83, 0xA4, 0xB7, 0xBC,
-  0xB3, 0x9D, 0x79, 0x5B, 0x48, 0x44, 0x54, 0x6D, 0x92, 0xAF, 0xC0, 0xC2,
-  0xB5, 0x9D, 0x78, 0x5C, 0x4C, 0x4C, 0x5D, 0x79, 0x9D, 0xB7, 0xC6, 0xC3,
-  0xB4, 0x98, 0x74, 0x5B, 0x4D, 0x52, 0x65, 0x82, 0xA6, 0xBD, 0xC8, 0xC3,
-  0xB1, 0x92, 0x6F, 0x59, 0x4E, 0x56, 0x6A, 0x8C, 0xAD, 0xC0, 0xC8, 0xBF,
-  0xAB, 0x89, 0x69, 0x54, 0x4D, 0x59, 0x70, 0x94, 0xB2, 0xC3, 0xC8, 0xBB,
-  0xA7, 0x84, 0x65, 0x53, 0x50, 0x5F, 0x79, 0x9D, 0xB8, 0xC8, 0xC8, 0xBA,
-  0xA0, 0x7D, 0x62, 0x51, 0x52, 0x64, 0x82, 0xA6, 0xBD, 0xCA, 0xC6, 0xB7,
-  0x9A, 0x76, 0x5D, 0x50, 0x56, 0x6A, 0x88, 0xAA, 0xC0, 0xCA, 0xC3, 0xB1,
-  0x91, 0x6F, 0x58, 0x4E, 0x58, 0x6D, 0x8F, 0xB0, 0xC2, 0xC9, 0xBF, 0xAA,
-  0x88, 0x68, 0x53, 0x4D, 0x5A, 0x72, 0x96, 0xB3, 0xC4, 0xC7, 0xBA, 0xA2,
-  0x7E, 0x61, 0x4F, 0x4D, 0x5C, 0x78, 0x9D, 0xB6, 0xC6, 0xC5, 0xB5, 0x9A,
-  0x75, 0x5B, 0x4C, 0x4F, 0x61, 0x7F, 0xA3, 0xBB, 0xC7, 0xC2, 0xB1, 0x92,
-  0x6F, 0x57, 0x4B, 0x52, 0x66, 0x87, 0xA9, 0xBE, 0xC7, 0xBF, 0xAB, 0x8A,
-  0x67, 0x52, 0x49, 0x54, 0x6B, 0x8E, 0xAE, 0xC1, 0xC6, 0xBB, 0xA5, 0x81,
-  0x61, 0x4E, 0x4A, 0x57, 0x71, 0x95, 0xB2, 0xC2, 0xC4, 0xB6, 0x9B, 0x76,
-  0x59, 0x49, 0x48, 0x59, 0x75, 0x9A, 0xB4, 0xC1, 0xC0, 0xAF, 0x93, 0x6F,
-  0x55, 0x46, 0x4B, 0x5E, 0x7E, 0xA2, 0xB9, 0xC5, 0xBF, 0xAC, 0x8D, 0x68,
-  0x51, 0x45, 0x4E, 0x64, 0x85, 0xA8, 0xBC, 0xC5, 0xBD, 0xA8, 0x84, 0x63,
-  0x4E, 0x47, 0x52, 0x6A, 0x8E, 0xAE, 0xC0, 0xC4, 0xB8, 0xA0, 0x7B, 0x5C,
-  0x4A, 0x46, 0x56, 0x70, 0x95, 0xB2, 0xC1, 0xC2, 0xB3, 0x98, 0x73, 0x56,
-  0x46, 0x48, 0x59, 0x77, 0x9B, 0xB4, 0xC2, 0xBE, 0xAD, 0x8E, 0x6A, 0x51,
-  0x42, 0x48, 0x5C, 0x7D, 0xA1, 0xB8, 0xC1, 0xBB, 0xA7, 0x86, 0x62, 0x4C,
-  0x42, 0x4B, 0x62, 0x84, 0xA6, 0xBB, 0xC1, 0xB6, 0xA1, 0x7D, 0x5D, 0x48,
-  0x42, 0x4F, 0x68, 0x8D, 0xAC, 0xBE, 0xC1, 0xB4, 0x9B, 0x76, 0x57, 0x46,
-  0x44, 0x54, 0x6F, 0x95, 0xB1, 0xBF, 0xBE, 0xAF, 0x92, 0x6D, 0x52, 0x43,
-  0x46, 0x58, 0x77, 0x9C, 0xB4, 0xC0, 0xBB, 0xAA, 0x8A, 0x65, 0x4D, 0x40,
-  0x46, 0x5B, 0x7D, 0xA0, 0xB5, 0xBE, 0xB6, 0xA2, 0x80, 0x5E, 0x48, 0x3F,
-  0x4B, 0x62, 0x86, 0xA8, 0xBB, 0xC2, 0xB7, 0x9F, 0x7A, 0x5A, 0x45, 0x40,
-  0x4F, 0x69, 0x8E, 0xAD, 0xBE, 0xC0, 0xB2, 0x98, 0x73, 0x56, 0x44, 0x43,
-  0x54, 0x72, 0x98, 0xB2, 0xC1, 0xBF, 0xAE, 0x90, 0x6B, 0x50, 0x41, 0x45,
-  0x59, 0x79, 0x9D, 0xB6, 0xC2, 0xBB, 0xA8, 0x87, 0x63, 0x4C, 0x3F, 0x48,
-  0x5E, 0x7F, 0xA3, 0xB8, 0xC1, 0xB7, 0xA2, 0x7F, 0x5D, 0x46, 0x3E, 0x4B,
-  0x63, 0x87, 0xA8, 0xBB, 0xBF, 0xB3, 0x9B, 0x76, 0x56, 0x42, 0x3E, 0x4F,
-  0x6A, 0x8F, 0xAC, 0xBC, 0xBE, 0xAE, 0x93, 0x6D, 0x50, 0x40, 0x41, 0x53,
-  0x72, 0x97, 0xB2, 0xBF, 0xBC, 0xAA, 0x8B, 0x67, 0x4D, 0x3F, 0x44, 0x59,
-  0x7A, 0x9E, 0xB5, 0xC0, 0xB9, 0xA5, 0x84, 0x60, 0x48, 0x3E, 0x48, 0x5F,
-  0x82, 0xA4, 0xB8, 0xC0, 0xB6, 0x9F, 0x7B, 0x59, 0x44, 0x3E, 0x4C, 0x64,
-  0x89, 0xA8, 0xBA, 0xBD, 0xAF, 0x96, 0x71, 0x52, 0x40, 0x3D, 0x4E, 0x6B,
-  0x90, 0xAE, 0xBE, 0xBD, 0xAD, 0x90, 0x6B, 0x4E, 0x3E, 0x41, 0x54, 0x74,
-  0x99, 0xB2, 0xC0, 0xBB, 0xA8, 0x88, 0x63, 0x4B, 0x3D, 0x46, 0x5C, 0x7D,
-  0xA1, 0xB8, 0xC1, 0xB9, 0xA4, 0x81, 0x5F, 0x47, 0x3E, 0x4A, 0x61, 0x85,
-  0xA6, 0xBA, 0xC0, 0xB4, 0x9E, 0x78, 0x58, 0x43, 0x3E, 0x4D, 0x67, 0x8D,
-  0xAB, 0xBD, 0xBF, 0xB0, 0x96, 0x6F, 0x52, 0x40, 0x3F, 0x50, 0x6F, 0x93,
-  0xAF, 0xBF, 0xBC, 0xAB, 0x8D, 0x67, 0x4D, 0x3D, 0x42, 0x56, 0x76, 0x9A,
-  0xB3, 0xBF, 0xB9, 0xA5, 0x85, 0x61, 0x48, 0x3B, 0x45, 0x5B, 0x7E, 0xA0,
-  0xB7, 0xC0, 0xB6, 0xA1, 0x7D, 0x5C, 0x45, 0x3D, 0x4A, 0x62, 0x87, 0xA7,
-  0xBB, 0xC0, 0xB3, 0x9A, 0x75, 0x55, 0x41, 0x3E, 0x4E, 0x6A, 0x8F, 0xAC,
-  0xBE, 0xBE, 0xAE, 0x92, 0x6D, 0x50, 0x3F, 0x40, 0x53, 0x70, 0x96, 0xB0,
-  0xBE, 0xBA, 0xA8, 0x89, 0x64, 0x49, 0x3B, 0x42, 0x56, 0x78, 0x9B, 0xB2,
-  0xBF, 0xB9, 0xA5, 0x83, 0x5F, 0x47, 0x3C, 0x47, 0x5E, 0x80, 0xA4, 0xB9,
-  0xC0, 0xB5, 0x9E, 0x7B, 0x59, 0x44, 0x3D, 0x4B, 0x65, 0x89, 0xAA, 0xBD,
-  0xC1, 0xB3, 0x99, 0x74, 0x55, 0x42, 0x3F, 0x51, 0x6D, 0x92, 0xAF, 0xBF,
-  0xBF, 0xAE, 0x91, 0x6B, 0x4F, 0x3E, 0x42, 0x54, 0x74, 0x9A, 0xB3, 0xC0,
-  0xBC, 0xA9, 0x89, 0x64, 0x4A, 0x3C, 0x44, 0x5A, 0x7C, 0xA0, 0xB6, 0xC1,
-  0xB7, 0xA2, 0x7F, 0x5C, 0x46, 0x3B, 0x47, 0x5F, 0x83, 0xA5, 0xB9, 0xBF,
-  0xB4, 0x9C, 0x76, 0x57, 0x41, 0x3C, 0x4B, 0x65, 0x8B, 0xAA, 0xBC, 0xBE,
-  0xB0, 0x95, 0x6F, 0x51, 0x3F, 0x3E, 0x51, 0x6E, 0x94, 0xAF, 0xBF, 0xBD,
-  0xAC, 0x8E, 0x68, 0x4D, 0x3D, 0x42, 0x56, 0x77, 0x9C, 0xB4, 0xC0, 0xB9,
-  0xA6, 0x85, 0x61, 0x49, 0x3D, 0x45, 0x5C, 0x7E, 0xA1, 0xB8, 0xC0, 0xB6,
-  0xA0, 0x7C, 0x5A, 0x43, 0x3A, 0x48, 0x60, 0x85, 0xA5, 0xB9, 0xBE, 0xB0,
-  0x98, 0x75, 0x55, 0x40, 0x3D, 0x4D, 0x69, 0x8F, 0xAD, 0xBE, 0xBF, 0xAF,
-  0x93, 0x6D, 0x4F, 0x3D, 0x3F, 0x52, 0x70, 0x96, 0xB1, 0xC0, 0xBD, 0xAB,
-  0x8C, 0x67, 0x4D, 0x3E, 0x43, 0x59, 0x7A, 0x9F, 0xB7, 0xC2, 0xBA, 0xA5,
-  0x83, 0x60, 0x48, 0x3C, 0x46, 0x5E, 0x82, 0xA4, 0xB9, 0xC2, 0xB6, 0x9F,
-  0x7B, 0x59, 0x43, 0x3D, 0x4B, 0x64, 0x8A, 0xA9, 0xBC, 0xC0, 0xB2, 0x98,
-  0x72, 0x52, 0x3F, 0x3E, 0x4E, 0x6A, 0x91, 0xAD, 0xBE, 0xBD, 0xAC, 0x90,
-  0x6A, 0x4E, 0x3C, 0x3F, 0x53, 0x72, 0x98, 0xB2, 0xBF, 0xBA, 0xA7, 0x88,
-  0x62, 0x49, 0x3C, 0x42, 0x59, 0x7C, 0x9F, 0xB6, 0xC1, 0xB8, 0xA3, 0x80,
-  0x5C, 0x45, 0x3C, 0x47, 0x60, 0x84, 0xA6, 0xBA, 0xC0, 0xB5, 0x9C, 0x77,
-  0x57, 0x42, 0x3D, 0x4C, 0x66, 0x8D, 0xAA, 0xBD, 0xBF, 0xB0, 0x96, 0x6F,
-  0x52, 0x3E, 0x3D, 0x4F, 0x6D, 0x92, 0xAD, 0xBC, 0xBA, 0xA9, 0x8C, 0x66,
-  0x4B, 0x3D, 0x42, 0x56, 0x78, 0x9D, 0xB7, 0xC5, 0xBE, 0xAA, 0x88, 0x63,
-  0x49, 0x3C, 0x45, 0x5C, 0x7F, 0xA3, 0xBA, 0xC3, 0xBA, 0xA3, 0x7F, 0x5C,
-  0x45, 0x3D, 0x4A, 0x64, 0x89, 0xA9, 0xBD, 0xC3, 0xB6, 0x9E, 0x78, 0x57,
-  0x42, 0x3D, 0x4E, 0x69, 0x8F, 0xAE, 0xBF, 0xC0, 0xB1, 0x95, 0x6E, 0x51,
-  0x3E, 0x3F, 0x52, 0x70, 0x97, 0xB2, 0xC1, 0xBE, 0xAB, 0x8C, 0x66, 0x4B,
-  0x3B, 0x41, 0x57, 0x77, 0x9D, 0xB5, 0xC0, 0xB9, 0xA5, 0x83, 0x5E, 0x45,
-  0x3A, 0x45, 0x5C, 0x80, 0xA2, 0xB8, 0xC1, 0xB6, 0x9E, 0x7A, 0x58, 0x41,
-  0x3A, 0x48, 0x63, 0x88, 0xA9, 0xBC, 0xC0, 0xB2, 0x98, 0x72, 0x53, 0x40,
-  0x3C, 0x4D, 0x6A, 0x91, 0xAE, 0xBF, 0xBE, 0xAE, 0x91, 0x6A, 0x4E, 0x3D,
-  0x3F, 0x52, 0x71, 0x98, 0xB3, 0xC1, 0xBC, 0xA9, 0x88, 0x63, 0x49, 0x3C,
-  0x43, 0x57, 0x7A, 0xA0, 0xB8, 0xC3, 0xBA, 0xA4, 0x7D, 0x59, 0x40, 0x36,
-  0x42, 0x53, 0x58, 0x5B, 0x6A, 0x6C, 0x7D, 0x8D, 0x92, 0xAB, 0xAA, 0xB4,
-  0xB8, 0xB8, 0xBB, 0xBB, 0xB4, 0xB0, 0xAC, 0x9E, 0x9F, 0x87, 0x7F, 0x6B,
-  0x45, 0x43, 0x6C, 0x7F, 0x8F, 0xB4, 0xB4, 0x91, 0x7D, 0x77, 0x64, 0x66,
-  0x58, 0x55, 0x53, 0x4F, 0x50, 0x4B, 0x4A, 0x4F, 0x57, 0x57, 0x5F, 0x61,
-  0x6A, 0x74, 0x77, 0x8A, 0x8D, 0x98, 0xA3, 0xA4, 0xB0, 0xB0, 0xB4, 0xB5,
-  0xB5, 0xB8, 0xB7, 0xB2, 0xAD, 0xAB, 0xA2, 0xA2, 0x96, 0x8E, 0x89, 0x78,
-  0x78, 0x62, 0x57, 0x54, 0x48, 0x48, 0x43, 0x42, 0x46, 0x4F, 0x50, 0x5F,
-  0x64, 0x6E, 0x85, 0x86, 0x9E, 0xA5, 0xA9, 0xB2, 0xB1, 0xB5, 0xB5, 0xB3,
-  0xAB, 0xAB, 0x9B, 0x9C, 0x89, 0x7B, 0x6F, 0x49, 0x39, 0x5C, 0x79, 0x81,
-  0xA6, 0xB2, 0x93, 0x7A, 0x76, 0x62, 0x61, 0x58, 0x50, 0x51, 0x4A, 0x4D,
-  0x48, 0x47, 0x49, 0x52, 0x53, 0x5A, 0x5D, 0x62, 0x6F, 0x70, 0x81, 0x89,
-  0x90, 0x9D, 0x9B, 0xA6, 0xAA, 0xAB, 0xAF, 0xAD, 0xB1, 0xB2, 0xAE, 0xA8,
-  0xA7, 0xA0, 0x9E, 0x97, 0x8C, 0x8A, 0x78, 0x77, 0x69, 0x58, 0x58, 0x4B,
-  0x4A, 0x47, 0x44, 0x46, 0x4F, 0x52, 0x5C, 0x66, 0x6B, 0x83, 0x85, 0x97,
-  0xA4, 0xA5, 0xB0, 0xAE, 0xB3, 0xB2, 0xB2, 0xA9, 0xAA, 0x9D, 0x99, 0x8E,
-  0x7B, 0x77, 0x56, 0x3D, 0x52, 0x75, 0x7E, 0x9D, 0xB2, 0x9C, 0x7D, 0x79,
-  0x69, 0x61, 0x5C, 0x51, 0x54, 0x4D, 0x4F, 0x4B, 0x49, 0x4A, 0x52, 0x55,
-  0x59, 0x5F, 0x61, 0x6F, 0x71, 0x7D, 0x8B, 0x8C, 0x9C, 0x9E, 0xA5, 0xAD,
-  0xAC, 0xB1, 0xB0, 0xB3, 0xB5, 0xB2, 0xAB, 0xA9, 0xA4, 0xA0, 0x9C, 0x8E,
-  0x8F, 0x80, 0x79, 0x72, 0x5C, 0x5B, 0x4F, 0x4C, 0x4A, 0x46, 0x47, 0x4E,
-  0x53, 0x59, 0x66, 0x68, 0x7F, 0x86, 0x90, 0xA4, 0xA4, 0xAF, 0xAF, 0xB2,
-  0xB3, 0xB3, 0xAB, 0xAA, 0xA2, 0x98, 0x94, 0x7D, 0x79, 0x5F, 0x3E, 0x46,
-  0x6D, 0x79, 0x8F, 0xAC, 0xA1, 0x81, 0x77, 0x6D, 0x60, 0x60, 0x52, 0x54,
-  0x4F, 0x50, 0x4E, 0x4B, 0x4B, 0x51, 0x56, 0x58, 0x5F, 0x5F, 0x6C, 0x71,
-  0x79, 0x88, 0x89, 0x97, 0x9D, 0xA1, 0xAC, 0xAB, 0xB0, 0xAF, 0xB1, 0xB4,
-  0xB2, 0xAD, 0xA9, 0xA5, 0x9F, 0x9E, 0x90, 0x8E, 0x85, 0x79, 0x78, 0x62,
-  0x5D, 0x56, 0x4E, 0x4F, 0x49, 0x49, 0x4E, 0x54, 0x57, 0x66, 0x67, 0x78,
-  0x87, 0x8A, 0xA0, 0xA2, 0xAA, 0xAD, 0xAD, 0xB1, 0xB0, 0xAB, 0xA7, 0xA4,
-  0x97, 0x97, 0x82, 0x7A, 0x6C, 0x48, 0x45, 0x69, 0x7A, 0x89, 0xAA, 0xAA,
-  0x8B, 0x7A, 0x73, 0x63, 0x64, 0x58, 0x56, 0x54, 0x51, 0x51, 0x4D, 0x4D,
-  0x52, 0x58, 0x59, 0x61, 0x62, 0x6B, 0x74, 0x76, 0x88, 0x8B, 0x94, 0x9E,
-  0x9F, 0xAB, 0xAB, 0xAF, 0xB1, 0xB0, 0xB3, 0xB3, 0xAE, 0xA9, 0xA7, 0xA0,
-  0x9F, 0x95, 0x8E, 0x89, 0x7B, 0x79, 0x66, 0x5C, 0x59, 0x4D, 0x4D, 0x49,
-  0x47, 0x4C, 0x53, 0x54, 0x61, 0x66, 0x6F, 0x82, 0x83, 0x97, 0x9D, 0xA1,
-  0xA8, 0xA7, 0xAB, 0xAB, 0xA9, 0xA2, 0xA2, 0x95, 0x96, 0x86, 0x7B, 0x71,
-  0x51, 0x44, 0x60, 0x79, 0x81, 0x9F, 0xAB, 0x94, 0x7D, 0x79, 0x68, 0x67,
-  0x5F, 0x58, 0x5A, 0x55, 0x56, 0x52, 0x51, 0x53, 0x5B, 0x5C, 0x62, 0x64,
-  0x69, 0x74, 0x75, 0x84, 0x8B, 0x90, 0x9C, 0x9C, 0xA6, 0xA9, 0xA9, 0xAD,
-  0xAC, 0xAF, 0xB0, 0xAC, 0xA7, 0xA6, 0x9F, 0x9D, 0x96, 0x8C, 0x8B, 0x7C,
-  0x7A, 0x6E, 0x5F, 0x5E, 0x52, 0x52, 0x4F, 0x4C, 0x4E, 0x56, 0x57, 0x60,
-  0x69, 0x6D, 0x82, 0x85, 0x94, 0xA1, 0xA1, 0xAB, 0xAA, 0xAD, 0xAD, 0xAC,
-  0xA5, 0xA6, 0x9B, 0x98, 0x90, 0x7E, 0x79, 0x5D, 0x46, 0x58, 0x78, 0x7F,
-  0x99, 0xAE, 0x9B, 0x80, 0x7B, 0x6D, 0x66, 0x64, 0x59, 0x5B, 0x55, 0x57,
-  0x53, 0x51, 0x52, 0x59, 0x5C, 0x5F, 0x64, 0x67, 0x72, 0x74, 0x7E, 0x89,
-  0x8C, 0x98, 0x98, 0x9E, 0xA4, 0xA4, 0xA8, 0xA7, 0xAA, 0xAB, 0xA9, 0xA4,
-  0xA1, 0x9D, 0x9A, 0x97, 0x8B, 0x8A, 0x7F, 0x79, 0x73, 0x61, 0x60, 0x58,
-  0x54, 0x52, 0x4F, 0x50, 0x55, 0x59, 0x5E, 0x6A, 0x6C, 0x7F, 0x86, 0x8F,
-  0xA0, 0x9F, 0xA8, 0xA8, 0xAB, 0xAC, 0xAC, 0xA5, 0xA4, 0x9E, 0x96, 0x93,
-  0x7F, 0x7C, 0x67, 0x4C, 0x52, 0x72, 0x7D, 0x91, 0xAA, 0xA1, 0x84, 0x7C,
-  0x73, 0x68, 0x67, 0x5C, 0x5C, 0x59, 0x58, 0x57, 0x54, 0x54, 0x59, 0x5D,
-  0x5F, 0x65, 0x66, 0x70, 0x75, 0x7A, 0x89, 0x89, 0x96, 0x9A, 0x9D, 0xA7,
-  0xA5, 0xA9, 0xA9, 0xAB, 0xAD, 0xAC, 0xA7, 0xA3, 0xA1, 0x9C, 0x9A, 0x8F,
-  0x8D, 0x84, 0x7A, 0x79, 0x67, 0x62, 0x5C, 0x55, 0x55, 0x51, 0x51, 0x56,
-  0x5B, 0x5D, 0x6A, 0x6B, 0x7A, 0x86, 0x89, 0x9D, 0x9F, 0xA6, 0xA9, 0xA9,
-  0xAC, 0xAB, 0xA7, 0xA3, 0xA0, 0x96, 0x95, 0x83, 0x7D, 0x6F, 0x51, 0x4B,
-  0x69, 0x7A, 0x85, 0x9F, 0xA0, 0x87, 0x78, 0x74, 0x66, 0x67, 0x5D, 0x5C,
-  0x5A, 0x58, 0x58, 0x54, 0x54, 0x57, 0x5D, 0x5E, 0x65, 0x65, 0x6C, 0x73,
-  0x77, 0x85, 0x87, 0x8F, 0x98, 0x97, 0xA1, 0xA2, 0xA5, 0xA7, 0xA7, 0xAA,
-  0xAA, 0xA6, 0xA2, 0xA1, 0x9B, 0x9A, 0x91, 0x8B, 0x89, 0x7C, 0x7B, 0x6B,
-  0x64, 0x61, 0x58, 0x59, 0x55, 0x54, 0x57, 0x5D, 0x5E, 0x68, 0x6C, 0x74,
-  0x85, 0x86, 0x96, 0x9C, 0xA0, 0xA6, 0xA5, 0xA8, 0xA8, 0xA6, 0xA0, 0xA0,
-  0x94, 0x94, 0x88, 0x7C, 0x75, 0x5A, 0x4C, 0x65, 0x7A, 0x81, 0x9C, 0xA6,
-  0x91, 0x7D, 0x79, 0x6A, 0x6A, 0x62, 0x5D, 0x5D, 0x59, 0x5B, 0x58, 0x56,
-  0x58, 0x5F, 0x60, 0x65, 0x67, 0x6C, 0x76, 0x77, 0x84, 0x8A, 0x8D, 0x99,
-  0x99, 0xA1, 0xA5, 0xA5, 0xA8, 0xA7, 0xAA, 0xAA, 0xA7, 0xA3, 0xA1, 0x9C,
-  0x9B, 0x95, 0x8C, 0x8B, 0x7E, 0x7B, 0x71, 0x64, 0x63, 0x5A, 0x58, 0x56,
-  0x53, 0x54, 0x5B, 0x5C, 0x63, 0x6B, 0x6E, 0x7F, 0x82, 0x8E, 0x98, 0x98,
-  0xA1, 0xA0, 0xA3, 0xA3, 0xA2, 0x9C, 0x9D, 0x94, 0x91, 0x8A, 0x7C, 0x78,
-  0x61, 0x4F, 0x5E, 0x77, 0x7D, 0x92, 0xA3, 0x96, 0x7F, 0x7B, 0x70, 0x6B,
-  0x69, 0x60, 0x62, 0x5E, 0x5F, 0x5C, 0x5A, 0x5B, 0x61, 0x63, 0x65, 0x6A,
-  0x6C, 0x75, 0x77, 0x7F, 0x89, 0x8A, 0x95, 0x97, 0x9C, 0xA2, 0xA1, 0xA5,
-  0xA4, 0xA6, 0xA8, 0xA5, 0xA1, 0xA0, 0x9C, 0x98, 0x96, 0x8C, 0x8A, 0x80,
-  0x7A, 0x76, 0x66, 0x66, 0x5E, 0x5A, 0x59, 0x56, 0x57, 0x5C, 0x5E, 0x63,
-  0x6C, 0x6E, 0x7E, 0x84, 0x8C, 0x9A, 0x9A, 0xA1, 0xA2, 0xA4, 0xA5, 0xA5,
-  0x9F, 0x9E, 0x99, 0x92, 0x91, 0x80, 0x7D, 0x6B, 0x53, 0x59, 0x74, 0x7D,
-  0x8C, 0xA3, 0x9C, 0x84, 0x7D, 0x75, 0x6B, 0x6B, 0x61, 0x61, 0x5E, 0x5E,
-  0x5D, 0x5A, 0x5B, 0x5E, 0x62, 0x65, 0x69, 0x6A, 0x72, 0x77, 0x7B, 0x88,
-  0x89, 0x92, 0x93, 0x90, 0x97, 0x95, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x97,
-  0x95, 0x93, 0x90, 0x8F, 0x87, 0x86, 0x81, 0x79, 0x78, 0x6C, 0x69, 0x65,
-  0x5F, 0x5F, 0x5D, 0x5D, 0x60, 0x64, 0x66, 0x6E, 0x6F, 0x79, 0x82, 0x85,
-  0x93, 0x95, 0x9A, 0x9C, 0x9C, 0x9E, 0x9F, 0x9B, 0x98, 0x97, 0x90, 0x8F,
-  0x82, 0x7E, 0x75, 0x60, 0x5C, 0x71, 0x7D, 0x86, 0x9A, 0x9A, 0x88, 0x7E,
-  0x7B, 0x70, 0x70, 0x69, 0x68, 0x66, 0x64, 0x65, 0x62, 0x61, 0x63, 0x67,
-  0x68, 0x6D, 0x6D, 0x73, 0x78, 0x7A, 0x83, 0x87, 0x8C, 0x93, 0x93, 0x99,
-  0x9A, 0x9B, 0x9D, 0x9D, 0x9F, 0x9E, 0x9C, 0x99, 0x98, 0x93, 0x93, 0x8D,
-  0x88, 0x86, 0x7D, 0x7D, 0x72, 0x6B, 0x69, 0x63, 0x63, 0x61, 0x60, 0x61,
-  0x66, 0x67, 0x6F, 0x72, 0x78, 0x84, 0x85, 0x91, 0x96, 0x98, 0x9D, 0x9C,
-  0x9F, 0x9E, 0x9D, 0x98, 0x97, 0x8E, 0x8F, 0x86, 0x7E, 0x7B, 0x68, 0x60,
-  0x6D, 0x7E, 0x84, 0xBC, 0xE3, 0xF5, 0xF1, 0xD4, 0xCA, 0xBA, 0x98, 0x72,
-  0x60, 0x4E, 0x41, 0x46, 0x55, 0x65, 0x7D, 0x91, 0x9A, 0x9B, 0x97, 0x8A,
-  0x7A, 0x62, 0x49, 0x3D, 0x3A, 0x43, 0x51, 0x72, 0x98, 0xAB, 0xB9, 0xCA,
-  0xC7, 0xB9, 0xB0, 0x9F, 0x89, 0x7D, 0x7F, 0x85, 0x8F, 0xA4, 0xBF, 0xD1,
-  0xDB, 0xE4, 0xE0, 0xD6, 0xC1, 0xA1, 0x8A, 0x7A, 0x6E, 0x6E, 0x7A, 0x84,
-  0x92, 0xA6, 0xB0, 0xAC, 0xA5, 0x9E, 0x82, 0x56, 0x3D, 0x2C, 0x19, 0x18,
-  0x28, 0x39, 0x51, 0x6A, 0x7A, 0x86, 0x88, 0x7F, 0x75, 0x67, 0x51, 0x44,
-  0x4B, 0x56, 0x5D, 0x76, 0xA2, 0xBF, 0xCE, 0xDE, 0xE1, 0xD5, 0xC2, 0xAA,
-  0x8E, 0x7F, 0x70, 0x6D, 0x76, 0x83, 0x90, 0xA5, 0xB3, 0xAF, 0xA2, 0x9D,
-  0x85, 0x4A, 0x2A, 0x1B, 0x2D, 0x49, 0x4F, 0x67, 0x99, 0xB6, 0xC5, 0xBC,
-  0xA4, 0x9E, 0x8B, 0x6B, 0x4D, 0x41, 0x31, 0x28, 0x30, 0x3D, 0x4F, 0x67,
-  0x7A, 0x81, 0x81, 0x7B, 0x6E, 0x5E, 0x47, 0x35, 0x2C, 0x2C, 0x34, 0x42,
-  0x65, 0x87, 0x99, 0xAC, 0xBA, 0xB3, 0xA6, 0x9A, 0x86, 0x71, 0x69, 0x6C,
-  0x73, 0x81, 0x9C, 0xBB, 0xCF, 0xDC, 0xE3, 0xDC, 0xCD, 0xB1, 0x8F, 0x78,
-  0x68, 0x5F, 0x65, 0x72, 0x7E, 0x90, 0xA5, 0xAC, 0xA7, 0x9F, 0x95, 0x72,
-  0x49, 0x35, 0x25, 0x15, 0x1A, 0x2A, 0x3C, 0x57, 0x6E, 0x7D, 0x88, 0x87,
-  0x7C, 0x72, 0x60, 0x4C, 0x42, 0x4C, 0x55, 0x5E, 0x7E, 0xA9, 0xC2, 0xD1,
-  0xDF, 0xDE, 0xCE, 0xBB, 0xA0, 0x87, 0x78, 0x6A, 0x6B, 0x76, 0x83, 0x93,
-  0xAB, 0xB4, 0xAD, 0xA0, 0x9C, 0x77, 0x41, 0x26, 0x1D, 0x36, 0x4A, 0x51,
-  0x71, 0xA2, 0xBB, 0xC7, 0xB6, 0xA4, 0x9E, 0x86, 0x64, 0x4B, 0x3F, 0x2E,
-  0x2A, 0x33, 0x42, 0x58, 0x71, 0x81, 0x87, 0x84, 0x7C, 0x6F, 0x5C, 0x44,
-  0x35, 0x2E, 0x30, 0x39, 0x4E, 0x73, 0x92, 0xA3, 0xB5, 0xBF, 0xB4, 0xA9,
-  0x9B, 0x85, 0x71, 0x6B, 0x6F, 0x77, 0x88, 0xA5, 0xC2, 0xD1, 0xDE, 0xE1,
-  0xD8, 0xC8, 0xA9, 0x88, 0x74, 0x66, 0x5F, 0x68, 0x75, 0x82, 0x97, 0xA9,
-  0xAE, 0xA8, 0xA0, 0x91, 0x6A, 0x45, 0x32, 0x20, 0x16, 0x1F, 0x30, 0x45,
-  0x61, 0x76, 0x85, 0x8E, 0x89, 0x7E, 0x72, 0x5F, 0x4B, 0x46, 0x50, 0x59,
-  0x66, 0x8B, 0xB3, 0xC7, 0xD7, 0xE2, 0xDC, 0xCB, 0xB7, 0x9B, 0x83, 0x75,
-  0x6A, 0x6F, 0x7B, 0x89, 0x9C, 0xB1, 0xB6, 0xAD, 0xA3, 0x9B, 0x6D, 0x3E,
-  0x27, 0x22, 0x3D, 0x4D, 0x57, 0x7F, 0xAB, 0xC1, 0xC8, 0xB2, 0xA6, 0x9D,
-  0x80, 0x5D, 0x49, 0x3C, 0x2C, 0x2C, 0x39, 0x49, 0x60, 0x7A, 0x86, 0x8A,
-  0x86, 0x7D, 0x6E, 0x58, 0x41, 0x34, 0x2F, 0x34, 0x3F, 0x57, 0x7E, 0x9A,
-  0xA9, 0xBC, 0xBF, 0xB2, 0xA7, 0x97, 0x7F, 0x70, 0x6E, 0x73, 0x7D, 0x90,
-  0xAF, 0xC8, 0xD6, 0xE1, 0xE1, 0xD6, 0xC3, 0xA3, 0x86, 0x74, 0x66, 0x64,
-  0x6E, 0x7C, 0x89, 0x9E, 0xAD, 0xAE, 0xA8, 0xA0, 0x8C, 0x61, 0x40, 0x2F,
-  0x1D, 0x18, 0x24, 0x36, 0x4D, 0x6A, 0x7E, 0x8A, 0x90, 0x88, 0x7D, 0x6F,
-  0x59, 0x46, 0x45, 0x4F, 0x57, 0x6A, 0x93, 0xB6, 0xC8, 0xD8, 0xDF, 0xD6,
-  0xC4, 0xAE, 0x90, 0x7C, 0x6D, 0x66, 0x6E, 0x7D, 0x8C, 0xA2, 0xB5, 0xB7,
-  0xAE, 0xA5, 0x98, 0x65, 0x3B, 0x27, 0x2A, 0x43, 0x4E, 0x5F, 0x8C, 0xB1,
-  0xC5, 0xC5, 0xB1, 0xA9, 0x9A, 0x7B, 0x59, 0x48, 0x38, 0x2C, 0x30, 0x3E,
-  0x51, 0x6B, 0x82, 0x8D, 0x8F, 0x8A, 0x7D, 0x6C, 0x55, 0x3E, 0x33, 0x2E,
-  0x35, 0x43, 0x61, 0x87, 0x9E, 0xAF, 0xC0, 0xBD, 0xAF, 0xA4, 0x90, 0x78,
-  0x6B, 0x6A, 0x71, 0x7D, 0x94, 0xB3, 0xCB, 0xD8, 0xE1, 0xDD, 0xD1, 0xBA,
-  0x98, 0x7F, 0x6E, 0x62, 0x63, 0x70, 0x7D, 0x8F, 0xA6, 0xB1, 0xB0, 0xA9,
-  0xA1, 0x85, 0x59, 0x3C, 0x29, 0x16, 0x15, 0x27, 0x3A, 0x56, 0x72, 0x85,
-  0x94, 0x95, 0x8A, 0x7F, 0x83, 0x84, 0x83, 0x92, 0x9A, 0x99, 0x9F, 0xAE,
-  0xB1, 0xAE, 0xB4, 0xB8, 0xB5, 0xB5, 0xB8, 0xB6, 0xB5, 0xAF, 0xAC, 0xAB,
-  0xA8, 0x9E, 0x9B, 0x9A, 0x8D, 0x7E, 0x81, 0x78, 0x57, 0x51, 0x51, 0x69,
-  0x82, 0x80, 0x89, 0xA5, 0xAB, 0xAB, 0x99, 0x7F, 0x81, 0x7B, 0x70, 0x6A,
-  0x6C, 0x65, 0x5E, 0x5F, 0x5F, 0x5B, 0x5B, 0x5C, 0x5A, 0x57, 0x58, 0x59,
-  0x5F, 0x62, 0x62, 0x66, 0x69, 0x6B, 0x6C, 0x76, 0x7B, 0x7A, 0x81, 0x8D,
-  0x8E, 0x8E, 0x97, 0x9D, 0x9B, 0x9F, 0xA7, 0xA6, 0xA5, 0xA8, 0xA9, 0xA7,
-  0xA7, 0xA9, 0xA9, 0xA7, 0xA3, 0x9F, 0x9E, 0x9C, 0x96, 0x95, 0x94, 0x8C,
-  0x85, 0x85, 0x80, 0x75, 0x72, 0x74, 0x67, 0x5A, 0x5C, 0x59, 0x51, 0x4F,
-  0x51, 0x4F, 0x4D, 0x4E, 0x50, 0x57, 0x59, 0x5A, 0x62, 0x6A, 0x6A, 0x6E,
-  0x80, 0x86, 0x84, 0x8F, 0x9D, 0x9C, 0x9D, 0xA4, 0xA6, 0xA4, 0xA6, 0xA8,
-  0xA7, 0xA5, 0xA0, 0x9C, 0x98, 0x95, 0x8C, 0x8C, 0x89, 0x7B, 0x70, 0x75,
-  0x63, 0x4A, 0x48, 0x4A, 0x67, 0x77, 0x74, 0x82, 0x9A, 0x9D, 0x9C, 0x85,
-  0x73, 0x76, 0x6F, 0x65, 0x62, 0x64, 0x5C, 0x58, 0x59, 0x59, 0x56, 0x56,
-  0x58, 0x55, 0x54, 0x54, 0x57, 0x5C, 0x5F, 0x60, 0x64, 0x69, 0x69, 0x6C,
-  0x75, 0x78, 0x78, 0x81, 0x8B, 0x8A, 0x8D, 0x96, 0x99, 0x98, 0x9D, 0xA3,
-  0xA2, 0xA2, 0xA5, 0xA5, 0xA3, 0xA5, 0xA7, 0xA6, 0xA4, 0xA0, 0x9D, 0x9C,
-  0x99, 0x94, 0x94, 0x92, 0x89, 0x84, 0x85, 0x7F, 0x74, 0x74, 0x73, 0x64,
-  0x5D, 0x5F, 0x5A, 0x54, 0x54, 0x54, 0x51, 0x51, 0x51, 0x54, 0x5A, 0x5B,
-  0x5D, 0x66, 0x6C, 0x6B, 0x73, 0x82, 0x85, 0x85, 0x92, 0x9C, 0x9A, 0x9E,
-  0xA3, 0xA4, 0xA2, 0xA5, 0xA6, 0xA5, 0xA3, 0x9F, 0x9D, 0x9B, 0x96, 0x8E,
-  0x90, 0x88, 0x7B, 0x75, 0x79, 0x62, 0x4D, 0x4C, 0x52, 0x71, 0x7C, 0x79,
-  0x8E, 0xA0, 0xA2, 0x9C, 0x80, 0x77, 0x79, 0x6F, 0x67, 0x67, 0x67, 0x5F,
-  0x5C, 0x5D, 0x5B, 0x59, 0x5A, 0x5A, 0x58, 0x57, 0x58, 0x5B, 0x61, 0x61,
-  0x63, 0x67, 0x69, 0x69, 0x6E, 0x76, 0x77, 0x79, 0x84, 0x8A, 0x88, 0x8E,
-  0x97, 0x96, 0x97, 0x9E, 0xA1, 0xA0, 0xA0, 0xA3, 0xA3, 0xA2, 0xA4, 0xA6,
-  0xA5, 0xA2, 0x9E, 0x9D, 0x9B, 0x97, 0x94, 0x94, 0x91, 0x89, 0x86, 0x86,
-  0x7F, 0x77, 0x78, 0x74, 0x66, 0x62, 0x63, 0x5D, 0x58, 0x59, 0x59, 0x56,
-  0x56, 0x57, 0x5B, 0x60, 0x60, 0x63, 0x6C, 0x6F, 0x6F, 0x7A, 0x86, 0x85,
-  0x88, 0x96, 0x9C, 0x99, 0x9E, 0xA1, 0xA2, 0xA1, 0xA3, 0xA3, 0xA3, 0xA0,
-  0x9C, 0x9B, 0x99, 0x91, 0x8D, 0x8F, 0x87, 0x79, 0x76, 0x77, 0x5C, 0x50,
-  0x4F, 0x5D, 0x78, 0x7B, 0x7E, 0x95, 0xA1, 0xA1, 0x96, 0x7D, 0x7B, 0x79,
-  0x71, 0x69, 0x6B, 0x68, 0x60, 0x60, 0x60, 0x5F, 0x5D, 0x5E, 0x5D, 0x5B,
-  0x5B, 0x5C, 0x60, 0x65, 0x68, 0x6B, 0x6E, 0x70, 0x70, 0x75, 0x7B, 0x7A,
-  0x7D, 0x86, 0x88, 0x87, 0x8D, 0x92, 0x92, 0x93, 0x98, 0x9A, 0x99, 0x9A,
-  0x9C, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x99, 0x96, 0x96, 0x94, 0x91, 0x8F,
-  0x8F, 0x8B, 0x85, 0x85, 0x83, 0x7C, 0x78, 0x7A, 0x73, 0x69, 0x69, 0x69,
-  0x65, 0x61, 0x62, 0x62, 0x60, 0x60, 0x61, 0x64, 0x68, 0x68, 0x6C, 0x73,
-  0x74, 0x75, 0x7F, 0x87, 0x86, 0x8A, 0x95, 0x97, 0x96, 0x9A, 0x9D, 0x9C,
-  0x9C, 0x9E, 0x9D, 0x9D, 0x9A, 0x97, 0x96, 0x95, 0x8E, 0x8C, 0x8B, 0x83,
-  0x79, 0x7B, 0x75, 0x5F, 0x5A, 0x5A, 0x6A, 0x7C, 0x7B, 0x81, 0x94, 0x9A,
-  0x9A, 0x8D, 0x7B, 0x7C, 0x79, 0x71, 0x6D, 0x6E, 0x6A, 0x66, 0x65, 0x66,
-  0x64, 0x64, 0x65, 0x64, 0x62, 0x62, 0x65, 0x68, 0x6B, 0x6B, 0x6D, 0x70,
-  0x71, 0x72, 0x79, 0x7C, 0x7C, 0x81, 0x88, 0x8A, 0x8B, 0x92, 0x95, 0x94,
-  0x96, 0x9C, 0x9B, 0x9D, 0x87, 0x53, 0x3D, 0x56, 0x93, 0xBD, 0xBE, 0x90,
-  0x55, 0x3F, 0x54, 0x8A, 0xB3, 0xB4, 0x86, 0x4E, 0x3A, 0x4C, 0x7A, 0xA0,
-  0xA2, 0x77, 0x3B, 0x26, 0x39, 0x68, 0x90, 0x93, 0x6C, 0x36, 0x21, 0x36,
-  0x6E, 0x98, 0x99, 0x7A, 0x4A, 0x34, 0x49, 0x86, 0xB4, 0xB5, 0x97, 0x69,
-  0x52, 0x67, 0x9F, 0xCC, 0xCF, 0xA8, 0x72, 0x5A, 0x6C, 0x9C, 0xC6, 0xC9,
-  0xA2, 0x67, 0x4C, 0x5D, 0x8A, 0xAF, 0xB5, 0x86, 0x40, 0x22, 0x36, 0x7D,
-  0xB4, 0xB7, 0x9A, 0x72, 0x5A, 0x6B, 0x91, 0xB2, 0xB9, 0x8F, 0x53, 0x36,
-  0x48, 0x77, 0xA2, 0xA9, 0x82, 0x46, 0x29, 0x3D, 0x72, 0x9E, 0xA4, 0x81,
-  0x4C, 0x30, 0x43, 0x7A, 0xA8, 0xB0, 0x8E, 0x5C, 0x42, 0x52, 0x8B, 0xBD,
-  0xC3, 0xA3, 0x72, 0x58, 0x66, 0x9D, 0xCC, 0xD2, 0xB1, 0x7D, 0x61, 0x6E,
-  0xA2, 0xCE, 0xD5, 0xB3, 0x7A, 0x5C, 0x69, 0x9A, 0xC3, 0xCA, 0xA8, 0x6D,
-  0x4D, 0x5B, 0x8A, 0xB0, 0xB7, 0x96, 0x56, 0x32, 0x41, 0x73, 0x9E, 0xA7,
-  0x87, 0x4C, 0x2A, 0x38, 0x6E, 0xA0, 0xAA, 0x8A, 0x57, 0x3A, 0x47, 0x7E,
-  0xB4, 0xC1, 0xA0, 0x70, 0x54, 0x5F, 0x94, 0xC7, 0xD4, 0xB1, 0x7A, 0x5A,
-  0x65, 0x95, 0xC2, 0xCC, 0xAD, 0x73, 0x4D, 0x59, 0x88, 0xB1, 0xB9, 0x9C,
-  0x58, 0x2B, 0x35, 0x6D, 0xAD, 0xBF, 0x9E, 0x71, 0x59, 0x62, 0x93, 0xB6,
-  0xBE, 0xA0, 0x62, 0x3B, 0x43, 0x75, 0xA3, 0xB0, 0x91, 0x56, 0x30, 0x39,
-  0x6E, 0x9E, 0xAB, 0x8E, 0x56, 0x35, 0x3E, 0x72, 0xA5, 0xB5, 0x98, 0x61,
-  0x42, 0x4A, 0x7D, 0xB3, 0xC6, 0xA9, 0x73, 0x54, 0x5C, 0x8D, 0xC1, 0xD2,
-  0xB6, 0x7E, 0x5B, 0x61, 0x91, 0xC4, 0xD3, 0xB8, 0x7F, 0x59, 0x5D, 0x8B,
-  0xBC, 0xCA, 0xB0, 0x76, 0x4C, 0x50, 0x80, 0xAE, 0xBA, 0xA1, 0x67, 0x37,
-  0x3A, 0x6C, 0x9C, 0xA9, 0x90, 0x57, 0x2E, 0x32, 0x64, 0x9A, 0xAD, 0x94,
-  0x5E, 0x3B, 0x42, 0x71, 0xAB, 0xC3, 0xA9, 0x73, 0x51, 0x58, 0x85, 0xBC,
-  0xD2, 0xB8, 0x7F, 0x58, 0x5B, 0x88, 0xBA, 0xCB, 0xB3, 0x7B, 0x4D, 0x4E,
-  0x7D, 0xAE, 0xBB, 0xA3, 0x6B, 0x34, 0x30, 0x5D, 0x9A, 0xBB, 0xA5, 0x6E,
-  0x4F, 0x57, 0x84, 0xB6, 0xBE, 0xA5, 0x6D, 0x3F, 0x3D, 0x6A, 0x9F, 0xB2,
-  0x9A, 0x62, 0x35, 0x35, 0x65, 0x9B, 0xAF, 0x99, 0x61, 0x37, 0x3A, 0x67,
-  0x9F, 0xB6, 0xA2, 0x6A, 0x41, 0x45, 0x71, 0xA9, 0xC4, 0xB1, 0x79, 0x51,
-  0x54, 0x7F, 0xB5, 0xCF, 0xBC, 0x84, 0x59, 0x59, 0x84, 0xBA, 0xD1, 0xBD,
-  0x85, 0x59, 0x55, 0x7F, 0xB5, 0xC9, 0xB5, 0x7E, 0x50, 0x4A, 0x73, 0xAA,
-  0xBC, 0xA7, 0x72, 0x40, 0x37, 0x61, 0x99, 0xAD, 0x99, 0x64, 0x33, 0x2F,
-  0x5A, 0x93, 0xAD, 0x9D, 0x68, 0x3B, 0x3D, 0x66, 0x9F, 0xBE, 0xB1, 0x7B,
-  0x4F, 0x52, 0x7B, 0xB3, 0xD0, 0xC0, 0x89, 0x5B, 0x58, 0x7E, 0xB6, 0xCE,
-  0xBB, 0x86, 0x55, 0x4D, 0x71, 0xA6, 0xBE, 0xAA, 0x75, 0x42, 0x32, 0x57,
-  0x91, 0xB5, 0xAC, 0x77, 0x47, 0x47, 0x71, 0xAB, 0xC3, 0xAC, 0x76, 0x44,
-  0x39, 0x5E, 0x98, 0xB4, 0xA3, 0x6E, 0x3D, 0x34, 0x5A, 0x94, 0xB1, 0xA2,
-  0x6D, 0x3B, 0x35, 0x5C, 0x96, 0xB5, 0xA9, 0x74, 0x43, 0x3C, 0x63, 0x9D,
-  0xBD, 0xB4, 0x80, 0x4F, 0x48, 0x70, 0xA9, 0xC8, 0xBE, 0x8A, 0x58, 0x4E,
-  0x73, 0xAC, 0xCB, 0xC0, 0x8B, 0x59, 0x4D, 0x6F, 0xA9, 0xC7, 0xBB, 0x86,
-  0x53, 0x46, 0x67, 0xA1, 0xC0, 0xB1, 0x7D, 0x4A, 0x3A, 0x5A, 0x95, 0xB3,
-  0xA6, 0x73, 0x3F, 0x31, 0x55, 0x8F, 0xB0, 0xA8, 0x76, 0x42, 0x37, 0x5C,
-  0x97, 0xB9, 0xB4, 0x83, 0x50, 0x45, 0x6B, 0xA5, 0xC7, 0xC0, 0x8E, 0x59,
-  0x4C, 0x6E, 0xA7, 0xCA, 0xC0, 0x8C, 0x56, 0x47, 0x66, 0xA0, 0xC2, 0xB5,
-  0x81, 0x4E, 0x3A, 0x54, 0x8C, 0xAC, 0xAC, 0x83, 0x50, 0x46, 0x6C, 0xA3,
-  0xC2, 0xB5, 0x83, 0x52, 0x41, 0x41, 0x40, 0x43, 0x42, 0x43, 0x45, 0x47,
-  0x48, 0x49, 0x4A, 0x4B, 0x4B, 0x4C, 0x4D, 0x50, 0x51, 0x50, 0x52, 0x53,
-  0x54, 0x56, 0x59, 0x5C, 0x5D, 0x60, 0x63, 0x65, 0x66, 0x69, 0x6C, 0x6D,
-  0x6F, 0x71, 0x72, 0x73, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x79, 0x7A,
-  0x79, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x79, 0x78,
-  0x79, 0x76, 0x74, 0x75, 0x75, 0x73, 0x74, 0x75, 0x74, 0x74, 0x75, 0x76,
-  0x77, 0x78, 0x79, 0x7B, 0x7D, 0x7D, 0x80, 0x83, 0x84, 0x85, 0x88, 0x8B,
-  0x8A, 0x8C, 0x8D, 0x8E, 0x8D, 0x8D, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C,
-  0x8B, 0x8A, 0x8A, 0x89, 0x85, 0x84, 0x85, 0x80, 0x7B, 0x7A, 0x7C, 0x84,
-  0x87, 0x86, 0x8B, 0x8F, 0x90, 0x8F, 0x89, 0x87, 0x86, 0x85, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x83, 0x82, 0x83, 0x84, 0x85, 0x84, 0x86, 0x87, 0x86, 0x87, 0x88, 0x8A,
-  0x89, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8D, 0x8C, 0x8B, 0x8C, 0x8B, 0x8C,
-  0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x8A, 0x8B, 0x8A, 0x89, 0x8A, 0x89, 0x89,
-  0x88, 0x87, 0x87, 0x86, 0x87, 0x86, 0x84, 0x83, 0x84, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x86, 0x87, 0x87, 0x88,
-  0x8A, 0x89, 0x8A, 0x8B, 0x8D, 0x8C, 0x8D, 0x8C, 0x8D, 0x8C, 0x8D, 0x8D,
-  0x8C, 0x8D, 0x8C, 0x8B, 0x8C, 0x8A, 0x89, 0x8A, 0x89, 0x87, 0x86, 0x87,
-  0x83, 0x81, 0x81, 0x83, 0x86, 0x87, 0x87, 0x89, 0x8B, 0x8B, 0x8A, 0x86,
-  0x85, 0x86, 0x84, 0x83, 0x83, 0x83, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x82, 0x83, 0x83, 0x82, 0x83,
-  0x85, 0x84, 0x85, 0x87, 0x88, 0x87, 0x88, 0x89, 0x88, 0x89, 0x89, 0x8A,
-  0x89, 0x89, 0x8A, 0x8A, 0x89, 0x85, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x82,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x84, 0x83, 0x83,
-  0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x84, 0x83,
-  0x84, 0x83, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80,
-  0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x7F, 0x96, 0xB9, 0xD7, 0xED, 0xEF, 0xE2, 0xC2,
-  0xA1, 0x8C, 0x8B, 0x9A, 0xB6, 0xCF, 0xD8, 0xD2, 0xBB, 0x9B, 0x82, 0x7A,
-  0x83, 0x9E, 0xBE, 0xD2, 0xD2, 0xBF, 0x9D, 0x7C, 0x6D, 0x70, 0x89, 0xAD,
-  0xC9, 0xD1, 0xC4, 0xA4, 0x7D, 0x64, 0x60, 0x72, 0x97, 0xBB, 0xCB, 0xC7,
-  0xAB, 0x81, 0x60, 0x54, 0x5F, 0x80, 0xA9, 0xC2, 0xC4, 0xB0, 0x89, 0x63,
-  0x4E, 0x50, 0x6B, 0x95, 0xB6, 0xC0, 0xB6, 0x94, 0x69, 0x4B, 0x47, 0x59,
-  0x80, 0xA8, 0xBA, 0xB7, 0x9D, 0x72, 0x4E, 0x41, 0x4B, 0x6B, 0x95, 0xB0,
-  0xB5, 0xA5, 0x7F, 0x56, 0x40, 0x41, 0x5A, 0x83, 0xA6, 0xB3, 0xAA, 0x8A,
-  0x5F, 0x41, 0x3B, 0x4C, 0x72, 0x99, 0xAE, 0xAD, 0x97, 0x6D, 0x48, 0x38,
-  0x40, 0x5F, 0x8A, 0xA8, 0xAE, 0xA0, 0x7B, 0x52, 0x39, 0x39, 0x51, 0x7A,
-  0x9F, 0xAD, 0xA7, 0x8A, 0x60, 0x40, 0x36, 0x46, 0x6A, 0x93, 0xAA, 0xAA,
-  0x97, 0x6F, 0x49, 0x37, 0x3D, 0x5A, 0x84, 0xA4, 0xAC, 0xA0, 0x7D, 0x53,
-  0x39, 0x35, 0x4B, 0x74, 0x9A, 0xAB, 0xA8, 0x8D, 0x63, 0x40, 0x34, 0x41,
-  0x64, 0x8F, 0xA7, 0xAA, 0x98, 0x70, 0x48, 0x34, 0x38, 0x54, 0x7E, 0x9F,
-  0xAB, 0xA1, 0x82, 0x57, 0x3A, 0x34, 0x48, 0x70, 0x97, 0xAA, 0xA8, 0x90,
-  0x66, 0x43, 0x35, 0x3F, 0x62, 0x8C, 0xA8, 0xAD, 0x9E, 0x78, 0x50, 0x38,
-  0x3A, 0x55, 0x7F, 0xA3, 0xB0, 0xA8, 0x89, 0x5E, 0x3F, 0x38, 0x4A, 0x70,
-  0x99, 0xAF, 0xAD, 0x97, 0x6E, 0x49, 0x39, 0x40, 0x60, 0x8C, 0xA9, 0xB0,
-  0xA3, 0x7F, 0x54, 0x3C, 0x3C, 0x53, 0x7E, 0xA2, 0xB1, 0xAB, 0x8E, 0x62,
-  0x42, 0x38, 0x47, 0x6C, 0x97, 0xAE, 0xB0, 0x9B, 0x73, 0x4C, 0x39, 0x3F,
-  0x5E, 0x89, 0xA9, 0xB2, 0xA6, 0x82, 0x58, 0x3E, 0x3B, 0x52, 0x7A, 0xA0,
-  0xB2, 0xAE, 0x93, 0x69, 0x46, 0x3B, 0x47, 0x6B, 0x96, 0xAF, 0xB3, 0xA1,
-  0x7A, 0x51, 0x3D, 0x41, 0x5D, 0x88, 0xA9, 0xB4, 0xAB, 0x8A, 0x5E, 0x41,
-  0x3B, 0x4E, 0x77, 0xA0, 0xB3, 0xB2, 0x99, 0x6D, 0x49, 0x3A, 0x45, 0x68,
-  0x94, 0xAF, 0xB4, 0xA3, 0x7C, 0x53, 0x3C, 0x3D, 0x57, 0x82, 0xA6, 0xB4,
-  0xAC, 0x8D, 0x61, 0x43, 0x3B, 0x4C, 0x73, 0x9D, 0xB3, 0xB3, 0x9B, 0x71,
-  0x4B, 0x3B, 0x45, 0x63, 0x8F, 0xAE, 0xB6, 0xA8, 0x84, 0x59, 0x40, 0x3F,
-  0x57, 0x82, 0xA9, 0xB9, 0xB3, 0x95, 0x69, 0x48, 0x3D, 0x4E, 0x74, 0x9E,
-  0xB5, 0xB7, 0xA3, 0x7A, 0x52, 0x3F, 0x45, 0x63, 0x8F, 0xAF, 0xB9, 0xAC,
-  0x89, 0x5F, 0x43, 0x41, 0x57, 0x80, 0xA7, 0xB8, 0xB3, 0x99, 0x6E, 0x4A,
-  0x3E, 0x4B, 0x6E, 0x99, 0xB4, 0xB8, 0xA5, 0x7D, 0x54, 0x3F, 0x43, 0x60,
-  0x8B, 0xAE, 0xB9, 0xAE, 0x8C, 0x61, 0x44, 0x3F, 0x52, 0x7A, 0xA3, 0xB7,
-  0xB5, 0x9C, 0x72, 0x4D, 0x3F, 0x49, 0x6B, 0x97, 0xB3, 0xBA, 0xA9, 0x82,
-  0x59, 0x42, 0x44, 0x5E, 0x89, 0xAD, 0xBA, 0xB3, 0x92, 0x66, 0x46, 0x3D,
-  0x4F, 0x76, 0xA1, 0xB8, 0xB8, 0xA0, 0x76, 0x4E, 0x3E, 0x46, 0x67, 0x94,
-  0xB3, 0xBA, 0xAC, 0x87, 0x5B, 0x40, 0x3F, 0x57, 0x82, 0xA8, 0xB8, 0xB2,
-  0x94, 0x69, 0x47, 0x3D, 0x4C, 0x72, 0x9E, 0xB6, 0xB7, 0xA2, 0x79, 0x51,
-  0x3E, 0x44, 0x63, 0x8F, 0xB0, 0xBB, 0xAE, 0x8B, 0x5F, 0x43, 0x40, 0x56,
-  0x80, 0xA9, 0xBB, 0xB7, 0x9C, 0x6F, 0x4B, 0x3F, 0x4C, 0x70, 0x9C, 0xB7,
-  0xBC, 0xA9, 0x80, 0x57, 0x42, 0x45, 0x62, 0x8E, 0xB1, 0xBD, 0xB3, 0x90,
-  0x64, 0x47, 0x41, 0x55, 0x7E, 0xA7, 0xBB, 0xB9, 0xA0, 0x75, 0x4F, 0x3F,
-  0x4A, 0x6C, 0x98, 0xB6, 0xBC, 0xAB, 0x84, 0x59, 0x41, 0x42, 0x5E, 0x89,
-  0xAE, 0xBC, 0xB3, 0x94, 0x68, 0x47, 0x40, 0x51, 0x78, 0xA2, 0xB9, 0xB9,
-  0xA2, 0x78, 0x51, 0x40, 0x49, 0x69, 0x95, 0xB4, 0xBB, 0xAC, 0x88, 0x5E,
-  0x44, 0x43, 0x5B, 0x85, 0xAC, 0xBD, 0xBA, 0xB5, 0xB4, 0xB3, 0xB1, 0xAF,
-  0xAE, 0xAC, 0xAB, 0xA9, 0xA8, 0xA7, 0xA5, 0xA4, 0xA3, 0xA2, 0xA1, 0x9F,
-  0x9F, 0x9E, 0x9C, 0x9B, 0x9A, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92,
-  0x91, 0x91, 0x90, 0x8F, 0x8E, 0x8D, 0x8D, 0x8D, 0x8C, 0x8B, 0x8A, 0x8A,
-  0x89, 0x89, 0x88, 0x87, 0x87, 0x86, 0x87, 0x86, 0x85, 0x85, 0x84, 0x85,
-  0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81,
-  0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B,
-  0x7A, 0x7B, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x78, 0x79, 0x78, 0x79,
-  0x79, 0x78, 0x79, 0x78, 0x79, 0x78, 0x77, 0x78, 0x77, 0x77, 0x78, 0x77,
-  0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x78, 0x77, 0x78,
-  0x79, 0x78, 0x79, 0x78, 0x79, 0x78, 0x77, 0x78, 0x78, 0x77, 0x78, 0x77,
-  0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x77, 0x78, 0x77, 0x78,
-  0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76,
-  0x77, 0x76, 0x77, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x77,
-  0x76, 0x77, 0x76, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x77, 0x78,
-  0x77, 0x78, 0x79, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x7A, 0x79, 0x7A,
-  0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A, 0x7B,
-  0x7A, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A,
-  0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79,
-  0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A,
-  0x7B, 0x7A, 0x7B, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7C,
-  0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C,
-  0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C,
-  0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B, 0x7A,
-  0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7C, 0x7B,
-  0x7C, 0x7B, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C,
-  0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D,
-  0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x80, 0x7E, 0x80, 0x7E, 0x81, 0x7D, 0x8C, 0x98, 0x84, 0x6B, 0x54, 0x4A,
-  0x53, 0x61, 0x7D, 0x9B, 0xA2, 0xA4, 0x8A, 0x6F, 0x44, 0x11, 0x0F, 0x2F,
-  0x49, 0x77, 0xA8, 0xA4, 0x96, 0x8A, 0x6D, 0x50, 0x33, 0x22, 0x23, 0x2E,
-  0x45, 0x5B, 0x6C, 0x79, 0x77, 0x69, 0x52, 0x3A, 0x38, 0x39, 0x53, 0x73,
-  0x94, 0xB5, 0xC2, 0xC9, 0xBB, 0xA1, 0x85, 0x75, 0x73, 0x7F, 0x91, 0xB0,
-  0xC4, 0xCD, 0xC5, 0xA8, 0x8A, 0x5C, 0x47, 0x30, 0x32, 0x46, 0x5E, 0x77,
-  0x7F, 0x7D, 0x75, 0x5E, 0x44, 0x3D, 0x35, 0x55, 0x6F, 0x9F, 0xC6, 0xD8,
-  0xE3, 0xD7, 0xC1, 0x9F, 0x81, 0x73, 0x77, 0x81, 0xA1, 0xAB, 0xB4, 0xA0,
-  0x6E, 0x66, 0x65, 0x59, 0x67, 0x84, 0x7C, 0x85, 0x9F, 0xA1, 0xA2, 0x8B,
-  0x6B, 0x43, 0x24, 0x18, 0x1C, 0x33, 0x58, 0x7B, 0x90, 0x9B, 0x95, 0x8D,
-  0x6E, 0x64, 0x5C, 0x65, 0x80, 0x9A, 0xC4, 0xD8, 0xE5, 0xDC, 0xCA, 0xAC,
-  0x91, 0x7C, 0x7A, 0x83, 0x99, 0xB4, 0xBC, 0xC3, 0xAE, 0x9B, 0x6D, 0x46,
-  0x2F, 0x24, 0x32, 0x48, 0x69, 0x84, 0x92, 0x93, 0x8D, 0x73, 0x69, 0x5B,
-  0x65, 0x7B, 0x96, 0xBD, 0xD6, 0xEA, 0xEA, 0xD5, 0xB2, 0x8A, 0x6D, 0x60,
-  0x57, 0x68, 0x72, 0x70, 0x94, 0xAD, 0xA9, 0xA8, 0x97, 0x68, 0x46, 0x48,
-  0x4E, 0x71, 0x86, 0x92, 0x92, 0x80, 0x63, 0x39, 0x23, 0x20, 0x30, 0x49,
-  0x6E, 0x8D, 0xA8, 0xAD, 0xB0, 0x9D, 0x85, 0x76, 0x6C, 0x7C, 0x8C, 0xB1,
-  0xCF, 0xE3, 0xE9, 0xDA, 0xBD, 0x9B, 0x7D, 0x6E, 0x6A, 0x72, 0x8B, 0x9B,
-  0xAC, 0xA0, 0x91, 0x78, 0x4F, 0x33, 0x1E, 0x1E, 0x36, 0x55, 0x7E, 0x9B,
-  0xA7, 0xB3, 0xA2, 0x93, 0x81, 0x75, 0x7A, 0x87, 0xA0, 0xBE, 0xCE, 0xD6,
-  0xCB, 0xB3, 0x92, 0x65, 0x50, 0x34, 0x29, 0x56, 0x8D, 0xAC, 0xCF, 0xD4,
-  0xAA, 0x82, 0x5E, 0x40, 0x38, 0x39, 0x4F, 0x6C, 0x80, 0x8D, 0x86, 0x79,
-  0x62, 0x46, 0x36, 0x32, 0x41, 0x63, 0x84, 0xAC, 0xBE, 0xC7, 0xC2, 0xA9,
-  0x91, 0x7B, 0x76, 0x7D, 0x94, 0xB6, 0xD2, 0xDB, 0xDB, 0xC6, 0xAA, 0x82,
-  0x65, 0x54, 0x4E, 0x60, 0x6E, 0x86, 0x8F, 0x8D, 0x80, 0x66, 0x44, 0x31,
-  0x23, 0x31, 0x4B, 0x71, 0xA5, 0xB8, 0xCC, 0xC7, 0xB7, 0x9B, 0x81, 0x76,
-  0x79, 0x83, 0x9E, 0xB5, 0xC3, 0xC5, 0xAA, 0x91, 0x5A, 0x2B, 0x32, 0x47,
-  0x61, 0x98, 0xC0, 0xB8, 0xB2, 0xA3, 0x86, 0x64, 0x3E, 0x2B, 0x27, 0x37,
-  0x4F, 0x6D, 0x84, 0x93, 0x91, 0x83, 0x67, 0x4E, 0x45, 0x44, 0x62, 0x7A,
-  0xA5, 0xC3, 0xD3, 0xDA, 0xC7, 0xAE, 0x8E, 0x7D, 0x78, 0x80, 0x91, 0xB2,
-  0xC5, 0xD2, 0xC6, 0xB0, 0x8F, 0x63, 0x4C, 0x30, 0x36, 0x45, 0x62, 0x7A,
-  0x86, 0x86, 0x7F, 0x67, 0x4F, 0x3E, 0x3A, 0x54, 0x6C, 0xA1, 0xC3, 0xDC,
-  0xE4, 0xDA, 0xC2, 0x9A, 0x7A, 0x6B, 0x69, 0x78, 0x93, 0xA3, 0xB1, 0x94,
-  0x74, 0x76, 0x6A, 0x5B, 0x6A, 0x74, 0x66, 0x79, 0x95, 0x9F, 0xA3, 0x8E,
-  0x73, 0x49, 0x28, 0x15, 0x18, 0x31, 0x56, 0x7B, 0x95, 0xA0, 0x9C, 0x90,
-  0x71, 0x62, 0x53, 0x5E, 0x71, 0x92, 0xBA, 0xD1, 0xE1, 0xD7, 0xC6, 0xA4,
-  0x84, 0x6E, 0x6A, 0x71, 0x8A, 0xA2, 0xB5, 0xBA, 0xAB, 0x97, 0x66, 0x43,
-  0x26, 0x1C, 0x29, 0x40, 0x64, 0x85, 0x92, 0x99, 0x8D, 0x78, 0x67, 0x55,
-  0x5F, 0x6E, 0x8A, 0xB0, 0xCC, 0xDF, 0xE0, 0xCB, 0xAB, 0x7F, 0x63, 0x50,
-  0x4B, 0x5C, 0x62, 0x74, 0xA1, 0xB2, 0xAF, 0xAE, 0x8C, 0x5A, 0x42, 0x3E,
-  0x4A, 0x6D, 0x82, 0x95, 0x94, 0x86, 0x68, 0x3E, 0x28, 0x22, 0x2D, 0x47,
-  0x6A, 0x8F, 0xA8, 0xB0, 0xB4, 0x9E, 0x86, 0x70, 0x66, 0x6F, 0x82, 0xA3,
-  0xC5, 0xDD, 0xE3, 0xD4, 0xB8, 0x94, 0x73, 0x63, 0x59, 0x68, 0x7B, 0x95,
-  0xA4, 0x9B, 0x93, 0x76, 0x52, 0x30, 0x18, 0x14, 0x29, 0x4A, 0x7F, 0x9C,
-  0xB4, 0xBC, 0xA9, 0x98, 0x7A, 0x6D, 0x6C, 0x77, 0x7E, 0x7E, 0x79, 0x7A,
-  0x71, 0x6F, 0x66, 0x58, 0x51, 0x32, 0x2B, 0x4A, 0x5D, 0x6C, 0x8B, 0x86,
-  0x69, 0x62, 0x56, 0x50, 0x4D, 0x44, 0x46, 0x42, 0x44, 0x42, 0x40, 0x45,
-  0x4B, 0x4E, 0x54, 0x56, 0x5F, 0x66, 0x6C, 0x7B, 0x7C, 0x8A, 0x8D, 0x95,
-  0x9B, 0x9C, 0xA1, 0x9F, 0xA3, 0xA4, 0xA1, 0x9D, 0x9B, 0x95, 0x95, 0x89,
-  0x88, 0x7D, 0x76, 0x70, 0x5F, 0x5E, 0x54, 0x52, 0x50, 0x4E, 0x51, 0x58,
-  0x5A, 0x67, 0x6A, 0x79, 0x87, 0x8C, 0x9E, 0xA1, 0xA8, 0xAC, 0xAD, 0xB0,
-  0xAD, 0xA8, 0xA6, 0x9D, 0x9A, 0x8D, 0x81, 0x78, 0x56, 0x52, 0x71, 0x81,
-  0x91, 0xAE, 0xA5, 0x89, 0x81, 0x74, 0x6D, 0x69, 0x61, 0x61, 0x5C, 0x5E,
-  0x5A, 0x58, 0x5D, 0x62, 0x64, 0x6A, 0x6B, 0x75, 0x7A, 0x82, 0x8F, 0x90,
-  0x9E, 0x9F, 0xA8, 0xAC, 0xAE, 0xB1, 0xB0, 0xB3, 0xB3, 0xAF, 0xAA, 0xA8,
-  0xA3, 0xA1, 0x95, 0x93, 0x88, 0x82, 0x79, 0x69, 0x67, 0x5E, 0x5D, 0x5B,
-  0x58, 0x5B, 0x62, 0x63, 0x6F, 0x71, 0x80, 0x8A, 0x91, 0xA1, 0xA2, 0xAA,
-  0xAB, 0xAD, 0xAE, 0xAB, 0xA7, 0xA6, 0x9C, 0x9A, 0x8D, 0x82, 0x79, 0x59,
-  0x58, 0x75, 0x82, 0x93, 0xAC, 0xA0, 0x87, 0x80, 0x74, 0x6E, 0x69, 0x62,
-  0x62, 0x5E, 0x5E, 0x5B, 0x5A, 0x5E, 0x63, 0x66, 0x6B, 0x6C, 0x76, 0x7A,
-  0x82, 0x8D, 0x8F, 0x9C, 0x9C, 0xA5, 0xA7, 0xAA, 0xAC, 0xAC, 0xAF, 0xAE,
-  0xAA, 0xA6, 0xA4, 0x9F, 0x9E, 0x93, 0x92, 0x86, 0x82, 0x78, 0x6A, 0x68,
-  0x5F, 0x5E, 0x5B, 0x59, 0x5C, 0x62, 0x64, 0x70, 0x72, 0x81, 0x89, 0x92,
-  0xA0, 0xA2, 0xA9, 0xAB, 0xAD, 0xAE, 0xAB, 0xA6, 0xA4, 0x9B, 0x99, 0x89,
-  0x80, 0x73, 0x55, 0x5A, 0x77, 0x81, 0x93, 0xAB, 0x9D, 0x85, 0x7E, 0x72,
-  0x6D, 0x68, 0x61, 0x61, 0x5D, 0x5F, 0x5A, 0x5A, 0x5E, 0x62, 0x65, 0x6A,
-  0x6B, 0x75, 0x79, 0x82, 0x8C, 0x8F, 0x9B, 0x9A, 0xA1, 0xA2, 0xA5, 0xA6,
-  0xA8, 0xAA, 0xA9, 0xA4, 0xA2, 0x9F, 0x9B, 0x98, 0x8E, 0x8D, 0x81, 0x7F,
-  0x73, 0x68, 0x66, 0x5E, 0x5D, 0x5B, 0x59, 0x5D, 0x61, 0x64, 0x6F, 0x70,
-  0x80, 0x86, 0x90, 0x9C, 0x9E, 0xA4, 0xA5, 0xA6, 0xA8, 0xA4, 0xA0, 0x9D,
-  0x94, 0x93, 0x84, 0x7C, 0x6E, 0x53, 0x5B, 0x76, 0x80, 0x93, 0xA6, 0x94,
-  0x80, 0x7B, 0x6F, 0x6C, 0x65, 0x61, 0x60, 0x5D, 0x5E, 0x5A, 0x5B, 0x5E,
-  0x63, 0x66, 0x6A, 0x6C, 0x76, 0x78, 0x83, 0x8B, 0x8E, 0x99, 0x99, 0xA3,
-  0xA3, 0xA6, 0xA7, 0xA8, 0xAA, 0xA8, 0xA4, 0xA2, 0x9E, 0x9B, 0x97, 0x8D,
-  0x8D, 0x80, 0x7E, 0x71, 0x68, 0x65, 0x5D, 0x5D, 0x59, 0x58, 0x5D, 0x61,
-  0x65, 0x6F, 0x70, 0x80, 0x85, 0x90, 0x9B, 0x9D, 0xA3, 0xA4, 0xA6, 0xA7,
-  0xA3, 0xA0, 0x9D, 0x95, 0x92, 0x83, 0x7D, 0x6D, 0x53, 0x5D, 0x76, 0x80,
-  0x95, 0xA6, 0x92, 0x80, 0x79, 0x6F, 0x6C, 0x65, 0x62, 0x61, 0x5F, 0x60,
-  0x5D, 0x5E, 0x62, 0x65, 0x67, 0x6B, 0x6C, 0x74, 0x75, 0x7F, 0x84, 0x88,
-  0x90, 0x90, 0x98, 0x98, 0x9B, 0x9B, 0x9C, 0x9E, 0x9D, 0x99, 0x97, 0x95,
-  0x92, 0x8F, 0x88, 0x86, 0x7D, 0x7C, 0x71, 0x6A, 0x66, 0x60, 0x60, 0x5D,
-  0x5D, 0x60, 0x63, 0x67, 0x6E, 0x71, 0x7F, 0x82, 0x8C, 0x93, 0x95, 0x9A,
-  0x9B, 0x9C, 0x9D, 0x9A, 0x98, 0x95, 0x8F, 0x8D, 0x81, 0x7C, 0x6E, 0x5A,
-  0x65, 0x78, 0x80, 0x91, 0x9D, 0x8D, 0x80, 0x7C, 0x73, 0x70, 0x6A, 0x68,
-  0x67, 0x65, 0x65, 0x62, 0x63, 0x67, 0x69, 0x6B, 0x6F, 0x71, 0x79, 0x7A,
-  0x84, 0x88, 0x8D, 0x93, 0x94, 0x9C, 0x9B, 0x9F, 0x9D, 0x9F, 0xA0, 0x9F,
-  0x9B, 0x9A, 0x96, 0x95, 0x8F, 0x8A, 0x88, 0x7E, 0x7D, 0x71, 0x6B, 0x68,
-  0x63, 0x62, 0x5F, 0x5F, 0x64, 0x65, 0x6A, 0x71, 0x74, 0x81, 0x84, 0x8E,
-  0x94, 0x96, 0x9B, 0x9A, 0x9D, 0x9D, 0x9A, 0x99, 0xBB, 0xDD, 0xF0, 0xED,
-  0xBF, 0x87, 0x77, 0x86, 0x8E, 0x9E, 0x9A, 0x8B, 0x80, 0x72, 0x86, 0xCA,
-  0xEF, 0xEF, 0xC3, 0x7A, 0x67, 0x77, 0x98, 0xAD, 0xAD, 0x85, 0x50, 0x3F,
-  0x52, 0x7C, 0x96, 0x98, 0x73, 0x3C, 0x25, 0x3D, 0x76, 0x9D, 0x9B, 0x7A,
-  0x4D, 0x3D, 0x52, 0x8C, 0xB2, 0xB0, 0x94, 0x75, 0x66, 0x77, 0xAC, 0xD4,
-  0xD1, 0xB2, 0x8F, 0x7F, 0x8F, 0xBD, 0xDE, 0xDD, 0xBC, 0x93, 0x80, 0x90,
-  0xB7, 0xD2, 0xD1, 0xAE, 0x7E, 0x69, 0x7A, 0x9E, 0xB4, 0xB5, 0x93, 0x5D,
-  0x44, 0x56, 0x76, 0x87, 0x88, 0x67, 0x30, 0x15, 0x2B, 0x57, 0x76, 0x79,
-  0x5A, 0x32, 0x22, 0x34, 0x68, 0x92, 0x96, 0x78, 0x5E, 0x55, 0x62, 0x96,
-  0xC9, 0xCF, 0xAD, 0x87, 0x76, 0x83, 0xB2, 0xDB, 0xDC, 0xB9, 0x83, 0x6B,
-  0x78, 0xA2, 0xB8, 0xBB, 0x9B, 0x5F, 0x3A, 0x4D, 0x6E, 0x6D, 0x6D, 0x4F,
-  0x40, 0x43, 0x4E, 0x85, 0xC6, 0xD1, 0xB1, 0x6F, 0x41, 0x50, 0x74, 0x8C,
-  0x8B, 0x71, 0x3F, 0x26, 0x32, 0x5B, 0x7B, 0x7F, 0x65, 0x35, 0x1A, 0x28,
-  0x55, 0x7F, 0x88, 0x6C, 0x43, 0x30, 0x3D, 0x6A, 0x99, 0xA3, 0x86, 0x5F,
-  0x54, 0x60, 0x8D, 0xBF, 0xCC, 0xAD, 0x81, 0x71, 0x7C, 0xA8, 0xD4, 0xDD,
-  0xBC, 0x8A, 0x73, 0x7D, 0xAB, 0xCE, 0xD0, 0xB1, 0x7D, 0x60, 0x69, 0x93,
-  0xB0, 0xB0, 0x97, 0x63, 0x3F, 0x47, 0x72, 0x8A, 0x85, 0x6D, 0x3C, 0x17,
-  0x20, 0x4E, 0x72, 0x79, 0x60, 0x35, 0x20, 0x2E, 0x59, 0x87, 0x98, 0x7E,
-  0x57, 0x50, 0x5E, 0x84, 0xB8, 0xCF, 0xB3, 0x87, 0x73, 0x7E, 0xA6, 0xD5,
-  0xE0, 0xC1, 0x8F, 0x6E, 0x74, 0x9D, 0xBF, 0xBE, 0xA7, 0x73, 0x47, 0x45,
-  0x75, 0x87, 0x76, 0x5C, 0x30, 0x34, 0x4E, 0x74, 0xB0, 0xD3, 0xBC, 0x8A,
-  0x53, 0x4B, 0x76, 0x95, 0x93, 0x7A, 0x4F, 0x2C, 0x2E, 0x55, 0x7C, 0x83,
-  0x6E, 0x3F, 0x1D, 0x22, 0x4E, 0x7A, 0x8B, 0x75, 0x49, 0x30, 0x3B, 0x63,
-  0x91, 0xA6, 0x92, 0x63, 0x50, 0x60, 0x85, 0xB5, 0xCC, 0xB8, 0x87, 0x6E,
-  0x7A, 0xA1, 0xCD, 0xDE, 0xC8, 0x94, 0x76, 0x7D, 0xA4, 0xD0, 0xD6, 0xBC,
-  0x8C, 0x68, 0x6A, 0x8F, 0xB8, 0xBB, 0xA2, 0x74, 0x4E, 0x48, 0x6E, 0x97,
-  0x93, 0x77, 0x4A, 0x22, 0x1F, 0x49, 0x76, 0x80, 0x6B, 0x3D, 0x1E, 0x29,
-  0x52, 0x7F, 0x96, 0x89, 0x5C, 0x44, 0x58, 0x7D, 0xA9, 0xC9, 0xBD, 0x8D,
-  0x6F, 0x78, 0x9F, 0xCC, 0xE1, 0xCA, 0x99, 0x74, 0x71, 0x96, 0xC0, 0xC8,
-  0xAE, 0x83, 0x58, 0x4B, 0x6B, 0x9C, 0x90, 0x69, 0x39, 0x1F, 0x42, 0x73,
-  0x9E, 0xC7, 0xC7, 0x98, 0x6E, 0x50, 0x6D, 0x9C, 0xA3, 0x86, 0x59, 0x38,
-  0x2E, 0x4F, 0x7D, 0x8C, 0x78, 0x4B, 0x24, 0x20, 0x46, 0x77, 0x8C, 0x81,
-  0x51, 0x30, 0x35, 0x5D, 0x8A, 0xA1, 0x9A, 0x6C, 0x4B, 0x58, 0x81, 0xAD,
-  0xC6, 0xBF, 0x90, 0x6D, 0x74, 0x9B, 0xC8, 0xDC, 0xCD, 0x9B, 0x74, 0x74,
-  0x9A, 0xC8, 0xDA, 0xC3, 0x94, 0x6D, 0x67, 0x87, 0xB5, 0xC4, 0xAC, 0x7D,
-  0x57, 0x4B, 0x66, 0x97, 0xA5, 0x86, 0x56, 0x2F, 0x23, 0x44, 0x76, 0x8A,
-  0x78, 0x49, 0x21, 0x23, 0x4D, 0x7D, 0x96, 0x90, 0x67, 0x40, 0x49, 0x77,
-  0xA4, 0xBD, 0xBE, 0x96, 0x6D, 0x6D, 0x94, 0xC6, 0xDD, 0xD0, 0x9F, 0x77,
-  0x6D, 0x8C, 0xBA, 0xCC, 0xB8, 0x88, 0x61, 0x51, 0x65, 0x94, 0xA9, 0x7E,
-  0x46, 0x1B, 0x25, 0x66, 0x99, 0xB4, 0xC1, 0x9E, 0x76, 0x63, 0x69, 0x97,
-  0xAE, 0x97, 0x62, 0x3E, 0x33, 0x4B, 0x7A, 0x93, 0x84, 0x54, 0x2A, 0x20,
-  0x40, 0x74, 0x8E, 0x87, 0x5E, 0x33, 0x2F, 0x54, 0x88, 0xA1, 0x9E, 0x78,
-  0x4C, 0x4A, 0x76, 0xA8, 0xC0, 0xBF, 0x9A, 0x6F, 0x68, 0x8F, 0xC1, 0xD8,
-  0xD0, 0xA6, 0x7A, 0x73, 0x92, 0xC3, 0xDC, 0xCF, 0x9E, 0x73, 0x69, 0x81,
-  0xAD, 0xC5, 0xB6, 0x86, 0x5B, 0x4F, 0x63, 0x8F, 0xA8, 0x9A, 0x74, 0x4C,
-  0x2E, 0x20, 0x2D, 0x52, 0x76, 0x89, 0x8A, 0x78, 0x57, 0x39, 0x2A, 0x37,
-  0x5B, 0x82, 0x9F, 0xB4, 0xB2, 0x8F, 0x70, 0x65, 0x65, 0x7B, 0xA7, 0xCA,
-  0xD5, 0xD1, 0xBC, 0x94, 0x75, 0x67, 0x72, 0x92, 0xB8, 0xC7, 0xC8, 0xB3,
-  0x81, 0x4F, 0x40, 0x38, 0x37, 0x5C, 0x7D, 0x9F, 0xAA, 0x86, 0x65, 0x65,
-  0x68, 0x7D, 0x8F, 0x9E, 0xB1, 0xA8, 0x87, 0x58, 0x38, 0x23, 0x2A, 0x4D,
-  0x78, 0x8F, 0x93, 0x83, 0x5B, 0x35, 0x23, 0x29, 0x47, 0x70, 0x91, 0x9F,
-  0x9A, 0x7D, 0x58, 0x47, 0x45, 0x55, 0x7E, 0xAD, 0xC1, 0xC1, 0xB4, 0x92,
-  0x6F, 0x66, 0x75, 0x93, 0xBA, 0xD5, 0xDB, 0xCC, 0xAB, 0x88, 0x71, 0x71,
-  0x83, 0xA6, 0xC6, 0xCF, 0xC4, 0xA7, 0x81, 0x5D, 0x50, 0x60, 0x7D, 0x99,
-  0xAC, 0xAC, 0x8C, 0x5B, 0x3B, 0x2A, 0x29, 0x42, 0x6B, 0x86, 0x8D, 0x80,
-  0x61, 0x40, 0x2D, 0x2E, 0x49, 0x74, 0x96, 0xA9, 0xB3, 0x9E, 0x74, 0x5F,
-  0x60, 0x6D, 0x91, 0xBC, 0xD3, 0xD4, 0xC5, 0xA3, 0x7C, 0x69, 0x68, 0x82,
-  0xAC, 0xC9, 0xCC, 0xC1, 0x9A, 0x64, 0x3F, 0x40, 0x41, 0x52, 0x7A, 0x8E,
-  0xA5, 0x9C, 0x6E, 0x59, 0x62, 0x70, 0x91, 0xA3, 0xAE, 0xB4, 0x9C, 0x6E,
-  0x43, 0x2E, 0x29, 0x42, 0x6D, 0x8E, 0x96, 0x8D, 0x6F, 0x44, 0x28, 0x24,
-  0x37, 0x60, 0x88, 0x9C, 0x9F, 0x8B, 0x63, 0x44, 0x3F, 0x4B, 0x69, 0x99,
-  0xBC, 0xC1, 0xB6, 0x9B, 0x76, 0x5F, 0x66, 0x82, 0xA8, 0xC9, 0xD9, 0xD3,
-  0xB7, 0x90, 0x73, 0x6C, 0x79, 0x99, 0xBE, 0xD0, 0xCC, 0xB4, 0x8F, 0x6B,
-  0x53, 0x56, 0x73, 0x96, 0xA9, 0xB1, 0xA3, 0x74, 0x48, 0x31, 0x2B, 0x39,
-  0x5F, 0x85, 0x92, 0x8D, 0x71, 0x4B, 0x33, 0x2B, 0x3A, 0x63, 0x8E, 0xA5,
-  0xAE, 0xA9, 0x86, 0x61, 0x5B, 0x67, 0x80, 0xAB, 0xCC, 0xD6, 0xCB, 0xB0,
-  0x88, 0x6D, 0x67, 0x77, 0x9D, 0xC2, 0xCF, 0xC5, 0xAB, 0x78, 0x4A, 0x38,
-  0x46, 0x52, 0x6D, 0x8A, 0x96, 0x9F, 0x7F, 0x54, 0x52, 0x64, 0x80, 0xA6,
-  0xAF, 0xB5, 0xAD, 0x85, 0x51, 0x32, 0x2B, 0x37, 0x5F, 0x87, 0x9A, 0x97,
-  0x81, 0x58, 0x33, 0x25, 0x2E, 0x50, 0x7E, 0x9B, 0xA2, 0x96, 0x75, 0x4C,
-  0x3C, 0x44, 0x5C, 0x85, 0xB0, 0xC2, 0xBB, 0xA5, 0x82, 0x63, 0x5A, 0x6F,
-  0x97, 0xBD, 0xD3, 0xD6, 0xC2, 0x9A, 0x76, 0x66, 0x6C, 0x88, 0xAE, 0xCA,
-  0xCF, 0xBF, 0x9A, 0x73, 0x58, 0x4E, 0x62, 0x88, 0xA6, 0xAF, 0xAC, 0x8C,
-  0x57, 0x37, 0x2D, 0x34, 0x52, 0x7D, 0x96, 0x95, 0x81, 0x5B, 0x3A, 0x2D,
-  0x33, 0x4F, 0x7F, 0xA2, 0xAB, 0xAC, 0x95, 0x6C, 0x53, 0x5C, 0x75, 0x99,
-  0xC1, 0xD5, 0xD3, 0xBB, 0x95, 0x72, 0x64, 0x6D, 0x8D, 0xB7, 0xD1, 0xCD,
-  0xB7, 0x92, 0x61, 0x3F, 0x40, 0x57, 0x69, 0x84, 0x8F, 0x94, 0x8C, 0x63,
-  0x47, 0x58, 0x74, 0x9C, 0xBA, 0xB6, 0xB2, 0x99, 0x67, 0x3B, 0x2B, 0x31,
-  0x4F, 0x7C, 0x9A, 0x9F, 0x90, 0x6C, 0x43, 0x2A, 0x2A, 0x43, 0x6F, 0x97,
-  0xA6, 0xA1, 0x85, 0x5B, 0x3C, 0x3A, 0x4E, 0x72, 0x9E, 0xBD, 0xC0, 0xAC,
-  0x88, 0x66, 0x54, 0x5C, 0x80, 0xAC, 0xCA, 0xD3, 0xC8, 0xA4, 0x7A, 0x61,
-  0x5F, 0x75, 0x9C, 0xBF, 0xCE, 0xC7, 0xA9, 0x7D, 0x5C, 0x4C, 0x53, 0x77,
-  0xA0, 0xB3, 0xB1, 0xA0, 0x71, 0x42, 0x2F, 0x33, 0x49, 0x72, 0x96, 0x9F,
-  0x92, 0x70, 0x47, 0x30, 0x2F, 0x41, 0x6C, 0x99, 0xAD, 0xAB, 0x9C, 0x78,
-  0x53, 0x4C, 0x61, 0x84, 0xAD, 0xCC, 0xD3, 0xC2, 0x9D, 0x76, 0x5E, 0x60,
-  0x78, 0xA3, 0xC6, 0xD2, 0xC3, 0xA1, 0x73, 0x4B, 0x3C, 0x50, 0x71, 0x88,
-  0x9B, 0x99, 0x91, 0x74, 0x4C, 0x42, 0x5D, 0x84, 0xB1, 0xC2, 0xBA, 0xAC,
-  0x81, 0x4F, 0x31, 0x33, 0x48, 0x70, 0x95, 0xA4, 0x9B, 0x7D, 0x55, 0x35,
-  0x2C, 0x3B, 0x60, 0x8B, 0xA4, 0xA5, 0x93, 0x6D, 0x46, 0x33, 0x35, 0x39,
-  0x3A, 0x40, 0x49, 0x4A, 0x4B, 0x54, 0x59, 0x59, 0x5D, 0x64, 0x66, 0x68,
-  0x6B, 0x6E, 0x6E, 0x70, 0x73, 0x74, 0x75, 0x73, 0x72, 0x73, 0x73, 0x70,
-  0x71, 0x71, 0x6D, 0x6A, 0x6C, 0x6A, 0x64, 0x63, 0x65, 0x5E, 0x57, 0x59,
-  0x58, 0x54, 0x54, 0x56, 0x54, 0x54, 0x55, 0x57, 0x5C, 0x5E, 0x5F, 0x64,
-  0x69, 0x6B, 0x6E, 0x79, 0x7E, 0x7D, 0x86, 0x8E, 0x8E, 0x90, 0x94, 0x96,
-  0x95, 0x97, 0x98, 0x98, 0x97, 0x95, 0x94, 0x94, 0x91, 0x8C, 0x8C, 0x8A,
-  0x81, 0x7B, 0x7F, 0x72, 0x63, 0x62, 0x65, 0x78, 0x84, 0x82, 0x8D, 0x9C,
-  0x9F, 0x9D, 0x8C, 0x83, 0x84, 0x7F, 0x79, 0x78, 0x78, 0x73, 0x71, 0x72,
-  0x72, 0x70, 0x71, 0x71, 0x6F, 0x6E, 0x6F, 0x71, 0x74, 0x76, 0x77, 0x79,
-  0x7C, 0x7C, 0x7E, 0x84, 0x86, 0x86, 0x8D, 0x93, 0x92, 0x94, 0x9A, 0x9D,
-  0x9C, 0xA0, 0xA3, 0xA2, 0xA3, 0xA4, 0xA5, 0xA3, 0xA5, 0xA3, 0x9E, 0x9D,
-  0x9B, 0x99, 0x98, 0x97, 0x95, 0x95, 0x94, 0x8F, 0x8C, 0x8C, 0x89, 0x83,
-  0x84, 0x83, 0x7A, 0x77, 0x78, 0x75, 0x72, 0x71, 0x72, 0x70, 0x6F, 0x70,
-  0x72, 0x75, 0x76, 0x77, 0x7C, 0x7F, 0x7F, 0x83, 0x8D, 0x8D, 0x8E, 0x96,
-  0x9B, 0x9A, 0x9B, 0x9E, 0x9F, 0x9E, 0x9F, 0xA0, 0x9F, 0x9D, 0x9A, 0x99,
-  0x98, 0x95, 0x90, 0x91, 0x8D, 0x85, 0x82, 0x84, 0x76, 0x6B, 0x6A, 0x6E,
-  0x80, 0x86, 0x85, 0x91, 0x9B, 0x9B, 0x98, 0x88, 0x84, 0x84, 0x7F, 0x79,
-  0x7A, 0x79, 0x75, 0x73, 0x74, 0x74, 0x72, 0x73, 0x73, 0x72, 0x71, 0x73,
-  0x74, 0x77, 0x77, 0x79, 0x7B, 0x7C, 0x7C, 0x80, 0x84, 0x84, 0x86, 0x8B,
-  0x90, 0x8E, 0x92, 0x97, 0x97, 0x97, 0x9B, 0x9D, 0x9C, 0x9C, 0x9D, 0x9E,
-  0x9D, 0x9E, 0x9E, 0x9D, 0x9C, 0x99, 0x98, 0x97, 0x95, 0x93, 0x93, 0x90,
-  0x8B, 0x8A, 0x89, 0x84, 0x80, 0x80, 0x7E, 0x75, 0x73, 0x73, 0x6F, 0x6D,
-  0x6E, 0x6E, 0x6C, 0x6C, 0x6D, 0x6F, 0x72, 0x72, 0x74, 0x78, 0x7B, 0x7A,
-  0x80, 0x86, 0x86, 0x88, 0x8F, 0x92, 0x91, 0x93, 0x96, 0x96, 0x95, 0x96,
-  0x96, 0x96, 0x94, 0x92, 0x92, 0x91, 0x8D, 0x8B, 0x8B, 0x87, 0x80, 0x7F,
-  0x7E, 0x71, 0x6B, 0x6B, 0x72, 0x7F, 0x80, 0x82, 0x8E, 0x93, 0x94, 0x8E,
-  0x80, 0x7F, 0x7E, 0x79, 0x75, 0x76, 0x74, 0x71, 0x70, 0x71, 0x70, 0x6F,
-  0x70, 0x70, 0x6E, 0x6F, 0x6E, 0x71, 0x73, 0x73, 0x75, 0x77, 0x78, 0x78,
-  0x7C, 0x7F, 0x7F, 0x81, 0x87, 0x89, 0x88, 0x8C, 0x90, 0x90, 0x92, 0x95,
-  0x96, 0x95, 0x96, 0x97, 0x96, 0x96, 0x97, 0x96, 0x97, 0x95, 0x93, 0x92,
-  0x91, 0x8F, 0x8E, 0x8E, 0x8B, 0x87, 0x87, 0x85, 0x80, 0x7E, 0x7F, 0x7B,
-  0x74, 0x74, 0x73, 0x70, 0x6E, 0x6F, 0x6D, 0x6C, 0x6C, 0x6D, 0x70, 0x71,
-  0x71, 0x74, 0x78, 0x79, 0x7A, 0x80, 0x85, 0x84, 0x88, 0x8E, 0x8A, 0x88,
-  0x8A, 0x8B, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8A, 0x8A, 0x88, 0x88, 0x85,
-  0x85, 0x84, 0x80, 0x7D, 0x7D, 0x7A, 0x71, 0x6F, 0x6F, 0x77, 0x7E, 0x7E,
-  0x81, 0x89, 0x8C, 0x8D, 0x86, 0x7F, 0x7F, 0x7D, 0x7A, 0x78, 0x79, 0x76,
-  0x74, 0x75, 0x75, 0x74, 0x73, 0x75, 0x74, 0x73, 0x73, 0x74, 0x75, 0x76,
-  0x77, 0x77, 0x78, 0x79, 0x79, 0x7C, 0x7D, 0x7D, 0x80, 0x83, 0x83, 0x84,
-  0x87, 0x89, 0x88, 0x8A, 0x8C, 0x8D, 0x8C, 0x8D, 0x8E, 0x8D, 0x8D, 0x8E,
-  0x8D, 0x8E, 0x8C, 0x8B, 0x8B, 0x8A, 0x89, 0x88, 0x88, 0x86, 0x84, 0x85,
-  0x83, 0x80, 0x7F, 0x7F, 0x7B, 0x77, 0x78, 0x77, 0x74, 0x73, 0x74, 0x73,
-  0x73, 0x72, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7C, 0x7B, 0x7D, 0x82, 0x84,
-  0x84, 0x87, 0x8B, 0x8B, 0x8C, 0x8E, 0x8E, 0x8D, 0x8E, 0x8E, 0x8E, 0x8D,
-  0x8C, 0x8B, 0x8A, 0x89, 0x86, 0x86, 0x85, 0x80, 0x7D, 0x7E, 0x77, 0x71,
-  0x70, 0x71, 0x77, 0x7C, 0x7B, 0x7E, 0x85, 0x86, 0x85, 0x7F, 0x7C, 0x7D,
-  0x7B, 0x79, 0x78, 0x79, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76,
-  0x75, 0x75, 0x76, 0x78, 0x79, 0x78, 0x7A, 0x7B, 0x7A, 0x7B, 0x7D, 0x7E,
-  0x7E, 0x80, 0x83, 0x82, 0x84, 0x86, 0x87, 0x86, 0x87, 0x89, 0x88, 0x89,
-  0x88, 0x89, 0x88, 0x88, 0x89, 0x88, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84,
-  0x84, 0x83, 0x81, 0x80, 0x81, 0x7F, 0x7D, 0x7C, 0x7C, 0x79, 0x77, 0x78,
-  0x77, 0x75, 0x76, 0x75, 0x74, 0x74, 0x75, 0x76, 0x77, 0x77, 0x78, 0x7B,
-  0x7D, 0x7D, 0x7F, 0x83, 0x83, 0x83, 0x87, 0x89, 0x88, 0x89, 0x8A, 0x8B,
-  0x8A, 0x8B, 0x8A, 0x8B, 0x8A, 0x89, 0x88, 0x87, 0x87, 0x85, 0x85, 0x84,
-  0x80, 0x7E, 0x7F, 0x79, 0x75, 0x74, 0x76, 0x7D, 0x7F, 0x80, 0x84, 0x88,
-  0x89, 0x87, 0x80, 0x7E, 0x7F, 0x7C, 0x7A, 0x7A, 0x7A, 0x78, 0x77, 0x78,
-  0x78, 0x77, 0x78, 0x78, 0x77, 0x78, 0x77, 0x78, 0x79, 0x79, 0x7A, 0x7A,
-  0x7B, 0x7A, 0x7B, 0x7D, 0x7C, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x82, 0x82,
-  0x81, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x84, 0x83,
-  0x84, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x7F, 0x7E,
-  0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x7A, 0x79, 0x7A, 0x79, 0x79, 0x78, 0x79,
-  0x79, 0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7C, 0x7E, 0x80, 0x7F, 0x80, 0x82,
-  0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83,
-  0x84, 0x83, 0x83, 0x83, 0x81, 0x81, 0x80, 0x80, 0x7D, 0x7B, 0x7B, 0x7C,
-  0x80, 0x81, 0x80, 0x83, 0x85, 0x85, 0x84, 0x80, 0x81, 0x80, 0x7F, 0x7D,
-  0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B,
-  0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x80, 0x81, 0x82, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7E, 0x7F, 0x7E, 0x7F, 0x7C, 0x7E,
-  0x8D, 0xAA, 0xCB, 0xDF, 0xE5, 0xDC, 0xC6, 0xA2, 0x83, 0x70, 0x6D, 0x7C,
-  0x94, 0xB3, 0xC8, 0xD0, 0xC9, 0xB6, 0x97, 0x79, 0x65, 0x60, 0x6E, 0x87,
-  0xAA, 0xC2, 0xCD, 0xC7, 0xB5, 0x95, 0x73, 0x5D, 0x55, 0x61, 0x7A, 0xA0,
-  0xBB, 0xC8, 0xC4, 0xB1, 0x92, 0x6E, 0x55, 0x4B, 0x57, 0x70, 0x95, 0xB3,
-  0xC2, 0xC1, 0xB0, 0x91, 0x6B, 0x52, 0x45, 0x4E, 0x65, 0x89, 0xA8, 0xBA,
-  0xBB, 0xAD, 0x8F, 0x68, 0x4E, 0x3F, 0x48, 0x5D, 0x80, 0xA3, 0xB6, 0xB8,
-  0xAB, 0x8F, 0x69, 0x4E, 0x3D, 0x43, 0x57, 0x7A, 0x9D, 0xB2, 0xB7, 0xAB,
-  0x92, 0x6C, 0x4E, 0x3E, 0x41, 0x54, 0x76, 0x9A, 0xAF, 0xB8, 0xAD, 0x96,
-  0x70, 0x50, 0x3E, 0x3E, 0x50, 0x6F, 0x95, 0xAC, 0xB6, 0xAD, 0x99, 0x73,
-  0x52, 0x3F, 0x3B, 0x4D, 0x6B, 0x90, 0xA9, 0xB5, 0xAE, 0x9B, 0x76, 0x54,
-  0x3F, 0x3A, 0x49, 0x64, 0x8A, 0xA7, 0xB3, 0xAF, 0x9C, 0x79, 0x56, 0x41,
-  0x39, 0x47, 0x60, 0x87, 0xA4, 0xB4, 0xB3, 0xA0, 0x80, 0x5A, 0x42, 0x38,
-  0x43, 0x5C, 0x83, 0xA1, 0xB3, 0xB3, 0xA3, 0x85, 0x5E, 0x44, 0x39, 0x42,
-  0x5A, 0x80, 0xA0, 0xB3, 0xB5, 0xA6, 0x8A, 0x63, 0x48, 0x39, 0x40, 0x57,
-  0x7A, 0x9D, 0xB1, 0xB5, 0xA8, 0x8D, 0x66, 0x4A, 0x3A, 0x3F, 0x53, 0x75,
-  0x9A, 0xAF, 0xB5, 0xAB, 0x91, 0x6B, 0x4D, 0x39, 0x3D, 0x4F, 0x70, 0x96,
-  0xAB, 0xB5, 0xAB, 0x94, 0x6F, 0x4E, 0x3B, 0x3A, 0x4C, 0x6C, 0x92, 0xAA,
-  0xB5, 0xAD, 0x98, 0x73, 0x51, 0x3E, 0x3A, 0x4A, 0x68, 0x8F, 0xA9, 0xB6,
-  0xB0, 0x9C, 0x79, 0x56, 0x41, 0x3A, 0x4A, 0x65, 0x8C, 0xAA, 0xB7, 0xB3,
-  0xA2, 0x7F, 0x5A, 0x44, 0x3B, 0x49, 0x62, 0x89, 0xA7, 0xB6, 0xB5, 0xA5,
-  0x83, 0x5E, 0x46, 0x3B, 0x46, 0x5F, 0x85, 0xA5, 0xB6, 0xB7, 0xA7, 0x89,
-  0x63, 0x48, 0x3C, 0x44, 0x5B, 0x81, 0xA1, 0xB4, 0xB7, 0xA8, 0x8D, 0x67,
-  0x4B, 0x3C, 0x42, 0x58, 0x7D, 0xA0, 0xB4, 0xBA, 0xAC, 0x92, 0x6B, 0x4E,
-  0x3D, 0x40, 0x55, 0x77, 0x9C, 0xB3, 0xB9, 0xAF, 0x97, 0x6F, 0x51, 0x3E,
-  0x3F, 0x53, 0x74, 0x9A, 0xB2, 0xBB, 0xB2, 0x9B, 0x74, 0x54, 0x40, 0x3F,
-  0x51, 0x6F, 0x97, 0xAF, 0xBB, 0xB5, 0x9F, 0x7A, 0x57, 0x42, 0x3E, 0x4D,
-  0x6B, 0x93, 0xAD, 0xBB, 0xB6, 0xA2, 0x7F, 0x5A, 0x43, 0x3C, 0x4A, 0x65,
-  0x8C, 0xA9, 0xB9, 0xB5, 0xA3, 0x81, 0x5B, 0x44, 0x3B, 0x47, 0x61, 0x88,
-  0xA8, 0xB8, 0xB7, 0xA7, 0x87, 0x60, 0x47, 0x3B, 0x46, 0x5E, 0x84, 0xA6,
-  0xB7, 0xB9, 0xAA, 0x8C, 0x65, 0x4A, 0x3C, 0x45, 0x5D, 0x83, 0xA5, 0xB8,
-  0xBC, 0xAE, 0x93, 0x6B, 0x4E, 0x3F, 0x44, 0x59, 0x7E, 0xA2, 0xB6, 0xBC,
-  0xAF, 0x96, 0x6F, 0x50, 0x3F, 0x42, 0x57, 0x78, 0x9E, 0xB5, 0xBD, 0xB2,
-  0x9A, 0x73, 0x53, 0x40, 0x40, 0x54, 0x73, 0x99, 0xB2, 0xBC, 0xB4, 0x9E,
-  0x78, 0x56, 0x42, 0x3F, 0x51, 0x70, 0x97, 0xB2, 0xBE, 0xB8, 0xA3, 0x7D,
-  0x5A, 0x44, 0x3E, 0x4E, 0x6B, 0x93, 0xAF, 0xBD, 0xB9, 0xA4, 0x83, 0x5D,
-  0x45, 0x3E, 0x4B, 0x67, 0x8F, 0xAD, 0xBD, 0xBB, 0xA8, 0x87, 0x61, 0x48,
-  0x3E, 0x49, 0x64, 0x8A, 0xAA, 0xBC, 0xBC, 0xAB, 0x8B, 0x64, 0x4A, 0x3D,
-  0x47, 0x60, 0x85, 0xA8, 0xBA, 0xBD, 0xAE, 0x90, 0x68, 0x4C, 0x3C, 0x44,
-  0x5B, 0x7F, 0xA3, 0xB7, 0xBC, 0xAE, 0x92, 0x6B, 0x4D, 0x3D, 0x42, 0x57,
-  0x7A, 0xA0, 0xB6, 0xBD, 0xB0, 0x97, 0x70, 0x4F, 0x3E, 0x40, 0x54, 0x76,
-  0x9C, 0xB4, 0xBE, 0xB3, 0x9B, 0x75, 0x53, 0x40, 0x40, 0x53, 0x74, 0x9A,
-  0xB4, 0xBF, 0xB6, 0xA1, 0x7A, 0x58, 0x43, 0x3F, 0x50, 0x6E, 0x96, 0xB2,
-  0xBE, 0xB8, 0xA3, 0x7F, 0x5B, 0x44, 0x3E, 0x4E, 0x6A, 0x92, 0xAF, 0xBD,
-  0xBA, 0xA6, 0x84, 0x5E, 0x46, 0x3D, 0x4B, 0x66, 0x8D, 0xAC, 0xBB, 0xBB,
-  0xAA, 0x8A, 0x62, 0x48, 0x3D, 0x48, 0x62, 0x89, 0xA9, 0xBD, 0xBE, 0xAC,
-  0x8D, 0x66, 0x4A, 0x3D, 0x46, 0x5F, 0x84, 0xA6, 0xBB, 0xBD, 0xAF, 0x92,
-  0x6A, 0x4D, 0x3D, 0x44, 0x5B, 0x80, 0xA4, 0xBA, 0xBF, 0xB2, 0x96, 0x6F,
-  0x50, 0x3E, 0x43, 0x58, 0x7B, 0xA1, 0xB8, 0xBF, 0xB4, 0x9A, 0x73, 0x53,
-  0x40, 0x41, 0x54, 0x76, 0x9D, 0xB5, 0xC0, 0xB6, 0x9E, 0x77, 0x55, 0x40,
-  0x3E, 0x50, 0x70, 0x97, 0xB1, 0xBE, 0xB5, 0x9F, 0x7A, 0x56, 0x41, 0x3D,
-  0x4D, 0x6C, 0x93, 0xAF, 0xBD, 0xB8, 0xA3, 0x7F, 0x5B, 0x43, 0x3C, 0x4B,
-  0x67, 0x8F, 0xAE, 0xBD, 0xBA, 0xA7, 0x84, 0x5E, 0x46, 0x3D, 0x4B, 0x65,
-  0x8D, 0xAD, 0xBE, 0xBD, 0xAB, 0x8B, 0x64, 0x4A, 0x3D, 0x48, 0x61, 0x88,
-  0xA9, 0xBC, 0xBE, 0xAD, 0x8F, 0x67, 0x4B, 0x3D, 0x45, 0x5E, 0x84, 0xA6,
-  0xBB, 0xBE, 0xB0, 0x93, 0x6B, 0x4E, 0x3E, 0x44, 0x5A, 0x7F, 0xA2, 0xB9,
-  0xC0, 0xB3, 0x98, 0x70, 0x51, 0x3E, 0x42, 0x57, 0x79, 0x9F, 0xB8, 0xC0,
-  0xB5, 0x9B, 0x74, 0x54, 0x3F, 0x40, 0x54, 0x74, 0x9C, 0xB5, 0xBF, 0xB7,
-  0x9F, 0x79, 0x56, 0x42, 0x40, 0x51, 0x72, 0x99, 0xB3, 0xC1, 0xB9, 0xA3,
-  0x7E, 0x59, 0x43, 0x3F, 0x4E, 0x6D, 0x95, 0xB1, 0xC0, 0xBA, 0xA7, 0x83,
-  0x5E, 0x46, 0x3D, 0x4C, 0x68, 0x90, 0xAE, 0xBF, 0xBB, 0xA9, 0x87, 0x61,
-  0x46, 0x3B, 0x48, 0x62, 0x89, 0xAA, 0xBC, 0xBC, 0xAB, 0x89, 0x63, 0x48,
-  0x3B, 0x46, 0x5E, 0x84, 0xA7, 0xBA, 0xBD, 0xAC, 0x8E, 0x67, 0x4A, 0x3C,
-  0x44, 0x5B, 0x81, 0xA4, 0xB9, 0xBF, 0xB0, 0x94, 0x6C, 0x4D, 0x3E, 0x42,
-  0x59, 0x7E, 0xA2, 0xB9, 0xC0, 0xB4, 0x99, 0x71, 0x52, 0x3F, 0x42, 0x57,
-  0x79, 0x9F, 0xB7, 0xBF, 0xB6, 0x9D, 0x75, 0x55, 0x40, 0x40, 0x53, 0x73,
-  0x9B, 0xB5, 0xC0, 0xB8, 0xA0, 0x79, 0x58, 0x42, 0x3F, 0x50, 0x6E, 0x96,
-  0xB3, 0xC1, 0xBA, 0xA4, 0x7F, 0x5B, 0x44, 0x3E, 0x4D, 0x6A, 0x93, 0xB0,
-  0xC0, 0xBB, 0xA7, 0x84, 0x5D, 0x45, 0x3D, 0x4A, 0x66, 0x8E, 0xAD, 0xBE,
-  0xBC, 0xAA, 0x89, 0x62, 0x48, 0x3C, 0x48, 0x63, 0x8A, 0xAB, 0xBE, 0xBE,
-  0xAE, 0x8E, 0x65, 0x4B, 0x3C, 0x47, 0x5F, 0x85, 0xA8, 0xBB, 0xBF, 0xB0,
-  0x91, 0x6A, 0x4D, 0x3C, 0x44, 0x5B, 0x81, 0xA5, 0xBA, 0xC0, 0xB2, 0x96,
-  0x6E, 0x4F, 0x3D, 0x41, 0x56, 0x7A, 0x9F, 0xB6, 0xBE, 0xB2, 0x99, 0x71,
-  0x51, 0x3D, 0x3F, 0x53, 0x76, 0x9C, 0xB4, 0xBF, 0xB5, 0x9D, 0x76, 0x54,
-  0x3F, 0x3E, 0x50, 0x70, 0x98, 0xB3, 0xBE, 0xB8, 0xA1, 0x7A, 0x57, 0x41,
-  0x3D, 0x50, 0x6E, 0x96, 0xB2, 0xC0, 0xBB, 0xA5, 0x80, 0x5C, 0x44, 0x3D,
-  0x4E, 0x69, 0x92, 0xAF, 0xBF, 0xBC, 0xA8, 0x86, 0x60, 0x46, 0x3D, 0x4A,
-  0x65, 0x8D, 0xAC, 0xBE, 0xBC, 0xAB, 0x8A, 0x63, 0x49, 0x3D, 0x48, 0x62,
-  0x8A, 0xAC, 0xC1, 0xC2, 0xB1, 0x91, 0x68, 0x4C, 0x3D, 0x45, 0x5E, 0x84,
-  0xA8, 0xBD, 0xC1, 0xB2, 0x95, 0x6C, 0x4F, 0x3D, 0x43, 0x59, 0x7E, 0xA4,
-  0xBB, 0xC1, 0xB4, 0x99, 0x70, 0x51, 0x3D, 0x42, 0x57, 0x7B, 0xA2, 0xB8,
-  0xC2, 0xB6, 0x9D, 0x76, 0x53, 0x3F, 0x40, 0x53, 0x75, 0x9D, 0xB6, 0xC2,
-  0xB8, 0xA0, 0x7A, 0x56, 0x41, 0x3E, 0x50, 0x71, 0x99, 0xB4, 0xC1, 0xB9,
-  0xA4, 0x7E, 0x59, 0x42, 0x3B, 0x4C, 0x6A, 0x92, 0xAF, 0xBE, 0xB9, 0xA5,
-  0x81, 0x5B, 0x42, 0x3A, 0x49, 0x65, 0x8E, 0xAD, 0xBD, 0xBB, 0xA9, 0x85,
-  0x5F, 0x45, 0x3A, 0x47, 0x61, 0x8A, 0xAB, 0xBD, 0xBD, 0xAB, 0x8B, 0x64,
-  0x47, 0x3C, 0x46, 0x60, 0x87, 0xA9, 0xBD, 0xBF, 0xAF, 0x91, 0x68, 0x4B,
-  0x3C, 0x44, 0x5C, 0x82, 0xA5, 0xBB, 0xC0, 0xB1, 0x95, 0x6C, 0x50, 0x3E,
-  0x44, 0x59, 0x7C, 0xA1, 0xB9, 0xC0, 0xB6, 0x99, 0x70, 0x4F, 0x3B, 0x3D,
-  0x42, 0x41, 0x47, 0x4C, 0x4F, 0x60, 0x61, 0x79, 0x83, 0x90, 0xA3, 0xA5,
-  0xAF, 0xAF, 0xB2, 0xB4, 0xAF, 0xAA, 0xA7, 0x9A, 0x98, 0x84, 0x78, 0x67,
-  0x3D, 0x44, 0x6D, 0x7B, 0x95, 0xB5, 0x9D, 0x7E, 0x77, 0x66, 0x61, 0x59,
-  0x50, 0x51, 0x4C, 0x4D, 0x48, 0x48, 0x4F, 0x54, 0x57, 0x5E, 0x60, 0x6E,
-  0x72, 0x81, 0x8C, 0x92, 0xA1, 0xA1, 0xAE, 0xB0, 0xB3, 0xB5, 0xB6, 0xB9,
-  0xB7, 0xB1, 0xAE, 0xA9, 0xA2, 0x9E, 0x8F, 0x8E, 0x7C, 0x79, 0x69, 0x58,
-  0x55, 0x49, 0x49, 0x44, 0x42, 0x48, 0x4F, 0x54, 0x63, 0x65, 0x7E, 0x85,
-  0x95, 0xA6, 0xA8, 0xB2, 0xB2, 0xB5, 0xB7, 0xB1, 0xAD, 0xA8, 0x9D, 0x9A,
-  0x83, 0x7A, 0x64, 0x3C, 0x4E, 0x74, 0x81, 0x9F, 0xB9, 0x9E, 0x80, 0x78,
-  0x67, 0x63, 0x59, 0x53, 0x52, 0x4D, 0x4F, 0x49, 0x4A, 0x50, 0x56, 0x59,
-  0x5F, 0x62, 0x71, 0x73, 0x83, 0x8D, 0x94, 0xA3, 0xA3, 0xB1, 0xB0, 0xB5,
-  0xB3, 0xB3, 0xB5, 0xB3, 0xAD, 0xAA, 0xA4, 0xA0, 0x9B, 0x8E, 0x8D, 0x7B,
-  0x7A, 0x65, 0x5B, 0x56, 0x4C, 0x4C, 0x47, 0x46, 0x4C, 0x51, 0x57, 0x65,
-  0x67, 0x80, 0x86, 0x96, 0xA4, 0xA7, 0xB0, 0xB0, 0xB4, 0xB5, 0xAF, 0xAD,
-  0xA6, 0x9C, 0x98, 0x83, 0x7B, 0x62, 0x3F, 0x52, 0x75, 0x81, 0xA0, 0xB5,
-  0x96, 0x7E, 0x76, 0x67, 0x63, 0x59, 0x55, 0x53, 0x50, 0x50, 0x4B, 0x4C,
-  0x52, 0x57, 0x5B, 0x61, 0x64, 0x72, 0x73, 0x83, 0x8B, 0x92, 0x9F, 0xA0,
-  0xAC, 0xAC, 0xB1, 0xB1, 0xB3, 0xB5, 0xB3, 0xAC, 0xAB, 0xA4, 0xA1, 0x99,
-  0x8E, 0x8B, 0x7A, 0x7A, 0x65, 0x5C, 0x55, 0x4C, 0x4C, 0x47, 0x47, 0x4E,
-  0x52, 0x5A, 0x66, 0x6A, 0x83, 0x87, 0x9A, 0xA6, 0xA9, 0xB2, 0xB2, 0xB5,
-  0xB7, 0xB0, 0xAD, 0xA6, 0x9C, 0x97, 0x82, 0x7B, 0x5F, 0x3F, 0x55, 0x77,
-  0x83, 0xA3, 0xB4, 0x93, 0x7E, 0x75, 0x65, 0x63, 0x58, 0x55, 0x52, 0x50,
-  0x50, 0x4B, 0x4D, 0x54, 0x57, 0x5B, 0x60, 0x65, 0x71, 0x74, 0x85, 0x89,
-  0x92, 0x9E, 0x9F, 0xAB, 0xAA, 0xAF, 0xAE, 0xB1, 0xB2, 0xB0, 0xAA, 0xA8,
-  0xA2, 0xA0, 0x98, 0x8D, 0x8A, 0x7A, 0x79, 0x64, 0x5D, 0x56, 0x4E, 0x4E,
-  0x4A, 0x4A, 0x52, 0x54, 0x5D, 0x68, 0x6D, 0x84, 0x87, 0x9B, 0xA3, 0xA8,
-  0xAF, 0xAF, 0xB2, 0xB2, 0xAC, 0xAA, 0xA1, 0x9A, 0x95, 0x80, 0x7A, 0x5D,
-  0x41, 0x59, 0x77, 0x83, 0xA3, 0xB0, 0x90, 0x7C, 0x73, 0x64, 0x62, 0x57,
-  0x54, 0x52, 0x50, 0x50, 0x4B, 0x4D, 0x54, 0x57, 0x5C, 0x60, 0x66, 0x72,
-  0x74, 0x86, 0x89, 0x95, 0x9D, 0xA1, 0xAB, 0xAB, 0xB0, 0xAE, 0xB2, 0xB3,
-  0xB0, 0xAA, 0xA9, 0xA1, 0xA0, 0x96, 0x8F, 0x8B, 0x7C, 0x7A, 0x64, 0x5F,
-  0x57, 0x50, 0x4F, 0x4B, 0x4B, 0x53, 0x55, 0x5F, 0x68, 0x6F, 0x85, 0x88,
-  0x9C, 0xA4, 0xA9, 0xB0, 0xAF, 0xB3, 0xB2, 0xAC, 0xAA, 0xA1, 0x9A, 0x92,
-  0x7D, 0x75, 0x57, 0x43, 0x5F, 0x76, 0x83, 0xA1, 0xA8, 0x8A, 0x7A, 0x72,
-  0x64, 0x63, 0x58, 0x57, 0x54, 0x53, 0x52, 0x4E, 0x50, 0x57, 0x59, 0x5E,
-  0x62, 0x67, 0x72, 0x75, 0x85, 0x88, 0x94, 0x9A, 0x9F, 0xA8, 0xA7, 0xAC,
-  0xAB, 0xAE, 0xAF, 0xAD, 0xA7, 0xA5, 0x9F, 0x9E, 0x93, 0x8D, 0x86, 0x7A,
-  0x78, 0x63, 0x61, 0x58, 0x52, 0x51, 0x4D, 0x4E, 0x56, 0x57, 0x62, 0x69,
-  0x71, 0x84, 0x87, 0x9A, 0xA0, 0xA7, 0xAB, 0xAC, 0xAE, 0xAC, 0xA6, 0xA5,
-  0x9B, 0x96, 0x8D, 0x7B, 0x76, 0x56, 0x45, 0x62, 0x79, 0x86, 0xA5, 0xA6,
-  0x87, 0x7A, 0x70, 0x65, 0x63, 0x58, 0x59, 0x55, 0x55, 0x53, 0x50, 0x52,
-  0x58, 0x5B, 0x61, 0x64, 0x6B, 0x74, 0x78, 0x89, 0x8B, 0x98, 0x9D, 0xA2,
-  0xAA, 0xAA, 0xAF, 0xAD, 0xB0, 0xB0, 0xAD, 0xA8, 0xA7, 0x9F, 0x9F, 0x93,
-  0x8F, 0x86, 0x7C, 0x77, 0x64, 0x61, 0x57, 0x53, 0x51, 0x4E, 0x50, 0x57,
-  0x59, 0x64, 0x69, 0x74, 0x84, 0x86, 0x99, 0x9D, 0xA3, 0xA7, 0xA8, 0xAB,
-  0xAA, 0xA4, 0xA2, 0x99, 0x95, 0x8C, 0x7C, 0x75, 0x56, 0x49, 0x66, 0x7A,
-  0x87, 0xA5, 0xA3, 0x85, 0x7B, 0x70, 0x67, 0x64, 0x5B, 0x5B, 0x57, 0x57,
-  0x55, 0x53, 0x56, 0x5C, 0x5F, 0x64, 0x66, 0x6F, 0x76, 0x7B, 0x89, 0x8A,
-  0x97, 0x9A, 0xA1, 0xA7, 0xA7, 0xAB, 0xAA, 0xAD, 0xAD, 0xAA, 0xA5, 0xA3,
-  0x9D, 0x9C, 0x91, 0x8E, 0x84, 0x7B, 0x76, 0x64, 0x62, 0x58, 0x54, 0x52,
-  0x4F, 0x51, 0x58, 0x59, 0x66, 0x69, 0x75, 0x83, 0x89, 0x9B, 0x9D, 0xA5,
-  0xA7, 0xA8, 0xAB, 0xA9, 0xA3, 0xA3, 0x99, 0x95, 0x8A, 0x7C, 0x74, 0x54,
-  0x4A, 0x69, 0x7B, 0x8A, 0xA7, 0xA1, 0x84, 0x7B, 0x70, 0x68, 0x66, 0x5C,
-  0x5D, 0x59, 0x59, 0x56, 0x54, 0x58, 0x5D, 0x5F, 0x65, 0x67, 0x70, 0x76,
-  0x7D, 0x8A, 0x8B, 0x99, 0x9A, 0xA3, 0xA7, 0xA9, 0xAC, 0xAB, 0xAD, 0xAE,
-  0xA9, 0xA1, 0x9F, 0x98, 0x98, 0x8C, 0x8A, 0x81, 0x7A, 0x73, 0x63, 0x62,
-  0x59, 0x56, 0x54, 0x51, 0x54, 0x5A, 0x5B, 0x67, 0x6A, 0x77, 0x83, 0x88,
-  0x99, 0x9B, 0xA2, 0xA4, 0xA6, 0xA8, 0xA5, 0xA1, 0x9F, 0x96, 0x94, 0x87,
-  0x7B, 0x71, 0x53, 0x52, 0x6F, 0x7D, 0x8E, 0xA6, 0x9D, 0x83, 0x7B, 0x70,
-  0x6A, 0x66, 0x5E, 0x5E, 0x5A, 0x5B, 0x57, 0x56, 0x5A, 0x5F, 0x61, 0x67,
-  0x68, 0x71, 0x76, 0x7C, 0x89, 0x8A, 0x97, 0x98, 0xA0, 0xA3, 0xA5, 0xA6,
-  0xA6, 0xA9, 0xA8, 0xA4, 0xA0, 0x9E, 0x98, 0x97, 0x8B, 0x8B, 0x7F, 0x7A,
-  0x71, 0x63, 0x62, 0x59, 0x57, 0x54, 0x52, 0x55, 0x5B, 0x5D, 0x69, 0x6A,
-  0x7A, 0x83, 0x8B, 0x9B, 0x9C, 0xA4, 0xA5, 0xA7, 0xA9, 0xA6, 0xA2, 0xA1,
-  0x98, 0x95, 0x87, 0x7E, 0x72, 0x53, 0x55, 0x71, 0x7F, 0x90, 0xA9, 0x9A,
-  0x82, 0x7C, 0x6F, 0x6A, 0x65, 0x5F, 0x5E, 0x5B, 0x5C, 0x58, 0x57, 0x5B,
-  0x60, 0x62, 0x67, 0x69, 0x72, 0x75, 0x7D, 0x87, 0x89, 0x95, 0x95, 0x9E,
-  0x9F, 0xA2, 0xA3, 0xA3, 0xA6, 0xA5, 0xA1, 0x9E, 0x9C, 0x97, 0x95, 0x8B,
-  0x89, 0x7E, 0x7B, 0x71, 0x65, 0x63, 0x5B, 0x5A, 0x57, 0x56, 0x5A, 0x5E,
-  0x61, 0x6B, 0x6D, 0x7D, 0x84, 0x8C, 0x9A, 0x9C, 0xA3, 0xA3, 0xA4, 0xA7,
-  0xA3, 0xA0, 0x9E, 0x95, 0x93, 0x85, 0x7D, 0x70, 0x55, 0x59, 0x73, 0x7E,
-  0x91, 0xA5, 0x96, 0x81, 0x7B, 0x6F, 0x6B, 0x66, 0x60, 0x61, 0x5D, 0x5D,
-  0x59, 0x58, 0x5D, 0x60, 0x62, 0x67, 0x69, 0x73, 0x75, 0x7F, 0x87, 0x89,
-  0x95, 0x95, 0x9D, 0x9F, 0xA2, 0xA3, 0xA3, 0xA6, 0xA5, 0xA1, 0x9F, 0x9B,
-  0x97, 0x95, 0x8A, 0x8A, 0x7E, 0x7B, 0x70, 0x66, 0x63, 0x5B, 0x5B, 0x58,
-  0x58, 0x5C, 0x60, 0x63, 0x6E, 0x6F, 0x80, 0x85, 0x90, 0x9B, 0x9C, 0xA4,
-  0xA4, 0xA6, 0xA7, 0xA3, 0xA0, 0x9D, 0x94, 0x93, 0x84, 0x7D, 0x6F, 0x53,
-  0x5B, 0x72, 0x79, 0x89, 0x98, 0x8B, 0x7C, 0x77, 0x6D, 0x6B, 0x66, 0x62,
-  0x62, 0x5F, 0x60, 0x5D, 0x5E, 0x61, 0x64, 0x66, 0x69, 0x6C, 0x73, 0x75,
-  0x7E, 0x83, 0x87, 0x8F, 0x90, 0x97, 0x97, 0x99, 0x9A, 0x9B, 0x9C, 0x9C,
-  0x98, 0x97, 0x94, 0x91, 0x8F, 0x87, 0x87, 0x7E, 0x7C, 0x72, 0x6B, 0x68,
-  0x62, 0x61, 0x5F, 0x5E, 0x62, 0x64, 0x68, 0x70, 0x72, 0x80, 0x83, 0x8D,
-  0x95, 0x96, 0x9C, 0x9C, 0x9E, 0x9E, 0x9B, 0x99, 0x96, 0x90, 0x8E, 0x82,
-  0x7D, 0x6E, 0x5A, 0x64, 0x78, 0x7F, 0x90, 0x9C, 0x8D, 0x7E, 0x79, 0x70,
-  0x6E, 0x68, 0x65, 0x65, 0x62, 0x63, 0x5F, 0x60, 0x64, 0x67, 0x69, 0x6C,
-  0x6E, 0x77, 0x78, 0x81, 0x86, 0x8A, 0x92, 0x92, 0x99, 0x9A, 0x9D, 0x9D,
-  0x9E, 0xA0, 0xA0, 0x9B, 0x9B, 0x97, 0x95, 0x90, 0x8B, 0x88, 0x7F, 0x7D,
-  0x72, 0x6C, 0x6A, 0x66, 0x68, 0x66, 0x67, 0x6B, 0x6C, 0x6F, 0x74, 0x77,
-  0x80, 0x8B, 0x9F, 0xC3, 0xD9, 0xE1, 0xE9, 0xEE, 0xE5, 0xD8, 0xC8, 0xB3,
-  0xA1, 0x94, 0x8B, 0x8B, 0x95, 0x9E, 0xAA, 0xB6, 0xC3, 0xBD, 0xB3, 0xAB,
-  0xA2, 0x72, 0x49, 0x37, 0x34, 0x52, 0x61, 0x6B, 0x87, 0xB7, 0xCB, 0xD8,
-  0xC8, 0xB2, 0xAB, 0x99, 0x77, 0x56, 0x4A, 0x3B, 0x30, 0x35, 0x45, 0x54,
-  0x6B, 0x7E, 0x8B, 0x8D, 0x89, 0x7F, 0x71, 0x5D, 0x48, 0x37, 0x2F, 0x31,
-  0x39, 0x47, 0x68, 0x8F, 0xA1, 0xAF, 0xBF, 0xC0, 0xB1, 0xA5, 0x97, 0x83,
-  0x73, 0x6F, 0x76, 0x7F, 0x8C, 0xA7, 0xC3, 0xD2, 0xDC, 0xE2, 0xDD, 0xD1,
-  0xBA, 0x98, 0x80, 0x71, 0x65, 0x62, 0x6D, 0x79, 0x86, 0x96, 0xA6, 0xAB,
-  0xA3, 0x9A, 0x90, 0x70, 0x46, 0x33, 0x26, 0x19, 0x16, 0x25, 0x34, 0x4A,
-  0x62, 0x72, 0x7E, 0x85, 0x80, 0x74, 0x6B, 0x5B, 0x4A, 0x40, 0x4A, 0x55,
-  0x5E, 0x76, 0xA3, 0xBF, 0xCC, 0xD9, 0xDE, 0xD3, 0xC4, 0xAF, 0x94, 0x80,
-  0x74, 0x69, 0x6A, 0x77, 0x82, 0x94, 0xA5, 0xB2, 0xAC, 0x9F, 0x97, 0x87,
-  0x4E, 0x29, 0x1A, 0x1C, 0x3D, 0x4B, 0x57, 0x7A, 0xA8, 0xB8, 0xC4, 0xB1,
-  0x9F, 0x97, 0x85, 0x64, 0x49, 0x3F, 0x2F, 0x27, 0x2C, 0x3B, 0x4C, 0x63,
-  0x75, 0x82, 0x82, 0x7E, 0x75, 0x67, 0x54, 0x41, 0x33, 0x2C, 0x2E, 0x36,
-  0x45, 0x65, 0x8A, 0x9C, 0xAA, 0xB9, 0xB8, 0xA9, 0x9D, 0x8F, 0x7B, 0x6B,
-  0x69, 0x70, 0x7A, 0x8B, 0xA7, 0xC3, 0xD2, 0xDC, 0xE2, 0xDC, 0xCE, 0xB6,
-  0x93, 0x7B, 0x6C, 0x61, 0x61, 0x6D, 0x79, 0x86, 0x98, 0xA8, 0xAA, 0xA3,
-  0x9B, 0x8F, 0x6D, 0x44, 0x32, 0x25, 0x17, 0x19, 0x27, 0x38, 0x50, 0x67,
-  0x77, 0x83, 0x88, 0x81, 0x75, 0x6A, 0x5A, 0x48, 0x41, 0x4B, 0x56, 0x5F,
-  0x7B, 0xA8, 0xC1, 0xCE, 0xDB, 0xDF, 0xD3, 0xC3, 0xAB, 0x92, 0x80, 0x73,
-  0x6B, 0x6F, 0x7D, 0x8A, 0x9B, 0xAC, 0xB7, 0xB0, 0xA3, 0x9A, 0x87, 0x4C,
-  0x2C, 0x1C, 0x23, 0x41, 0x4F, 0x5C, 0x83, 0xAE, 0xBD, 0xC9, 0xB4, 0xA4,
-  0x9A, 0x86, 0x64, 0x4B, 0x3F, 0x30, 0x29, 0x30, 0x41, 0x52, 0x6B, 0x7D,
-  0x88, 0x89, 0x84, 0x78, 0x6A, 0x56, 0x41, 0x33, 0x2D, 0x30, 0x3A, 0x4A,
-  0x6E, 0x91, 0xA2, 0xAF, 0xBC, 0xB9, 0xAB, 0x9F, 0x8E, 0x7A, 0x6C, 0x6B,
-  0x72, 0x7D, 0x8E, 0xAC, 0xC6, 0xD3, 0xDE, 0xE2, 0xDA, 0xCD, 0xB2, 0x90,
-  0x7B, 0x6D, 0x63, 0x64, 0x70, 0x7E, 0x8C, 0x9E, 0xAE, 0xB0, 0xA8, 0xA0,
-  0x93, 0x6D, 0x45, 0x35, 0x27, 0x1A, 0x1C, 0x2C, 0x3E, 0x58, 0x6E, 0x7D,
-  0x89, 0x8D, 0x84, 0x78, 0x6B, 0x5A, 0x47, 0x42, 0x4D, 0x57, 0x62, 0x80,
-  0xAD, 0xC3, 0xD1, 0xDC, 0xDE, 0xD1, 0xBF, 0xA8, 0x8E, 0x7C, 0x71, 0x69,
-  0x70, 0x7E, 0x8C, 0x9E, 0xB0, 0xBA, 0xB1, 0xA6, 0x9E, 0x86, 0x4B, 0x2F,
-  0x1E, 0x2C, 0x48, 0x53, 0x62, 0x8B, 0xB4, 0xC3, 0xCB, 0xB3, 0xA7, 0x9C,
-  0x86, 0x62, 0x4B, 0x3E, 0x2F, 0x2A, 0x35, 0x45, 0x59, 0x72, 0x83, 0x8F,
-  0x8E, 0x89, 0x7C, 0x6C, 0x56, 0x42, 0x33, 0x2D, 0x31, 0x3C, 0x4F, 0x75,
-  0x96, 0xA5, 0xB4, 0xC0, 0xB9, 0xAA, 0x9D, 0x8A, 0x76, 0x68, 0x68, 0x6F,
-  0x7B, 0x8E, 0xAD, 0xC6, 0xD4, 0xDE, 0xE0, 0xD7, 0xC8, 0xAD, 0x8C, 0x77,
-  0x68, 0x60, 0x63, 0x71, 0x7E, 0x8F, 0xA3, 0xB2, 0xB3, 0xAB, 0xA3, 0x93,
-  0x6B, 0x45, 0x34, 0x26, 0x1B, 0x21, 0x32, 0x44, 0x5F, 0x77, 0x86, 0x90,
-  0x92, 0x88, 0x7C, 0x6D, 0x59, 0x48, 0x43, 0x4D, 0x57, 0x64, 0x86, 0xB1,
-  0xC5, 0xD2, 0xDC, 0xDC, 0xCE, 0xBC, 0xA2, 0x89, 0x78, 0x6C, 0x66, 0x6F,
-  0x7C, 0x8C, 0xA0, 0xB1, 0xB8, 0xB0, 0xA5, 0x9D, 0x81, 0x49, 0x2F, 0x20,
-  0x2E, 0x48, 0x53, 0x63, 0x8F, 0xB5, 0xC4, 0xCB, 0xB4, 0xA9, 0x9D, 0x84,
-  0x5F, 0x4A, 0x3B, 0x29, 0x23, 0x2F, 0x41, 0x59, 0x75, 0x89, 0x95, 0x93,
-  0x8C, 0x7C, 0x74, 0x77, 0x77, 0x78, 0x7C, 0x7E, 0x7E, 0x81, 0x89, 0x8C,
-  0x8B, 0x92, 0x9D, 0x9E, 0x9C, 0xA5, 0xAC, 0xAA, 0xAB, 0xB2, 0xB5, 0xB2,
-  0xB2, 0xB4, 0xB4, 0xB2, 0xB3, 0xB4, 0xB2, 0xB1, 0xAC, 0xA8, 0xA7, 0xA4,
-  0x9F, 0x9D, 0x9D, 0x97, 0x8D, 0x8C, 0x8B, 0x81, 0x79, 0x7A, 0x77, 0x67,
-  0x60, 0x62, 0x5F, 0x56, 0x55, 0x57, 0x54, 0x52, 0x52, 0x54, 0x59, 0x5D,
-  0x5E, 0x62, 0x6B, 0x70, 0x6E, 0x78, 0x87, 0x8A, 0x88, 0x96, 0xA1, 0x9F,
-  0xA0, 0xA6, 0xA9, 0xA7, 0xA8, 0xA9, 0xA9, 0xA7, 0xA4, 0x9E, 0x9E, 0x9A,
-  0x94, 0x8D, 0x8E, 0x88, 0x79, 0x71, 0x75, 0x63, 0x47, 0x47, 0x45, 0x60,
-  0x77, 0x77, 0x7C, 0x98, 0xA2, 0xA2, 0x99, 0x79, 0x75, 0x75, 0x6D, 0x62,
-  0x63, 0x62, 0x5B, 0x55, 0x58, 0x58, 0x55, 0x55, 0x57, 0x56, 0x52, 0x54,
-  0x54, 0x5A, 0x5E, 0x5F, 0x60, 0x65, 0x68, 0x68, 0x6D, 0x76, 0x79, 0x77,
-  0x80, 0x8C, 0x8B, 0x8B, 0x94, 0x99, 0x98, 0x9A, 0xA1, 0xA3, 0xA2, 0xA3,
-  0xA5, 0xA5, 0xA3, 0xA5, 0xA6, 0xA4, 0xA3, 0x9F, 0x9B, 0x9B, 0x98, 0x93,
-  0x92, 0x92, 0x8C, 0x83, 0x83, 0x82, 0x79, 0x72, 0x73, 0x70, 0x61, 0x5B,
-  0x5E, 0x5A, 0x52, 0x52, 0x54, 0x51, 0x50, 0x50, 0x53, 0x58, 0x5B, 0x5C,
-  0x60, 0x6A, 0x6D, 0x6D, 0x78, 0x85, 0x86, 0x86, 0x93, 0x9D, 0x9B, 0x9D,
-  0xA2, 0xA4, 0xA2, 0xA4, 0xA5, 0xA5, 0xA3, 0xA0, 0x9B, 0x9C, 0x99, 0x92,
-  0x8C, 0x8F, 0x86, 0x78, 0x73, 0x77, 0x63, 0x4B, 0x4C, 0x4C, 0x69, 0x79,
-  0x78, 0x7E, 0x98, 0x9F, 0xA0, 0x92, 0x78, 0x77, 0x75, 0x6D, 0x63, 0x66,
-  0x63, 0x5D, 0x58, 0x5B, 0x5A, 0x58, 0x57, 0x59, 0x58, 0x55, 0x56, 0x57,
-  0x5C, 0x60, 0x61, 0x63, 0x67, 0x6A, 0x6A, 0x6F, 0x78, 0x7A, 0x7B, 0x83,
-  0x8D, 0x8C, 0x8E, 0x97, 0x9B, 0x9A, 0x9C, 0xA4, 0xA5, 0xA4, 0xA5, 0xA7,
-  0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA1, 0x9D, 0x9B, 0x9B, 0x98, 0x94, 0x93,
-  0x92, 0x8B, 0x85, 0x85, 0x83, 0x7A, 0x74, 0x76, 0x71, 0x62, 0x60, 0x61,
-  0x5D, 0x56, 0x57, 0x58, 0x56, 0x54, 0x55, 0x57, 0x5C, 0x5F, 0x5F, 0x65,
-  0x6D, 0x6F, 0x6F, 0x7A, 0x85, 0x85, 0x88, 0x95, 0x9B, 0x99, 0x9C, 0xA1,
-  0xA2, 0xA0, 0xA2, 0xA4, 0xA3, 0xA2, 0x9F, 0x9B, 0x9C, 0x98, 0x91, 0x8D,
-  0x8F, 0x86, 0x7B, 0x76, 0x7A, 0x64, 0x50, 0x50, 0x53, 0x6F, 0x7C, 0x7B,
-  0x83, 0x9C, 0xA0, 0xA1, 0x91, 0x7A, 0x7A, 0x78, 0x70, 0x68, 0x6A, 0x67,
-  0x60, 0x5D, 0x5F, 0x5D, 0x5B, 0x5B, 0x5D, 0x5A, 0x59, 0x5A, 0x5B, 0x60,
-  0x62, 0x64, 0x66, 0x6A, 0x6C, 0x6B, 0x71, 0x79, 0x79, 0x7B, 0x84, 0x8C,
-  0x8A, 0x8D, 0x96, 0x99, 0x97, 0x9B, 0xA2, 0xA2, 0xA1, 0xA3, 0xA5, 0xA4,
-  0xA4, 0xA6, 0xA7, 0xA6, 0xA4, 0x9F, 0x9D, 0x9C, 0x99, 0x95, 0x95, 0x93,
-  0x8C, 0x87, 0x85, 0x80, 0x79, 0x75, 0x76, 0x70, 0x66, 0x65, 0x66, 0x62,
-  0x5D, 0x5E, 0x5F, 0x5C, 0x5C, 0x5D, 0x5E, 0x62, 0x65, 0x64, 0x6A, 0x70,
-  0x71, 0x71, 0x7B, 0x83, 0x82, 0x85, 0x90, 0x94, 0x93, 0x96, 0x99, 0x9A,
-  0x98, 0x9A, 0x9B, 0x9A, 0x99, 0x96, 0x94, 0x94, 0x91, 0x8C, 0x89, 0x8B,
-  0x83, 0x79, 0x77, 0x79, 0x65, 0x59, 0x5A, 0x5D, 0x74, 0x7D, 0x7C, 0x85,
-  0x98, 0x99, 0x9A, 0x8C, 0x7B, 0x7C, 0x79, 0x72, 0x6C, 0x6F, 0x6C, 0x67,
-  0x65, 0x67, 0x65, 0x64, 0x64, 0x66, 0x63, 0x62, 0x63, 0x64, 0x69, 0x6A,
-  0x6A, 0x6B, 0x6E, 0x70, 0x6F, 0x75, 0x7A, 0x7A, 0x7B, 0x84, 0x89, 0x87,
-  0x8A, 0x91, 0x94, 0x92, 0x96, 0x9A, 0x9A, 0x99, 0x9B, 0x9C, 0x9B, 0x9C,
-  0x9E, 0x9D, 0x9C, 0x9B, 0x97, 0x96, 0x96, 0x93, 0x90, 0x90, 0x8F, 0x89,
-  0x86, 0x87, 0x84, 0x7C, 0x79, 0x7B, 0x74, 0x6A, 0x6A, 0x69, 0x64, 0x61,
-  0x62, 0x62, 0x60, 0x40, 0x15, 0x0F, 0x31, 0x69, 0x8D, 0x93, 0x73, 0x42,
-  0x2A, 0x3E, 0x72, 0x9F, 0xB0, 0xA5, 0x78, 0x50, 0x4D, 0x70, 0xA6, 0xC5,
-  0xC2, 0x97, 0x64, 0x4F, 0x5D, 0x8C, 0xB9, 0xC1, 0xA2, 0x6C, 0x48, 0x41,
-  0x60, 0x94, 0xAE, 0x93, 0x5C, 0x2C, 0x22, 0x4B, 0x85, 0xAD, 0xBC, 0xAB,
-  0x75, 0x57, 0x50, 0x6F, 0xA1, 0xB3, 0x9E, 0x6A, 0x41, 0x33, 0x49, 0x7D,
-  0xA4, 0xA2, 0x7B, 0x45, 0x2B, 0x35, 0x64, 0x95, 0xA6, 0x94, 0x63, 0x3A,
-  0x35, 0x5A, 0x90, 0xB0, 0xAE, 0x8A, 0x58, 0x43, 0x5A, 0x90, 0xBB, 0xC7,
-  0xB2, 0x80, 0x5A, 0x5C, 0x86, 0xB9, 0xD1, 0xC8, 0x9E, 0x6D, 0x5C, 0x74,
-  0xA7, 0xCD, 0xD1, 0xB0, 0x7B, 0x5A, 0x5D, 0x85, 0xB5, 0xC9, 0xB5, 0x82,
-  0x55, 0x48, 0x5E, 0x91, 0xB4, 0xAE, 0x84, 0x4E, 0x31, 0x39, 0x65, 0x97,
-  0xA5, 0x91, 0x5E, 0x33, 0x2F, 0x54, 0x8B, 0xAA, 0xAA, 0x87, 0x54, 0x3F,
-  0x59, 0x8F, 0xBA, 0xC6, 0xB4, 0x81, 0x5B, 0x5B, 0x84, 0xB9, 0xD3, 0xCB,
-  0x9E, 0x6B, 0x5A, 0x6D, 0x9F, 0xC6, 0xC9, 0xA8, 0x72, 0x50, 0x4E, 0x74,
-  0xA5, 0xB9, 0x9B, 0x66, 0x35, 0x31, 0x5C, 0x94, 0xB8, 0xC3, 0xAB, 0x74,
-  0x57, 0x54, 0x7C, 0xAD, 0xBB, 0xA2, 0x6B, 0x42, 0x38, 0x55, 0x8B, 0xAC,
-  0xA8, 0x7D, 0x47, 0x2F, 0x3D, 0x72, 0xA0, 0xAD, 0x97, 0x62, 0x3B, 0x3B,
-  0x64, 0x9B, 0xB6, 0xB1, 0x87, 0x54, 0x45, 0x60, 0x96, 0xBE, 0xC7, 0xAD,
-  0x79, 0x57, 0x5E, 0x8A, 0xBC, 0xD2, 0xC5, 0x96, 0x66, 0x5A, 0x76, 0xAA,
-  0xCD, 0xCE, 0xA8, 0x72, 0x55, 0x5C, 0x88, 0xB7, 0xC7, 0xB0, 0x7A, 0x50,
-  0x47, 0x61, 0x96, 0xB6, 0xAC, 0x7E, 0x49, 0x32, 0x3D, 0x6E, 0x9D, 0xA8,
-  0x8C, 0x57, 0x31, 0x31, 0x5B, 0x91, 0xAD, 0xA7, 0x7F, 0x4D, 0x3D, 0x5A,
-  0x92, 0xBB, 0xC5, 0xAF, 0x7A, 0x58, 0x5E, 0x8B, 0xBE, 0xD4, 0xC7, 0x96,
-  0x67, 0x59, 0x70, 0xA2, 0xC4, 0xC4, 0x9E, 0x68, 0x49, 0x4D, 0x78, 0xA9,
-  0xB7, 0x98, 0x60, 0x33, 0x33, 0x60, 0x99, 0xBA, 0xC1, 0xA1, 0x6A, 0x50,
-  0x54, 0x80, 0xAF, 0xB9, 0x9C, 0x65, 0x3E, 0x38, 0x5B, 0x92, 0xAF, 0xA5,
-  0x77, 0x43, 0x2F, 0x43, 0x79, 0xA4, 0xAD, 0x91, 0x5B, 0x38, 0x3C, 0x69,
-  0x9E, 0xB6, 0xAC, 0x7D, 0x4D, 0x41, 0x61, 0x99, 0xBF, 0xC3, 0xA4, 0x6E,
-  0x4F, 0x5C, 0x8D, 0xBD, 0xCF, 0xBD, 0x8A, 0x5D, 0x55, 0x75, 0xAB, 0xCC,
-  0xC8, 0x9F, 0x69, 0x50, 0x5C, 0x8C, 0xBB, 0xC5, 0xAB, 0x73, 0x4B, 0x47,
-  0x67, 0x9C, 0xB7, 0xAB, 0x7A, 0x46, 0x31, 0x42, 0x76, 0xA2, 0xA9, 0x8A,
-  0x53, 0x30, 0x35, 0x61, 0x97, 0xAF, 0xA5, 0x78, 0x48, 0x3D, 0x5C, 0x94,
-  0xBB, 0xC2, 0xA4, 0x6E, 0x50, 0x5A, 0x8A, 0xBD, 0xD0, 0xBE, 0x8A, 0x5C,
-  0x53, 0x70, 0xA6, 0xC7, 0xC3, 0x98, 0x63, 0x49, 0x50, 0x7E, 0xAE, 0xB7,
-  0x93, 0x5B, 0x31, 0x36, 0x64, 0x9D, 0xBB, 0xBB, 0x93, 0x5E, 0x48, 0x53,
-  0x85, 0xB2, 0xB9, 0x98, 0x60, 0x3C, 0x3C, 0x64, 0x9B, 0xB4, 0xA6, 0x75,
-  0x42, 0x33, 0x4B, 0x84, 0xAB, 0xB0, 0x8F, 0x57, 0x38, 0x40, 0x70, 0xA5,
-  0xB8, 0xA9, 0x76, 0x49, 0x40, 0x62, 0x9C, 0xBE, 0xBF, 0x99, 0x62, 0x49,
-  0x57, 0x8B, 0xBB, 0xCA, 0xB3, 0x7C, 0x52, 0x4E, 0x74, 0xAB, 0xC9, 0xC1,
-  0x95, 0x5F, 0x49, 0x5C, 0x90, 0xBB, 0xC3, 0xA5, 0x6C, 0x46, 0x45, 0x6D,
-  0xA3, 0xBB, 0xAB, 0x78, 0x46, 0x35, 0x4C, 0x83, 0xAC, 0xAF, 0x8C, 0x54,
-  0x34, 0x3C, 0x6D, 0xA1, 0xB5, 0xA7, 0x74, 0x45, 0x3D, 0x60, 0x99, 0xBD,
-  0xBE, 0x9B, 0x64, 0x48, 0x58, 0x8B, 0xBC, 0xCA, 0xB4, 0x7D, 0x52, 0x4D,
-  0x6F, 0xA6, 0xC4, 0xBC, 0x8E, 0x5A, 0x42, 0x51, 0x84, 0xB2, 0xB7, 0x92,
-  0x59, 0x32, 0x3C, 0x6D, 0xA4, 0xC0, 0xBC, 0x8E, 0x5A, 0x48, 0x58, 0x90,
-  0xB9, 0xBD, 0x94, 0x60, 0x50, 0x4D, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x52,
-  0x53, 0x54, 0x55, 0x56, 0x58, 0x5A, 0x5B, 0x5D, 0x5F, 0x60, 0x61, 0x63,
-  0x65, 0x67, 0x68, 0x6A, 0x6D, 0x6E, 0x6F, 0x71, 0x74, 0x74, 0x75, 0x78,
-  0x79, 0x79, 0x7A, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7B, 0x7C, 0x7B, 0x7A, 0x79, 0x7A,
-  0x7A, 0x77, 0x75, 0x76, 0x75, 0x74, 0x74, 0x75, 0x74, 0x75, 0x75, 0x76,
-  0x76, 0x78, 0x78, 0x79, 0x7C, 0x7D, 0x7D, 0x80, 0x83, 0x83, 0x84, 0x87,
-  0x89, 0x89, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x89,
-  0x8A, 0x89, 0x88, 0x86, 0x87, 0x85, 0x82, 0x80, 0x81, 0x7D, 0x77, 0x78,
-  0x77, 0x7D, 0x83, 0x83, 0x83, 0x8A, 0x8D, 0x8D, 0x8A, 0x84, 0x83, 0x83,
-  0x82, 0x7F, 0x80, 0x7F, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7D, 0x7F, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x83, 0x82, 0x83, 0x84,
-  0x85, 0x84, 0x86, 0x87, 0x86, 0x87, 0x88, 0x89, 0x88, 0x89, 0x89, 0x8A,
-  0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x89, 0x88, 0x89,
-  0x88, 0x87, 0x88, 0x88, 0x87, 0x85, 0x86, 0x85, 0x84, 0x83, 0x84, 0x83,
-  0x81, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x83, 0x84, 0x83, 0x84, 0x86, 0x87, 0x87, 0x88, 0x89,
-  0x89, 0x88, 0x89, 0x8A, 0x89, 0x8A, 0x8A, 0x89, 0x8A, 0x89, 0x88, 0x89,
-  0x88, 0x87, 0x86, 0x87, 0x85, 0x84, 0x83, 0x84, 0x81, 0x7E, 0x7E, 0x7D,
-  0x80, 0x82, 0x82, 0x83, 0x86, 0x87, 0x87, 0x85, 0x82, 0x82, 0x81, 0x80,
-  0x7F, 0x80, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E,
-  0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83, 0x84,
-  0x83, 0x85, 0x86, 0x85, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83,
-  0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81,
-  0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x7F, 0x83, 0x9A, 0x99, 0x9B, 0xAF, 0xCC, 0xE5, 0xEC, 0xE6,
-  0xCF, 0xAD, 0x91, 0x85, 0x88, 0x9C, 0xB8, 0xCE, 0xD5, 0xCE, 0xB8, 0x99,
-  0x80, 0x76, 0x7C, 0x93, 0xB3, 0xCC, 0xD3, 0xC9, 0xAF, 0x8B, 0x71, 0x67,
-  0x70, 0x8B, 0xB0, 0xC8, 0xCE, 0xC3, 0xA4, 0x7E, 0x63, 0x5B, 0x66, 0x85,
-  0xAC, 0xC4, 0xC8, 0xBB, 0x99, 0x71, 0x56, 0x4F, 0x5D, 0x7F, 0xA7, 0xBE,
-  0xC1, 0xB2, 0x8F, 0x67, 0x4D, 0x49, 0x5B, 0x7F, 0xA4, 0xBA, 0xBC, 0xAA,
-  0x86, 0x5E, 0x46, 0x44, 0x58, 0x7D, 0xA1, 0xB6, 0xB6, 0xA2, 0x7D, 0x57,
-  0x41, 0x41, 0x57, 0x7D, 0xA1, 0xB3, 0xB1, 0x9C, 0x75, 0x50, 0x3D, 0x3F,
-  0x56, 0x7D, 0xA0, 0xAF, 0xAD, 0x95, 0x6E, 0x4A, 0x38, 0x3C, 0x56, 0x7E,
-  0xA0, 0xAD, 0xA9, 0x91, 0x68, 0x47, 0x37, 0x3D, 0x58, 0x80, 0xA1, 0xAD,
-  0xA7, 0x8C, 0x64, 0x43, 0x35, 0x3E, 0x5B, 0x84, 0xA3, 0xAD, 0xA5, 0x89,
-  0x62, 0x43, 0x37, 0x42, 0x5F, 0x87, 0xA4, 0xAD, 0xA3, 0x85, 0x5D, 0x3D,
-  0x34, 0x41, 0x62, 0x8B, 0xA7, 0xAD, 0xA1, 0x82, 0x58, 0x3C, 0x35, 0x43,
-  0x66, 0x8E, 0xA8, 0xAC, 0xA0, 0x7E, 0x55, 0x3B, 0x36, 0x46, 0x69, 0x92,
-  0xA8, 0xAC, 0x9D, 0x7A, 0x52, 0x39, 0x36, 0x49, 0x6E, 0x95, 0xAB, 0xAC,
-  0x9B, 0x77, 0x50, 0x39, 0x38, 0x4C, 0x72, 0x99, 0xAC, 0xAC, 0x9A, 0x74,
-  0x4E, 0x38, 0x39, 0x51, 0x77, 0x9D, 0xAE, 0xAD, 0x99, 0x71, 0x4C, 0x39,
-  0x3D, 0x55, 0x7D, 0xA1, 0xB0, 0xAD, 0x96, 0x6E, 0x4B, 0x39, 0x3E, 0x59,
-  0x82, 0xA4, 0xB1, 0xAC, 0x93, 0x6B, 0x49, 0x39, 0x40, 0x5D, 0x86, 0xA6,
-  0xB2, 0xAB, 0x8F, 0x67, 0x45, 0x37, 0x41, 0x60, 0x88, 0xA7, 0xB1, 0xA9,
-  0x8C, 0x63, 0x44, 0x39, 0x44, 0x63, 0x8C, 0xAA, 0xB3, 0xA8, 0x89, 0x60,
-  0x42, 0x39, 0x47, 0x68, 0x91, 0xAD, 0xB3, 0xA7, 0x86, 0x5D, 0x42, 0x3B,
-  0x4B, 0x6F, 0x97, 0xB0, 0xB5, 0xA6, 0x83, 0x5A, 0x3F, 0x3B, 0x4C, 0x71,
-  0x9A, 0xB1, 0xB4, 0xA4, 0x81, 0x58, 0x40, 0x3D, 0x50, 0x76, 0x9D, 0xB3,
-  0xB4, 0xA2, 0x7C, 0x56, 0x3F, 0x3E, 0x53, 0x7A, 0xA1, 0xB3, 0xB4, 0x9F,
-  0x79, 0x52, 0x3D, 0x3F, 0x56, 0x7E, 0xA3, 0xB5, 0xB2, 0x9D, 0x75, 0x50,
-  0x3C, 0x41, 0x5A, 0x83, 0xA7, 0xB6, 0xB3, 0x9B, 0x72, 0x4D, 0x3D, 0x43,
-  0x5E, 0x87, 0xAA, 0xB7, 0xB2, 0x98, 0x6F, 0x4D, 0x3E, 0x46, 0x63, 0x8C,
-  0xAD, 0xB9, 0xB2, 0x95, 0x6C, 0x4B, 0x3E, 0x48, 0x67, 0x91, 0xAF, 0xB9,
-  0xB0, 0x92, 0x69, 0x49, 0x3E, 0x4A, 0x6B, 0x95, 0xB1, 0xBA, 0xAE, 0x8E,
-  0x65, 0x47, 0x3F, 0x4D, 0x6E, 0x97, 0xB2, 0xB7, 0xAA, 0x89, 0x5F, 0x44,
-  0x3E, 0x4D, 0x71, 0x9A, 0xB4, 0xB7, 0xA9, 0x85, 0x5C, 0x43, 0x3F, 0x50,
-  0x76, 0x9F, 0xB5, 0xB8, 0xA7, 0x83, 0x5B, 0x43, 0x40, 0x54, 0x7B, 0xA2,
-  0xB7, 0xB8, 0xA6, 0x81, 0x59, 0x40, 0x3F, 0x55, 0x7D, 0xA4, 0xB7, 0xB7,
-  0xA2, 0x7B, 0x54, 0x3F, 0x41, 0x59, 0x82, 0xA8, 0xB9, 0xB6, 0xA0, 0x77,
-  0x52, 0x3F, 0x43, 0x5D, 0x86, 0xAB, 0xB9, 0xB5, 0x9C, 0x74, 0x4F, 0x3F,
-  0x45, 0x61, 0x8B, 0xAD, 0xB9, 0xB4, 0x99, 0x6F, 0x4C, 0x3E, 0x46, 0x64,
-  0x8E, 0xAF, 0xBA, 0xB3, 0x96, 0x6C, 0x4B, 0x3E, 0x48, 0x68, 0x93, 0xB2,
-  0xBB, 0xB1, 0x92, 0x69, 0x49, 0x3F, 0x4B, 0x6D, 0x98, 0xB5, 0xBD, 0xB1,
-  0x91, 0x67, 0x49, 0x41, 0x4E, 0x72, 0x9C, 0xB6, 0xBC, 0xAF, 0x8D, 0x62,
-  0x47, 0x41, 0x51, 0x75, 0x9F, 0xB8, 0xBC, 0xAD, 0x88, 0x5F, 0x45, 0x41,
-  0x54, 0x79, 0xA2, 0xB9, 0xBB, 0xA9, 0x84, 0x5B, 0x43, 0x40, 0x55, 0x7D,
-  0xA4, 0xB8, 0xB8, 0xA6, 0x7E, 0x57, 0x41, 0x41, 0x58, 0x80, 0xA7, 0xB9,
-  0xB9, 0xA3, 0x7A, 0x54, 0x3F, 0x43, 0x5B, 0x84, 0xAA, 0xBB, 0xB8, 0xA0,
-  0x78, 0x53, 0x40, 0x46, 0x60, 0x6D, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x72,
-  0x72, 0x73, 0x73, 0x74, 0x74, 0x75, 0x74, 0x75, 0x76, 0x75, 0x76, 0x77,
-  0x76, 0x77, 0x78, 0x77, 0x78, 0x79, 0x78, 0x79, 0x79, 0x7A, 0x79, 0x7A,
-  0x79, 0x7A, 0x7B, 0x7A, 0x7A, 0x7B, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B,
-  0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x83, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
-  0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x80,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7C, 0x79, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C,
-  0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80,
-  0x7F, 0x80, 0x7F, 0x7E, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x8D, 0xA7, 0xBF, 0xB8, 0xA9, 0x97, 0x6B,
-  0x47, 0x2B, 0x1E, 0x2A, 0x45, 0x62, 0x8B, 0xA2, 0xB3, 0xC0, 0xB0, 0xA8,
-  0x91, 0x84, 0x82, 0x88, 0x9B, 0xB2, 0xC9, 0xD3, 0xDA, 0xC6, 0xB5, 0x8D,
-  0x6A, 0x53, 0x30, 0x2C, 0x55, 0x88, 0xA5, 0xCD, 0xD9, 0xB9, 0x94, 0x76,
-  0x4F, 0x3E, 0x35, 0x3A, 0x51, 0x69, 0x7F, 0x87, 0x85, 0x7B, 0x6D, 0x4E,
-  0x3C, 0x30, 0x38, 0x54, 0x6D, 0x99, 0xB4, 0xC4, 0xCE, 0xBF, 0xAF, 0x94,
-  0x80, 0x7A, 0x7F, 0x92, 0xAE, 0xCA, 0xD7, 0xDE, 0xCF, 0xBA, 0x98, 0x72,
-  0x60, 0x48, 0x4E, 0x56, 0x64, 0x7E, 0x82, 0x85, 0x7A, 0x66, 0x4A, 0x34,
-  0x24, 0x27, 0x3D, 0x58, 0x8D, 0xA9, 0xC6, 0xD3, 0xC7, 0xBB, 0x9B, 0x88,
-  0x7A, 0x79, 0x7E, 0x94, 0xA9, 0xBD, 0xC0, 0xAC, 0x9A, 0x68, 0x34, 0x2F,
-  0x41, 0x4C, 0x76, 0xA3, 0xAF, 0xA6, 0xAA, 0x99, 0x83, 0x66, 0x3E, 0x2C,
-  0x1D, 0x27, 0x36, 0x50, 0x6C, 0x83, 0x8E, 0x8A, 0x7F, 0x64, 0x53, 0x45,
-  0x48, 0x5D, 0x73, 0x9C, 0xB9, 0xD2, 0xDF, 0xD3, 0xC1, 0xA0, 0x89, 0x7B,
-  0x76, 0x7C, 0x8F, 0xAA, 0xBE, 0xC9, 0xBE, 0xB1, 0x90, 0x6B, 0x4C, 0x29,
-  0x27, 0x2F, 0x45, 0x65, 0x76, 0x82, 0x85, 0x7C, 0x68, 0x54, 0x3F, 0x45,
-  0x52, 0x69, 0x98, 0xB8, 0xD7, 0xE4, 0xE4, 0xD5, 0xB5, 0x8A, 0x73, 0x61,
-  0x61, 0x74, 0x7D, 0x9B, 0x98, 0x7C, 0x7C, 0x8D, 0x76, 0x6E, 0x77, 0x67,
-  0x50, 0x5D, 0x79, 0x88, 0x9A, 0x90, 0x85, 0x68, 0x44, 0x24, 0x0E, 0x0F,
-  0x29, 0x48, 0x6C, 0x8A, 0x96, 0xA1, 0x99, 0x89, 0x77, 0x62, 0x60, 0x68,
-  0x79, 0x9B, 0xBB, 0xD8, 0xE6, 0xE1, 0xD2, 0xB3, 0x8F, 0x79, 0x6B, 0x6B,
-  0x7A, 0x89, 0xA3, 0xAD, 0xAB, 0xA2, 0x80, 0x60, 0x3A, 0x1D, 0x14, 0x1A,
-  0x30, 0x56, 0x77, 0x89, 0x9A, 0x93, 0x8D, 0x7E, 0x67, 0x6A, 0x68, 0x7A,
-  0x91, 0xAF, 0xCC, 0xDC, 0xDC, 0xCC, 0xB1, 0x85, 0x6E, 0x4D, 0x46, 0x49,
-  0x42, 0x5E, 0x93, 0xAE, 0xB7, 0xC4, 0xAF, 0x78, 0x52, 0x3F, 0x33, 0x45,
-  0x56, 0x73, 0x86, 0x8C, 0x89, 0x75, 0x59, 0x3C, 0x2D, 0x23, 0x31, 0x47,
-  0x6C, 0x91, 0xA5, 0xBB, 0xB7, 0xAD, 0x98, 0x7B, 0x74, 0x6D, 0x7A, 0x8F,
-  0xAE, 0xD0, 0xE3, 0xE3, 0xD1, 0xB8, 0x91, 0x77, 0x5E, 0x54, 0x5E, 0x67,
-  0x86, 0x8E, 0x92, 0x92, 0x7D, 0x67, 0x42, 0x25, 0x16, 0x1E, 0x31, 0x57,
-  0x7D, 0x9B, 0xB9, 0xB7, 0xB9, 0xA5, 0x8A, 0x7D, 0x71, 0x79, 0x88, 0x9E,
-  0xB6, 0xC9, 0xC8, 0xC3, 0xA6, 0x7F, 0x5D, 0x31, 0x1C, 0x39, 0x60, 0x82,
-  0xB7, 0xD0, 0xBF, 0xA6, 0x92, 0x6A, 0x4D, 0x36, 0x2B, 0x36, 0x46, 0x65,
-  0x78, 0x85, 0x8A, 0x86, 0x72, 0x57, 0x40, 0x33, 0x3D, 0x4D, 0x70, 0x96,
-  0xB2, 0xCC, 0xCE, 0xC9, 0xB4, 0x94, 0x80, 0x72, 0x77, 0x85, 0x9D, 0xB9,
-  0xCE, 0xD4, 0xCC, 0xB7, 0x92, 0x73, 0x4E, 0x3F, 0x3B, 0x40, 0x5E, 0x74,
-  0x85, 0x8C, 0x85, 0x75, 0x5D, 0x40, 0x31, 0x31, 0x3E, 0x65, 0x88, 0xB3,
-  0xD1, 0xD7, 0xD6, 0xC0, 0xA2, 0x85, 0x72, 0x66, 0x73, 0x81, 0xA1, 0xB7,
-  0xB7, 0xB5, 0x8D, 0x61, 0x4E, 0x50, 0x44, 0x59, 0x7E, 0x88, 0x91, 0xA7,
-  0xA9, 0x9F, 0x8E, 0x69, 0x47, 0x28, 0x1B, 0x1E, 0x2F, 0x4D, 0x74, 0x8C,
-  0x99, 0x9A, 0x8B, 0x79, 0x5C, 0x4E, 0x50, 0x59, 0x76, 0x95, 0xB9, 0xD5,
-  0xDE, 0xDA, 0xC4, 0xA6, 0x89, 0x76, 0x6A, 0x73, 0x83, 0x9F, 0xB8, 0xBD,
-  0xC1, 0xAC, 0x93, 0x6E, 0x3F, 0x2B, 0x1F, 0x29, 0x44, 0x62, 0x7C, 0x8E,
-  0x92, 0x8A, 0x7D, 0x5F, 0x57, 0x4E, 0x56, 0x75, 0x8D, 0xB8, 0xD4, 0xE6,
-  0xE8, 0xD8, 0xB2, 0x8C, 0x6C, 0x57, 0x59, 0x57, 0x73, 0x83, 0x7C, 0x8B,
-  0xA5, 0x9E, 0x90, 0x89, 0x6C, 0x47, 0x46, 0x53, 0x68, 0x88, 0x8F, 0x97,
-  0x89, 0x76, 0x54, 0x33, 0x1F, 0x1E, 0x2A, 0x2E, 0x36, 0x36, 0x40, 0x46,
-  0x4D, 0x5D, 0x60, 0x6C, 0x72, 0x76, 0x80, 0x81, 0x86, 0x87, 0x89, 0x8D,
-  0x8D, 0x8A, 0x87, 0x86, 0x81, 0x81, 0x76, 0x74, 0x6E, 0x64, 0x64, 0x52,
-  0x4E, 0x49, 0x42, 0x43, 0x40, 0x40, 0x45, 0x4B, 0x4F, 0x5B, 0x5E, 0x6C,
-  0x7A, 0x7D, 0x91, 0x94, 0x9B, 0x9F, 0xA0, 0xA3, 0xA4, 0xA0, 0x9D, 0x9A,
-  0x90, 0x91, 0x7F, 0x78, 0x6C, 0x4E, 0x48, 0x69, 0x79, 0x86, 0xA3, 0xA5,
-  0x8B, 0x7B, 0x77, 0x68, 0x68, 0x5F, 0x5D, 0x5B, 0x59, 0x5B, 0x58, 0x56,
-  0x5A, 0x61, 0x61, 0x68, 0x69, 0x71, 0x79, 0x7C, 0x8B, 0x8F, 0x96, 0xA0,
-  0xA1, 0xAB, 0xAC, 0xAE, 0xB0, 0xB0, 0xB4, 0xB3, 0xAF, 0xAB, 0xA9, 0xA3,
-  0xA3, 0x9A, 0x93, 0x8F, 0x82, 0x80, 0x71, 0x67, 0x64, 0x5A, 0x5B, 0x58,
-  0x55, 0x59, 0x5F, 0x61, 0x6C, 0x70, 0x78, 0x8B, 0x8C, 0x9E, 0xA5, 0xA9,
-  0xB0, 0xAE, 0xB2, 0xB2, 0xB0, 0xAA, 0xA7, 0x9A, 0x9A, 0x8E, 0x82, 0x7D,
-  0x61, 0x53, 0x6A, 0x80, 0x88, 0xA3, 0xAE, 0x9A, 0x85, 0x81, 0x73, 0x71,
-  0x6B, 0x65, 0x66, 0x61, 0x63, 0x5F, 0x5E, 0x5F, 0x66, 0x67, 0x6C, 0x6E,
-  0x72, 0x7D, 0x7D, 0x8A, 0x90, 0x94, 0x9F, 0xA0, 0xA8, 0xAB, 0xAC, 0xAF,
-  0xAD, 0xB0, 0xB0, 0xAD, 0xA9, 0xA7, 0xA2, 0xA0, 0x9B, 0x91, 0x91, 0x84,
-  0x81, 0x78, 0x69, 0x69, 0x5F, 0x5E, 0x5C, 0x59, 0x5B, 0x61, 0x63, 0x6A,
-  0x72, 0x75, 0x87, 0x8B, 0x97, 0xA2, 0xA3, 0xAB, 0xAB, 0xAE, 0xAE, 0xAE,
-  0xA7, 0xA8, 0x9E, 0x9B, 0x94, 0x84, 0x80, 0x68, 0x53, 0x61, 0x7D, 0x83,
-  0x9A, 0xAD, 0x9E, 0x86, 0x81, 0x75, 0x6F, 0x6D, 0x63, 0x64, 0x5F, 0x61,
-  0x5E, 0x5C, 0x5C, 0x63, 0x65, 0x67, 0x6C, 0x6C, 0x77, 0x79, 0x81, 0x8C,
-  0x8E, 0x99, 0x9C, 0xA1, 0xA7, 0xA7, 0xAB, 0xAA, 0xAB, 0xAD, 0xAB, 0xA7,
-  0xA5, 0xA1, 0x9D, 0x9A, 0x90, 0x8F, 0x83, 0x7C, 0x78, 0x68, 0x67, 0x60,
-  0x5C, 0x5B, 0x58, 0x59, 0x5E, 0x62, 0x66, 0x70, 0x71, 0x81, 0x88, 0x8E,
-  0x9D, 0x9D, 0xA4, 0xA5, 0xA7, 0xA8, 0xA8, 0xA3, 0xA1, 0x9D, 0x95, 0x94,
-  0x83, 0x7F, 0x6E, 0x56, 0x5A, 0x75, 0x7F, 0x8D, 0xA6, 0x9F, 0x87, 0x7E,
-  0x78, 0x6D, 0x6D, 0x64, 0x63, 0x60, 0x5F, 0x5F, 0x5C, 0x5B, 0x5F, 0x64,
-  0x65, 0x6B, 0x6B, 0x73, 0x78, 0x7C, 0x88, 0x8A, 0x94, 0x98, 0x9B, 0xA3,
-  0xA2, 0xA6, 0xA6, 0xA7, 0xA9, 0xA8, 0xA3, 0xA1, 0x9F, 0x9A, 0x99, 0x90,
-  0x8E, 0x87, 0x7E, 0x7D, 0x6D, 0x68, 0x63, 0x5C, 0x5D, 0x59, 0x59, 0x5D,
-  0x61, 0x63, 0x6E, 0x6F, 0x7B, 0x87, 0x89, 0x9A, 0x9B, 0xA1, 0xA5, 0xA5,
-  0xA8, 0xA8, 0xA4, 0xA0, 0x9E, 0x95, 0x94, 0x84, 0x7D, 0x72, 0x59, 0x52,
-  0x6C, 0x7B, 0x87, 0x9F, 0xA2, 0x8B, 0x7C, 0x78, 0x6B, 0x6B, 0x63, 0x61,
-  0x60, 0x5D, 0x5E, 0x5A, 0x59, 0x5C, 0x62, 0x64, 0x69, 0x6A, 0x6E, 0x75,
-  0x77, 0x81, 0x84, 0x89, 0x90, 0x91, 0x98, 0x9A, 0x9B, 0x9D, 0x9C, 0x9E,
-  0x9E, 0x9B, 0x99, 0x98, 0x94, 0x92, 0x8D, 0x88, 0x86, 0x7D, 0x7D, 0x72,
-  0x6B, 0x69, 0x62, 0x62, 0x60, 0x5F, 0x61, 0x65, 0x66, 0x6E, 0x72, 0x76,
-  0x83, 0x84, 0x90, 0x95, 0x97, 0x9C, 0x9B, 0x9E, 0x9D, 0x9C, 0x98, 0x98,
-  0x90, 0x8F, 0x87, 0x7E, 0x79, 0x65, 0x5A, 0x6B, 0x7B, 0x81, 0x95, 0x9C,
-  0x8E, 0x7F, 0x7C, 0x72, 0x70, 0x6C, 0x66, 0x67, 0x64, 0x65, 0x63, 0x62,
-  0x63, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x79, 0x7A, 0x83, 0x88, 0x8A, 0x93,
-  0x94, 0x99, 0x9C, 0x9D, 0x9F, 0x9E, 0xA0, 0xA0, 0x9E, 0x9B, 0x9A, 0x96,
-  0x95, 0x91, 0x8A, 0x89, 0x80, 0x7E, 0x76, 0x6C, 0x6B, 0x63, 0x62, 0x60,
-  0x5E, 0x60, 0x63, 0x65, 0x6B, 0x71, 0x72, 0x80, 0x83, 0x8B, 0x93, 0x94,
-  0x99, 0x99, 0x9A, 0x9B, 0x9B, 0x95, 0x9D, 0xBF, 0xDE, 0xF2, 0xF1, 0xCA,
-  0x97, 0x7D, 0x80, 0x7E, 0x96, 0xA2, 0xA1, 0x9C, 0x81, 0x76, 0x9A, 0xD7,
-  0xEE, 0xF3, 0xBE, 0x81, 0x6C, 0x6F, 0x88, 0xA6, 0xB5, 0x9D, 0x6B, 0x48,
-  0x46, 0x5C, 0x84, 0x9B, 0x9A, 0x70, 0x3D, 0x28, 0x3B, 0x71, 0x9C, 0xA4,
-  0x90, 0x65, 0x45, 0x45, 0x70, 0xA5, 0xB6, 0xB0, 0x98, 0x76, 0x66, 0x7D,
-  0xB3, 0xD2, 0xD3, 0xC0, 0x9B, 0x80, 0x83, 0xA9, 0xD2, 0xDE, 0xD3, 0xAE,
-  0x89, 0x7F, 0x90, 0xB5, 0xCF, 0xCF, 0xAD, 0x7E, 0x68, 0x6E, 0x88, 0xA8,
-  0xB6, 0xA0, 0x6C, 0x48, 0x46, 0x52, 0x6F, 0x88, 0x83, 0x59, 0x28, 0x18,
-  0x25, 0x4C, 0x71, 0x7B, 0x69, 0x45, 0x27, 0x28, 0x51, 0x83, 0x96, 0x93,
-  0x81, 0x62, 0x51, 0x6B, 0xA8, 0xCB, 0xCE, 0xB8, 0x91, 0x74, 0x77, 0x9E,
-  0xCB, 0xDB, 0xCB, 0x9B, 0x71, 0x67, 0x78, 0x9B, 0xB6, 0xB6, 0x89, 0x50,
-  0x3B, 0x3E, 0x40, 0x61, 0x6C, 0x6B, 0x63, 0x45, 0x40, 0x72, 0xB3, 0xCA,
-  0xC7, 0x88, 0x50, 0x42, 0x49, 0x64, 0x83, 0x8E, 0x75, 0x46, 0x29, 0x2B,
-  0x44, 0x6C, 0x81, 0x7A, 0x52, 0x2A, 0x1B, 0x31, 0x61, 0x84, 0x89, 0x75,
-  0x4E, 0x33, 0x38, 0x62, 0x94, 0xA4, 0x9C, 0x82, 0x60, 0x54, 0x71, 0xAA,
-  0xC9, 0xC8, 0xB2, 0x88, 0x6F, 0x77, 0xA4, 0xD0, 0xDB, 0xCB, 0x9F, 0x78,
-  0x72, 0x89, 0xB4, 0xCE, 0xCA, 0xA2, 0x70, 0x5E, 0x67, 0x86, 0xA6, 0xB2,
-  0x95, 0x60, 0x40, 0x41, 0x51, 0x70, 0x88, 0x7E, 0x51, 0x23, 0x18, 0x28,
-  0x51, 0x74, 0x7B, 0x67, 0x41, 0x27, 0x2C, 0x58, 0x88, 0x97, 0x93, 0x7D,
-  0x5D, 0x52, 0x70, 0xAD, 0xCC, 0xCD, 0xB4, 0x8C, 0x72, 0x7A, 0xA4, 0xD0,
-  0xDC, 0xC8, 0x96, 0x70, 0x69, 0x7E, 0xA3, 0xBC, 0xB6, 0x84, 0x4F, 0x3E,
-  0x42, 0x49, 0x6C, 0x72, 0x70, 0x63, 0x46, 0x46, 0x7F, 0xBD, 0xD1, 0xC8,
-  0x83, 0x50, 0x44, 0x4E, 0x6B, 0x8A, 0x91, 0x73, 0x42, 0x29, 0x2D, 0x4B,
-  0x74, 0x86, 0x7C, 0x4F, 0x28, 0x1D, 0x38, 0x6A, 0x8B, 0x8E, 0x76, 0x4E,
-  0x36, 0x3E, 0x6F, 0x9D, 0xA9, 0xA0, 0x83, 0x60, 0x57, 0x7B, 0xB3, 0xCD,
-  0xC9, 0xAF, 0x87, 0x70, 0x7D, 0xAC, 0xD4, 0xDB, 0xC8, 0x9C, 0x78, 0x76,
-  0x91, 0xBB, 0xD1, 0xCA, 0x9F, 0x70, 0x61, 0x6D, 0x8E, 0xAE, 0xB5, 0x96,
-  0x5D, 0x41, 0x44, 0x57, 0x7A, 0x8F, 0x81, 0x50, 0x23, 0x1A, 0x2F, 0x5C,
-  0x7D, 0x80, 0x67, 0x40, 0x26, 0x32, 0x61, 0x90, 0x9C, 0x95, 0x7C, 0x5C,
-  0x54, 0x78, 0xB5, 0xCF, 0xCD, 0xB2, 0x89, 0x73, 0x7F, 0xAC, 0xD5, 0xDE,
-  0xC7, 0x92, 0x70, 0x6B, 0x85, 0xAA, 0xC0, 0xB6, 0x83, 0x4F, 0x42, 0x47,
-  0x54, 0x75, 0x79, 0x79, 0x64, 0x47, 0x4D, 0x8A, 0xC5, 0xD7, 0xC6, 0x7D,
-  0x4F, 0x45, 0x54, 0x72, 0x92, 0x94, 0x70, 0x3F, 0x2A, 0x31, 0x53, 0x7A,
-  0x8A, 0x7A, 0x4A, 0x26, 0x1F, 0x3E, 0x72, 0x92, 0x91, 0x74, 0x4B, 0x35,
-  0x43, 0x76, 0xA3, 0xAC, 0x9F, 0x7E, 0x5D, 0x59, 0x80, 0xB7, 0xCE, 0xC8,
-  0xAA, 0x82, 0x6F, 0x81, 0xB1, 0xD6, 0xDB, 0xC3, 0x96, 0x76, 0x77, 0x96,
-  0xBF, 0xD3, 0xC7, 0x99, 0x6C, 0x61, 0x70, 0x95, 0xB4, 0xB8, 0x93, 0x5B,
-  0x42, 0x47, 0x5F, 0x83, 0x96, 0x83, 0x4E, 0x24, 0x1E, 0x37, 0x66, 0x85,
-  0x85, 0x67, 0x3E, 0x27, 0x37, 0x6B, 0x97, 0xA1, 0x97, 0x7A, 0x5A, 0x55,
-  0x80, 0xBA, 0xD0, 0xCB, 0xAB, 0x82, 0x6E, 0x80, 0xAF, 0xD7, 0xDD, 0xC0,
-  0x8B, 0x6A, 0x6A, 0x88, 0xAE, 0xC4, 0xB4, 0x7E, 0x4C, 0x42, 0x48, 0x5B,
-  0x7E, 0x80, 0x7C, 0x61, 0x45, 0x52, 0x95, 0xC9, 0xD9, 0xC2, 0x78, 0x4E,
-  0x46, 0x58, 0x7C, 0x9A, 0x98, 0x70, 0x3E, 0x2B, 0x36, 0x5C, 0x84, 0x90,
-  0x7B, 0x49, 0x25, 0x23, 0x46, 0x7B, 0x96, 0x91, 0x71, 0x48, 0x36, 0x49,
-  0x7E, 0xA7, 0xAE, 0x9E, 0x79, 0x5B, 0x5D, 0x86, 0xB3, 0xC9, 0xD1, 0xCC,
-  0xAE, 0x87, 0x70, 0x6C, 0x7B, 0x9A, 0xC1, 0xD7, 0xDA, 0xCA, 0xA6, 0x7F,
-  0x68, 0x63, 0x70, 0x91, 0xB6, 0xC2, 0xBB, 0xAA, 0x88, 0x5E, 0x43, 0x42,
-  0x4F, 0x63, 0x84, 0x99, 0x95, 0x7C, 0x58, 0x37, 0x22, 0x22, 0x36, 0x5A,
-  0x82, 0x96, 0x95, 0x86, 0x6B, 0x4C, 0x3B, 0x4A, 0x6A, 0x8D, 0xAD, 0xC7,
-  0xCF, 0xB9, 0x98, 0x7B, 0x6C, 0x6E, 0x88, 0xAF, 0xCB, 0xD4, 0xCE, 0xB4,
-  0x91, 0x70, 0x5E, 0x5E, 0x77, 0x95, 0xA5, 0xAA, 0xA8, 0x7E, 0x46, 0x2A,
-  0x1D, 0x3C, 0x67, 0x8C, 0xAE, 0xCE, 0xCB, 0xB3, 0x86, 0x52, 0x46, 0x4D,
-  0x62, 0x7D, 0x97, 0x9E, 0x8F, 0x70, 0x4C, 0x30, 0x26, 0x31, 0x4E, 0x73,
-  0x8C, 0x93, 0x89, 0x6E, 0x4A, 0x31, 0x2F, 0x42, 0x63, 0x88, 0xA4, 0xB1,
-  0xA7, 0x86, 0x68, 0x59, 0x53, 0x65, 0x8E, 0xB6, 0xC9, 0xD0, 0xCA, 0xAA,
-  0x83, 0x6E, 0x6D, 0x7E, 0xA0, 0xC4, 0xD8, 0xD7, 0xC4, 0x9E, 0x78, 0x62,
-  0x5E, 0x6E, 0x91, 0xB6, 0xC0, 0xB8, 0xA6, 0x82, 0x58, 0x40, 0x42, 0x50,
-  0x68, 0x89, 0x9D, 0x97, 0x7C, 0x57, 0x35, 0x23, 0x25, 0x3C, 0x63, 0x89,
-  0x9B, 0x98, 0x86, 0x68, 0x49, 0x3B, 0x4B, 0x6D, 0x91, 0xB0, 0xC9, 0xCD,
-  0xB5, 0x91, 0x75, 0x69, 0x6D, 0x8A, 0xB1, 0xCC, 0xD4, 0xCC, 0xB0, 0x8C,
-  0x6B, 0x5A, 0x5E, 0x7B, 0x96, 0xA7, 0xAC, 0xA7, 0x7A, 0x45, 0x29, 0x20,
-  0x42, 0x6B, 0x90, 0xB2, 0xCF, 0xC8, 0xAD, 0x7A, 0x4C, 0x44, 0x4D, 0x64,
-  0x81, 0x9B, 0x9E, 0x8E, 0x6E, 0x4A, 0x2E, 0x27, 0x35, 0x56, 0x7B, 0x92,
-  0x97, 0x8A, 0x6D, 0x48, 0x32, 0x31, 0x45, 0x69, 0x8E, 0xA9, 0xB3, 0xA5,
-  0x82, 0x65, 0x56, 0x54, 0x68, 0x93, 0xBA, 0xCB, 0xD1, 0xC8, 0xA5, 0x7E,
-  0x6B, 0x6C, 0x80, 0xA2, 0xC7, 0xD8, 0xD6, 0xC1, 0x9A, 0x76, 0x62, 0x60,
-  0x71, 0x97, 0xB9, 0xC1, 0xB7, 0xA3, 0x7E, 0x54, 0x3E, 0x41, 0x51, 0x6B,
-  0x8E, 0x9D, 0x95, 0x78, 0x52, 0x32, 0x22, 0x27, 0x40, 0x68, 0x8D, 0x9C,
-  0x97, 0x84, 0x64, 0x45, 0x3B, 0x4D, 0x70, 0x94, 0xB4, 0xCB, 0xCA, 0xB1,
-  0x8C, 0x71, 0x64, 0x6C, 0x8D, 0xB4, 0xCD, 0xD4, 0xC8, 0xAA, 0x85, 0x66,
-  0x58, 0x5F, 0x7D, 0x99, 0xAA, 0xAF, 0xA5, 0x74, 0x43, 0x28, 0x24, 0x47,
-  0x6F, 0x95, 0xB7, 0xCF, 0xC4, 0xA7, 0x72, 0x49, 0x43, 0x50, 0x68, 0x87,
-  0x9F, 0xA0, 0x8E, 0x6B, 0x48, 0x2E, 0x29, 0x38, 0x5B, 0x80, 0x96, 0x99,
-  0x89, 0x69, 0x45, 0x30, 0x32, 0x49, 0x6D, 0x92, 0xAB, 0xB4, 0xA3, 0x7F,
-  0x63, 0x53, 0x53, 0x6B, 0x97, 0xBB, 0xCB, 0xD1, 0xC3, 0x9E, 0x79, 0x67,
-  0x6B, 0x80, 0xA6, 0xCA, 0xD8, 0xD4, 0xBD, 0x95, 0x71, 0x5F, 0x60, 0x75,
-  0x9C, 0xBC, 0xC1, 0xB7, 0xA1, 0x79, 0x50, 0x3F, 0x43, 0x55, 0x71, 0x92,
-  0x9E, 0x92, 0x74, 0x4F, 0x30, 0x22, 0x28, 0x45, 0x71, 0x94, 0xA2, 0x9B,
-  0x84, 0x60, 0x42, 0x38, 0x4C, 0x70, 0x94, 0xB5, 0xC8, 0xC3, 0xA6, 0x7E,
-  0x63, 0x59, 0x65, 0x87, 0xB0, 0xCA, 0xD0, 0xC3, 0xA2, 0x7B, 0x5C, 0x51,
-  0x5C, 0x7D, 0x9D, 0xAE, 0xB3, 0xA6, 0x73, 0x45, 0x2B, 0x2A, 0x4C, 0x74,
-  0x9B, 0xBC, 0xCE, 0xC0, 0x9F, 0x6B, 0x46, 0x43, 0x51, 0x6D, 0x90, 0xA6,
-  0xA7, 0x92, 0x6D, 0x47, 0x2F, 0x2C, 0x3F, 0x65, 0x8A, 0x9F, 0xA0, 0x8F,
-  0x6B, 0x45, 0x31, 0x34, 0x4E, 0x75, 0x9A, 0xB1, 0xB6, 0xA1, 0x7B, 0x5C,
-  0x4E, 0x4F, 0x6B, 0x98, 0xBB, 0xCB, 0xCD, 0xBB, 0x93, 0x6D, 0x5E, 0x63,
-  0x7C, 0xA4, 0xC7, 0xD5, 0xCF, 0xB6, 0x8B, 0x68, 0x57, 0x5B, 0x75, 0x9E,
-  0xBE, 0xC3, 0xB8, 0x9E, 0x74, 0x4D, 0x3E, 0x46, 0x5A, 0x7D, 0x9E, 0xA8,
-  0x9B, 0x7A, 0x52, 0x33, 0x27, 0x31, 0x51, 0x7A, 0x9A, 0xA2, 0x9A, 0x81,
-  0x60, 0x45, 0x3F, 0x55, 0x75, 0x99, 0xB5, 0xC4, 0xC1, 0xBF, 0xC1, 0xC2,
-  0xC0, 0xBE, 0xBF, 0xBE, 0xBC, 0xBA, 0xB7, 0xB6, 0xB5, 0xB0, 0xAB, 0xA9,
-  0xAA, 0xA1, 0x9B, 0x9A, 0x98, 0x84, 0x7D, 0x7C, 0x84, 0x95, 0x98, 0x96,
-  0xA1, 0xAE, 0xAD, 0xAC, 0x9A, 0x90, 0x8F, 0x8C, 0x84, 0x80, 0x81, 0x7C,
-  0x78, 0x76, 0x77, 0x75, 0x74, 0x73, 0x72, 0x70, 0x70, 0x6F, 0x70, 0x73,
-  0x74, 0x74, 0x75, 0x78, 0x77, 0x78, 0x7D, 0x80, 0x7F, 0x81, 0x89, 0x8B,
-  0x89, 0x8D, 0x92, 0x92, 0x91, 0x95, 0x98, 0x97, 0x97, 0x98, 0x98, 0x96,
-  0x97, 0x98, 0x97, 0x96, 0x94, 0x91, 0x90, 0x8F, 0x8C, 0x8A, 0x8A, 0x88,
-  0x82, 0x80, 0x80, 0x7C, 0x76, 0x75, 0x75, 0x6C, 0x65, 0x66, 0x65, 0x60,
-  0x5D, 0x5F, 0x5E, 0x5C, 0x5C, 0x5D, 0x5F, 0x63, 0x63, 0x64, 0x69, 0x6E,
-  0x6E, 0x71, 0x7A, 0x7E, 0x7D, 0x83, 0x8C, 0x8B, 0x8B, 0x8D, 0x90, 0x8F,
-  0x8F, 0x90, 0x90, 0x8F, 0x8E, 0x8B, 0x8A, 0x89, 0x84, 0x7E, 0x7E, 0x7D,
-  0x76, 0x70, 0x71, 0x6E, 0x5D, 0x5A, 0x59, 0x62, 0x71, 0x73, 0x74, 0x7F,
-  0x8A, 0x89, 0x88, 0x79, 0x73, 0x73, 0x71, 0x6C, 0x6A, 0x6B, 0x68, 0x65,
-  0x65, 0x65, 0x63, 0x64, 0x63, 0x64, 0x62, 0x62, 0x62, 0x64, 0x67, 0x68,
-  0x68, 0x6A, 0x6D, 0x6D, 0x6E, 0x73, 0x76, 0x75, 0x78, 0x7F, 0x80, 0x80,
-  0x83, 0x88, 0x88, 0x88, 0x8C, 0x8E, 0x8D, 0x8D, 0x8E, 0x8F, 0x8E, 0x8E,
-  0x90, 0x8F, 0x8E, 0x8C, 0x8A, 0x8A, 0x88, 0x86, 0x85, 0x85, 0x83, 0x7E,
-  0x7C, 0x7D, 0x79, 0x74, 0x74, 0x74, 0x6C, 0x67, 0x68, 0x66, 0x63, 0x61,
-  0x63, 0x62, 0x61, 0x62, 0x63, 0x65, 0x67, 0x68, 0x69, 0x6E, 0x72, 0x71,
-  0x75, 0x7D, 0x80, 0x7F, 0x85, 0x8C, 0x8B, 0x8C, 0x8E, 0x91, 0x90, 0x90,
-  0x91, 0x91, 0x90, 0x90, 0x8C, 0x8C, 0x8B, 0x88, 0x84, 0x84, 0x82, 0x7A,
-  0x75, 0x76, 0x70, 0x5F, 0x5E, 0x5C, 0x68, 0x77, 0x78, 0x79, 0x83, 0x8A,
-  0x8A, 0x88, 0x7B, 0x77, 0x77, 0x75, 0x70, 0x6F, 0x6F, 0x6D, 0x6A, 0x6B,
-  0x6A, 0x6A, 0x69, 0x6A, 0x6A, 0x68, 0x69, 0x69, 0x6C, 0x6E, 0x6F, 0x70,
-  0x72, 0x74, 0x73, 0x75, 0x7A, 0x7B, 0x7A, 0x7E, 0x83, 0x84, 0x83, 0x87,
-  0x8A, 0x8A, 0x8A, 0x8E, 0x8F, 0x8E, 0x8F, 0x90, 0x90, 0x8F, 0x90, 0x91,
-  0x90, 0x90, 0x8E, 0x8C, 0x8C, 0x8A, 0x88, 0x87, 0x87, 0x85, 0x81, 0x80,
-  0x80, 0x7C, 0x78, 0x79, 0x78, 0x71, 0x6E, 0x6E, 0x6D, 0x69, 0x69, 0x6A,
-  0x68, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x6D, 0x6F, 0x73, 0x75, 0x75, 0x7A,
-  0x80, 0x81, 0x82, 0x87, 0x8D, 0x8C, 0x8D, 0x90, 0x91, 0x90, 0x90, 0x91,
-  0x91, 0x90, 0x8F, 0x8D, 0x8D, 0x8C, 0x88, 0x86, 0x86, 0x84, 0x7D, 0x7A,
-  0x7B, 0x74, 0x68, 0x67, 0x66, 0x72, 0x7C, 0x7C, 0x7E, 0x89, 0x8F, 0x8E,
-  0x8A, 0x7D, 0x7A, 0x7A, 0x76, 0x71, 0x72, 0x71, 0x70, 0x6F, 0x70, 0x71,
-  0x70, 0x6F, 0x70, 0x70, 0x6F, 0x70, 0x6F, 0x72, 0x73, 0x73, 0x73, 0x75,
-  0x76, 0x76, 0x78, 0x7B, 0x7C, 0x7B, 0x7E, 0x81, 0x83, 0x82, 0x87, 0x89,
-  0x88, 0x89, 0x8B, 0x8C, 0x8B, 0x8C, 0x8C, 0x8D, 0x8C, 0x8C, 0x8D, 0x8D,
-  0x8C, 0x8B, 0x8A, 0x89, 0x89, 0x87, 0x86, 0x87, 0x84, 0x81, 0x82, 0x81,
-  0x7E, 0x7C, 0x7C, 0x7B, 0x76, 0x74, 0x75, 0x73, 0x71, 0x70, 0x71, 0x70,
-  0x70, 0x6F, 0x70, 0x72, 0x73, 0x73, 0x75, 0x77, 0x79, 0x78, 0x7C, 0x81,
-  0x81, 0x82, 0x85, 0x89, 0x88, 0x89, 0x8B, 0x8C, 0x8A, 0x8B, 0x8B, 0x8C,
-  0x8B, 0x8B, 0x89, 0x89, 0x88, 0x87, 0x85, 0x85, 0x83, 0x7E, 0x7D, 0x7E,
-  0x78, 0x6F, 0x6F, 0x6F, 0x78, 0x7E, 0x7E, 0x80, 0x88, 0x8B, 0x8B, 0x88,
-  0x7F, 0x7E, 0x7E, 0x7B, 0x77, 0x78, 0x77, 0x75, 0x73, 0x74, 0x74, 0x73,
-  0x72, 0x73, 0x72, 0x70, 0x71, 0x70, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A,
-  0x79, 0x7B, 0x7D, 0x7D, 0x7E, 0x80, 0x82, 0x81, 0x82, 0x85, 0x86, 0x85,
-  0x86, 0x87, 0x88, 0x87, 0x88, 0x89, 0x88, 0x89, 0x88, 0x88, 0x89, 0x8A,
-  0x89, 0x88, 0x87, 0x88, 0x86, 0x85, 0x86, 0x84, 0x82, 0x83, 0x82, 0x80,
-  0x7E, 0x7F, 0x7D, 0x7A, 0x79, 0x79, 0x77, 0x76, 0x77, 0x76, 0x76, 0x75,
-  0x76, 0x77, 0x78, 0x78, 0x78, 0x7A, 0x7C, 0x7B, 0x7C, 0x7F, 0x81, 0x81,
-  0x82, 0x85, 0x87, 0x86, 0x86, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x87,
-  0x87, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83, 0x81, 0x7E, 0x7D, 0x7D, 0x77,
-  0x73, 0x73, 0x75, 0x7B, 0x7F, 0x7F, 0x82, 0x88, 0x88, 0x89, 0x84, 0x80,
-  0x7F, 0x7E, 0x7C, 0x7A, 0x7B, 0x7A, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77,
-  0x78, 0x77, 0x77, 0x76, 0x77, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7C,
-  0x7C, 0x7E, 0x7D, 0x7E, 0x80, 0x82, 0x81, 0x82, 0x83, 0x83, 0x82, 0x83,
-  0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
-  0x82, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x7F,
-  0x80, 0x7F, 0x7D, 0x7D, 0x7E, 0x7D, 0x7C, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B,
-  0x7C, 0x7D, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x81, 0x82, 0x81, 0x82,
-  0x83, 0x84, 0x83, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84, 0x85, 0x84, 0x83,
-  0x82, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7A, 0x79,
-  0x79, 0x7A, 0x7E, 0x7F, 0x7E, 0x80, 0x83, 0x83, 0x84, 0x81, 0x7F, 0x7F,
-  0x7E, 0x7D, 0x7C, 0x7D, 0x7C, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7C,
-  0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7D, 0x7F,
-  0x80, 0x7F, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x83, 0x84,
-  0x83, 0x84, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x7F, 0x7D, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x80, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E,
-  0x7F, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7D, 0x80, 0x65, 0x45, 0x2F,
-  0x1C, 0x13, 0x13, 0x20, 0x33, 0x50, 0x65, 0x71, 0x73, 0x6B, 0x5C, 0x44,
-  0x35, 0x2C, 0x2F, 0x3B, 0x4E, 0x69, 0x7B, 0x85, 0x84, 0x79, 0x62, 0x48,
-  0x37, 0x2E, 0x34, 0x44, 0x5F, 0x7D, 0x91, 0x9B, 0x96, 0x86, 0x69, 0x4B,
-  0x39, 0x32, 0x3D, 0x51, 0x71, 0x90, 0xA4, 0xAC, 0xA3, 0x8E, 0x6B, 0x4E,
-  0x3B, 0x38, 0x46, 0x5F, 0x82, 0xA0, 0xB2, 0xB5, 0xA8, 0x91, 0x6D, 0x51,
-  0x40, 0x41, 0x51, 0x6D, 0x92, 0xAC, 0xBB, 0xBA, 0xAC, 0x90, 0x6C, 0x52,
-  0x44, 0x48, 0x5B, 0x7A, 0x9F, 0xB6, 0xC1, 0xBD, 0xAC, 0x8D, 0x6A, 0x54,
-  0x48, 0x50, 0x65, 0x86, 0xA8, 0xBE, 0xC6, 0xBE, 0xAB, 0x88, 0x68, 0x54,
-  0x4C, 0x58, 0x6F, 0x92, 0xB1, 0xC3, 0xC9, 0xBD, 0xA6, 0x83, 0x65, 0x53,
-  0x4F, 0x5E, 0x77, 0x9A, 0xB7, 0xC6, 0xC8, 0xBA, 0xA1, 0x7C, 0x61, 0x51,
-  0x52, 0x63, 0x7F, 0xA3, 0xBB, 0xC8, 0xC4, 0xB5, 0x98, 0x75, 0x5C, 0x4F,
-  0x54, 0x67, 0x87, 0xA9, 0xC0, 0xCA, 0xC3, 0xB1, 0x92, 0x6F, 0x58, 0x4E,
-  0x57, 0x6D, 0x8F, 0xAE, 0xC2, 0xCA, 0xC0, 0xAB, 0x89, 0x69, 0x54, 0x4E,
-  0x5B, 0x73, 0x96, 0xB4, 0xC5, 0xC9, 0xBD, 0xA6, 0x83, 0x65, 0x52, 0x50,
-  0x60, 0x7A, 0x9F, 0xB9, 0xC7, 0xC7, 0xB9, 0x9F, 0x7B, 0x5F, 0x4F, 0x51,
-  0x63, 0x81, 0xA4, 0xBC, 0xC8, 0xC4, 0xB3, 0x95, 0x72, 0x59, 0x4C, 0x53,
-  0x68, 0x88, 0xA9, 0xBF, 0xC8, 0xC0, 0xAC, 0x8B, 0x6A, 0x54, 0x4A, 0x55,
-  0x6B, 0x8D, 0xAE, 0xC0, 0xC7, 0xBC, 0xA5, 0x83, 0x63, 0x4F, 0x4A, 0x58,
-  0x71, 0x95, 0xB2, 0xC3, 0xC5, 0xB8, 0x9F, 0x7A, 0x5E, 0x4B, 0x4B, 0x5C,
-  0x77, 0x9D, 0xB7, 0xC5, 0xC3, 0xB4, 0x98, 0x72, 0x58, 0x4A, 0x4E, 0x60,
-  0x7F, 0xA2, 0xBA, 0xC6, 0xC0, 0xAE, 0x8F, 0x6B, 0x53, 0x47, 0x50, 0x65,
-  0x86, 0xA8, 0xBC, 0xC5, 0xBD, 0xA7, 0x85, 0x63, 0x4D, 0x46, 0x52, 0x69,
-  0x8D, 0xAC, 0xBF, 0xC4, 0xB8, 0xA0, 0x7C, 0x5D, 0x4A, 0x45, 0x55, 0x6E,
-  0x93, 0xB1, 0xC1, 0xC2, 0xB4, 0x99, 0x73, 0x58, 0x47, 0x47, 0x59, 0x76,
-  0x9B, 0xB5, 0xC3, 0xC0, 0xAF, 0x91, 0x6C, 0x54, 0x46, 0x4B, 0x5F, 0x7E,
-  0xA3, 0xBA, 0xC4, 0xBE, 0xAB, 0x8A, 0x66, 0x4F, 0x44, 0x4E, 0x63, 0x85,
-  0xA8, 0xBC, 0xC3, 0xBA, 0xA3, 0x80, 0x60, 0x4A, 0x43, 0x50, 0x69, 0x8E,
-  0xAC, 0xBE, 0xC2, 0xB4, 0x9C, 0x78, 0x58, 0x46, 0x44, 0x53, 0x6F, 0x93,
-  0xAF, 0xBF, 0xBF, 0xB0, 0x94, 0x6E, 0x53, 0x43, 0x45, 0x57, 0x75, 0x9A,
-  0xB4, 0xC0, 0xBD, 0xAA, 0x8C, 0x67, 0x4E, 0x41, 0x48, 0x5C, 0x7D, 0xA1,
-  0xB7, 0xC0, 0xBA, 0xA6, 0x83, 0x61, 0x4B, 0x41, 0x4C, 0x63, 0x86, 0xA7,
-  0xBA, 0xC1, 0xB6, 0xA0, 0x7B, 0x5A, 0x47, 0x41, 0x50, 0x69, 0x8E, 0xAB,
-  0xBD, 0xBF, 0xB2, 0x98, 0x72, 0x56, 0x44, 0x43, 0x53, 0x6E, 0x96, 0xB1,
-  0xC0, 0xBF, 0xAE, 0x91, 0x6C, 0x50, 0x40, 0x44, 0x58, 0x77, 0x9C, 0xB4,
-  0xC0, 0xBB, 0xA9, 0x88, 0x64, 0x4B, 0x3F, 0x47, 0x5C, 0x7F, 0xA2, 0xB7,
-  0xC1, 0xB8, 0xA3, 0x80, 0x5E, 0x47, 0x3F, 0x4B, 0x64, 0x89, 0xAA, 0xBD,
-  0xC1, 0xB5, 0x9D, 0x78, 0x5A, 0x45, 0x41, 0x50, 0x6B, 0x90, 0xAD, 0xBE,
-  0xC0, 0xB0, 0x96, 0x70, 0x52, 0x42, 0x42, 0x54, 0x71, 0x97, 0xB1, 0xBF,
-  0xBD, 0xAB, 0x8D, 0x68, 0x4D, 0x3F, 0x44, 0x58, 0x78, 0x9D, 0xB4, 0xBF,
-  0xB9, 0xA5, 0x84, 0x60, 0x48, 0x3D, 0x47, 0x5D, 0x80, 0xA3, 0xB8, 0xBF,
-  0xB5, 0x9F, 0x7B, 0x5A, 0x44, 0x3D, 0x4B, 0x64, 0x89, 0xA8, 0xBA, 0xBF,
-  0xB1, 0x98, 0x73, 0x55, 0x42, 0x40, 0x51, 0x6B, 0x91, 0xAE, 0xBD, 0xBE,
-  0xAE, 0x91, 0x6D, 0x50, 0x40, 0x42, 0x54, 0x73, 0x98, 0xB2, 0xBF, 0xBB,
-  0xA9, 0x8A, 0x65, 0x4C, 0x3D, 0x44, 0x5A, 0x7B, 0x9E, 0xB6, 0xC1, 0xB9,
-  0xA4, 0x81, 0x5E, 0x46, 0x3D, 0x47, 0x5F, 0x83, 0xA4, 0xB9, 0xC0, 0xB5,
-  0x9D, 0x78, 0x58, 0x43, 0x3D, 0x4C, 0x65, 0x8B, 0xAA, 0xBB, 0xBF, 0xB1,
-  0x96, 0x70, 0x52, 0x40, 0x3F, 0x51, 0x6D, 0x93, 0xAF, 0xBF, 0xBE, 0xAE,
-  0x91, 0x6A, 0x4F, 0x3E, 0x43, 0x57, 0x76, 0x9C, 0xB4, 0xC1, 0xBB, 0xA8,
-  0x88, 0x63, 0x4A, 0x3E, 0x46, 0x5B, 0x7E, 0xA1, 0xB8, 0xC1, 0xB7, 0xA2,
-  0x7E, 0x5C, 0x46, 0x3D, 0x49, 0x61, 0x86, 0xA7, 0xBA, 0xBF, 0xB3, 0x9A,
-  0x76, 0x55, 0x41, 0x3D, 0x4D, 0x68, 0x8D, 0xAA, 0xBC, 0xBE, 0xAE, 0x93,
-  0x6D, 0x50, 0x3E, 0x3F, 0x52, 0x6F, 0x95, 0xB0, 0xBE, 0xBB, 0xA9, 0x8C,
-  0x67, 0x4C, 0x3D, 0x42, 0x57, 0x79, 0x9D, 0xB5, 0xC0, 0xB9, 0xA6, 0x84,
-  0x60, 0x49, 0x3D, 0x47, 0x5D, 0x80, 0xA3, 0xB8, 0xC0, 0xB6, 0x9F, 0x7C,
-  0x5A, 0x44, 0x3D, 0x4A, 0x64, 0x88, 0xA8, 0xBB, 0xBF, 0xB2, 0x9A, 0x74,
-  0x55, 0x41, 0x3E, 0x4F, 0x6A, 0x91, 0xAE, 0xBE, 0xBE, 0xAD, 0x91, 0x6B,
-  0x4F, 0x3E, 0x3F, 0x53, 0x72, 0x97, 0xB1, 0xBF, 0xBB, 0xA8, 0x89, 0x64,
-  0x4A, 0x3C, 0x43, 0x58, 0x79, 0x9E, 0xB5, 0xC1, 0xB9, 0xA4, 0x82, 0x5F,
-  0x48, 0x3D, 0x48, 0x60, 0x84, 0xA6, 0xBA, 0xC1, 0xB6, 0x9E, 0x7A, 0x59,
-  0x43, 0x3D, 0x4C, 0x66, 0x8C, 0xAB, 0xBD, 0xBF, 0xB1, 0x97, 0x71, 0x53,
-  0x40, 0x3E, 0x50, 0x6D, 0x93, 0xAF, 0xBF, 0xBD, 0xAC, 0x8F, 0x68, 0x4D,
-  0x3D, 0x41, 0x54, 0x73, 0x99, 0xB2, 0xC0, 0xBA, 0xA6, 0x86, 0x61, 0x48,
-  0x3C, 0x44, 0x59, 0x7C, 0xA0, 0xB6, 0xC0, 0xB7, 0xA1, 0x7E, 0x5B, 0x44,
-  0x3B, 0x48, 0x60, 0x85, 0xA6, 0xBA, 0xC1, 0xB4, 0x9C, 0x76, 0x56, 0x42,
-  0x3D, 0x4D, 0x69, 0x8E, 0xAC, 0xBD, 0xBE, 0xAF, 0x94, 0x6E, 0x51, 0x3E,
-  0x3F, 0x51, 0x70, 0x96, 0xB0, 0xBF, 0xBC, 0xAA, 0x8C, 0x67, 0x4D, 0x3E,
-  0x43, 0x58, 0x77, 0x9C, 0xB5, 0xC0, 0xBA, 0xA6, 0x84, 0x5F, 0x46, 0x3B,
-  0x45, 0x5C, 0x7F, 0xA2, 0xB8, 0xC0, 0xB6, 0xA0, 0x7B, 0x59, 0x42, 0x3B,
-  0x49, 0x62, 0x88, 0xA8, 0xBB, 0xBF, 0xB2, 0x99, 0x73, 0x54, 0x40, 0x3E,
-  0x4F, 0x6C, 0x92, 0xAE, 0xBF, 0xBF, 0xAF, 0x92, 0x6C, 0x50, 0x3E, 0x41,
-  0x54, 0x73, 0x98, 0xB3, 0xC1, 0xBD, 0xAA, 0x89, 0x65, 0x4A, 0x3C, 0x44,
-  0x58, 0x7B, 0x9F, 0xB6, 0xC1, 0xB8, 0xA4, 0x82, 0x5E, 0x45, 0x3B, 0x46,
-  0x5E, 0x82, 0xA5, 0xB9, 0xC0, 0xB4, 0x9D, 0x78, 0x57, 0x42, 0x3C, 0x4A,
-  0x65, 0x8A, 0xA9, 0xBC, 0xBF, 0xB0, 0x95, 0x6F, 0x52, 0x3E, 0x3E, 0x50,
-  0x6C, 0x92, 0xAF, 0xBE, 0xBD, 0xAB, 0x8E, 0x69, 0x4D, 0x3D, 0x41, 0x55,
-  0x75, 0x9B, 0xB3, 0xC0, 0xBB, 0xA8, 0x87, 0x62, 0x49, 0x3B, 0x45, 0x5B,
-  0x7D, 0xA0, 0xB7, 0xC0, 0xB6, 0xA1, 0x7F, 0x5C, 0x45, 0x3C, 0x4A, 0x64,
-  0x89, 0xAB, 0xBF, 0xC4, 0xB8, 0x9E, 0x78, 0x58, 0x42, 0x3D, 0x4D, 0x68,
-  0x8E, 0xAD, 0xBE, 0xC0, 0xB1, 0x96, 0x70, 0x51, 0x3E, 0x3E, 0x51, 0x6F,
-  0x95, 0xB1, 0xC0, 0xBE, 0xAC, 0x8D, 0x67, 0x4C, 0x3C, 0x41, 0x56, 0x77,
-  0x9D, 0xB6, 0xC3, 0xBC, 0xA8, 0x86, 0x62, 0x49, 0x3C, 0x46, 0x5D, 0x80,
-  0xA3, 0xBA, 0xC2, 0xB7, 0xA1, 0x7C, 0x5A, 0x44, 0x3C, 0x4A, 0x62, 0x88,
-  0xA9, 0xBC, 0xC1, 0xB4, 0x9A, 0x74, 0x54, 0x40, 0x3D, 0x4D, 0x69, 0x90,
-  0xAE, 0xBE, 0xBE, 0xAE, 0x91, 0x6B, 0x4E, 0x3C, 0x3E, 0x51, 0x71, 0x97,
-  0xB1, 0xBF, 0xBB, 0xA9, 0x89, 0x63, 0x49, 0x3B, 0x41, 0x57, 0x79, 0x9D,
-  0xB5, 0xC0, 0xB8, 0xA3, 0x80, 0x5D, 0x45, 0x3A, 0x46, 0x5D, 0x82, 0xA5,
-  0xBA, 0xC2, 0xB6, 0x9E, 0x79, 0x57, 0x41, 0x3B, 0x49, 0x63, 0x8B, 0xAC,
-  0xBE, 0xC1, 0xB2, 0x97, 0x71, 0x54, 0x43, 0x44, 0x53, 0x6F, 0x8C, 0x91,
-  0x90, 0x9A, 0x9C, 0xA6, 0xB4, 0xB3, 0xC6, 0xC8, 0xCB, 0xD0, 0xCD, 0xD0,
-  0xCE, 0xCA, 0xC3, 0xC1, 0xB4, 0xB4, 0xA1, 0x97, 0x8C, 0x6C, 0x60, 0x7E,
-  0x92, 0x9E, 0xC0, 0xC8, 0xA9, 0x91, 0x8C, 0x78, 0x77, 0x6B, 0x64, 0x63,
-  0x5E, 0x5F, 0x59, 0x58, 0x5B, 0x63, 0x62, 0x6A, 0x6B, 0x71, 0x7E, 0x7E,
-  0x8F, 0x96, 0x9D, 0xA9, 0xA8, 0xB4, 0xB5, 0xB7, 0xBA, 0xB9, 0xBC, 0xBC,
-  0xB6, 0xAF, 0xAE, 0xA5, 0xA4, 0x99, 0x8F, 0x8C, 0x7A, 0x79, 0x67, 0x57,
-  0x55, 0x48, 0x48, 0x43, 0x40, 0x42, 0x4B, 0x4D, 0x59, 0x60, 0x68, 0x80,
-  0x81, 0x95, 0xA0, 0xA2, 0xAC, 0xAA, 0xAF, 0xAE, 0xAD, 0xA3, 0xA4, 0x96,
-  0x94, 0x85, 0x73, 0x6E, 0x49, 0x32, 0x4B, 0x6F, 0x78, 0x9A, 0xAD, 0x93,
-  0x74, 0x71, 0x5E, 0x59, 0x53, 0x48, 0x4A, 0x43, 0x46, 0x41, 0x3F, 0x41,
-  0x49, 0x4B, 0x51, 0x56, 0x59, 0x68, 0x6A, 0x78, 0x84, 0x86, 0x96, 0x95,
-  0x9E, 0xA4, 0xA4, 0xA9, 0xA7, 0xAA, 0xAB, 0xA7, 0xA0, 0x9F, 0x98, 0x95,
-  0x90, 0x83, 0x83, 0x73, 0x6E, 0x65, 0x51, 0x50, 0x44, 0x41, 0x3F, 0x3B,
-  0x3D, 0x44, 0x48, 0x51, 0x5D, 0x5E, 0x76, 0x7C, 0x88, 0x9B, 0x9A, 0xA6,
-  0xA5, 0xA8, 0xA9, 0xA9, 0xA2, 0xA2, 0x98, 0x92, 0x8C, 0x75, 0x72, 0x57,
-  0x37, 0x47, 0x6C, 0x75, 0x8F, 0xAA, 0x9C, 0x7A, 0x72, 0x65, 0x5B, 0x59,
-  0x4B, 0x4E, 0x49, 0x49, 0x47, 0x43, 0x44, 0x4B, 0x4F, 0x53, 0x5A, 0x5A,
-  0x66, 0x6B, 0x74, 0x84, 0x85, 0x94, 0x97, 0x9C, 0xA7, 0xA6, 0xAA, 0xA9,
-  0xAC, 0xAE, 0xAC, 0xA7, 0xA3, 0x9F, 0x99, 0x98, 0x89, 0x87, 0x7D, 0x72,
-  0x6E, 0x57, 0x55, 0x4C, 0x45, 0x46, 0x40, 0x41, 0x47, 0x4D, 0x51, 0x60,
-  0x62, 0x75, 0x82, 0x88, 0x9E, 0x9E, 0xA8, 0xAB, 0xAC, 0xAE, 0xAE, 0xA7,
-  0xA5, 0x9F, 0x94, 0x93, 0x7C, 0x76, 0x64, 0x40, 0x40, 0x68, 0x76, 0x86,
-  0xA7, 0xA4, 0x84, 0x75, 0x6D, 0x5E, 0x5F, 0x51, 0x51, 0x4D, 0x4B, 0x4C,
-  0x47, 0x47, 0x4C, 0x52, 0x53, 0x5A, 0x5C, 0x66, 0x6E, 0x72, 0x83, 0x85,
-  0x90, 0x99, 0x9A, 0xA6, 0xA5, 0xA9, 0xAA, 0xAB, 0xAE, 0xAD, 0xA8, 0xA4,
-  0xA1, 0x9B, 0x9A, 0x8F, 0x89, 0x84, 0x77, 0x77, 0x62, 0x5B, 0x56, 0x4C,
-  0x4C, 0x48, 0x47, 0x4B, 0x52, 0x54, 0x61, 0x65, 0x71, 0x84, 0x86, 0x9C,
-  0xA0, 0xA5, 0xAC, 0xAB, 0xAF, 0xAE, 0xAB, 0xA5, 0xA4, 0x97, 0x97, 0x85,
-  0x7A, 0x6D, 0x4A, 0x40, 0x60, 0x78, 0x81, 0xA3, 0xAA, 0x8C, 0x78, 0x74,
-  0x62, 0x62, 0x59, 0x53, 0x53, 0x4E, 0x50, 0x4C, 0x4B, 0x4E, 0x55, 0x56,
-  0x5D, 0x5F, 0x66, 0x71, 0x72, 0x83, 0x89, 0x90, 0x9C, 0x9C, 0xA7, 0xA9,
-  0xAC, 0xAF, 0xAE, 0xB1, 0xB2, 0xAE, 0xA8, 0xA7, 0x9F, 0x9E, 0x96, 0x8C,
-  0x8A, 0x7A, 0x79, 0x6A, 0x5C, 0x5B, 0x4F, 0x4E, 0x4A, 0x48, 0x4B, 0x53,
-  0x56, 0x60, 0x67, 0x6E, 0x83, 0x84, 0x95, 0x9E, 0x9F, 0xA8, 0xA7, 0xAA,
-  0xA9, 0xA9, 0xA0, 0xA2, 0x96, 0x94, 0x88, 0x79, 0x74, 0x56, 0x43, 0x58,
-  0x75, 0x7D, 0x9B, 0xA9, 0x95, 0x7B, 0x78, 0x69, 0x64, 0x60, 0x56, 0x58,
-  0x53, 0x55, 0x51, 0x4F, 0x50, 0x58, 0x5A, 0x60, 0x64, 0x67, 0x73, 0x74,
-  0x80, 0x8B, 0x8E, 0x9B, 0x9B, 0xA3, 0xA9, 0xA9, 0xAD, 0xAB, 0xAE, 0xAF,
-  0xAD, 0xA7, 0xA5, 0xA0, 0x9C, 0x98, 0x8D, 0x8C, 0x7E, 0x7B, 0x73, 0x60,
-  0x5F, 0x54, 0x52, 0x50, 0x4D, 0x4E, 0x55, 0x57, 0x5E, 0x69, 0x6A, 0x7F,
-  0x84, 0x8F, 0xA0, 0x9F, 0xA8, 0xA9, 0xAB, 0xAC, 0xAC, 0xA5, 0xA5, 0x9C,
-  0x96, 0x91, 0x7D, 0x7A, 0x61, 0x46, 0x51, 0x72, 0x7C, 0x94, 0xAB, 0x9E,
-  0x81, 0x7A, 0x71, 0x66, 0x65, 0x59, 0x5B, 0x55, 0x56, 0x55, 0x51, 0x52,
-  0x58, 0x5B, 0x5E, 0x65, 0x65, 0x71, 0x74, 0x7C, 0x8A, 0x8B, 0x98, 0x9B,
-  0x9E, 0xA6, 0xA5, 0xAA, 0xA9, 0xAA, 0xAD, 0xAB, 0xA5, 0xA3, 0x9E, 0x9A,
-  0x98, 0x8C, 0x8A, 0x81, 0x78, 0x75, 0x63, 0x60, 0x59, 0x53, 0x53, 0x4F,
-  0x4F, 0x54, 0x59, 0x5C, 0x68, 0x6A, 0x7A, 0x85, 0x89, 0x9B, 0x9C, 0xA4,
-  0xA7, 0xA8, 0xAA, 0xAA, 0xA5, 0xA2, 0x9E, 0x95, 0x94, 0x83, 0x7D, 0x6E,
-  0x4F, 0x50, 0x70, 0x7C, 0x8B, 0xA7, 0xA5, 0x89, 0x7C, 0x75, 0x67, 0x69,
-  0x5D, 0x5D, 0x5A, 0x58, 0x58, 0x54, 0x54, 0x58, 0x5E, 0x5F, 0x65, 0x66,
-  0x6E, 0x75, 0x79, 0x88, 0x8A, 0x93, 0x9A, 0x9B, 0xA5, 0xA5, 0xA9, 0xA9,
-  0xAA, 0xAC, 0xAB, 0xA7, 0xA3, 0xA1, 0x9B, 0x9B, 0x90, 0x8C, 0x87, 0x7A,
-  0x79, 0x67, 0x60, 0x5D, 0x54, 0x55, 0x51, 0x4F, 0x53, 0x59, 0x5B, 0x67,
-  0x6A, 0x74, 0x85, 0x87, 0x9B, 0x9E, 0xA3, 0xA8, 0xA8, 0xAB, 0xAB, 0xA8,
-  0xA3, 0xA2, 0x95, 0x97, 0x86, 0x7C, 0x75, 0x56, 0x4A, 0x67, 0x7B, 0x83,
-  0x9E, 0xA5, 0x8F, 0x7C, 0x78, 0x6A, 0x69, 0x62, 0x5D, 0x5D, 0x58, 0x5A,
-  0x56, 0x55, 0x57, 0x5D, 0x5E, 0x64, 0x65, 0x6A, 0x73, 0x75, 0x81, 0x87,
-  0x8C, 0x96, 0x97, 0x9F, 0xA2, 0xA3, 0xA5, 0xA4, 0xA7, 0xA8, 0xA4, 0xA0,
-  0xA0, 0x99, 0x98, 0x92, 0x8A, 0x88, 0x7C, 0x7A, 0x6F, 0x63, 0x63, 0x5A,
-  0x59, 0x56, 0x54, 0x56, 0x5C, 0x5E, 0x66, 0x6D, 0x71, 0x83, 0x86, 0x94,
-  0x9D, 0x9F, 0xA6, 0xA5, 0xA8, 0xA8, 0xA7, 0xA1, 0xA1, 0x97, 0x95, 0x8C,
-  0x7E, 0x79, 0x5E, 0x4D, 0x5F, 0x7A, 0x7F, 0x97, 0xA6, 0x94, 0x7E, 0x7A,
-  0x6E, 0x69, 0x66, 0x5D, 0x5E, 0x59, 0x5B, 0x58, 0x57, 0x57, 0x5D, 0x60,
-  0x63, 0x67, 0x69, 0x74, 0x75, 0x80, 0x89, 0x8B, 0x97, 0x98, 0x9E, 0xA3,
-  0xA3, 0xA6, 0xA6, 0xA8, 0xAA, 0xA8, 0xA3, 0xA2, 0x9D, 0x99, 0x97, 0x8D,
-  0x8B, 0x80, 0x7B, 0x75, 0x64, 0x64, 0x5B, 0x58, 0x57, 0x54, 0x55, 0x5B,
-  0x5F, 0x64, 0x6D, 0x6F, 0x80, 0x84, 0x8D, 0x9A, 0x99, 0xA2, 0xA2, 0xA4,
-  0xA4, 0xA3, 0x9D, 0x9D, 0x96, 0x90, 0x8C, 0x7C, 0x7A, 0x66, 0x50, 0x59,
-  0x73, 0x7B, 0x8F, 0xA2, 0x98, 0x80, 0x7A, 0x72, 0x69, 0x69, 0x5F, 0x60,
-  0x5C, 0x5D, 0x5B, 0x59, 0x59, 0x5D, 0x61, 0x63, 0x69, 0x6A, 0x73, 0x77,
-  0x7E, 0x89, 0x8A, 0x95, 0x97, 0x9B, 0xA2, 0xA1, 0xA5, 0xA5, 0xA6, 0xA7,
-  0xA6, 0xA1, 0xA0, 0x9D, 0x98, 0x97, 0x8D, 0x8B, 0x83, 0x7B, 0x79, 0x69,
-  0x66, 0x60, 0x5B, 0x5B, 0x58, 0x57, 0x5B, 0x60, 0x62, 0x6D, 0x6E, 0x7B,
-  0x84, 0x88, 0x98, 0x99, 0xA0, 0xA2, 0xA3, 0xA5, 0xA4, 0xA0, 0x9E, 0x9A,
-  0x92, 0x91, 0x81, 0x7C, 0x6F, 0x55, 0x54, 0x6F, 0x7C, 0x88, 0xA1, 0x9F,
-  0x87, 0x7C, 0x77, 0x6B, 0x6B, 0x62, 0x61, 0x60, 0x5E, 0x5E, 0x5B, 0x5A,
-  0x5E, 0x63, 0x64, 0x69, 0x69, 0x71, 0x77, 0x7A, 0x87, 0x89, 0x91, 0x96,
-  0x94, 0x99, 0x99, 0x9C, 0x9C, 0x9D, 0x9E, 0x9E, 0x9B, 0x98, 0x97, 0x93,
-  0x92, 0x8B, 0x87, 0x84, 0x7B, 0x7A, 0x6F, 0x69, 0x66, 0x60, 0x60, 0x5E,
-  0x5D, 0x5F, 0x63, 0x65, 0x6D, 0x6F, 0x76, 0x82, 0x83, 0x8F, 0x93, 0x97,
-  0x9A, 0x9B, 0x9D, 0x9C, 0x9A, 0x97, 0x97, 0x8E, 0x8F, 0x84, 0x7D, 0x77,
-  0x64, 0x5C, 0x6F, 0x7D, 0x83, 0x97, 0x9C, 0x8C, 0x7F, 0x7B, 0x71, 0x70,
-  0x6B, 0x67, 0x67, 0x65, 0x66, 0x62, 0x61, 0x63, 0x68, 0x69, 0x6C, 0x6E,
-  0x72, 0x79, 0x7A, 0x83, 0x87, 0x8B, 0x92, 0x92, 0x99, 0x9B, 0x9C, 0x9D,
-  0x9D, 0x9E, 0x9F, 0x9C, 0x99, 0x97, 0x93, 0x92, 0x8E, 0x88, 0x87, 0x7E,
-  0x7C, 0x73, 0x6A, 0x69, 0x62, 0x62, 0x60, 0x5E, 0x60, 0x65, 0x66, 0x6C,
-  0x72, 0x74, 0x82, 0x84, 0x8E, 0x95, 0x96, 0x9C, 0x9B, 0x9E, 0x9E, 0x9D,
-  0x98, 0x99, 0x91, 0x91, 0x89, 0x7F, 0x7B, 0x6A, 0x5E, 0x6B, 0x7B, 0x81,
-  0xAE, 0xD1, 0xBF, 0x9B, 0x86, 0x5B, 0x3D, 0x28, 0x16, 0x20, 0x2A, 0x44,
-  0x5F, 0x6F, 0x7A, 0x7F, 0x76, 0x66, 0x4F, 0x3B, 0x3B, 0x3A, 0x50, 0x6C,
-  0x89, 0xB1, 0xC2, 0xD3, 0xD2, 0xC1, 0xA9, 0x8C, 0x7D, 0x75, 0x77, 0x7F,
-  0x95, 0xAD, 0xBF, 0xC6, 0xBA, 0xAE, 0x8D, 0x6B, 0x48, 0x23, 0x1F, 0x21,
-  0x35, 0x53, 0x6A, 0x7B, 0x87, 0x84, 0x7C, 0x6F, 0x54, 0x57, 0x52, 0x60,
-  0x7E, 0x93, 0xBC, 0xD3, 0xE4, 0xE6, 0xDB, 0xBF, 0x9F, 0x7D, 0x67, 0x5E,
-  0x53, 0x60, 0x62, 0x62, 0x7F, 0xAB, 0xAD, 0xB5, 0xB7, 0x8B, 0x57, 0x43,
-  0x38, 0x3C, 0x54, 0x67, 0x80, 0x87, 0x8A, 0x7E, 0x68, 0x4A, 0x35, 0x28,
-  0x24, 0x35, 0x48, 0x71, 0x90, 0xA7, 0xBD, 0xBB, 0xBB, 0xA7, 0x8F, 0x84,
-  0x77, 0x7C, 0x87, 0x9E, 0xC0, 0xD7, 0xE0, 0xE1, 0xD2, 0xB9, 0x9C, 0x75,
-  0x62, 0x4F, 0x4D, 0x5B, 0x61, 0x7C, 0x84, 0x87, 0x84, 0x74, 0x5F, 0x45,
-  0x32, 0x25, 0x32, 0x42, 0x69, 0x93, 0xB1, 0xD4, 0xD8, 0xD8, 0xC8, 0xAE,
-  0x93, 0x80, 0x72, 0x75, 0x81, 0x92, 0xB2, 0xB3, 0xB9, 0xA3, 0x71, 0x5A,
-  0x5D, 0x54, 0x56, 0x72, 0x7B, 0x70, 0x84, 0x99, 0x9A, 0xA0, 0x8B, 0x78,
-  0x56, 0x34, 0x1E, 0x0F, 0x16, 0x2F, 0x52, 0x73, 0x8E, 0x99, 0xA1, 0x9C,
-  0x8B, 0x7D, 0x69, 0x66, 0x69, 0x74, 0x91, 0xAE, 0xD0, 0xE4, 0xEC, 0xE6,
-  0xD2, 0xB0, 0x8E, 0x7A, 0x6A, 0x6D, 0x72, 0x82, 0x9A, 0xA1, 0xAC, 0x9B,
-  0x8A, 0x73, 0x4C, 0x30, 0x18, 0x11, 0x22, 0x3E, 0x5E, 0x86, 0x99, 0xAB,
-  0xB6, 0xA8, 0xA1, 0x89, 0x7C, 0x77, 0x78, 0x88, 0x9C, 0xB4, 0xC6, 0xD2,
-  0xC9, 0xBE, 0x9C, 0x77, 0x57, 0x2D, 0x1E, 0x3F, 0x63, 0x85, 0xB9, 0xCD,
-  0xBD, 0xA8, 0x99, 0x75, 0x58, 0x3C, 0x2B, 0x2D, 0x37, 0x4D, 0x65, 0x7A,
-  0x89, 0x91, 0x88, 0x7D, 0x63, 0x4D, 0x47, 0x42, 0x59, 0x6E, 0x8E, 0xB7,
-  0xC9, 0xDD, 0xDC, 0xCF, 0xB7, 0x98, 0x85, 0x78, 0x75, 0x7C, 0x8F, 0xA7,
-  0xBD, 0xC3, 0xBF, 0xB5, 0x97, 0x7A, 0x50, 0x2D, 0x21, 0x1E, 0x32, 0x4D,
-  0x69, 0x7D, 0x8D, 0x8C, 0x89, 0x7A, 0x61, 0x5E, 0x51, 0x5E, 0x73, 0x89,
-  0xB0, 0xCA, 0xDD, 0xE3, 0xDB, 0xC1, 0xA5, 0x7C, 0x69, 0x55, 0x4C, 0x57,
-  0x56, 0x60, 0x89, 0xAF, 0xB3, 0xC1, 0xBC, 0x8B, 0x5B, 0x46, 0x34, 0x3B,
-  0x4B, 0x62, 0x7F, 0x89, 0x91, 0x86, 0x74, 0x5A, 0x42, 0x2F, 0x27, 0x31,
-  0x45, 0x6A, 0x8A, 0xAA, 0xBF, 0xC1, 0xC2, 0xAE, 0x97, 0x84, 0x74, 0x74,
-  0x7D, 0x92, 0xB0, 0xCB, 0xD8, 0xDE, 0xD0, 0xBC, 0x9E, 0x75, 0x61, 0x47,
-  0x46, 0x4D, 0x55, 0x74, 0x7F, 0x88, 0x88, 0x7C, 0x69, 0x51, 0x39, 0x2C,
-  0x31, 0x3C, 0x62, 0x85, 0xAF, 0xD1, 0xD9, 0xDE, 0xCD, 0xB6, 0x97, 0x81,
-  0x6D, 0x6F, 0x74, 0x86, 0xA4, 0xAB, 0xB6, 0x9D, 0x75, 0x6D, 0x6F, 0x5A,
-  0x5B, 0x6A, 0x69, 0x5F, 0x77, 0x8F, 0x99, 0xA3, 0x93, 0x85, 0x63, 0x3F,
-  0x24, 0x11, 0x13, 0x2B, 0x49, 0x6D, 0x8C, 0x9A, 0xA7, 0xA2, 0x96, 0x84,
-  0x69, 0x63, 0x5E, 0x69, 0x81, 0x9C, 0xC1, 0xDA, 0xE8, 0xE6, 0xD3, 0xB2,
-  0x8F, 0x74, 0x62, 0x61, 0x63, 0x75, 0x8B, 0x9C, 0xA7, 0x9B, 0x92, 0x7B,
-  0x58, 0x38, 0x1E, 0x12, 0x1F, 0x38, 0x59, 0x83, 0x98, 0xB1, 0xBA, 0xB1,
-  0xAB, 0x8C, 0x7D, 0x72, 0x70, 0x7D, 0x8F, 0xA7, 0xBF, 0xCC, 0xCA, 0xC1,
-  0xA1, 0x80, 0x57, 0x2C, 0x22, 0x41, 0x5C, 0x7F, 0xB4, 0xC4, 0xB8, 0xAD,
-  0x9C, 0x7E, 0x61, 0x3F, 0x2E, 0x28, 0x32, 0x45, 0x5E, 0x78, 0x8B, 0x96,
-  0x91, 0x88, 0x6E, 0x58, 0x49, 0x40, 0x52, 0x63, 0x84, 0xAB, 0xC3, 0xDC,
-  0xDD, 0xD3, 0xBD, 0x9E, 0x86, 0x75, 0x6D, 0x73, 0x83, 0x9A, 0xB5, 0xBD,
-  0xC0, 0xB7, 0x9D, 0x84, 0x54, 0x34, 0x22, 0x1C, 0x2E, 0x46, 0x66, 0x7F,
-  0x92, 0x95, 0x94, 0x82, 0x6A, 0x5E, 0x4F, 0x5E, 0x71, 0x8D, 0xB5, 0xD1,
-  0xE4, 0xE6, 0xD2, 0xAF, 0x8A, 0x66, 0x57, 0x4C, 0x54, 0x69, 0x70, 0x7D,
-  0xA1, 0xAE, 0xA6, 0xA2, 0x87, 0x5B, 0x3C, 0x3F, 0x46, 0x67, 0x81, 0x91,
-  0x99, 0x8D, 0x7A, 0x54, 0x32, 0x1F, 0x1F, 0x2D, 0x4C, 0x6F, 0x8F, 0xA8,
-  0xAE, 0xB0, 0xA0, 0x85, 0x72, 0x62, 0x67, 0x76, 0x8F, 0xB4, 0xD0, 0xE4,
-  0xE5, 0xD2, 0xB2, 0x8F, 0x72, 0x61, 0x5C, 0x64, 0x7C, 0x91, 0xA6, 0xA7,
-  0x99, 0x8A, 0x67, 0x44, 0x27, 0x15, 0x1D, 0x38, 0x59, 0x83, 0x9D, 0xAA,
-  0xB6, 0xA6, 0x94, 0x7F, 0x6D, 0x6B, 0x72, 0x87, 0xA3, 0xBD, 0xCB, 0xD3,
-  0xC2, 0xAC, 0x85, 0x5E, 0x4A, 0x2E, 0x29, 0x4B, 0x81, 0xA1, 0xC4, 0xD3,
-  0xB9, 0x92, 0x72, 0x4D, 0x38, 0x33, 0x39, 0x53, 0x6E, 0x86, 0x90, 0x8F,
-  0x83, 0x71, 0x52, 0x3B, 0x2E, 0x33, 0x50, 0x6D, 0x97, 0xB5, 0xC4, 0xCB,
-  0xBC, 0xA4, 0x86, 0x71, 0x68, 0x6D, 0x81, 0xA0, 0xC0, 0xD3, 0xDB, 0xCD,
-  0xB7, 0x94, 0x6C, 0x57, 0x43, 0x49, 0x58, 0x6B, 0x88, 0x91, 0x94, 0x8A,
-  0x73, 0x53, 0x38, 0x25, 0x26, 0x3C, 0x56, 0x89, 0xAA, 0xC2, 0xD1, 0xC3,
-  0xB3, 0x91, 0x79, 0x6A, 0x6A, 0x73, 0x8B, 0xA6, 0xBC, 0xC7, 0xB6, 0xA4,
-  0x79, 0x42, 0x32, 0x3D, 0x46, 0x68, 0x98, 0xB1, 0xB2, 0xB6, 0xA8, 0x90,
-  0x73, 0x49, 0x34, 0x24, 0x2E, 0x40, 0x5C, 0x7C, 0x92, 0x9D, 0x98, 0x8A,
-  0x6B, 0x54, 0x43, 0x42, 0x58, 0x6E, 0x98, 0xB8, 0xCF, 0xDC, 0xD1, 0xBC,
-  0x99, 0x7E, 0x6E, 0x6A, 0x74, 0x88, 0xA6, 0xBE, 0xCC, 0xC3, 0xB3, 0x95,
-  0x6C, 0x4D, 0x2C, 0x2A, 0x36, 0x4E, 0x71, 0x85, 0x91, 0x92, 0x88, 0x6F,
-  0x57, 0x40, 0x3E, 0x4D, 0x64, 0x91, 0xB4, 0xD4, 0xE3, 0xE0, 0xCE, 0xAC,
-  0x82, 0x69, 0x5A, 0x5B, 0x71, 0x84, 0xA2, 0xA8, 0x94, 0x8A, 0x90, 0x78,
-  0x64, 0x64, 0x5B, 0x51, 0x5E, 0x80, 0x95, 0xA9, 0xA3, 0x95, 0x79, 0x50,
-  0x2F, 0x19, 0x17, 0x2E, 0x50, 0x76, 0x95, 0xA4, 0xAA, 0xA1, 0x8A, 0x71,
-  0x5A, 0x51, 0x5A, 0x6C, 0x8E, 0xB2, 0xCF, 0xDF, 0xDA, 0xC9, 0xA9, 0x84,
-  0x6A, 0x5D, 0x5F, 0x70, 0x87, 0xA4, 0xB4, 0xB4, 0xAD, 0x8E, 0x69, 0x44,
-  0x24, 0x1A, 0x23, 0x3B, 0x62, 0x85, 0x98, 0xA6, 0x9F, 0x93, 0x7F, 0x62,
-  0x5F, 0x5C, 0x6C, 0x88, 0xA8, 0xC7, 0xD9, 0xDB, 0xCA, 0xB0, 0x83, 0x69,
-  0x4D, 0x44, 0x4B, 0x4F, 0x69, 0x98, 0xB5, 0xB9, 0xBF, 0xAB, 0x78, 0x50,
-  0x3F, 0x36, 0x47, 0x5F, 0x7D, 0x93, 0x9B, 0x99, 0x84, 0x64, 0x42, 0x2F,
-  0x24, 0x32, 0x49, 0x6E, 0x96, 0xAA, 0xBD, 0xBA, 0xAB, 0x92, 0x72, 0x66,
-  0x60, 0x6C, 0x84, 0xA6, 0xC9, 0xDE, 0xDF, 0xCE, 0xB3, 0x8C, 0x6F, 0x58,
-  0x4E, 0x5A, 0x68, 0x8A, 0x9B, 0xA0, 0xA0, 0x8C, 0x73, 0x4E, 0x2E, 0x1C,
-  0x23, 0x37, 0x5B, 0x86, 0xA3, 0xBD, 0xBB, 0xB3, 0x9C, 0x7B, 0x68, 0x5A,
-  0x62, 0x73, 0x8F, 0xAC, 0xC3, 0xC9, 0xC1, 0xA9, 0x82, 0x5F, 0x3A, 0x23,
-  0x35, 0x59, 0x7E, 0xAC, 0xC8, 0xC4, 0xAD, 0x97, 0x70, 0x4F, 0x38, 0x2D,
-  0x3A, 0x4E, 0x71, 0x8A, 0x9A, 0x9F, 0x97, 0x82, 0x61, 0x45, 0x33, 0x39,
-  0x4A, 0x6A, 0x93, 0xB1, 0xC9, 0xCC, 0xC1, 0xA8, 0x84, 0x6C, 0x5C, 0x60,
-  0x72, 0x8E, 0xB0, 0xC9, 0xD3, 0xCC, 0xB8, 0x93, 0x6F, 0x4E, 0x3C, 0x3E,
-  0x48, 0x69, 0x85, 0x99, 0xA1, 0x99, 0x87, 0x6A, 0x49, 0x35, 0x31, 0x3D,
-  0x60, 0x87, 0xAE, 0xCD, 0xD4, 0xCF, 0xB7, 0x94, 0x75, 0x60, 0x57, 0x64,
-  0x77, 0x99, 0xB6, 0xBC, 0xBE, 0xA1, 0x76, 0x56, 0x4C, 0x3F, 0x4A, 0x6A,
-  0x81, 0x96, 0xAD, 0xB6, 0xAE, 0x9C, 0x79, 0x53, 0x33, 0x23, 0x28, 0x3B,
-  0x5A, 0x82, 0x9C, 0xA9, 0xA8, 0x97, 0x7E, 0x5D, 0x4A, 0x46, 0x4F, 0x6B,
-  0x8F, 0xB2, 0xCD, 0xD6, 0xCC, 0xB2, 0x8C, 0x6D, 0x5B, 0x59, 0x6A, 0x88,
-  0xAB, 0xC3, 0xC7, 0xBC, 0xA0, 0x76, 0x54, 0x34, 0x2F, 0x3E, 0x5A, 0x80,
-  0x98, 0xA3, 0x9F, 0x8D, 0x69, 0x4E, 0x37, 0x3B, 0x52, 0x71, 0xA3, 0xC1,
-  0xD4, 0xD1, 0xBE, 0x9B, 0x74, 0x59, 0x51, 0x5D, 0x74, 0x9C, 0xB1, 0xBE,
-  0xB3, 0x8D, 0x6B, 0x56, 0x44, 0x41, 0x5D, 0x79, 0x92, 0xAC, 0xBA, 0xB2,
-  0xA0, 0x79, 0x51, 0x33, 0x26, 0x32, 0x4A, 0x70, 0x92, 0xA8, 0xAA, 0xA0,
-  0x82, 0x5F, 0x48, 0x3B, 0x4C, 0x65, 0x8C, 0xB3, 0xC9, 0xD4, 0xC7, 0xAB,
-  0x85, 0x69, 0x59, 0x5F, 0x72, 0x92, 0xB6, 0xC8, 0xCE, 0xBB, 0x9E, 0x76,
-  0x51, 0x3D, 0x37, 0x46, 0x67, 0x88, 0x9D, 0xA4, 0x99, 0x83, 0x61, 0x41,
-  0x33, 0x35, 0x4C, 0x77, 0x9F, 0xC1, 0xD0, 0xC9, 0xB6, 0x90, 0x70, 0x5C,
-  0x58, 0x66, 0x83, 0xA2, 0xBD, 0xC2, 0xB5, 0x9C, 0x69, 0x41, 0x39, 0x3E,
-  0x51, 0x7C, 0xA5, 0xB7, 0xBB, 0xB5, 0x9B, 0x77, 0x50, 0x36, 0x2D, 0x3A,
-  0x55, 0x7A, 0x98, 0xA8, 0xAA, 0x99, 0x7A, 0x55, 0x3D, 0x38, 0x45, 0x64,
-  0x8E, 0xAF, 0xC8, 0xCA, 0xBD, 0x9E, 0x77, 0x5C, 0x50, 0x5A, 0x73, 0x98,
-  0xB8, 0xCC, 0xCB, 0xBA, 0x9A, 0x6E, 0x51, 0x3B, 0x41, 0x53, 0x71, 0x94,
-  0xA4, 0xA9, 0x9B, 0x7F, 0x57, 0x3C, 0x2B, 0x34, 0x4E, 0x74, 0xA2, 0xBB,
-  0xC8, 0xC1, 0xA9, 0x86, 0x68, 0x57, 0x59, 0x6B, 0x87, 0xAC, 0xBF, 0xC7,
-  0xB9, 0x9C, 0x75, 0x4A, 0x2D, 0x33, 0x51, 0x73, 0xA4, 0xC4, 0xC8, 0xB5,
-  0x9E, 0x75, 0x51, 0x3A, 0x32, 0x43, 0x5E, 0x84, 0x9C, 0xAA, 0xA4, 0x93,
-  0x70, 0x4E, 0x38, 0x33, 0x48, 0x66, 0x90, 0xB2, 0xC4, 0xC6, 0xB5, 0x94,
-  0x72, 0x59, 0x51, 0x5F, 0x7A, 0xA2, 0xC2, 0xD0, 0xCE, 0xB9, 0x96, 0x6E,
-  0x4F, 0x43, 0x49, 0x5F, 0x83, 0x9C, 0xAD, 0xAA, 0x99, 0x7A, 0x51, 0x35,
-  0x29, 0x34, 0x4F, 0x7B, 0x9F, 0xBB, 0xC2, 0xB5, 0x9E, 0x77, 0x5E, 0x4F,
-  0x56, 0x6C, 0x8F, 0xAF, 0xC5, 0xC8, 0xB9, 0x9D, 0x70, 0x51, 0x38, 0x30,
-  0x47, 0x75, 0x9E, 0xBC, 0xCB, 0xBC, 0x9A, 0x72, 0x50, 0x38, 0x37, 0x47,
-  0x67, 0x8B, 0xA3, 0xAD, 0xA5, 0x8C, 0x67, 0x48, 0x33, 0x33, 0x46, 0x69,
-  0x93, 0xB0, 0xC3, 0xBC, 0xAB, 0x87, 0x64, 0x51, 0x4D, 0x5E, 0x7D, 0xA5,
-  0xC3, 0xD3, 0xCB, 0xB5, 0x91, 0x69, 0x50, 0x45, 0x51, 0x6B, 0x8F, 0xAC,
-  0xB7, 0xB1, 0x9C, 0x76, 0x4F, 0x33, 0x28, 0x37, 0x56, 0x7F, 0xA4, 0xB7,
-  0xBB, 0xAF, 0x8F, 0x70, 0x56, 0x4C, 0x59, 0x71, 0x97, 0xB9, 0xCB, 0xCC,
-  0xBB, 0x97, 0x70, 0x4D, 0x3C, 0x3F, 0x4A, 0x6E, 0x9D, 0xB9, 0xC1, 0xBC,
-  0xA1, 0x71, 0x4E, 0x3B, 0x3A, 0x50, 0x71, 0x94, 0xA9, 0xAF, 0xA3, 0x88,
-  0x5E, 0x3F, 0x30, 0x33, 0x4B, 0x6F, 0x98, 0xB3, 0xBE, 0xB9, 0xA2, 0x7D,
-  0x5F, 0x4A, 0x49, 0x5C, 0x7F, 0xA6, 0xC2, 0xCF, 0xC6, 0xAD, 0x84, 0x61,
-  0x48, 0x44, 0x53, 0x71, 0x9A, 0xB3, 0xBF, 0xB5, 0x9D, 0x75, 0x4E, 0x34,
-  0x2E, 0x3E, 0x5D, 0x88, 0xA6, 0xB9, 0xB6, 0xA3, 0x83, 0x5F, 0x49, 0x43,
-  0x52, 0x70, 0x98, 0xB9, 0xCC, 0xCA, 0xB5, 0x92, 0x66, 0x4B, 0x3B, 0x43,
-  0x5D, 0x7F, 0x9D, 0xB8, 0xBE, 0xAE, 0x95, 0x6F, 0x4E, 0x39, 0x41, 0x56,
-  0x7E, 0xA1, 0xB4, 0xB8, 0xA8, 0x88, 0x5D, 0x3F, 0x2E, 0x39, 0x51, 0x79,
-  0x9F, 0xB6, 0xBF, 0xB2, 0x98, 0x71, 0x53, 0x44, 0x4A, 0x62, 0x87, 0xAE,
-  0xC6, 0xCF, 0xC3, 0xA8, 0x7F, 0x5C, 0x49, 0x49, 0x5C, 0x7E, 0xA2, 0xBB,
-  0xC2, 0xB6, 0x9B, 0x6F, 0x4B, 0x33, 0x31, 0x43, 0x65, 0x8E, 0xAA, 0xB7,
-  0xB0, 0x9D, 0x77, 0x58, 0x42, 0x41, 0x56, 0x75, 0xA1, 0xBF, 0xD0, 0xCB,
-  0xB4, 0x8A, 0x64, 0x49, 0x42, 0x50, 0x69, 0x8F, 0xA6, 0xB0, 0xB2, 0xA6,
-  0x85, 0x65, 0x50, 0x47, 0x43, 0x42, 0x43, 0x43, 0x43, 0x42, 0x44, 0x45,
-  0x47, 0x47, 0x48, 0x49, 0x4B, 0x4D, 0x4F, 0x50, 0x52, 0x55, 0x57, 0x5A,
-  0x5E, 0x60, 0x64, 0x66, 0x68, 0x6B, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x70,
-  0x70, 0x71, 0x70, 0x71, 0x70, 0x6F, 0x70, 0x6E, 0x6E, 0x6D, 0x6A, 0x6B,
-  0x69, 0x69, 0x6A, 0x69, 0x6A, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0x78, 0x7B,
-  0x7D, 0x81, 0x82, 0x84, 0x85, 0x86, 0x88, 0x88, 0x87, 0x88, 0x86, 0x85,
-  0x84, 0x81, 0x81, 0x7C, 0x76, 0x78, 0x7F, 0x82, 0x86, 0x8C, 0x8A, 0x85,
-  0x83, 0x82, 0x7F, 0x7F, 0x7D, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7D,
-  0x7F, 0x7F, 0x81, 0x81, 0x83, 0x84, 0x85, 0x88, 0x89, 0x8C, 0x8D, 0x8E,
-  0x8F, 0x90, 0x91, 0x90, 0x91, 0x92, 0x91, 0x91, 0x90, 0x8F, 0x8E, 0x8E,
-  0x8B, 0x8B, 0x89, 0x87, 0x87, 0x83, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E,
-  0x80, 0x82, 0x82, 0x84, 0x84, 0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8C,
-  0x8C, 0x8D, 0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x8A, 0x88, 0x88, 0x86, 0x83,
-  0x82, 0x85, 0x87, 0x89, 0x8C, 0x8C, 0x89, 0x87, 0x86, 0x84, 0x84, 0x82,
-  0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x83, 0x84,
-  0x85, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8A, 0x8B, 0x8B, 0x8C, 0x8B, 0x8C,
-  0x8B, 0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x8A, 0x8B, 0x8A, 0x89, 0x88, 0x87,
-  0x86, 0x84, 0x85, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x83, 0x84, 0x86,
-  0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8C, 0x8B, 0x8A,
-  0x8A, 0x89, 0x89, 0x87, 0x86, 0x85, 0x82, 0x80, 0x82, 0x84, 0x86, 0x89,
-  0x8A, 0x87, 0x85, 0x85, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83, 0x84, 0x85, 0x85, 0x86,
-  0x88, 0x88, 0x86, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84,
-  0x83, 0x84, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x83, 0x84, 0x83, 0x84,
-  0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
-  0x84, 0x83, 0x83, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
-  0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82,
-  0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x7F, 0x80, 0x7E, 0x7F, 0x82, 0x9D, 0xB7, 0xDA, 0xF3, 0xFA, 0xF9, 0xE7,
-  0xD0, 0xB8, 0xA4, 0xA0, 0xA2, 0xB1, 0xC1, 0xC2, 0xC1, 0x9D, 0x90, 0x92,
-  0x85, 0x8B, 0x9C, 0x8D, 0x91, 0xA9, 0xB2, 0xBA, 0xA9, 0x95, 0x70, 0x4A,
-  0x30, 0x26, 0x3D, 0x5A, 0x7D, 0x9A, 0xA7, 0xB0, 0xA4, 0x96, 0x7D, 0x71,
-  0x72, 0x80, 0x9D, 0xBD, 0xDB, 0xE7, 0xE7, 0xD7, 0xB6, 0x96, 0x7C, 0x71,
-  0x72, 0x7A, 0x94, 0xA0, 0xAA, 0x9C, 0x85, 0x69, 0x40, 0x29, 0x16, 0x1F,
-  0x38, 0x5B, 0x84, 0x98, 0xAB, 0xA8, 0x9D, 0x8D, 0x78, 0x75, 0x78, 0x8B,
-  0xA5, 0xBB, 0xCA, 0xC7, 0xB8, 0x98, 0x6B, 0x4D, 0x1E, 0x1F, 0x4E, 0x73,
-  0xA5, 0xCB, 0xB9, 0x9D, 0x84, 0x5C, 0x42, 0x2A, 0x27, 0x33, 0x4A, 0x65,
-  0x72, 0x7E, 0x7C, 0x6E, 0x55, 0x3C, 0x36, 0x38, 0x54, 0x73, 0x9A, 0xB8,
-  0xC9, 0xCC, 0xBA, 0xA0, 0x82, 0x74, 0x72, 0x77, 0x8C, 0xA7, 0xBA, 0xC0,
-  0xB3, 0x9E, 0x75, 0x52, 0x2E, 0x1E, 0x24, 0x35, 0x56, 0x69, 0x7A, 0x7D,
-  0x73, 0x63, 0x47, 0x42, 0x44, 0x59, 0x7C, 0x9E, 0xC2, 0xD3, 0xD9, 0xCC,
-  0xA9, 0x84, 0x64, 0x53, 0x50, 0x54, 0x6D, 0x65, 0x75, 0x9A, 0x9A, 0x98,
-  0x8E, 0x60, 0x3D, 0x38, 0x3C, 0x5A, 0x6F, 0x7D, 0x80, 0x72, 0x59, 0x32,
-  0x1D, 0x17, 0x21, 0x39, 0x5A, 0x82, 0x97, 0xAB, 0xA8, 0x9B, 0x83, 0x6D,
-  0x68, 0x6A, 0x7D, 0x9A, 0xBD, 0xD5, 0xD6, 0xCB, 0xB1, 0x8C, 0x6C, 0x52,
-  0x4D, 0x52, 0x68, 0x79, 0x84, 0x87, 0x79, 0x68, 0x43, 0x29, 0x1B, 0x1A,
-  0x35, 0x52, 0x86, 0xA8, 0xBC, 0xC5, 0xB6, 0xA1, 0x84, 0x75, 0x71, 0x76,
-  0x8C, 0xA5, 0xB9, 0xBB, 0xA7, 0x8D, 0x4F, 0x2E, 0x3A, 0x42, 0x62, 0x90,
-  0x9A, 0x9D, 0xA2, 0x93, 0x82, 0x5E, 0x3B, 0x23, 0x1A, 0x24, 0x37, 0x5A,
-  0x77, 0x89, 0x8F, 0x84, 0x76, 0x58, 0x50, 0x4D, 0x5D, 0x79, 0x9A, 0xC1,
-  0xD4, 0xDA, 0xCE, 0xB4, 0x93, 0x77, 0x68, 0x6A, 0x78, 0x92, 0xA8, 0xB4,
-  0xAE, 0x9F, 0x79, 0x4E, 0x2F, 0x17, 0x1B, 0x28, 0x4B, 0x70, 0x86, 0x98,
-  0x91, 0x8B, 0x76, 0x66, 0x65, 0x68, 0x7F, 0x99, 0xB9, 0xCE, 0xD3, 0xCA,
-  0xAF, 0x8A, 0x65, 0x47, 0x3D, 0x2C, 0x42, 0x7F, 0xA2, 0xBE, 0xCC, 0xA8,
-  0x78, 0x55, 0x38, 0x31, 0x36, 0x4C, 0x69, 0x7E, 0x86, 0x7F, 0x73, 0x59,
-  0x3E, 0x31, 0x2D, 0x44, 0x5E, 0x8C, 0xAB, 0xC0, 0xC7, 0xBA, 0xA6, 0x87,
-  0x77, 0x70, 0x7C, 0x94, 0xB0, 0xC9, 0xD4, 0xCF, 0xBA, 0x96, 0x70, 0x4D,
-  0x40, 0x3A, 0x47, 0x64, 0x76, 0x86, 0x82, 0x78, 0x65, 0x46, 0x3A, 0x2F,
-  0x45, 0x65, 0x90, 0xC0, 0xD5, 0xE2, 0xD9, 0xC1, 0x9B, 0x79, 0x68, 0x65,
-  0x74, 0x8C, 0x9E, 0xA8, 0x87, 0x77, 0x80, 0x6D, 0x68, 0x71, 0x5B, 0x55,
-  0x6E, 0x84, 0x97, 0x94, 0x87, 0x6C, 0x44, 0x22, 0x0E, 0x18, 0x32, 0x54,
-  0x7B, 0x91, 0xA6, 0xA1, 0x9A, 0x80, 0x68, 0x60, 0x61, 0x78, 0x94, 0xBB,
-  0xD3, 0xE2, 0xDC, 0xC3, 0x9F, 0x7C, 0x67, 0x5E, 0x63, 0x79, 0x90, 0xA3,
-  0xA1, 0x94, 0x80, 0x59, 0x39, 0x1E, 0x18, 0x2A, 0x45, 0x74, 0x94, 0xAF,
-  0xB6, 0xAC, 0x9E, 0x81, 0x73, 0x6B, 0x78, 0x8C, 0xA7, 0xC0, 0xC7, 0xC4,
-  0xAD, 0x86, 0x5E, 0x2D, 0x1E, 0x41, 0x61, 0x92, 0xC3, 0xC0, 0xAF, 0x9C,
-  0x7A, 0x57, 0x38, 0x2A, 0x2F, 0x40, 0x5E, 0x76, 0x8B, 0x92, 0x8A, 0x78,
-  0x57, 0x48, 0x3D, 0x4D, 0x68, 0x8D, 0xB4, 0xCB, 0xDA, 0xD0, 0xBB, 0x99,
-  0x81, 0x73, 0x71, 0x7F, 0x96, 0xB5, 0xC5, 0xC4, 0xB9, 0x98, 0x72, 0x48,
-  0x2B, 0x28, 0x31, 0x4E, 0x6C, 0x83, 0x92, 0x8D, 0x84, 0x68, 0x58, 0x4F,
-  0x54, 0x71, 0x8F, 0xB8, 0xD1, 0xE1, 0xDF, 0xC6, 0xA2, 0x79, 0x60, 0x52,
-  0x50, 0x62, 0x66, 0x7B, 0xA7, 0xAF, 0xAF, 0xA9, 0x76, 0x4D, 0x3C, 0x3A,
-  0x4F, 0x6B, 0x86, 0x93, 0x91, 0x7F, 0x58, 0x37, 0x27, 0x29, 0x3E, 0x5C,
-  0x89, 0xA4, 0xB7, 0xB6, 0xA4, 0x88, 0x6D, 0x67, 0x6E, 0x86, 0xA9, 0xCB,
-  0xDC, 0xD6, 0xC4, 0xA2, 0x7D, 0x62, 0x54, 0x5F, 0x71, 0x90, 0x9D, 0x9C,
-  0x91, 0x72, 0x4E, 0x2C, 0x1E, 0x27, 0x3D, 0x6A, 0x8F, 0xAE, 0xB6, 0xAD,
-  0x9D, 0x7D, 0x6F, 0x6B, 0x79, 0x93, 0xAF, 0xC5, 0xC8, 0xBD, 0xA1, 0x73,
-  0x51, 0x27, 0x23, 0x51, 0x7E, 0xAC, 0xD2, 0xC2, 0xA2, 0x81, 0x55, 0x3D,
-  0x30, 0x3A, 0x51, 0x71, 0x89, 0x90, 0x8C, 0x7A, 0x59, 0x41, 0x33, 0x40,
-  0x57, 0x82, 0xA9, 0xC0, 0xCB, 0xC0, 0xAB, 0x88, 0x73, 0x6C, 0x7A, 0x98,
-  0xB7, 0xCE, 0xD4, 0xCA, 0xB0, 0x84, 0x64, 0x49, 0x47, 0x4F, 0x66, 0x83,
-  0x8E, 0x91, 0x7E, 0x62, 0x43, 0x2E, 0x2E, 0x3D, 0x66, 0x97, 0xB7, 0xD1,
-  0xCC, 0xBE, 0x9B, 0x7E, 0x6F, 0x6C, 0x7E, 0x98, 0xB3, 0xBF, 0xB4, 0x9F,
-  0x67, 0x3C, 0x40, 0x42, 0x5C, 0x8E, 0xA5, 0xAD, 0xB2, 0xA0, 0x88, 0x5D,
-  0x3A, 0x27, 0x29, 0x3C, 0x5A, 0x7E, 0x96, 0x9B, 0x93, 0x76, 0x5A, 0x45,
-  0x45, 0x58, 0x77, 0xA3, 0xC1, 0xD5, 0xD0, 0xBE, 0x9C, 0x7D, 0x6D, 0x69,
-  0x7B, 0x98, 0xB7, 0xC7, 0xC3, 0xB3, 0x8C, 0x64, 0x41, 0x2D, 0x34, 0x46,
-  0x6A, 0x82, 0x91, 0x91, 0x7E, 0x64, 0x48, 0x3E, 0x48, 0x63, 0x93, 0xB9,
-  0xD6, 0xE0, 0xD5, 0xB8, 0x89, 0x6A, 0x57, 0x5D, 0x73, 0x8D, 0xA7, 0x99,
-  0x8A, 0x90, 0x78, 0x66, 0x69, 0x59, 0x57, 0x75, 0x8F, 0xA4, 0xA3, 0x91,
-  0x6E, 0x43, 0x25, 0x18, 0x28, 0x49, 0x72, 0x94, 0xA4, 0xA9, 0x98, 0x7D,
-  0x63, 0x54, 0x5C, 0x70, 0x98, 0xBC, 0xD3, 0xDA, 0xCF, 0xB5, 0x8D, 0x71,
-  0x62, 0x66, 0x7C, 0x99, 0xB2, 0xB7, 0xB1, 0x94, 0x65, 0x41, 0x26, 0x24,
-  0x30, 0x52, 0x7B, 0x93, 0xA2, 0x9B, 0x8A, 0x6F, 0x5C, 0x5D, 0x66, 0x85,
-  0xAA, 0xC9, 0xDA, 0xD4, 0xC0, 0x96, 0x6D, 0x51, 0x42, 0x4C, 0x55, 0x74,
-  0xA3, 0xB6, 0xB8, 0xB1, 0x81, 0x54, 0x3F, 0x3B, 0x4E, 0x70, 0x8D, 0x9B,
-  0x98, 0x85, 0x5D, 0x3A, 0x2B, 0x2C, 0x40, 0x60, 0x8E, 0xA8, 0xB9, 0xB6,
-  0xA2, 0x82, 0x66, 0x5F, 0x68, 0x81, 0xA8, 0xC8, 0xD9, 0xD3, 0xC0, 0x9C,
-  0x74, 0x5C, 0x50, 0x5C, 0x71, 0x94, 0xA3, 0xA1, 0x95, 0x75, 0x4F, 0x2D,
-  0x20, 0x2A, 0x42, 0x6F, 0x95, 0xB0, 0xB8, 0xAD, 0x9A, 0x78, 0x68, 0x65,
-  0x74, 0x91, 0xB0, 0xC6, 0xC9, 0xBD, 0xA1, 0x73, 0x51, 0x2D, 0x28, 0x52,
-  0x82, 0xAF, 0xD2, 0xC6, 0xA5, 0x82, 0x56, 0x3E, 0x33, 0x3E, 0x57, 0x79,
-  0x90, 0x96, 0x91, 0x7E, 0x5B, 0x40, 0x33, 0x3F, 0x58, 0x82, 0xAA, 0xC2,
-  0xCA, 0xBE, 0xA4, 0x81, 0x6A, 0x65, 0x74, 0x93, 0xB5, 0xCC, 0xD3, 0xC7,
-  0xAE, 0x81, 0x5F, 0x45, 0x46, 0x51, 0x6B, 0x8A, 0x96, 0x97, 0x84, 0x65,
-  0x45, 0x2E, 0x2E, 0x3F, 0x63, 0x95, 0xB6, 0xCC, 0xC6, 0xB3, 0x8E, 0x6D,
-  0x5C, 0x5D, 0x71, 0x92, 0xB1, 0xC1, 0xB9, 0xA5, 0x73, 0x44, 0x3C, 0x3E,
-  0x56, 0x85, 0xA5, 0xB2, 0xB9, 0xA9, 0x8E, 0x62, 0x3F, 0x2B, 0x2D, 0x42,
-  0x64, 0x88, 0xA0, 0xA6, 0x9A, 0x7B, 0x5A, 0x43, 0x40, 0x53, 0x73, 0xA0,
-  0xBD, 0xD0, 0xCB, 0xB6, 0x91, 0x70, 0x5E, 0x5D, 0x70, 0x92, 0xB3, 0xC6,
-  0xC4, 0xB3, 0x8C, 0x62, 0x40, 0x2F, 0x39, 0x4F, 0x76, 0x90, 0x9D, 0x9C,
-  0x87, 0x68, 0x49, 0x3D, 0x45, 0x5E, 0x8E, 0xB7, 0xD4, 0xDC, 0xCF, 0xB0,
-  0x80, 0x61, 0x51, 0x59, 0x73, 0x93, 0xAD, 0xA8, 0x98, 0x94, 0x78, 0x60,
-  0x5C, 0x53, 0x56, 0x78, 0x99, 0xAD, 0xAE, 0x9B, 0x78, 0x4A, 0x2C, 0x1F,
-  0x2F, 0x51, 0x7A, 0x9D, 0xAC, 0xAE, 0x9A, 0x7A, 0x5D, 0x4D, 0x53, 0x69,
-  0x90, 0xB7, 0xCE, 0xD5, 0xC8, 0xAC, 0x83, 0x64, 0x56, 0x5D, 0x78, 0x98,
-  0xB4, 0xBC, 0xB5, 0x97, 0x6B, 0x44, 0x2C, 0x2D, 0x41, 0x69, 0x92, 0xA5,
-  0xA8, 0x94, 0x73, 0x56, 0x48, 0x54, 0x71, 0x9F, 0xC5, 0xD5, 0xD4, 0xB8,
-  0x8B, 0x5F, 0x49, 0x4B, 0x61, 0x89, 0x9B, 0xA0, 0xAA, 0x99, 0x78, 0x64,
-  0x4F, 0x47, 0x61, 0x87, 0xA7, 0xAF, 0xA4, 0x83, 0x53, 0x31, 0x24, 0x31,
-  0x54, 0x80, 0xA3, 0xAE, 0xAA, 0x8C, 0x67, 0x4D, 0x47, 0x59, 0x7C, 0xAA,
-  0xC6, 0xCF, 0xC5, 0xA6, 0x7F, 0x5F, 0x55, 0x61, 0x82, 0xAA, 0xBE, 0xC2,
-  0xAF, 0x89, 0x5A, 0x38, 0x32, 0x3C, 0x5F, 0x85, 0x9E, 0xA6, 0x98, 0x7A,
-  0x54, 0x42, 0x45, 0x5B, 0x8B, 0xB6, 0xD1, 0xD6, 0xC6, 0xA0, 0x72, 0x57,
-  0x51, 0x63, 0x89, 0xA9, 0xB7, 0xA7, 0x8B, 0x73, 0x56, 0x48, 0x59, 0x6A,
-  0x84, 0xAA, 0xB6, 0xB1, 0x94, 0x67, 0x3E, 0x2A, 0x2D, 0x43, 0x6E, 0x97,
-  0xA9, 0xAA, 0x93, 0x6E, 0x4C, 0x41, 0x4C, 0x69, 0x97, 0xBB, 0xCD, 0xCA,
-  0xB4, 0x8C, 0x68, 0x5A, 0x5A, 0x74, 0x9D, 0xBC, 0xC7, 0xBD, 0xA0, 0x70,
-  0x4B, 0x39, 0x3B, 0x57, 0x7D, 0x9E, 0xA8, 0x9F, 0x84, 0x5A, 0x3F, 0x35,
-  0x45, 0x6D, 0x9A, 0xC0, 0xCB, 0xC5, 0xA7, 0x7E, 0x5E, 0x53, 0x5E, 0x7D,
-  0xA4, 0xBC, 0xBB, 0xAC, 0x80, 0x4D, 0x3E, 0x3E, 0x53, 0x86, 0xAB, 0xB9,
-  0xBA, 0xA5, 0x7F, 0x52, 0x35, 0x30, 0x3E, 0x62, 0x89, 0xA2, 0xAA, 0x9B,
-  0x78, 0x50, 0x3C, 0x3B, 0x53, 0x7E, 0xA8, 0xC2, 0xC6, 0xBA, 0x95, 0x6D,
-  0x56, 0x55, 0x6C, 0x92, 0xB8, 0xC9, 0xC8, 0xB3, 0x87, 0x5E, 0x45, 0x43,
-  0x56, 0x76, 0x9B, 0xAA, 0xA8, 0x8F, 0x65, 0x43, 0x31, 0x38, 0x53, 0x82,
-  0xAE, 0xC0, 0xC5, 0xAF, 0x8A, 0x67, 0x57, 0x5E, 0x75, 0x9C, 0xB9, 0xC3,
-  0xBD, 0x9D, 0x71, 0x43, 0x2C, 0x3E, 0x63, 0x94, 0xC1, 0xC9, 0xB6, 0x96,
-  0x67, 0x45, 0x36, 0x3C, 0x58, 0x7F, 0x9D, 0xA7, 0xA0, 0x84, 0x5B, 0x3F,
-  0x35, 0x44, 0x67, 0x95, 0xB7, 0xC2, 0xBC, 0x9E, 0x75, 0x56, 0x4D, 0x5C,
-  0x80, 0xAC, 0xC5, 0xCB, 0xBE, 0x9B, 0x6F, 0x4E, 0x45, 0x50, 0x72, 0x99,
-  0xAE, 0xB2, 0xA0, 0x7A, 0x4E, 0x33, 0x31, 0x43, 0x6C, 0x99, 0xB5, 0xBE,
-  0xB0, 0x92, 0x6A, 0x54, 0x53, 0x66, 0x8D, 0xB3, 0xC6, 0xC5, 0xB2, 0x89,
-  0x5B, 0x41, 0x35, 0x42, 0x74, 0xA3, 0xBC, 0xC6, 0xAF, 0x7F, 0x56, 0x3C,
-  0x3B, 0x4E, 0x74, 0x99, 0xAB, 0xA9, 0x91, 0x68, 0x44, 0x34, 0x3A, 0x53,
-  0x80, 0xA7, 0xBB, 0xBC, 0xA6, 0x80, 0x5A, 0x4D, 0x54, 0x71, 0x9D, 0xC0,
-  0xCF, 0xC7, 0xAD, 0x81, 0x5B, 0x4B, 0x4F, 0x6B, 0x92, 0xB2, 0xBA, 0xAD,
-  0x8D, 0x5E, 0x3C, 0x2F, 0x37, 0x59, 0x85, 0xA9, 0xB6, 0xB1, 0x97, 0x6F,
-  0x55, 0x4C, 0x5B, 0x7E, 0xA9, 0xC8, 0xCE, 0xC3, 0x9F, 0x70, 0x4D, 0x3D,
-  0x49, 0x63, 0x86, 0xAD, 0xBB, 0xB4, 0x9D, 0x70, 0x48, 0x3D, 0x48, 0x6A,
-  0x93, 0xAC, 0xB0, 0x9F, 0x79, 0x4E, 0x33, 0x32, 0x45, 0x6D, 0x99, 0xB5,
-  0xBA, 0xAB, 0x88, 0x5E, 0x47, 0x45, 0x5D, 0x87, 0xB1, 0xC6, 0xC7, 0xB6,
-  0x8E, 0x63, 0x4A, 0x48, 0x5E, 0x86, 0xAC, 0xBE, 0xBC, 0xA4, 0x76, 0x4C,
-  0x35, 0x36, 0x4D, 0x77, 0xA0, 0xB3, 0xB4, 0x9D, 0x76, 0x53, 0x41, 0x49,
-  0x66, 0x94, 0xBA, 0xCB, 0xC8, 0xAC, 0x7F, 0x54, 0x41, 0x45, 0x5E, 0x8B,
-  0xA8, 0xB0, 0xB1, 0x9A, 0x73, 0x55, 0x44, 0x44, 0x61, 0x8B, 0xAE, 0xB9,
-  0xAF, 0x8E, 0x5F, 0x3C, 0x2E, 0x3A, 0x5D, 0x8A, 0xAD, 0xB8, 0xB1, 0x92,
-  0x68, 0x4B, 0x43, 0x52, 0x76, 0xA3, 0xC1, 0xCA, 0xC0, 0x9E, 0x73, 0x53,
-  0x49, 0x57, 0x7B, 0xA5, 0xBF, 0xC4, 0xB3, 0x8D, 0x5F, 0x3F, 0x37, 0x45,
-  0x69, 0x94, 0xAE, 0xB4, 0xA5, 0x81, 0x59, 0x40, 0x40, 0x54, 0x81, 0xAD,
-  0xC7, 0xCB, 0xB9, 0x93, 0x65, 0x4B, 0x48, 0x5B, 0x83, 0xA7, 0xBB, 0xB5,
-  0x9B, 0x78, 0x54, 0x42, 0x48, 0x4E, 0x4B, 0x4A, 0x49, 0x4A, 0x48, 0x48,
-  0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x50, 0x52, 0x55, 0x57, 0x5A, 0x5C, 0x5F,
-  0x63, 0x65, 0x69, 0x6A, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x74, 0x75,
-  0x74, 0x75, 0x75, 0x73, 0x72, 0x72, 0x71, 0x6F, 0x6C, 0x6C, 0x6B, 0x6B,
-  0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x71, 0x74, 0x78, 0x7A, 0x7D, 0x7F, 0x81,
-  0x82, 0x83, 0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 0x7D, 0x7C, 0x77, 0x72,
-  0x78, 0x7D, 0x81, 0x88, 0x87, 0x81, 0x7F, 0x7D, 0x7C, 0x7A, 0x79, 0x7A,
-  0x79, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 0x83, 0x84, 0x87,
-  0x88, 0x8B, 0x8C, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x90, 0x90, 0x8E,
-  0x8E, 0x8D, 0x8B, 0x8A, 0x88, 0x87, 0x85, 0x81, 0x80, 0x7F, 0x7E, 0x7D,
-  0x7C, 0x7E, 0x7E, 0x80, 0x82, 0x84, 0x87, 0x89, 0x8D, 0x8E, 0x8F, 0x90,
-  0x90, 0x91, 0x90, 0x90, 0x8D, 0x88, 0x86, 0x84, 0x83, 0x80, 0x7E, 0x80,
-  0x83, 0x85, 0x88, 0x89, 0x85, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x87, 0x88,
-  0x88, 0x89, 0x8A, 0x8B, 0x8A, 0x8B, 0x8B, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A,
-  0x8A, 0x89, 0x87, 0x87, 0x85, 0x84, 0x83, 0x81, 0x81, 0x80, 0x80, 0x7F,
-  0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x88, 0x89, 0x89,
-  0x8A, 0x89, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x82, 0x7F, 0x82, 0x84,
-  0x86, 0x89, 0x89, 0x86, 0x85, 0x85, 0x84, 0x83, 0x83, 0x82, 0x81, 0x82,
-  0x82, 0x81, 0x82, 0x83, 0x83, 0x82, 0x83, 0x85, 0x85, 0x87, 0x87, 0x89,
-  0x88, 0x89, 0x8A, 0x89, 0x89, 0x8A, 0x8B, 0x8A, 0x8A, 0x89, 0x88, 0x88,
-  0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7F,
-  0x7F, 0x80, 0x81, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83,
-  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82,
-  0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x80, 0x7F, 0x81, 0x7E, 0xA0, 0xD2, 0xEC, 0xFB, 0xF8, 0xE5, 0xBF,
-  0x8B, 0x6E, 0x5E, 0x64, 0x74, 0x91, 0xA7, 0xB1, 0xAF, 0xA1, 0x93, 0x88,
-  0x8F, 0x9C, 0xBB, 0xD9, 0xEF, 0xEE, 0xE0, 0xC1, 0x9C, 0x7D, 0x69, 0x63,
-  0x5D, 0x8F, 0xB8, 0xC9, 0xD9, 0xAA, 0x79, 0x5B, 0x4D, 0x52, 0x65, 0x83,
-  0x93, 0x93, 0x7F, 0x66, 0x48, 0x3C, 0x3E, 0x56, 0x7A, 0xA8, 0xC1, 0xCC,
-  0xC3, 0xAA, 0x8E, 0x7D, 0x7F, 0x93, 0xB5, 0xCC, 0xD6, 0xCF, 0xBB, 0x90,
-  0x6C, 0x50, 0x4B, 0x4C, 0x63, 0x77, 0x81, 0x7B, 0x67, 0x4D, 0x32, 0x2D,
-  0x37, 0x60, 0x8D, 0xC1, 0xD5, 0xDA, 0xC7, 0xA6, 0x83, 0x6E, 0x6F, 0x7E,
-  0x9A, 0xA3, 0x9F, 0x74, 0x64, 0x64, 0x57, 0x71, 0x69, 0x64, 0x7E, 0x8D,
-  0x90, 0x7D, 0x60, 0x35, 0x1B, 0x0E, 0x1E, 0x3D, 0x67, 0x84, 0x93, 0x94,
-  0x85, 0x6C, 0x5B, 0x5D, 0x6D, 0x91, 0xB3, 0xCB, 0xD0, 0xCB, 0xAD, 0x89,
-  0x6A, 0x61, 0x63, 0x7A, 0x91, 0x9E, 0x94, 0x7C, 0x59, 0x31, 0x1A, 0x12,
-  0x25, 0x44, 0x74, 0x8E, 0xA2, 0x9E, 0x90, 0x7A, 0x6B, 0x6D, 0x7D, 0x9B,
-  0xB3, 0xC0, 0xB9, 0xA9, 0x7C, 0x53, 0x20, 0x18, 0x4C, 0x76, 0xB4, 0xC5,
-  0xAA, 0x8F, 0x65, 0x43, 0x2B, 0x2A, 0x37, 0x54, 0x6D, 0x7D, 0x80, 0x74,
-  0x56, 0x3E, 0x37, 0x40, 0x61, 0x89, 0xB1, 0xC2, 0xC8, 0xB7, 0x9A, 0x7C,
-  0x71, 0x70, 0x83, 0xA0, 0xBA, 0xBE, 0xB4, 0x95, 0x68, 0x40, 0x26, 0x28,
-  0x35, 0x56, 0x6D, 0x80, 0x7C, 0x6F, 0x53, 0x45, 0x47, 0x5D, 0x83, 0xAC,
-  0xCD, 0xD5, 0xD3, 0xB5, 0x8E, 0x66, 0x56, 0x4F, 0x5F, 0x69, 0x70, 0x9A,
-  0xA1, 0xA3, 0x8F, 0x56, 0x41, 0x3C, 0x51, 0x6E, 0x82, 0x86, 0x79, 0x56,
-  0x31, 0x21, 0x22, 0x34, 0x57, 0x83, 0x9F, 0xB1, 0xAD, 0x9B, 0x7D, 0x6F,
-  0x6D, 0x80, 0x9F, 0xC3, 0xD3, 0xD1, 0xC2, 0xA0, 0x77, 0x59, 0x50, 0x56,
-  0x6C, 0x7C, 0x89, 0x81, 0x71, 0x4B, 0x31, 0x21, 0x27, 0x3E, 0x6D, 0x9F,
-  0xBA, 0xCB, 0xBD, 0xA4, 0x81, 0x72, 0x6E, 0x80, 0x9B, 0xB5, 0xB5, 0xA8,
-  0x82, 0x41, 0x3B, 0x41, 0x5A, 0x8A, 0x94, 0xA2, 0xA4, 0x97, 0x79, 0x4F,
-  0x2F, 0x20, 0x24, 0x37, 0x61, 0x81, 0x93, 0x90, 0x83, 0x66, 0x55, 0x50,
-  0x60, 0x80, 0xAA, 0xC8, 0xD3, 0xCF, 0xBB, 0x9B, 0x78, 0x6A, 0x6D, 0x84,
-  0x9D, 0xB2, 0xB0, 0xA1, 0x75, 0x4C, 0x2A, 0x1F, 0x23, 0x3E, 0x67, 0x87,
-  0x97, 0x95, 0x8B, 0x72, 0x6A, 0x67, 0x79, 0x95, 0xBA, 0xCB, 0xCD, 0xBE,
-  0x9F, 0x73, 0x4C, 0x3A, 0x25, 0x53, 0x90, 0xB2, 0xD3, 0xB8, 0x86, 0x5B,
-  0x3E, 0x35, 0x3B, 0x56, 0x74, 0x86, 0x85, 0x7C, 0x60, 0x43, 0x32, 0x3A,
-  0x50, 0x7A, 0xA5, 0xBE, 0xC7, 0xBF, 0xA6, 0x86, 0x75, 0x76, 0x8B, 0xA6,
-  0xC4, 0xCE, 0xCC, 0xB1, 0x8A, 0x5D, 0x47, 0x39, 0x44, 0x5E, 0x78, 0x84,
-  0x80, 0x74, 0x54, 0x3E, 0x35, 0x48, 0x66, 0x9D, 0xC7, 0xDC, 0xDC, 0xC8,
-  0xA0, 0x76, 0x62, 0x5F, 0x73, 0x8A, 0xA0, 0x8A, 0x86, 0x8E, 0x73, 0x74,
-  0x61, 0x4B, 0x5D, 0x79, 0x94, 0x98, 0x8E, 0x6D, 0x42, 0x1F, 0x1B, 0x2B,
-  0x4D, 0x76, 0x99, 0xA8, 0xA8, 0x98, 0x7A, 0x66, 0x62, 0x75, 0x93, 0xBA,
-  0xD1, 0xDA, 0xCD, 0xB1, 0x87, 0x6A, 0x5B, 0x62, 0x77, 0x93, 0xA0, 0x99,
-  0x88, 0x62, 0x3E, 0x23, 0x23, 0x30, 0x5A, 0x85, 0xAA, 0xB6, 0xB6, 0xA1,
-  0x83, 0x72, 0x6F, 0x80, 0x9A, 0xB8, 0xC1, 0xC0, 0xA4, 0x7D, 0x40, 0x20,
-  0x3E, 0x5A, 0x98, 0xC0, 0xB7, 0xAD, 0x90, 0x6A, 0x43, 0x2F, 0x2D, 0x3E,
-  0x5B, 0x7C, 0x91, 0x94, 0x85, 0x67, 0x4E, 0x45, 0x52, 0x6D, 0x9A, 0xBD,
-  0xD2, 0xD0, 0xC1, 0xA1, 0x83, 0x71, 0x71, 0x84, 0xA5, 0xBD, 0xC3, 0xB9,
-  0x99, 0x6A, 0x3E, 0x2E, 0x2A, 0x40, 0x5F, 0x83, 0x91, 0x94, 0x81, 0x69,
-  0x58, 0x57, 0x6B, 0x8A, 0xB6, 0xD0, 0xDD, 0xD0, 0xB3, 0x81, 0x5D, 0x49,
-  0x4F, 0x60, 0x72, 0xA1, 0xAE, 0xAF, 0x99, 0x5F, 0x45, 0x41, 0x58, 0x79,
-  0x91, 0x96, 0x83, 0x5D, 0x36, 0x26, 0x2B, 0x46, 0x70, 0x9B, 0xAD, 0xB3,
-  0x9D, 0x7E, 0x65, 0x64, 0x78, 0x9D, 0xC2, 0xD6, 0xD6, 0xC0, 0x99, 0x72,
-  0x5F, 0x5D, 0x72, 0x91, 0xA7, 0xA0, 0x8F, 0x65, 0x3F, 0x25, 0x26, 0x3C,
-  0x66, 0x91, 0xA8, 0xB1, 0x9F, 0x86, 0x6D, 0x6B, 0x77, 0x9A, 0xB8, 0xC9,
-  0xC5, 0xB2, 0x87, 0x58, 0x37, 0x20, 0x4D, 0x88, 0xB5, 0xD4, 0xB7, 0x8A,
-  0x5D, 0x3E, 0x35, 0x41, 0x61, 0x80, 0x90, 0x89, 0x78, 0x55, 0x3C, 0x33,
-  0x45, 0x67, 0x99, 0xB8, 0xC5, 0xBC, 0xA0, 0x7F, 0x6C, 0x71, 0x8C, 0xB4,
-  0xCC, 0xD4, 0xC8, 0xA9, 0x79, 0x5B, 0x4A, 0x55, 0x69, 0x87, 0x93, 0x8F,
-  0x75, 0x4F, 0x34, 0x29, 0x3B, 0x5F, 0x97, 0xB9, 0xCE, 0xC4, 0xA7, 0x83,
-  0x70, 0x6F, 0x81, 0xA2, 0xBA, 0xBF, 0xAB, 0x88, 0x45, 0x2F, 0x3F, 0x59,
-  0x97, 0xB4, 0xB5, 0xAC, 0x8E, 0x63, 0x3B, 0x2D, 0x30, 0x4A, 0x6C, 0x8C,
-  0x98, 0x91, 0x72, 0x52, 0x3F, 0x46, 0x63, 0x8F, 0xB9, 0xCC, 0xCD, 0xB6,
-  0x93, 0x73, 0x6B, 0x74, 0x95, 0xB7, 0xCB, 0xC6, 0xAF, 0x82, 0x57, 0x3B,
-  0x37, 0x4A, 0x6B, 0x89, 0x90, 0x8C, 0x6E, 0x4F, 0x39, 0x43, 0x5F, 0x94,
-  0xC3, 0xDB, 0xDB, 0xC3, 0x98, 0x6F, 0x5D, 0x61, 0x7F, 0x9C, 0xAB, 0x94,
-  0x80, 0x77, 0x59, 0x5F, 0x62, 0x63, 0x86, 0x9E, 0xA6, 0x95, 0x6F, 0x40,
-  0x24, 0x1C, 0x31, 0x5A, 0x86, 0x9E, 0xA3, 0x93, 0x71, 0x58, 0x51, 0x62,
-  0x84, 0xB3, 0xCB, 0xD4, 0xC8, 0xAC, 0x83, 0x69, 0x65, 0x7A, 0x9D, 0xB8,
-  0xBE, 0xB0, 0x8A, 0x57, 0x37, 0x29, 0x35, 0x52, 0x7E, 0x96, 0x9F, 0x90,
-  0x75, 0x5B, 0x55, 0x67, 0x87, 0xB5, 0xD3, 0xDC, 0xCC, 0xA9, 0x79, 0x59,
-  0x47, 0x55, 0x67, 0x7D, 0xA8, 0xB1, 0xAD, 0x8C, 0x56, 0x42, 0x43, 0x5F,
-  0x83, 0x9A, 0x9A, 0x84, 0x59, 0x34, 0x27, 0x2F, 0x4D, 0x7A, 0xA2, 0xB2,
-  0xB2, 0x97, 0x75, 0x5D, 0x5F, 0x76, 0x9F, 0xC3, 0xD5, 0xD1, 0xB8, 0x8E,
-  0x69, 0x57, 0x5C, 0x79, 0x99, 0xAD, 0xA5, 0x8F, 0x63, 0x3D, 0x25, 0x2B,
-  0x44, 0x72, 0x9A, 0xAE, 0xB1, 0x9B, 0x7F, 0x67, 0x67, 0x78, 0x9D, 0xBB,
-  0xCB, 0xC4, 0xAE, 0x7F, 0x53, 0x34, 0x27, 0x5A, 0x8F, 0xBA, 0xD1, 0xB2,
-  0x84, 0x56, 0x3C, 0x36, 0x46, 0x6A, 0x8A, 0x96, 0x8D, 0x76, 0x51, 0x38,
-  0x33, 0x48, 0x6E, 0x9F, 0xBA, 0xC3, 0xB5, 0x95, 0x73, 0x63, 0x6B, 0x8C,
-  0xB4, 0xCC, 0xD2, 0xC3, 0x9F, 0x70, 0x53, 0x4A, 0x58, 0x71, 0x92, 0x9B,
-  0x95, 0x76, 0x4E, 0x32, 0x2C, 0x40, 0x68, 0x9E, 0xBE, 0xCD, 0xBD, 0x9D,
-  0x79, 0x69, 0x6B, 0x84, 0xA7, 0xBE, 0xBF, 0xAB, 0x82, 0x41, 0x33, 0x42,
-  0x61, 0x9F, 0xB6, 0xB7, 0xAC, 0x8B, 0x5F, 0x3B, 0x2D, 0x35, 0x54, 0x7B,
-  0x98, 0xA0, 0x93, 0x6E, 0x4D, 0x3B, 0x43, 0x63, 0x93, 0xBA, 0xC9, 0xC6,
-  0xA9, 0x80, 0x62, 0x5C, 0x6B, 0x91, 0xB6, 0xC8, 0xC2, 0xA8, 0x77, 0x4F,
-  0x37, 0x3A, 0x53, 0x7A, 0x97, 0x9E, 0x94, 0x70, 0x4C, 0x38, 0x43, 0x61,
-  0x96, 0xC2, 0xD7, 0xD2, 0xB5, 0x87, 0x60, 0x53, 0x5F, 0x83, 0xA3, 0xB3,
-  0x9F, 0x8A, 0x74, 0x56, 0x58, 0x59, 0x67, 0x8F, 0xA9, 0xAF, 0x9B, 0x71,
-  0x43, 0x28, 0x23, 0x3C, 0x6A, 0x96, 0xA9, 0xA9, 0x92, 0x6C, 0x51, 0x4A,
-  0x5C, 0x84, 0xB1, 0xCA, 0xCF, 0xBE, 0x9B, 0x70, 0x5A, 0x5B, 0x76, 0x9C,
-  0xBA, 0xBF, 0xAF, 0x84, 0x53, 0x35, 0x2C, 0x3E, 0x61, 0x8F, 0xA3, 0xA8,
-  0x91, 0x71, 0x54, 0x4F, 0x61, 0x87, 0xB5, 0xD2, 0xD7, 0xC4, 0x9B, 0x6A,
-  0x4E, 0x46, 0x5C, 0x74, 0x91, 0xB3, 0xB4, 0xA8, 0x81, 0x50, 0x40, 0x48,
-  0x6B, 0x90, 0xA6, 0xA3, 0x88, 0x59, 0x36, 0x29, 0x36, 0x5E, 0x8F, 0xB1,
-  0xB7, 0xA5, 0x7C, 0x5A, 0x4E, 0x62, 0x8B, 0xB7, 0xCD, 0xCE, 0xB3, 0x85,
-  0x5F, 0x50, 0x5F, 0x85, 0xAB, 0xBB, 0xB1, 0x89, 0x58, 0x33, 0x2C, 0x3D,
-  0x6A, 0x95, 0xAD, 0xA9, 0x8E, 0x68, 0x4F, 0x53, 0x6F, 0x9F, 0xC6, 0xD7,
-  0xC9, 0xA4, 0x70, 0x4E, 0x45, 0x5C, 0x7D, 0x95, 0xB3, 0xAF, 0x95, 0x72,
-  0x49, 0x44, 0x5B, 0x87, 0xA7, 0xAD, 0x97, 0x6B, 0x3D, 0x25, 0x30, 0x55,
-  0x87, 0xA8, 0xB4, 0xA2, 0x7D, 0x58, 0x4A, 0x58, 0x82, 0xB0, 0xCB, 0xCE,
-  0xB9, 0x8E, 0x64, 0x52, 0x5F, 0x82, 0xAB, 0xC1, 0xB9, 0x99, 0x64, 0x3D,
-  0x2C, 0x3C, 0x60, 0x8D, 0xA5, 0xA6, 0x8C, 0x64, 0x4A, 0x48, 0x66, 0x95,
-  0xC4, 0xD8, 0xD4, 0xAE, 0x7C, 0x55, 0x4D, 0x5F, 0x87, 0xA5, 0xA2, 0xA4,
-  0x8D, 0x6A, 0x5B, 0x4E, 0x5E, 0x87, 0xA9, 0xB1, 0x9F, 0x73, 0x43, 0x27,
-  0x28, 0x4C, 0x7E, 0xA5, 0xB0, 0xA3, 0x7C, 0x57, 0x43, 0x4E, 0x73, 0xA4,
-  0xC6, 0xCC, 0xBA, 0x92, 0x68, 0x51, 0x59, 0x7C, 0xA9, 0xC1, 0xC2, 0xA4,
-  0x74, 0x45, 0x33, 0x3B, 0x60, 0x8A, 0xA5, 0xA8, 0x8F, 0x66, 0x42, 0x3F,
-  0x54, 0x86, 0xB6, 0xD3, 0xD0, 0xB3, 0x81, 0x59, 0x4C, 0x5F, 0x89, 0xAC,
-  0xB9, 0xA1, 0x85, 0x63, 0x48, 0x52, 0x65, 0x88, 0xAD, 0xB9, 0xAA, 0x80,
-  0x4F, 0x2E, 0x2C, 0x45, 0x77, 0xA1, 0xB1, 0xA4, 0x80, 0x55, 0x3F, 0x46,
-  0x69, 0x9B, 0xBF, 0xCC, 0xBD, 0x97, 0x6B, 0x54, 0x57, 0x78, 0xA5, 0xC4,
-  0xC6, 0xAF, 0x7F, 0x51, 0x38, 0x3C, 0x5B, 0x86, 0xA3, 0xA6, 0x92, 0x67,
-  0x43, 0x36, 0x4B, 0x76, 0xAB, 0xCA, 0xCE, 0xB5, 0x88, 0x62, 0x51, 0x60,
-  0x86, 0xAF, 0xBD, 0xB5, 0x89, 0x58, 0x43, 0x40, 0x64, 0x8F, 0xAE, 0xBE,
-  0xB1, 0x8B, 0x59, 0x37, 0x2F, 0x45, 0x6F, 0x9A, 0xAD, 0xA5, 0x83, 0x58,
-  0x3E, 0x40, 0x60, 0x91, 0xBB, 0xCA, 0xC2, 0x9B, 0x6D, 0x50, 0x54, 0x71,
-  0x9E, 0xC0, 0xC9, 0xB6, 0x8B, 0x5B, 0x3F, 0x40, 0x5A, 0x86, 0xA6, 0xAD,
-  0x97, 0x6E, 0x44, 0x33, 0x3E, 0x68, 0x9C, 0xC0, 0xC8, 0xB3, 0x8A, 0x61,
-  0x51, 0x5A, 0x7F, 0xA9, 0xC1, 0xBC, 0x9F, 0x68, 0x3A, 0x38, 0x4E, 0x82,
-  0xB3, 0xC1, 0xB9, 0x95, 0x65, 0x3F, 0x33, 0x45, 0x6E, 0x97, 0xAC, 0xA9,
-  0x8A, 0x5E, 0x3D, 0x3A, 0x54, 0x85, 0xB1, 0xC7, 0xC1, 0xA0, 0x72, 0x53,
-  0x4F, 0x6C, 0x99, 0xBE, 0xCA, 0xBD, 0x94, 0x64, 0x45, 0x41, 0x5B, 0x84,
-  0xA7, 0xAE, 0x9E, 0x72, 0x48, 0x2F, 0x37, 0x5B, 0x8E, 0xB6, 0xC3, 0xB5,
-  0x8C, 0x66, 0x50, 0x5A, 0x7A, 0xA6, 0xC0, 0xC3, 0xA9, 0x7A, 0x49, 0x2C,
-  0x42, 0x70, 0xA5, 0xCA, 0xC2, 0xA3, 0x71, 0x47, 0x37, 0x43, 0x69, 0x94,
-  0xAB, 0xA9, 0x8F, 0x63, 0x40, 0x37, 0x4D, 0x79, 0xA9, 0xC1, 0xC1, 0xA4,
-  0x77, 0x56, 0x4F, 0x66, 0x95, 0xBD, 0xCC, 0xC1, 0x9A, 0x69, 0x46, 0x41,
-  0x57, 0x82, 0xA8, 0xB6, 0xA7, 0x80, 0x50, 0x33, 0x34, 0x53, 0x84, 0xAD,
-  0xBF, 0xB2, 0x8D, 0x61, 0x4A, 0x4E, 0x6F, 0x9C, 0xBD, 0xC4, 0xB1, 0x85,
-  0x54, 0x39, 0x38, 0x60, 0x96, 0xBB, 0xC9, 0xAE, 0x7D, 0x50, 0x3A, 0x42,
-  0x65, 0x94, 0xB0, 0xB2, 0x97, 0x6B, 0x44, 0x35, 0x44, 0x6F, 0xA0, 0xBC,
-  0xBF, 0xA4, 0x77, 0x52, 0x46, 0x5A, 0x86, 0xB3, 0xCA, 0xC5, 0xA4, 0x73,
-  0x4D, 0x42, 0x56, 0x80, 0xAA, 0xB9, 0xAE, 0x88, 0x57, 0x36, 0x31, 0x4D,
-  0x7B, 0xA7, 0xB9, 0xB4, 0x91, 0x66, 0x4A, 0x4B, 0x68, 0x97, 0xBD, 0xC9,
-  0xB9, 0x8F, 0x5F, 0x3E, 0x3E, 0x56, 0x87, 0xB3, 0xC0, 0xB8, 0x8C, 0x5A,
-  0x3F, 0x41, 0x61, 0x90, 0xB0, 0xB6, 0xA0, 0x71, 0x47, 0x34, 0x40, 0x67,
-  0x98, 0xB8, 0xBF, 0xA8, 0x7B, 0x54, 0x47, 0x58, 0x7F, 0xAE, 0xC7, 0xC8,
-  0xAB, 0x7C, 0x55, 0x47, 0x57, 0x7F, 0xA8, 0xBD, 0xBE, 0xBA, 0xB7, 0xB4,
-  0xB2, 0xAF, 0xAF, 0xAE, 0xB0, 0xAF, 0xB1, 0xB2, 0xB4, 0xB4, 0xB3, 0xB4,
-  0xB3, 0xB4, 0xB2, 0xB0, 0xAD, 0xAA, 0xA5, 0xA1, 0x99, 0x96, 0x9C, 0x9D,
-  0xA3, 0xA3, 0x9C, 0x99, 0x94, 0x92, 0x90, 0x8E, 0x8C, 0x8B, 0x89, 0x89,
-  0x89, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91,
-  0x91, 0x90, 0x91, 0x8F, 0x8E, 0x8D, 0x8C, 0x89, 0x87, 0x85, 0x82, 0x7F,
-  0x7B, 0x79, 0x76, 0x75, 0x74, 0x75, 0x74, 0x77, 0x77, 0x7A, 0x7D, 0x7F,
-  0x82, 0x83, 0x84, 0x83, 0x84, 0x83, 0x82, 0x7F, 0x7E, 0x7B, 0x78, 0x72,
-  0x6D, 0x73, 0x77, 0x7D, 0x80, 0x7B, 0x77, 0x75, 0x73, 0x71, 0x70, 0x6F,
-  0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x71, 0x72, 0x74, 0x75, 0x78, 0x79, 0x7B,
-  0x7C, 0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7B, 0x7A,
-  0x78, 0x76, 0x74, 0x70, 0x6E, 0x6D, 0x6C, 0x6C, 0x70, 0x70, 0x71, 0x72,
-  0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x78, 0x79, 0x78, 0x79, 0x77, 0x77,
-  0x75, 0x75, 0x72, 0x6F, 0x71, 0x74, 0x76, 0x79, 0x77, 0x74, 0x73, 0x72,
-  0x72, 0x71, 0x71, 0x70, 0x71, 0x70, 0x71, 0x72, 0x73, 0x73, 0x74, 0x75,
-  0x76, 0x77, 0x78, 0x79, 0x7A, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A, 0x7B,
-  0x7A, 0x79, 0x79, 0x78, 0x76, 0x76, 0x74, 0x74, 0x73, 0x72, 0x71, 0x72,
-  0x72, 0x72, 0x73, 0x74, 0x75, 0x77, 0x78, 0x79, 0x7A, 0x79, 0x7A, 0x7A,
-  0x79, 0x79, 0x78, 0x78, 0x77, 0x75, 0x71, 0x73, 0x75, 0x77, 0x7A, 0x79,
-  0x77, 0x76, 0x75, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x74, 0x74, 0x75,
-  0x76, 0x77, 0x78, 0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7C, 0x7C, 0x7A, 0x7A, 0x78, 0x77, 0x76,
-  0x75, 0x76, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A,
-  0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A,
-  0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B,
-  0x7A, 0x7B, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 0x7D, 0x7C,
-  0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7D,
-  0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C,
-  0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B,
-  0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C,
-  0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C,
-  0x7D, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E,
-  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
-  0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
-  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F,
-  0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F,
-  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x81, 0x62, 0x1A, 0x17,
-  0x2C, 0x5C, 0x99, 0x94, 0x81, 0x59, 0x2D, 0x17, 0x21, 0x45, 0x63, 0x68,
-  0x5A, 0x3B, 0x24, 0x28, 0x4A, 0x7A, 0x99, 0x9C, 0x84, 0x68, 0x63, 0x79,
-  0xA2, 0xC6, 0xCB, 0xB1, 0x82, 0x67, 0x63, 0x80, 0xA0, 0xA7, 0x8D, 0x57,
-  0x29, 0x19, 0x2C, 0x56, 0x78, 0x7E, 0x6A, 0x4A, 0x44, 0x5C, 0x93, 0xC1,
-  0xD3, 0xC7, 0xA1, 0x7D, 0x75, 0x88, 0xAC, 0xB4, 0xA4, 0x61, 0x2F, 0x43,
-  0x61, 0xAD, 0xC1, 0xB0, 0x90, 0x58, 0x30, 0x28, 0x48, 0x70, 0x82, 0x79,
-  0x5E, 0x3B, 0x31, 0x49, 0x7D, 0xA8, 0xB9, 0xA9, 0x88, 0x75, 0x80, 0xA4,
-  0xD1, 0xE4, 0xD7, 0xAA, 0x80, 0x73, 0x81, 0xA4, 0xB4, 0xAB, 0x7F, 0x4A,
-  0x2C, 0x30, 0x52, 0x7A, 0x8B, 0x84, 0x63, 0x50, 0x59, 0x86, 0xBB, 0xD9,
-  0xDB, 0xBD, 0x94, 0x7E, 0x85, 0xA5, 0xBE, 0xB7, 0x8C, 0x41, 0x41, 0x57,
-  0x92, 0xCA, 0xBE, 0xA8, 0x76, 0x44, 0x2C, 0x3C, 0x66, 0x86, 0x88, 0x74,
-  0x4E, 0x37, 0x3F, 0x6A, 0x9C, 0xBA, 0xB9, 0x99, 0x7B, 0x78, 0x92, 0xBF,
-  0xE2, 0xE2, 0xC1, 0x8F, 0x75, 0x76, 0x96, 0xB2, 0xB6, 0x98, 0x63, 0x36,
-  0x2B, 0x43, 0x6C, 0x89, 0x8C, 0x74, 0x54, 0x50, 0x6A, 0xA3, 0xCE, 0xDC,
-  0xCC, 0xA4, 0x81, 0x7C, 0x92, 0xB7, 0xBC, 0xA6, 0x5E, 0x39, 0x4D, 0x6C,
-  0xB8, 0xC5, 0xB4, 0x8F, 0x57, 0x32, 0x30, 0x53, 0x7B, 0x89, 0x7F, 0x5E,
-  0x3C, 0x36, 0x52, 0x88, 0xB0, 0xBE, 0xAA, 0x86, 0x73, 0x82, 0xA9, 0xD5,
-  0xE4, 0xD2, 0xA2, 0x7B, 0x70, 0x84, 0xA7, 0xB5, 0xA8, 0x78, 0x45, 0x2A,
-  0x32, 0x57, 0x7F, 0x8C, 0x81, 0x5C, 0x4A, 0x58, 0x87, 0xBD, 0xD8, 0xD5,
-  0xB5, 0x8A, 0x78, 0x83, 0xA7, 0xBB, 0xB3, 0x83, 0x3C, 0x41, 0x57, 0x98,
-  0xC7, 0xB9, 0xA4, 0x6E, 0x3D, 0x29, 0x3F, 0x6A, 0x86, 0x84, 0x6D, 0x47,
-  0x33, 0x40, 0x6E, 0xA0, 0xBB, 0xB5, 0x93, 0x77, 0x77, 0x93, 0xC1, 0xE0,
-  0xDD, 0xB7, 0x86, 0x6F, 0x73, 0x97, 0xB2, 0xB2, 0x92, 0x5A, 0x30, 0x29,
-  0x43, 0x6F, 0x8A, 0x8A, 0x6C, 0x4D, 0x4D, 0x6C, 0xA4, 0xCD, 0xD8, 0xC3,
-  0x98, 0x78, 0x76, 0x91, 0xB5, 0xB9, 0x9F, 0x53, 0x36, 0x49, 0x71, 0xB9,
-  0xC0, 0xAF, 0x87, 0x4F, 0x2C, 0x2F, 0x56, 0x7E, 0x89, 0x7B, 0x58, 0x38,
-  0x35, 0x55, 0x8B, 0xB1, 0xBB, 0xA1, 0x7D, 0x70, 0x81, 0xAB, 0xD6, 0xE1,
-  0xCB, 0x98, 0x75, 0x6D, 0x85, 0xA9, 0xB6, 0xA3, 0x71, 0x3D, 0x25, 0x33,
-  0x5B, 0x80, 0x8B, 0x7B, 0x55, 0x48, 0x57, 0x89, 0xBE, 0xD5, 0xCF, 0xAA,
-  0x80, 0x72, 0x81, 0xA7, 0xB9, 0xAD, 0x75, 0x35, 0x3F, 0x56, 0x9B, 0xC3,
-  0xB5, 0x9B, 0x63, 0x38, 0x27, 0x41, 0x6E, 0x86, 0x83, 0x6A, 0x43, 0x32,
-  0x42, 0x74, 0xA4, 0xBA, 0xB0, 0x8C, 0x71, 0x76, 0x97, 0xC6, 0xE1, 0xD9,
-  0xB0, 0x81, 0x6D, 0x75, 0x9A, 0xB3, 0xB1, 0x8A, 0x52, 0x2C, 0x2A, 0x49,
-  0x76, 0x8E, 0x89, 0x67, 0x48, 0x49, 0x6D, 0xA8, 0xCD, 0xD4, 0xBB, 0x8D,
-  0x70, 0x73, 0x92, 0xB5, 0xB6, 0x98, 0x4D, 0x36, 0x47, 0x75, 0xB9, 0xBB,
-  0xAB, 0x7E, 0x48, 0x29, 0x31, 0x5B, 0x82, 0x8A, 0x79, 0x53, 0x33, 0x35,
-  0x59, 0x90, 0xB3, 0xB8, 0x9A, 0x76, 0x6C, 0x80, 0xAD, 0xD6, 0xDE, 0xC3,
-  0x8E, 0x6E, 0x69, 0x86, 0xAB, 0xB6, 0xA0, 0x6B, 0x38, 0x25, 0x37, 0x62,
-  0x87, 0x90, 0x7A, 0x53, 0x47, 0x5A, 0x8F, 0xC1, 0xD7, 0xCB, 0xA2, 0x78,
-  0x6E, 0x80, 0xA9, 0xB9, 0xAC, 0x6D, 0x35, 0x40, 0x59, 0xA0, 0xC0, 0xB4,
-  0x96, 0x5D, 0x32, 0x27, 0x46, 0x74, 0x8A, 0x82, 0x64, 0x3E, 0x30, 0x44,
-  0x78, 0xA6, 0xBA, 0xA9, 0x83, 0x6C, 0x73, 0x96, 0xC7, 0xDF, 0xD3, 0xA7,
-  0x79, 0x68, 0x77, 0x9E, 0xB5, 0xAF, 0x85, 0x4C, 0x29, 0x2C, 0x4F, 0x7B,
-  0x8F, 0x88, 0x63, 0x49, 0x4D, 0x74, 0xB0, 0xD1, 0xD5, 0xB4, 0x86, 0x6D,
-  0x73, 0x96, 0xB7, 0xB6, 0x91, 0x47, 0x38, 0x49, 0x7C, 0xBA, 0xBA, 0xA9,
-  0x79, 0x44, 0x28, 0x36, 0x62, 0x87, 0x8B, 0x77, 0x4F, 0x31, 0x36, 0x60,
-  0x96, 0xB5, 0xB6, 0x94, 0x70, 0x68, 0x81, 0xB1, 0xD7, 0xDB, 0xBC, 0x86,
-  0x68, 0x68, 0x8A, 0xAC, 0xB6, 0x9D, 0x65, 0x34, 0x26, 0x3D, 0x6B, 0x8D,
-  0x90, 0x77, 0x4F, 0x45, 0x5D, 0x96, 0xC5, 0xD6, 0xC6, 0x9B, 0x74, 0x6D,
-  0x83, 0xAD, 0xB9, 0xA9, 0x67, 0x36, 0x43, 0x5F, 0xA8, 0xBF, 0xB3, 0x93,
-  0x58, 0x30, 0x2A, 0x4D, 0x79, 0x8C, 0x82, 0x60, 0x3A, 0x2F, 0x49, 0x7F,
-  0xAA, 0xB9, 0xA4, 0x7D, 0x67, 0x73, 0x9A, 0xC9, 0xDD, 0xCD, 0x9D, 0x71,
-  0x64, 0x76, 0x9F, 0xB5, 0xAC, 0x7E, 0x46, 0x28, 0x2E, 0x55, 0x81, 0x93,
-  0x88, 0x5F, 0x47, 0x50, 0x7B, 0xB4, 0xD3, 0xD2, 0xB0, 0x81, 0x6D, 0x76,
-  0x9C, 0xBA, 0xB6, 0x8A, 0x41, 0x3D, 0x4C, 0x86, 0xC0, 0xBA, 0xA6, 0x72,
-  0x3F, 0x28, 0x3B, 0x6A, 0x8C, 0x8E, 0x75, 0x4A, 0x31, 0x39, 0x67, 0x9C,
-  0xB8, 0xB2, 0x8D, 0x6A, 0x66, 0x82, 0xB3, 0xD7, 0xD7, 0xB2, 0x7D, 0x63,
-  0x67, 0x8C, 0xAF, 0xB4, 0x96, 0x5E, 0x30, 0x26, 0x42, 0x72, 0x90, 0x92,
-  0x73, 0x4B, 0x45, 0x5F, 0x99, 0xC7, 0xD5, 0xC0, 0x92, 0x6F, 0x6A, 0x87,
-  0xB0, 0xBA, 0xA5, 0x60, 0x37, 0x42, 0x64, 0xAD, 0xBF, 0xB3, 0x8D, 0x54,
-  0x2E, 0x2E, 0x56, 0x82, 0x92, 0x84, 0x5F, 0x39, 0x32, 0x50, 0x88, 0xB1,
-  0xBB, 0xA1, 0x77, 0x63, 0x72, 0x9D, 0xCC, 0xDB, 0xC7, 0x93, 0x6A, 0x60,
-  0x79, 0xA3, 0xB5, 0xA9, 0x78, 0x41, 0x25, 0x32, 0x5D, 0x87, 0x94, 0x83,
-  0x5A, 0x43, 0x4F, 0x7E, 0xB6, 0xD2, 0xCC, 0xA7, 0x7A, 0x68, 0x76, 0xA0,
-  0xBA, 0xB5, 0x85, 0x3F, 0x3D, 0x50, 0x8F, 0xBF, 0xBA, 0xA3, 0x6C, 0x3B,
-  0x29, 0x41, 0x71, 0x8F, 0x8E, 0x72, 0x46, 0x31, 0x3D, 0x70, 0xA2, 0xBB,
-  0xB0, 0x88, 0x67, 0x66, 0x86, 0xB8, 0xD9, 0xD4, 0xAB, 0x77, 0x60, 0x68,
-  0x91, 0xB2, 0xB5, 0x93, 0x59, 0x2E, 0x29, 0x49, 0x7A, 0x95, 0x93, 0x6F,
-  0x49, 0x45, 0x64, 0x9F, 0xC8, 0xD3, 0xB9, 0x89, 0x68, 0x69, 0x89, 0xB2,
-  0xBA, 0xA1, 0x59, 0x39, 0x43, 0x69, 0xB0, 0xBF, 0xB2, 0x87, 0x4F, 0x2D,
-  0x33, 0x5D, 0x89, 0x95, 0x84, 0x5B, 0x37, 0x34, 0x57, 0x8F, 0xB4, 0xBA,
-  0x9B, 0x72, 0x62, 0x74, 0xA2, 0xD0, 0xDA, 0xC2, 0x8C, 0x67, 0x60, 0x7E,
-  0xA8, 0xB8, 0xA7, 0x72, 0x3D, 0x27, 0x37, 0x64, 0x8D, 0x96, 0x81, 0x55,
-  0x41, 0x50, 0x83, 0xBA, 0xD1, 0xC8, 0x9F, 0x73, 0x64, 0x77, 0xA3, 0xBA,
-  0xB1, 0x7A, 0x3C, 0x3C, 0x51, 0x94, 0xBE, 0xB8, 0x9E, 0x66, 0x38, 0x2A,
-  0x48, 0x79, 0x94, 0x90, 0x70, 0x44, 0x32, 0x44, 0x78, 0xA8, 0xBC, 0xAD,
-  0x83, 0x65, 0x69, 0x8D, 0xC0, 0xDB, 0xD2, 0xA5, 0x74, 0x5A, 0x64, 0x92,
-  0xB2, 0xB4, 0x90, 0x55, 0x2E, 0x2E, 0x52, 0x85, 0x9E, 0x95, 0x6C, 0x45,
-  0x42, 0x64, 0xA0, 0xC8, 0xCD, 0xAE, 0x7B, 0x5D, 0x62, 0x89, 0xB2, 0xB9,
-  0x9F, 0x57, 0x3A, 0x42, 0x6D, 0xAF, 0xBD, 0xB1, 0x83, 0x4A, 0x2C, 0x38,
-  0x67, 0x92, 0x9B, 0x87, 0x59, 0x36, 0x36, 0x5D, 0x96, 0xB8, 0xB9, 0x94,
-  0x68, 0x5A, 0x71, 0xA1, 0xCD, 0xD6, 0xB8, 0x80, 0x5D, 0x5B, 0x7E, 0xAB,
-  0xBB, 0xA7, 0x70, 0x3B, 0x2A, 0x40, 0x72, 0x99, 0xA0, 0x83, 0x55, 0x42,
-  0x52, 0x88, 0xBC, 0xD0, 0xC1, 0x92, 0x67, 0x5D, 0x75, 0xA4, 0xBB, 0xB0,
-  0x76, 0x3F, 0x3E, 0x53, 0x95, 0xBC, 0xB9, 0x9C, 0x62, 0x35, 0x2E, 0x50,
-  0x83, 0x9B, 0x94, 0x6F, 0x42, 0x32, 0x47, 0x7F, 0xAD, 0xBD, 0xA6, 0x7A,
-  0x5D, 0x63, 0x8A, 0xBF, 0xD8, 0xCB, 0x9A, 0x69, 0x59, 0x6C, 0x9B, 0xBC,
-  0xBA, 0x8C, 0x4D, 0x26, 0x2C, 0x59, 0x8E, 0xA5, 0x98, 0x68, 0x4D, 0x53,
-  0x5D, 0x6A, 0x71, 0x77, 0x7B, 0x7E, 0x7C, 0x78, 0x72, 0x6A, 0x5E, 0x4E,
-  0x33, 0x41, 0x57, 0x70, 0x85, 0x74, 0x68, 0x5C, 0x54, 0x4D, 0x48, 0x45,
-  0x43, 0x3F, 0x42, 0x46, 0x49, 0x4E, 0x55, 0x5F, 0x6B, 0x75, 0x80, 0x8A,
-  0x91, 0x98, 0x9B, 0x9F, 0xA2, 0xA1, 0x9D, 0x9B, 0x95, 0x8F, 0x86, 0x7D,
-  0x72, 0x64, 0x5A, 0x53, 0x4D, 0x4A, 0x4C, 0x52, 0x5B, 0x65, 0x75, 0x83,
-  0x92, 0x9C, 0xA3, 0xA8, 0xAB, 0xAA, 0xA8, 0xA0, 0x9A, 0x8D, 0x7F, 0x64,
-  0x5A, 0x71, 0x81, 0x9E, 0x99, 0x84, 0x76, 0x6B, 0x63, 0x5D, 0x5B, 0x5A,
-  0x59, 0x59, 0x5F, 0x64, 0x69, 0x70, 0x79, 0x81, 0x8B, 0x92, 0x9B, 0xA1,
-  0xA6, 0xA8, 0xAA, 0xAC, 0xAC, 0xA8, 0xA4, 0xA0, 0x99, 0x93, 0x8A, 0x82,
-  0x77, 0x6C, 0x65, 0x61, 0x5F, 0x61, 0x64, 0x6A, 0x71, 0x7C, 0x87, 0x94,
-  0x9F, 0xA6, 0xAB, 0xAD, 0xAD, 0xA9, 0xA4, 0x9E, 0x94, 0x86, 0x74, 0x5E,
-  0x6E, 0x7D, 0x93, 0xA1, 0x91, 0x86, 0x7A, 0x73, 0x6B, 0x67, 0x64, 0x61,
-  0x5C, 0x5F, 0x61, 0x63, 0x67, 0x6E, 0x76, 0x80, 0x8A, 0x92, 0x9A, 0xA0,
-  0xA5, 0xA7, 0xAB, 0xAB, 0xAA, 0xA7, 0xA3, 0x9D, 0x97, 0x8E, 0x86, 0x7B,
-  0x70, 0x66, 0x5F, 0x5A, 0x59, 0x5B, 0x61, 0x68, 0x72, 0x7F, 0x8B, 0x98,
-  0xA1, 0xA7, 0xAB, 0xAD, 0xAB, 0xA8, 0xA2, 0x9A, 0x8E, 0x81, 0x68, 0x64,
-  0x77, 0x86, 0x9E, 0x95, 0x86, 0x7B, 0x71, 0x6B, 0x66, 0x65, 0x64, 0x63,
-  0x64, 0x69, 0x6C, 0x71, 0x77, 0x7C, 0x83, 0x8B, 0x91, 0x98, 0x9D, 0xA1,
-  0xA2, 0xA5, 0xA5, 0xA5, 0xA1, 0x9E, 0x9A, 0x96, 0x8F, 0x88, 0x81, 0x77,
-  0x6F, 0x69, 0x65, 0x62, 0x63, 0x66, 0x6A, 0x70, 0x7B, 0x84, 0x90, 0x98,
-  0x9E, 0xA1, 0xA4, 0xA4, 0xA2, 0x9D, 0x99, 0x90, 0x86, 0x74, 0x61, 0x73,
-  0x82, 0x99, 0xA2, 0x92, 0x86, 0x7A, 0x72, 0x6B, 0x66, 0x63, 0x60, 0x5D,
-  0x5E, 0x61, 0x64, 0x68, 0x6E, 0x75, 0x7E, 0x85, 0x8D, 0x92, 0x98, 0x9B,
-  0x9E, 0xA0, 0xA0, 0x9F, 0x9B, 0x99, 0x94, 0x8E, 0x87, 0x80, 0x76, 0x6D,
-  0x65, 0x61, 0x5D, 0x5C, 0x5F, 0x64, 0x6A, 0x73, 0x7D, 0x87, 0x91, 0x98,
-  0x9D, 0xA0, 0xA2, 0x9F, 0x9C, 0x97, 0x91, 0x86, 0x7C, 0x66, 0x67, 0x77,
-  0x84, 0x98, 0x8F, 0x82, 0x79, 0x71, 0x6D, 0x69, 0x67, 0x66, 0x65, 0x66,
-  0x6A, 0x6D, 0x70, 0x74, 0x7A, 0x80, 0x87, 0x8D, 0x93, 0x97, 0x9B, 0x9D,
-  0x9F, 0xA0, 0x9F, 0x9C, 0x9A, 0x96, 0x92, 0x8C, 0x85, 0x7E, 0x75, 0x6E,
-  0x68, 0x65, 0x63, 0x63, 0x66, 0x6B, 0x70, 0x79, 0x82, 0x8C, 0x93, 0x98,
-  0x9B, 0x9D, 0x9D, 0x9B, 0x97, 0x92, 0x8A, 0x82, 0x72, 0x63, 0x73, 0x7F,
-  0x95, 0x98, 0x89, 0x80, 0x76, 0x71, 0x6B, 0x68, 0x66, 0x63, 0x60, 0x63,
-  0x66, 0x68, 0x6D, 0x73, 0x7A, 0x83, 0x8A, 0x91, 0x97, 0x9C, 0x99, 0x98,
-  0x99, 0x99, 0x97, 0x93, 0x91, 0x8D, 0x89, 0x83, 0x7E, 0x77, 0x6F, 0x69,
-  0x66, 0x63, 0x64, 0x66, 0x6B, 0x70, 0x77, 0x7F, 0x87, 0x8E, 0x93, 0x96,
-  0x98, 0x99, 0x96, 0x93, 0x8F, 0x8A, 0x83, 0x7A, 0x6A, 0x6C, 0x77, 0x83,
-  0x8E, 0x87, 0x7F, 0x78, 0x74, 0x71, 0x6F, 0x6E, 0x6E, 0x6D, 0x6F, 0x72,
-  0x74, 0x76, 0x79, 0x7C, 0x80, 0x85, 0x89, 0x8D, 0x90, 0x92, 0x92, 0x94,
-  0x95, 0x94, 0x92, 0x91, 0x8F, 0x8C, 0x88, 0x85, 0x80, 0x7A, 0x76, 0x72,
-  0x6F, 0x6D, 0x6D, 0x6F, 0x71, 0x75, 0x7B, 0x81, 0x87, 0x8C, 0x90, 0x91,
-  0x93, 0x92, 0x91, 0x8F, 0x8C, 0x86, 0x7F, 0x73, 0x6E, 0x7A, 0x82, 0x91,
-  0x90, 0x86, 0x7F, 0x78, 0x73, 0x6E, 0x6C, 0x69, 0x66, 0x64, 0x66, 0x68,
-  0x6B, 0x6F, 0x75, 0x7B, 0x82, 0x87, 0x8D, 0x91, 0x96, 0x99, 0x9A, 0x9C,
-  0x9B, 0x99, 0x95, 0x92, 0x8E, 0x89, 0x84, 0x7E, 0x77, 0x70, 0x6B, 0x69,
-  0x67, 0x68, 0x6A, 0x6E, 0x71, 0x76, 0x7B, 0x81, 0x86, 0x89, 0x8C, 0x8D,
-  0x8D, 0x8B, 0x89, 0x87, 0x83, 0x7D, 0x77, 0x6C, 0x70, 0x77, 0x80, 0x87,
-  0x81, 0x7C, 0x78, 0x76, 0x73, 0x72, 0x71, 0x70, 0x70, 0x71, 0x73, 0x74,
-  0x76, 0x78, 0x7A, 0x7E, 0x81, 0x84, 0x87, 0x89, 0x8A, 0x8C, 0x8D, 0x8D,
-  0x8D, 0x8C, 0x8C, 0x8A, 0x88, 0x85, 0x83, 0x7F, 0x7B, 0x77, 0x75, 0x72,
-  0x71, 0x72, 0x73, 0x75, 0x78, 0x7C, 0x81, 0x86, 0x8A, 0x8C, 0x8D, 0x8F,
-  0x8E, 0x8D, 0x8B, 0x89, 0x85, 0x81, 0x77, 0x74, 0x7D, 0x82, 0x8C, 0x8A,
-  0x83, 0x7E, 0x79, 0x76, 0x72, 0x70, 0x6E, 0x6D, 0x6C, 0x6E, 0x70, 0x73,
-  0x75, 0x78, 0x7D, 0x81, 0x85, 0x8A, 0x8D, 0x8F, 0x90, 0x91, 0x91, 0x91,
-  0x8F, 0x8E, 0x8C, 0x89, 0x86, 0x82, 0x7E, 0x79, 0x75, 0x72, 0x70, 0x6F,
-  0x71, 0x73, 0x76, 0x79, 0x7E, 0x83, 0x88, 0x8D, 0x90, 0x92, 0x8D, 0x87,
-  0x85, 0x82, 0x81, 0x7F, 0x7C, 0x78, 0x72, 0x76, 0x79, 0x7E, 0x82, 0x7F,
-  0x7D, 0x7B, 0x7A, 0x79, 0x78, 0x79, 0x78, 0x79, 0x78, 0x79, 0x7A, 0x7A,
-  0x7B, 0x7C, 0x7D, 0x7F, 0x80, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x86,
-  0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x7F, 0x7D, 0x7C, 0x7A, 0x79, 0x78,
-  0x78, 0x79, 0x79, 0x7A, 0x7D, 0x80, 0x82, 0x84, 0x86, 0x86, 0x88, 0x87,
-  0x86, 0x86, 0x85, 0x83, 0x82, 0x7C, 0x7C, 0x80, 0x83, 0x87, 0x85, 0x81,
-  0x7F, 0x7D, 0x7B, 0x79, 0x78, 0x76, 0x75, 0x76, 0x77, 0x78, 0x7A, 0x7C,
-  0x7D, 0x7F, 0x81, 0x83, 0x85, 0x87, 0x88, 0x88, 0x89, 0x89, 0x88, 0x87,
-  0x86, 0x85, 0x83, 0x81, 0x80, 0x7E, 0x7B, 0x78, 0x78, 0x77, 0x77, 0x78,
-  0x7A, 0x7B, 0x7C, 0x80, 0x83, 0x85, 0x87, 0x88, 0x89, 0x8A, 0x89, 0x89,
-  0x88, 0x85, 0x83, 0x80, 0x7B, 0x77, 0x7A, 0x7E, 0x84, 0x86, 0x81, 0x7B,
-  0x79, 0x79, 0x78, 0x79, 0x78, 0x79, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A,
-  0x7B, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B,
-  0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7D,
-  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F,
-  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x4C, 0x49,
-  0x53, 0x54, 0x18, 0x00, 0x00, 0x00, 0x49, 0x4E, 0x46, 0x4F, 0x49, 0x43,
-  0x52, 0x44, 0x0C, 0x00, 0x00, 0x00, 0x31, 0x39, 0x39, 0x34, 0x2D, 0x31,
-  0x32, 0x2D, 0x30, 0x38, 0x00, 0x00, 0x69, 0x64, 0x33, 0x20, 0x20, 0x00,
-  0x00, 0x00, 0x49, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-  0x54, 0x44, 0x52, 0x43, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x31,
-  0x39, 0x39, 0x34, 0x2D, 0x31, 0x32, 0x2D, 0x30, 0x38, 0x00
-};
-
-uint8_t pacmanDeath[17092] = {
-  0x52, 0x49, 0x46, 0x46, 0xBC, 0x42, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-  0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0x11, 0x2B, 0x00, 0x00, 0x11, 0x2B, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-  0x64, 0x61, 0x74, 0x61, 0x14, 0x42, 0x00, 0x00, 0x7F, 0x84, 0x7B, 0x85,
-  0xB2, 0xC1, 0xA5, 0xAE, 0xD8, 0xDC, 0xDB, 0xF8, 0xE9, 0x98, 0x65, 0x73,
-  0x80, 0x7F, 0x9C, 0xC2, 0xB7, 0x91, 0x96, 0xBE, 0xCB, 0xCB, 0xE5, 0xE6,
-  0xA0, 0x62, 0x6A, 0x7F, 0x7C, 0x90, 0xBA, 0xBB, 0x96, 0x90, 0xB6, 0xCB,
-  0xC7, 0xDA, 0xE7, 0xAC, 0x63, 0x5E, 0x74, 0x72, 0x7E, 0xA6, 0xB1, 0x8E,
-  0x7B, 0x9B, 0xB7, 0xB4, 0xC3, 0xD9, 0xAB, 0x5D, 0x4F, 0x68, 0x68, 0x6E,
-  0x94, 0xA7, 0x8A, 0x70, 0x89, 0xAA, 0xAA, 0xB1, 0xCA, 0xAD, 0x5B, 0x38,
-  0x4E, 0x54, 0x56, 0x7C, 0x9B, 0x86, 0x66, 0x78, 0x9E, 0xA5, 0xA7, 0xC2,
-  0xB7, 0x68, 0x36, 0x48, 0x56, 0x54, 0x74, 0x9C, 0x90, 0x6D, 0x76, 0x9E,
-  0xAB, 0xA9, 0xC3, 0xC5, 0x7F, 0x41, 0x4B, 0x5E, 0x59, 0x70, 0x9A, 0x99,
-  0x73, 0x6F, 0x94, 0xA7, 0xA4, 0xB8, 0xC4, 0x88, 0x40, 0x3D, 0x52, 0x4F,
-  0x5F, 0x89, 0x91, 0x6E, 0x60, 0x81, 0x9B, 0x98, 0xA7, 0xBC, 0x8D, 0x3B,
-  0x2A, 0x43, 0x46, 0x4F, 0x7A, 0x8F, 0x70, 0x58, 0x75, 0x98, 0x98, 0xA2,
-  0xBD, 0x9E, 0x4C, 0x2E, 0x48, 0x50, 0x53, 0x79, 0x98, 0x82, 0x63, 0x76,
-  0x9D, 0xA1, 0xA4, 0xC0, 0xAF, 0x60, 0x33, 0x46, 0x51, 0x50, 0x70, 0x93,
-  0x84, 0x60, 0x69, 0x90, 0x9B, 0x99, 0xB5, 0xB4, 0x6C, 0x32, 0x3F, 0x54,
-  0x52, 0x69, 0x91, 0x8D, 0x67, 0x60, 0x84, 0x9C, 0x98, 0xA7, 0xBE, 0x93,
-  0x41, 0x29, 0x42, 0x47, 0x49, 0x6E, 0x90, 0x7F, 0x5C, 0x64, 0x8C, 0x9B,
-  0x99, 0xB0, 0xB9, 0x7B, 0x32, 0x2E, 0x48, 0x48, 0x52, 0x7E, 0x94, 0x76,
-  0x5C, 0x76, 0x9B, 0x9D, 0xA1, 0xBE, 0xB2, 0x67, 0x34, 0x42, 0x52, 0x4F,
-  0x66, 0x8F, 0x93, 0x71, 0x64, 0x84, 0xA1, 0x9F, 0xA9, 0xC1, 0xA1, 0x51,
-  0x2F, 0x46, 0x50, 0x4E, 0x6E, 0x93, 0x87, 0x60, 0x63, 0x8C, 0x9D, 0x99,
-  0xAE, 0xBC, 0x82, 0x36, 0x2E, 0x47, 0x48, 0x50, 0x79, 0x92, 0x79, 0x5C,
-  0x70, 0x96, 0x9F, 0xA0, 0xBA, 0xB6, 0x70, 0x35, 0x3F, 0x54, 0x50, 0x62,
-  0x8D, 0x97, 0x73, 0x63, 0x83, 0xA1, 0x9F, 0xA9, 0xC3, 0xA6, 0x56, 0x2F,
-  0x44, 0x4F, 0x4B, 0x68, 0x8F, 0x86, 0x60, 0x5D, 0x84, 0x9D, 0x9C, 0xAD,
-  0xBF, 0x92, 0x48, 0x38, 0x50, 0x51, 0x52, 0x79, 0x97, 0x7F, 0x5E, 0x6D,
-  0x94, 0x9D, 0x9C, 0xB6, 0xB9, 0x75, 0x32, 0x34, 0x4A, 0x48, 0x58, 0x83,
-  0x93, 0x73, 0x5C, 0x77, 0x9B, 0x9D, 0xA2, 0xBF, 0xAD, 0x5D, 0x2E, 0x42,
-  0x53, 0x50, 0x69, 0x93, 0x92, 0x6D, 0x67, 0x8C, 0xA5, 0xA1, 0xB0, 0xC5,
-  0x9D, 0x50, 0x38, 0x4F, 0x55, 0x57, 0x79, 0x9A, 0x8A, 0x68, 0x70, 0x98,
-  0xA5, 0xA2, 0xB9, 0xC1, 0x85, 0x3E, 0x38, 0x51, 0x52, 0x56, 0x7A, 0x97,
-  0x85, 0x62, 0x68, 0x91, 0xA3, 0x9E, 0xB2, 0xC4, 0x93, 0x43, 0x2E, 0x47,
-  0x4F, 0x4E, 0x6F, 0x95, 0x8E, 0x6B, 0x67, 0x8B, 0xA4, 0xA1, 0xAD, 0xC6,
-  0xAA, 0x5D, 0x36, 0x49, 0x57, 0x54, 0x6B, 0x93, 0x97, 0x74, 0x63, 0x81,
-  0xA1, 0xA1, 0xA6, 0xC1, 0xB5, 0x6A, 0x32, 0x3A, 0x4D, 0x48, 0x56, 0x82,
-  0x98, 0x7C, 0x62, 0x78, 0xA0, 0xA8, 0xA7, 0xBF, 0xC1, 0x82, 0x3E, 0x39,
-  0x50, 0x51, 0x56, 0x7D, 0x9A, 0x85, 0x63, 0x6E, 0x96, 0xA5, 0xA0, 0xB4,
-  0xC5, 0x93, 0x44, 0x2F, 0x49, 0x50, 0x50, 0x72, 0x97, 0x8D, 0x69, 0x66,
-  0x8B, 0xA4, 0xA0, 0xAD, 0xC5, 0xA7, 0x5A, 0x35, 0x49, 0x57, 0x55, 0x6D,
-  0x95, 0x98, 0x75, 0x66, 0x85, 0xA4, 0xA5, 0xAA, 0xC4, 0xB8, 0x6E, 0x37,
-  0x42, 0x55, 0x52, 0x62, 0x8D, 0x9C, 0x7E, 0x65, 0x7A, 0x9E, 0xA3, 0xA2,
-  0xBC, 0xBE, 0x7D, 0x39, 0x37, 0x4F, 0x4F, 0x56, 0x7D, 0x99, 0x83, 0x63,
-  0x6F, 0x97, 0xA5, 0xA1, 0xB6, 0xC5, 0x91, 0x45, 0x36, 0x50, 0x55, 0x56,
-  0x79, 0x9D, 0x92, 0x6F, 0x6E, 0x92, 0xA9, 0xA5, 0xB2, 0xC9, 0xA8, 0x5A,
-  0x37, 0x4C, 0x58, 0x54, 0x6C, 0x94, 0x95, 0x70, 0x62, 0x83, 0xA1, 0x9F,
-  0xA5, 0xC0, 0xB0, 0x66, 0x34, 0x42, 0x58, 0x58, 0x66, 0x8F, 0xA0, 0x84,
-  0x67, 0x74, 0x9A, 0xA8, 0xA3, 0xB4, 0xC9, 0xA1, 0x51, 0x30, 0x47, 0x54,
-  0x50, 0x65, 0x8F, 0x9A, 0x7A, 0x61, 0x76, 0x9C, 0xA4, 0xA1, 0xB8, 0xC4,
-  0x90, 0x45, 0x31, 0x4A, 0x53, 0x52, 0x6D, 0x94, 0x97, 0x76, 0x65, 0x80,
-  0xA3, 0xA6, 0xA6, 0xC0, 0xC4, 0x87, 0x42, 0x39, 0x53, 0x58, 0x59, 0x78,
-  0x9C, 0x95, 0x70, 0x67, 0x89, 0xA7, 0xA5, 0xA9, 0xC3, 0xBC, 0x77, 0x3A,
-  0x3D, 0x55, 0x55, 0x59, 0x7D, 0x9D, 0x8E, 0x69, 0x69, 0x8F, 0xA7, 0xA2,
-  0xAC, 0xC7, 0xB4, 0x67, 0x31, 0x3D, 0x54, 0x52, 0x5C, 0x85, 0x9F, 0x89,
-  0x68, 0x71, 0x99, 0xAC, 0xA6, 0xB4, 0xCB, 0xAD, 0x61, 0x38, 0x4A, 0x5B,
-  0x56, 0x66, 0x8F, 0x9F, 0x81, 0x65, 0x75, 0x9A, 0xA6, 0xA0, 0xB2, 0xC3,
-  0x96, 0x46, 0x28, 0x41, 0x4F, 0x4E, 0x67, 0x91, 0x9A, 0x7D, 0x69, 0x81,
-  0xA4, 0xA8, 0xA4, 0xBC, 0xC6, 0x8E, 0x44, 0x34, 0x4D, 0x53, 0x52, 0x70,
-  0x97, 0x95, 0x71, 0x62, 0x80, 0xA3, 0xA4, 0xA5, 0xC0, 0xBF, 0x7C, 0x38,
-  0x35, 0x50, 0x52, 0x54, 0x77, 0x9A, 0x91, 0x6E, 0x69, 0x8C, 0xA8, 0xA6,
-  0xAC, 0xC6, 0xBB, 0x74, 0x3B, 0x41, 0x58, 0x58, 0x5F, 0x83, 0xA0, 0x8E,
-  0x6C, 0x6F, 0x95, 0xAA, 0xA4, 0xB1, 0xCA, 0xB0, 0x65, 0x38, 0x43, 0x57,
-  0x57, 0x5E, 0x81, 0x9E, 0x92, 0x6D, 0x68, 0x8A, 0xA7, 0xA6, 0xA7, 0xC1,
-  0xC4, 0x86, 0x3E, 0x32, 0x4D, 0x56, 0x53, 0x6B, 0x94, 0x9D, 0x7A, 0x62,
-  0x79, 0xA0, 0xAA, 0xA3, 0xB5, 0xCC, 0xAB, 0x5D, 0x36, 0x49, 0x5B, 0x57,
-  0x62, 0x89, 0xA1, 0x8D, 0x6A, 0x6C, 0x8F, 0xA6, 0xA3, 0xA7, 0xC2, 0xBC,
-  0x78, 0x38, 0x35, 0x4C, 0x4E, 0x4D, 0x6B, 0x93, 0x97, 0x76, 0x63, 0x7F,
-  0xA4, 0xAD, 0xA9, 0xBB, 0xCA, 0xA2, 0x55, 0x32, 0x46, 0x58, 0x53, 0x60,
-  0x88, 0xA0, 0x89, 0x66, 0x6B, 0x92, 0xA9, 0xA5, 0xAC, 0xC7, 0xBB, 0x71,
-  0x34, 0x39, 0x52, 0x54, 0x55, 0x74, 0x9A, 0x98, 0x72, 0x62, 0x81, 0xA3,
-  0xA6, 0xA5, 0xBD, 0xC9, 0x97, 0x4D, 0x36, 0x4E, 0x5A, 0x56, 0x68, 0x8F,
-  0xA0, 0x86, 0x68, 0x73, 0x98, 0xA9, 0xA5, 0xB0, 0xC8, 0xB4, 0x6C, 0x38,
-  0x3F, 0x55, 0x55, 0x5A, 0x7B, 0x9C, 0x94, 0x6F, 0x63, 0x83, 0xA3, 0xA6,
-  0xA5, 0xBC, 0xC5, 0x8F, 0x43, 0x2F, 0x49, 0x55, 0x52, 0x67, 0x91, 0x9E,
-  0x7F, 0x63, 0x74, 0x9B, 0xA9, 0xA4, 0xB2, 0xCB, 0xB3, 0x67, 0x38, 0x47,
-  0x5C, 0x58, 0x60, 0x85, 0xA2, 0x93, 0x6F, 0x6B, 0x8C, 0xA7, 0xA5, 0xA7,
-  0xC0, 0xC1, 0x83, 0x3E, 0x34, 0x4C, 0x51, 0x4D, 0x67, 0x8F, 0x99, 0x7A,
-  0x64, 0x7D, 0xA5, 0xAD, 0xAB, 0xC2, 0xC9, 0x92, 0x49, 0x37, 0x4F, 0x56,
-  0x55, 0x71, 0x99, 0x98, 0x73, 0x64, 0x83, 0xA5, 0xA5, 0xA6, 0xC1, 0xC0,
-  0x7F, 0x3B, 0x36, 0x50, 0x53, 0x55, 0x78, 0x9C, 0x92, 0x6D, 0x67, 0x8A,
-  0xA6, 0xA3, 0xA9, 0xC5, 0xBA, 0x72, 0x38, 0x3E, 0x56, 0x56, 0x5C, 0x81,
-  0x9E, 0x8D, 0x6A, 0x6E, 0x94, 0xAA, 0xA5, 0xB0, 0xC8, 0xB2, 0x68, 0x38,
-  0x46, 0x5A, 0x56, 0x62, 0x8B, 0xA1, 0x88, 0x68, 0x73, 0x9A, 0xA9, 0xA3,
-  0xB4, 0xCA, 0xA4, 0x54, 0x30, 0x45, 0x56, 0x52, 0x65, 0x90, 0x9E, 0x7F,
-  0x65, 0x79, 0xA0, 0xAA, 0xA5, 0xBB, 0xCB, 0x9C, 0x4E, 0x38, 0x52, 0x5C,
-  0x58, 0x71, 0x99, 0x9D, 0x7B, 0x68, 0x81, 0xA5, 0xA9, 0xA6, 0xBF, 0xC5,
-  0x89, 0x42, 0x37, 0x50, 0x54, 0x52, 0x70, 0x95, 0x90, 0x69, 0x5D, 0x7F,
-  0xA0, 0xA2, 0xA6, 0xC1, 0xBF, 0x7F, 0x41, 0x40, 0x56, 0x55, 0x58, 0x7C,
-  0x9C, 0x8F, 0x6A, 0x67, 0x8D, 0xA7, 0xA2, 0xAA, 0xC6, 0xB4, 0x69, 0x32,
-  0x3D, 0x53, 0x51, 0x5A, 0x83, 0x9F, 0x89, 0x66, 0x6D, 0x94, 0xA7, 0xA2,
-  0xB0, 0xC8, 0xAC, 0x5F, 0x35, 0x46, 0x58, 0x55, 0x63, 0x8C, 0x9F, 0x85,
-  0x68, 0x76, 0x9D, 0xAA, 0xA6, 0xB8, 0xCA, 0xA3, 0x57, 0x38, 0x4E, 0x5C,
-  0x57, 0x6C, 0x96, 0x9D, 0x7A, 0x68, 0x85, 0xA6, 0xA7, 0xAA, 0xC5, 0xBC,
-  0x72, 0x37, 0x40, 0x55, 0x53, 0x60, 0x8A, 0x9E, 0x81, 0x64, 0x78, 0x9F,
-  0xA8, 0xA5, 0xBE, 0xC4, 0x86, 0x40, 0x3A, 0x52, 0x54, 0x5B, 0x82, 0x9E,
-  0x8C, 0x6D, 0x74, 0x9A, 0xAB, 0xA6, 0xB8, 0xC9, 0x9A, 0x4F, 0x3A, 0x51,
-  0x57, 0x56, 0x76, 0x9A, 0x91, 0x6C, 0x68, 0x8B, 0xA2, 0x9F, 0xAA, 0xC3,
-  0xA6, 0x54, 0x2C, 0x44, 0x56, 0x51, 0x6A, 0x97, 0x9E, 0x7C, 0x6B, 0x87,
-  0xA7, 0xA7, 0xAA, 0xC5, 0xB9, 0x6E, 0x36, 0x40, 0x55, 0x53, 0x61, 0x8B,
-  0x9E, 0x80, 0x64, 0x79, 0xA0, 0xA7, 0xA6, 0xBF, 0xC3, 0x83, 0x3D, 0x38,
-  0x51, 0x52, 0x58, 0x80, 0x9C, 0x88, 0x69, 0x72, 0x98, 0xA7, 0xA4, 0xB8,
-  0xC8, 0x98, 0x4C, 0x3A, 0x52, 0x58, 0x58, 0x78, 0x9D, 0x93, 0x6E, 0x6C,
-  0x91, 0xA8, 0xA3, 0xB0, 0xC8, 0xA9, 0x5B, 0x36, 0x4B, 0x58, 0x54, 0x6C,
-  0x95, 0x98, 0x75, 0x66, 0x85, 0xA3, 0xA3, 0xA8, 0xC4, 0xB5, 0x69, 0x32,
-  0x3F, 0x55, 0x51, 0x60, 0x8C, 0x9C, 0x7C, 0x63, 0x7B, 0xA0, 0xA7, 0xA8,
-  0xC2, 0xC4, 0x84, 0x42, 0x41, 0x58, 0x59, 0x61, 0x88, 0xA1, 0x8B, 0x6C,
-  0x76, 0x9B, 0xA9, 0xA5, 0xBA, 0xC7, 0x94, 0x49, 0x38, 0x50, 0x55, 0x54,
-  0x76, 0x98, 0x8B, 0x66, 0x67, 0x90, 0xA6, 0xA3, 0xB7, 0xC8, 0x97, 0x4E,
-  0x41, 0x57, 0x57, 0x5C, 0x82, 0x9D, 0x86, 0x67, 0x77, 0x9E, 0xA6, 0xA5,
-  0xC0, 0xC1, 0x78, 0x37, 0x3E, 0x55, 0x51, 0x62, 0x8E, 0x9A, 0x77, 0x63,
-  0x81, 0xA2, 0xA4, 0xAB, 0xC5, 0xAD, 0x5E, 0x33, 0x47, 0x57, 0x54, 0x6E,
-  0x97, 0x94, 0x6F, 0x6A, 0x91, 0xA8, 0xA3, 0xB4, 0xC9, 0x9C, 0x4E, 0x3B,
-  0x54, 0x58, 0x5B, 0x80, 0x9E, 0x8B, 0x6B, 0x75, 0x9B, 0xA9, 0xA7, 0xBE,
-  0xC4, 0x86, 0x41, 0x3F, 0x56, 0x55, 0x60, 0x8A, 0x9D, 0x7D, 0x63, 0x7E,
-  0xA3, 0xA4, 0xA9, 0xC6, 0xB6, 0x68, 0x36, 0x46, 0x55, 0x53, 0x6C, 0x96,
-  0x97, 0x74, 0x6B, 0x8E, 0xA9, 0xA7, 0xB4, 0xCB, 0xA7, 0x58, 0x3B, 0x53,
-  0x5B, 0x5A, 0x7C, 0x9F, 0x90, 0x6B, 0x71, 0x99, 0xA7, 0xA2, 0xB8, 0xC3,
-  0x86, 0x3D, 0x38, 0x4F, 0x4C, 0x54, 0x7E, 0x95, 0x7D, 0x64, 0x78, 0x9F,
-  0xA8, 0xAA, 0xC5, 0xBE, 0x73, 0x38, 0x44, 0x58, 0x52, 0x65, 0x91, 0x98,
-  0x73, 0x64, 0x86, 0xA4, 0xA2, 0xAE, 0xC8, 0xA7, 0x55, 0x32, 0x48, 0x53,
-  0x53, 0x73, 0x99, 0x8F, 0x6A, 0x6A, 0x92, 0xA7, 0xA3, 0xB6, 0xC7, 0x94,
-  0x48, 0x3A, 0x55, 0x58, 0x5C, 0x83, 0xA0, 0x88, 0x6A, 0x7A, 0xA0, 0xA8,
-  0xA8, 0xC1, 0xC1, 0x7E, 0x40, 0x44, 0x58, 0x57, 0x6B, 0x95, 0x99, 0x75,
-  0x6D, 0x90, 0xA7, 0xA5, 0xB8, 0xC7, 0x90, 0x45, 0x3D, 0x53, 0x52, 0x5F,
-  0x8A, 0x9A, 0x78, 0x65, 0x86, 0xA6, 0xA3, 0xAF, 0xC8, 0x9F, 0x4C, 0x36,
-  0x50, 0x54, 0x5A, 0x83, 0x9D, 0x82, 0x67, 0x7F, 0xA5, 0xA7, 0xAD, 0xC8,
-  0xAE, 0x5F, 0x3B, 0x51, 0x59, 0x59, 0x7C, 0x9C, 0x89, 0x68, 0x76, 0x9D,
-  0xA4, 0xA5, 0xBF, 0xB5, 0x69, 0x36, 0x43, 0x4F, 0x4C, 0x6A, 0x93, 0x8D,
-  0x6B, 0x6F, 0x9A, 0xAB, 0xAA, 0xC1, 0xC6, 0x82, 0x40, 0x45, 0x58, 0x53,
-  0x69, 0x95, 0x97, 0x72, 0x6B, 0x91, 0xA8, 0xA4, 0xB8, 0xC9, 0x90, 0x43,
-  0x3D, 0x55, 0x53, 0x60, 0x8E, 0x9B, 0x78, 0x66, 0x87, 0xA5, 0xA3, 0xB1,
-  0xC8, 0x9E, 0x4E, 0x3A, 0x52, 0x56, 0x5E, 0x86, 0x9D, 0x82, 0x68, 0x7F,
-  0xA3, 0xA5, 0xAC, 0xC7, 0xAC, 0x5B, 0x38, 0x4E, 0x56, 0x59, 0x7D, 0x9C,
-  0x88, 0x67, 0x76, 0x9E, 0xA5, 0xA6, 0xC2, 0xB6, 0x67, 0x36, 0x48, 0x55,
-  0x52, 0x6F, 0x96, 0x8C, 0x67, 0x6C, 0x97, 0xA5, 0xA3, 0xBD, 0xBF, 0x76,
-  0x37, 0x40, 0x54, 0x52, 0x69, 0x94, 0x95, 0x72, 0x6C, 0x92, 0xA9, 0xA6,
-  0xBB, 0xC7, 0x8D, 0x46, 0x44, 0x5A, 0x57, 0x66, 0x91, 0x9C, 0x7A, 0x6A,
-  0x8B, 0xA7, 0xA4, 0xB1, 0xC6, 0x99, 0x49, 0x39, 0x50, 0x4F, 0x59, 0x84,
-  0x94, 0x74, 0x67, 0x8C, 0xA6, 0xA6, 0xBC, 0xCB, 0x8D, 0x44, 0x43, 0x58,
-  0x55, 0x6A, 0x96, 0x94, 0x6E, 0x6E, 0x98, 0xA7, 0xA6, 0xC1, 0xBC, 0x6E,
-  0x37, 0x47, 0x54, 0x53, 0x75, 0x9A, 0x88, 0x65, 0x77, 0x9F, 0xA3, 0xA9,
-  0xC5, 0xAA, 0x57, 0x37, 0x4F, 0x54, 0x5A, 0x83, 0x9B, 0x7D, 0x67, 0x86,
-  0xA5, 0xA4, 0xB2, 0xC7, 0x96, 0x49, 0x40, 0x57, 0x56, 0x66, 0x92, 0x98,
-  0x74, 0x6D, 0x93, 0xA8, 0xA5, 0xBC, 0xC2, 0x7E, 0x3E, 0x47, 0x58, 0x55,
-  0x71, 0x9A, 0x8E, 0x69, 0x72, 0x9C, 0xA6, 0xA7, 0xC3, 0xB6, 0x64, 0x36,
-  0x4A, 0x55, 0x56, 0x7D, 0x9C, 0x83, 0x67, 0x7F, 0xA4, 0xA5, 0xB0, 0xC9,
-  0xA4, 0x54, 0x40, 0x57, 0x59, 0x63, 0x8D, 0x9D, 0x7C, 0x6B, 0x8D, 0xA8,
-  0xA4, 0xB7, 0xC6, 0x8B, 0x41, 0x3F, 0x54, 0x52, 0x65, 0x8E, 0x8E, 0x69,
-  0x66, 0x8E, 0x9E, 0x9E, 0xBB, 0xBA, 0x6F, 0x3A, 0x4B, 0x5B, 0x5A, 0x78,
-  0x9A, 0x89, 0x68, 0x77, 0x9E, 0xA3, 0xA8, 0xC4, 0xAC, 0x58, 0x35, 0x4C,
-  0x52, 0x58, 0x81, 0x9B, 0x7D, 0x64, 0x82, 0xA4, 0xA2, 0xAF, 0xC6, 0x96,
-  0x46, 0x39, 0x52, 0x52, 0x60, 0x8E, 0x98, 0x74, 0x6B, 0x91, 0xA7, 0xA4,
-  0xBB, 0xC3, 0x82, 0x41, 0x46, 0x59, 0x58, 0x70, 0x9A, 0x93, 0x6D, 0x76,
-  0x9D, 0xA5, 0xAB, 0xC7, 0xAF, 0x5D, 0x3C, 0x54, 0x59, 0x60, 0x8D, 0x9C,
-  0x75, 0x6C, 0x93, 0xA5, 0xA5, 0xBF, 0xBD, 0x72, 0x3A, 0x48, 0x56, 0x56,
-  0x7D, 0x9E, 0x7F, 0x66, 0x87, 0xA4, 0xA4, 0xB8, 0xC5, 0x8A, 0x43, 0x42,
-  0x58, 0x57, 0x71, 0x9C, 0x8F, 0x6C, 0x7F, 0xA3, 0xA5, 0xB0, 0xC8, 0xA1,
-  0x53, 0x40, 0x56, 0x57, 0x65, 0x92, 0x95, 0x6C, 0x6F, 0x98, 0xA1, 0xA2,
-  0xBE, 0xAC, 0x5B, 0x31, 0x45, 0x4E, 0x54, 0x82, 0x9A, 0x76, 0x6B, 0x94,
-  0xA9, 0xA7, 0xBD, 0xBE, 0x79, 0x3D, 0x46, 0x56, 0x56, 0x76, 0x9B, 0x82,
-  0x64, 0x82, 0xA3, 0xA2, 0xB4, 0xC4, 0x8D, 0x42, 0x3B, 0x52, 0x53, 0x69,
-  0x95, 0x8D, 0x66, 0x74, 0x9D, 0xA2, 0xAB, 0xC5, 0xA3, 0x53, 0x3A, 0x52,
-  0x56, 0x62, 0x8F, 0x97, 0x71, 0x6F, 0x97, 0xA5, 0xA7, 0xC2, 0xB8, 0x6B,
-  0x3B, 0x4E, 0x5A, 0x5B, 0x82, 0x9D, 0x7B, 0x68, 0x8C, 0xA4, 0xA3, 0xBA,
-  0xC3, 0x83, 0x41, 0x45, 0x57, 0x57, 0x74, 0x9A, 0x86, 0x64, 0x7D, 0xA1,
-  0xA1, 0xB1, 0xC7, 0x98, 0x49, 0x3C, 0x52, 0x53, 0x66, 0x95, 0x93, 0x6B,
-  0x74, 0x9C, 0xA5, 0xAC, 0xC7, 0xAE, 0x60, 0x41, 0x55, 0x59, 0x62, 0x8F,
-  0x9E, 0x78, 0x6F, 0x97, 0xA7, 0xA7, 0xC0, 0xBB, 0x72, 0x3D, 0x4A, 0x57,
-  0x52, 0x6F, 0x94, 0x8C, 0x69, 0x63, 0x84, 0x9E, 0x9C, 0xA8, 0xC2, 0xA9,
-  0x5E, 0x39, 0x4D, 0x5B, 0x57, 0x6A, 0x91, 0x98, 0x76, 0x65, 0x83, 0xA3,
-  0xA2, 0xA6, 0xC1, 0xB6, 0x6E, 0x36, 0x40, 0x54, 0x51, 0x5F, 0x88, 0x99,
-  0x7D, 0x63, 0x76, 0x9C, 0xA4, 0xA2, 0xBA, 0xBF, 0x83, 0x40, 0x3A, 0x51,
-  0x54, 0x59, 0x7E, 0x9A, 0x88, 0x69, 0x71, 0x96, 0xA4, 0xA2, 0xB4, 0xC4,
-  0x97, 0x4D, 0x3A, 0x52, 0x58, 0x58, 0x77, 0x9A, 0x92, 0x6F, 0x6C, 0x8F,
-  0xA6, 0xA2, 0xAE, 0xC6, 0xAA, 0x5F, 0x38, 0x4B, 0x59, 0x54, 0x6A, 0x94,
-  0x99, 0x76, 0x67, 0x85, 0xA4, 0xA4, 0xA9, 0xC3, 0xB7, 0x6F, 0x39, 0x44,
-  0x57, 0x54, 0x63, 0x8C, 0x9C, 0x80, 0x68, 0x7C, 0xA1, 0xA8, 0xA8, 0xC1,
-  0xC2, 0x83, 0x43, 0x42, 0x58, 0x58, 0x5F, 0x84, 0x9D, 0x89, 0x6A, 0x73,
-  0x97, 0xA4, 0xA0, 0xB4, 0xC1, 0x91, 0x48, 0x34, 0x49, 0x4F, 0x50, 0x72,
-  0x98, 0x8F, 0x6D, 0x6D, 0x93, 0xAA, 0xA6, 0xB1, 0xC7, 0xA8, 0x5C, 0x36,
-  0x4A, 0x57, 0x53, 0x6B, 0x94, 0x97, 0x75, 0x67, 0x85, 0xA4, 0xA4, 0xA9,
-  0xC3, 0xB4, 0x6A, 0x37, 0x44, 0x56, 0x52, 0x62, 0x8B, 0x9A, 0x7C, 0x65,
-  0x7D, 0xA1, 0xA6, 0xA6, 0xBF, 0xC0, 0x80, 0x40, 0x40, 0x57, 0x57, 0x5F,
-  0x85, 0x9E, 0x8A, 0x6B, 0x73, 0x97, 0xA9, 0xA5, 0xB2, 0xC8, 0xA9, 0x5F,
-  0x3A, 0x4C, 0x5B, 0x58, 0x67, 0x8E, 0x9E, 0x84, 0x69, 0x78, 0x9D, 0xA8,
-  0xA4, 0xB7, 0xC8, 0x9D, 0x51, 0x35, 0x4C, 0x58, 0x54, 0x6B, 0x93, 0x9B,
-  0x7A, 0x65, 0x7D, 0xA1, 0xA6, 0xA4, 0xBC, 0xC5, 0x8F, 0x49, 0x3B, 0x53,
-  0x5B, 0x5A, 0x76, 0x9B, 0x9A, 0x77, 0x6A, 0x87, 0xA5, 0xA5, 0xA7, 0xC0,
-  0xBF, 0x80, 0x40, 0x3B, 0x53, 0x56, 0x57, 0x76, 0x97, 0x8D, 0x68, 0x62,
-  0x85, 0xA1, 0xA1, 0xA8, 0xC2, 0xB8, 0x77, 0x41, 0x46, 0x5C, 0x59, 0x5E,
-  0x83, 0x9F, 0x8C, 0x6B, 0x6E, 0x93, 0xA8, 0xA4, 0xAF, 0xC7, 0xAF, 0x64,
-  0x35, 0x43, 0x57, 0x53, 0x60, 0x89, 0x9E, 0x85, 0x67, 0x73, 0x99, 0xA8,
-  0xA2, 0xB2, 0xC7, 0xA4, 0x59, 0x38, 0x4B, 0x59, 0x56, 0x69, 0x90, 0x9C,
-  0x80, 0x68, 0x7A, 0x9E, 0xA7, 0xA3, 0xB8, 0xC5, 0x96, 0x4D, 0x39, 0x50,
-  0x59, 0x56, 0x6F, 0x95, 0x99, 0x79, 0x67, 0x80, 0xA2, 0xA6, 0xA5, 0xBD,
-  0xC2, 0x89, 0x44, 0x38, 0x4F, 0x55, 0x55, 0x73, 0x98, 0x94, 0x70, 0x65,
-  0x85, 0xA4, 0xA3, 0xA6, 0xC1, 0xBC, 0x7A, 0x3D, 0x3D, 0x55, 0x57, 0x5C,
-  0x7F, 0x9F, 0x93, 0x71, 0x6F, 0x92, 0xAA, 0xA6, 0xAE, 0xC8, 0xB7, 0x6F,
-  0x3C, 0x45, 0x59, 0x57, 0x5F, 0x82, 0x9D, 0x8E, 0x6B, 0x67, 0x89, 0xA3,
-  0xA1, 0xA3, 0xBC, 0xBC, 0x81, 0x41, 0x39, 0x51, 0x5A, 0x5B, 0x75, 0x9C,
-  0x9E, 0x7B, 0x67, 0x7D, 0x9F, 0xA7, 0xA4, 0xB5, 0xC8, 0xA5, 0x58, 0x34,
-  0x47, 0x57, 0x53, 0x60, 0x87, 0x9E, 0x89, 0x68, 0x6C, 0x8F, 0xA5, 0xA2,
-  0xA9, 0xC1, 0xB9, 0x77, 0x3B, 0x39, 0x51, 0x55, 0x58, 0x73, 0x97, 0x97,
-  0x77, 0x66, 0x7F, 0xA0, 0xA7, 0xA4, 0xB8, 0xC7, 0x9D, 0x54, 0x37, 0x4B,
-  0x5A, 0x57, 0x65, 0x8B, 0x9F, 0x88, 0x69, 0x72, 0x96, 0xA8, 0xA2, 0xAC,
-  0xC6, 0xB8, 0x71, 0x3A, 0x40, 0x56, 0x56, 0x58, 0x77, 0x9A, 0x94, 0x71,
-  0x66, 0x84, 0xA3, 0xA5, 0xA5, 0xBC, 0xC6, 0x93, 0x4B, 0x36, 0x4D, 0x58,
-  0x56, 0x6B, 0x91, 0x9E, 0x85, 0x6B, 0x77, 0x9B, 0xAA, 0xA7, 0xB2, 0xC8,
-  0xB2, 0x6C, 0x3B, 0x44, 0x59, 0x58, 0x5D, 0x7D, 0x9B, 0x90, 0x6D, 0x64,
-  0x82, 0xA0, 0xA1, 0xA0, 0xB7, 0xBC, 0x83, 0x40, 0x35, 0x4E, 0x58, 0x57,
-  0x6E, 0x95, 0x9F, 0x7E, 0x64, 0x77, 0x9B, 0xA5, 0xA1, 0xB2, 0xC6, 0xA8,
-  0x5C, 0x33, 0x42, 0x55, 0x52, 0x5C, 0x81, 0x9D, 0x8E, 0x6A, 0x68, 0x8B,
-  0xA4, 0xA3, 0xA9, 0xC0, 0xBD, 0x81, 0x40, 0x38, 0x50, 0x57, 0x57, 0x71,
-  0x95, 0x9B, 0x7B, 0x66, 0x7B, 0x9F, 0xA9, 0xA4, 0xB3, 0xC8, 0xAD, 0x66,
-  0x38, 0x43, 0x59, 0x5A, 0x5C, 0x79, 0x9C, 0x9C, 0x7B, 0x67, 0x7B, 0x9D,
-  0xA8, 0xA4, 0xB1, 0xC9, 0xB6, 0x70, 0x3B, 0x3F, 0x54, 0x56, 0x56, 0x70,
-  0x95, 0x9D, 0x7E, 0x64, 0x75, 0x9A, 0xA8, 0xA3, 0xAD, 0xC4, 0xB7, 0x74,
-  0x3A, 0x39, 0x52, 0x59, 0x57, 0x6E, 0x95, 0xA0, 0x84, 0x68, 0x74, 0x97,
-  0xA8, 0xA5, 0xAC, 0xC4, 0xBF, 0x82, 0x42, 0x39, 0x51, 0x58, 0x55, 0x68,
-  0x8D, 0x9E, 0x84, 0x65, 0x6C, 0x8E, 0xA2, 0x9E, 0xA2, 0xBC, 0xBE, 0x84,
-  0x41, 0x38, 0x52, 0x5D, 0x5A, 0x67, 0x8B, 0xA0, 0x8B, 0x68, 0x6A, 0x8D,
-  0xA6, 0xA6, 0xA8, 0xBF, 0xC5, 0x92, 0x4A, 0x32, 0x47, 0x56, 0x54, 0x60,
-  0x85, 0xA0, 0x8E, 0x6B, 0x69, 0x89, 0xA5, 0xA5, 0xA4, 0xBA, 0xC7, 0x99,
-  0x50, 0x34, 0x49, 0x58, 0x56, 0x5F, 0x81, 0x9D, 0x93, 0x70, 0x68, 0x85,
-  0xA3, 0xA7, 0xA5, 0xB8, 0xC7, 0xA2, 0x59, 0x35, 0x45, 0x58, 0x56, 0x5D,
-  0x7D, 0x9D, 0x96, 0x73, 0x65, 0x81, 0xA1, 0xA6, 0xA2, 0xB3, 0xC7, 0xAA,
-  0x61, 0x33, 0x3F, 0x55, 0x53, 0x56, 0x76, 0x98, 0x95, 0x73, 0x63, 0x7B,
-  0x9E, 0xA7, 0xA3, 0xB2, 0xC7, 0xB0, 0x69, 0x38, 0x40, 0x57, 0x5A, 0x5D,
-  0x78, 0x9C, 0x9F, 0x7F, 0x68, 0x7A, 0x9D, 0xAA, 0xA5, 0xAF, 0xC6, 0xBD,
-  0x7E, 0x3E, 0x35, 0x4E, 0x57, 0x53, 0x61, 0x83, 0x9C, 0x8D, 0x6A, 0x61,
-  0x80, 0xA0, 0xA6, 0xA3, 0xB4, 0xCB, 0xBA, 0x76, 0x3C, 0x3B, 0x54, 0x59,
-  0x55, 0x67, 0x8D, 0xA2, 0x8D, 0x6A, 0x68, 0x88, 0xA4, 0xA6, 0xA3, 0xB5,
-  0xC8, 0xAE, 0x66, 0x33, 0x3A, 0x53, 0x55, 0x53, 0x6A, 0x8F, 0x9E, 0x86,
-  0x66, 0x69, 0x8C, 0xA6, 0xA5, 0xA4, 0xB8, 0xC6, 0xA1, 0x5B, 0x35, 0x42,
-  0x57, 0x57, 0x58, 0x73, 0x96, 0x9E, 0x82, 0x68, 0x72, 0x94, 0xA8, 0xA5,
-  0xA6, 0xBD, 0xC5, 0x96, 0x51, 0x34, 0x46, 0x59, 0x58, 0x5B, 0x78, 0x9B,
-  0x9B, 0x78, 0x62, 0x73, 0x97, 0xA8, 0xA3, 0xA8, 0xC1, 0xC2, 0x8A, 0x45,
-  0x31, 0x48, 0x58, 0x55, 0x5D, 0x7E, 0x9E, 0x98, 0x76, 0x66, 0x7B, 0x9E,
-  0xAB, 0xA6, 0xAF, 0xC7, 0xC0, 0x83, 0x44, 0x3A, 0x50, 0x5B, 0x59, 0x65,
-  0x86, 0xA0, 0x93, 0x70, 0x64, 0x7E, 0x9D, 0xA3, 0x9F, 0xAC, 0xC2, 0xB2,
-  0x6E, 0x32, 0x32, 0x4E, 0x56, 0x54, 0x67, 0x8D, 0xA4, 0x91, 0x6E, 0x68,
-  0x87, 0xA3, 0xA6, 0xA3, 0xB3, 0xC8, 0xB0, 0x69, 0x34, 0x39, 0x53, 0x56,
-  0x53, 0x6A, 0x90, 0x9F, 0x87, 0x67, 0x69, 0x8C, 0xA5, 0xA4, 0xA3, 0xB7,
-  0xC6, 0xA6, 0x5F, 0x33, 0x3F, 0x57, 0x57, 0x57, 0x71, 0x95, 0xA0, 0x85,
-  0x67, 0x6D, 0x8F, 0xA7, 0xA8, 0xA5, 0xB4, 0xC9, 0xB5, 0x73, 0x3C, 0x39,
-  0x52, 0x5C, 0x58, 0x63, 0x84, 0xA0, 0x9A, 0x79, 0x65, 0x77, 0x9A, 0xA9,
-  0xA4, 0xA7, 0xBE, 0xC7, 0x9E, 0x56, 0x31, 0x3E, 0x54, 0x56, 0x55, 0x69,
-  0x8E, 0xA1, 0x8C, 0x6B, 0x65, 0x82, 0xA2, 0xA9, 0xA2, 0xAD, 0xC5, 0xBE,
-  0x85, 0x45, 0x34, 0x4D, 0x5C, 0x57, 0x5D, 0x7B, 0x9B, 0x9F, 0x81, 0x67,
-  0x70, 0x91, 0xA7, 0xA6, 0xA4, 0xB6, 0xC6, 0xAA, 0x66, 0x34, 0x36, 0x4D,
-  0x56, 0x50, 0x5C, 0x80, 0x9A, 0x91, 0x71, 0x62, 0x79, 0x9E, 0xAC, 0xA8,
-  0xAD, 0xC1, 0xC5, 0x97, 0x51, 0x31, 0x43, 0x56, 0x56, 0x57, 0x6E, 0x93,
-  0xA1, 0x88, 0x68, 0x68, 0x87, 0xA4, 0xA8, 0xA2, 0xB1, 0xC7, 0xB8, 0x7A,
-  0x3C, 0x32, 0x4B, 0x59, 0x54, 0x5D, 0x7C, 0x9B, 0x9B, 0x7B, 0x63, 0x73,
-  0x96, 0xA8, 0xA6, 0xA6, 0xBA, 0xC9, 0xA6, 0x60, 0x36, 0x3E, 0x55, 0x5A,
-  0x57, 0x68, 0x8C, 0xA0, 0x90, 0x70, 0x65, 0x7F, 0x9F, 0xA8, 0xA3, 0xAB,
-  0xC2, 0xC1, 0x8C, 0x48, 0x32, 0x46, 0x56, 0x53, 0x56, 0x71, 0x95, 0x9E,
-  0x82, 0x65, 0x6A, 0x8A, 0xA5, 0xA6, 0xA2, 0xB3, 0xC7, 0xB2, 0x71, 0x39,
-  0x35, 0x50, 0x5B, 0x56, 0x62, 0x85, 0xA1, 0x9B, 0x7A, 0x67, 0x7A, 0x9B,
-  0xAB, 0xA6, 0xAA, 0xC1, 0xC4, 0x8F, 0x4B, 0x35, 0x49, 0x58, 0x56, 0x5C,
-  0x7A, 0x9A, 0x96, 0x72, 0x5E, 0x72, 0x96, 0xA5, 0xA1, 0xA9, 0xC3, 0xC0,
-  0x86, 0x47, 0x3A, 0x50, 0x5B, 0x57, 0x62, 0x83, 0x9F, 0x95, 0x71, 0x63,
-  0x7D, 0x9F, 0xA9, 0xA4, 0xB0, 0xC7, 0xB9, 0x76, 0x39, 0x34, 0x4D, 0x57,
-  0x54, 0x63, 0x88, 0x9F, 0x8E, 0x6B, 0x66, 0x84, 0xA1, 0xA5, 0xA3, 0xB3,
-  0xC8, 0xB2, 0x6D, 0x39, 0x3C, 0x54, 0x59, 0x58, 0x6A, 0x90, 0xA2, 0x8B,
-  0x6B, 0x6C, 0x8C, 0xA6, 0xA7, 0xA5, 0xB8, 0xC9, 0xAB, 0x64, 0x37, 0x41,
-  0x58, 0x59, 0x58, 0x70, 0x95, 0xA0, 0x86, 0x68, 0x6E, 0x90, 0xA7, 0xA5,
-  0xA6, 0xBB, 0xC6, 0x9D, 0x55, 0x31, 0x41, 0x56, 0x55, 0x58, 0x74, 0x98,
-  0x9D, 0x7F, 0x65, 0x72, 0x97, 0xAA, 0xA5, 0xA9, 0xC1, 0xC6, 0x93, 0x4F,
-  0x37, 0x4B, 0x5C, 0x59, 0x5E, 0x7C, 0x9D, 0x9A, 0x78, 0x63, 0x76, 0x98,
-  0xA6, 0xA0, 0xA6, 0xBD, 0xBB, 0x81, 0x3C, 0x2B, 0x42, 0x51, 0x51, 0x5D,
-  0x7E, 0x9C, 0x97, 0x76, 0x67, 0x7F, 0x9E, 0xA7, 0xA3, 0xAD, 0xC4, 0xB9,
-  0x79, 0x3B, 0x34, 0x4C, 0x57, 0x54, 0x62, 0x86, 0x9F, 0x8F, 0x6C, 0x64,
-  0x81, 0xA0, 0xA7, 0xA3, 0xB2, 0xC8, 0xB4, 0x6E, 0x36, 0x39, 0x51, 0x57,
-  0x55, 0x6A, 0x8F, 0xA0, 0x89, 0x69, 0x6D, 0x90, 0xA7, 0xA7, 0xAA, 0xC1,
-  0xC5, 0x90, 0x4B, 0x38, 0x4E, 0x5B, 0x59, 0x67, 0x8B, 0xA2, 0x90, 0x6E,
-  0x6E, 0x8F, 0xA8, 0xA7, 0xA6, 0xBD, 0xC8, 0x98, 0x4E, 0x35, 0x4A, 0x58,
-  0x53, 0x5E, 0x82, 0x9E, 0x8F, 0x6C, 0x66, 0x86, 0xA3, 0xA7, 0xA6, 0xBA,
-  0xC8, 0x9E, 0x54, 0x32, 0x44, 0x56, 0x56, 0x5F, 0x80, 0x9F, 0x97, 0x74,
-  0x69, 0x85, 0xA5, 0xA9, 0xA6, 0xB7, 0xC9, 0xA9, 0x60, 0x36, 0x44, 0x58,
-  0x56, 0x59, 0x78, 0x98, 0x94, 0x71, 0x60, 0x7A, 0x9B, 0xA2, 0x9E, 0xAE,
-  0xC3, 0xAA, 0x63, 0x34, 0x40, 0x59, 0x5B, 0x5F, 0x7A, 0x9B, 0x9B, 0x7A,
-  0x64, 0x78, 0x9C, 0xA8, 0xA3, 0xB0, 0xC7, 0xB5, 0x6F, 0x38, 0x3C, 0x54,
-  0x56, 0x55, 0x70, 0x95, 0x9B, 0x7B, 0x63, 0x75, 0x99, 0xA7, 0xA3, 0xAC,
-  0xC4, 0xB7, 0x74, 0x3A, 0x3B, 0x52, 0x58, 0x58, 0x6F, 0x94, 0x9F, 0x82,
-  0x66, 0x73, 0x96, 0xA8, 0xA4, 0xAA, 0xC3, 0xBF, 0x82, 0x42, 0x3A, 0x52,
-  0x59, 0x56, 0x68, 0x8E, 0x9F, 0x86, 0x66, 0x6E, 0x93, 0xA7, 0xA3, 0xA7,
-  0xBF, 0xBE, 0x84, 0x40, 0x33, 0x4B, 0x55, 0x53, 0x64, 0x8A, 0x9F, 0x89,
-  0x67, 0x69, 0x8B, 0xA4, 0xA4, 0xA7, 0xBE, 0xC5, 0x92, 0x4C, 0x37, 0x4D,
-  0x5B, 0x58, 0x64, 0x8A, 0xA3, 0x91, 0x6F, 0x6F, 0x91, 0xA9, 0xA6, 0xAB,
-  0xC3, 0xBE, 0x7E, 0x40, 0x3C, 0x53, 0x57, 0x56, 0x6F, 0x94, 0x96, 0x74,
-  0x60, 0x78, 0x9A, 0xA5, 0xA4, 0xB6, 0xC6, 0xA2, 0x5B, 0x3B, 0x4C, 0x5A,
-  0x56, 0x63, 0x89, 0x9F, 0x89, 0x68, 0x6D, 0x91, 0xA7, 0xA4, 0xAB, 0xC4,
-  0xBB, 0x77, 0x3A, 0x3A, 0x53, 0x55, 0x56, 0x74, 0x99, 0x96, 0x72, 0x63,
-  0x7F, 0xA0, 0xA4, 0xA2, 0xB7, 0xC3, 0x95, 0x4D, 0x36, 0x4C, 0x59, 0x55,
-  0x66, 0x8E, 0x9F, 0x85, 0x67, 0x72, 0x96, 0xA7, 0xA4, 0xAF, 0xC6, 0xB3,
-  0x6E, 0x3B, 0x41, 0x57, 0x57, 0x5C, 0x7B, 0x9C, 0x94, 0x73, 0x69, 0x87,
-  0xA4, 0xA6, 0xA6, 0xBC, 0xC4, 0x90, 0x48, 0x34, 0x4C, 0x57, 0x54, 0x68,
-  0x90, 0x9D, 0x80, 0x65, 0x75, 0x9A, 0xA8, 0xA3, 0xB1, 0xC8, 0xB0, 0x66,
-  0x38, 0x45, 0x5A, 0x58, 0x60, 0x84, 0xA0, 0x93, 0x71, 0x6D, 0x8D, 0xA7,
-  0xA7, 0xA8, 0xC0, 0xC2, 0x87, 0x44, 0x39, 0x50, 0x56, 0x54, 0x6B, 0x8F,
-  0x96, 0x77, 0x5F, 0x71, 0x95, 0xA2, 0xA0, 0xB1, 0xC4, 0xA6, 0x5F, 0x39,
-  0x49, 0x5A, 0x56, 0x5F, 0x83, 0x9D, 0x8B, 0x69, 0x68, 0x8C, 0xA5, 0xA3,
-  0xA7, 0xC1, 0xBD, 0x7C, 0x3B, 0x37, 0x51, 0x55, 0x54, 0x6F, 0x96, 0x99,
-  0x76, 0x62, 0x7B, 0x9E, 0xA5, 0xA2, 0xB6, 0xC6, 0x9D, 0x53, 0x37, 0x4E,
-  0x5A, 0x56, 0x6C, 0x94, 0x9C, 0x7C, 0x67, 0x7F, 0xA1, 0xA7, 0xA6, 0xBD,
-  0xC5, 0x90, 0x4B, 0x3C, 0x54, 0x5A, 0x59, 0x75, 0x9A, 0x99, 0x77, 0x69,
-  0x86, 0xA5, 0xA6, 0xA7, 0xC0, 0xC1, 0x82, 0x40, 0x3C, 0x54, 0x55, 0x58,
-  0x7A, 0x9B, 0x91, 0x6E, 0x68, 0x8A, 0xA6, 0xA4, 0xA9, 0xC3, 0xB7, 0x70,
-  0x38, 0x40, 0x57, 0x57, 0x5D, 0x82, 0x9F, 0x8E, 0x6D, 0x70, 0x94, 0xA9,
-  0xA4, 0xAF, 0xC7, 0xB0, 0x67, 0x39, 0x46, 0x58, 0x55, 0x60, 0x86, 0x9C,
-  0x83, 0x63, 0x6F, 0x94, 0xA2, 0x9C, 0xAD, 0xC1, 0x9F, 0x56, 0x35, 0x49,
-  0x5A, 0x59, 0x6C, 0x94, 0x9F, 0x81, 0x68, 0x7B, 0x9E, 0xA6, 0xA3, 0xB8,
-  0xC6, 0x97, 0x4C, 0x35, 0x4C, 0x57, 0x54, 0x6C, 0x94, 0x99, 0x77, 0x64,
-  0x7E, 0xA1, 0xA6, 0xA5, 0xBD, 0xC2, 0x8A, 0x45, 0x39, 0x51, 0x56, 0x56,
-  0x75, 0x9A, 0x96, 0x74, 0x69, 0x87, 0xA5, 0xA5, 0xA9, 0xC2, 0xBC, 0x7B,
-  0x3E, 0x3E, 0x56, 0x57, 0x5B, 0x7D, 0x9C, 0x8F, 0x6E, 0x6C, 0x8F, 0xA7,
-  0xA4, 0xAB, 0xC4, 0xB5, 0x6E, 0x39, 0x42, 0x57, 0x54, 0x5D, 0x82, 0x9B,
-  0x87, 0x67, 0x6C, 0x92, 0xA6, 0xA0, 0xAE, 0xC6, 0xA9, 0x5D, 0x34, 0x45,
-  0x56, 0x53, 0x62, 0x8A, 0x9D, 0x84, 0x68, 0x77, 0x9D, 0xA9, 0xA6, 0xBA,
-  0xC8, 0x97, 0x4F, 0x3F, 0x56, 0x5B, 0x5C, 0x7B, 0x9B, 0x90, 0x6E, 0x6E,
-  0x91, 0xA6, 0xA2, 0xAF, 0xC4, 0xA1, 0x54, 0x32, 0x45, 0x51, 0x50, 0x6D,
-  0x95, 0x95, 0x75, 0x6C, 0x8C, 0xA8, 0xA7, 0xAC, 0xC5, 0xB5, 0x6B, 0x39,
-  0x46, 0x58, 0x54, 0x65, 0x8E, 0x9B, 0x7C, 0x66, 0x7D, 0xA1, 0xA6, 0xA6,
-  0xBF, 0xBF, 0x7D, 0x3C, 0x3C, 0x53, 0x52, 0x5C, 0x84, 0x9C, 0x85, 0x67,
-  0x73, 0x99, 0xA5, 0xA1, 0xB6, 0xC4, 0x91, 0x49, 0x3C, 0x54, 0x58, 0x5A,
-  0x7A, 0x9B, 0x8F, 0x6D, 0x6F, 0x94, 0xA8, 0xA4, 0xB3, 0xC7, 0xA3, 0x57,
-  0x39, 0x4F, 0x5A, 0x57, 0x70, 0x97, 0x97, 0x74, 0x69, 0x88, 0xA5, 0xA4,
-  0xAB, 0xC4, 0xB2, 0x67, 0x37, 0x45, 0x57, 0x54, 0x66, 0x8F, 0x9A, 0x7B,
-  0x66, 0x7F, 0xA2, 0xA6, 0xA8, 0xC1, 0xBC, 0x7A, 0x3F, 0x42, 0x58, 0x58,
-  0x63, 0x8A, 0xA0, 0x89, 0x6C, 0x79, 0x9E, 0xA8, 0xA5, 0xBA, 0xC5, 0x8F,
-  0x48, 0x3D, 0x53, 0x56, 0x58, 0x79, 0x97, 0x88, 0x66, 0x6A, 0x8E, 0xA0,
-  0x9B, 0xAE, 0xC4, 0x9D, 0x51, 0x38, 0x51, 0x5B, 0x59, 0x72, 0x97, 0x94,
-  0x71, 0x67, 0x89, 0xA5, 0xA2, 0xAA, 0xC3, 0xAF, 0x64, 0x36, 0x45, 0x56,
-  0x53, 0x65, 0x8E, 0x98, 0x78, 0x65, 0x7F, 0xA1, 0xA4, 0xA6, 0xC0, 0xBA,
-  0x75, 0x3B, 0x43, 0x56, 0x55, 0x67, 0x90, 0x99, 0x79, 0x69, 0x86, 0xA5,
-  0xA5, 0xAD, 0xC6, 0xAD, 0x60, 0x3B, 0x50, 0x5B, 0x58, 0x75, 0x9A, 0x92,
-  0x70, 0x70, 0x94, 0xA7, 0xA4, 0xB6, 0xC6, 0x97, 0x4E, 0x3E, 0x54, 0x57,
-  0x5C, 0x7F, 0x9B, 0x87, 0x68, 0x75, 0x9C, 0xA6, 0xA3, 0xBD, 0xC0, 0x7C,
-  0x3B, 0x40, 0x56, 0x53, 0x61, 0x8C, 0x9A, 0x7A, 0x67, 0x83, 0xA4, 0xA5,
-  0xAB, 0xC5, 0xB2, 0x68, 0x3D, 0x4D, 0x5A, 0x58, 0x70, 0x97, 0x95, 0x72,
-  0x6C, 0x8F, 0xA5, 0xA1, 0xB0, 0xC4, 0x9B, 0x4F, 0x38, 0x4E, 0x53, 0x55,
-  0x77, 0x95, 0x84, 0x64, 0x6F, 0x96, 0xA4, 0xA4, 0xBD, 0xC4, 0x89, 0x46,
-  0x42, 0x57, 0x57, 0x61, 0x88, 0x9C, 0x7F, 0x65, 0x7D, 0xA1, 0xA3, 0xA7,
-  0xC3, 0xB7, 0x6C, 0x39, 0x46, 0x56, 0x53, 0x6A, 0x93, 0x96, 0x74, 0x68,
-  0x89, 0xA4, 0xA3, 0xAF, 0xC5, 0xA5, 0x58, 0x39, 0x4F, 0x58, 0x57, 0x77,
-  0x9B, 0x8F, 0x6C, 0x71, 0x97, 0xA6, 0xA2, 0xB7, 0xC3, 0x8C, 0x47, 0x40,
-  0x56, 0x56, 0x5E, 0x84, 0x9B, 0x83, 0x68, 0x7A, 0x9E, 0xA5, 0xA5, 0xBF,
-  0xBB, 0x75, 0x3B, 0x44, 0x57, 0x52, 0x63, 0x8E, 0x97, 0x74, 0x64, 0x85,
-  0xA3, 0xA1, 0xAB, 0xC5, 0xA8, 0x5A, 0x36, 0x4B, 0x56, 0x54, 0x72, 0x98,
-  0x91, 0x70, 0x6B, 0x8A, 0xA3, 0xA3, 0xA7, 0xBE, 0xBF, 0x86, 0x48, 0x3F,
-  0x55, 0x5B, 0x59, 0x70, 0x93, 0x98, 0x7B, 0x67, 0x78, 0x99, 0xA4, 0x9F,
-  0xAE, 0xC0, 0xA0, 0x58, 0x31, 0x41, 0x54, 0x54, 0x5F, 0x83, 0x9D, 0x8F,
-  0x70, 0x70, 0x8F, 0xA5, 0xA3, 0xA7, 0xBF, 0xBA, 0x7B, 0x3F, 0x3C, 0x53,
-  0x57, 0x57, 0x71, 0x95, 0x97, 0x76, 0x63, 0x7B, 0x9D, 0xA3, 0xA1, 0xB4,
-  0xC3, 0x9A, 0x53, 0x35, 0x48, 0x57, 0x53, 0x61, 0x87, 0x9C, 0x87, 0x69,
-  0x6F, 0x92, 0xA5, 0xA2, 0xAA, 0xC2, 0xB6, 0x76, 0x40, 0x42, 0x57, 0x59,
-  0x5C, 0x79, 0x99, 0x96, 0x76, 0x68, 0x83, 0xA2, 0xA5, 0xA4, 0xB8, 0xC3,
-  0x98, 0x53, 0x3B, 0x4F, 0x5B, 0x58, 0x68, 0x8D, 0x9D, 0x83, 0x66, 0x72,
-  0x96, 0xA5, 0xA1, 0xAC, 0xC4, 0xB2, 0x6C, 0x39, 0x42, 0x57, 0x57, 0x5C,
-  0x7D, 0x9B, 0x93, 0x73, 0x6B, 0x88, 0xA4, 0xA6, 0xA7, 0xBD, 0xC4, 0x91,
-  0x4F, 0x3E, 0x53, 0x5C, 0x5A, 0x6E, 0x91, 0x9C, 0x80, 0x68, 0x75, 0x97,
-  0xA4, 0x9F, 0xAB, 0xBF, 0xA7, 0x5F, 0x31, 0x3D, 0x52, 0x53, 0x5C, 0x7D,
-  0x9A, 0x91, 0x72, 0x6D, 0x8B, 0xA4, 0xA2, 0xA5, 0xBD, 0xBD, 0x84, 0x43,
-  0x3A, 0x51, 0x57, 0x55, 0x6D, 0x92, 0x9A, 0x7B, 0x65, 0x79, 0x9B, 0xA3,
-  0xA0, 0xB2, 0xC3, 0xA2, 0x5B, 0x34, 0x43, 0x57, 0x56, 0x5C, 0x7B, 0x9B,
-  0x97, 0x76, 0x67, 0x7F, 0x9E, 0xA6, 0xA3, 0xB3, 0xC7, 0xAE, 0x6B, 0x3E,
-  0x46, 0x5A, 0x5B, 0x5E, 0x79, 0x9B, 0x9C, 0x7D, 0x6B, 0x7E, 0x9E, 0xA8,
-  0xA3, 0xB0, 0xC5, 0xB2, 0x6E, 0x3D, 0x42, 0x58, 0x5A, 0x59, 0x71, 0x94,
-  0x9B, 0x7C, 0x65, 0x75, 0x97, 0xA6, 0xA3, 0xAC, 0xC3, 0xB7, 0x77, 0x3D,
-  0x3B, 0x52, 0x57, 0x57, 0x6D, 0x93, 0x9F, 0x84, 0x6A, 0x77, 0x98, 0xA9,
-  0xA4, 0xAA, 0xC2, 0xBE, 0x82, 0x45, 0x3E, 0x55, 0x5B, 0x58, 0x69, 0x8D,
-  0x9C, 0x83, 0x67, 0x6E, 0x8E, 0xA1, 0xA0, 0xA4, 0xBA, 0xBA, 0x82, 0x42,
-  0x37, 0x4D, 0x58, 0x59, 0x6A, 0x8F, 0xA3, 0x8E, 0x6C, 0x6F, 0x90, 0xA5,
-  0xA4, 0xA6, 0xBC, 0xC3, 0x93, 0x4E, 0x37, 0x4C, 0x59, 0x55, 0x61, 0x84,
-  0x9C, 0x8C, 0x6C, 0x69, 0x89, 0xA3, 0xA4, 0xA4, 0xB8, 0xC2, 0x97, 0x52,
-  0x36, 0x49, 0x59, 0x58, 0x61, 0x82, 0x9E, 0x92, 0x71, 0x69, 0x86, 0xA2,
-  0xA6, 0xA3, 0xB5, 0xC5, 0xA2, 0x5E, 0x3B, 0x49, 0x5B, 0x58, 0x5D, 0x7D,
-  0x9B, 0x93, 0x72, 0x68, 0x81, 0x9E, 0xA4, 0xA2, 0xB2, 0xC3, 0xA5, 0x60,
-  0x37, 0x41, 0x55, 0x55, 0x5A, 0x77, 0x99, 0x96, 0x75, 0x63, 0x7A, 0x9B,
-  0xA5, 0xA1, 0xAF, 0xC4, 0xAF, 0x6B, 0x3A, 0x3F, 0x57, 0x5B, 0x59, 0x6F,
-  0x93, 0xA1, 0x8A, 0x6D, 0x71, 0x90, 0xA8, 0xA7, 0xA4, 0xB8, 0xC6, 0xA1,
-  0x5D, 0x38, 0x45, 0x58, 0x58, 0x59, 0x71, 0x92, 0x9A, 0x7E, 0x62, 0x6A,
-  0x8C, 0xA2, 0xA1, 0xA4, 0xBA, 0xC3, 0x99, 0x58, 0x3C, 0x4C, 0x5C, 0x59,
-  0x5E, 0x7B, 0x99, 0x9A, 0x7C, 0x65, 0x74, 0x96, 0xA7, 0xA3, 0xA8, 0xBF,
-  0xC1, 0x8C, 0x49, 0x35, 0x4A, 0x58, 0x55, 0x5E, 0x7E, 0x9B, 0x96, 0x74,
-  0x64, 0x7A, 0x9A, 0xA4, 0xA1, 0xAA, 0xC0, 0xBB, 0x83, 0x45, 0x3A, 0x51,
-  0x5C, 0x58, 0x63, 0x85, 0xA0, 0x94, 0x73, 0x68, 0x82, 0xA0, 0xA7, 0xA3,
-  0xAE, 0xC3, 0xB6, 0x79, 0x41, 0x3E, 0x55, 0x5B, 0x58, 0x68, 0x8B, 0x9E,
-  0x8D, 0x6E, 0x69, 0x86, 0xA2, 0xA6, 0xA2, 0xB2, 0xC4, 0xAC, 0x6A, 0x39,
-  0x3D, 0x54, 0x58, 0x56, 0x6A, 0x8F, 0x9E, 0x87, 0x69, 0x6B, 0x8C, 0xA6,
-  0xA6, 0xA3, 0xB7, 0xC7, 0xA5, 0x61, 0x3A, 0x46, 0x5A, 0x5C, 0x5C, 0x72,
-  0x95, 0x9E, 0x83, 0x67, 0x6F, 0x8E, 0xA3, 0xA1, 0xA1, 0xB5, 0xBE, 0x95,
-  0x4F, 0x2E, 0x3D, 0x50, 0x51, 0x57, 0x74, 0x95, 0x9A, 0x7E, 0x6A, 0x78,
-  0x97, 0xA5, 0xA2, 0xA7, 0xBD, 0xC0, 0x8F, 0x4C, 0x34, 0x47, 0x57, 0x55,
-  0x5D, 0x7C, 0x9B, 0x98, 0x76, 0x64, 0x79, 0x9A, 0xA5, 0xA1, 0xA7, 0xBC,
-  0xC1, 0x93, 0x4F, 0x33, 0x44, 0x57, 0x58, 0x5A, 0x70, 0x93, 0xA0, 0x89,
-  0x6B, 0x6B, 0x88, 0xA4, 0xA8, 0xA2, 0xB1, 0xC6, 0xB7, 0x7C, 0x44, 0x3C,
-  0x53, 0x5F, 0x5A, 0x62, 0x80, 0x9C, 0x9B, 0x7C, 0x68, 0x76, 0x96, 0xA7,
-  0xA6, 0xA6, 0xB8, 0xC6, 0xA4, 0x60, 0x36, 0x3E, 0x54, 0x59, 0x56, 0x67,
-  0x8B, 0x9F, 0x8F, 0x6F, 0x65, 0x7E, 0x9E, 0xA6, 0xA2, 0xAA, 0xC0, 0xBF,
-  0x8C, 0x4C, 0x37, 0x4A, 0x5B, 0x5B, 0x5E, 0x76, 0x98, 0xA0, 0x85, 0x6A,
-  0x6F, 0x8E, 0xA6, 0xA6, 0xA2, 0xB2, 0xC4, 0xAE, 0x70, 0x3C, 0x39, 0x50,
-  0x57, 0x52, 0x5E, 0x7D, 0x97, 0x90, 0x71, 0x61, 0x75, 0x96, 0xA6, 0xA5,
-  0xA9, 0xBF, 0xC7, 0x9D, 0x59, 0x38, 0x44, 0x57, 0x59, 0x58, 0x6C, 0x8E,
-  0x9F, 0x8C, 0x6C, 0x67, 0x83, 0xA0, 0xA6, 0xA2, 0xAC, 0xC2, 0xBB, 0x82,
-  0x43, 0x34, 0x4A, 0x58, 0x55, 0x5B, 0x77, 0x98, 0x9B, 0x7F, 0x67, 0x70,
-  0x8F, 0xA6, 0xA5, 0xA3, 0xB5, 0xC5, 0xAA, 0x6A, 0x3C, 0x3E, 0x56, 0x5B,
-  0x58, 0x67, 0x87, 0x9E, 0x93, 0x73, 0x65, 0x7C, 0x9B, 0xA6, 0xA2, 0xA7,
-  0xBD, 0xC1, 0x93, 0x51, 0x35, 0x45, 0x58, 0x58, 0x57, 0x6D, 0x91, 0x9D,
-  0x85, 0x68, 0x68, 0x86, 0xA2, 0xA5, 0xA0, 0xAE, 0xC3, 0xB6, 0x7B, 0x40,
-  0x35, 0x4B, 0x5A, 0x58, 0x5D, 0x74, 0x95, 0xA2, 0x8D, 0x70, 0x6C, 0x86,
-  0xA3, 0xAA, 0xA4, 0xAB, 0xC0, 0xC5, 0x9C, 0x5B, 0x36, 0x41, 0x57, 0x5A,
-  0x57, 0x65, 0x83, 0x9B, 0x94, 0x75, 0x5F, 0x6C, 0x8D, 0xA2, 0xA2, 0xA1,
-  0xB1, 0xC5, 0xB6, 0x7C, 0x45, 0x3A, 0x4E, 0x5C, 0x5A, 0x5B, 0x73, 0x94,
-  0x9F, 0x87, 0x69, 0x66, 0x81, 0x9F, 0xA8, 0xA1, 0xA7, 0xBE, 0xC2, 0x96,
-  0x53, 0x31, 0x3D, 0x54, 0x57, 0x54, 0x62, 0x83, 0x9D, 0x94, 0x75, 0x63,
-  0x72, 0x93, 0xA6, 0xA3, 0xA2, 0xB4, 0xC4, 0xB1, 0x77, 0x41, 0x38, 0x4F,
-  0x5C, 0x58, 0x5C, 0x76, 0x97, 0xA0, 0x88, 0x6C, 0x6A, 0x85, 0xA2, 0xA8,
-  0xA2, 0xAB, 0xC0, 0xC1, 0x96, 0x57, 0x36, 0x44, 0x59, 0x5C, 0x58, 0x65,
-  0x86, 0xA0, 0x96, 0x75, 0x64, 0x74, 0x95, 0xA7, 0xA4, 0xA4, 0xB6, 0xC6,
-  0xB1, 0x73, 0x3D, 0x37, 0x4D, 0x5A, 0x59, 0x5F, 0x79, 0x9A, 0xA3, 0x89,
-  0x6C, 0x6D, 0x89, 0xA4, 0xA9, 0xA3, 0xAC, 0xC1, 0xC1, 0x93, 0x52, 0x35,
-  0x44, 0x56, 0x57, 0x56, 0x65, 0x84, 0x9B, 0x90, 0x6E, 0x5C, 0x6E, 0x8F,
-  0xA2, 0xA0, 0xA0, 0xB3, 0xC5, 0xAF, 0x72, 0x3E, 0x39, 0x4F, 0x5B, 0x57,
-  0x5B, 0x75, 0x97, 0x9D, 0x82, 0x65, 0x67, 0x85, 0xA1, 0xA5, 0x9F, 0xA9,
-  0xBF, 0xBF, 0x93, 0x53, 0x31, 0x3B, 0x52, 0x59, 0x55, 0x5D, 0x79, 0x98,
-  0x9E, 0x85, 0x69, 0x68, 0x82, 0x9F, 0xA9, 0xA3, 0xA6, 0xBA, 0xC7, 0xAD,
-  0x6F, 0x3D, 0x39, 0x51, 0x5E, 0x5B, 0x5C, 0x71, 0x91, 0xA3, 0x94, 0x75,
-  0x66, 0x76, 0x95, 0xA9, 0xA7, 0xA4, 0xB1, 0xC5, 0xBE, 0x8C, 0x4D, 0x33,
-  0x43, 0x57, 0x59, 0x56, 0x62, 0x80, 0x9E, 0x9D, 0x7F, 0x65, 0x69, 0x85,
-  0xA2, 0xA9, 0xA1, 0xA7, 0xBD, 0xC5, 0xA4, 0x65, 0x38, 0x3A, 0x51, 0x5B,
-  0x59, 0x5E, 0x75, 0x96, 0xA4, 0x8F, 0x71, 0x67, 0x7B, 0x9A, 0xA9, 0xA4,
-  0xA2, 0xB3, 0xC4, 0xB5, 0x7E, 0x44, 0x33, 0x45, 0x55, 0x56, 0x54, 0x61,
-  0x80, 0x99, 0x93, 0x77, 0x64, 0x6E, 0x8D, 0xA7, 0xAA, 0xA5, 0xAD, 0xC1,
-  0xC2, 0x99, 0x59, 0x34, 0x3D, 0x54, 0x5A, 0x56, 0x5E, 0x79, 0x97, 0x9F,
-  0x87, 0x6A, 0x67, 0x80, 0x9E, 0xA9, 0xA3, 0xA4, 0xB8, 0xC5, 0xAD, 0x70,
-  0x3B, 0x33, 0x4B, 0x59, 0x56, 0x59, 0x6D, 0x8D, 0xA1, 0x95, 0x75, 0x65,
-  0x75, 0x94, 0xA8, 0xA7, 0xA2, 0xAF, 0xC3, 0xBC, 0x8B, 0x4E, 0x33, 0x42,
-  0x58, 0x5B, 0x58, 0x63, 0x80, 0x9D, 0x9E, 0x82, 0x67, 0x69, 0x85, 0xA1,
-  0xA8, 0xA1, 0xA5, 0xBB, 0xC4, 0xA4, 0x63, 0x34, 0x34, 0x4B, 0x57, 0x54,
-  0x58, 0x71, 0x92, 0x9F, 0x8B, 0x6C, 0x66, 0x7F, 0x9E, 0xA8, 0xA2, 0xA8,
-  0xBE, 0xC5, 0xA0, 0x61, 0x3A, 0x43, 0x5A, 0x5F, 0x5B, 0x67, 0x86, 0xA1,
-  0x9C, 0x7D, 0x68, 0x73, 0x92, 0xA7, 0xA5, 0xA1, 0xB1, 0xC3, 0xB3, 0x79,
-  0x3F, 0x31, 0x45, 0x53, 0x52, 0x57, 0x71, 0x93, 0xA0, 0x8C, 0x70, 0x6D,
-  0x86, 0xA1, 0xA9, 0xA3, 0xA9, 0xBE, 0xC3, 0x9B, 0x59, 0x33, 0x3E, 0x54,
-  0x59, 0x56, 0x63, 0x83, 0x9E, 0x98, 0x77, 0x63, 0x70, 0x91, 0xA6, 0xA4,
-  0xA1, 0xB2, 0xC3, 0xB2, 0x77, 0x3E, 0x33, 0x4A, 0x59, 0x57, 0x5A, 0x72,
-  0x94, 0x9F, 0x87, 0x6A, 0x68, 0x83, 0xA0, 0xA8, 0xA1, 0xA8, 0xBE, 0xC1,
-  0x98, 0x59, 0x38, 0x43, 0x58, 0x5C, 0x59, 0x67, 0x87, 0xA0, 0x98, 0x78,
-  0x67, 0x76, 0x95, 0xA8, 0xA5, 0xA3, 0xB4, 0xC4, 0xB1, 0x74, 0x3C, 0x34,
-  0x4C, 0x59, 0x56, 0x5A, 0x75, 0x96, 0xA0, 0x88, 0x6A, 0x68, 0x85, 0xA2,
-  0xA8, 0xA2, 0xAB, 0xC1, 0xC3, 0x99, 0x59, 0x38, 0x46, 0x5B, 0x5D, 0x5B,
-  0x6A, 0x8A, 0xA2, 0x98, 0x78, 0x67, 0x76, 0x95, 0xA6, 0xA2, 0xA0, 0xB1,
-  0xC1, 0xAB, 0x6E, 0x38, 0x31, 0x47, 0x52, 0x50, 0x59, 0x74, 0x94, 0x9D,
-  0x87, 0x6D, 0x6D, 0x87, 0xA1, 0xA6, 0xA1, 0xA9, 0xBF, 0xC0, 0x91, 0x4F,
-  0x30, 0x3F, 0x55, 0x57, 0x55, 0x67, 0x89, 0x9E, 0x8E, 0x6E, 0x64, 0x7E,
-  0x9D, 0xA6, 0xA1, 0xA9, 0xBF, 0xBE, 0x8A, 0x4A, 0x35, 0x48, 0x59, 0x58,
-  0x5B, 0x74, 0x97, 0x9F, 0x84, 0x69, 0x6F, 0x8E, 0xA5, 0xA6, 0xA3, 0xB3,
-  0xC6, 0xB1, 0x73, 0x40, 0x3E, 0x55, 0x5E, 0x5A, 0x65, 0x84, 0x9F, 0x98,
-  0x79, 0x67, 0x79, 0x9A, 0xA8, 0xA4, 0xA7, 0xBC, 0xC4, 0x9A, 0x57, 0x35,
-  0x41, 0x56, 0x58, 0x57, 0x6C, 0x8F, 0x9F, 0x8B, 0x6B, 0x67, 0x83, 0xA0,
-  0xA6, 0xA2, 0xAC, 0xC2, 0xBB, 0x83, 0x46, 0x38, 0x4F, 0x5D, 0x5A, 0x5F,
-  0x7B, 0x9B, 0x9E, 0x81, 0x68, 0x72, 0x91, 0xA6, 0xA3, 0xA1, 0xB4, 0xC3,
-  0xA7, 0x67, 0x38, 0x39, 0x51, 0x57, 0x52, 0x5F, 0x80, 0x98, 0x8E, 0x70,
-  0x64, 0x7B, 0x9C, 0xAA, 0xA7, 0xAC, 0xC0, 0xC3, 0x94, 0x52, 0x36, 0x45,
-  0x58, 0x58, 0x58, 0x70, 0x92, 0x9E, 0x87, 0x6A, 0x6A, 0x88, 0xA3, 0xA6,
-  0xA2, 0xAF, 0xC4, 0xB6, 0x78, 0x3D, 0x36, 0x4C, 0x57, 0x55, 0x5D, 0x7B,
-  0x9B, 0x99, 0x7A, 0x65, 0x74, 0x94, 0xA7, 0xA3, 0xA4, 0xB9, 0xC5, 0xA2,
-  0x61, 0x39, 0x41, 0x58, 0x5B, 0x58, 0x6A, 0x8B, 0x9E, 0x8F, 0x6F, 0x67,
-  0x81, 0x9E, 0xA7, 0xA2, 0xA9, 0xBF, 0xBE, 0x8A, 0x4A, 0x35, 0x48, 0x58,
-  0x55, 0x58, 0x72, 0x95, 0x9C, 0x81, 0x66, 0x6D, 0x8E, 0xA4, 0xA3, 0xA4,
-  0xB8, 0xC4, 0x9F, 0x59, 0x35, 0x44, 0x59, 0x59, 0x5C, 0x76, 0x9A, 0xA0,
-  0x82, 0x6A, 0x78, 0x98, 0xA8, 0xA5, 0xA8, 0xBE, 0xC5, 0x97, 0x54, 0x39,
-  0x4B, 0x5B, 0x57, 0x5C, 0x7A, 0x98, 0x96, 0x77, 0x63, 0x73, 0x94, 0xA2,
-  0x9E, 0xA6, 0xBE, 0xBC, 0x89, 0x4D, 0x3D, 0x53, 0x5E, 0x58, 0x61, 0x81,
-  0x9C, 0x95, 0x74, 0x65, 0x7B, 0x9C, 0xA6, 0xA1, 0xAB, 0xC2, 0xB7, 0x79,
-  0x3E, 0x36, 0x4E, 0x57, 0x54, 0x61, 0x83, 0x9C, 0x8D, 0x6C, 0x63, 0x7F,
-  0x9E, 0xA4, 0x9E, 0xAD, 0xC3, 0xB0, 0x6F, 0x3B, 0x3D, 0x53, 0x5A, 0x59,
-  0x69, 0x8B, 0x9E, 0x8C, 0x6C, 0x6A, 0x87, 0xA3, 0xA6, 0xA3, 0xB4, 0xC6,
-  0xAA, 0x67, 0x3B, 0x42, 0x57, 0x5B, 0x5A, 0x70, 0x93, 0xA0, 0x87, 0x6A,
-  0x6E, 0x8D, 0xA4, 0xA4, 0xA4, 0xB8, 0xC5, 0xA1, 0x5B, 0x35, 0x43, 0x57,
-  0x57, 0x59, 0x74, 0x96, 0x9E, 0x81, 0x67, 0x72, 0x94, 0xA7, 0xA5, 0xA7,
-  0xBD, 0xC6, 0x9C, 0x57, 0x3B, 0x4D, 0x5E, 0x5A, 0x5F, 0x7C, 0x9B, 0x9B,
-  0x7D, 0x67, 0x77, 0x97, 0xA5, 0xA0, 0xA5, 0xBB, 0xBB, 0x89, 0x47, 0x32,
-  0x45, 0x51, 0x4E, 0x58, 0x7B, 0x99, 0x93, 0x76, 0x68, 0x7E, 0x9E, 0xA8,
-  0xA1, 0xAA, 0xC1, 0xB7, 0x7C, 0x40, 0x37, 0x4D, 0x58, 0x55, 0x62, 0x86,
-  0x9D, 0x8B, 0x6B, 0x6B, 0x8B, 0xA3, 0xA3, 0xA3, 0xB9, 0xC1, 0x90, 0x4B,
-  0x34, 0x49, 0x58, 0x55, 0x60, 0x83, 0x9D, 0x8F, 0x6D, 0x69, 0x88, 0xA2,
-  0xA5, 0xA5, 0xB9, 0xC5, 0x9E, 0x59, 0x3A, 0x4B, 0x5A, 0x5A, 0x62, 0x82,
-  0x9E, 0x96, 0x74, 0x6B, 0x86, 0xA3, 0xA7, 0xA4, 0xB6, 0xC7, 0xA5, 0x5E,
-  0x39, 0x48, 0x5A, 0x58, 0x5B, 0x79, 0x99, 0x95, 0x73, 0x65, 0x7E, 0x9D,
-  0xA5, 0xA3, 0xB2, 0xC5, 0xAA, 0x64, 0x37, 0x40, 0x55, 0x56, 0x5A, 0x77,
-  0x9A, 0x9A, 0x7A, 0x68, 0x7E, 0x9E, 0xA8, 0xA4, 0xB0, 0xC5, 0xB4, 0x72,
-  0x3F, 0x43, 0x58, 0x59, 0x59, 0x72, 0x93, 0x97, 0x79, 0x64, 0x74, 0x95,
-  0xA2, 0x9E, 0xA7, 0xBD, 0xAF, 0x6F, 0x3A, 0x3C, 0x53, 0x59, 0x5C, 0x74,
-  0x98, 0xA1, 0x83, 0x67, 0x74, 0x96, 0xA6, 0xA2, 0xAA, 0xC1, 0xBC, 0x80,
-  0x42, 0x3B, 0x52, 0x59, 0x56, 0x69, 0x8E, 0x9C, 0x83, 0x66, 0x6F, 0x91,
-  0xA5, 0xA2, 0xA6, 0xBD, 0xBD, 0x85, 0x44, 0x38, 0x4F, 0x59, 0x58, 0x68,
-  0x8B, 0x9F, 0x8A, 0x6A, 0x6D, 0x8E, 0xA5, 0xA3, 0xA5, 0xBC, 0xC1, 0x90,
-  0x4E, 0x3C, 0x50, 0x5B, 0x58, 0x64, 0x86, 0x9E, 0x8D, 0x6C, 0x6B, 0x8A,
-  0xA2, 0xA3, 0xA3, 0xB7, 0xC0, 0x94, 0x4F, 0x35, 0x48, 0x57, 0x54, 0x5E,
-  0x82, 0x9C, 0x8A, 0x69, 0x6B, 0x8D, 0xA4, 0xA3, 0xA7, 0xBF, 0xBB, 0x7E,
-  0x41, 0x3D, 0x55, 0x5B, 0x5A, 0x74, 0x9A, 0x9C, 0x7B, 0x6A, 0x82, 0xA2,
-  0xA8, 0xA5, 0xB6, 0xC6, 0xA0, 0x59, 0x3B, 0x4E, 0x5B, 0x57, 0x65, 0x89,
-  0x9C, 0x86, 0x67, 0x6D, 0x8E, 0xA0, 0x9D, 0xA5, 0xBD, 0xB3, 0x74, 0x3E,
-  0x42, 0x5A, 0x5D, 0x60, 0x7B, 0x99, 0x96, 0x77, 0x68, 0x82, 0xA0, 0xA5,
-  0xA3, 0xB8, 0xC4, 0x96, 0x4F, 0x37, 0x4C, 0x58, 0x55, 0x65, 0x8B, 0x9C,
-  0x83, 0x66, 0x71, 0x95, 0xA5, 0x9F, 0xAA, 0xC2, 0xB0, 0x6B, 0x39, 0x42,
-  0x57, 0x56, 0x5B, 0x7B, 0x9A, 0x91, 0x71, 0x6A, 0x87, 0xA2, 0xA3, 0xA5,
-  0xBB, 0xC1, 0x8D, 0x4C, 0x3D, 0x53, 0x5A, 0x59, 0x6D, 0x91, 0x9B, 0x81,
-  0x69, 0x78, 0x99, 0xA6, 0xA4, 0xB1, 0xC4, 0xAB, 0x67, 0x3B, 0x45, 0x58,
-  0x56, 0x5D, 0x7F, 0x9B, 0x8F, 0x6E, 0x69, 0x89, 0xA4, 0xA4, 0xA6, 0xBE,
-  0xBF, 0x85, 0x45, 0x3C, 0x54, 0x5C, 0x5A, 0x70, 0x96, 0x9E, 0x7F, 0x69,
-  0x7D, 0x9F, 0xA7, 0xA4, 0xB4, 0xC6, 0xA5, 0x5E, 0x3B, 0x4A, 0x5A, 0x56,
-  0x60, 0x83, 0x9A, 0x88, 0x67, 0x68, 0x8A, 0x9F, 0x9C, 0xA2, 0xBA, 0xB5,
-  0x7A, 0x40, 0x3C, 0x55, 0x5B, 0x5C, 0x76, 0x96, 0x96, 0x78, 0x65, 0x7B,
-  0x9D, 0xA3, 0xA1, 0xB6, 0xC0, 0x8F, 0x4A, 0x39, 0x4F, 0x56, 0x55, 0x70,
-  0x95, 0x96, 0x75, 0x66, 0x81, 0xA0, 0xA2, 0xA3, 0xBC, 0xBD, 0x83, 0x43,
-  0x3D, 0x55, 0x59, 0x5A, 0x77, 0x98, 0x92, 0x71, 0x6B, 0x8B, 0xA5, 0xA4,
-  0xA9, 0xC1, 0xB9, 0x7A, 0x43, 0x45, 0x5B, 0x5B, 0x60, 0x82, 0x9E, 0x8F,
-  0x6F, 0x70, 0x92, 0xA7, 0xA3, 0xAC, 0xC4, 0xB0, 0x6A, 0x3C, 0x48, 0x5A,
-  0x56, 0x60, 0x86, 0x9C, 0x86, 0x69, 0x72, 0x96, 0xA5, 0xA1, 0xAF, 0xC4,
-  0xA6, 0x5C, 0x37, 0x4A, 0x59, 0x55, 0x66, 0x8E, 0x9C, 0x81, 0x69, 0x79,
-  0x9C, 0xA6, 0xA2, 0xB6, 0xC5, 0x9A, 0x53, 0x3D, 0x52, 0x5B, 0x58, 0x6D,
-  0x92, 0x98, 0x79, 0x66, 0x7D, 0x9D, 0xA0, 0x9F, 0xB6, 0xBC, 0x87, 0x43,
-  0x34, 0x4D, 0x56, 0x57, 0x72, 0x97, 0x98, 0x78, 0x6D, 0x89, 0xA4, 0xA3,
-  0xA6, 0xBE, 0xBB, 0x7E, 0x42, 0x3F, 0x55, 0x57, 0x5A, 0x7B, 0x9C, 0x91,
-  0x6F, 0x6B, 0x8C, 0xA4, 0xA1, 0xA9, 0xC2, 0xB4, 0x70, 0x3A, 0x40, 0x56,
-  0x56, 0x5D, 0x80, 0x9A, 0x89, 0x6B, 0x6F, 0x92, 0xA5, 0xA2, 0xAD, 0xC3,
-  0xAD, 0x67, 0x3D, 0x4A, 0x5B, 0x57, 0x64, 0x8A, 0x9D, 0x85, 0x6A, 0x75,
-  0x97, 0xA5, 0xA1, 0xB1, 0xC3, 0xA0, 0x59, 0x3A, 0x4D, 0x5A, 0x56, 0x68,
-  0x8E, 0x9A, 0x7C, 0x63, 0x70, 0x90, 0xA0, 0x9E, 0xA3, 0xB9, 0xBB, 0x88,
-  0x48, 0x34, 0x49, 0x57, 0x55, 0x5C, 0x7A, 0x98, 0x94, 0x75, 0x66, 0x7A,
-  0x98, 0xA4, 0xA2, 0xAA, 0xC0, 0xBA, 0x83, 0x48, 0x3D, 0x51, 0x5C, 0x59,
-  0x64, 0x84, 0x9C, 0x90, 0x71, 0x66, 0x7E, 0x9B, 0xA1, 0x9C, 0xA9, 0xBD,
-  0xAF, 0x72, 0x3B, 0x38, 0x51, 0x59, 0x56, 0x66, 0x8A, 0xA0, 0x91, 0x71,
-  0x6B, 0x86, 0xA0, 0xA4, 0xA1, 0xB0, 0xC3, 0xAD, 0x6D, 0x3D, 0x40, 0x56,
-  0x5A, 0x57, 0x6B, 0x8E, 0x9D, 0x88, 0x6B, 0x6B, 0x89, 0xA2, 0xA2, 0xA1,
-  0xB3, 0xC0, 0xA1, 0x61, 0x3A, 0x42, 0x56, 0x58, 0x58, 0x6F, 0x91, 0x9A,
-  0x81, 0x67, 0x6F, 0x8F, 0xA3, 0xA1, 0xA3, 0xB7, 0xBF, 0x97, 0x58, 0x3B,
-  0x49, 0x5A, 0x5A, 0x5D, 0x76, 0x96, 0x99, 0x7C, 0x67, 0x74, 0x95, 0xA5,
-  0xA2, 0xA5, 0xBB, 0xBF, 0x8F, 0x4F, 0x39, 0x4B, 0x5A, 0x58, 0x5E, 0x7B,
-  0x9A, 0x98, 0x79, 0x66, 0x79, 0x99, 0xA6, 0xA2, 0xAB, 0xC1, 0xBC, 0x86,
-  0x4A, 0x3D, 0x52, 0x5D, 0x5B, 0x67, 0x85, 0x9E, 0x95, 0x76, 0x6B, 0x82,
-  0x9E, 0xA6, 0xA3, 0xAD, 0xC1, 0xB5, 0x7A, 0x43, 0x3D, 0x52, 0x59, 0x55,
-  0x63, 0x84, 0x9A, 0x8A, 0x69, 0x64, 0x80, 0x9C, 0xA1, 0x9F, 0xAF, 0xC3,
-  0xB1, 0x73, 0x41, 0x41, 0x56, 0x5B, 0x57, 0x67, 0x89, 0x9D, 0x8F, 0x6F,
-  0x66, 0x7D, 0x9B, 0xA4, 0xA1, 0xA8, 0xBD, 0xBD, 0x8D, 0x4D, 0x37, 0x48,
-  0x58, 0x57, 0x5A, 0x72, 0x93, 0x9C, 0x84, 0x6A, 0x6D, 0x8A, 0xA3, 0xA5,
-  0xA1, 0xB0, 0xC3, 0xB0, 0x75, 0x43, 0x3E, 0x55, 0x5E, 0x5A, 0x64, 0x82,
-  0x9C, 0x98, 0x79, 0x68, 0x79, 0x97, 0xA6, 0xA3, 0xA5, 0xB9, 0xC3, 0x9E,
-  0x5D, 0x3C, 0x46, 0x59, 0x5C, 0x5A, 0x6D, 0x8E, 0x9E, 0x8C, 0x6E, 0x68,
-  0x82, 0x9F, 0xA6, 0xA1, 0xAB, 0xBF, 0xBA, 0x85, 0x48, 0x38, 0x4C, 0x5A,
-  0x59, 0x5D, 0x77, 0x98, 0x9C, 0x81, 0x6A, 0x72, 0x90, 0xA5, 0xA5, 0xA3,
-  0xB4, 0xC3, 0xAA, 0x6E, 0x3F, 0x40, 0x57, 0x5C, 0x58, 0x65, 0x84, 0x9A,
-  0x92, 0x72, 0x64, 0x78, 0x96, 0xA2, 0x9D, 0xA1, 0xB7, 0xBD, 0x93, 0x54,
-  0x39, 0x48, 0x5C, 0x5E, 0x5E, 0x72, 0x91, 0x9E, 0x89, 0x6C, 0x6A, 0x87,
-  0xA1, 0xA5, 0xA1, 0xAE, 0xC2, 0xB7, 0x7D, 0x44, 0x39, 0x4F, 0x5A, 0x57,
-  0x5E, 0x7B, 0x9A, 0x99, 0x7C, 0x66, 0x72, 0x91, 0xA5, 0xA2, 0xA2, 0xB5,
-  0xC2, 0xA3, 0x65, 0x3C, 0x42, 0x58, 0x5C, 0x59, 0x6A, 0x8A, 0x9D, 0x90,
-  0x71, 0x67, 0x7E, 0x9B, 0xA5, 0xA1, 0xA8, 0xBD, 0xBC, 0x8C, 0x4F, 0x39,
-  0x4A, 0x5B, 0x5A, 0x5B, 0x73, 0x94, 0x9B, 0x83, 0x69, 0x6A, 0x85, 0x9F,
-  0xA4, 0x9F, 0xA9, 0xBD, 0xBC, 0x8F, 0x50, 0x34, 0x44, 0x57, 0x59, 0x58,
-  0x68, 0x88, 0x9E, 0x93, 0x74, 0x66, 0x79, 0x98, 0xA7, 0xA5, 0xA6, 0xB7,
-  0xC5, 0xAD, 0x71, 0x40, 0x3E, 0x54, 0x5E, 0x5B, 0x61, 0x7B, 0x98, 0x9D,
-  0x83, 0x68, 0x6B, 0x88, 0xA0, 0xA3, 0x9E, 0xA8, 0xBC, 0xB8, 0x88, 0x4B,
-  0x35, 0x46, 0x59, 0x5B, 0x5D, 0x6E, 0x8E, 0xA1, 0x92, 0x74, 0x68, 0x7A,
-  0x98, 0xA7, 0xA2, 0xA3, 0xB7, 0xC3, 0xA7, 0x6A, 0x3B, 0x3B, 0x51, 0x5A,
-  0x57, 0x5E, 0x7A, 0x98, 0x9B, 0x80, 0x68, 0x6C, 0x88, 0xA1, 0xA4, 0x9F,
-  0xAA, 0xBE, 0xBA, 0x8B, 0x4E, 0x37, 0x48, 0x5A, 0x59, 0x5A, 0x6C, 0x8C,
-  0x9F, 0x90, 0x72, 0x68, 0x7B, 0x99, 0xA6, 0xA2, 0xA4, 0xB7, 0xC3, 0xA7,
-  0x6A, 0x3D, 0x3F, 0x56, 0x5D, 0x59, 0x62, 0x7E, 0x9A, 0x9B, 0x81, 0x69,
-  0x6F, 0x8B, 0xA2, 0xA4, 0xA0, 0xAC, 0xC1, 0xBA, 0x87, 0x4A, 0x35, 0x47,
-  0x59, 0x59, 0x59, 0x6D, 0x8E, 0x9F, 0x8F, 0x71, 0x68, 0x7D, 0x9A, 0xA8,
-  0xA4, 0xA6, 0xB9, 0xC4, 0xA6, 0x68, 0x3D, 0x40, 0x56, 0x5D, 0x5A, 0x62,
-  0x7D, 0x99, 0x9A, 0x7D, 0x65, 0x6C, 0x89, 0x9F, 0xA0, 0x9B, 0xA7, 0xBB,
-  0xB2, 0x7D, 0x44, 0x34, 0x48, 0x59, 0x5A, 0x5C, 0x70, 0x90, 0xA0, 0x90,
-  0x72, 0x65, 0x75, 0x93, 0xA5, 0xA2, 0x9F, 0xAE, 0xC1, 0xB8, 0x85, 0x49,
-  0x32, 0x43, 0x56, 0x58, 0x56, 0x64, 0x83, 0x9D, 0x9A, 0x7E, 0x66, 0x6B,
-  0x87, 0xA1, 0xA6, 0xA0, 0xA7, 0xBB, 0xC2, 0xA0, 0x63, 0x3A, 0x3E, 0x54,
-  0x5D, 0x5A, 0x5F, 0x77, 0x96, 0xA0, 0x8C, 0x71, 0x6A, 0x7E, 0x9B, 0xA8,
-  0xA3, 0xA3, 0xB4, 0xC3, 0xB3, 0x7D, 0x47, 0x39, 0x4C, 0x5D, 0x5C, 0x5B,
-  0x6A, 0x89, 0x9F, 0x96, 0x78, 0x66, 0x71, 0x8D, 0xA4, 0xA5, 0x9F, 0xAA,
-  0xBE, 0xBD, 0x93, 0x56, 0x35, 0x3F, 0x55, 0x5B, 0x57, 0x60, 0x7B, 0x99,
-  0x9D, 0x85, 0x6C, 0x6B, 0x84, 0xA0, 0xA9, 0xA3, 0xA5, 0xB8, 0xC4, 0xAA,
-  0x6F, 0x3F, 0x3A, 0x4F, 0x5C, 0x59, 0x5A, 0x6D, 0x8D, 0x9D, 0x8E, 0x70,
-  0x61, 0x70, 0x8E, 0xA1, 0xA0, 0x9F, 0xAD, 0xC1, 0xBA, 0x8C, 0x52, 0x3A,
-  0x48, 0x5A, 0x5B, 0x59, 0x64, 0x82, 0x9D, 0x9B, 0x7F, 0x67, 0x6A, 0x86,
-  0xA1, 0xA7, 0xA0, 0xA7, 0xBB, 0xC2, 0xA3, 0x65, 0x38, 0x39, 0x50, 0x5A,
-  0x57, 0x5B, 0x72, 0x92, 0xA0, 0x8C, 0x6E, 0x66, 0x7A, 0x98, 0xA6, 0xA2,
-  0xA2, 0xB2, 0xC2, 0xB4, 0x80, 0x48, 0x37, 0x4A, 0x5A, 0x5A, 0x59, 0x68,
-  0x86, 0x9D, 0x97, 0x7A, 0x67, 0x70, 0x8C, 0xA3, 0xA5, 0x9F, 0xA8, 0xBC,
-  0xBF, 0x9C, 0x60, 0x38, 0x3B, 0x50, 0x5A, 0x57, 0x58, 0x6A, 0x89, 0x9E,
-  0x95, 0x78, 0x63, 0x69, 0x86, 0xA0, 0xA7, 0xA1, 0xA4, 0xB7, 0xC4, 0xB1,
-  0x7B, 0x45, 0x37, 0x49, 0x5B, 0x5E, 0x5C, 0x65, 0x80, 0x9C, 0xA1, 0x89,
-  0x6E, 0x68, 0x7C, 0x99, 0xA8, 0xA5, 0xA1, 0xAE, 0xC0, 0xBD, 0x94, 0x58,
-  0x35, 0x3C, 0x52, 0x59, 0x55, 0x57, 0x6C, 0x8D, 0x9F, 0x92, 0x76, 0x68,
-  0x72, 0x8F, 0xA6, 0xA8, 0xA1, 0xA8, 0xBB, 0xC3, 0xAA, 0x71, 0x3F, 0x35,
-  0x4B, 0x5B, 0x5A, 0x58, 0x64, 0x81, 0x9C, 0x9B, 0x81, 0x68, 0x66, 0x7D,
-  0x9A, 0xA7, 0xA1, 0xA0, 0xAF, 0xC0, 0xB8, 0x8A, 0x4E, 0x33, 0x40, 0x56,
-  0x5C, 0x58, 0x5D, 0x75, 0x93, 0xA0, 0x90, 0x74, 0x66, 0x73, 0x90, 0xA5,
-  0xA6, 0xA0, 0xA8, 0xBC, 0xC2, 0xA3, 0x68, 0x3C, 0x3A, 0x4F, 0x5C, 0x5C,
-  0x5B, 0x6A, 0x89, 0xA0, 0x9A, 0x7F, 0x69, 0x6A, 0x83, 0x9E, 0xA7, 0xA1,
-  0xA2, 0xB3, 0xC3, 0xB5, 0x81, 0x48, 0x33, 0x43, 0x57, 0x5B, 0x58, 0x60,
-  0x7A, 0x97, 0xA0, 0x8E, 0x72, 0x67, 0x78, 0x96, 0xA8, 0xA6, 0xA1, 0xAC,
-  0xC0, 0xC1, 0x9C, 0x61, 0x3B, 0x3D, 0x51, 0x5D, 0x5B, 0x5B, 0x6D, 0x8A,
-  0x9D, 0x95, 0x79, 0x63, 0x69, 0x83, 0x9C, 0xA2, 0x9B, 0x9E, 0xB2, 0xC1,
-  0xAC, 0x77, 0x45, 0x36, 0x47, 0x59, 0x5D, 0x58, 0x5E, 0x73, 0x90, 0xA1,
-  0x96, 0x78, 0x64, 0x69, 0x83, 0x9D, 0xA8, 0xA2, 0xA0, 0xAE, 0xC0, 0xBC,
-  0x95, 0x5B, 0x34, 0x36, 0x4C, 0x5A, 0x59, 0x57, 0x64, 0x80, 0x9B, 0x9F,
-  0x8B, 0x70, 0x66, 0x75, 0x92, 0xA5, 0xA7, 0xA1, 0xA6, 0xB9, 0xC4, 0xB2,
-  0x7F, 0x4A, 0x35, 0x44, 0x58, 0x5F, 0x5B, 0x5E, 0x72, 0x90, 0xA2, 0x9A,
-  0x7F, 0x69, 0x6B, 0x82, 0x9D, 0xA9, 0xA5, 0xA1, 0xAD, 0xC1, 0xC1, 0x9C,
-  0x61, 0x37, 0x35, 0x4B, 0x5B, 0x5A, 0x57, 0x62, 0x7D, 0x98, 0xA0, 0x8D,
-  0x6F, 0x63, 0x73, 0x8F, 0xA4, 0xA7, 0xA1, 0xA4, 0xB6, 0xC4, 0xB5, 0x84,
-  0x4D, 0x35, 0x42, 0x57, 0x5E, 0x5B, 0x5D, 0x6F, 0x8C, 0xA0, 0x9B, 0x80,
-  0x68, 0x68, 0x7E, 0x99, 0xA6, 0xA1, 0x9C, 0xA8, 0xBA, 0xBD, 0x9E, 0x64,
-  0x36, 0x33, 0x48, 0x59, 0x5D, 0x5C, 0x65, 0x7F, 0x9A, 0xA2, 0x91, 0x74,
-  0x64, 0x70, 0x8B, 0xA2, 0xA8, 0xA1, 0xA3, 0xB4, 0xC3, 0xB6, 0x88, 0x4E,
-  0x32, 0x3C, 0x52, 0x5B, 0x59, 0x59, 0x6A, 0x88, 0x9E, 0x9B, 0x82, 0x69,
-  0x66, 0x7B, 0x97, 0xA7, 0xA4, 0x9F, 0xA9, 0xBD, 0xC2, 0xA6, 0x70, 0x40,
-  0x36, 0x48, 0x5A, 0x5D, 0x59, 0x60, 0x78, 0x94, 0xA1, 0x93, 0x76, 0x64,
-  0x6D, 0x88, 0xA0, 0xA7, 0xA1, 0xA2, 0xB3, 0xC2, 0xB3, 0x7F, 0x47, 0x34,
-  0x45, 0x58, 0x5A, 0x56, 0x5E, 0x79, 0x96, 0x9E, 0x89, 0x6D, 0x63, 0x75,
-  0x94, 0xA5, 0xA3, 0x9F, 0xAB, 0xBE, 0xBF, 0x98, 0x5D, 0x38, 0x3C, 0x52,
-  0x5E, 0x5D, 0x5E, 0x70, 0x8F, 0xA2, 0x98, 0x7C, 0x69, 0x70, 0x8A, 0xA3,
-  0xA8, 0xA0, 0xA4, 0xB6, 0xC2, 0xAD, 0x76, 0x41, 0x34, 0x47, 0x58, 0x58,
-  0x54, 0x5F, 0x7B, 0x98, 0x9E, 0x87, 0x6D, 0x69, 0x7F, 0x9D, 0xAA, 0xA4,
-  0xA0, 0xAE, 0xC1, 0xBC, 0x90, 0x55, 0x35, 0x3C, 0x52, 0x5B, 0x58, 0x5B,
-  0x72, 0x91, 0xA0, 0x92, 0x75, 0x64, 0x6F, 0x8C, 0xA3, 0xA5, 0x9F, 0xA4,
-  0xB8, 0xC1, 0xA5, 0x6B, 0x3C, 0x35, 0x4A, 0x5A, 0x5A, 0x59, 0x67, 0x84,
-  0x9E, 0x9D, 0x84, 0x6A, 0x69, 0x81, 0x9C, 0xA7, 0xA3, 0xA1, 0xB1, 0xC2,
-  0xB8, 0x88, 0x4F, 0x36, 0x42, 0x57, 0x5E, 0x5A, 0x60, 0x78, 0x97, 0xA3,
-  0x91, 0x73, 0x66, 0x75, 0x92, 0xA5, 0xA6, 0xA0, 0xA8, 0xBD, 0xC2, 0x9F,
-  0x63, 0x38, 0x36, 0x4C, 0x5B, 0x5A, 0x59, 0x6A, 0x89, 0xA0, 0x9B, 0x80,
-  0x69, 0x6C, 0x86, 0xA1, 0xAA, 0xA4, 0xA4, 0xB6, 0xC5, 0xB4, 0x7F, 0x49,
-  0x36, 0x46, 0x5A, 0x5D, 0x59, 0x61, 0x7A, 0x96, 0x9E, 0x8A, 0x6C, 0x62,
-  0x74, 0x91, 0xA2, 0x9F, 0x9A, 0xA7, 0xBC, 0xBA, 0x8F, 0x55, 0x37, 0x43,
-  0x59, 0x5D, 0x57, 0x60, 0x7C, 0x98, 0x9C, 0x84, 0x68, 0x66, 0x7F, 0x9C,
-  0xA6, 0xA1, 0xA3, 0xB6, 0xC3, 0xA9, 0x6C, 0x3A, 0x35, 0x4B, 0x59, 0x56,
-  0x59, 0x6E, 0x8E, 0xA0, 0x92, 0x74, 0x65, 0x74, 0x93, 0xA7, 0xA4, 0xA0,
-  0xAF, 0xC2, 0xBA, 0x8A, 0x4F, 0x37, 0x47, 0x5A, 0x5D, 0x5B, 0x66, 0x83,
-  0x9E, 0x9D, 0x81, 0x6B, 0x6F, 0x89, 0xA2, 0xA7, 0xA1, 0xA8, 0xBC, 0xC1,
-  0xA1, 0x66, 0x3B, 0x3C, 0x53, 0x5D, 0x59, 0x5C, 0x73, 0x93, 0x9F, 0x8B,
-  0x6E, 0x66, 0x7B, 0x98, 0xA6, 0xA1, 0xA1, 0xB2, 0xC2, 0xB2, 0x7C, 0x45,
-  0x36, 0x49, 0x5B, 0x5C, 0x5A, 0x6A, 0x89, 0x9E, 0x97, 0x7B, 0x68, 0x71,
-  0x8F, 0xA5, 0xA6, 0xA1, 0xAB, 0xBF, 0xBE, 0x94, 0x58, 0x36, 0x3F, 0x55,
-  0x5A, 0x56, 0x5D, 0x78, 0x95, 0x99, 0x80, 0x65, 0x64, 0x7E, 0x9B, 0xA6,
-  0xA4, 0xA8, 0xBA, 0xC7, 0xAE, 0x72, 0x3F, 0x38, 0x4D, 0x5A, 0x59, 0x59,
-  0x6D, 0x8E, 0xA1, 0x93, 0x74, 0x64, 0x73, 0x92, 0xA6, 0xA4, 0xA0, 0xAE,
-  0xC1, 0xBB, 0x8D, 0x50, 0x34, 0x41, 0x55, 0x59, 0x57, 0x62, 0x7F, 0x9C,
-  0x9C, 0x80, 0x69, 0x6C, 0x86, 0xA0, 0xA7, 0xA0, 0xA5, 0xBA, 0xC2, 0xA3,
-  0x68, 0x3C, 0x3C, 0x52, 0x5C, 0x59, 0x5C, 0x72, 0x91, 0x9E, 0x8A, 0x6D,
-  0x68, 0x80, 0x9C, 0xA5, 0xA0, 0xA6, 0xBA, 0xC0, 0x9A, 0x5A, 0x35, 0x3F,
-  0x54, 0x58, 0x56, 0x62, 0x81, 0x9C, 0x96, 0x77, 0x64, 0x71, 0x90, 0xA5,
-  0xA3, 0xA0, 0xB0, 0xC2, 0xB2, 0x7B, 0x46, 0x3B, 0x51, 0x5F, 0x5D, 0x5F,
-  0x76, 0x96, 0xA1, 0x8B, 0x6F, 0x6C, 0x84, 0xA0, 0xA8, 0xA1, 0xA7, 0xBC,
-  0xBF, 0x97, 0x59, 0x37, 0x41, 0x55, 0x58, 0x55, 0x62, 0x81, 0x9B, 0x96,
-  0x78, 0x67, 0x76, 0x96, 0xA9, 0xA7, 0xA4, 0xB2, 0xC4, 0xB3, 0x79, 0x43,
-  0x3A, 0x4F, 0x5B, 0x58, 0x5C, 0x74, 0x95, 0x9E, 0x87, 0x6A, 0x69, 0x83,
-  0x9E, 0xA4, 0x9F, 0xA6, 0xBC, 0xBF, 0x95, 0x55, 0x35, 0x42, 0x56, 0x59,
-  0x57, 0x66, 0x85, 0x9C, 0x94, 0x77, 0x66, 0x74, 0x92, 0xA5, 0xA3, 0xA1,
-  0xB2, 0xC3, 0xAF, 0x74, 0x41, 0x3B, 0x51, 0x5D, 0x5A, 0x5E, 0x76, 0x95,
-  0x9D, 0x86, 0x6C, 0x6B, 0x84, 0xA0, 0xA7, 0xA1, 0xA8, 0xBD, 0xBE, 0x93,
-  0x54, 0x36, 0x44, 0x57, 0x5A, 0x58, 0x67, 0x86, 0x9D, 0x93, 0x75, 0x66,
-  0x76, 0x94, 0xA6, 0xA4, 0xA3, 0xB4, 0xC4, 0xAD, 0x72, 0x40, 0x3D, 0x54,
-  0x5F, 0x5B, 0x60, 0x7A, 0x98, 0x9F, 0x87, 0x6C, 0x6D, 0x87, 0xA1, 0xA6,
-  0xA0, 0xA8, 0xBC, 0xBB, 0x8F, 0x52, 0x34, 0x42, 0x56, 0x56, 0x53, 0x64,
-  0x85, 0x9A, 0x8C, 0x6D, 0x66, 0x81, 0x9F, 0xA8, 0xA3, 0xA9, 0xBE, 0xBB,
-  0x88, 0x4A, 0x37, 0x4A, 0x59, 0x57, 0x5A, 0x74, 0x94, 0x9B, 0x82, 0x67,
-  0x6C, 0x8B, 0xA2, 0xA3, 0xA1, 0xB0, 0xC1, 0xAD, 0x6F, 0x3C, 0x3B, 0x52,
-  0x5A, 0x57, 0x62, 0x82, 0x9D, 0x96, 0x76, 0x67, 0x79, 0x98, 0xA6, 0xA2,
-  0xA6, 0xBB, 0xC1, 0x9B, 0x5C, 0x3B, 0x48, 0x5D, 0x5D, 0x5C, 0x71, 0x90,
-  0x9F, 0x8C, 0x6E, 0x6C, 0x87, 0xA1, 0xA7, 0xA3, 0xAC, 0xC1, 0xB9, 0x81,
-  0x48, 0x3B, 0x4D, 0x5A, 0x58, 0x5D, 0x79, 0x98, 0x9A, 0x7E, 0x66, 0x70,
-  0x8F, 0xA3, 0xA2, 0xA3, 0xB4, 0xC2, 0xA8, 0x68, 0x3B, 0x40, 0x57, 0x5B,
-  0x59, 0x68, 0x88, 0x9F, 0x93, 0x75, 0x69, 0x7D, 0x9B, 0xA7, 0xA1, 0xA6,
-  0xBC, 0xBD, 0x91, 0x53, 0x38, 0x48, 0x5A, 0x58, 0x58, 0x6F, 0x8F, 0x99,
-  0x82, 0x65, 0x66, 0x84, 0x9F, 0xA3, 0xA0, 0xAF, 0xC4, 0xB6, 0x7C, 0x46,
-  0x3D, 0x52, 0x5D, 0x59, 0x60, 0x7E, 0x9A, 0x98, 0x7A, 0x66, 0x74, 0x94,
-  0xA4, 0xA2, 0xA4, 0xB7, 0xC2, 0xA1, 0x5F, 0x38, 0x41, 0x55, 0x59, 0x58,
-  0x68, 0x8A, 0x9E, 0x8E, 0x6F, 0x67, 0x80, 0x9D, 0xA5, 0xA0, 0xA9, 0xBF,
-  0xBB, 0x89, 0x4E, 0x3A, 0x4D, 0x5C, 0x59, 0x5C, 0x76, 0x94, 0x9B, 0x83,
-  0x68, 0x6F, 0x8D, 0xA3, 0xA2, 0xA2, 0xB6, 0xC1, 0x9A, 0x59, 0x39, 0x48,
-  0x59, 0x59, 0x5C, 0x74, 0x94, 0x98, 0x7C, 0x65, 0x71, 0x91, 0xA3, 0xA1,
-  0xA5, 0xBB, 0xBF, 0x90, 0x50, 0x38, 0x49, 0x59, 0x58, 0x5E, 0x7B, 0x99,
-  0x98, 0x7B, 0x68, 0x7B, 0x9B, 0xA7, 0xA3, 0xAB, 0xC1, 0xBE, 0x8A, 0x4E,
-  0x3E, 0x52, 0x5D, 0x5A, 0x63, 0x82, 0x9D, 0x95, 0x74, 0x67, 0x7D, 0x9A,
-  0xA3, 0x9F, 0xA8, 0xBD, 0xB4, 0x7B, 0x43, 0x3D, 0x53, 0x5B, 0x5A, 0x69,
-  0x8B, 0xA0, 0x91, 0x72, 0x6A, 0x84, 0xA0, 0xA5, 0xA1, 0xAF, 0xC1, 0xAE,
-  0x70, 0x3E, 0x3D, 0x53, 0x59, 0x56, 0x67, 0x8A, 0x9C, 0x89, 0x6B, 0x69,
-  0x86, 0xA0, 0xA2, 0x9F, 0xB0, 0xC1, 0xA3, 0x63, 0x3A, 0x42, 0x56, 0x59,
-  0x58, 0x6D, 0x8F, 0x9B, 0x84, 0x69, 0x6E, 0x8D, 0xA3, 0xA2, 0xA1, 0xB5,
-  0xC1, 0x9E, 0x5C, 0x3B, 0x47, 0x5A, 0x5B, 0x5D, 0x74, 0x94, 0x9B, 0x80,
-  0x68, 0x73, 0x92, 0xA5, 0xA2, 0xA5, 0xBA, 0xC0, 0x94, 0x53, 0x39, 0x49,
-  0x59, 0x58, 0x5D, 0x7A, 0x98, 0x98, 0x7B, 0x66, 0x76, 0x96, 0xA5, 0xA2,
-  0xA8, 0xBE, 0xBE, 0x8C, 0x4E, 0x3D, 0x52, 0x5E, 0x5B, 0x64, 0x82, 0x9E,
-  0x97, 0x78, 0x69, 0x7F, 0x9D, 0xA5, 0xA1, 0xAA, 0xBF, 0xB8, 0x7F, 0x44,
-  0x3B, 0x50, 0x58, 0x54, 0x63, 0x84, 0x97, 0x84, 0x67, 0x68, 0x87, 0x9F,
-  0xA1, 0xA4, 0xBA, 0xC2, 0x95, 0x52, 0x3B, 0x4E, 0x5A, 0x56, 0x61, 0x82,
-  0x9A, 0x8D, 0x6D, 0x69, 0x86, 0xA0, 0xA2, 0xA1, 0xB4, 0xBE, 0x97, 0x54,
-  0x37, 0x49, 0x58, 0x55, 0x5F, 0x80, 0x9A, 0x90, 0x71, 0x68, 0x82, 0x9E,
-  0xA3, 0xA1, 0xB3, 0xC3, 0xA3, 0x61, 0x3D, 0x49, 0x5B, 0x5A, 0x5F, 0x7D,
-  0x9B, 0x97, 0x79, 0x6C, 0x82, 0x9F, 0xA6, 0xA1, 0xB1, 0xC3, 0xA8, 0x65,
-  0x3E, 0x48, 0x5B, 0x5A, 0x5D, 0x78, 0x98, 0x97, 0x79, 0x67, 0x7B, 0x9A,
-  0xA4, 0xA1, 0xAE, 0xC2, 0xAE, 0x6D, 0x3C, 0x40, 0x55, 0x58, 0x5A, 0x72,
-  0x94, 0x9A, 0x7D, 0x67, 0x79, 0x99, 0xA5, 0xA0, 0xAA, 0xC2, 0xB5, 0x76,
-  0x42, 0x44, 0x58, 0x5B, 0x5B, 0x70, 0x91, 0x9A, 0x80, 0x68, 0x74, 0x93,
-  0xA2, 0xA0, 0xA8, 0xBD, 0xB5, 0x7B, 0x41, 0x3A, 0x4E, 0x54, 0x53, 0x69,
-  0x8D, 0x9B, 0x84, 0x6B, 0x75, 0x96, 0xA8, 0xA3, 0xA7, 0xBE, 0xBE, 0x88,
-  0x4A, 0x3D, 0x52, 0x5A, 0x57, 0x67, 0x89, 0x9A, 0x87, 0x6A, 0x6D, 0x8D,
-  0xA3, 0xA2, 0xA5, 0xBB, 0xBE, 0x8D, 0x4C, 0x39, 0x4E, 0x5A, 0x57, 0x65,
-  0x86, 0x9C, 0x8C, 0x6D, 0x6B, 0x8A, 0xA2, 0xA3, 0xA3, 0xB7, 0xC1, 0x98,
-  0x56, 0x3D, 0x4F, 0x5B, 0x58, 0x60, 0x7B, 0x96, 0x97, 0x7E, 0x67, 0x6D,
-  0x88, 0x9E, 0xA0, 0x9C, 0xA7, 0xBA, 0xB3, 0x85, 0x4E, 0x3A, 0x4A, 0x5A,
-  0x59, 0x57, 0x69, 0x89, 0x9A, 0x8A, 0x6E, 0x65, 0x78, 0x95, 0xA2, 0x9D,
-  0x9F, 0xB2, 0xBB, 0x9D, 0x65, 0x3D, 0x40, 0x55, 0x5D, 0x5B, 0x64, 0x80,
-  0x9B, 0x9B, 0x82, 0x6D, 0x73, 0x8E, 0xA3, 0xA4, 0xA0, 0xAB, 0xBD, 0xB5,
-  0x86, 0x50, 0x3E, 0x4E, 0x5D, 0x5B, 0x5C, 0x6D, 0x8B, 0x9A, 0x88, 0x6B,
-  0x63, 0x79, 0x96, 0xA2, 0x9E, 0xA3, 0xB7, 0xC1, 0xA4, 0x69, 0x41, 0x45,
-  0x5A, 0x5E, 0x5A, 0x64, 0x7F, 0x98, 0x96, 0x7C, 0x67, 0x6E, 0x8A, 0x9F,
-  0xA0, 0x9E, 0xAA, 0xBC, 0xB2, 0x80, 0x48, 0x38, 0x4A, 0x59, 0x59, 0x5A,
-  0x6D, 0x8C, 0x9A, 0x89, 0x6F, 0x69, 0x7D, 0x98, 0xA3, 0x9F, 0xA2, 0xB5,
-  0xBD, 0x9D, 0x63, 0x40, 0x46, 0x5A, 0x5F, 0x5D, 0x67, 0x82, 0x9B, 0x97,
-  0x7D, 0x6A, 0x73, 0x8E, 0xA2, 0xA3, 0xA0, 0xAD, 0xBE, 0xB2, 0x7F, 0x4B,
-  0x3E, 0x51, 0x5E, 0x5B, 0x5C, 0x71, 0x8F, 0x9C, 0x8A, 0x6E, 0x68, 0x7F,
-  0x9B, 0xA3, 0x9F, 0xA5, 0xB7, 0xBD, 0x9C, 0x62, 0x3E, 0x46, 0x5B, 0x60,
-  0x5D, 0x68, 0x85, 0x9D, 0x98, 0x7E, 0x6D, 0x77, 0x92, 0xA5, 0xA4, 0xA1,
-  0xAF, 0xBF, 0xB1, 0x7E, 0x4A, 0x3D, 0x50, 0x5D, 0x59, 0x5A, 0x6B, 0x88,
-  0x98, 0x8B, 0x6E, 0x5F, 0x6F, 0x8E, 0xA0, 0xA0, 0x9F, 0xAC, 0xBF, 0xBA,
-  0x8B, 0x52, 0x3B, 0x48, 0x59, 0x5B, 0x59, 0x64, 0x80, 0x99, 0x98, 0x7F,
-  0x68, 0x6A, 0x84, 0x9D, 0xA3, 0x9D, 0xA1, 0xB5, 0xBD, 0xA0, 0x66, 0x3C,
-  0x3C, 0x51, 0x5C, 0x5A, 0x5E, 0x73, 0x91, 0x9E, 0x8D, 0x72, 0x6A, 0x7C,
-  0x97, 0xA4, 0xA1, 0xA0, 0xAF, 0xBF, 0xB3, 0x83, 0x4F, 0x3F, 0x50, 0x60,
-  0x61, 0x5F, 0x6C, 0x88, 0x9E, 0x98, 0x7D, 0x6B, 0x73, 0x8D, 0xA2, 0xA4,
-  0x9F, 0xA7, 0xBA, 0xBB, 0x96, 0x5E, 0x3C, 0x43, 0x57, 0x5D, 0x59, 0x60,
-  0x78, 0x94, 0x9A, 0x85, 0x6C, 0x68, 0x7E, 0x99, 0xA4, 0xA0, 0xA1, 0xB2,
-  0xBF, 0xAB, 0x75, 0x46, 0x40, 0x54, 0x61, 0x5F, 0x60, 0x71, 0x8E, 0x9F,
-  0x93, 0x78, 0x69, 0x75, 0x90, 0xA2, 0xA2, 0x9E, 0xA8, 0xBA, 0xB6, 0x8B,
-  0x52, 0x38, 0x44, 0x55, 0x57, 0x54, 0x5E, 0x7B, 0x97, 0x99, 0x82, 0x6E,
-  0x71, 0x89, 0xA1, 0xA6, 0xA0, 0xA4, 0xB7, 0xBE, 0xA4, 0x6C, 0x40, 0x3D,
-  0x51, 0x5C, 0x5A, 0x5D, 0x71, 0x8F, 0x9E, 0x8D, 0x71, 0x67, 0x77, 0x93,
-  0xA3, 0xA0, 0x9E, 0xAD, 0xBD, 0xB2, 0x83, 0x4D, 0x3A, 0x4B, 0x5C, 0x5D,
-  0x5C, 0x69, 0x84, 0x9B, 0x98, 0x7F, 0x6B, 0x71, 0x8A, 0xA0, 0xA4, 0x9E,
-  0xA4, 0xB6, 0xBF, 0xA9, 0x75, 0x46, 0x3C, 0x4F, 0x5E, 0x5E, 0x5C, 0x67,
-  0x81, 0x99, 0x9B, 0x83, 0x6B, 0x68, 0x7D, 0x98, 0xA3, 0x9F, 0x9E, 0xAC,
-  0xBD, 0xB5, 0x8A, 0x53, 0x37, 0x41, 0x55, 0x5B, 0x59, 0x5E, 0x73, 0x90,
-  0x9E, 0x8E, 0x73, 0x68, 0x75, 0x8F, 0xA4, 0xA6, 0xA1, 0xA9, 0xBB, 0xC1,
-  0xA5, 0x6F, 0x44, 0x41, 0x55, 0x61, 0x5E, 0x5E, 0x6B, 0x86, 0x9B, 0x97,
-  0x7E, 0x68, 0x68, 0x7F, 0x99, 0xA1, 0x9B, 0x9C, 0xAC, 0xBB, 0xB0, 0x83,
-  0x4F, 0x3D, 0x4D, 0x60, 0x63, 0x5E, 0x63, 0x7A, 0x96, 0x9D, 0x8A, 0x70,
-  0x66, 0x75, 0x91, 0xA3, 0xA2, 0x9E, 0xA8, 0xBA, 0xBC, 0x99, 0x60, 0x3A,
-  0x3C, 0x51, 0x5C, 0x59, 0x5B, 0x6B, 0x88, 0x9B, 0x94, 0x79, 0x66, 0x6B,
-  0x85, 0x9D, 0xA3, 0x9E, 0xA2, 0xB2, 0xBE, 0xAD, 0x7C, 0x4A, 0x3C, 0x4D,
-  0x5E, 0x60, 0x5C, 0x65, 0x7F, 0x99, 0x9C, 0x87, 0x6F, 0x6A, 0x7C, 0x96,
-  0xA4, 0xA3, 0xA0, 0xAB, 0xBD, 0xBA, 0x94, 0x5C, 0x3D, 0x44, 0x57, 0x5D,
-  0x5A, 0x5D, 0x70, 0x8D, 0x9D, 0x92, 0x77, 0x67, 0x6F, 0x8A, 0xA1, 0xA4,
-  0x9F, 0xA4, 0xB6, 0xBF, 0xA8, 0x73, 0x46, 0x3E, 0x50, 0x5F, 0x61, 0x5F,
-  0x6A, 0x85, 0x9D, 0x9C, 0x86, 0x6F, 0x6D, 0x81, 0x9A, 0xA5, 0x9F, 0x9E,
-  0xAB, 0xBA, 0xB6, 0x93, 0x5C, 0x37, 0x39, 0x4D, 0x57, 0x55, 0x53, 0x60,
-  0x7D, 0x97, 0x9B, 0x88, 0x71, 0x6A, 0x7A, 0x92, 0xA3, 0xA4, 0x9E, 0xA3,
-  0xB4, 0xBE, 0xAB, 0x7A, 0x48, 0x35, 0x43, 0x56, 0x5C, 0x59, 0x5C, 0x6F,
-  0x8B, 0x9C, 0x94, 0x7B, 0x67, 0x69, 0x80, 0x99, 0xA4, 0x9F, 0x9D, 0xAA,
-  0xBC, 0xBA, 0x9A, 0x65, 0x3E, 0x3D, 0x50, 0x5E, 0x5E, 0x5D, 0x68, 0x80,
-  0x99, 0x9F, 0x8E, 0x74, 0x69, 0x76, 0x8F, 0xA4, 0xA7, 0xA0, 0xA3, 0xB4,
-  0xC1, 0xB1, 0x84, 0x51, 0x3C, 0x47, 0x5A, 0x61, 0x5E, 0x5F, 0x70, 0x8B,
-  0x9E, 0x98, 0x7F, 0x68, 0x69, 0x7E, 0x98, 0xA5, 0xA2, 0x9D, 0xA8, 0xBA,
-  0xBC, 0x9E, 0x68, 0x3D, 0x39, 0x4D, 0x5C, 0x5D, 0x5C, 0x65, 0x7C, 0x96,
-  0xA1, 0x91, 0x76, 0x6A, 0x74, 0x8D, 0xA2, 0xA6, 0xA0, 0xA2, 0xB1, 0xBF,
-  0xB3, 0x88, 0x53, 0x38, 0x41, 0x55, 0x5D, 0x59, 0x59, 0x69, 0x84, 0x98,
-  0x94, 0x7C, 0x66, 0x66, 0x7A, 0x94, 0xA5, 0xA6, 0xA2, 0xAB, 0xBB, 0xBE,
-  0xA3, 0x70, 0x43, 0x39, 0x4B, 0x5B, 0x5D, 0x5A, 0x61, 0x77, 0x93, 0x9E,
-  0x90, 0x75, 0x66, 0x6F, 0x87, 0x9E, 0xA4, 0x9F, 0x9F, 0xAE, 0xBE, 0xB5,
-  0x8C, 0x57, 0x39, 0x3E, 0x52, 0x5D, 0x5C, 0x5C, 0x6A, 0x86, 0x9C, 0x9B,
-  0x85, 0x6D, 0x67, 0x77, 0x90, 0xA3, 0xA4, 0x9D, 0xA0, 0xB0, 0xBE, 0xB8,
-  0x92, 0x5D, 0x3C, 0x3C, 0x50, 0x5F, 0x60, 0x5C, 0x62, 0x77, 0x91, 0x9F,
-  0x96, 0x7D, 0x68, 0x68, 0x7B, 0x94, 0xA3, 0xA1, 0x9B, 0xA1, 0xB3, 0xBE,
-  0xB0, 0x84, 0x51, 0x36, 0x3C, 0x50, 0x5C, 0x5C, 0x5A, 0x63, 0x7B, 0x96,
-  0xA0, 0x94, 0x7B, 0x6B, 0x70, 0x85, 0x9E, 0xA9, 0xA5, 0xA0, 0xA8, 0xBA,
-  0xC1, 0xAD, 0x7F, 0x4D, 0x39, 0x44, 0x58, 0x5F, 0x5D, 0x5B, 0x66, 0x7E,
-  0x96, 0x9B, 0x88, 0x6D, 0x60, 0x6C, 0x86, 0x9C, 0xA5, 0xA3, 0xA2, 0xAE,
-  0xBF, 0xBF, 0xA3, 0x71, 0x45, 0x37, 0x46, 0x59, 0x5F, 0x5B, 0x5C, 0x6C,
-  0x87, 0x9B, 0x9B, 0x87, 0x6E, 0x65, 0x72, 0x8C, 0xA0, 0xA5, 0x9F, 0x9E,
-  0xAC, 0xBC, 0xB9, 0x98, 0x64, 0x3C, 0x36, 0x4A, 0x5B, 0x5E, 0x5B, 0x5F,
-  0x71, 0x8B, 0x9E, 0x9A, 0x82, 0x6B, 0x68, 0x7A, 0x93, 0xA4, 0xA5, 0x9F,
-  0xA2, 0xB1, 0xBF, 0xB7, 0x91, 0x5D, 0x3C, 0x3E, 0x52, 0x60, 0x60, 0x5D,
-  0x64, 0x7A, 0x93, 0xA0, 0x97, 0x7D, 0x68, 0x68, 0x7D, 0x97, 0xA5, 0xA3,
-  0x9E, 0xA4, 0xB5, 0xBF, 0xAF, 0x84, 0x51, 0x36, 0x3D, 0x51, 0x5D, 0x5D,
-  0x5C, 0x67, 0x7F, 0x97, 0xA0, 0x95, 0x7B, 0x6A, 0x70, 0x86, 0x9E, 0xA9,
-  0xA4, 0x9F, 0xA9, 0xB9, 0xC0, 0xAD, 0x80, 0x51, 0x37, 0x3B, 0x50, 0x5D,
-  0x5A, 0x57, 0x5C, 0x6C, 0x86, 0x98, 0x94, 0x82, 0x6D, 0x62, 0x6E, 0x88,
-  0x9F, 0xAA, 0xA4, 0x9E, 0xA5, 0xB5, 0xBE, 0xB0, 0x84, 0x53, 0x37, 0x37,
-  0x4A, 0x5B, 0x5D, 0x59, 0x5D, 0x6C, 0x86, 0x9C, 0x9D, 0x8A, 0x71, 0x63,
-  0x6C, 0x82, 0x98, 0xA5, 0xA2, 0x9B, 0xA3, 0xB4, 0xBE, 0xB6, 0x92, 0x5E,
-  0x3C, 0x3A, 0x4C, 0x5E, 0x61, 0x5D, 0x60, 0x6D, 0x86, 0x9D, 0xA1, 0x92,
-  0x7A, 0x68, 0x6D, 0x83, 0x99, 0xA7, 0xA7, 0x9F, 0xA3, 0xB2, 0xBE, 0xBA,
-  0x98, 0x65, 0x41, 0x3A, 0x48, 0x5B, 0x61, 0x5D, 0x5D, 0x67, 0x7D, 0x97,
-  0x9F, 0x92, 0x7A, 0x66, 0x66, 0x7A, 0x92, 0xA3, 0xA6, 0x9E, 0x9F, 0xAF,
-  0xBC, 0xBC, 0xA1, 0x6D, 0x44, 0x39, 0x44, 0x59, 0x63, 0x5F, 0x5E, 0x68,
-  0x7D, 0x97, 0xA3, 0x98, 0x81, 0x6C, 0x68, 0x7A, 0x91, 0xA1, 0xA6, 0x9E,
-  0x9B, 0xA9, 0xB8, 0xB8, 0xA1, 0x73, 0x44, 0x2F, 0x37, 0x4D, 0x5C, 0x5B,
-  0x5A, 0x62, 0x78, 0x95, 0xA5, 0x9D, 0x85, 0x6D, 0x66, 0x75, 0x8D, 0xA0,
-  0xA7, 0xA1, 0x9D, 0xA9, 0xB9, 0xBE, 0xAD, 0x7E, 0x4D, 0x35, 0x3A, 0x4E,
-  0x5D, 0x5D, 0x59, 0x5F, 0x72, 0x8C, 0x9F, 0x9B, 0x86, 0x6F, 0x63, 0x6F,
-  0x89, 0x9D, 0xA6, 0xA2, 0x9C, 0xA5, 0xB7, 0xBE, 0xAC, 0x80, 0x4F, 0x39,
-  0x43, 0x55, 0x5F, 0x5E, 0x5D, 0x69, 0x81, 0x98, 0x9F, 0x8F, 0x75, 0x67,
-  0x6E, 0x85, 0x9D, 0xA6, 0xA1, 0x9E, 0xA8, 0xB9, 0xBE, 0xA4, 0x72, 0x43,
-  0x34, 0x43, 0x57, 0x5D, 0x59, 0x5B, 0x69, 0x83, 0x9B, 0x9C, 0x88, 0x6E,
-  0x65, 0x71, 0x8A, 0x9F, 0xA5, 0x9F, 0x9F, 0xAD, 0xBE, 0xBC, 0x9E, 0x6C,
-  0x44, 0x3D, 0x4E, 0x5F, 0x62, 0x5F, 0x62, 0x74, 0x8D, 0x9F, 0x9B, 0x85,
-  0x6E, 0x68, 0x77, 0x8F, 0xA2, 0xA3, 0x9B, 0x9D, 0xAC, 0xBA, 0xB3, 0x8E,
-  0x5A, 0x39, 0x3A, 0x4E, 0x5F, 0x63, 0x61, 0x67, 0x7A, 0x92, 0xA1, 0x99,
-  0x7F, 0x68, 0x68, 0x7C, 0x96, 0xA5, 0xA3, 0x9D, 0xA2, 0xB4, 0xBF, 0xB1,
-  0x85, 0x51, 0x35, 0x3B, 0x50, 0x5C, 0x5B, 0x58, 0x62, 0x79, 0x93, 0x9D,
-  0x90, 0x76, 0x65, 0x6A, 0x80, 0x98, 0xA5, 0xA2, 0x9D, 0xA5, 0xB6, 0xBE,
-  0xAB, 0x7D, 0x4D, 0x38, 0x44, 0x58, 0x61, 0x5F, 0x5E, 0x6A, 0x82, 0x99,
-  0xA0, 0x8F, 0x75, 0x68, 0x72, 0x89, 0x9F, 0xA7, 0xA2, 0x9F, 0xAA, 0xBB,
-  0xBF, 0xA4, 0x70, 0x42, 0x36, 0x46, 0x58, 0x5E, 0x5A, 0x5B, 0x6C, 0x87,
-  0x9D, 0x9D, 0x88, 0x6E, 0x66, 0x74, 0x8D, 0xA1, 0xA6, 0xA1, 0xA1, 0xAF,
-  0xBF, 0xBC, 0x9C, 0x69, 0x43, 0x3D, 0x4E, 0x5E, 0x61, 0x5E, 0x64, 0x78,
-  0x92, 0x9F, 0x93, 0x77, 0x66, 0x6C, 0x83, 0x9A, 0xA0, 0x9B, 0x9A, 0xA8,
-  0xB7, 0xB1, 0x8A, 0x56, 0x38, 0x3D, 0x52, 0x5F, 0x60, 0x60, 0x6C, 0x83,
-  0x99, 0x9C, 0x86, 0x6D, 0x66, 0x76, 0x90, 0xA1, 0xA2, 0x9C, 0xA3, 0xB4,
-  0xBD, 0xA9, 0x77, 0x45, 0x35, 0x44, 0x57, 0x5C, 0x58, 0x5D, 0x71, 0x8E,
-  0x9E, 0x94, 0x7B, 0x67, 0x6B, 0x82, 0x9C, 0xA6, 0xA0, 0x9F, 0xAC, 0xBD,
-  0xBA, 0x96, 0x62, 0x3E, 0x3F, 0x53, 0x60, 0x5F, 0x5D, 0x69, 0x82, 0x9A,
-  0x9F, 0x8C, 0x72, 0x69, 0x78, 0x92, 0xA4, 0xA6, 0x9F, 0xA3, 0xB4, 0xC0,
-  0xAE, 0x7F, 0x4E, 0x3A, 0x45, 0x57, 0x5E, 0x5B, 0x5D, 0x6F, 0x8B, 0x9E,
-  0x97, 0x7D, 0x68, 0x6A, 0x80, 0x99, 0xA5, 0xA1, 0x9D, 0xAA, 0xBB, 0xBC,
-  0x9D, 0x67, 0x3F, 0x3E, 0x52, 0x5F, 0x60, 0x5E, 0x67, 0x7F, 0x99, 0xA0,
-  0x8E, 0x74, 0x67, 0x73, 0x8D, 0xA0, 0xA3, 0x9D, 0x9F, 0xB0, 0xBB, 0xAC,
-  0x7F, 0x4C, 0x32, 0x3B, 0x4F, 0x59, 0x59, 0x5C, 0x6D, 0x8A, 0x9F, 0x9D,
-  0x85, 0x6F, 0x6C, 0x7F, 0x99, 0xA5, 0xA2, 0x9E, 0xA8, 0xBA, 0xBD, 0xA0,
-  0x6B, 0x40, 0x38, 0x4B, 0x5B, 0x5C, 0x59, 0x61, 0x7A, 0x94, 0x9E, 0x8F,
-  0x74, 0x65, 0x6E, 0x88, 0x9F, 0xA4, 0x9E, 0xA0, 0xB0, 0xBE, 0xB3, 0x88,
-  0x53, 0x3B, 0x47, 0x5A, 0x5E, 0x5B, 0x61, 0x76, 0x93, 0x9D, 0x8C, 0x72,
-  0x68, 0x76, 0x90, 0xA2, 0xA2, 0x9E, 0xA7, 0xB9, 0xBC, 0x9F, 0x69, 0x40,
-  0x3E, 0x53, 0x5E, 0x5B, 0x5C, 0x6B, 0x87, 0x9B, 0x95, 0x7B, 0x66, 0x69,
-  0x81, 0x9B, 0xA3, 0x9E, 0xA0, 0xB1, 0xBF, 0xB0, 0x7E, 0x4A, 0x38, 0x48,
-  0x59, 0x5D, 0x5C, 0x64, 0x7C, 0x98, 0xA0, 0x8C, 0x72, 0x6B, 0x7C, 0x96,
-  0xA6, 0xA4, 0xA1, 0xAC, 0xBD, 0xBB, 0x98, 0x61, 0x3E, 0x42, 0x55, 0x5E,
-  0x5A, 0x5B, 0x6C, 0x89, 0x99, 0x8E, 0x72, 0x61, 0x6A, 0x87, 0x9E, 0xA4,
-  0xA1, 0xA7, 0xB9, 0xC3, 0xAD, 0x79, 0x48, 0x3C, 0x4D, 0x5C, 0x5D, 0x5B,
-  0x65, 0x7F, 0x99, 0x9A, 0x83, 0x6A, 0x67, 0x7B, 0x96, 0xA3, 0xA0, 0x9E,
-  0xAB, 0xBC, 0xB7, 0x8D, 0x55, 0x37, 0x40, 0x55, 0x5C, 0x59, 0x5D, 0x72,
-  0x8F, 0x9D, 0x8F, 0x75, 0x68, 0x72, 0x8D, 0xA1, 0xA3, 0x9E, 0xA6, 0xB7,
-  0xBE, 0xA4, 0x70, 0x44, 0x3F, 0x52, 0x5F, 0x5F, 0x5E, 0x6A, 0x85, 0x9C,
-  0x9A, 0x82, 0x6C, 0x6C, 0x82, 0x9B, 0xA5, 0xA1, 0xA0, 0xAE, 0xBD, 0xB3,
-  0x86, 0x4F, 0x37, 0x45, 0x59, 0x5D, 0x5A, 0x60, 0x77, 0x93, 0x9E, 0x8D,
-  0x73, 0x67, 0x75, 0x91, 0xA4, 0xA4, 0x9F, 0xA8, 0xBB, 0xBF, 0x9F, 0x69,
-  0x43, 0x43, 0x56, 0x60, 0x5E, 0x62, 0x76, 0x93, 0x9E, 0x8D, 0x71, 0x67,
-  0x77, 0x93, 0xA1, 0x9C, 0x99, 0xA8, 0xB8, 0xAB, 0x7A, 0x44, 0x33, 0x47,
-  0x59, 0x5A, 0x5B, 0x6B, 0x88, 0x9F, 0x99, 0x7C, 0x69, 0x70, 0x89, 0x9F,
-  0xA2, 0x9C, 0xA4, 0xB7, 0xBA, 0x96, 0x5D, 0x3A, 0x40, 0x55, 0x5C, 0x59,
-  0x5E, 0x76, 0x93, 0x9B, 0x86, 0x6C, 0x68, 0x7D, 0x98, 0xA3, 0x9F, 0xA0,
-  0xB1, 0xBE, 0xAA, 0x76, 0x47, 0x3F, 0x52, 0x5F, 0x5E, 0x5E, 0x6F, 0x8B,
-  0x9D, 0x93, 0x78, 0x6A, 0x76, 0x91, 0xA4, 0xA4, 0xA0, 0xAB, 0xBD, 0xB9,
-  0x8F, 0x57, 0x3E, 0x4B, 0x5C, 0x5F, 0x5D, 0x66, 0x7F, 0x99, 0x9B, 0x82,
-  0x69, 0x69, 0x82, 0x9D, 0xA4, 0x9F, 0xA3, 0xB6, 0xBE, 0xA3, 0x6A, 0x3E,
-  0x3C, 0x51, 0x5C, 0x5A, 0x5D, 0x71, 0x90, 0x9F, 0x8F, 0x73, 0x69, 0x7A,
-  0x96, 0xA5, 0xA3, 0xA1, 0xAF, 0xBF, 0xB6, 0x87, 0x51, 0x3D, 0x4C, 0x5B,
-  0x5D, 0x5B, 0x66, 0x81, 0x99, 0x95, 0x79, 0x65, 0x6B, 0x84, 0x99, 0x9D,
-  0x98, 0xA1, 0xB6, 0xBA, 0x9A, 0x65, 0x43, 0x48, 0x5C, 0x61, 0x5C, 0x61,
-  0x78, 0x93, 0x9C, 0x89, 0x6F, 0x69, 0x7D, 0x98, 0xA3, 0x9F, 0xA0, 0xB0,
-  0xBE, 0xAC, 0x78, 0x45, 0x3A, 0x4D, 0x5B, 0x5B, 0x5B, 0x6A, 0x87, 0x9A,
-  0x91, 0x77, 0x66, 0x72, 0x8F, 0xA2, 0xA0, 0x9F, 0xAE, 0xBE, 0xAF, 0x7B,
-  0x4A, 0x40, 0x52, 0x5E, 0x5C, 0x5F, 0x74, 0x92, 0x9B, 0x88, 0x6E, 0x6B,
-  0x82, 0x9C, 0xA3, 0x9E, 0xA5, 0xB7, 0xBA, 0x96, 0x5D, 0x3E, 0x48, 0x5A,
-  0x5D, 0x5A, 0x66, 0x83, 0x9A, 0x93, 0x77, 0x65, 0x73, 0x90, 0xA1, 0x9F,
-  0x9E, 0xAE, 0xBE, 0xAD, 0x76, 0x44, 0x3D, 0x51, 0x5C, 0x5B, 0x61, 0x77,
-  0x96, 0x9F, 0x8A, 0x71, 0x70, 0x88, 0xA0, 0xA6, 0xA1, 0xA8, 0xBB, 0xBC,
-  0x95, 0x5C, 0x3F, 0x4A, 0x5B, 0x5D, 0x5B, 0x69, 0x84, 0x98, 0x90, 0x73,
-  0x62, 0x6F, 0x8D, 0x9E, 0x9D, 0x9E, 0xAF, 0xBE, 0xAD, 0x78, 0x49, 0x43,
-  0x55, 0x5E, 0x5C, 0x60, 0x76, 0x94, 0x9B, 0x84, 0x69, 0x6A, 0x84, 0x9D,
-  0xA2, 0x9D, 0xA5, 0xB9, 0xB8, 0x8E, 0x55, 0x3A, 0x46, 0x58, 0x5A, 0x58,
-  0x67, 0x85, 0x9A, 0x91, 0x74, 0x66, 0x76, 0x93, 0xA2, 0x9F, 0x9F, 0xB0,
-  0xBD, 0xA7, 0x71, 0x45, 0x42, 0x55, 0x5F, 0x5D, 0x62, 0x7A, 0x96, 0x9C,
-  0x86, 0x6D, 0x6E, 0x88, 0xA0, 0xA4, 0x9F, 0xA7, 0xBB, 0xBA, 0x90, 0x57,
-  0x3E, 0x4C, 0x5C, 0x5E, 0x5C, 0x6A, 0x88, 0x9C, 0x90, 0x73, 0x67, 0x78,
-  0x95, 0xA3, 0xA0, 0xA0, 0xB2, 0xBF, 0xA7, 0x6E, 0x41, 0x40, 0x55, 0x5E,
-  0x5C, 0x64, 0x7C, 0x97, 0x9D, 0x85, 0x6D, 0x74, 0x90, 0xA4, 0xA4, 0xA2,
-  0xB0, 0xBF, 0xAA, 0x71, 0x45, 0x43, 0x56, 0x5C, 0x59, 0x64, 0x80, 0x95,
-  0x8E, 0x73, 0x62, 0x72, 0x8F, 0x9B, 0x99, 0x9F, 0xB3, 0xB9, 0x96, 0x5D,
-  0x42, 0x4E, 0x5D, 0x5C, 0x5C, 0x6E, 0x8C, 0x9A, 0x88, 0x6C, 0x69, 0x82,
-  0x9C, 0xA1, 0x9C, 0xA8, 0xBC, 0xB2, 0x7E, 0x48, 0x3B, 0x4F, 0x5B, 0x58,
-  0x5F, 0x79, 0x94, 0x97, 0x7D, 0x67, 0x73, 0x8F, 0xA1, 0xA1, 0xA1, 0xB0,
-  0xBE, 0xA4, 0x6A, 0x42, 0x47, 0x5A, 0x5F, 0x5D, 0x6B, 0x89, 0x9C, 0x91,
-  0x76, 0x6B, 0x7F, 0x9B, 0xA4, 0xA0, 0xA7, 0xBA, 0xBB, 0x91, 0x58, 0x40,
-  0x4E, 0x5D, 0x5E, 0x5F, 0x73, 0x92, 0x9C, 0x85, 0x6B, 0x6C, 0x87, 0x9F,
-  0xA1, 0x9D, 0xAB, 0xBD, 0xAE, 0x77, 0x44, 0x3E, 0x53, 0x5D, 0x59, 0x62,
-  0x7E, 0x97, 0x96, 0x7B, 0x6A, 0x77, 0x95, 0xA4, 0xA2, 0xA3, 0xB5, 0xBF,
-  0x9E, 0x64, 0x42, 0x4A, 0x5B, 0x5F, 0x5D, 0x6C, 0x8A, 0x9A, 0x8B, 0x6F,
-  0x68, 0x7E, 0x97, 0x9E, 0x9A, 0xA2, 0xB5, 0xB1, 0x82, 0x4C, 0x3C, 0x4E,
-  0x5D, 0x5E, 0x63, 0x7B, 0x98, 0x9B, 0x82, 0x6B, 0x71, 0x8B, 0xA1, 0xA1,
-  0x9F, 0xAE, 0xBE, 0xA9, 0x70, 0x42, 0x40, 0x56, 0x5C, 0x59, 0x65, 0x82,
-  0x99, 0x92, 0x76, 0x67, 0x78, 0x95, 0xA1, 0x9C, 0x9B, 0xAA, 0xB7, 0xAC,
-  0x83, 0x50, 0x3A, 0x47, 0x59, 0x5C, 0x5A, 0x61, 0x75, 0x8F, 0x99, 0x88,
-  0x6F, 0x66, 0x74, 0x8D, 0x9E, 0x9E, 0x9A, 0xA3, 0xB4, 0xB6, 0x98, 0x65,
-  0x40, 0x40, 0x53, 0x5D, 0x5B, 0x5C, 0x6B, 0x85, 0x99, 0x92, 0x78, 0x66,
-  0x6B, 0x82, 0x99, 0xA0, 0x9B, 0x9E, 0xAE, 0xBA, 0xAB, 0x7C, 0x4B, 0x3B,
-  0x4A, 0x5A, 0x5C, 0x5A, 0x63, 0x7B, 0x96, 0x9B, 0x88, 0x72, 0x6C, 0x7C,
-  0x96, 0xA4, 0xA2, 0x9F, 0xAB, 0xBB, 0xB8, 0x96, 0x62, 0x41, 0x45, 0x58,
-  0x5F, 0x5C, 0x5F, 0x6F, 0x89, 0x99, 0x8F, 0x74, 0x63, 0x6B, 0x84, 0x9B,
-  0xA0, 0x9C, 0xA1, 0xB4, 0xBE, 0xAB, 0x7A, 0x4C, 0x40, 0x51, 0x5F, 0x5F,
-  0x5D, 0x67, 0x80, 0x98, 0x99, 0x83, 0x6B, 0x68, 0x7C, 0x97, 0xA2, 0x9F,
-  0x9E, 0xAC, 0xBB, 0xB5, 0x8C, 0x58, 0x3C, 0x45, 0x58, 0x5E, 0x5B, 0x5F,
-  0x72, 0x8E, 0x9B, 0x8E, 0x74, 0x67, 0x73, 0x8C, 0x9F, 0xA1, 0x9D, 0xA5,
-  0xB5, 0xBB, 0xA2, 0x6F, 0x46, 0x42, 0x55, 0x61, 0x5F, 0x5F, 0x6C, 0x86,
-  0x9B, 0x98, 0x81, 0x6D, 0x6D, 0x83, 0x9B, 0xA4, 0x9F, 0xA0, 0xAF, 0xBC,
-  0xB1, 0x85, 0x52, 0x3D, 0x4A, 0x5B, 0x5F, 0x5C, 0x62, 0x78, 0x94, 0x9C,
-  0x8B, 0x73, 0x69, 0x77, 0x92, 0xA2, 0xA1, 0x9E, 0xA7, 0xB8, 0xBC, 0xA2,
-  0x70, 0x48, 0x42, 0x53, 0x62, 0x63, 0x60, 0x67, 0x7D, 0x95, 0x9E, 0x8F,
-  0x76, 0x69, 0x71, 0x88, 0x9C, 0xA1, 0x9A, 0x9B, 0xAA, 0xB7, 0xAD, 0x85,
-  0x52, 0x37, 0x40, 0x55, 0x5E, 0x5D, 0x5F, 0x6E, 0x88, 0x9C, 0x9A, 0x84,
-  0x6E, 0x6A, 0x7A, 0x93, 0xA2, 0xA0, 0x9B, 0xA4, 0xB5, 0xBB, 0xA4, 0x72,
-  0x45, 0x3A, 0x4A, 0x5A, 0x5E, 0x5B, 0x61, 0x76, 0x91, 0x9D, 0x91, 0x78,
-  0x68, 0x70, 0x87, 0x9C, 0xA4, 0xA0, 0x9F, 0xAD, 0xBC, 0xB5, 0x90, 0x5E,
-  0x40, 0x45, 0x58, 0x61, 0x61, 0x61, 0x6D, 0x85, 0x9B, 0x9C, 0x89, 0x72,
-  0x6C, 0x7B, 0x93, 0xA3, 0xA3, 0x9E, 0xA5, 0xB5, 0xBC, 0xA8, 0x7A, 0x4C,
-  0x3E, 0x4C, 0x5C, 0x5F, 0x5C, 0x60, 0x74, 0x8E, 0x9D, 0x93, 0x7A, 0x68,
-  0x6C, 0x83, 0x9A, 0xA4, 0x9F, 0x9E, 0xAB, 0xBB, 0xB7, 0x94, 0x61, 0x41,
-  0x42, 0x55, 0x61, 0x61, 0x5F, 0x6A, 0x83, 0x99, 0x9D, 0x8A, 0x72, 0x6A,
-  0x78, 0x90, 0xA1, 0xA2, 0x9C, 0xA0, 0xB1, 0xBA, 0xA9, 0x7B, 0x4C, 0x3A,
-  0x45, 0x56, 0x5B, 0x57, 0x5B, 0x6F, 0x8A, 0x9C, 0x97, 0x81, 0x6F, 0x71,
-  0x84, 0x9A, 0xA4, 0xA0, 0x9D, 0xA9, 0xB9, 0xB9, 0x9A, 0x66, 0x40, 0x3E,
-  0x50, 0x5D, 0x5E, 0x5C, 0x66, 0x7E, 0x96, 0x9C, 0x8B, 0x71, 0x67, 0x73,
-  0x8B, 0x9E, 0xA3, 0x9D, 0x9D, 0xAA, 0xB9, 0xB9, 0x9B, 0x69, 0x43, 0x3E,
-  0x4E, 0x5D, 0x61, 0x5D, 0x61, 0x72, 0x8C, 0x9C, 0x99, 0x83, 0x6D, 0x69,
-  0x78, 0x90, 0xA1, 0xA3, 0x9D, 0x9F, 0xAE, 0xBB, 0xB3, 0x90, 0x5F, 0x3F,
-  0x3F, 0x50, 0x5D, 0x5F, 0x5C, 0x62, 0x75, 0x8E, 0x9C, 0x94, 0x7C, 0x68,
-  0x67, 0x7A, 0x93, 0xA2, 0xA1, 0x9B, 0xA1, 0xB2, 0xBC, 0xAF, 0x85, 0x54,
-  0x3B, 0x43, 0x56, 0x61, 0x62, 0x61, 0x69, 0x7E, 0x96, 0xA1, 0x93, 0x7A,
-  0x6B, 0x70, 0x85, 0x9B, 0xA5, 0xA1, 0x9D, 0xA5, 0xB5, 0xBC, 0xA8, 0x7A,
-  0x4C, 0x39, 0x43, 0x54, 0x5B, 0x58, 0x59, 0x67, 0x81, 0x96, 0x9C, 0x8F,
-  0x78, 0x6D, 0x74, 0x89, 0x9E, 0xA6, 0xA0, 0x9D, 0xA8, 0xB8, 0xBA, 0xA1,
-  0x71, 0x46, 0x39, 0x47, 0x59, 0x5F, 0x5C, 0x5D, 0x6C, 0x86, 0x9A, 0x9B,
-  0x86, 0x6E, 0x66, 0x73, 0x8B, 0x9E, 0xA2, 0x9C, 0x9C, 0xAB, 0xBA, 0xB6,
-  0x96, 0x65, 0x42, 0x3D, 0x4E, 0x5E, 0x61, 0x5E, 0x62, 0x73, 0x8C, 0x9D,
-  0x98, 0x83, 0x6E, 0x6B, 0x7A, 0x92, 0xA2, 0xA4, 0x9E, 0xA1, 0xB1, 0xBD,
-  0xB4, 0x8F, 0x5E, 0x3F, 0x40, 0x53, 0x60, 0x60, 0x5C, 0x62, 0x77, 0x90,
-  0x9E, 0x95, 0x7C, 0x69, 0x6B, 0x7E, 0x96, 0xA4, 0xA1, 0x9C, 0xA2, 0xB2,
-  0xBD, 0xB0, 0x86, 0x58, 0x3F, 0x3F, 0x52, 0x61, 0x63, 0x60, 0x64, 0x73,
-  0x8C, 0x9F, 0x9F, 0x8E, 0x76, 0x68, 0x71, 0x86, 0x99, 0xA4, 0xA0, 0x99,
-  0xA0, 0xAF, 0xB7, 0xAE, 0x8C, 0x5B, 0x39, 0x34, 0x45, 0x58, 0x5D, 0x5A,
-  0x5D, 0x6B, 0x85, 0x9C, 0x9F, 0x8E, 0x77, 0x67, 0x6C, 0x80, 0x95, 0xA2,
-  0xA1, 0x99, 0x9E, 0xAD, 0xBA, 0xB5, 0x94, 0x62, 0x3F, 0x38, 0x46, 0x59,
-  0x5F, 0x5B, 0x5D, 0x69, 0x7F, 0x97, 0x9E, 0x91, 0x7B, 0x68, 0x6A, 0x7E,
-  0x93, 0xA2, 0xA5, 0x9D, 0x9F, 0xAE, 0xBA, 0xBA, 0xA0, 0x70, 0x48, 0x3D,
-  0x49, 0x5C, 0x63, 0x60, 0x60, 0x69, 0x7D, 0x96, 0xA0, 0x95, 0x81, 0x6D,
-  0x6A, 0x7C, 0x92, 0xA1, 0xA6, 0x9F, 0x9D, 0xAA, 0xB9, 0xBB, 0xA3, 0x73,
-  0x49, 0x39, 0x42, 0x55, 0x60, 0x5D, 0x5C, 0x64, 0x76, 0x8F, 0x9E, 0x97,
-  0x82, 0x6D, 0x67, 0x76, 0x8C, 0x9E, 0xA6, 0x9F, 0x9C, 0xA9, 0xB8, 0xBD,
-  0xAC, 0x81, 0x53, 0x3E, 0x43, 0x56, 0x63, 0x61, 0x5E, 0x63, 0x74, 0x8D,
-  0x9D, 0x98, 0x85, 0x6F, 0x65, 0x70, 0x86, 0x99, 0xA1, 0x9C, 0x96, 0xA0,
-  0xB1, 0xBA, 0xAC, 0x84, 0x58, 0x41, 0x42, 0x53, 0x62, 0x61, 0x5E, 0x62,
-  0x6F, 0x87, 0x9D, 0x9C, 0x89, 0x73, 0x65, 0x6E, 0x84, 0x99, 0xA4, 0xA2,
-  0x9B, 0xA3, 0xB3, 0xBB, 0xB4, 0x93, 0x61, 0x3F, 0x38, 0x43, 0x57, 0x62,
-  0x5D, 0x5C, 0x64, 0x72, 0x8B, 0x9E, 0x9C, 0x8C, 0x77, 0x66, 0x6B, 0x80,
-  0x93, 0xA1, 0xA5, 0x9D, 0x9C, 0xA8, 0xB5, 0xBA, 0xAD, 0x85, 0x57, 0x3E,
-  0x3C, 0x4B, 0x5D, 0x62, 0x5E, 0x5F, 0x67, 0x79, 0x92, 0x9F, 0x98, 0x85,
-  0x70, 0x63, 0x6E, 0x85, 0x97, 0xA3, 0xA3, 0x9B, 0x9E, 0xAD, 0xB8, 0xB9,
-  0xA5, 0x76, 0x4A, 0x38, 0x3D, 0x4F, 0x5F, 0x5F, 0x5D, 0x62, 0x6D, 0x82,
-  0x9B, 0xA3, 0x97, 0x83, 0x6F, 0x69, 0x79, 0x8E, 0x9F, 0xA8, 0xA3, 0x9C,
-  0xA3, 0xB1, 0xBA, 0xB6, 0x99, 0x69, 0x45, 0x39, 0x41, 0x54, 0x5F, 0x5A,
-  0x57, 0x5F, 0x6D, 0x86, 0x9C, 0x9D, 0x8F, 0x7C, 0x6C, 0x6D, 0x80, 0x93,
-  0xA1, 0xA7, 0x9F, 0x9B, 0xA7, 0xB6, 0xBB, 0xB2, 0x8C, 0x5B, 0x3D, 0x39,
-  0x46, 0x59, 0x60, 0x5B, 0x5C, 0x64, 0x76, 0x8F, 0x9F, 0x99, 0x88, 0x72,
-  0x63, 0x6C, 0x82, 0x95, 0xA2, 0xA4, 0x9B, 0x9B, 0xAA, 0xB7, 0xBA, 0xA9,
-  0x7E, 0x51, 0x3C, 0x3E, 0x4E, 0x5F, 0x62, 0x5D, 0x60, 0x6B, 0x7F, 0x97,
-  0x9F, 0x95, 0x84, 0x6F, 0x66, 0x74, 0x8A, 0x9B, 0xA6, 0xA4, 0x9B, 0xA1,
-  0xB0, 0xBB, 0xB9, 0x9D, 0x6E, 0x47, 0x39, 0x40, 0x53, 0x60, 0x5F, 0x5C,
-  0x61, 0x6E, 0x85, 0x9C, 0x9F, 0x91, 0x7D, 0x6A, 0x65, 0x75, 0x8B, 0x9C,
-  0xA7, 0xA6, 0x9E, 0x9F, 0xAC, 0xB9, 0xBC, 0xB2, 0x8D, 0x60, 0x43, 0x3B,
-  0x45, 0x58, 0x63, 0x60, 0x5C, 0x60, 0x6A, 0x7E, 0x95, 0x9E, 0x94, 0x82,
-  0x6E, 0x60, 0x66, 0x7A, 0x8E, 0x9D, 0xA3, 0x9D, 0x98, 0xA3, 0xB4, 0xBB,
-  0xB8, 0x9F, 0x70, 0x49, 0x39, 0x3B, 0x4C, 0x5E, 0x60, 0x5B, 0x5C, 0x64,
-  0x74, 0x8C, 0x9E, 0x9E, 0x8E, 0x79, 0x67, 0x65, 0x75, 0x8B, 0x9B, 0xA5,
-  0xA3, 0x9A, 0x9C, 0xAC, 0xB8, 0xBA, 0xAD, 0x86, 0x58, 0x3F, 0x3A, 0x45,
-  0x5A, 0x63, 0x60, 0x5E, 0x63, 0x6F, 0x84, 0x9A, 0xA2, 0x97, 0x85, 0x71,
-  0x67, 0x71, 0x86, 0x97, 0xA4, 0xA8, 0xA0, 0x9B, 0xA7, 0xB5, 0xBC, 0xB7,
-  0x9B, 0x6C, 0x48, 0x3A, 0x3F, 0x51, 0x61, 0x60, 0x5C, 0x5E, 0x66, 0x78,
-  0x90, 0x9F, 0x9C, 0x8B, 0x77, 0x66, 0x66, 0x79, 0x8E, 0x9D, 0xA6, 0xA3,
-  0x9A, 0x9F, 0xAF, 0xB9, 0xBA, 0xAA, 0x81, 0x55, 0x3E, 0x3C, 0x49, 0x5D,
-  0x64, 0x60, 0x5F, 0x64, 0x70, 0x86, 0x9B, 0xA0, 0x93, 0x7F, 0x6C, 0x64,
-  0x6E, 0x83, 0x95, 0xA0, 0xA2, 0x99, 0x96, 0xA4, 0xB3, 0xB9, 0xB3, 0x95,
-  0x68, 0x47, 0x3D, 0x43, 0x54, 0x62, 0x62, 0x5D, 0x5F, 0x68, 0x7B, 0x93,
-  0xA0, 0x9B, 0x89, 0x75, 0x65, 0x68, 0x7C, 0x91, 0xA0, 0xA6, 0x9F, 0x9A,
-  0xA5, 0xB4, 0xBA, 0xB2, 0x8E, 0x5E, 0x3F, 0x39, 0x45, 0x59, 0x61, 0x5D,
-  0x5D, 0x65, 0x74, 0x8D, 0x9F, 0x9A, 0x89, 0x75, 0x66, 0x6D, 0x83, 0x95,
-  0xA2, 0xA4, 0x9C, 0x9B, 0xAA, 0xB6, 0xBA, 0xAA, 0x81, 0x54, 0x3C, 0x3C,
-  0x4D, 0x5F, 0x61, 0x5D, 0x5F, 0x68, 0x7A, 0x94, 0x9F, 0x95, 0x82, 0x6D,
-  0x63, 0x70, 0x87, 0x99, 0xA4, 0xA2, 0x9A, 0x9F, 0xAE, 0xB9, 0xB8, 0xA1,
-  0x72, 0x49, 0x39, 0x3F, 0x53, 0x62, 0x61, 0x5F, 0x65, 0x71, 0x87, 0x9D,
-  0xA1, 0x94, 0x80, 0x6C, 0x69, 0x7B, 0x90, 0x9F, 0xA6, 0xA0, 0x9A, 0xA4,
-  0xB2, 0xBA, 0xB4, 0x93, 0x63, 0x41, 0x37, 0x40, 0x53, 0x5E, 0x5B, 0x5B,
-  0x63, 0x73, 0x8D, 0xA2, 0xA1, 0x90, 0x7A, 0x68, 0x6B, 0x80, 0x94, 0xA2,
-  0xA6, 0x9E, 0x9B, 0xA9, 0xB6, 0xBB, 0xAE, 0x86, 0x57, 0x3B, 0x38, 0x47,
-  0x5B, 0x60, 0x5B, 0x5C, 0x65, 0x78, 0x91, 0x9E, 0x96, 0x84, 0x6F, 0x63,
-  0x6E, 0x84, 0x97, 0xA3, 0xA3, 0x9B, 0x9D, 0xAC, 0xB8, 0xB9, 0xA4, 0x77,
-  0x4D, 0x3C, 0x3F, 0x50, 0x61, 0x62, 0x5E, 0x62, 0x6D, 0x81, 0x99, 0xA0,
-  0x93, 0x81, 0x6D, 0x67, 0x77, 0x8D, 0x9D, 0xA7, 0xA2, 0x9A, 0xA3, 0xB1,
-  0xB9, 0xB7, 0x99, 0x67, 0x43, 0x38, 0x3F, 0x55, 0x61, 0x5E, 0x5C, 0x62,
-  0x72, 0x8D, 0x9E, 0x9A, 0x87, 0x6F, 0x66, 0x74, 0x8A, 0x9D, 0xA7, 0xA3,
-  0x9E, 0xA7, 0xB6, 0xBD, 0xB0, 0x87, 0x58, 0x40, 0x40, 0x51, 0x60, 0x61,
-  0x5D, 0x61, 0x70, 0x88, 0x9A, 0x99, 0x87, 0x6F, 0x62, 0x6B, 0x81, 0x94,
-  0xA0, 0x9E, 0x98, 0xA0, 0xB1, 0xBB, 0xB3, 0x91, 0x61, 0x40, 0x3C, 0x4D,
-  0x5D, 0x5E, 0x5B, 0x5E, 0x6B, 0x83, 0x99, 0x9C, 0x8C, 0x75, 0x66, 0x6B,
-  0x80, 0x96, 0xA3, 0xA2, 0x9A, 0x9E, 0xAE, 0xBA, 0xB5, 0x94, 0x62, 0x40,
-  0x3A, 0x48, 0x5B, 0x61, 0x5E, 0x5F, 0x6B, 0x81, 0x99, 0x9F, 0x92, 0x7C,
-  0x6A, 0x6C, 0x80, 0x95, 0xA3, 0xA5, 0x9E, 0xA0, 0xAF, 0xBB, 0xBA, 0x9F,
-  0x70, 0x48, 0x3D, 0x49, 0x5C, 0x63, 0x5F, 0x5F, 0x69, 0x7D, 0x95, 0x9E,
-  0x94, 0x7F, 0x6A, 0x67, 0x79, 0x90, 0xA0, 0xA4, 0x9D, 0x9C, 0xAA, 0xB8,
-  0xBA, 0xA2, 0x72, 0x47, 0x38, 0x41, 0x55, 0x60, 0x5D, 0x5E, 0x67, 0x78,
-  0x90, 0xA0, 0x99, 0x84, 0x6F, 0x69, 0x78, 0x8E, 0x9F, 0xA6, 0x9F, 0x9C,
-  0xA8, 0xB7, 0xBB, 0xA9, 0x7D, 0x4F, 0x3A, 0x40, 0x51, 0x5E, 0x5D, 0x59,
-  0x5E, 0x6F, 0x88, 0x9A, 0x97, 0x85, 0x70, 0x67, 0x76, 0x8D, 0x9F, 0xA7,
-  0xA2, 0x9C, 0xA5, 0xB5, 0xBB, 0xAE, 0x84, 0x54, 0x3C, 0x3D, 0x4E, 0x60,
-  0x5A, 0x47, 0x3F, 0x40, 0x42, 0x48, 0x4D, 0x4E, 0x52, 0x59, 0x5F, 0x66,
-  0x6B, 0x6F, 0x75, 0x7C, 0x84, 0x8E, 0x95, 0x9A, 0x9E, 0xA1, 0xA6, 0xAA,
-  0xAB, 0xAE, 0xB0, 0xAD, 0xAD, 0xB0, 0xB0, 0xAE, 0xAD, 0xAB, 0xA7, 0xA3,
-  0xA1, 0x9F, 0x9A, 0x95, 0x92, 0x8C, 0x87, 0x84, 0x7F, 0x78, 0x6F, 0x67,
-  0x61, 0x5D, 0x5B, 0x58, 0x55, 0x51, 0x4D, 0x4D, 0x4E, 0x4D, 0x4B, 0x4A,
-  0x4C, 0x4D, 0x4F, 0x55, 0x5A, 0x5C, 0x5E, 0x63, 0x68, 0x6D, 0x73, 0x78,
-  0x7B, 0x7F, 0x86, 0x8F, 0x96, 0x9B, 0x9E, 0xA0, 0xA4, 0xA7, 0xA7, 0xAA,
-  0xAC, 0xAA, 0xA9, 0xA9, 0xAA, 0xA8, 0xA7, 0xA5, 0xA2, 0x9E, 0x9A, 0x99,
-  0x97, 0x92, 0x8F, 0x8A, 0x85, 0x82, 0x80, 0x7D, 0x78, 0x71, 0x6B, 0x67,
-  0x66, 0x64, 0x60, 0x5E, 0x5B, 0x58, 0x58, 0x5A, 0x5A, 0x57, 0x56, 0x59,
-  0x59, 0x5B, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x71, 0x76, 0x7B, 0x7D, 0x7F,
-  0x83, 0x89, 0x90, 0x96, 0x9A, 0x9C, 0x9D, 0xA0, 0xA2, 0xA2, 0xA4, 0xA5,
-  0xA3, 0xA2, 0xA2, 0xA3, 0xA1, 0xA0, 0x9F, 0x9B, 0x97, 0x94, 0x94, 0x91,
-  0x8D, 0x8B, 0x87, 0x82, 0x80, 0x7D, 0x7A, 0x75, 0x6E, 0x68, 0x65, 0x64,
-  0x63, 0x62, 0x60, 0x5D, 0x5C, 0x5E, 0x5F, 0x5F, 0x5D, 0x5E, 0x60, 0x61,
-  0x64, 0x6A, 0x6D, 0x72, 0x7B, 0x84, 0x8D, 0x9A, 0xA8, 0xB1, 0xB8, 0xBF,
-  0xC1, 0xC2, 0xC1, 0xBE, 0xB7, 0xAE, 0xA6, 0x99, 0x8C, 0x7E, 0x6E, 0x5B,
-  0x4F, 0x43, 0x39, 0x32, 0x2E, 0x29, 0x2C, 0x32, 0x37, 0x40, 0x4C, 0x57,
-  0x65, 0x77, 0x87, 0x93, 0x9F, 0xA8, 0xAE, 0xB4, 0xB8, 0xB9, 0xB5, 0xB3,
-  0xAE, 0xA7, 0x9E, 0x93, 0x84, 0x77, 0x70, 0x67, 0x5F, 0x5D, 0x59, 0x58,
-  0x5E, 0x63, 0x6A, 0x74, 0x7E, 0x89, 0x97, 0xA6, 0xAF, 0xB8, 0xC0, 0xC2,
-  0xC3, 0xC4, 0xC0, 0xBA, 0xB2, 0xA9, 0x9D, 0x91, 0x82, 0x70, 0x60, 0x53,
-  0x48, 0x3D, 0x38, 0x34, 0x2F, 0x32, 0x38, 0x3E, 0x48, 0x53, 0x5E, 0x6C,
-  0x7E, 0x8C, 0x97, 0xA3, 0xAB, 0xAF, 0xB4, 0xB6, 0xB5, 0xB1, 0xAE, 0xA6,
-  0x9D, 0x95, 0x88, 0x7A, 0x6F, 0x66, 0x5D, 0x58, 0x55, 0x51, 0x52, 0x58,
-  0x5D, 0x65, 0x70, 0x7B, 0x85, 0x96, 0xA4, 0xAF, 0xB8, 0xC0, 0xC3, 0xC5,
-  0xC5, 0xC2, 0xBB, 0xB5, 0xAB, 0x9F, 0x94, 0x86, 0x75, 0x64, 0x59, 0x4D,
-  0x44, 0x3E, 0x39, 0x35, 0x39, 0x3E, 0x43, 0x4D, 0x57, 0x61, 0x6F, 0x80,
-  0x8C, 0x98, 0xA1, 0xA8, 0xAB, 0xAF, 0xB1, 0xAD, 0xA9, 0xA5, 0x9D, 0x95,
-  0x8C, 0x7F, 0x71, 0x67, 0x60, 0x58, 0x52, 0x4F, 0x4B, 0x4C, 0x53, 0x59,
-  0x62, 0x6D, 0x78, 0x84, 0x96, 0xAA, 0xB8, 0xC2, 0xC8, 0xC8, 0xC2, 0xB8,
-  0xAA, 0x97, 0x80, 0x6B, 0x5A, 0x4E, 0x46, 0x44, 0x4A, 0x53, 0x60, 0x73,
-  0x88, 0x99, 0xA6, 0xAE, 0xB2, 0xB0, 0xA8, 0x9E, 0x8E, 0x7A, 0x66, 0x54,
-  0x47, 0x3D, 0x39, 0x3C, 0x45, 0x52, 0x63, 0x79, 0x8F, 0xA0, 0xAC, 0xB5,
-  0xB8, 0xB6, 0xAF, 0xA4, 0x95, 0x81, 0x6E, 0x5F, 0x53, 0x4C, 0x4B, 0x51,
-  0x5B, 0x68, 0x7B, 0x91, 0xA5, 0xB3, 0xBD, 0xC3, 0xC4, 0xBD, 0xB3, 0xA6,
-  0x93, 0x7C, 0x68, 0x59, 0x4D, 0x46, 0x47, 0x4E, 0x59, 0x67, 0x7B, 0x90,
-  0xA0, 0xAC, 0xB4, 0xB7, 0xB4, 0xAC, 0xA0, 0x91, 0x7D, 0x67, 0x55, 0x49,
-  0x3F, 0x3B, 0x3F, 0x48, 0x55, 0x65, 0x7A, 0x8F, 0xA0, 0xAB, 0xB2, 0xB4,
-  0xB1, 0xAA, 0x9F, 0x8F, 0x7B, 0x69, 0x5C, 0x51, 0x4A, 0x49, 0x50, 0x5A,
-  0x68, 0x7B, 0x91, 0xA4, 0xB2, 0xBC, 0xC1, 0xC1, 0xBA, 0xB0, 0xA2, 0x8E,
-  0x78, 0x65, 0x56, 0x4B, 0x45, 0x46, 0x4E, 0x59, 0x68, 0x7C, 0x91, 0xA1,
-  0xAD, 0xB4, 0xB6, 0xB3, 0xAB, 0x9F, 0x8F, 0x7A, 0x65, 0x54, 0x48, 0x3F,
-  0x3D, 0x41, 0x4B, 0x58, 0x69, 0x7F, 0x93, 0xA2, 0xAE, 0xB4, 0xB5, 0xB2,
-  0xA9, 0x9C, 0x8B, 0x77, 0x63, 0x56, 0x4C, 0x46, 0x46, 0x4E, 0x59, 0x68,
-  0x7B, 0x91, 0xA4, 0xB1, 0xBA, 0xBF, 0xBD, 0xB5, 0xA5, 0x8C, 0x72, 0x5D,
-  0x4D, 0x48, 0x4E, 0x5C, 0x73, 0x8E, 0xA5, 0xB3, 0xBA, 0xB7, 0xAD, 0x9A,
-  0x81, 0x68, 0x54, 0x48, 0x45, 0x4E, 0x5D, 0x76, 0x8F, 0xA3, 0xB0, 0xB4,
-  0xAF, 0xA2, 0x8D, 0x73, 0x5B, 0x49, 0x40, 0x41, 0x4B, 0x5E, 0x78, 0x92,
-  0xA4, 0xAF, 0xB2, 0xAB, 0x9F, 0x89, 0x6E, 0x5A, 0x4C, 0x47, 0x4C, 0x59,
-  0x6D, 0x88, 0xA0, 0xB0, 0xB9, 0xB9, 0xAF, 0x9F, 0x87, 0x6C, 0x58, 0x4A,
-  0x47, 0x4D, 0x5D, 0x74, 0x8F, 0xA5, 0xB3, 0xBA, 0xB6, 0xAB, 0x96, 0x7C,
-  0x63, 0x51, 0x45, 0x45, 0x4E, 0x5F, 0x79, 0x93, 0xA5, 0xB2, 0xB5, 0xB0,
-  0xA2, 0x8D, 0x72, 0x5C, 0x4B, 0x43, 0x46, 0x52, 0x66, 0x80, 0x99, 0xAA,
-  0xB5, 0xB6, 0xAF, 0x9F, 0x87, 0x6E, 0x59, 0x4C, 0x46, 0x4D, 0x5A, 0x70,
-  0x8C, 0xA2, 0xB2, 0xBA, 0xB8, 0xAE, 0x9C, 0x83, 0x69, 0x56, 0x48, 0x47,
-  0x4F, 0x60, 0x78, 0x92, 0xA8, 0xB5, 0xBA, 0xB6, 0xA9, 0x95, 0x79, 0x62,
-  0x51, 0x46, 0x47, 0x52, 0x65, 0x7E, 0x97, 0xAA, 0xB4, 0xB6, 0xB0, 0xA1,
-  0x8A, 0x70, 0x59, 0x4A, 0x42, 0x47, 0x53, 0x68, 0x82, 0x9A, 0xAA, 0xB3,
-  0xB2, 0xAA, 0x99, 0x80, 0x65, 0x51, 0x45, 0x42, 0x4B, 0x5A, 0x73, 0x8F,
-  0xA6, 0xB4, 0xBA, 0xB7, 0xAC, 0x99, 0x7F, 0x66, 0x54, 0x49, 0x4B, 0x5D,
-  0x79, 0x97, 0xAE, 0xB8, 0xB4, 0xA3, 0x87, 0x68, 0x51, 0x47, 0x4D, 0x61,
-  0x7F, 0x9C, 0xAF, 0xB5, 0xAF, 0x9B, 0x7D, 0x60, 0x4D, 0x46, 0x4F, 0x66,
-  0x84, 0xA0, 0xB0, 0xB3, 0xAA, 0x94, 0x75, 0x5A, 0x49, 0x46, 0x52, 0x6B,
-  0x8A, 0xA3, 0xB1, 0xB2, 0xA6, 0x8D, 0x6F, 0x56, 0x48, 0x49, 0x59, 0x74,
-  0x92, 0xA9, 0xB4, 0xB3, 0xA3, 0x88, 0x6A, 0x52, 0x47, 0x4B, 0x5E, 0x7B,
-  0x99, 0xAE, 0xB6, 0xB1, 0x9F, 0x82, 0x63, 0x4E, 0x47, 0x4E, 0x64, 0x83,
-  0x9F, 0xB1, 0xB7, 0xAF, 0x99, 0x7C, 0x60, 0x4E, 0x4A, 0x54, 0x6C, 0x8A,
-  0xA5, 0xB3, 0xB5, 0xAB, 0x93, 0x74, 0x59, 0x4A, 0x49, 0x56, 0x70, 0x8E,
-  0xA6, 0xB2, 0xB1, 0xA3, 0x89, 0x6A, 0x50, 0x44, 0x47, 0x5A, 0x77, 0x96,
-  0xAC, 0xB6, 0xB4, 0xA3, 0x87, 0x68, 0x51, 0x49, 0x4F, 0x62, 0x7F, 0x9D,
-  0xB1, 0xB7, 0xB0, 0x9C, 0x7E, 0x61, 0x4D, 0x47, 0x50, 0x67, 0x86, 0xA1,
-  0xB2, 0xB6, 0xAC, 0x94, 0x76, 0x5A, 0x49, 0x46, 0x53, 0x6C, 0x8B, 0xA5,
-  0xB2, 0xB3, 0xA6, 0x8D, 0x6F, 0x55, 0x48, 0x49, 0x59, 0x74, 0x92, 0xA9,
-  0xB4, 0xB1, 0xA2, 0x87, 0x69, 0x52, 0x48, 0x4C, 0x5F, 0x7C, 0x9A, 0xAD,
-  0xB5, 0xB1, 0x9E, 0x82, 0x64, 0x4F, 0x49, 0x50, 0x65, 0x83, 0xA1, 0xB2,
-  0xB3, 0xA4, 0x83, 0x61, 0x4D, 0x4C, 0x60, 0x82, 0xA2, 0xB3, 0xB2, 0x9E,
-  0x7D, 0x5D, 0x4D, 0x4E, 0x65, 0x89, 0xA6, 0xB4, 0xAF, 0x99, 0x76, 0x59,
-  0x4D, 0x53, 0x6D, 0x8F, 0xAA, 0xB4, 0xAC, 0x92, 0x6E, 0x53, 0x49, 0x54,
-  0x71, 0x92, 0xAA, 0xB0, 0xA5, 0x88, 0x66, 0x4C, 0x45, 0x53, 0x74, 0x96,
-  0xAD, 0xB1, 0xA1, 0x84, 0x64, 0x50, 0x4D, 0x5F, 0x7F, 0x9E, 0xB1, 0xB1,
-  0x9F, 0x7D, 0x5D, 0x4B, 0x4C, 0x63, 0x85, 0xA4, 0xB2, 0xB0, 0x99, 0x77,
-  0x58, 0x49, 0x4E, 0x68, 0x8B, 0xA7, 0xB3, 0xAC, 0x94, 0x71, 0x54, 0x4A,
-  0x53, 0x6F, 0x92, 0xAC, 0xB4, 0xA9, 0x8E, 0x6B, 0x51, 0x4B, 0x58, 0x77,
-  0x98, 0xAF, 0xB3, 0xA6, 0x87, 0x66, 0x51, 0x4D, 0x5D, 0x7E, 0x9E, 0xB1,
-  0xB2, 0xA1, 0x81, 0x61, 0x4E, 0x4E, 0x63, 0x84, 0xA3, 0xB2, 0xB1, 0x9C,
-  0x79, 0x5A, 0x4B, 0x4F, 0x68, 0x8A, 0xA7, 0xB3, 0xAE, 0x95, 0x73, 0x55,
-  0x48, 0x51, 0x6C, 0x90, 0xAA, 0xB4, 0xAA, 0x90, 0x6D, 0x53, 0x4A, 0x57,
-  0x74, 0x97, 0xAD, 0xB4, 0xA7, 0x8A, 0x67, 0x50, 0x4B, 0x5B, 0x7A, 0x9B,
-  0xAF, 0xB1, 0xA1, 0x81, 0x60, 0x4C, 0x4A, 0x5D, 0x7E, 0x9E, 0xAF, 0xAD,
-  0x9A, 0x79, 0x5A, 0x4A, 0x4D, 0x66, 0x8A, 0xA7, 0xB6, 0xB1, 0x98, 0x76,
-  0x58, 0x4B, 0x58, 0x7A, 0x9E, 0xB1, 0xAB, 0x8D, 0x67, 0x4E, 0x50, 0x6B,
-  0x91, 0xAD, 0xB1, 0x9C, 0x77, 0x55, 0x4B, 0x5D, 0x81, 0xA3, 0xB2, 0xA7,
-  0x86, 0x61, 0x4C, 0x53, 0x71, 0x97, 0xAE, 0xAD, 0x95, 0x70, 0x53, 0x4D,
-  0x63, 0x88, 0xA7, 0xB1, 0xA1, 0x7F, 0x5C, 0x4B, 0x57, 0x78, 0x9C, 0xB0,
-  0xAA, 0x8E, 0x69, 0x4F, 0x4F, 0x69, 0x8E, 0xAA, 0xB0, 0x9C, 0x78, 0x57,
-  0x4B, 0x5B, 0x7E, 0xA0, 0xB0, 0xA7, 0x87, 0x62, 0x4B, 0x50, 0x6E, 0x94,
-  0xAD, 0xAE, 0x97, 0x71, 0x52, 0x4B, 0x60, 0x86, 0xA7, 0xB2, 0xA4, 0x83,
-  0x60, 0x4E, 0x59, 0x79, 0x9D, 0xB2, 0xAE, 0x93, 0x6E, 0x53, 0x51, 0x6A,
-  0x8E, 0xAB, 0xB2, 0x9F, 0x7B, 0x59, 0x4C, 0x5B, 0x7D, 0x9F, 0xB0, 0xA7,
-  0x88, 0x62, 0x4A, 0x4E, 0x6C, 0x92, 0xAD, 0xAF, 0x99, 0x76, 0x58, 0x4F,
-  0x61, 0x85, 0xA5, 0xB2, 0xA5, 0x84, 0x60, 0x4C, 0x54, 0x74, 0x99, 0xAF,
-  0xAD, 0x93, 0x6D, 0x4F, 0x4C, 0x64, 0x8A, 0xA9, 0xB1, 0x9F, 0x7C, 0x59,
-  0x4A, 0x58, 0x7A, 0x9D, 0xB0, 0xA9, 0x8B, 0x66, 0x4E, 0x50, 0x6B, 0x91,
-  0xAC, 0xB0, 0x9A, 0x76, 0x56, 0x4C, 0x5E, 0x82, 0xA3, 0xB1, 0xA6, 0x86,
-  0x62, 0x4D, 0x54, 0x73, 0x98, 0xAF, 0xAE, 0x95, 0x70, 0x53, 0x4E, 0x64,
-  0x8A, 0xA9, 0xB2, 0xA0, 0x79, 0x56, 0x50, 0x6C, 0x94, 0xAD, 0xA8, 0x87,
-  0x5F, 0x4E, 0x5F, 0x86, 0xA8, 0xAE, 0x95, 0x6D, 0x51, 0x56, 0x77, 0x9E,
-  0xB0, 0xA2, 0x7C, 0x58, 0x51, 0x6B, 0x93, 0xAD, 0xAB, 0x8C, 0x64, 0x50,
-  0x5E, 0x84, 0xA6, 0xAE, 0x97, 0x6F, 0x52, 0x53, 0x72, 0x99, 0xAC, 0xA0,
-  0x7B, 0x57, 0x4C, 0x62, 0x8A, 0xA7, 0xA7, 0x8A, 0x63, 0x4D, 0x59, 0x7F,
-  0xA4, 0xB0, 0x9B, 0x73, 0x53, 0x52, 0x70, 0x97, 0xAD, 0xA4, 0x81, 0x5B,
-  0x4D, 0x62, 0x8A, 0xA9, 0xAB, 0x8F, 0x67, 0x4E, 0x57, 0x7B, 0xA1, 0xAF,
-  0x9C, 0x75, 0x54, 0x50, 0x6D, 0x96, 0xAE, 0xA7, 0x85, 0x5F, 0x4F, 0x61,
-  0x88, 0xA9, 0xAD, 0x93, 0x6C, 0x51, 0x58, 0x7A, 0xA0, 0xB0, 0xA0, 0x7A,
-  0x58, 0x52, 0x6C, 0x94, 0xAE, 0xA9, 0x8A, 0x63, 0x50, 0x60, 0x86, 0xA7,
-  0xAF, 0x97, 0x6F, 0x52, 0x56, 0x76, 0x9D, 0xB0, 0xA2, 0x7D, 0x58, 0x4E,
-  0x67, 0x90, 0xAC, 0xAA, 0x8B, 0x62, 0x4D, 0x5B, 0x81, 0xA5, 0xAE, 0x98,
-  0x71, 0x52, 0x53, 0x72, 0x9A, 0xAF, 0xA4, 0x81, 0x5C, 0x50, 0x66, 0x8E,
-  0xAB, 0xAB, 0x8E, 0x67, 0x50, 0x5A, 0x7E, 0xA2, 0xAE, 0x9B, 0x73, 0x53,
-  0x51, 0x6E, 0x95, 0xAC, 0xA3, 0x81, 0x5A, 0x4A, 0x5E, 0x87, 0xA8, 0xAC,
-  0x91, 0x6A, 0x52, 0x5A, 0x7E, 0xA3, 0xAD, 0x93, 0x69, 0x51, 0x64, 0x8E,
-  0xAB, 0xA4, 0x7F, 0x58, 0x54, 0x76, 0x9E, 0xAD, 0x96, 0x6B, 0x50, 0x60,
-  0x89, 0xA9, 0xA6, 0x82, 0x5A, 0x53, 0x72, 0x9B, 0xAC, 0x98, 0x6D, 0x51,
-  0x5D, 0x86, 0xA8, 0xA7, 0x85, 0x5E, 0x52, 0x6E, 0x99, 0xAD, 0x9A, 0x71,
-  0x53, 0x5B, 0x81, 0xA5, 0xA8, 0x89, 0x60, 0x52, 0x6B, 0x95, 0xAC, 0x9D,
-  0x75, 0x55, 0x59, 0x7E, 0xA3, 0xAA, 0x8C, 0x62, 0x50, 0x68, 0x91, 0xAB,
-  0x9F, 0x77, 0x53, 0x55, 0x79, 0xA1, 0xAA, 0x90, 0x65, 0x4F, 0x63, 0x8E,
-  0xAA, 0xA2, 0x7C, 0x57, 0x55, 0x77, 0xA0, 0xAD, 0x94, 0x6B, 0x54, 0x64,
-  0x8D, 0xAC, 0xA6, 0x82, 0x5C, 0x56, 0x75, 0x9E, 0xAE, 0x97, 0x6D, 0x53,
-  0x60, 0x88, 0xA9, 0xA7, 0x83, 0x5B, 0x52, 0x6F, 0x98, 0xAB, 0x98, 0x6D,
-  0x51, 0x5C, 0x84, 0xA7, 0xA9, 0x8A, 0x62, 0x54, 0x6F, 0x98, 0xAE, 0x9D,
-  0x74, 0x53, 0x5A, 0x81, 0xA5, 0xA9, 0x8B, 0x61, 0x4F, 0x69, 0x94, 0xAB,
-  0x9E, 0x76, 0x53, 0x56, 0x7C, 0xA2, 0xAA, 0x8D, 0x63, 0x4F, 0x65, 0x8F,
-  0xAB, 0xA0, 0x79, 0x56, 0x55, 0x78, 0xA0, 0xAB, 0x91, 0x67, 0x51, 0x63,
-  0x8D, 0xAA, 0xA4, 0x7E, 0x59, 0x55, 0x76, 0x9F, 0xAD, 0x95, 0x6B, 0x52,
-  0x61, 0x8A, 0xAA, 0xA6, 0x83, 0x5C, 0x54, 0x75, 0x9F, 0xAA, 0x89, 0x5F,
-  0x57, 0x79, 0xA2, 0xA8, 0x84, 0x5B, 0x58, 0x7E, 0xA5, 0xA5, 0x7F, 0x58,
-  0x5A, 0x84, 0xA8, 0xA2, 0x7A, 0x57, 0x5E, 0x89, 0xA9, 0xA0, 0x75, 0x56,
-  0x64, 0x8F, 0xAC, 0x9D, 0x71, 0x56, 0x68, 0x94, 0xAC, 0x98, 0x6C, 0x54,
-  0x6A, 0x96, 0xA9, 0x92, 0x65, 0x52, 0x6E, 0x98, 0xA7, 0x8B, 0x5E, 0x50,
-  0x70, 0x9A, 0xA5, 0x86, 0x5D, 0x55, 0x79, 0xA2, 0xA8, 0x84, 0x5C, 0x59,
-  0x7E, 0xA4, 0xA4, 0x7D, 0x57, 0x59, 0x82, 0xA6, 0xA0, 0x78, 0x55, 0x5D,
-  0x88, 0xA7, 0x9D, 0x73, 0x53, 0x61, 0x8D, 0xAA, 0x9A, 0x6D, 0x52, 0x66,
-  0x92, 0xAB, 0x97, 0x69, 0x53, 0x6B, 0x98, 0xAB, 0x92, 0x66, 0x55, 0x70,
-  0x9C, 0xAB, 0x8E, 0x63, 0x56, 0x76, 0xA0, 0xA9, 0x8A, 0x60, 0x58, 0x7C,
-  0xA3, 0xA8, 0x84, 0x5D, 0x5A, 0x81, 0xA6, 0xA6, 0x7E, 0x58, 0x5D, 0x85,
-  0xA7, 0xA2, 0x79, 0x56, 0x5E, 0x89, 0xA9, 0x9D, 0x73, 0x53, 0x62, 0x8E,
-  0xA9, 0x9A, 0x6D, 0x52, 0x66, 0x92, 0xAA, 0x96, 0x69, 0x53, 0x6B, 0x98,
-  0xAB, 0x91, 0x65, 0x55, 0x71, 0x9C, 0xAA, 0x8D, 0x62, 0x56, 0x76, 0xA0,
-  0xA8, 0x87, 0x5E, 0x57, 0x7A, 0xA2, 0xA5, 0x81, 0x5A, 0x58, 0x7E, 0xA2,
-  0xA2, 0x7A, 0x54, 0x57, 0x82, 0xA5, 0xA0, 0x77, 0x56, 0x62, 0x91, 0xAB,
-  0x91, 0x64, 0x5A, 0x7F, 0xA6, 0x9E, 0x72, 0x57, 0x6E, 0x9C, 0xA7, 0x82,
-  0x59, 0x60, 0x8D, 0xA9, 0x92, 0x64, 0x57, 0x7C, 0xA4, 0x9F, 0x73, 0x55,
-  0x6B, 0x99, 0xA7, 0x84, 0x5C, 0x5F, 0x8A, 0xA8, 0x94, 0x66, 0x57, 0x79,
-  0xA3, 0xA1, 0x76, 0x57, 0x69, 0x96, 0xA7, 0x86, 0x5D, 0x5D, 0x86, 0xA7,
-  0x96, 0x68, 0x57, 0x76, 0xA1, 0xA2, 0x79, 0x57, 0x67, 0x95, 0xA8, 0x89,
-  0x5E, 0x5B, 0x84, 0xA6, 0x98, 0x6B, 0x56, 0x72, 0x9E, 0xA3, 0x7A, 0x55,
-  0x63, 0x91, 0xA8, 0x8B, 0x5F, 0x59, 0x81, 0xA6, 0x9A, 0x6D, 0x55, 0x71,
-  0x9D, 0xA5, 0x7F, 0x5B, 0x65, 0x92, 0xAB, 0x91, 0x64, 0x5B, 0x81, 0xA7,
-  0x9F, 0x72, 0x58, 0x70, 0x9D, 0xA7, 0x82, 0x5C, 0x62, 0x8D, 0xA8, 0x91,
-  0x64, 0x58, 0x7B, 0xA3, 0x9D, 0x70, 0x53, 0x69, 0x98, 0xA6, 0x83, 0x5C,
-  0x61, 0x8D, 0xAB, 0x96, 0x68, 0x59, 0x7B, 0xA3, 0xA0, 0x76, 0x56, 0x69,
-  0x97, 0xA8, 0x86, 0x5C, 0x5D, 0x87, 0xA7, 0x95, 0x67, 0x55, 0x75, 0xA0,
-  0xA1, 0x77, 0x56, 0x66, 0x94, 0xA7, 0x88, 0x5D, 0x5A, 0x83, 0xA6, 0x98,
-  0x6A, 0x56, 0x74, 0x9F, 0xA3, 0x7B, 0x58, 0x66, 0x92, 0xA7, 0x8B, 0x61,
-  0x5B, 0x83, 0xA7, 0x9B, 0x6F, 0x57, 0x72, 0x9E, 0xA4, 0x7D, 0x5B, 0x55,
-  0x56, 0x54, 0x55, 0x57, 0x57, 0x59, 0x5B, 0x5B, 0x5D, 0x5E, 0x5E, 0x60,
-  0x61, 0x61, 0x62, 0x63, 0x63, 0x65, 0x64, 0x64, 0x65, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x68, 0x68, 0x67, 0x68, 0x67, 0x68, 0x68, 0x69, 0x68, 0x69,
-  0x68, 0x69, 0x69, 0x6A, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C,
-  0x6D, 0x6D, 0x6E, 0x6E, 0x70, 0x70, 0x71, 0x71, 0x73, 0x74, 0x74, 0x75,
-  0x75, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D,
-  0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F,
-  0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
-  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x87, 0x86,
-  0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87,
-  0x86, 0x86, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x83,
-  0x84, 0x84, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x83,
-  0x82, 0x82, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84,
-  0x84, 0x88, 0x91, 0x98, 0x9C, 0xA3, 0xAB, 0xB4, 0xBB, 0xC0, 0xC2, 0xC6,
-  0xCA, 0xCD, 0xCF, 0xD3, 0xD4, 0xD3, 0xD2, 0xD3, 0xD4, 0xD3, 0xD1, 0xD0,
-  0xCB, 0xC6, 0xC4, 0xC1, 0xBD, 0xB7, 0xB3, 0xAD, 0xA7, 0xA2, 0x9D, 0x97,
-  0x8F, 0x86, 0x7D, 0x78, 0x75, 0x71, 0x6D, 0x6A, 0x66, 0x62, 0x61, 0x62,
-  0x60, 0x5C, 0x5C, 0x5D, 0x5C, 0x5F, 0x64, 0x68, 0x68, 0x6A, 0x6F, 0x73,
-  0x78, 0x7D, 0x7F, 0x82, 0x87, 0x8E, 0x95, 0x9B, 0x9F, 0xA2, 0xA4, 0xA8,
-  0xAA, 0xAB, 0xAE, 0xAF, 0xAD, 0xAD, 0xAE, 0xAF, 0xAD, 0xAD, 0xAC, 0xA7,
-  0xA3, 0xA2, 0xA1, 0x9C, 0x98, 0x96, 0x91, 0x8D, 0x8A, 0x86, 0x82, 0x7C,
-  0x74, 0x6E, 0x6B, 0x69, 0x67, 0x64, 0x61, 0x5E, 0x5C, 0x5D, 0x5E, 0x5C,
-  0x59, 0x5A, 0x5B, 0x5B, 0x5E, 0x63, 0x66, 0x66, 0x67, 0x6B, 0x6F, 0x73,
-  0x76, 0x78, 0x7B, 0x80, 0x87, 0x8E, 0x94, 0x99, 0x9B, 0x9D, 0xA0, 0xA0,
-  0xA1, 0xA3, 0xA2, 0xA0, 0x9F, 0xA1, 0xA0, 0x9F, 0x9D, 0x9C, 0x97, 0x94,
-  0x93, 0x91, 0x8E, 0x8A, 0x88, 0x84, 0x7F, 0x7D, 0x7A, 0x76, 0x70, 0x68,
-  0x63, 0x60, 0x60, 0x5E, 0x5C, 0x5B, 0x59, 0x59, 0x5A, 0x5D, 0x5C, 0x5A,
-  0x5C, 0x5D, 0x5E, 0x63, 0x68, 0x6B, 0x6C, 0x6E, 0x72, 0x76, 0x7B, 0x7D,
-  0x80, 0x81, 0x85, 0x8C, 0x96, 0x9D, 0xA3, 0xAA, 0xAC, 0xAC, 0xAD, 0xAA,
-  0xA4, 0x9C, 0x95, 0x89, 0x7E, 0x72, 0x61, 0x51, 0x44, 0x3A, 0x32, 0x2D,
-  0x2A, 0x27, 0x2B, 0x32, 0x3A, 0x46, 0x53, 0x60, 0x70, 0x83, 0x95, 0xA2,
-  0xAE, 0xB9, 0xBF, 0xC5, 0xCA, 0xC9, 0xC6, 0xC2, 0xBC, 0xB3, 0xA9, 0x9E,
-  0x8D, 0x80, 0x75, 0x6A, 0x61, 0x5D, 0x57, 0x54, 0x58, 0x5B, 0x60, 0x68,
-  0x70, 0x79, 0x85, 0x93, 0x9C, 0xA4, 0xAC, 0xAF, 0xB1, 0xB2, 0xAF, 0xA9,
-  0xA3, 0x9A, 0x8E, 0x81, 0x75, 0x65, 0x53, 0x48, 0x3D, 0x34, 0x2E, 0x2B,
-  0x28, 0x2B, 0x32, 0x39, 0x44, 0x50, 0x5C, 0x6B, 0x7F, 0x8E, 0x9B, 0xA6,
-  0xB0, 0xB6, 0xBB, 0xBF, 0xBD, 0xBA, 0xB5, 0xAF, 0xA5, 0x9D, 0x90, 0x81,
-  0x74, 0x6C, 0x62, 0x5A, 0x58, 0x54, 0x52, 0x57, 0x5C, 0x62, 0x6C, 0x75,
-  0x7F, 0x8D, 0x9B, 0xA5, 0xAD, 0xB4, 0xB7, 0xB9, 0xBA, 0xB6, 0xAF, 0xA9,
-  0xA0, 0x95, 0x88, 0x7C, 0x6A, 0x5A, 0x4E, 0x44, 0x3A, 0x34, 0x30, 0x2C,
-  0x30, 0x36, 0x3D, 0x47, 0x52, 0x5E, 0x6D, 0x80, 0x8E, 0x99, 0xA5, 0xAC,
-  0xB1, 0xB7, 0xB9, 0xB7, 0xB3, 0xAF, 0xA7, 0x9E, 0x95, 0x88, 0x79, 0x6C,
-  0x64, 0x5B, 0x54, 0x51, 0x4D, 0x4D, 0x53, 0x58, 0x5F, 0x69, 0x73, 0x7D,
-  0x8D, 0x9A, 0xA4, 0xAC, 0xB3, 0xB7, 0xB9, 0xB9, 0xB3, 0xA9, 0x9C, 0x89,
-  0x74, 0x60, 0x51, 0x44, 0x3C, 0x39, 0x3F, 0x49, 0x56, 0x69, 0x7F, 0x90,
-  0x9E, 0xA7, 0xAC, 0xAC, 0xA6, 0x9C, 0x8D, 0x7B, 0x66, 0x54, 0x48, 0x3F,
-  0x3B, 0x3F, 0x49, 0x56, 0x68, 0x7E, 0x94, 0xA6, 0xB3, 0xBB, 0xBF, 0xBD,
-  0xB6, 0xAA, 0x9B, 0x87, 0x72, 0x62, 0x57, 0x4E, 0x4C, 0x50, 0x5A, 0x67,
-  0x78, 0x8E, 0xA0, 0xAE, 0xB8, 0xBC, 0xBB, 0xB6, 0xAB, 0x9D, 0x8A, 0x74,
-  0x60, 0x50, 0x44, 0x3D, 0x3D, 0x44, 0x4D, 0x5B, 0x6F, 0x84, 0x95, 0xA2,
-  0xAA, 0xAE, 0xAC, 0xA6, 0x9B, 0x8C, 0x79, 0x64, 0x52, 0x46, 0x3D, 0x3A,
-  0x3E, 0x49, 0x56, 0x68, 0x7F, 0x95, 0xA5, 0xB2, 0xBB, 0xBD, 0xBA, 0xB2,
-  0xA7, 0x97, 0x82, 0x6E, 0x5F, 0x54, 0x4D, 0x4B, 0x51, 0x5B, 0x69, 0x7B,
-  0x90, 0xA2, 0xB0, 0xB8, 0xBD, 0xBC, 0xB5, 0xAB, 0x9C, 0x87, 0x71, 0x5F,
-  0x51, 0x47, 0x41, 0x43, 0x4B, 0x56, 0x65, 0x78, 0x8B, 0x9C, 0xA8, 0xB0,
-  0xB3, 0xB0, 0xA8, 0x9C, 0x8D, 0x78, 0x63, 0x53, 0x46, 0x3C, 0x3B, 0x3F,
-  0x49, 0x57, 0x69, 0x7F, 0x94, 0xA4, 0xAF, 0xB7, 0xB9, 0xB5, 0xAC, 0xA0,
-  0x8F, 0x7A, 0x67, 0x58, 0x4D, 0x47, 0x47, 0x4F, 0x5A, 0x68, 0x7C, 0x91,
-  0xA3, 0xB0, 0xB9, 0xBE, 0xBD, 0xB5, 0xAB, 0x9C, 0x86, 0x6D, 0x58, 0x4A,
-  0x45, 0x4A, 0x59, 0x6F, 0x88, 0x9E, 0xAE, 0xB4, 0xB1, 0xA7, 0x94, 0x7B,
-  0x61, 0x4D, 0x40, 0x3F, 0x47, 0x58, 0x70, 0x8B, 0xA1, 0xAF, 0xB3, 0xAF,
-  0xA3, 0x8E, 0x74, 0x5C, 0x4C, 0x42, 0x45, 0x51, 0x65, 0x7E, 0x98, 0xAC,
-  0xB7, 0xB9, 0xB3, 0xA5, 0x8F, 0x74, 0x5F, 0x4F, 0x49, 0x4D, 0x5B, 0x6F,
-  0x88, 0xA0, 0xAF, 0xB7, 0xB7, 0xAD, 0x9C, 0x82, 0x69, 0x53, 0x45, 0x40,
-  0x48, 0x57, 0x70, 0x8B, 0xA0, 0xB0, 0xB6, 0xB3, 0xA7, 0x94, 0x78, 0x60,
-  0x4D, 0x41, 0x41, 0x4A, 0x5B, 0x75, 0x8F, 0xA3, 0xAF, 0xB3, 0xAE, 0xA0,
-  0x8A, 0x70, 0x59, 0x49, 0x40, 0x44, 0x50, 0x65, 0x80, 0x9A, 0xAC, 0xB6,
-  0xB8, 0xB0, 0xA0, 0x89, 0x6F, 0x5B, 0x4B, 0x46, 0x4E, 0x5C, 0x72, 0x8D,
-  0xA4, 0xB3, 0xBB, 0xB9, 0xAF, 0x9D, 0x84, 0x6B, 0x57, 0x4B, 0x48, 0x51,
-  0x61, 0x79, 0x92, 0xA6, 0xB4, 0xB8, 0xB4, 0xA7, 0x92, 0x78, 0x60, 0x4E,
-  0x43, 0x45, 0x4F, 0x61, 0x7B, 0x94, 0xA7, 0xB2, 0xB5, 0xAE, 0x9F, 0x88,
-  0x6E, 0x57, 0x48, 0x41, 0x45, 0x53, 0x68, 0x84, 0x9B, 0xAD, 0xB7, 0xB6,
-  0xAE, 0x9D, 0x85, 0x6C, 0x58, 0x4B, 0x47, 0x4E, 0x5E, 0x75, 0x8F, 0xA5,
-  0xB3, 0xBA, 0xB6, 0xAC, 0x98, 0x7E, 0x64, 0x52, 0x47, 0x45, 0x51, 0x68,
-  0x86, 0xA0, 0xB0, 0xB4, 0xAB, 0x93, 0x75, 0x5B, 0x4C, 0x4A, 0x58, 0x70,
-  0x8E, 0xA7, 0xB3, 0xB3, 0xA6, 0x8C, 0x6D, 0x54, 0x46, 0x47, 0x58, 0x74,
-  0x92, 0xA9, 0xB4, 0xB1, 0xA1, 0x85, 0x66, 0x4F, 0x45, 0x4A, 0x5E, 0x7C,
-  0x9A, 0xAE, 0xB5, 0xB0, 0x9D, 0x80, 0x63, 0x4F, 0x49, 0x51, 0x67, 0x85,
-  0xA1, 0xB2, 0xB6, 0xAE, 0x98, 0x7A, 0x5E, 0x4D, 0x49, 0x54, 0x6D, 0x8C,
-  0xA5, 0xB4, 0xB5, 0xA9, 0x90, 0x72, 0x58, 0x4A, 0x49, 0x57, 0x72, 0x90,
-  0xA8, 0xB3, 0xB2, 0xA3, 0x88, 0x69, 0x50, 0x45, 0x48, 0x5A, 0x77, 0x95,
-  0xAA, 0xB3, 0xAF, 0x9E, 0x81, 0x63, 0x4D, 0x45, 0x4C, 0x61, 0x80, 0x9D,
-  0xAF, 0xB6, 0xB0, 0x9B, 0x7E, 0x62, 0x50, 0x4B, 0x55, 0x6C, 0x8A, 0xA5,
-  0xB4, 0xB7, 0xAD, 0x96, 0x77, 0x5D, 0x4C, 0x4A, 0x57, 0x71, 0x8F, 0xA7,
-  0xB4, 0xB4, 0xA6, 0x8B, 0x6C, 0x53, 0x47, 0x49, 0x5B, 0x77, 0x95, 0xAD,
-  0xB7, 0xB4, 0xA3, 0x87, 0x68, 0x51, 0x47, 0x4C, 0x5F, 0x7C, 0x9A, 0xAD,
-  0xB5, 0xAF, 0x9B, 0x7D, 0x60, 0x4B, 0x44, 0x4D, 0x64, 0x83, 0x9F, 0xB0,
-  0xB4, 0xAC, 0x95, 0x77, 0x5A, 0x49, 0x47, 0x52, 0x6B, 0x8B, 0xA5, 0xB2,
-  0xB4, 0xA9, 0x90, 0x72, 0x58, 0x4A, 0x4B, 0x5A, 0x75, 0x93, 0xAA, 0xB5,
-  0xB4, 0xA0, 0x7F, 0x5F, 0x4D, 0x4E, 0x64, 0x86, 0xA4, 0xB3, 0xB0, 0x9B,
-  0x78, 0x5A, 0x4B, 0x51, 0x6A, 0x8C, 0xA8, 0xB2, 0xAB, 0x93, 0x70, 0x54,
-  0x48, 0x51, 0x6E, 0x91, 0xAB, 0xB3, 0xA8, 0x8D, 0x69, 0x4F, 0x49, 0x57,
-  0x75, 0x98, 0xAE, 0xB3, 0xA6, 0x87, 0x66, 0x50, 0x4E, 0x5E, 0x7F, 0x9F,
-  0xB2, 0xB3, 0xA2, 0x82, 0x61, 0x4E, 0x4D, 0x61, 0x83, 0xA1, 0xB1, 0xAE,
-  0x99, 0x78, 0x58, 0x49, 0x4D, 0x63, 0x86, 0xA2, 0xAF, 0xAB, 0x93, 0x71,
-  0x55, 0x4A, 0x54, 0x6F, 0x91, 0xAA, 0xB2, 0xAA, 0x8F, 0x6B, 0x51, 0x48,
-  0x53, 0x72, 0x94, 0xAB, 0xB2, 0xA5, 0x87, 0x64, 0x4D, 0x48, 0x58, 0x79,
-  0x9A, 0xAF, 0xB1, 0xA1, 0x82, 0x60, 0x4C, 0x4B, 0x60, 0x81, 0xA1, 0xB1,
-  0xB1, 0x9D, 0x7D, 0x5D, 0x4D, 0x4F, 0x66, 0x89, 0xA6, 0xB4, 0xAF, 0x99,
-  0x77, 0x59, 0x4D, 0x54, 0x6D, 0x90, 0xAA, 0xB5, 0xAC, 0x93, 0x70, 0x55,
-  0x4B, 0x57, 0x74, 0x95, 0xAD, 0xB4, 0xA8, 0x8C, 0x69, 0x51, 0x49, 0x58,
-  0x77, 0x99, 0xAF, 0xB2, 0xA3, 0x83, 0x61, 0x4C, 0x49, 0x5C, 0x7D, 0x9E,
-  0xB1, 0xB1, 0x9E, 0x7E, 0x5D, 0x4B, 0x4E, 0x63, 0x86, 0xA4, 0xB3, 0xAF,
-  0x9A, 0x79, 0x5A, 0x4C, 0x51, 0x6A, 0x8D, 0xA8, 0xB3, 0xAD, 0x93, 0x71,
-  0x55, 0x49, 0x54, 0x74, 0x98, 0xAD, 0xAB, 0x90, 0x69, 0x4D, 0x4B, 0x63,
-  0x8A, 0xA9, 0xB1, 0xA0, 0x7F, 0x5D, 0x4F, 0x5C, 0x7D, 0xA0, 0xB2, 0xAA,
-  0x8C, 0x67, 0x4E, 0x50, 0x6C, 0x92, 0xAD, 0xB0, 0x9A, 0x75, 0x54, 0x4B,
-  0x5E, 0x82, 0xA3, 0xB2, 0xA6, 0x85, 0x60, 0x4B, 0x53, 0x73, 0x98, 0xAF,
-  0xAD, 0x94, 0x6F, 0x52, 0x4D, 0x65, 0x8A, 0xA8, 0xB1, 0xA1, 0x7E, 0x5C,
-  0x4C, 0x58, 0x79, 0x9D, 0xB0, 0xAA, 0x8E, 0x69, 0x4F, 0x4F, 0x6A, 0x90,
-  0xAB, 0xAF, 0x9B, 0x78, 0x57, 0x4C, 0x5D, 0x80, 0xA2, 0xB1, 0xA6, 0x86,
-  0x61, 0x4B, 0x51, 0x70, 0x95, 0xAD, 0xAD, 0x95, 0x6F, 0x51, 0x4B, 0x61,
-  0x86, 0xA6, 0xB1, 0xA2, 0x80, 0x5C, 0x4B, 0x57, 0x78, 0x9D, 0xB2, 0xAD,
-  0x91, 0x6C, 0x52, 0x52, 0x6B, 0x90, 0xAD, 0xB3, 0x9F, 0x7B, 0x59, 0x4D,
-  0x5D, 0x7F, 0xA1, 0xB1, 0xA8, 0x89, 0x64, 0x4D, 0x51, 0x6E, 0x93, 0xAC,
-  0xAD, 0x96, 0x72, 0x53, 0x4C, 0x61, 0x87, 0xA8, 0xB4, 0xA6, 0x84, 0x60,
-  0x4D, 0x57, 0x76, 0x9A, 0xB0, 0xAC, 0x91, 0x6B, 0x50, 0x4E, 0x66, 0x8C,
-  0xA9, 0xB0, 0x9E, 0x7B, 0x58, 0x49, 0x58, 0x7B, 0x9E, 0xB0, 0xA8, 0x89,
-  0x64, 0x4C, 0x4F, 0x6B, 0x91, 0xAC, 0xAF, 0x98, 0x74, 0x55, 0x4C, 0x5F,
-  0x83, 0xA4, 0xB1, 0xA5, 0x85, 0x60, 0x4E, 0x5F, 0x86, 0xA7, 0xAE, 0x96,
-  0x6E, 0x52, 0x56, 0x77, 0x9E, 0xB0, 0xA2, 0x7D, 0x59, 0x51, 0x6A, 0x91,
-  0xAC, 0xAA, 0x8B, 0x63, 0x4E, 0x5C, 0x82, 0xA5, 0xAE, 0x98, 0x70, 0x51,
-  0x53, 0x73, 0x9A, 0xAF, 0xA3, 0x7F, 0x59, 0x4E, 0x66, 0x8E, 0xAB, 0xAB,
-  0x8F, 0x67, 0x50, 0x5C, 0x80, 0xA4, 0xB0, 0x9C, 0x75, 0x55, 0x54, 0x72,
-  0x98, 0xAE, 0xA5, 0x82, 0x5B, 0x4D, 0x62, 0x89, 0xA8, 0xA9, 0x8D, 0x66,
-  0x4D, 0x54, 0x77, 0x9D, 0xAC, 0x9B, 0x75, 0x53, 0x50, 0x6E, 0x96, 0xAE,
-  0xA7, 0x85, 0x5E, 0x4E, 0x5F, 0x86, 0xA7, 0xAC, 0x92, 0x6A, 0x4E, 0x54,
-  0x77, 0x9D, 0xAE, 0x9F, 0x79, 0x55, 0x4E, 0x69, 0x91, 0xAC, 0xA8, 0x88,
-  0x61, 0x4E, 0x5D, 0x84, 0xA7, 0xAE, 0x96, 0x6F, 0x52, 0x55, 0x75, 0x9C,
-  0xB0, 0xA3, 0x7E, 0x5A, 0x51, 0x69, 0x91, 0xAD, 0xAB, 0x8D, 0x66, 0x51,
-  0x5D, 0x83, 0xA6, 0xB0, 0x9A, 0x73, 0x54, 0x55, 0x74, 0x9B, 0xAF, 0xA5,
-  0x82, 0x5C, 0x4F, 0x65, 0x8D, 0xAB, 0xAB, 0x8E, 0x66, 0x4E, 0x58, 0x7D,
-  0xA2, 0xAE, 0x9B, 0x74, 0x53, 0x51, 0x6E, 0x96, 0xAD, 0xA6, 0x83, 0x5D,
-  0x4E, 0x62, 0x89, 0xA9, 0xAD, 0x93, 0x6B, 0x51, 0x59, 0x7B, 0xA0, 0xB0,
-  0x9F, 0x79, 0x57, 0x51, 0x6C, 0x94, 0xAC, 0xA3, 0x7C, 0x57, 0x55, 0x76,
-  0x9D, 0xAA, 0x91, 0x66, 0x4D, 0x5F, 0x88, 0xA8, 0xA4, 0x80, 0x59, 0x55,
-  0x76, 0x9F, 0xAF, 0x98, 0x6E, 0x52, 0x60, 0x88, 0xA9, 0xA7, 0x84, 0x5B,
-  0x52, 0x70, 0x9A, 0xAD, 0x9A, 0x6F, 0x52, 0x5B, 0x84, 0xA7, 0xA8, 0x87,
-  0x5E, 0x50, 0x6C, 0x96, 0xAD, 0x9C, 0x73, 0x53, 0x59, 0x80, 0xA5, 0xAA,
-  0x8B, 0x61, 0x52, 0x6A, 0x93, 0xAB, 0x9F, 0x77, 0x55, 0x58, 0x7D, 0xA2,
-  0xAA, 0x8E, 0x64, 0x51, 0x67, 0x90, 0xAB, 0xA1, 0x7A, 0x56, 0x56, 0x79,
-  0xA0, 0xAB, 0x91, 0x67, 0x50, 0x62, 0x8C, 0xA9, 0xA3, 0x7D, 0x57, 0x53,
-  0x74, 0x9C, 0xAB, 0x94, 0x69, 0x4F, 0x5E, 0x88, 0xA9, 0xA5, 0x81, 0x5A,
-  0x53, 0x71, 0x9C, 0xAE, 0x99, 0x6F, 0x54, 0x60, 0x88, 0xAA, 0xA9, 0x88,
-  0x5F, 0x54, 0x71, 0x9A, 0xAE, 0x9D, 0x73, 0x55, 0x5D, 0x83, 0xA6, 0xA9,
-  0x8A, 0x5F, 0x51, 0x6A, 0x94, 0xAB, 0x9C, 0x73, 0x51, 0x56, 0x7D, 0xA4,
-  0xAA, 0x8E, 0x65, 0x54, 0x6A, 0x94, 0xAD, 0xA1, 0x79, 0x56, 0x57, 0x7B,
-  0xA2, 0xAB, 0x8F, 0x65, 0x50, 0x63, 0x8E, 0xAB, 0xA2, 0x7B, 0x56, 0x53,
-  0x75, 0x9F, 0xAC, 0x92, 0x67, 0x4F, 0x60, 0x8A, 0xA9, 0xA4, 0x7F, 0x58,
-  0x53, 0x73, 0x9C, 0xAC, 0x96, 0x6C, 0x52, 0x5F, 0x87, 0xA8, 0xA1, 0x78,
-  0x56, 0x61, 0x8A, 0xA9, 0x9F, 0x73, 0x55, 0x65, 0x8F, 0xAB, 0x9A, 0x6F,
-  0x55, 0x6A, 0x95, 0xAC, 0x97, 0x6A, 0x55, 0x6D, 0x98, 0xAB, 0x91, 0x65,
-  0x54, 0x71, 0x9C, 0xAA, 0x8C, 0x60, 0x54, 0x75, 0xA0, 0xA9, 0x87, 0x5D,
-  0x56, 0x7B, 0xA4, 0xA6, 0x82, 0x5A, 0x5B, 0x82, 0xA6, 0xA5, 0x7E, 0x5A,
-  0x5E, 0x88, 0xA9, 0xA2, 0x78, 0x58, 0x62, 0x8B, 0xAA, 0x9D, 0x72, 0x54,
-  0x63, 0x8E, 0xA8, 0x98, 0x6B, 0x51, 0x65, 0x92, 0xA7, 0x91, 0x64, 0x4F,
-  0x69, 0x96, 0xA8, 0x8F, 0x64, 0x56, 0x73, 0x9D, 0xAA, 0x8B, 0x5F, 0x55,
-  0x75, 0x9E, 0xA7, 0x85, 0x5B, 0x55, 0x7A, 0xA3, 0xA6, 0x80, 0x58, 0x58,
-  0x80, 0xA5, 0xA2, 0x7B, 0x56, 0x5C, 0x85, 0xA8, 0xA0, 0x77, 0x54, 0x60,
-  0x8B, 0xA9, 0x9D, 0x72, 0x55, 0x64, 0x90, 0xAB, 0x99, 0x6E, 0x55, 0x69,
-  0x96, 0xAB, 0x95, 0x6A, 0x55, 0x6F, 0x9B, 0xAB, 0x91, 0x65, 0x56, 0x74,
-  0x9E, 0xAB, 0x8C, 0x62, 0x57, 0x79, 0xA1, 0xA9, 0x87, 0x5D, 0x58, 0x7D,
-  0xA4, 0xA6, 0x80, 0x59, 0x59, 0x81, 0xA5, 0xA3, 0x7A, 0x56, 0x5B, 0x86,
-  0xA7, 0xA0, 0x76, 0x54, 0x60, 0x8B, 0xA9, 0x9C, 0x71, 0x55, 0x64, 0x90,
-  0xAB, 0x99, 0x6D, 0x55, 0x6A, 0x96, 0xAB, 0x94, 0x69, 0x55, 0x6E, 0x9A,
-  0xA6, 0x83, 0x5B, 0x5F, 0x8A, 0xA7, 0x92, 0x65, 0x56, 0x79, 0xA2, 0x9E,
-  0x72, 0x53, 0x66, 0x95, 0xA6, 0x85, 0x5D, 0x60, 0x8B, 0xAB, 0x98, 0x69,
-  0x58, 0x78, 0xA2, 0xA1, 0x78, 0x57, 0x67, 0x96, 0xA8, 0x89, 0x5D, 0x5C,
-  0x85, 0xA7, 0x98, 0x6A, 0x55, 0x74, 0xA0, 0xA3, 0x7A, 0x57, 0x65, 0x92,
-  0xA8, 0x8B, 0x5F, 0x5A, 0x82, 0xA6, 0x9A, 0x6D, 0x56, 0x73, 0x9F, 0xA4,
-  0x7D, 0x58, 0x63, 0x90, 0xA8, 0x8D, 0x61, 0x5A, 0x80, 0xA5, 0x9C, 0x6F,
-  0x56, 0x6F, 0x9B, 0xA5, 0x7F, 0x59, 0x62, 0x8E, 0xA8, 0x90, 0x63, 0x58,
-  0x7C, 0xA3, 0x9C, 0x70, 0x55, 0x6C, 0x99, 0xA6, 0x81, 0x59, 0x5E, 0x8A,
-  0xA7, 0x91, 0x64, 0x56, 0x79, 0xA3, 0xA0, 0x74, 0x56, 0x6A, 0x98, 0xA8,
-  0x87, 0x5D, 0x5F, 0x8B, 0xAA, 0x97, 0x6A, 0x5A, 0x7A, 0xA4, 0xA3, 0x79,
-  0x58, 0x6A, 0x97, 0xA9, 0x89, 0x5E, 0x5D, 0x87, 0xA8, 0x97, 0x69, 0x55,
-  0x73, 0x9E, 0xA1, 0x77, 0x55, 0x64, 0x93, 0xA8, 0x8A, 0x60, 0x5E, 0x86,
-  0xA8, 0x9B, 0x6D, 0x57, 0x74, 0x9F, 0xA5, 0x7D, 0x57, 0x63, 0x91, 0xA7,
-  0x8C, 0x60, 0x58, 0x80, 0xA6, 0x9B, 0x6E, 0x55, 0x6F, 0x9C, 0xA5, 0x7E,
-  0x58, 0x60, 0x8D, 0xA8, 0x8E, 0x62, 0x58, 0x7C, 0xA4, 0x9E, 0x6E, 0x58,
-  0x6A, 0x71, 0x5F, 0x57, 0x58, 0x55, 0x55, 0x58, 0x57, 0x59, 0x5B, 0x5A,
-  0x5C, 0x5E, 0x5D, 0x5E, 0x60, 0x60, 0x62, 0x63, 0x62, 0x63, 0x65, 0x65,
-  0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x68, 0x68, 0x69, 0x6A, 0x69, 0x69,
-  0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E,
-  0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x75,
-  0x75, 0x76, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A,
-  0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E,
-  0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F,
-  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x7F,
-  0x7F, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x83,
-  0x82, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85,
-  0x86, 0x85, 0x85, 0x86, 0x85, 0x86, 0x86, 0x87, 0x86, 0x86, 0x87, 0x86,
-  0x87, 0x87, 0x86, 0x87, 0x86, 0x86, 0x85, 0x86, 0x85, 0x85, 0x86, 0x85,
-  0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84,
-  0x83, 0x83, 0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84,
-  0x85, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x86, 0x85, 0x85, 0x86,
-  0x85, 0x86, 0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87,
-  0x87, 0x88, 0x87, 0x87, 0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x86,
-  0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x85, 0x85, 0x86, 0x85, 0x85, 0x84,
-  0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84,
-  0x85, 0x85, 0x84, 0x85, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85,
-  0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85,
-  0x84, 0x85, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84,
-  0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x83, 0x84,
-  0x83, 0x83, 0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83,
-  0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84,
-  0x84, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84,
-  0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84, 0x84, 0x83, 0x84, 0x83,
-  0x84, 0x84, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82,
-  0x83, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82,
-  0x82, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x83,
-  0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x82,
-  0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x82, 0x81, 0x81, 0x80, 0x4C, 0x49, 0x53, 0x54, 0x3C, 0x00, 0x00, 0x00,
-  0x49, 0x4E, 0x46, 0x4F, 0x49, 0x53, 0x46, 0x54, 0x30, 0x00, 0x00, 0x00,
-  0x57, 0x48, 0x41, 0x4D, 0x20, 0x31, 0x2E, 0x33, 0x31, 0x20, 0x62, 0x79,
-  0x20, 0x41, 0x6E, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75, 0x6C, 0x68,
-  0x61, 0x6B, 0x20, 0x28, 0x6C, 0x69, 0x62, 0x73, 0x6E, 0x64, 0x66, 0x69,
-  0x6C, 0x65, 0x2D, 0x31, 0x2E, 0x30, 0x2E, 0x32, 0x34, 0x29, 0x00, 0x00,
-  0x69, 0x64, 0x33, 0x20, 0x38, 0x00, 0x00, 0x00, 0x49, 0x44, 0x33, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x54, 0x58, 0x58, 0x58, 0x00, 0x00,
-  0x00, 0x24, 0x00, 0x00, 0x00, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x00, 0x57, 0x48, 0x41, 0x4D, 0x20, 0x31, 0x2E, 0x33, 0x31, 0x20,
-  0x62, 0x79, 0x20, 0x41, 0x6E, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75,
-  0x6C, 0x68, 0x61, 0x6B
-};
-
-
-uint8_t chomp[5920] = {
-  0x52, 0x49, 0x46, 0x46, 0x18, 0x17, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-  0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0x40, 0x1f, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-  0x64, 0x61, 0x74, 0x61, 0x64, 0x16, 0x00, 0x00, 0x81, 0x81, 0x7e, 0x7e,
-  0x81, 0x82, 0x82, 0x81, 0x7f, 0x7c, 0x7c, 0x7b, 0x7d, 0x7d, 0x7d, 0x7c,
-  0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x81, 0x80, 0x7f, 0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x82, 0x82, 0x82, 0x80,
-  0x7d, 0x7c, 0x7a, 0x76, 0x75, 0x7a, 0x82, 0x8b, 0x8f, 0x90, 0x91, 0x8c,
-  0x84, 0x7d, 0x79, 0x75, 0x72, 0x70, 0x72, 0x75, 0x74, 0x77, 0x7d, 0x85,
-  0x89, 0x8b, 0x8d, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x83, 0x7d, 0x78, 0x74,
-  0x71, 0x71, 0x73, 0x74, 0x74, 0x78, 0x82, 0x88, 0x8b, 0x8c, 0x8c, 0x8d,
-  0x8c, 0x8a, 0x87, 0x82, 0x7c, 0x75, 0x70, 0x6f, 0x6f, 0x72, 0x73, 0x73,
-  0x78, 0x83, 0x8a, 0x8b, 0x89, 0x89, 0x8a, 0x8c, 0x8c, 0x8a, 0x85, 0x7b,
-  0x72, 0x6e, 0x6c, 0x6c, 0x6f, 0x71, 0x74, 0x7c, 0x86, 0x8b, 0x8d, 0x8d,
-  0x8d, 0x8e, 0x8e, 0x8d, 0x88, 0x82, 0x7a, 0x73, 0x6f, 0x6d, 0x6e, 0x6f,
-  0x6f, 0x74, 0x7e, 0x89, 0x8c, 0x8b, 0x8b, 0x8c, 0x8e, 0x90, 0x8e, 0x89,
-  0x82, 0x7a, 0x74, 0x71, 0x6e, 0x6c, 0x6c, 0x6d, 0x71, 0x7d, 0x8a, 0x8f,
-  0x8f, 0x8e, 0x8d, 0x8d, 0x8e, 0x8c, 0x88, 0x7f, 0x76, 0x71, 0x6f, 0x6e,
-  0x6f, 0x71, 0x70, 0x72, 0x7b, 0x88, 0x8e, 0x90, 0x8f, 0x8e, 0x8e, 0x8f,
-  0x8d, 0x87, 0x7c, 0x70, 0x6a, 0x6c, 0x6f, 0x72, 0x74, 0x76, 0x7d, 0x88,
-  0x91, 0x94, 0x94, 0x90, 0x8a, 0x86, 0x85, 0x82, 0x77, 0x6d, 0x68, 0x6a,
-  0x70, 0x74, 0x7a, 0x7f, 0x85, 0x8a, 0x8f, 0x93, 0x93, 0x90, 0x8a, 0x85,
-  0x81, 0x7b, 0x74, 0x6c, 0x68, 0x6a, 0x70, 0x77, 0x80, 0x86, 0x89, 0x8a,
-  0x8c, 0x90, 0x90, 0x8b, 0x86, 0x80, 0x76, 0x71, 0x6f, 0x6f, 0x6f, 0x6f,
-  0x74, 0x7c, 0x84, 0x88, 0x8a, 0x8a, 0x8b, 0x8a, 0x8a, 0x89, 0x83, 0x7a,
-  0x71, 0x6f, 0x70, 0x73, 0x74, 0x75, 0x79, 0x80, 0x88, 0x8d, 0x8f, 0x8e,
-  0x8c, 0x8a, 0x8a, 0x87, 0x7e, 0x73, 0x6e, 0x6e, 0x70, 0x72, 0x75, 0x7a,
-  0x81, 0x86, 0x8a, 0x8d, 0x8f, 0x8d, 0x89, 0x88, 0x86, 0x80, 0x77, 0x70,
-  0x6d, 0x6f, 0x71, 0x75, 0x7a, 0x81, 0x86, 0x89, 0x8c, 0x8d, 0x8e, 0x8a,
-  0x88, 0x85, 0x7e, 0x77, 0x72, 0x70, 0x70, 0x72, 0x75, 0x7a, 0x83, 0x89,
-  0x8c, 0x8c, 0x8c, 0x8a, 0x86, 0x82, 0x7c, 0x78, 0x74, 0x73, 0x75, 0x77,
-  0x7c, 0x84, 0x89, 0x8a, 0x88, 0x88, 0x88, 0x87, 0x82, 0x7a, 0x75, 0x72,
-  0x73, 0x76, 0x79, 0x7c, 0x82, 0x8a, 0x8c, 0x8a, 0x88, 0x86, 0x83, 0x81,
-  0x7d, 0x76, 0x71, 0x6e, 0x71, 0x77, 0x7d, 0x83, 0x89, 0x8d, 0x8d, 0x8c,
-  0x8b, 0x88, 0x83, 0x7d, 0x76, 0x71, 0x6d, 0x6a, 0x6e, 0x75, 0x7e, 0x86,
-  0x8d, 0x8f, 0x8d, 0x8d, 0x8c, 0x88, 0x82, 0x78, 0x6f, 0x6c, 0x6c, 0x6e,
-  0x72, 0x77, 0x7d, 0x87, 0x8f, 0x90, 0x8f, 0x8c, 0x8a, 0x87, 0x82, 0x78,
-  0x6f, 0x6c, 0x6c, 0x71, 0x76, 0x7b, 0x81, 0x8a, 0x8f, 0x90, 0x8f, 0x8c,
-  0x88, 0x85, 0x7f, 0x78, 0x71, 0x6c, 0x6d, 0x73, 0x79, 0x7e, 0x84, 0x8a,
-  0x8d, 0x8d, 0x8d, 0x8a, 0x85, 0x81, 0x79, 0x74, 0x71, 0x6f, 0x71, 0x75,
-  0x7b, 0x82, 0x8a, 0x8e, 0x8d, 0x8a, 0x88, 0x88, 0x84, 0x7b, 0x73, 0x6d,
-  0x6d, 0x73, 0x78, 0x7f, 0x87, 0x8f, 0x92, 0x8e, 0x89, 0x86, 0x82, 0x79,
-  0x70, 0x6d, 0x6c, 0x70, 0x75, 0x7d, 0x89, 0x93, 0x95, 0x91, 0x8c, 0x88,
-  0x85, 0x7d, 0x72, 0x6a, 0x69, 0x6e, 0x73, 0x78, 0x81, 0x8e, 0x97, 0x97,
-  0x8f, 0x8a, 0x87, 0x81, 0x76, 0x6d, 0x6a, 0x6d, 0x71, 0x74, 0x7c, 0x89,
-  0x94, 0x95, 0x8f, 0x8a, 0x89, 0x88, 0x7c, 0x6e, 0x68, 0x6a, 0x6f, 0x74,
-  0x79, 0x83, 0x8f, 0x94, 0x91, 0x8c, 0x88, 0x86, 0x7e, 0x74, 0x6d, 0x6a,
-  0x6d, 0x70, 0x74, 0x7e, 0x8b, 0x94, 0x95, 0x8f, 0x87, 0x85, 0x80, 0x77,
-  0x70, 0x6b, 0x6b, 0x6f, 0x74, 0x7b, 0x87, 0x92, 0x96, 0x92, 0x8c, 0x87,
-  0x83, 0x79, 0x71, 0x6c, 0x6c, 0x6f, 0x72, 0x79, 0x84, 0x91, 0x96, 0x93,
-  0x8c, 0x88, 0x87, 0x7d, 0x71, 0x6a, 0x6b, 0x70, 0x75, 0x78, 0x7f, 0x8c,
-  0x97, 0x97, 0x91, 0x89, 0x85, 0x80, 0x75, 0x6d, 0x6a, 0x6f, 0x73, 0x78,
-  0x80, 0x8c, 0x95, 0x96, 0x91, 0x8a, 0x83, 0x77, 0x6e, 0x68, 0x6a, 0x6e,
-  0x75, 0x7f, 0x8b, 0x93, 0x95, 0x92, 0x8e, 0x86, 0x79, 0x6f, 0x6a, 0x6b,
-  0x6e, 0x72, 0x7c, 0x88, 0x91, 0x94, 0x92, 0x8f, 0x89, 0x7e, 0x71, 0x6a,
-  0x6c, 0x6e, 0x70, 0x78, 0x85, 0x91, 0x96, 0x92, 0x8d, 0x87, 0x81, 0x76,
-  0x6d, 0x6b, 0x6f, 0x74, 0x7c, 0x85, 0x8f, 0x95, 0x92, 0x8c, 0x85, 0x7d,
-  0x74, 0x6f, 0x6d, 0x6d, 0x70, 0x78, 0x85, 0x90, 0x94, 0x91, 0x8e, 0x89,
-  0x80, 0x76, 0x6e, 0x6c, 0x6e, 0x70, 0x74, 0x7e, 0x8b, 0x92, 0x94, 0x90,
-  0x8a, 0x82, 0x79, 0x70, 0x6b, 0x6d, 0x70, 0x74, 0x7d, 0x88, 0x8f, 0x90,
-  0x8f, 0x8c, 0x86, 0x7d, 0x71, 0x6d, 0x6e, 0x71, 0x73, 0x7b, 0x86, 0x8f,
-  0x91, 0x8f, 0x8b, 0x85, 0x7d, 0x74, 0x6f, 0x70, 0x73, 0x75, 0x7a, 0x85,
-  0x8e, 0x90, 0x8e, 0x8b, 0x86, 0x7e, 0x76, 0x71, 0x71, 0x74, 0x78, 0x7e,
-  0x88, 0x91, 0x91, 0x8d, 0x88, 0x7f, 0x74, 0x6c, 0x6a, 0x71, 0x78, 0x7f,
-  0x8a, 0x94, 0x99, 0x92, 0x8a, 0x81, 0x76, 0x6a, 0x64, 0x67, 0x72, 0x7b,
-  0x86, 0x93, 0x9b, 0x97, 0x8d, 0x83, 0x78, 0x6c, 0x64, 0x65, 0x6e, 0x78,
-  0x83, 0x8f, 0x9a, 0x9b, 0x93, 0x8b, 0x7c, 0x6d, 0x63, 0x62, 0x6a, 0x74,
-  0x7e, 0x8c, 0x9a, 0x9f, 0x98, 0x90, 0x85, 0x75, 0x67, 0x60, 0x65, 0x6f,
-  0x79, 0x86, 0x94, 0x9e, 0x9c, 0x95, 0x8a, 0x7a, 0x69, 0x5f, 0x63, 0x6c,
-  0x75, 0x7f, 0x8d, 0x9b, 0x9c, 0x94, 0x8c, 0x7e, 0x6e, 0x62, 0x60, 0x68,
-  0x72, 0x7d, 0x8a, 0x96, 0x9b, 0x98, 0x91, 0x84, 0x73, 0x64, 0x5f, 0x63,
-  0x6d, 0x79, 0x86, 0x95, 0x9c, 0x9a, 0x94, 0x89, 0x78, 0x68, 0x5e, 0x5f,
-  0x69, 0x76, 0x83, 0x91, 0x9c, 0x9e, 0x98, 0x8d, 0x7d, 0x6d, 0x61, 0x61,
-  0x69, 0x73, 0x7f, 0x8e, 0x9a, 0x9f, 0x9b, 0x90, 0x81, 0x70, 0x64, 0x60,
-  0x66, 0x72, 0x82, 0x90, 0x9b, 0x9d, 0x98, 0x8e, 0x7b, 0x6b, 0x60, 0x5f,
-  0x69, 0x78, 0x89, 0x97, 0x9e, 0x9c, 0x93, 0x85, 0x73, 0x64, 0x5f, 0x65,
-  0x71, 0x7f, 0x8e, 0x9b, 0x9c, 0x94, 0x8b, 0x7e, 0x6e, 0x61, 0x62, 0x6b,
-  0x75, 0x83, 0x94, 0x9d, 0x99, 0x8e, 0x82, 0x77, 0x6a, 0x63, 0x68, 0x72,
-  0x7d, 0x8a, 0x97, 0x9c, 0x94, 0x88, 0x7c, 0x71, 0x69, 0x67, 0x6b, 0x75,
-  0x82, 0x91, 0x99, 0x98, 0x90, 0x84, 0x77, 0x6b, 0x67, 0x6c, 0x73, 0x7c,
-  0x89, 0x93, 0x96, 0x93, 0x89, 0x7d, 0x71, 0x69, 0x6b, 0x70, 0x79, 0x84,
-  0x91, 0x95, 0x91, 0x8b, 0x80, 0x73, 0x69, 0x6b, 0x72, 0x78, 0x80, 0x8b,
-  0x92, 0x90, 0x88, 0x7f, 0x75, 0x6c, 0x6a, 0x73, 0x7a, 0x81, 0x8a, 0x93,
-  0x94, 0x8c, 0x82, 0x77, 0x6d, 0x66, 0x6c, 0x77, 0x81, 0x8a, 0x92, 0x95,
-  0x90, 0x87, 0x7d, 0x71, 0x68, 0x69, 0x72, 0x7c, 0x86, 0x92, 0x99, 0x95,
-  0x8a, 0x7d, 0x72, 0x69, 0x66, 0x6e, 0x7c, 0x89, 0x94, 0x9c, 0x98, 0x8a,
-  0x7a, 0x6d, 0x65, 0x64, 0x6e, 0x7e, 0x8d, 0x97, 0x9d, 0x96, 0x85, 0x75,
-  0x6a, 0x62, 0x63, 0x6e, 0x80, 0x8f, 0x99, 0x9d, 0x96, 0x84, 0x73, 0x68,
-  0x63, 0x65, 0x71, 0x83, 0x92, 0x9c, 0x9d, 0x95, 0x84, 0x71, 0x65, 0x62,
-  0x68, 0x75, 0x85, 0x92, 0x9a, 0x99, 0x8f, 0x80, 0x71, 0x68, 0x67, 0x6e,
-  0x78, 0x85, 0x91, 0x98, 0x95, 0x8b, 0x7d, 0x71, 0x69, 0x69, 0x70, 0x7d,
-  0x89, 0x92, 0x95, 0x91, 0x86, 0x7b, 0x70, 0x6a, 0x6b, 0x74, 0x82, 0x8b,
-  0x91, 0x91, 0x8e, 0x83, 0x79, 0x72, 0x6e, 0x6e, 0x76, 0x83, 0x8b, 0x90,
-  0x90, 0x89, 0x7f, 0x76, 0x70, 0x6e, 0x71, 0x79, 0x85, 0x8e, 0x90, 0x8c,
-  0x83, 0x77, 0x70, 0x6d, 0x6f, 0x75, 0x7f, 0x89, 0x8f, 0x90, 0x8a, 0x7e,
-  0x73, 0x6c, 0x6c, 0x71, 0x7a, 0x84, 0x88, 0x86, 0x83, 0x87, 0x8b, 0x8b,
-  0x89, 0x87, 0x89, 0x86, 0x7a, 0x6e, 0x70, 0x74, 0x70, 0x6a, 0x67, 0x6d,
-  0x75, 0x80, 0x90, 0x9f, 0xa3, 0x9b, 0x90, 0x84, 0x7d, 0x82, 0x8e, 0x93,
-  0x91, 0x8b, 0x82, 0x72, 0x60, 0x51, 0x4d, 0x53, 0x5d, 0x6f, 0x82, 0x93,
-  0x9e, 0x9f, 0x96, 0x8c, 0x8c, 0x8f, 0x8c, 0x7f, 0x75, 0x74, 0x80, 0x86,
-  0x82, 0x80, 0x84, 0x86, 0x77, 0x6a, 0x6c, 0x76, 0x7c, 0x78, 0x71, 0x6f,
-  0x6e, 0x70, 0x7c, 0x92, 0xa6, 0xaf, 0xaa, 0x92, 0x79, 0x72, 0x7d, 0x87,
-  0x8b, 0x8d, 0x8d, 0x8a, 0x7d, 0x69, 0x52, 0x46, 0x45, 0x4d, 0x62, 0x80,
-  0x9d, 0xaa, 0xaa, 0x9d, 0x8e, 0x87, 0x81, 0x71, 0x62, 0x68, 0x81, 0x9b,
-  0xa3, 0x9c, 0x8a, 0x7d, 0x6a, 0x56, 0x51, 0x61, 0x78, 0x85, 0x8c, 0x89,
-  0x7f, 0x73, 0x6c, 0x70, 0x83, 0x9d, 0xb4, 0xb6, 0xa5, 0x93, 0x86, 0x81,
-  0x7c, 0x75, 0x71, 0x78, 0x81, 0x80, 0x79, 0x66, 0x52, 0x46, 0x49, 0x5b,
-  0x7b, 0xa0, 0xb8, 0xb9, 0x9f, 0x82, 0x71, 0x67, 0x67, 0x6a, 0x7b, 0x98,
-  0xa8, 0x94, 0x6d, 0x57, 0x54, 0x5e, 0x70, 0x86, 0x99, 0xa1, 0xa1, 0xa4,
-  0xa5, 0x9b, 0x86, 0x6f, 0x5a, 0x4f, 0x5e, 0x7c, 0x8b, 0x8b, 0x87, 0x87,
-  0x8d, 0x91, 0x85, 0x77, 0x7e, 0x8c, 0x91, 0x83, 0x72, 0x6e, 0x6c, 0x5d,
-  0x4e, 0x5d, 0x7d, 0x8f, 0x8c, 0x89, 0x8b, 0x85, 0x82, 0x8c, 0x9c, 0xa9,
-  0xae, 0xa4, 0x8a, 0x64, 0x47, 0x3f, 0x4d, 0x64, 0x82, 0xa0, 0xb3, 0xb1,
-  0x92, 0x6b, 0x5b, 0x61, 0x6f, 0x79, 0x87, 0xa1, 0xae, 0x94, 0x66, 0x4c,
-  0x4e, 0x5e, 0x6e, 0x83, 0x9e, 0xa9, 0xa2, 0x99, 0x90, 0x83, 0x7d, 0x7b,
-  0x72, 0x6b, 0x70, 0x78, 0x77, 0x70, 0x6f, 0x7a, 0x90, 0xa4, 0xa2, 0x91,
-  0x85, 0x7e, 0x7b, 0x73, 0x6a, 0x76, 0x89, 0x80, 0x68, 0x63, 0x6e, 0x73,
-  0x6e, 0x6b, 0x79, 0x88, 0x92, 0xa4, 0xb4, 0xb5, 0xa4, 0x86, 0x62, 0x45,
-  0x47, 0x63, 0x84, 0xa2, 0xb3, 0xa4, 0x87, 0x71, 0x5f, 0x5b, 0x60, 0x6e,
-  0x83, 0x8c, 0x78, 0x60, 0x65, 0x75, 0x89, 0xa3, 0xb7, 0xb9, 0x9e, 0x77,
-  0x5e, 0x52, 0x52, 0x5e, 0x74, 0x90, 0xa8, 0xaf, 0xa3, 0x92, 0x7e, 0x70,
-  0x65, 0x66, 0x75, 0x80, 0x7c, 0x68, 0x61, 0x69, 0x78, 0x90, 0xa8, 0xb9,
-  0xb1, 0x92, 0x74, 0x5e, 0x4d, 0x4a, 0x62, 0x81, 0x9c, 0xb0, 0xaf, 0x9a,
-  0x80, 0x6d, 0x5b, 0x59, 0x6f, 0x81, 0x85, 0x79, 0x6e, 0x75, 0x86, 0x94,
-  0x9e, 0xa8, 0xa3, 0x8d, 0x7d, 0x70, 0x58, 0x43, 0x49, 0x6b, 0x95, 0xb4,
-  0xbb, 0xaa, 0x8d, 0x74, 0x63, 0x56, 0x5b, 0x73, 0x83, 0x7e, 0x74, 0x75,
-  0x7b, 0x81, 0x84, 0x95, 0xa6, 0x9d, 0x85, 0x78, 0x6d, 0x5f, 0x5b, 0x6f,
-  0x87, 0x98, 0xa7, 0xa8, 0x9a, 0x82, 0x6a, 0x53, 0x53, 0x6e, 0x85, 0x85,
-  0x7c, 0x7d, 0x84, 0x89, 0x88, 0x8d, 0x9c, 0x99, 0x83, 0x76, 0x72, 0x67,
-  0x61, 0x75, 0x88, 0x87, 0x90, 0x9b, 0x95, 0x83, 0x69, 0x59, 0x59, 0x5f,
-  0x65, 0x7e, 0xa1, 0xb8, 0xb8, 0x9f, 0x7b, 0x59, 0x46, 0x47, 0x64, 0x8b,
-  0xa7, 0xb7, 0xb1, 0x97, 0x7d, 0x5f, 0x4d, 0x50, 0x5b, 0x63, 0x71, 0x8f,
-  0xab, 0xb9, 0xb2, 0x96, 0x6e, 0x50, 0x49, 0x61, 0x89, 0xa4, 0xac, 0xae,
-  0x99, 0x78, 0x58, 0x4b, 0x56, 0x6f, 0x89, 0x91, 0x90, 0x8f, 0x91, 0x8f,
-  0x85, 0x73, 0x61, 0x57, 0x6b, 0x94, 0xae, 0xad, 0x9f, 0x84, 0x64, 0x4f,
-  0x53, 0x78, 0x95, 0x93, 0x78, 0x68, 0x6f, 0x83, 0x9c, 0xa5, 0x9b, 0x86,
-  0x69, 0x55, 0x63, 0x7c, 0x87, 0x92, 0x99, 0x91, 0x8a, 0x80, 0x76, 0x6e,
-  0x66, 0x58, 0x58, 0x76, 0x93, 0xae, 0xba, 0xa8, 0x85, 0x62, 0x43, 0x3f,
-  0x66, 0x8c, 0xa7, 0xc0, 0xb9, 0x95, 0x6a, 0x4c, 0x4a, 0x5a, 0x6b, 0x74,
-  0x8d, 0xa7, 0xb1, 0xab, 0x96, 0x78, 0x5e, 0x4e, 0x4e, 0x6d, 0x91, 0xa8,
-  0xb7, 0xae, 0x8a, 0x54, 0x32, 0x40, 0x66, 0x90, 0xac, 0xbd, 0xb7, 0x91,
-  0x5b, 0x3e, 0x50, 0x70, 0x86, 0x9e, 0xb5, 0xba, 0xa3, 0x6e, 0x3e, 0x32,
-  0x4a, 0x69, 0x84, 0xb0, 0xc9, 0xbd, 0x95, 0x67, 0x47, 0x49, 0x56, 0x6d,
-  0x97, 0xbc, 0xc8, 0xa2, 0x70, 0x47, 0x3a, 0x55, 0x70, 0x93, 0xa6, 0xa5,
-  0x98, 0x83, 0x79, 0x75, 0x6d, 0x6d, 0x7f, 0x89, 0x92, 0x91, 0x82, 0x74,
-  0x6e, 0x73, 0x74, 0x7f, 0x8c, 0x8c, 0x83, 0x74, 0x75, 0x88, 0x92, 0x8d,
-  0x8b, 0x84, 0x7e, 0x6e, 0x5a, 0x54, 0x66, 0x89, 0xa4, 0xb7, 0xab, 0x88,
-  0x5f, 0x40, 0x43, 0x72, 0x9f, 0xaa, 0xb0, 0xa7, 0x94, 0x77, 0x52, 0x3a,
-  0x3b, 0x64, 0x8e, 0xb5, 0xcc, 0xbc, 0x89, 0x54, 0x3b, 0x4c, 0x72, 0x91,
-  0xae, 0xb1, 0xa6, 0x8c, 0x66, 0x49, 0x40, 0x53, 0x6d, 0x98, 0xbf, 0xc1,
-  0xa2, 0x71, 0x4d, 0x4f, 0x69, 0x81, 0x99, 0x9d, 0x9a, 0x93, 0x86, 0x7a,
-  0x6c, 0x6d, 0x6b, 0x6b, 0x6e, 0x73, 0x80, 0x86, 0x8e, 0x98, 0x99, 0x8f,
-  0x7c, 0x5f, 0x58, 0x6e, 0x90, 0x9a, 0x8e, 0x8d, 0x8d, 0x8a, 0x84, 0x7b,
-  0x71, 0x60, 0x5d, 0x74, 0x99, 0xad, 0xa2, 0x85, 0x70, 0x68, 0x6c, 0x72,
-  0x70, 0x75, 0x7e, 0x8b, 0x92, 0x90, 0x87, 0x70, 0x61, 0x6c, 0x7f, 0x87,
-  0x82, 0x77, 0x75, 0x7e, 0x8c, 0x93, 0x8d, 0x7e, 0x71, 0x6f, 0x75, 0x7e,
-  0x82, 0x7e, 0x7f, 0x8d, 0x99, 0x95, 0x84, 0x6c, 0x5c, 0x62, 0x7a, 0x8f,
-  0x9a, 0x9c, 0x94, 0x85, 0x77, 0x6a, 0x63, 0x68, 0x73, 0x86, 0x99, 0xa0,
-  0x97, 0x85, 0x74, 0x69, 0x68, 0x6e, 0x77, 0x84, 0x8d, 0x8c, 0x8a, 0x88,
-  0x80, 0x74, 0x70, 0x73, 0x78, 0x7e, 0x84, 0x88, 0x88, 0x85, 0x81, 0x7e,
-  0x79, 0x78, 0x78, 0x76, 0x76, 0x7d, 0x80, 0x82, 0x8c, 0x91, 0x8a, 0x7c,
-  0x6d, 0x69, 0x6f, 0x79, 0x84, 0x8e, 0x93, 0x90, 0x87, 0x7a, 0x70, 0x6d,
-  0x6c, 0x6e, 0x7c, 0x8c, 0x92, 0x93, 0x8d, 0x87, 0x80, 0x75, 0x6f, 0x72,
-  0x77, 0x7b, 0x7f, 0x86, 0x8e, 0x91, 0x8e, 0x86, 0x81, 0x7a, 0x70, 0x6d,
-  0x70, 0x74, 0x7e, 0x8c, 0x95, 0x95, 0x90, 0x87, 0x7b, 0x6d, 0x64, 0x67,
-  0x6c, 0x76, 0x8a, 0x9c, 0xa1, 0x9c, 0x8d, 0x77, 0x64, 0x5a, 0x5c, 0x6b,
-  0x7e, 0x8e, 0x9b, 0x9c, 0x96, 0x8d, 0x7c, 0x67, 0x5c, 0x60, 0x6d, 0x7c,
-  0x8b, 0x9a, 0xa0, 0x98, 0x8a, 0x80, 0x75, 0x67, 0x60, 0x66, 0x73, 0x83,
-  0x90, 0x9a, 0x9d, 0x97, 0x88, 0x79, 0x6a, 0x62, 0x67, 0x6d, 0x76, 0x87,
-  0x9b, 0xa1, 0x99, 0x8a, 0x78, 0x6b, 0x5e, 0x5d, 0x6a, 0x79, 0x88, 0x99,
-  0xa0, 0x99, 0x8d, 0x7c, 0x6c, 0x63, 0x63, 0x6a, 0x76, 0x84, 0x92, 0x9d,
-  0x9a, 0x8e, 0x83, 0x78, 0x6b, 0x63, 0x68, 0x75, 0x81, 0x8b, 0x95, 0x98,
-  0x92, 0x88, 0x7d, 0x70, 0x65, 0x66, 0x6d, 0x76, 0x84, 0x91, 0x9a, 0x96,
-  0x8e, 0x85, 0x7a, 0x6b, 0x62, 0x69, 0x73, 0x79, 0x84, 0x91, 0x96, 0x95,
-  0x90, 0x88, 0x7d, 0x6f, 0x67, 0x6a, 0x70, 0x79, 0x86, 0x8f, 0x93, 0x93,
-  0x90, 0x8b, 0x80, 0x72, 0x66, 0x66, 0x6d, 0x76, 0x82, 0x8d, 0x95, 0x97,
-  0x91, 0x8a, 0x81, 0x73, 0x67, 0x65, 0x6d, 0x74, 0x7a, 0x83, 0x91, 0x98,
-  0x94, 0x8f, 0x86, 0x78, 0x68, 0x64, 0x6b, 0x72, 0x78, 0x80, 0x8d, 0x97,
-  0x95, 0x90, 0x8a, 0x7d, 0x6d, 0x64, 0x65, 0x6b, 0x74, 0x82, 0x90, 0x99,
-  0x99, 0x94, 0x8f, 0x81, 0x70, 0x64, 0x62, 0x68, 0x72, 0x81, 0x90, 0x9c,
-  0x9e, 0x98, 0x8f, 0x7e, 0x6d, 0x62, 0x60, 0x67, 0x71, 0x7e, 0x8d, 0x99,
-  0x9c, 0x97, 0x8e, 0x80, 0x72, 0x66, 0x62, 0x6a, 0x72, 0x7c, 0x86, 0x90,
-  0x96, 0x94, 0x91, 0x89, 0x7b, 0x6d, 0x66, 0x67, 0x6d, 0x74, 0x7f, 0x8d,
-  0x97, 0x9b, 0x98, 0x8e, 0x7f, 0x6f, 0x63, 0x61, 0x67, 0x6e, 0x79, 0x88,
-  0x97, 0x9f, 0x9e, 0x96, 0x86, 0x74, 0x65, 0x5f, 0x61, 0x68, 0x70, 0x7e,
-  0x91, 0xa0, 0xa3, 0x9d, 0x91, 0x81, 0x70, 0x62, 0x5d, 0x63, 0x6c, 0x76,
-  0x87, 0x9a, 0xa4, 0xa0, 0x95, 0x88, 0x7b, 0x6e, 0x63, 0x62, 0x6a, 0x73,
-  0x7c, 0x8a, 0x98, 0x9e, 0x98, 0x8e, 0x83, 0x78, 0x6c, 0x65, 0x69, 0x71,
-  0x77, 0x7d, 0x87, 0x91, 0x96, 0x93, 0x8b, 0x81, 0x79, 0x73, 0x6e, 0x6d,
-  0x71, 0x76, 0x7a, 0x82, 0x8a, 0x8e, 0x8d, 0x8a, 0x84, 0x7f, 0x7a, 0x73,
-  0x6f, 0x6f, 0x74, 0x78, 0x7e, 0x86, 0x8c, 0x8d, 0x8a, 0x88, 0x85, 0x7f,
-  0x75, 0x6e, 0x6f, 0x74, 0x76, 0x7b, 0x86, 0x8e, 0x90, 0x8f, 0x8c, 0x86,
-  0x7d, 0x73, 0x6f, 0x71, 0x75, 0x75, 0x7a, 0x83, 0x8c, 0x90, 0x8e, 0x8b,
-  0x86, 0x80, 0x78, 0x71, 0x6f, 0x71, 0x72, 0x75, 0x7e, 0x89, 0x90, 0x91,
-  0x90, 0x8b, 0x83, 0x77, 0x6d, 0x6a, 0x6d, 0x74, 0x7e, 0x84, 0x82, 0x7b,
-  0x78, 0x80, 0x8f, 0x9f, 0xa1, 0x93, 0x7c, 0x66, 0x5e, 0x63, 0x6f, 0x8a,
-  0xa8, 0xb1, 0x99, 0x67, 0x4b, 0x56, 0x72, 0x86, 0x97, 0x9a, 0x81, 0x5f,
-  0x53, 0x68, 0x84, 0x9c, 0xac, 0xad, 0x91, 0x60, 0x4b, 0x58, 0x72, 0x84,
-  0x99, 0xa4, 0x8f, 0x70, 0x66, 0x79, 0x8b, 0x91, 0x9c, 0xab, 0x9d, 0x67,
-  0x43, 0x50, 0x70, 0x89, 0x98, 0x9d, 0x91, 0x79, 0x69, 0x71, 0x85, 0x91,
-  0x98, 0xa1, 0x95, 0x69, 0x42, 0x44, 0x5b, 0x78, 0x96, 0xad, 0xaa, 0x8d,
-  0x6f, 0x68, 0x79, 0x84, 0x87, 0x90, 0x8c, 0x6d, 0x49, 0x4a, 0x68, 0x87,
-  0xa1, 0xb4, 0xae, 0x91, 0x70, 0x5b, 0x5d, 0x6c, 0x79, 0x90, 0x9e, 0x89,
-  0x62, 0x53, 0x69, 0x88, 0xa1, 0xb0, 0xab, 0x8c, 0x61, 0x4b, 0x56, 0x74,
-  0x89, 0x95, 0x9f, 0x97, 0x7c, 0x60, 0x62, 0x79, 0x90, 0xa6, 0xa7, 0x8f,
-  0x6a, 0x4f, 0x51, 0x6a, 0x85, 0x98, 0xac, 0xac, 0x8d, 0x65, 0x55, 0x67,
-  0x77, 0x87, 0x98, 0x9f, 0x8f, 0x6c, 0x4d, 0x51, 0x77, 0x93, 0x9a, 0x9f,
-  0xa4, 0xa6, 0x90, 0x6b, 0x4b, 0x4a, 0x5c, 0x67, 0x7e, 0x9c, 0xab, 0x9f,
-  0x8a, 0x75, 0x66, 0x66, 0x72, 0x8b, 0xa1, 0xac, 0xa2, 0x86, 0x55, 0x31,
-  0x40, 0x68, 0x81, 0x91, 0xa7, 0xb7, 0xae, 0x8a, 0x63, 0x63, 0x70, 0x73,
-  0x79, 0x8a, 0xa3, 0xaa, 0x94, 0x5e, 0x3b, 0x45, 0x68, 0x85, 0x9d, 0xb5,
-  0xb5, 0xa6, 0x88, 0x5e, 0x4f, 0x56, 0x63, 0x74, 0x8d, 0xae, 0xb8, 0xa6,
-  0x69, 0x41, 0x4f, 0x71, 0x84, 0x8f, 0xa6, 0xa2, 0x8d, 0x73, 0x5f, 0x5e,
-  0x64, 0x6e, 0x7b, 0x98, 0xb6, 0xbd, 0xa9, 0x6c, 0x3a, 0x40, 0x6a, 0x7e,
-  0x7e, 0x8a, 0x91, 0x95, 0x8e, 0x7c, 0x72, 0x6d, 0x6c, 0x73, 0x91, 0xb4,
-  0xba, 0xa1, 0x63, 0x33, 0x3b, 0x61, 0x73, 0x78, 0x8c, 0xa1, 0xb5, 0xb1,
-  0x90, 0x6d, 0x5b, 0x5f, 0x6d, 0x8a, 0xaa, 0xb2, 0x9f, 0x69, 0x36, 0x3a,
-  0x62, 0x76, 0x7f, 0x93, 0xa8, 0xbc, 0xbd, 0xa4, 0x7b, 0x52, 0x35, 0x3b,
-  0x63, 0x91, 0xac, 0xb3, 0x9f, 0x7a, 0x6f, 0x70, 0x6d, 0x6e, 0x6f, 0x68,
-  0x6f, 0x8e, 0xa7, 0xad, 0xa2, 0x91, 0x7b, 0x5f, 0x45, 0x49, 0x6b, 0x89,
-  0x9d, 0xa7, 0xab, 0x9e, 0x89, 0x78, 0x64, 0x68, 0x7b, 0x7e, 0x67, 0x4e,
-  0x56, 0x7a, 0xa4, 0xb6, 0xaf, 0x98, 0x70, 0x4f, 0x54, 0x6d, 0x8a, 0xa4,
-  0xa8, 0x97, 0x86, 0x88, 0x89, 0x6f, 0x58, 0x59, 0x5f, 0x5e, 0x60, 0x75,
-  0x9c, 0xc2, 0xcc, 0xbb, 0x9d, 0x69, 0x41, 0x3f, 0x50, 0x74, 0x97, 0xa2,
-  0x99, 0x84, 0x82, 0x84, 0x78, 0x73, 0x71, 0x6a, 0x5f, 0x62, 0x7d, 0xa7,
-  0xbe, 0xb2, 0x96, 0x6e, 0x45, 0x37, 0x4c, 0x6a, 0x92, 0xad, 0xae, 0xa3,
-  0x92, 0x8e, 0x84, 0x6f, 0x67, 0x62, 0x5b, 0x55, 0x63, 0x81, 0x9d, 0xae,
-  0xac, 0x9c, 0x7b, 0x58, 0x51, 0x65, 0x80, 0x9a, 0xa5, 0x9e, 0x8d, 0x7f,
-  0x85, 0x7f, 0x6b, 0x66, 0x69, 0x60, 0x52, 0x5a, 0x73, 0x8f, 0xa3, 0xac,
-  0xb5, 0xb5, 0x9d, 0x86, 0x74, 0x62, 0x57, 0x54, 0x59, 0x61, 0x7b, 0xa3,
-  0xb2, 0x9e, 0x87, 0x75, 0x70, 0x7a, 0x83, 0x8c, 0x96, 0x88, 0x5f, 0x45,
-  0x4f, 0x70, 0x91, 0x9c, 0x9e, 0xa0, 0x91, 0x7f, 0x76, 0x72, 0x6e, 0x67,
-  0x68, 0x70, 0x84, 0xa6, 0xc2, 0xbb, 0x95, 0x72, 0x5f, 0x5d, 0x5a, 0x60,
-  0x79, 0x84, 0x73, 0x5c, 0x5d, 0x6f, 0x8a, 0xa5, 0xae, 0xb4, 0xae, 0x97,
-  0x83, 0x73, 0x65, 0x5d, 0x5f, 0x60, 0x61, 0x71, 0x91, 0xa5, 0x9c, 0x8e,
-  0x80, 0x7b, 0x83, 0x83, 0x8b, 0x94, 0x85, 0x5f, 0x4c, 0x54, 0x65, 0x7e,
-  0x8e, 0x9a, 0xa7, 0xa3, 0x8e, 0x7a, 0x6c, 0x5f, 0x5f, 0x69, 0x71, 0x7c,
-  0x99, 0xb5, 0xb2, 0x9e, 0x85, 0x6b, 0x5e, 0x57, 0x5c, 0x6c, 0x78, 0x6e,
-  0x61, 0x68, 0x79, 0x95, 0xaa, 0xac, 0xaf, 0xb0, 0x9e, 0x82, 0x6b, 0x59,
-  0x4c, 0x4b, 0x4f, 0x5b, 0x76, 0x97, 0xac, 0xb6, 0xb1, 0x94, 0x72, 0x62,
-  0x6d, 0x88, 0x9b, 0x9c, 0x96, 0x90, 0x75, 0x54, 0x47, 0x49, 0x57, 0x6b,
-  0x7e, 0x87, 0x88, 0x88, 0x91, 0xa2, 0xa4, 0x9b, 0x94, 0x8f, 0x88, 0x88,
-  0x90, 0x86, 0x66, 0x4b, 0x49, 0x5d, 0x75, 0x8a, 0x99, 0xa2, 0x99, 0x7e,
-  0x68, 0x66, 0x77, 0x8c, 0x94, 0x8d, 0x8c, 0x94, 0x87, 0x67, 0x52, 0x56,
-  0x60, 0x6b, 0x7c, 0x8f, 0x9b, 0x91, 0x85, 0x8b, 0x96, 0x98, 0x97, 0x8f,
-  0x7f, 0x78, 0x7c, 0x77, 0x68, 0x5b, 0x5a, 0x6e, 0x8f, 0xa3, 0xa2, 0x9d,
-  0x93, 0x7f, 0x6a, 0x60, 0x66, 0x73, 0x7a, 0x80, 0x92, 0xa0, 0x88, 0x5d,
-  0x49, 0x52, 0x64, 0x79, 0x88, 0x92, 0x98, 0x9a, 0xa3, 0xad, 0xa5, 0x91,
-  0x81, 0x74, 0x65, 0x60, 0x6a, 0x6d, 0x64, 0x5d, 0x5e, 0x70, 0x8c, 0xa1,
-  0xa9, 0xaa, 0xa3, 0x8c, 0x72, 0x67, 0x6f, 0x7e, 0x7d, 0x71, 0x75, 0x88,
-  0x7f, 0x62, 0x56, 0x62, 0x74, 0x82, 0x8c, 0x8e, 0x8d, 0x8a, 0x8f, 0x9b,
-  0xa1, 0x96, 0x84, 0x74, 0x69, 0x71, 0x89, 0x8d, 0x7d, 0x6c, 0x60, 0x66,
-  0x77, 0x83, 0x85, 0x8a, 0x8f, 0x8c, 0x85, 0x81, 0x83, 0x88, 0x8a, 0x87,
-  0x86, 0x88, 0x83, 0x7b, 0x78, 0x78, 0x78, 0x7a, 0x76, 0x6f, 0x6d, 0x71,
-  0x78, 0x7c, 0x7c, 0x79, 0x77, 0x73, 0x71, 0x7c, 0x8e, 0x97, 0x96, 0x91,
-  0x8b, 0x89, 0x8b, 0x8a, 0x7f, 0x73, 0x72, 0x7c, 0x80, 0x7b, 0x73, 0x70,
-  0x71, 0x71, 0x76, 0x7c, 0x81, 0x85, 0x86, 0x84, 0x86, 0x8b, 0x8d, 0x8e,
-  0x8f, 0x91, 0x8f, 0x89, 0x7d, 0x75, 0x76, 0x7b, 0x7d, 0x78, 0x71, 0x69,
-  0x68, 0x6f, 0x77, 0x7f, 0x87, 0x89, 0x82, 0x7b, 0x7c, 0x85, 0x8d, 0x8d,
-  0x8a, 0x8a, 0x88, 0x81, 0x7c, 0x7b, 0x7f, 0x84, 0x84, 0x7b, 0x71, 0x6a,
-  0x66, 0x68, 0x6d, 0x73, 0x79, 0x7d, 0x81, 0x82, 0x87, 0x8c, 0x94, 0x96,
-  0x90, 0x8b, 0x8b, 0x89, 0x83, 0x7d, 0x7b, 0x77, 0x71, 0x69, 0x65, 0x69,
-  0x71, 0x78, 0x7c, 0x82, 0x84, 0x85, 0x87, 0x89, 0x8c, 0x91, 0x94, 0x90,
-  0x88, 0x7e, 0x76, 0x73, 0x70, 0x6d, 0x6f, 0x73, 0x78, 0x7c, 0x83, 0x89,
-  0x8c, 0x8f, 0x90, 0x8d, 0x88, 0x87, 0x85, 0x80, 0x7a, 0x75, 0x71, 0x6e,
-  0x6c, 0x70, 0x75, 0x79, 0x7d, 0x87, 0x90, 0x91, 0x90, 0x8c, 0x88, 0x88,
-  0x89, 0x88, 0x82, 0x7a, 0x70, 0x67, 0x65, 0x68, 0x6d, 0x72, 0x75, 0x79,
-  0x84, 0x8c, 0x90, 0x92, 0x94, 0x94, 0x92, 0x8f, 0x8b, 0x85, 0x7c, 0x71,
-  0x6a, 0x66, 0x60, 0x61, 0x67, 0x6e, 0x77, 0x84, 0x8f, 0x95, 0x96, 0x93,
-  0x90, 0x91, 0x92, 0x8e, 0x87, 0x7e, 0x75, 0x6e, 0x6b, 0x6b, 0x6d, 0x6d,
-  0x6d, 0x73, 0x81, 0x8b, 0x8d, 0x8c, 0x8d, 0x8e, 0x91, 0x90, 0x8b, 0x84,
-  0x7c, 0x75, 0x73, 0x71, 0x6d, 0x6b, 0x6c, 0x70, 0x7a, 0x86, 0x8d, 0x8c,
-  0x89, 0x87, 0x8a, 0x8c, 0x8f, 0x8b, 0x80, 0x73, 0x6b, 0x6a, 0x6c, 0x6d,
-  0x6f, 0x72, 0x77, 0x83, 0x8f, 0x96, 0x97, 0x92, 0x8d, 0x89, 0x87, 0x83,
-  0x7b, 0x6f, 0x66, 0x65, 0x6a, 0x70, 0x77, 0x7d, 0x83, 0x89, 0x8d, 0x92,
-  0x95, 0x94, 0x8f, 0x88, 0x84, 0x81, 0x7a, 0x70, 0x68, 0x67, 0x6b, 0x72,
-  0x79, 0x7f, 0x83, 0x86, 0x8a, 0x8f, 0x92, 0x90, 0x8a, 0x83, 0x7d, 0x7a,
-  0x78, 0x74, 0x70, 0x6b, 0x6d, 0x76, 0x81, 0x87, 0x89, 0x88, 0x8a, 0x8c,
-  0x8b, 0x8c, 0x8b, 0x82, 0x77, 0x70, 0x6e, 0x70, 0x71, 0x71, 0x75, 0x7e,
-  0x87, 0x8b, 0x8c, 0x8d, 0x8c, 0x8b, 0x89, 0x86, 0x80, 0x77, 0x70, 0x6c,
-  0x6e, 0x71, 0x76, 0x78, 0x7b, 0x82, 0x88, 0x8c, 0x8f, 0x8f, 0x8b, 0x87,
-  0x85, 0x81, 0x7a, 0x75, 0x71, 0x6f, 0x6e, 0x70, 0x76, 0x7f, 0x85, 0x88,
-  0x8a, 0x8d, 0x8e, 0x8a, 0x88, 0x86, 0x81, 0x78, 0x70, 0x6e, 0x6f, 0x72,
-  0x74, 0x78, 0x7e, 0x84, 0x89, 0x8a, 0x8c, 0x8c, 0x89, 0x86, 0x81, 0x7a,
-  0x74, 0x72, 0x72, 0x72, 0x75, 0x7b, 0x82, 0x86, 0x87, 0x87, 0x89, 0x89,
-  0x86, 0x80, 0x79, 0x74, 0x73, 0x75, 0x77, 0x79, 0x7c, 0x82, 0x89, 0x8b,
-  0x8a, 0x88, 0x86, 0x85, 0x81, 0x7b, 0x74, 0x6f, 0x6d, 0x71, 0x78, 0x7d,
-  0x82, 0x8a, 0x8e, 0x8e, 0x8d, 0x8c, 0x88, 0x82, 0x7d, 0x76, 0x70, 0x6c,
-  0x6a, 0x6f, 0x76, 0x7f, 0x89, 0x90, 0x90, 0x8f, 0x8f, 0x8d, 0x89, 0x81,
-  0x77, 0x6e, 0x6b, 0x68, 0x6a, 0x71, 0x77, 0x7e, 0x88, 0x92, 0x93, 0x92,
-  0x90, 0x8d, 0x8a, 0x82, 0x78, 0x6e, 0x69, 0x6a, 0x71, 0x76, 0x7a, 0x7e,
-  0x88, 0x8f, 0x8f, 0x8e, 0x8a, 0x87, 0x85, 0x81, 0x79, 0x72, 0x6c, 0x6c,
-  0x71, 0x77, 0x7c, 0x80, 0x88, 0x8c, 0x8d, 0x8d, 0x8b, 0x86, 0x81, 0x7b,
-  0x76, 0x72, 0x6f, 0x71, 0x74, 0x7a, 0x80, 0x88, 0x8d, 0x8c, 0x8e, 0x8e,
-  0x8a, 0x82, 0x77, 0x6b, 0x62, 0x60, 0x68, 0x74, 0x7f, 0x89, 0x90, 0x95,
-  0x96, 0x95, 0x92, 0x90, 0x8b, 0x82, 0x7e, 0x7c, 0x7b, 0x78, 0x78, 0x77,
-  0x74, 0x6e, 0x67, 0x64, 0x66, 0x6b, 0x70, 0x73, 0x79, 0x82, 0x8b, 0x93,
-  0x96, 0x9c, 0xa0, 0x98, 0x87, 0x74, 0x71, 0x7e, 0x86, 0x88, 0x88, 0x8b,
-  0x81, 0x6a, 0x54, 0x54, 0x6a, 0x7f, 0x89, 0x8a, 0x87, 0x83, 0x83, 0x84,
-  0x87, 0x88, 0x8b, 0x8b, 0x85, 0x83, 0x8e, 0x9f, 0xa4, 0x9b, 0x8a, 0x7e,
-  0x75, 0x69, 0x5b, 0x51, 0x4c, 0x4e, 0x54, 0x61, 0x77, 0x8e, 0x9f, 0xa5,
-  0xa3, 0xa1, 0xa4, 0x9a, 0x80, 0x64, 0x55, 0x5c, 0x71, 0x7f, 0x8b, 0x98,
-  0xa4, 0x9a, 0x7d, 0x63, 0x59, 0x5f, 0x63, 0x69, 0x70, 0x78, 0x7a, 0x7c,
-  0x85, 0x96, 0xa8, 0xb2, 0xaa, 0x98, 0x8e, 0x91, 0x96, 0x8f, 0x81, 0x72,
-  0x6a, 0x63, 0x5f, 0x62, 0x68, 0x6d, 0x6c, 0x68, 0x6b, 0x7a, 0x8a, 0x8d,
-  0x8d, 0x8f, 0x97, 0x90, 0x7b, 0x70, 0x78, 0x8a, 0x92, 0x97, 0x9c, 0x94,
-  0x72, 0x49, 0x3c, 0x4e, 0x66, 0x77, 0x82, 0x93, 0xa0, 0xa6, 0xaf, 0xb4,
-  0xa7, 0x8d, 0x75, 0x61, 0x52, 0x4d, 0x55, 0x65, 0x7b, 0x92, 0xa3, 0xaf,
-  0xaf, 0x99, 0x78, 0x65, 0x61, 0x64, 0x69, 0x6f, 0x81, 0x92, 0x89, 0x6b,
-  0x5b, 0x63, 0x72, 0x7b, 0x7f, 0x87, 0x8d, 0x8f, 0x94, 0x9f, 0xa8, 0xa8,
-  0x9b, 0x82, 0x68, 0x59, 0x58, 0x59, 0x5e, 0x69, 0x7b, 0x91, 0xa4, 0xa2,
-  0x8c, 0x7f, 0x82, 0x88, 0x86, 0x7f, 0x82, 0x8c, 0x82, 0x5e, 0x48, 0x55,
-  0x70, 0x82, 0x8b, 0x97, 0x9c, 0x97, 0x91, 0x8d, 0x8b, 0x8a, 0x83, 0x74,
-  0x64, 0x60, 0x6d, 0x79, 0x7d, 0x7e, 0x89, 0x99, 0xa2, 0x98, 0x7a, 0x62,
-  0x61, 0x70, 0x7f, 0x87, 0x90, 0x9c, 0x92, 0x6b, 0x4d, 0x4f, 0x5f, 0x6b,
-  0x72, 0x81, 0x92, 0x9a, 0xa1, 0xa8, 0xa7, 0xa2, 0x99, 0x87, 0x6b, 0x54,
-  0x53, 0x64, 0x71, 0x7c, 0x8d, 0x9b, 0x97, 0x8e, 0x85, 0x7c, 0x74, 0x68,
-  0x63, 0x6a, 0x73, 0x6d, 0x69, 0x76, 0x91, 0xad, 0xb5, 0xb0, 0xa1, 0x82,
-  0x5c, 0x48, 0x4d, 0x5a, 0x65, 0x7d, 0x9b, 0xaf, 0xb1, 0xa6, 0x98, 0x84,
-  0x6e, 0x57, 0x53, 0x62, 0x6d, 0x71, 0x71, 0x76, 0x83, 0x9b, 0xa9, 0xaa,
-  0xa5, 0x8b, 0x67, 0x55, 0x54, 0x5b, 0x68, 0x7f, 0x96, 0xa4, 0xad, 0xa1,
-  0x8b, 0x75, 0x63, 0x59, 0x5d, 0x73, 0x84, 0x88, 0x7f, 0x7b, 0x89, 0x99,
-  0x9a, 0x8e, 0x87, 0x81, 0x73, 0x69, 0x66, 0x65, 0x67, 0x7a, 0x97, 0xa6,
-  0xa5, 0x93, 0x7c, 0x71, 0x6e, 0x6b, 0x6a, 0x7a, 0x8d, 0x8d, 0x79, 0x6a,
-  0x6a, 0x70, 0x79, 0x85, 0x9c, 0xa7, 0x96, 0x7f, 0x79, 0x75, 0x6c, 0x6d,
-  0x7e, 0x89, 0x89, 0x88, 0x81, 0x7a, 0x75, 0x75, 0x7a, 0x85, 0x90, 0x8e,
-  0x7a, 0x61, 0x5a, 0x61, 0x73, 0x88, 0x9e, 0xb2, 0xad, 0x93, 0x7d, 0x6c,
-  0x59, 0x51, 0x68, 0x83, 0x84, 0x87, 0x9a, 0x9f, 0x99, 0x80, 0x67, 0x66,
-  0x70, 0x70, 0x69, 0x78, 0x8f, 0x9e, 0xa1, 0x98, 0x8a, 0x76, 0x5e, 0x5d,
-  0x77, 0x8f, 0x90, 0x8e, 0x90, 0x88, 0x7c, 0x72, 0x71, 0x6e, 0x6c, 0x63,
-  0x67, 0x7b, 0x90, 0xa5, 0xa8, 0x97, 0x7f, 0x66, 0x5b, 0x6b, 0x8a, 0x9b,
-  0x9c, 0x96, 0x7e, 0x67, 0x55, 0x5c, 0x78, 0x8e, 0x8c, 0x7e, 0x80, 0x88,
-  0x8c, 0x8a, 0x81, 0x71, 0x5c, 0x5e, 0x7b, 0xa1, 0xb0, 0xa6, 0x98, 0x7a,
-  0x59, 0x48, 0x57, 0x75, 0x86, 0x87, 0x7e, 0x87, 0x96, 0xa4, 0xa2, 0x8b,
-  0x70, 0x54, 0x48, 0x5e, 0x8a, 0xa6, 0xaa, 0xac, 0x9d, 0x82, 0x65, 0x54,
-  0x5c, 0x67, 0x71, 0x76, 0x88, 0x98, 0xa1, 0xa1, 0x92, 0x7a, 0x61, 0x51,
-  0x51, 0x71, 0x98, 0xaa, 0xb0, 0xa8, 0x8c, 0x6b, 0x4e, 0x4d, 0x5f, 0x74,
-  0x7b, 0x84, 0x96, 0xa3, 0xa5, 0x9d, 0x8d, 0x72, 0x54, 0x45, 0x54, 0x78,
-  0x92, 0xae, 0xc0, 0xac, 0x80, 0x50, 0x43, 0x51, 0x6c, 0x83, 0x97, 0xac,
-  0xa8, 0x92, 0x75, 0x66, 0x6a, 0x76, 0x76, 0x7f, 0x96, 0x9e, 0x8f, 0x73,
-  0x5d, 0x5a, 0x69, 0x79, 0x8f, 0xa3, 0xa3, 0x8f, 0x73, 0x60, 0x68, 0x7d,
-  0x82, 0x8e, 0xa1, 0xa7, 0x8f, 0x65, 0x47, 0x41, 0x65, 0x8e, 0xac, 0xb9,
-  0xa5, 0x86, 0x65, 0x51, 0x56, 0x71, 0x83, 0x97, 0xa8, 0xac, 0x9f, 0x78,
-  0x57, 0x41, 0x4a, 0x63, 0x7f, 0xa7, 0xbb, 0xb0, 0x8b, 0x67, 0x5c, 0x65,
-  0x6a, 0x77, 0x8d, 0x9c, 0x9e, 0x86, 0x6a, 0x5b, 0x62, 0x78, 0x8a, 0x98,
-  0x97, 0x85, 0x6c, 0x5f, 0x6d, 0x8c, 0x96, 0x96, 0x99, 0x92, 0x89, 0x6f,
-  0x56, 0x4b, 0x5b, 0x7b, 0x98, 0xb5, 0xb7, 0xa0, 0x76, 0x4e, 0x45, 0x66,
-  0x89, 0x9e, 0xac, 0xa5, 0x92, 0x76, 0x5d, 0x49, 0x46, 0x61, 0x80, 0xa7,
-  0xc0, 0xb7, 0x91, 0x5c, 0x41, 0x53, 0x79, 0x94, 0xa6, 0xa5, 0x9b, 0x89,
-  0x75, 0x69, 0x60, 0x68, 0x68, 0x6e, 0x79, 0x82, 0x88, 0x84, 0x83, 0x8b,
-  0x92, 0x8d, 0x7d, 0x66, 0x62, 0x76, 0x97, 0xa5, 0x96, 0x89, 0x7f, 0x77,
-  0x72, 0x74, 0x78, 0x72, 0x6f, 0x7f, 0x9e, 0xae, 0x9c, 0x75, 0x5a, 0x58,
-  0x65, 0x7d, 0x8c, 0x93, 0x96, 0x94, 0x87, 0x73, 0x67, 0x5d, 0x5b, 0x71,
-  0x91, 0xa7, 0xa7, 0x96, 0x78, 0x61, 0x5f, 0x69, 0x74, 0x7e, 0x8d, 0x9b,
-  0xa0, 0x9a, 0x87, 0x69, 0x53, 0x54, 0x6d, 0x89, 0x9e, 0xa1, 0x96, 0x8a,
-  0x81, 0x76, 0x69, 0x62, 0x66, 0x73, 0x86, 0x96, 0x9d, 0x99, 0x87, 0x71,
-  0x66, 0x69, 0x6e, 0x74, 0x7e, 0x8c, 0x96, 0x9c, 0x94, 0x82, 0x71, 0x62,
-  0x5b, 0x64, 0x7c, 0x92, 0x9c, 0xa0, 0x9c, 0x89, 0x71, 0x5f, 0x5a, 0x5f,
-  0x70, 0x8a, 0x9d, 0xa5, 0xa1, 0x8c, 0x73, 0x61, 0x56, 0x56, 0x6b, 0x8f,
-  0xa8, 0xae, 0xa1, 0x85, 0x6c, 0x5f, 0x5a, 0x61, 0x75, 0x8f, 0xa0, 0xa4,
-  0x9b, 0x87, 0x6f, 0x5c, 0x57, 0x64, 0x7e, 0x96, 0xa2, 0xa1, 0x96, 0x7e,
-  0x66, 0x5d, 0x62, 0x6e, 0x82, 0x97, 0x9f, 0x9a, 0x8b, 0x73, 0x61, 0x61,
-  0x6a, 0x77, 0x8c, 0x9e, 0xa2, 0x96, 0x80, 0x69, 0x5b, 0x5e, 0x6f, 0x84,
-  0x99, 0xa6, 0xa2, 0x89, 0x71, 0x61, 0x5c, 0x68, 0x7a, 0x8a, 0x9a, 0xa4,
-  0x99, 0x82, 0x70, 0x60, 0x5b, 0x67, 0x7a, 0x91, 0xa5, 0xa6, 0x92, 0x7c,
-  0x68, 0x5c, 0x62, 0x71, 0x82, 0x96, 0xa1, 0x9c, 0x8e, 0x79, 0x63, 0x59,
-  0x5f, 0x72, 0x8d, 0x9f, 0xa2, 0x98, 0x85, 0x6d, 0x60, 0x62, 0x6c, 0x7d,
-  0x8e, 0x9a, 0x9b, 0x92, 0x7c, 0x66, 0x5d, 0x62, 0x72, 0x85, 0x98, 0xa0,
-  0x97, 0x86, 0x72, 0x62, 0x63, 0x6d, 0x7a, 0x8c, 0x9b, 0x9c, 0x8e, 0x7c,
-  0x6a, 0x63, 0x69, 0x74, 0x86, 0x9a, 0xa1, 0x94, 0x80, 0x6a, 0x60, 0x65,
-  0x6f, 0x7e, 0x93, 0xa0, 0x9c, 0x8c, 0x78, 0x65, 0x60, 0x66, 0x74, 0x89,
-  0x9b, 0xa0, 0x95, 0x83, 0x6f, 0x61, 0x61, 0x6d, 0x80, 0x96, 0xa1, 0x99,
-  0x87, 0x74, 0x65, 0x63, 0x6f, 0x80, 0x8f, 0x9a, 0x98, 0x88, 0x77, 0x68,
-  0x61, 0x6a, 0x7c, 0x8e, 0x99, 0x97, 0x86, 0x74, 0x6a, 0x69, 0x74, 0x83,
-  0x8f, 0x93, 0x8d, 0x82, 0x75, 0x6e, 0x6d, 0x74, 0x84, 0x91, 0x96, 0x8e,
-  0x7f, 0x6f, 0x68, 0x6c, 0x77, 0x88, 0x94, 0x97, 0x8f, 0x80, 0x70, 0x67,
-  0x6b, 0x78, 0x89, 0x97, 0x9b, 0x91, 0x7e, 0x6c, 0x60, 0x66, 0x77, 0x89,
-  0x99, 0x9d, 0x91, 0x7d, 0x6c, 0x62, 0x66, 0x76, 0x87, 0x96, 0x9d, 0x93,
-  0x7e, 0x6b, 0x60, 0x64, 0x75, 0x87, 0x95, 0x9b, 0x92, 0x7e, 0x69, 0x5e,
-  0x64, 0x76, 0x8c, 0x9a, 0x9d, 0x91, 0x7b, 0x67, 0x5f, 0x67, 0x77, 0x8a,
-  0x99, 0x9d, 0x91, 0x7c, 0x6a, 0x60, 0x64, 0x76, 0x8b, 0x9b, 0xa0, 0x93,
-  0x7d, 0x69, 0x5f, 0x66, 0x78, 0x8b, 0x99, 0x9d, 0x92, 0x7e, 0x6b, 0x5f,
-  0x64, 0x76, 0x89, 0x99, 0x9e, 0x91, 0x7a, 0x68, 0x61, 0x6a, 0x7d, 0x8f,
-  0x9a, 0x97, 0x87, 0x75, 0x66, 0x65, 0x71, 0x84, 0x95, 0x9b, 0x93, 0x7f,
-  0x6b, 0x62, 0x68, 0x79, 0x8d, 0x9c, 0x99, 0x89, 0x75, 0x66, 0x63, 0x6f,
-  0x83, 0x97, 0x9e, 0x95, 0x80, 0x6a, 0x60, 0x65, 0x76, 0x8c, 0x9d, 0x9f,
-  0x8f, 0x79, 0x65, 0x5e, 0x68, 0x7a, 0x92, 0xa3, 0x9f, 0x8a, 0x74, 0x61,
-  0x5c, 0x69, 0x7e, 0x96, 0xa2, 0x9b, 0x86, 0x6f, 0x5f, 0x62, 0x70, 0x86,
-  0x9b, 0xa2, 0x95, 0x80, 0x6b, 0x62, 0x68, 0x76, 0x8b, 0x9a, 0x99, 0x8c,
-  0x7a, 0x6b, 0x67, 0x6f, 0x7e, 0x90, 0x97, 0x90, 0x82, 0x72, 0x6a, 0x6c,
-  0x76, 0x85, 0x91, 0x91, 0x87, 0x79, 0x6f, 0x6c, 0x71, 0x7d, 0x8b, 0x93,
-  0x8e, 0x81, 0x72, 0x69, 0x6b, 0x75, 0x84, 0x93, 0x94, 0x89, 0x7b, 0x6c,
-  0x69, 0x70, 0x7c, 0x8b, 0x96, 0x91, 0x86, 0x78, 0x6e, 0x6e, 0x75, 0x82,
-  0x8e, 0x90, 0x82, 0x71, 0x68, 0x6f, 0x84, 0x9a, 0xa5, 0x9e, 0x88, 0x72,
-  0x69, 0x66, 0x6c, 0x83, 0x9b, 0xa5, 0x8d, 0x60, 0x4b, 0x56, 0x70, 0x87,
-  0x9c, 0xa2, 0x8f, 0x72, 0x65, 0x70, 0x7b, 0x85, 0x91, 0x99, 0x87, 0x66,
-  0x5c, 0x70, 0x84, 0x8c, 0x95, 0x96, 0x85, 0x6f, 0x6a, 0x7f, 0x92, 0x92,
-  0x94, 0x95, 0x81, 0x5c, 0x4b, 0x62, 0x87, 0xa1, 0xa9, 0x9e, 0x80, 0x5d,
-  0x51, 0x63, 0x85, 0x9b, 0xa3, 0xa6, 0x96, 0x66, 0x3c, 0x45, 0x67, 0x8c,
-  0xab, 0xb6, 0xa3, 0x79, 0x50, 0x48, 0x65, 0x85, 0x9f, 0xb8, 0xb3, 0x84,
-  0x50, 0x40, 0x54, 0x72, 0x93, 0xb0, 0xb7, 0x9a, 0x6e, 0x54, 0x56, 0x69,
-  0x80, 0xa0, 0xb6, 0xa6, 0x76, 0x4f, 0x4f, 0x60, 0x7b, 0x9b, 0xab, 0x9f,
-  0x84, 0x6b, 0x65, 0x70, 0x76, 0x82, 0x97, 0x98, 0x82, 0x69, 0x64, 0x6f,
-  0x79, 0x86, 0x90, 0x8f, 0x80, 0x71, 0x75, 0x83, 0x88, 0x85, 0x87, 0x85,
-  0x76, 0x62, 0x61, 0x7a, 0x8a, 0x92, 0x9b, 0x97, 0x84, 0x69, 0x57, 0x62,
-  0x8b, 0x9e, 0x94, 0x91, 0x89, 0x85, 0x74, 0x60, 0x5a, 0x6b, 0x86, 0x86,
-  0x8d, 0x9a, 0x99, 0x83, 0x6e, 0x68, 0x6b, 0x76, 0x81, 0x8e, 0x9d, 0xa0,
-  0x92, 0x78, 0x56, 0x46, 0x5f, 0x86, 0x94, 0x94, 0x96, 0x9b, 0x8d, 0x6d,
-  0x57, 0x68, 0x84, 0x8b, 0x8a, 0x93, 0xa1, 0x9f, 0x81, 0x50, 0x40, 0x5b,
-  0x7e, 0x8f, 0x9c, 0xa8, 0x9a, 0x82, 0x6d, 0x5a, 0x62, 0x78, 0x87, 0x90,
-  0xa0, 0xab, 0xa0, 0x7c, 0x41, 0x33, 0x5c, 0x8a, 0x95, 0x9d, 0xaa, 0x9a,
-  0x7f, 0x66, 0x5c, 0x69, 0x7a, 0x87, 0x8e, 0xa0, 0xa9, 0x9e, 0x7c, 0x46,
-  0x34, 0x57, 0x8d, 0x9e, 0x9b, 0x99, 0x8e, 0x83, 0x74, 0x69, 0x6b, 0x75,
-  0x7f, 0x86, 0x9d, 0xa8, 0x98, 0x73, 0x43, 0x3c, 0x67, 0x90, 0x91, 0x8f,
-  0x90, 0x8e, 0x8f, 0x82, 0x6d, 0x62, 0x6b, 0x7b, 0x8a, 0xa2, 0xaa, 0x9d,
-  0x78, 0x42, 0x39, 0x66, 0x8d, 0x8e, 0x91, 0x97, 0x9b, 0x9d, 0x8c, 0x6f,
-  0x59, 0x54, 0x62, 0x85, 0xa5, 0xa9, 0xa3, 0x8e, 0x69, 0x59, 0x67, 0x7c,
-  0x84, 0x81, 0x67, 0x5b, 0x77, 0x95, 0xa5, 0xa3, 0xa0, 0x8f, 0x70, 0x59,
-  0x56, 0x6b, 0x84, 0x8c, 0x89, 0x95, 0x99, 0x94, 0x8a, 0x6f, 0x62, 0x6d,
-  0x71, 0x5e, 0x51, 0x6a, 0x98, 0xc1, 0xcb, 0xb6, 0x8b, 0x52, 0x31, 0x3b,
-  0x60, 0x8a, 0xac, 0xb8, 0xa6, 0x91, 0x91, 0x83, 0x62, 0x4a, 0x4c, 0x5b,
-  0x6b, 0x7d, 0x94, 0xb4, 0xc0, 0xab, 0x8c, 0x6a, 0x41, 0x38, 0x5c, 0x81,
-  0xa8, 0xbd, 0xb3, 0x92, 0x6f, 0x68, 0x5f, 0x5f, 0x77, 0x82, 0x7a, 0x6d,
-  0x6d, 0x7c, 0x9e, 0xad, 0xa0, 0x8e, 0x72, 0x5a, 0x61, 0x78, 0x86, 0x92,
-  0x91, 0x85, 0x7c, 0x81, 0x93, 0x8c, 0x7e, 0x78, 0x6b, 0x54, 0x4a, 0x62,
-  0x86, 0xa8, 0xbc, 0xb9, 0xa1, 0x74, 0x49, 0x44, 0x53, 0x70, 0x8d, 0x99,
-  0xa0, 0x9d, 0x9c, 0x9b, 0x7d, 0x61, 0x56, 0x4f, 0x47, 0x51, 0x74, 0x9c,
-  0xb5, 0xbb, 0xb5, 0xa4, 0x87, 0x68, 0x54, 0x49, 0x54, 0x6d, 0x81, 0x91,
-  0x9c, 0xae, 0xad, 0x8c, 0x6d, 0x5f, 0x62, 0x6e, 0x80, 0x92, 0x9c, 0x8c,
-  0x60, 0x40, 0x48, 0x68, 0x8c, 0xa8, 0xb5, 0xb6, 0xa6, 0x8e, 0x7d, 0x68,
-  0x59, 0x54, 0x55, 0x62, 0x7c, 0xa2, 0xbf, 0xba, 0x9b, 0x7d, 0x6b, 0x66,
-  0x61, 0x65, 0x79, 0x85, 0x72, 0x5e, 0x66, 0x7c, 0x91, 0x97, 0x9a, 0xa1,
-  0x9a, 0x84, 0x76, 0x73, 0x70, 0x70, 0x77, 0x7a, 0x71, 0x7a, 0x93, 0x9c,
-  0x8d, 0x80, 0x7d, 0x7f, 0x82, 0x82, 0x89, 0x8c, 0x7a, 0x52, 0x3c, 0x4e,
-  0x71, 0x94, 0xa9, 0xb2, 0xb7, 0xaf, 0x9a, 0x7b, 0x5a, 0x48, 0x46, 0x59,
-  0x73, 0x85, 0x9c, 0xb3, 0xad, 0x91, 0x80, 0x73, 0x6d, 0x67, 0x67, 0x7b,
-  0x90, 0x8c, 0x6c, 0x57, 0x59, 0x6e, 0x8b, 0x99, 0xa1, 0xa9, 0xa4, 0x96,
-  0x85, 0x6d, 0x57, 0x4d, 0x4f, 0x59, 0x6c, 0x91, 0xb7, 0xca, 0xc1, 0x95,
-  0x63, 0x4c, 0x53, 0x68, 0x7e, 0x8f, 0x99, 0x98, 0x7f, 0x5d, 0x57, 0x69,
-  0x6e, 0x6c, 0x75, 0x86, 0x8c, 0x88, 0x89, 0x97, 0xa8, 0xac, 0xa4, 0x8d,
-  0x75, 0x65, 0x65, 0x6c, 0x67, 0x5e, 0x5e, 0x6e, 0x86, 0x9b, 0xad, 0xb6,
-  0xa9, 0x7a, 0x4a, 0x45, 0x62, 0x84, 0x98, 0xa2, 0xa8, 0xa3, 0x88, 0x5c,
-  0x40, 0x3e, 0x4d, 0x61, 0x75, 0x8c, 0xa5, 0xb5, 0xb5, 0xac, 0x9d, 0x8f,
-  0x83, 0x73, 0x68, 0x66, 0x73, 0x81, 0x80, 0x71, 0x65, 0x65, 0x72, 0x82,
-  0x8e, 0x99, 0x98, 0x85, 0x70, 0x71, 0x82, 0x92, 0x93, 0x82, 0x7c, 0x80,
-  0x72, 0x58, 0x48, 0x53, 0x6e, 0x85, 0x8f, 0x96, 0x97, 0x90, 0x8e, 0x97,
-  0xa2, 0x9f, 0x94, 0x87, 0x7c, 0x78, 0x7b, 0x74, 0x5d, 0x4a, 0x48, 0x5e,
-  0x80, 0x95, 0x9f, 0xae, 0xb4, 0x9e, 0x7a, 0x64, 0x65, 0x6e, 0x75, 0x7c,
-  0x87, 0x92, 0x8a, 0x72, 0x61, 0x62, 0x6c, 0x74, 0x77, 0x7b, 0x80, 0x80,
-  0x7e, 0x88, 0x99, 0xa0, 0x9d, 0x94, 0x83, 0x76, 0x76, 0x76, 0x71, 0x6b,
-  0x69, 0x76, 0x8e, 0x9c, 0x98, 0x8e, 0x89, 0x85, 0x7d, 0x6f, 0x63, 0x63,
-  0x69, 0x71, 0x7e, 0x90, 0x96, 0x8c, 0x82, 0x78, 0x70, 0x6c, 0x6b, 0x6c,
-  0x73, 0x82, 0x91, 0x9b, 0x9d, 0x92, 0x87, 0x7b, 0x6e, 0x65, 0x65, 0x6e,
-  0x76, 0x7d, 0x85, 0x93, 0xa0, 0x9f, 0x93, 0x84, 0x75, 0x6f, 0x6d, 0x6c,
-  0x6d, 0x74, 0x84, 0x91, 0x98, 0x98, 0x94, 0x8a, 0x7a, 0x69, 0x60, 0x66,
-  0x6e, 0x74, 0x80, 0x92, 0xa3, 0xa4, 0x99, 0x87, 0x73, 0x66, 0x60, 0x65,
-  0x70, 0x76, 0x7d, 0x8b, 0x98, 0x9d, 0x9a, 0x8f, 0x7c, 0x69, 0x5f, 0x61,
-  0x6b, 0x76, 0x7e, 0x89, 0x94, 0x93, 0x8d, 0x8a, 0x83, 0x79, 0x6d, 0x69,
-  0x6e, 0x73, 0x79, 0x83, 0x91, 0x99, 0x97, 0x8e, 0x82, 0x76, 0x6b, 0x66,
-  0x69, 0x70, 0x7a, 0x84, 0x8f, 0x98, 0x99, 0x98, 0x90, 0x7e, 0x68, 0x5a,
-  0x5b, 0x67, 0x73, 0x7f, 0x8f, 0x9d, 0xa0, 0x9a, 0x90, 0x82, 0x74, 0x68,
-  0x61, 0x66, 0x70, 0x76, 0x7e, 0x8c, 0x9b, 0x9f, 0x97, 0x8b, 0x7f, 0x72,
-  0x65, 0x60, 0x68, 0x71, 0x79, 0x84, 0x91, 0x9c, 0x9b, 0x90, 0x83, 0x78,
-  0x6e, 0x65, 0x64, 0x6c, 0x74, 0x7b, 0x85, 0x92, 0x9a, 0x97, 0x90, 0x87,
-  0x7e, 0x76, 0x70, 0x6d, 0x70, 0x75, 0x78, 0x80, 0x8a, 0x90, 0x90, 0x8d,
-  0x89, 0x82, 0x7b, 0x72, 0x6b, 0x6e, 0x75, 0x7a, 0x80, 0x89, 0x91, 0x90,
-  0x8b, 0x86, 0x83, 0x7e, 0x72, 0x6a, 0x6b, 0x72, 0x77, 0x7e, 0x88, 0x8f,
-  0x90, 0x8d, 0x8a, 0x86, 0x80, 0x76, 0x6f, 0x70, 0x72, 0x73, 0x77, 0x82,
-  0x8d, 0x91, 0x8f, 0x8e, 0x8a, 0x81, 0x75, 0x6f, 0x71, 0x72, 0x71, 0x74,
-  0x7d, 0x87, 0x8c, 0x90, 0x91, 0x8c, 0x84, 0x7a, 0x71, 0x6d, 0x6e, 0x70,
-  0x74, 0x7c, 0x86, 0x8e, 0x91, 0x92, 0x8e, 0x86, 0x7e, 0x75, 0x6f, 0x6e,
-  0x6e, 0x6d, 0x72, 0x7d, 0x89, 0x93, 0x97, 0x93, 0x8d, 0x87, 0x80, 0x76,
-  0x6e, 0x68, 0x69, 0x6f, 0x78, 0x81, 0x8a, 0x91, 0x90, 0x8c, 0x89, 0x88,
-  0x84, 0x79, 0x6e, 0x6a, 0x6c, 0x73, 0x78, 0x7d, 0x84, 0x8c, 0x8f, 0x8c,
-  0x88, 0x87, 0x86, 0x7d, 0x72, 0x6c, 0x6f, 0x74, 0x76, 0x77, 0x7d, 0x87,
-  0x90, 0x91, 0x8d, 0x8c, 0x8b, 0x83, 0x75, 0x6f, 0x6d, 0x6e, 0x6c, 0x70,
-  0x7c, 0x8b, 0x94, 0x95, 0x93, 0x8f, 0x8c, 0x85, 0x78, 0x6e, 0x69, 0x68,
-  0x6c, 0x72, 0x7c, 0x88, 0x91, 0x95, 0x93, 0x8e, 0x8b, 0x87, 0x7b, 0x6d,
-  0x65, 0x65, 0x6e, 0x74, 0x7c, 0x86, 0x91, 0x96, 0x94, 0x8e, 0x89, 0x85,
-  0x7b, 0x70, 0x69, 0x69, 0x6e, 0x74, 0x7a, 0x82, 0x8d, 0x93, 0x90, 0x8d,
-  0x8a, 0x88, 0x80, 0x75, 0x6d, 0x68, 0x6a, 0x6e, 0x73, 0x7c, 0x88, 0x92,
-  0x96, 0x94, 0x8d, 0x89, 0x4c, 0x49, 0x53, 0x54, 0x3c, 0x00, 0x00, 0x00,
-  0x49, 0x4e, 0x46, 0x4f, 0x49, 0x53, 0x46, 0x54, 0x30, 0x00, 0x00, 0x00,
-  0x57, 0x48, 0x41, 0x4d, 0x20, 0x31, 0x2e, 0x33, 0x31, 0x20, 0x62, 0x79,
-  0x20, 0x41, 0x6e, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75, 0x6c, 0x68,
-  0x61, 0x6b, 0x20, 0x28, 0x6c, 0x69, 0x62, 0x73, 0x6e, 0x64, 0x66, 0x69,
-  0x6c, 0x65, 0x2d, 0x31, 0x2e, 0x30, 0x2e, 0x32, 0x35, 0x29, 0x00, 0x00,
-  0x69, 0x64, 0x33, 0x20, 0x44, 0x00, 0x00, 0x00, 0x49, 0x44, 0x33, 0x04,
-  0x00, 0x40, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x20,
-  0x05, 0x09, 0x05, 0x1d, 0x22, 0x26, 0x54, 0x58, 0x58, 0x58, 0x00, 0x00,
-  0x00, 0x24, 0x00, 0x00, 0x00, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x00, 0x57, 0x48, 0x41, 0x4d, 0x20, 0x31, 0x2e, 0x33, 0x31, 0x20,
-  0x62, 0x79, 0x20, 0x41, 0x6e, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75,
-  0x6c, 0x68, 0x61, 0x6b
-};
-
-uint8_t pacman_eatghost[4717] = {
-  0x52, 0x49, 0x46, 0x46, 0x65, 0x12, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-  0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0x40, 0x1f, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-  0x64, 0x61, 0x74, 0x61, 0xed, 0x11, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x7f, 0xb7, 0xdd, 0xda, 0xdb, 0xd6, 0xd4, 0xcf, 0xce, 0xca,
-  0xc8, 0xc5, 0xc3, 0xc0, 0xbe, 0xbc, 0xba, 0xb9, 0xb8, 0xb7, 0xb6, 0xb5,
-  0xb4, 0xb4, 0xb3, 0xb1, 0xb0, 0xae, 0xac, 0xab, 0xa8, 0xa7, 0xa6, 0xa4,
-  0xa3, 0xa1, 0xa0, 0x9e, 0x9d, 0x9c, 0x9b, 0x99, 0x98, 0x96, 0x95, 0x94,
-  0x93, 0x92, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x89, 0x89, 0x88, 0x87, 0x86,
-  0x85, 0x85, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7b, 0x7c, 0x7b, 0x7b, 0x7a, 0x7b, 0x7a,
-  0x7b, 0x76, 0x67, 0x64, 0x63, 0x64, 0x63, 0x64, 0x64, 0x64, 0x65, 0x65,
-  0x66, 0x65, 0x66, 0x65, 0x66, 0x67, 0x66, 0x67, 0x68, 0x67, 0x68, 0x67,
-  0x68, 0x69, 0x68, 0x69, 0x6a, 0x6a, 0x69, 0x6a, 0x69, 0x69, 0x6a, 0x6a,
-  0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6c, 0x6b, 0x6c, 0x6b,
-  0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6e, 0x6d, 0x6e, 0x6d, 0x6e, 0x6e,
-  0x6f, 0x6e, 0x6f, 0x6f, 0x70, 0x6f, 0x70, 0x70, 0x72, 0x8a, 0x99, 0x98,
-  0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x91, 0x8f, 0x8f, 0x8e,
-  0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x87, 0x86,
-  0x86, 0x85, 0x84, 0x83, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7d,
-  0x7e, 0x7c, 0x7e, 0x75, 0x50, 0x46, 0x46, 0x45, 0x48, 0x48, 0x4a, 0x4b,
-  0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x54, 0x54, 0x56, 0x57, 0x59, 0x59,
-  0x5a, 0x5c, 0x5d, 0x60, 0x60, 0x61, 0x61, 0x62, 0x63, 0x63, 0x64, 0x65,
-  0x65, 0x66, 0x67, 0x67, 0x69, 0x68, 0x6a, 0x69, 0x6c, 0x67, 0x82, 0xad,
-  0xb2, 0xb4, 0xb2, 0xb1, 0xaf, 0xae, 0xac, 0xaa, 0xa9, 0xa8, 0xa6, 0xa4,
-  0xa3, 0xa1, 0xa1, 0x9f, 0x9f, 0x9c, 0x9c, 0x9a, 0x9a, 0x99, 0x97, 0x97,
-  0x95, 0x95, 0x94, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8e, 0x90, 0x8b, 0x91,
-  0x74, 0x3c, 0x34, 0x33, 0x35, 0x36, 0x38, 0x3a, 0x3c, 0x3e, 0x41, 0x42,
-  0x44, 0x46, 0x47, 0x48, 0x4b, 0x4c, 0x4e, 0x4f, 0x51, 0x51, 0x52, 0x53,
-  0x55, 0x56, 0x58, 0x58, 0x5d, 0xa0, 0xc3, 0xc3, 0xc5, 0xc1, 0xc0, 0xbd,
-  0xbd, 0xba, 0xb9, 0xb6, 0xb5, 0xb2, 0xb0, 0xae, 0xad, 0xaa, 0xa9, 0xa6,
-  0xa6, 0xa3, 0xa2, 0x9f, 0xa0, 0x9c, 0x9e, 0x99, 0x9e, 0x79, 0x33, 0x2a,
-  0x27, 0x2c, 0x2d, 0x30, 0x32, 0x35, 0x37, 0x39, 0x3b, 0x3d, 0x3f, 0x42,
-  0x45, 0x49, 0x4b, 0x4d, 0x4f, 0x51, 0x52, 0x54, 0x54, 0x56, 0x57, 0x59,
-  0x5a, 0x60, 0xac, 0xd4, 0xd4, 0xd6, 0xd2, 0xd1, 0xcd, 0xcc, 0xc9, 0xc7,
-  0xc5, 0xc3, 0xc1, 0xbe, 0xbb, 0xb8, 0xb5, 0xb3, 0xb0, 0xb0, 0xad, 0xac,
-  0xaa, 0xa9, 0xa6, 0xa7, 0xa0, 0xa8, 0x75, 0x2b, 0x25, 0x21, 0x26, 0x26,
-  0x2a, 0x2c, 0x2e, 0x31, 0x34, 0x38, 0x39, 0x3e, 0x3f, 0x43, 0x44, 0x48,
-  0x48, 0x4a, 0x4a, 0x4d, 0x4e, 0x52, 0xa1, 0xd2, 0xd1, 0xd6, 0xd1, 0xd3,
-  0xce, 0xcd, 0xc8, 0xc6, 0xc2, 0xc0, 0xbd, 0xbb, 0xb9, 0xb6, 0xb5, 0xb1,
-  0xb3, 0xad, 0xb4, 0x7c, 0x2e, 0x27, 0x23, 0x27, 0x28, 0x2a, 0x2d, 0x30,
-  0x34, 0x36, 0x3a, 0x3b, 0x40, 0x3f, 0x44, 0x43, 0x48, 0x46, 0x4b, 0x46,
-  0x60, 0xbb, 0xd8, 0xd9, 0xda, 0xd5, 0xd7, 0xd1, 0xd0, 0xcb, 0xca, 0xc4,
-  0xc3, 0xbf, 0xbe, 0xbb, 0xb9, 0xb7, 0xb5, 0xb4, 0xb1, 0xb1, 0x5f, 0x21,
-  0x21, 0x1c, 0x22, 0x21, 0x27, 0x28, 0x2e, 0x31, 0x34, 0x37, 0x39, 0x3d,
-  0x3f, 0x42, 0x42, 0x48, 0x44, 0x4c, 0x44, 0x78, 0xd1, 0xde, 0xe1, 0xde,
-  0xdd, 0xda, 0xd7, 0xd3, 0xce, 0xcc, 0xc6, 0xc5, 0xc0, 0xbf, 0xba, 0xba,
-  0xb5, 0xb7, 0xb1, 0xb5, 0xa1, 0x3c, 0x12, 0x12, 0x0f, 0x15, 0x15, 0x1b,
-  0x1c, 0x21, 0x21, 0x26, 0x27, 0x2b, 0x2c, 0x31, 0x32, 0x35, 0x37, 0x3d,
-  0x9f, 0xda, 0xd9, 0xde, 0xd8, 0xd8, 0xd2, 0xd3, 0xcf, 0xce, 0xcb, 0xca,
-  0xc7, 0xc5, 0xc4, 0xc0, 0xc0, 0x68, 0x23, 0x20, 0x1b, 0x21, 0x20, 0x26,
-  0x26, 0x2b, 0x2c, 0x2f, 0x32, 0x33, 0x37, 0x37, 0x3d, 0x3a, 0x87, 0xd4,
-  0xd8, 0xde, 0xd9, 0xda, 0xd6, 0xd6, 0xd4, 0xd1, 0xcf, 0xcc, 0xcc, 0xc8,
-  0xc9, 0xc2, 0xc9, 0x8b, 0x3e, 0x37, 0x32, 0x36, 0x36, 0x39, 0x3a, 0x3b,
-  0x3d, 0x3f, 0x42, 0x42, 0x47, 0x44, 0x4b, 0x44, 0x79, 0xcc, 0xd6, 0xdb,
-  0xd7, 0xd7, 0xd3, 0xd1, 0xd0, 0xcd, 0xcd, 0xc9, 0xc9, 0xc4, 0xc6, 0xbf,
-  0xc6, 0x96, 0x45, 0x39, 0x36, 0x38, 0x39, 0x3b, 0x3d, 0x3e, 0x40, 0x41,
-  0x45, 0x44, 0x48, 0x46, 0x4c, 0x46, 0x6d, 0xc0, 0xd0, 0xd4, 0xd2, 0xd0,
-  0xce, 0xcb, 0xca, 0xc6, 0xc7, 0xc2, 0xc3, 0xbd, 0xbf, 0xb8, 0xbd, 0xa1,
-  0x50, 0x3a, 0x38, 0x37, 0x3a, 0x39, 0x3d, 0x3c, 0x40, 0x3e, 0x43, 0x41,
-  0x48, 0x41, 0x61, 0xb0, 0xc0, 0xc3, 0xc2, 0xc2, 0xbf, 0xbf, 0xbe, 0xbd,
-  0xbb, 0xbc, 0xb8, 0xbb, 0xab, 0x5e, 0x45, 0x43, 0x43, 0x44, 0x45, 0x47,
-  0x47, 0x48, 0x49, 0x4b, 0x4c, 0x4f, 0x50, 0x90, 0xb9, 0xba, 0xbc, 0xb9,
-  0xb9, 0xb6, 0xb6, 0xb2, 0xb3, 0xaf, 0xb0, 0xab, 0xaf, 0x85, 0x53, 0x4f,
-  0x4c, 0x4f, 0x4e, 0x51, 0x51, 0x53, 0x53, 0x56, 0x56, 0x59, 0x56, 0x6e,
-  0x9c, 0xa3, 0xa5, 0xa3, 0xa3, 0xa1, 0xa1, 0x9f, 0x9f, 0x9d, 0x9e, 0x9b,
-  0x9c, 0x94, 0x6f, 0x63, 0x63, 0x63, 0x64, 0x65, 0x67, 0x67, 0x68, 0x69,
-  0x6a, 0x6a, 0x6b, 0x6c, 0x84, 0x93, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92,
-  0x91, 0x91, 0x8f, 0x90, 0x8e, 0x8f, 0x83, 0x77, 0x76, 0x75, 0x76, 0x76,
-  0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x78, 0x76, 0x7e, 0x8c, 0x8e, 0x8f,
-  0x8e, 0x8d, 0x8e, 0x8d, 0x8c, 0x8b, 0x8c, 0x8b, 0x8b, 0x87, 0x77, 0x72,
-  0x73, 0x72, 0x72, 0x73, 0x74, 0x73, 0x74, 0x74, 0x75, 0x76, 0x8f, 0x9c,
-  0x9c, 0x9d, 0x9c, 0x9c, 0x9a, 0x9b, 0x99, 0x99, 0x97, 0x98, 0x7b, 0x60,
-  0x5f, 0x5e, 0x5f, 0x5f, 0x61, 0x61, 0x64, 0x62, 0x66, 0x62, 0x7f, 0xaa,
-  0xad, 0xaf, 0xad, 0xad, 0xaa, 0xaa, 0xa7, 0xa7, 0xa3, 0xa7, 0x8d, 0x52,
-  0x48, 0x45, 0x47, 0x47, 0x49, 0x4a, 0x4d, 0x4d, 0x50, 0x4e, 0x5f, 0xa6,
-  0xbb, 0xbd, 0xbc, 0xb9, 0xb8, 0xb5, 0xb4, 0xb2, 0xb2, 0xae, 0xab, 0x64,
-  0x3b, 0x3b, 0x3a, 0x3f, 0x3f, 0x43, 0x43, 0x48, 0x47, 0x4e, 0x4b, 0x8c,
-  0xc6, 0xc7, 0xca, 0xc4, 0xc5, 0xbf, 0xc0, 0xbb, 0xbd, 0xb6, 0xbb, 0x86,
-  0x3a, 0x36, 0x31, 0x37, 0x36, 0x3b, 0x3a, 0x3f, 0x3d, 0x44, 0x40, 0x5e,
-  0xb7, 0xc9, 0xcc, 0xc9, 0xc8, 0xc3, 0xc3, 0xc0, 0xc0, 0xbb, 0xbb, 0xab,
-  0x52, 0x2f, 0x2f, 0x2e, 0x32, 0x32, 0x36, 0x37, 0x3c, 0x3c, 0x43, 0x97,
-  0xcd, 0xcb, 0xd0, 0xc8, 0xcb, 0xc3, 0xc6, 0xbe, 0xc3, 0xa5, 0x46, 0x2a,
-  0x2a, 0x2a, 0x2f, 0x2f, 0x36, 0x35, 0x3e, 0x38, 0x74, 0xc6, 0xcb, 0xd0,
-  0xca, 0xca, 0xc7, 0xc5, 0xc2, 0xbf, 0xbc, 0x5d, 0x1a, 0x1a, 0x14, 0x1c,
-  0x1a, 0x22, 0x21, 0x29, 0x25, 0x43, 0xad, 0xce, 0xcf, 0xd0, 0xcc, 0xcc,
-  0xc6, 0xc8, 0xbf, 0xc8, 0x8b, 0x2d, 0x20, 0x1a, 0x1e, 0x1e, 0x22, 0x24,
-  0x26, 0x2b, 0x2b, 0x88, 0xcd, 0xce, 0xd4, 0xcd, 0xd0, 0xca, 0xcd, 0xc7,
-  0xcb, 0xb6, 0x5c, 0x3a, 0x3a, 0x37, 0x3b, 0x3a, 0x3f, 0x3c, 0x45, 0x3c,
-  0x70, 0xc6, 0xd1, 0xd6, 0xd4, 0xd3, 0xd0, 0xce, 0xcd, 0xc9, 0xc9, 0x7e,
-  0x40, 0x40, 0x3a, 0x3f, 0x3d, 0x42, 0x41, 0x46, 0x42, 0x54, 0xaa, 0xcc,
-  0xcd, 0xd0, 0xcc, 0xcd, 0xc8, 0xca, 0xc3, 0xc9, 0x9e, 0x4c, 0x40, 0x3c,
-  0x3f, 0x3e, 0x42, 0x42, 0x44, 0x43, 0x50, 0xa0, 0xc0, 0xc3, 0xc3, 0xc4,
-  0xc1, 0xc2, 0xbb, 0xc2, 0x91, 0x51, 0x4a, 0x47, 0x48, 0x49, 0x4a, 0x4b,
-  0x4b, 0x55, 0x9b, 0xb9, 0xba, 0xbb, 0xb9, 0xb8, 0xb7, 0xb3, 0xb6, 0x8c,
-  0x5b, 0x58, 0x54, 0x57, 0x58, 0x59, 0x5a, 0x5a, 0x63, 0x94, 0xa6, 0xa6,
-  0xa6, 0xa5, 0xa4, 0xa3, 0xa1, 0xa3, 0x8a, 0x6b, 0x69, 0x66, 0x69, 0x68,
-  0x69, 0x68, 0x68, 0x6c, 0x87, 0x90, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8e,
-  0x8e, 0x84, 0x77, 0x75, 0x75, 0x76, 0x75, 0x77, 0x77, 0x76, 0x79, 0x89,
-  0x8e, 0x8f, 0x8e, 0x8f, 0x8d, 0x8e, 0x8c, 0x8e, 0x82, 0x77, 0x76, 0x76,
-  0x77, 0x78, 0x77, 0x78, 0x77, 0x7c, 0x96, 0x9f, 0xa0, 0x9e, 0x9f, 0x9d,
-  0x9d, 0x9a, 0x9c, 0x82, 0x65, 0x62, 0x61, 0x61, 0x63, 0x63, 0x65, 0x64,
-  0x70, 0xa0, 0xae, 0xae, 0xae, 0xad, 0xab, 0xaa, 0xa7, 0xaa, 0x7d, 0x4e,
-  0x4c, 0x49, 0x4c, 0x4c, 0x4e, 0x51, 0x4e, 0x74, 0xb5, 0xbb, 0xbf, 0xbb,
-  0xba, 0xb6, 0xb4, 0xac, 0x64, 0x3f, 0x40, 0x3e, 0x44, 0x42, 0x4a, 0x45,
-  0x6b, 0xb9, 0xc5, 0xc8, 0xc5, 0xc2, 0xbf, 0xbd, 0xb9, 0x6a, 0x36, 0x37,
-  0x33, 0x3a, 0x39, 0x42, 0x3b, 0x64, 0xb9, 0xc8, 0xca, 0xc8, 0xc5, 0xc4,
-  0xbe, 0xbf, 0x73, 0x33, 0x33, 0x2e, 0x36, 0x33, 0x3c, 0x37, 0x58, 0xb4,
-  0xcc, 0xcd, 0xcc, 0xc7, 0xc7, 0xc0, 0xc4, 0x7b, 0x2f, 0x2c, 0x28, 0x30,
-  0x30, 0x38, 0x34, 0x4d, 0xaa, 0xca, 0xca, 0xcb, 0xc6, 0xc7, 0xbf, 0xc5,
-  0x78, 0x1f, 0x19, 0x13, 0x1a, 0x1a, 0x22, 0x21, 0x33, 0x9c, 0xcb, 0xcb,
-  0xcf, 0xc9, 0xcc, 0xc4, 0xcb, 0x8b, 0x2f, 0x23, 0x1c, 0x20, 0x1f, 0x23,
-  0x23, 0x2c, 0x93, 0xcd, 0xce, 0xd4, 0xcd, 0xd0, 0xc8, 0xcf, 0xa0, 0x4c,
-  0x3e, 0x39, 0x3b, 0x3a, 0x3d, 0x3d, 0x43, 0x99, 0xcd, 0xce, 0xd3, 0xcd,
-  0xd0, 0xc9, 0xcf, 0xaa, 0x50, 0x3e, 0x39, 0x3b, 0x3a, 0x40, 0x3a, 0x6c,
-  0xbd, 0xc5, 0xcd, 0xc7, 0xcb, 0xc4, 0xc9, 0x83, 0x44, 0x40, 0x3c, 0x40,
-  0x3d, 0x42, 0x45, 0x96, 0xbc, 0xc0, 0xc2, 0xc1, 0xc0, 0xc2, 0xaf, 0x61,
-  0x4d, 0x48, 0x4a, 0x48, 0x4d, 0x48, 0x6c, 0xaf, 0xb7, 0xbb, 0xb7, 0xb9,
-  0xb3, 0xb7, 0x88, 0x5b, 0x58, 0x55, 0x59, 0x57, 0x5b, 0x5b, 0x86, 0xa3,
-  0xa5, 0xa6, 0xa3, 0xa3, 0xa1, 0x9b, 0x76, 0x67, 0x66, 0x66, 0x66, 0x68,
-  0x67, 0x70, 0x8b, 0x8f, 0x91, 0x90, 0x90, 0x8e, 0x90, 0x85, 0x78, 0x77,
-  0x76, 0x77, 0x76, 0x77, 0x77, 0x85, 0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x8f,
-  0x8d, 0x7e, 0x78, 0x78, 0x78, 0x78, 0x79, 0x77, 0x80, 0x9a, 0x9f, 0xa0,
-  0x9f, 0x9f, 0x9d, 0x9e, 0x89, 0x67, 0x65, 0x62, 0x65, 0x63, 0x67, 0x64,
-  0x8d, 0xad, 0xae, 0xb0, 0xad, 0xad, 0xaa, 0xa6, 0x6a, 0x50, 0x4d, 0x4f,
-  0x4e, 0x52, 0x4e, 0x65, 0xa9, 0xbd, 0xbc, 0xbd, 0xb7, 0xb8, 0xae, 0x67,
-  0x40, 0x44, 0x40, 0x47, 0x45, 0x4d, 0x95, 0xc7, 0xc2, 0xc7, 0xc0, 0xbf,
-  0xbd, 0x74, 0x37, 0x39, 0x36, 0x3a, 0x3d, 0x3a, 0x7a, 0xc3, 0xc7, 0xc9,
-  0xc7, 0xc1, 0xc8, 0x8d, 0x3d, 0x34, 0x34, 0x34, 0x3c, 0x33, 0x68, 0xbe,
-  0xcd, 0xcb, 0xcd, 0xc4, 0xcc, 0xa6, 0x4a, 0x2e, 0x34, 0x2f, 0x3a, 0x32,
-  0x50, 0xaa, 0xce, 0xc8, 0xcf, 0xc3, 0xcb, 0xb2, 0x49, 0x15, 0x1a, 0x15,
-  0x1e, 0x1b, 0x26, 0x88, 0xca, 0xc7, 0xce, 0xc7, 0xc8, 0xc4, 0x6d, 0x21,
-  0x20, 0x1a, 0x1e, 0x20, 0x1d, 0x73, 0xc7, 0xcb, 0xcf, 0xcd, 0xc9, 0xcf,
-  0x95, 0x46, 0x3b, 0x3b, 0x39, 0x3f, 0x35, 0x69, 0xbe, 0xce, 0xcd, 0xd1,
-  0xc8, 0xd3, 0xa7, 0x52, 0x3c, 0x3e, 0x39, 0x42, 0x39, 0x54, 0xaa, 0xcb,
-  0xc8, 0xce, 0xc6, 0xcd, 0xba, 0x66, 0x3e, 0x42, 0x3b, 0x42, 0x3d, 0x4a,
-  0x96, 0xc0, 0xbe, 0xc3, 0xbe, 0xc2, 0xb8, 0x72, 0x49, 0x4b, 0x45, 0x4b,
-  0x44, 0x6e, 0xad, 0xb5, 0xb7, 0xb6, 0xb5, 0xb1, 0x7b, 0x58, 0x59, 0x54,
-  0x5a, 0x56, 0x69, 0x97, 0xa4, 0xa3, 0xa4, 0xa1, 0xa3, 0x86, 0x6b, 0x6b,
-  0x68, 0x6b, 0x69, 0x6f, 0x89, 0x93, 0x93, 0x94, 0x92, 0x93, 0x88, 0x7b,
-  0x7a, 0x79, 0x7a, 0x79, 0x7b, 0x8a, 0x91, 0x91, 0x91, 0x90, 0x91, 0x89,
-  0x7a, 0x77, 0x77, 0x78, 0x77, 0x77, 0x8d, 0x9d, 0x9c, 0x9e, 0x9a, 0x9c,
-  0x8d, 0x6a, 0x61, 0x61, 0x61, 0x63, 0x62, 0x87, 0xab, 0xaa, 0xae, 0xa9,
-  0xac, 0x9e, 0x63, 0x4d, 0x4f, 0x4c, 0x52, 0x4c, 0x78, 0xb5, 0xba, 0xbe,
-  0xb9, 0xba, 0xae, 0x64, 0x43, 0x46, 0x43, 0x4b, 0x43, 0x71, 0xbd, 0xc6,
-  0xc8, 0xc4, 0xc3, 0xbe, 0x70, 0x39, 0x3b, 0x36, 0x3f, 0x38, 0x5a, 0xb2,
-  0xc9, 0xc8, 0xc9, 0xc3, 0xc6, 0x80, 0x38, 0x37, 0x31, 0x39, 0x34, 0x4f,
-  0xad, 0xcc, 0xcb, 0xcd, 0xc4, 0xc8, 0x81, 0x36, 0x35, 0x2e, 0x37, 0x30,
-  0x6f, 0xc4, 0xc8, 0xd0, 0xc6, 0xce, 0x90, 0x27, 0x1c, 0x13, 0x1c, 0x16,
-  0x49, 0xb7, 0xc8, 0xcf, 0xc9, 0xce, 0xa8, 0x39, 0x1f, 0x19, 0x1d, 0x1b,
-  0x31, 0xa0, 0xc9, 0xce, 0xcf, 0xcd, 0xc3, 0x66, 0x3d, 0x3a, 0x37, 0x3b,
-  0x3f, 0x96, 0xc8, 0xca, 0xd0, 0xcb, 0xcb, 0x79, 0x3f, 0x3d, 0x37, 0x3e,
-  0x3a, 0x84, 0xc5, 0xc7, 0xce, 0xc6, 0xcd, 0x8b, 0x45, 0x40, 0x38, 0x3f,
-  0x38, 0x6d, 0xb4, 0xba, 0xc2, 0xbb, 0xc1, 0x9e, 0x56, 0x4a, 0x44, 0x48,
-  0x44, 0x5e, 0xa5, 0xb3, 0xb6, 0xb3, 0xb6, 0xa5, 0x68, 0x58, 0x56, 0x57,
-  0x57, 0x61, 0x91, 0xa2, 0xa4, 0xa4, 0xa4, 0xa0, 0x7c, 0x6c, 0x6a, 0x6a,
-  0x6b, 0x6c, 0x85, 0x93, 0x93, 0x94, 0x93, 0x93, 0x85, 0x7b, 0x7a, 0x79,
-  0x7b, 0x79, 0x85, 0x91, 0x91, 0x92, 0x90, 0x92, 0x87, 0x79, 0x78, 0x77,
-  0x78, 0x76, 0x85, 0x9d, 0x9e, 0xa0, 0x9d, 0x9f, 0x84, 0x66, 0x66, 0x62,
-  0x65, 0x65, 0x93, 0xac, 0xae, 0xad, 0xad, 0x9e, 0x60, 0x53, 0x4d, 0x52,
-  0x4e, 0x79, 0xb7, 0xba, 0xbf, 0xb8, 0xb7, 0x70, 0x45, 0x43, 0x43, 0x46,
-  0x55, 0xab, 0xc5, 0xc9, 0xc3, 0xc8, 0x99, 0x44, 0x3b, 0x36, 0x3e, 0x3b,
-  0x89, 0xc6, 0xc7, 0xcb, 0xc5, 0xbd, 0x5e, 0x37, 0x33, 0x36, 0x33, 0x5a,
-  0xbb, 0xc9, 0xcf, 0xc6, 0xca, 0x81, 0x38, 0x34, 0x2f, 0x34, 0x3a, 0x9d,
-  0xc9, 0xcc, 0xc9, 0xca, 0xab, 0x37, 0x1b, 0x12, 0x1a, 0x13, 0x5c, 0xc0,
-  0xc7, 0xd0, 0xc8, 0xc9, 0x60, 0x20, 0x19, 0x19, 0x18, 0x35, 0xa8, 0xc6,
-  0xce, 0xca, 0xd2, 0xa0, 0x46, 0x3b, 0x34, 0x3c, 0x38, 0x86, 0xc4, 0xca,
-  0xce, 0xce, 0xc0, 0x60, 0x40, 0x39, 0x3c, 0x36, 0x62, 0xbb, 0xc5, 0xce,
-  0xc7, 0xce, 0x8b, 0x46, 0x41, 0x3b, 0x3e, 0x43, 0x97, 0xbc, 0xc2, 0xc0,
-  0xc3, 0xa8, 0x5b, 0x4d, 0x45, 0x4b, 0x46, 0x81, 0xb0, 0xb6, 0xb5, 0xb7,
-  0x9c, 0x62, 0x59, 0x56, 0x58, 0x5d, 0x8e, 0xa1, 0xa4, 0xa3, 0xa3, 0x86,
-  0x6b, 0x6a, 0x68, 0x69, 0x72, 0x8d, 0x90, 0x93, 0x91, 0x91, 0x80, 0x7a,
-  0x78, 0x7a, 0x79, 0x85, 0x91, 0x91, 0x92, 0x91, 0x8c, 0x7b, 0x79, 0x77,
-  0x79, 0x79, 0x95, 0x9e, 0xa1, 0x9d, 0xa0, 0x84, 0x69, 0x65, 0x66, 0x64,
-  0x76, 0xa6, 0xad, 0xb0, 0xad, 0xaa, 0x6d, 0x54, 0x50, 0x53, 0x4d, 0x81,
-  0xb6, 0xbb, 0xba, 0xba, 0x9e, 0x50, 0x44, 0x40, 0x46, 0x4a, 0x9f, 0xc2,
-  0xc7, 0xc0, 0xc5, 0x84, 0x3d, 0x38, 0x38, 0x38, 0x56, 0xb5, 0xc4, 0xca,
-  0xc3, 0xc0, 0x61, 0x38, 0x31, 0x38, 0x32, 0x77, 0xc5, 0xcb, 0xcc, 0xca,
-  0xac, 0x48, 0x36, 0x2f, 0x36, 0x38, 0x9b, 0xc9, 0xd0, 0xc9, 0xd1, 0x83,
-  0x25, 0x18, 0x17, 0x15, 0x38, 0xaf, 0xca, 0xd1, 0xcd, 0xca, 0x5f, 0x1f,
-  0x19, 0x1b, 0x15, 0x5d, 0xbf, 0xc8, 0xcd, 0xd1, 0xa7, 0x4a, 0x39, 0x38,
-  0x31, 0x5e, 0xb4, 0xc8, 0xc6, 0xd2, 0xa5, 0x50, 0x39, 0x3e, 0x31, 0x58,
-  0xae, 0xcb, 0xc4, 0xd2, 0xac, 0x5a, 0x3c, 0x42, 0x35, 0x59, 0xa5, 0xc1,
-  0xbc, 0xc8, 0xa8, 0x62, 0x49, 0x4e, 0x45, 0x5c, 0x9d, 0xb8, 0xb3, 0xbb,
-  0xa7, 0x70, 0x58, 0x5c, 0x56, 0x66, 0x92, 0xa5, 0xa2, 0xa7, 0x9b, 0x78,
-  0x69, 0x6c, 0x68, 0x71, 0x89, 0x94, 0x92, 0x94, 0x8f, 0x81, 0x79, 0x7a,
-  0x77, 0x7a, 0x88, 0x8f, 0x8e, 0x90, 0x8b, 0x7d, 0x75, 0x77, 0x74, 0x79,
-  0x91, 0x9e, 0x9b, 0x9e, 0x98, 0x78, 0x63, 0x66, 0x61, 0x68, 0x92, 0xae,
-  0xab, 0xb0, 0xa7, 0x73, 0x50, 0x54, 0x4e, 0x58, 0x96, 0xbf, 0xbb, 0xc0,
-  0xb8, 0x78, 0x45, 0x4a, 0x45, 0x4d, 0x92, 0xc9, 0xc5, 0xc8, 0xc1, 0x75,
-  0x3a, 0x3d, 0x39, 0x3f, 0x8e, 0xc9, 0xc7, 0xc9, 0xc7, 0x7d, 0x38, 0x37,
-  0x35, 0x36, 0x82, 0xc9, 0xc7, 0xcb, 0xc4, 0x76, 0x31, 0x36, 0x2c, 0x42,
-  0x9f, 0xce, 0xc6, 0xd3, 0xa4, 0x34, 0x14, 0x18, 0x0d, 0x59, 0xc0, 0xcb,
-  0xcf, 0xce, 0x70, 0x1a, 0x1c, 0x10, 0x2c, 0x9a, 0xca, 0xc5, 0xd2, 0xa6,
-  0x4c, 0x36, 0x38, 0x30, 0x71, 0xbf, 0xc6, 0xcb, 0xc8, 0x7b, 0x3b, 0x3e,
-  0x34, 0x48, 0x9f, 0xca, 0xc5, 0xd1, 0xaa, 0x54, 0x3d, 0x40, 0x37, 0x6f,
-  0xb6, 0xbe, 0xc1, 0xbf, 0x80, 0x4b, 0x4c, 0x45, 0x54, 0x96, 0xb6, 0xb2,
-  0xb9, 0x99, 0x63, 0x57, 0x56, 0x54, 0x76, 0x9c, 0x9f, 0xa1, 0x9e, 0x7e,
-  0x67, 0x69, 0x65, 0x6d, 0x85, 0x90, 0x8f, 0x91, 0x8a, 0x7b, 0x78, 0x77,
-  0x76, 0x82, 0x8f, 0x8f, 0x90, 0x8f, 0x82, 0x77, 0x78, 0x76, 0x7c, 0x95,
-  0xa2, 0x9f, 0xa3, 0x92, 0x6f, 0x67, 0x68, 0x65, 0x88, 0xae, 0xae, 0xb2,
-  0xab, 0x77, 0x53, 0x56, 0x4f, 0x63, 0xa5, 0xc0, 0xbb, 0xc3, 0x9a, 0x53,
-  0x46, 0x48, 0x44, 0x82, 0xc4, 0xc5, 0xc9, 0xbc, 0x67, 0x39, 0x3d, 0x33,
-  0x71, 0xc1, 0xc6, 0xcb, 0xba, 0x5e, 0x33, 0x38, 0x2f, 0x6f, 0xc1, 0xc6,
-  0xcc, 0xbc, 0x5d, 0x2f, 0x34, 0x2a, 0x6b, 0xc3, 0xc9, 0xd0, 0xbe, 0x4e,
-  0x14, 0x18, 0x0b, 0x56, 0xc1, 0xcb, 0xd4, 0xc3, 0x55, 0x17, 0x1b, 0x0e,
-  0x54, 0xbb, 0xc8, 0xcf, 0xc3, 0x69, 0x38, 0x3a, 0x2f, 0x6e, 0xbf, 0xc5,
-  0xcd, 0xbd, 0x65, 0x3a, 0x3c, 0x32, 0x6e, 0xbf, 0xc6, 0xce, 0xbe, 0x68,
-  0x3e, 0x40, 0x35, 0x6b, 0xb3, 0xbb, 0xc1, 0xb4, 0x6c, 0x47, 0x49, 0x41,
-  0x6e, 0xaa, 0xb0, 0xb4, 0xaa, 0x72, 0x57, 0x58, 0x52, 0x72, 0x9b, 0x9f,
-  0xa3, 0x9b, 0x77, 0x68, 0x69, 0x67, 0x79, 0x8f, 0x90, 0x92, 0x8f, 0x80,
-  0x7a, 0x7b, 0x7a, 0x85, 0x91, 0x92, 0x93, 0x90, 0x81, 0x79, 0x7a, 0x78,
-  0x89, 0x9f, 0xa0, 0xa2, 0x9a, 0x77, 0x66, 0x68, 0x64, 0x83, 0xab, 0xae,
-  0xb1, 0xa7, 0x6d, 0x53, 0x55, 0x4f, 0x82, 0xba, 0xbb, 0xc2, 0xa2, 0x56,
-  0x47, 0x44, 0x51, 0xa4, 0xc7, 0xc5, 0xc6, 0x77, 0x3a, 0x3d, 0x34, 0x6f,
-  0xc1, 0xc5, 0xcf, 0xaa, 0x4b, 0x36, 0x34, 0x3e, 0x98, 0xc9, 0xc6, 0xcd,
-  0x81, 0x34, 0x35, 0x2a, 0x60, 0xbf, 0xc9, 0xd3, 0xb5, 0x3e, 0x16, 0x12,
-  0x18, 0x8a, 0xce, 0xcc, 0xd8, 0x89, 0x22, 0x1a, 0x0c, 0x3d, 0xb0, 0xc8,
-  0xd0, 0xc0, 0x62, 0x38, 0x36, 0x34, 0x86, 0xc5, 0xc5, 0xd0, 0x95, 0x45,
-  0x3e, 0x32, 0x4e, 0xab, 0xc6, 0xca, 0xc3, 0x6d, 0x3d, 0x3d, 0x35, 0x77,
-  0xb7, 0xba, 0xc4, 0x9b, 0x54, 0x4a, 0x43, 0x57, 0x9c, 0xb1, 0xb3, 0xb2,
-  0x7d, 0x58, 0x59, 0x53, 0x75, 0x9d, 0x9f, 0xa4, 0x94, 0x70, 0x6a, 0x68,
-  0x6d, 0x88, 0x92, 0x93, 0x93, 0x86, 0x7b, 0x7b, 0x79, 0x83, 0x90, 0x92,
-  0x93, 0x8e, 0x7e, 0x7a, 0x79, 0x7b, 0x94, 0xa0, 0x9f, 0xa1, 0x84, 0x68,
-  0x69, 0x63, 0x7e, 0xaa, 0xad, 0xb2, 0xa1, 0x64, 0x55, 0x51, 0x5f, 0xa6,
-  0xbc, 0xbe, 0xb3, 0x65, 0x46, 0x46, 0x4b, 0x9e, 0xc6, 0xc6, 0xc1, 0x67,
-  0x3a, 0x3b, 0x3c, 0x91, 0xc8, 0xc7, 0xca, 0x78, 0x37, 0x39, 0x33, 0x7e,
-  0xc6, 0xc6, 0xcf, 0x81, 0x34, 0x35, 0x2b, 0x72, 0xc7, 0xca, 0xd7, 0x92,
-  0x22, 0x19, 0x0a, 0x47, 0xbd, 0xcb, 0xd9, 0xa0, 0x2b, 0x1b, 0x0c, 0x3b,
-  0xb1, 0xc8, 0xd2, 0xb5, 0x53, 0x3b, 0x31, 0x44, 0xa7, 0xc5, 0xcd, 0xbc,
-  0x5e, 0x3f, 0x38, 0x41, 0x9e, 0xc5, 0xc9, 0xc6, 0x6d, 0x3f, 0x3b, 0x39,
-  0x86, 0xba, 0xbb, 0xc2, 0x7f, 0x4b, 0x49, 0x45, 0x81, 0xaf, 0xb0, 0xb6,
-  0x87, 0x5b, 0x59, 0x53, 0x75, 0x9d, 0x9f, 0xa4, 0x8e, 0x6d, 0x6b, 0x67,
-  0x76, 0x8e, 0x91, 0x94, 0x8d, 0x7e, 0x7c, 0x7a, 0x80, 0x90, 0x91, 0x93,
-  0x8e, 0x7e, 0x7b, 0x79, 0x80, 0x9a, 0xa0, 0xa1, 0x99, 0x74, 0x69, 0x66,
-  0x6d, 0x9c, 0xaf, 0xb0, 0xac, 0x72, 0x56, 0x53, 0x5a, 0xa1, 0xbb, 0xbf,
-  0xb0, 0x5f, 0x49, 0x43, 0x60, 0xb7, 0xc3, 0xcb, 0xa2, 0x47, 0x3e, 0x35,
-  0x6e, 0xc3, 0xc4, 0xce, 0x89, 0x3b, 0x3a, 0x35, 0x87, 0xc7, 0xc7, 0xca,
-  0x6c, 0x33, 0x32, 0x39, 0xa0, 0xcb, 0xd0, 0xbf, 0x42, 0x16, 0x0c, 0x31,
-  0xb1, 0xcb, 0xd8, 0xaa, 0x2f, 0x1a, 0x0a, 0x43, 0xb8, 0xc6, 0xd3, 0x95,
-  0x40, 0x3b, 0x2d, 0x75, 0xc1, 0xc5, 0xcd, 0x7c, 0x40, 0x3d, 0x37, 0x90,
-  0xc4, 0xc9, 0xc3, 0x65, 0x41, 0x3a, 0x45, 0x9e, 0xb9, 0xc1, 0xaa, 0x59,
-  0x4a, 0x42, 0x60, 0xa5, 0xae, 0xb6, 0x91, 0x5c, 0x59, 0x53, 0x75, 0x9c,
-  0x9e, 0xa3, 0x86, 0x6a, 0x6a, 0x67, 0x7f, 0x8f, 0x90, 0x91, 0x81, 0x7a,
-  0x78, 0x7b, 0x8b, 0x90, 0x92, 0x8f, 0x7f, 0x7b, 0x79, 0x82, 0x9c, 0x9f,
-  0xa2, 0x92, 0x6d, 0x6a, 0x65, 0x83, 0xad, 0xad, 0xb3, 0x87, 0x59, 0x57,
-  0x53, 0x90, 0xbc, 0xbc, 0xbd, 0x72, 0x49, 0x47, 0x54, 0xae, 0xc4, 0xcc,
-  0xa3, 0x47, 0x3f, 0x36, 0x82, 0xc6, 0xc7, 0xc6, 0x64, 0x3a, 0x35, 0x52,
-  0xb7, 0xc5, 0xd1, 0x93, 0x39, 0x35, 0x30, 0x90, 0xca, 0xcf, 0xc1, 0x3f,
-  0x16, 0x09, 0x39, 0xb9, 0xca, 0xd8, 0x7c, 0x1c, 0x16, 0x12, 0x89, 0xc6,
-  0xcf, 0xb8, 0x4f, 0x3d, 0x2f, 0x63, 0xbd, 0xc5, 0xcd, 0x7a, 0x40, 0x3c,
-  0x40, 0xa2, 0xc4, 0xce, 0xa9, 0x4d, 0x43, 0x36, 0x74, 0xb8, 0xbd, 0xbf,
-  0x71, 0x4d, 0x48, 0x58, 0xa1, 0xb1, 0xb8, 0x93, 0x5e, 0x5a, 0x55, 0x7f,
-  0x9d, 0xa0, 0x9b, 0x74, 0x6a, 0x66, 0x71, 0x8b, 0x8e, 0x90, 0x85, 0x79,
-  0x78, 0x78, 0x87, 0x8f, 0x90, 0x8c, 0x7b, 0x79, 0x76, 0x85, 0x9c, 0x9d,
-  0x9f, 0x7e, 0x68, 0x67, 0x6c, 0x9e, 0xae, 0xb4, 0x98, 0x5e, 0x5a, 0x51,
-  0x85, 0xbb, 0xbd, 0xbe, 0x72, 0x4b, 0x46, 0x5c, 0xb6, 0xc4, 0xce, 0x9a,
-  0x45, 0x3f, 0x38, 0x8e, 0xc7, 0xca, 0xc2, 0x5c, 0x3d, 0x32, 0x6e, 0xc4,
-  0xc8, 0xca, 0x61, 0x37, 0x2c, 0x56, 0xc0, 0xcb, 0xd3, 0x5d, 0x16, 0x0b,
-  0x2e, 0xb6, 0xca, 0xdb, 0x78, 0x1c, 0x10, 0x25, 0xa8, 0xc5, 0xd4, 0x91,
-  0x3d, 0x37, 0x37, 0x9c, 0xc3, 0xcf, 0x9b, 0x44, 0x3e, 0x38, 0x93, 0xc2,
-  0xcd, 0xae, 0x50, 0x40, 0x38, 0x85, 0xba, 0xc1, 0xb1, 0x5d, 0x4e, 0x43,
-  0x79, 0xae, 0xb3, 0xac, 0x6c, 0x5d, 0x56, 0x74, 0x9d, 0xa1, 0xa2, 0x7c,
-  0x6c, 0x68, 0x76, 0x8e, 0x90, 0x91, 0x82, 0x7b, 0x78, 0x7c, 0x8c, 0x8e,
-  0x8e, 0x81, 0x77, 0x75, 0x7b, 0x96, 0x9b, 0x9f, 0x85, 0x67, 0x65, 0x6a,
-  0x9c, 0xa9, 0xb0, 0x8e, 0x58, 0x55, 0x52, 0x98, 0xb8, 0xc0, 0x9b, 0x4e,
-  0x4a, 0x43, 0x95, 0xc4, 0xc9, 0xb1, 0x4f, 0x40, 0x37, 0x88, 0xc7, 0xcc,
-  0xbc, 0x53, 0x3f, 0x31, 0x73, 0xc4, 0xcb, 0xc4, 0x58, 0x36, 0x2c, 0x63,
-  0xc7, 0xcc, 0xd4, 0x59, 0x18, 0x08, 0x3d, 0xbe, 0xce, 0xd2, 0x52, 0x19,
-  0x08, 0x52, 0xc1, 0xcc, 0xc4, 0x56, 0x3b, 0x2d, 0x7a, 0xc0, 0xcc, 0xb3,
-  0x50, 0x3e, 0x36, 0x8d, 0xc0, 0xcf, 0xa4, 0x4a, 0x3e, 0x3d, 0x97, 0xb8,
-  0xc4, 0x91, 0x50, 0x49, 0x52, 0x9e, 0xae, 0xb6, 0x83, 0x5d, 0x57, 0x66,
-  0x98, 0xa0, 0xa2, 0x7e, 0x6d, 0x69, 0x77, 0x8e, 0x92, 0x91, 0x7f, 0x7b,
-  0x79, 0x84, 0x90, 0x91, 0x8e, 0x7d, 0x7a, 0x78, 0x8f, 0x9e, 0xa0, 0x93,
-  0x6d, 0x69, 0x68, 0x99, 0xac, 0xb3, 0x8f, 0x5a, 0x55, 0x5c, 0xa6, 0xb8,
-  0xbf, 0x79, 0x48, 0x42, 0x63, 0xbb, 0xc3, 0xc5, 0x65, 0x3e, 0x32, 0x6b,
-  0xc0, 0xc8, 0xbd, 0x55, 0x3c, 0x30, 0x7d, 0xc5, 0xcd, 0xb3, 0x46, 0x36,
-  0x2b, 0x90, 0xca, 0xd7, 0xa0, 0x23, 0x12, 0x11, 0x99, 0xcc, 0xdd, 0x8c,
-  0x1f, 0x12, 0x21, 0xa7, 0xc7, 0xd5, 0x82, 0x3c, 0x32, 0x4e, 0xb6, 0xc5,
-  0xce, 0x70, 0x42, 0x34, 0x64, 0xba, 0xca, 0xc1, 0x5c, 0x42, 0x36, 0x84,
-  0xb8, 0xc5, 0x98, 0x53, 0x4a, 0x56, 0xa1, 0xb1, 0xb3, 0x77, 0x5c, 0x56,
-  0x7a, 0x9e, 0xa1, 0x96, 0x6f, 0x6b, 0x6a, 0x88, 0x8f, 0x92, 0x84, 0x7a,
-  0x78, 0x81, 0x8f, 0x90, 0x8d, 0x7a, 0x7a, 0x76, 0x92, 0x9d, 0xa1, 0x85,
-  0x6a, 0x65, 0x79, 0xa9, 0xaf, 0xab, 0x6b, 0x59, 0x52, 0x92, 0xb9, 0xc2,
-  0x98, 0x4f, 0x47, 0x59, 0xb7, 0xc6, 0xc6, 0x64, 0x3f, 0x34, 0x7b, 0xc5,
-  0xcc, 0xa8, 0x44, 0x3b, 0x3c, 0xa9, 0xc7, 0xd2, 0x74, 0x38, 0x2a, 0x69,
-  0xc7, 0xd2, 0xbc, 0x31, 0x12, 0x0b, 0x90, 0xc9, 0xda, 0x78, 0x18, 0x09,
-  0x33, 0xb6, 0xc8, 0xc6, 0x56, 0x3b, 0x2b, 0x81, 0xbe, 0xce, 0x9c, 0x45,
-  0x38, 0x4a, 0xaf, 0xc1, 0xcc, 0x6e, 0x42, 0x34, 0x74, 0xb6, 0xc3, 0xad,
-  0x5a, 0x4d, 0x4f, 0x9a, 0xb0, 0xb7, 0x81, 0x5d, 0x58, 0x6f, 0x9d, 0xa1,
-  0x9d, 0x73, 0x6e, 0x69, 0x87, 0x8f, 0x96, 0x86, 0x7e, 0x77, 0x83, 0x8e,
-  0x92, 0x8c, 0x7d, 0x79, 0x7c, 0x98, 0x9e, 0xa0, 0x78, 0x6b, 0x64, 0x95,
-  0xa8, 0xb5, 0x80, 0x5d, 0x4d, 0x7b, 0xb1, 0xc2, 0xa0, 0x55, 0x44, 0x58,
-  0xb1, 0xc7, 0xc2, 0x61, 0x3e, 0x37, 0x92, 0xc4, 0xcf, 0x83, 0x40, 0x30,
-  0x6a, 0xc0, 0xd1, 0xab, 0x46, 0x2e, 0x41, 0xb1, 0xd2, 0xce, 0x4e, 0x12,
-  0x09, 0x7c, 0xcd, 0xd9, 0x77, 0x18, 0x08, 0x52, 0xc1, 0xd1, 0xac, 0x46,
-  0x33, 0x45, 0xac, 0xc7, 0xc5, 0x64, 0x3c, 0x38, 0x8c, 0xc2, 0xcc, 0x8a,
-  0x42, 0x38, 0x62, 0xb3, 0xbd, 0xa7, 0x54, 0x48, 0x51, 0x9c, 0xae, 0xad,
-  0x71, 0x58, 0x57, 0x80, 0x9e, 0x9f, 0x87, 0x69, 0x68, 0x73, 0x8d, 0x8e,
-  0x8b, 0x7a, 0x78, 0x7b, 0x8d, 0x8f, 0x8f, 0x7d, 0x7a, 0x77, 0x93, 0x9d,
-  0xa4, 0x82, 0x6e, 0x64, 0x86, 0xa9, 0xb5, 0x97, 0x63, 0x52, 0x68, 0xa9,
-  0xc1, 0xb4, 0x6a, 0x47, 0x4d, 0x97, 0xca, 0xc6, 0x7d, 0x3c, 0x3c, 0x80,
-  0xc8, 0xca, 0x8d, 0x3e, 0x34, 0x76, 0xc6, 0xd2, 0x94, 0x3d, 0x27, 0x6b,
-  0xc2, 0xde, 0x97, 0x28, 0x00, 0x49, 0xb8, 0xdf, 0xa3, 0x31, 0x01, 0x33,
-  0xa3, 0xd8, 0xad, 0x57, 0x27, 0x4a, 0x9d, 0xd2, 0xb1, 0x62, 0x30, 0x49,
-  0x96, 0xcc, 0xb7, 0x6a, 0x36, 0x45, 0x8c, 0xc2, 0xba, 0x7e, 0x47, 0x4f,
-  0x86, 0xb4, 0xb0, 0x85, 0x59, 0x5c, 0x7d, 0xa2, 0xa0, 0x89, 0x6b, 0x6b,
-  0x7b, 0x91, 0x91, 0x88, 0x7b, 0x78, 0x82, 0x8e, 0x92, 0x87, 0x7d, 0x76,
-  0x86, 0x99, 0xa2, 0x8b, 0x6f, 0x60, 0x7a, 0x9f, 0xb3, 0x93, 0x63, 0x4c,
-  0x69, 0xa4, 0xc2, 0xa6, 0x63, 0x3d, 0x5e, 0xa7, 0xcf, 0xb3, 0x63, 0x30,
-  0x4d, 0x9e, 0xcf, 0xb8, 0x6a, 0x2e, 0x44, 0x97, 0xd1, 0xc3, 0x6f, 0x2c,
-  0x33, 0x88, 0xd6, 0xd1, 0x6b, 0x10, 0x0b, 0x6b, 0xd1, 0xd7, 0x7a, 0x16,
-  0x0a, 0x5c, 0xc6, 0xd2, 0x91, 0x3c, 0x2f, 0x67, 0xbe, 0xcd, 0x91, 0x43,
-  0x36, 0x72, 0xbe, 0xcb, 0x8a, 0x43, 0x3b, 0x7f, 0xbc, 0xc0, 0x85, 0x4c,
-  0x4c, 0x84, 0xb3, 0xae, 0x7c, 0x58, 0x5d, 0x84, 0xa2, 0x9c, 0x7d, 0x68,
-  0x6e, 0x85, 0x92, 0x8d, 0x80, 0x78, 0x7d, 0x8a, 0x92, 0x8b, 0x7e, 0x76,
-  0x82, 0x97, 0xa2, 0x91, 0x72, 0x64, 0x7c, 0xa5, 0xb4, 0x92, 0x61, 0x51,
-  0x78, 0xb3, 0xc3, 0x91, 0x51, 0x46, 0x81, 0xc4, 0xcc, 0x8d, 0x40, 0x3b,
-  0x7f, 0xc9, 0xc6, 0x7d, 0x36, 0x3d, 0x8e, 0xd1, 0xc6, 0x75, 0x2a, 0x3b,
-  0x93, 0xdc, 0xc2, 0x51, 0x02, 0x1c, 0x8e, 0xdd, 0xbb, 0x4a, 0x00, 0x2b,
-  0x9b, 0xd7, 0xb3, 0x5b, 0x26, 0x4f, 0xa4, 0xd1, 0xa4, 0x53, 0x2d, 0x59,
-  0xa9, 0xcd, 0x9e, 0x50, 0x32, 0x64, 0xad, 0xc4, 0x98, 0x56, 0x44, 0x70,
-  0xa9, 0xb5, 0x8c, 0x5f, 0x5a, 0x7d, 0xa0, 0xa2, 0x89, 0x6c, 0x6c, 0x7f,
-  0x91, 0x91, 0x84, 0x7a, 0x7b, 0x87, 0x92, 0x8f, 0x83, 0x78, 0x7f, 0x95,
-  0xa2, 0x94, 0x73, 0x65, 0x7e, 0xa7, 0xb2, 0x8b, 0x5b, 0x55, 0x84, 0xbc,
-  0xb9, 0x7b, 0x44, 0x54, 0x9e, 0xd0, 0xb0, 0x5c, 0x32, 0x60, 0xb3, 0xd0,
-  0x96, 0x42, 0x32, 0x7b, 0xc8, 0xcd, 0x7f, 0x2d, 0x36, 0x90, 0xdc, 0xbe,
-  0x4b, 0x00, 0x30, 0xa8, 0xe1, 0x9f, 0x29, 0x02, 0x54, 0xc2, 0xd2, 0x85,
-  0x34, 0x36, 0x89, 0xcb, 0xc0, 0x71, 0x32, 0x4a, 0x9d, 0xce, 0xaa, 0x59,
-  0x33, 0x62, 0xae, 0xc2, 0x90, 0x50, 0x4a, 0x7f, 0xb1, 0xad, 0x7b, 0x58,
-  0x60, 0x88, 0xa3, 0x97, 0x77, 0x66, 0x72, 0x88, 0x90, 0x86, 0x78, 0x76,
-  0x81, 0x8d, 0x8c, 0x81, 0x75, 0x79, 0x8f, 0x9f, 0x94, 0x74, 0x62, 0x73,
-  0x9d, 0xb1, 0x93, 0x5f, 0x50, 0x7b, 0xb5, 0xbc, 0x82, 0x46, 0x4d, 0x95,
-  0xce, 0xb8, 0x66, 0x33, 0x59, 0xad, 0xd3, 0xa8, 0x50, 0x2f, 0x69, 0xc0,
-  0xd4, 0x8b, 0x35, 0x30, 0x86, 0xd8, 0xca, 0x59, 0x01, 0x2c, 0xa7, 0xe2,
-  0x9a, 0x24, 0x05, 0x66, 0xca, 0xcd, 0x79, 0x2c, 0x43, 0x9b, 0xd1, 0xa6,
-  0x51, 0x31, 0x6e, 0xbe, 0xc3, 0x7c, 0x39, 0x47, 0x94, 0xc4, 0xa2, 0x5c,
-  0x44, 0x71, 0xaa, 0xae, 0x80, 0x57, 0x60, 0x89, 0xa2, 0x92, 0x72, 0x67,
-  0x77, 0x8d, 0x8f, 0x84, 0x78, 0x7a, 0x88, 0x91, 0x8b, 0x7d, 0x78, 0x88,
-  0x9e, 0x9f, 0x83, 0x67, 0x6f, 0x98, 0xb3, 0x9c, 0x66, 0x52, 0x7c, 0xb7,
-  0xbc, 0x80, 0x45, 0x55, 0xa1, 0xd1, 0xaa, 0x53, 0x35, 0x71, 0xc1, 0xca,
-  0x7e, 0x34, 0x45, 0x9c, 0xd6, 0xad, 0x4c, 0x25, 0x66, 0xc8, 0xd5, 0x70,
-  0x07, 0x19, 0x8d, 0xdf, 0xae, 0x36, 0x00, 0x40, 0xb6, 0xd3, 0x8a, 0x34,
-  0x34, 0x89, 0xcc, 0xb4, 0x5f, 0x2f, 0x5d, 0xb2, 0xc9, 0x8d, 0x41, 0x3e,
-  0x84, 0xc1, 0xaf, 0x6a, 0x45, 0x67, 0xa5, 0xb6, 0x8e, 0x5f, 0x5d, 0x84,
-  0xa3, 0x9b, 0x7b, 0x6a, 0x74, 0x8c, 0x92, 0x8a, 0x66, 0x3f, 0x34, 0x30,
-  0x31, 0x32, 0x35, 0x36, 0x39, 0x3b, 0x3d, 0x3f, 0x41, 0x43, 0x45, 0x47,
-  0x49, 0x4a, 0x4c, 0x4e, 0x4f, 0x51, 0x52, 0x54, 0x55, 0x57, 0x59, 0x5a,
-  0x5b, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69,
-  0x6a, 0x6a, 0x6c, 0x6c, 0x6e, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
-  0x76, 0x76, 0x77, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82,
-  0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84, 0x83, 0x84, 0x83, 0x84,
-  0x85, 0x84, 0x84, 0x85, 0x85, 0x86, 0x85, 0x86, 0x87, 0x87, 0x86, 0x87,
-  0x87, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x89, 0x89, 0x8a, 0x89, 0x8a,
-  0x89, 0x8a, 0x8a, 0x8b, 0x8a, 0x8b, 0x8c, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c,
-  0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d,
-  0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c,
-  0x8d, 0x8c, 0x8d, 0x8c, 0x8b, 0x8c, 0x8b, 0x8c, 0x8b, 0x8c, 0x8b, 0x8c,
-  0x8b, 0x8c, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a,
-  0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b,
-  0x8a, 0x8b, 0x8c, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a,
-  0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x89,
-  0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x89, 0x88, 0x89, 0x88, 0x87, 0x88, 0x87,
-  0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87,
-  0x86, 0x85, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x87, 0x86, 0x87, 0x86,
-  0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x87, 0x88, 0x88, 0x87, 0x88,
-  0x87, 0x88, 0x87, 0x88, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x86, 0x87,
-  0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x85, 0x85, 0x86, 0x85, 0x86,
-  0x85, 0x86, 0x85, 0x86, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x85,
-  0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84,
-  0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
-  0x84, 0x83, 0x84, 0x85, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84,
-  0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84,
-  0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x82, 0x83, 0x83, 0x82,
-  0x83, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81,
-  0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x4c, 0x49, 0x53, 0x54, 0x18, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x46,
-  0x4f, 0x49, 0x43, 0x52, 0x44, 0x0c, 0x00, 0x00, 0x00, 0x31, 0x39, 0x39,
-  0x34, 0x2d, 0x31, 0x31, 0x2d, 0x33, 0x30, 0x00, 0x00, 0x69, 0x64, 0x33,
-  0x20, 0x2c, 0x00, 0x00, 0x00, 0x49, 0x44, 0x33, 0x04, 0x00, 0x40, 0x00,
-  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x20, 0x05, 0x0e, 0x67,
-  0x39, 0x39, 0x73, 0x54, 0x44, 0x52, 0x43, 0x00, 0x00, 0x00, 0x0b, 0x00,
-  0x00, 0x00, 0x31, 0x39, 0x39, 0x34, 0x2d, 0x31, 0x31, 0x2d, 0x33, 0x30,
-  0x00
-};
+// sound in WAV format, we're not concernet with most of the header bytes
+// just samples per second and data size, we will always save in 8bit 
+// unsigned pcm
+// sample rate is at offset 24, data size at
+
+/* C:\Users\barto\Downloads\pacman_beginning8.wav (2/8/2018 12:53:34 PM)
+   StartOffset: 00000000, EndOffset: 00008439, Length: 0000843A */
+
+uint8_t pacman[33850] = {
+  0x52, 0x49, 0x46, 0x46, 0x32, 0x84, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
+  0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x40, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
+  0x64, 0x61, 0x74, 0x61, 0xC6, 0x83, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x80, 0x7E, 0x80, 0x7E, 0x80,
+  0x7E, 0x80, 0x7D, 0x84, 0xA2, 0x9F, 0xAF, 0xC0, 0xCE, 0xE1, 0xED, 0xF1,
+  0xED, 0xE8, 0xDC, 0xCB, 0xB5, 0xA4, 0x95, 0x92, 0x91, 0x94, 0x9D, 0xB1,
+  0xB6, 0xB5, 0xB9, 0xBB, 0x99, 0x7D, 0x66, 0x51, 0x64, 0x65, 0x5E, 0x74,
+  0x9D, 0xAF, 0xC9, 0xC4, 0xB8, 0xC1, 0xBB, 0xA3, 0x89, 0x73, 0x54, 0x3B,
+  0x2E, 0x30, 0x35, 0x42, 0x56, 0x70, 0x7F, 0x89, 0x8E, 0x8C, 0x86, 0x77,
+  0x5E, 0x49, 0x3E, 0x34, 0x31, 0x42, 0x5A, 0x72, 0x91, 0xB1, 0xC2, 0xC1,
+  0xBE, 0xBC, 0xAE, 0x92, 0x82, 0x7B, 0x71, 0x71, 0x7F, 0x91, 0xA7, 0xC0,
+  0xD4, 0xDD, 0xDF, 0xD7, 0xC5, 0xAF, 0x90, 0x76, 0x63, 0x5D, 0x5F, 0x62,
+  0x6B, 0x83, 0x92, 0x96, 0x9C, 0x9F, 0x8F, 0x72, 0x5D, 0x43, 0x29, 0x17,
+  0x14, 0x18, 0x20, 0x31, 0x4C, 0x66, 0x7A, 0x83, 0x83, 0x84, 0x7F, 0x6B,
+  0x57, 0x57, 0x53, 0x4C, 0x55, 0x73, 0x8A, 0xA4, 0xC2, 0xD9, 0xDF, 0xDC,
+  0xD3, 0xC3, 0xA6, 0x8A, 0x70, 0x60, 0x5E, 0x60, 0x65, 0x76, 0x93, 0x99,
+  0x99, 0x9F, 0x9D, 0x6F, 0x4D, 0x30, 0x20, 0x38, 0x3B, 0x39, 0x55, 0x7C,
+  0x8E, 0xA9, 0xA3, 0x9B, 0xA1, 0x9A, 0x84, 0x6E, 0x5A, 0x3F, 0x2B, 0x20,
+  0x22, 0x28, 0x35, 0x4A, 0x65, 0x72, 0x7C, 0x80, 0x7E, 0x78, 0x6B, 0x53,
+  0x41, 0x38, 0x2F, 0x2E, 0x3F, 0x55, 0x6C, 0x8C, 0xAB, 0xBA, 0xB9, 0xB8,
+  0xB5, 0xA3, 0x88, 0x7A, 0x72, 0x69, 0x6B, 0x79, 0x8C, 0xA5, 0xBF, 0xD2,
+  0xDC, 0xDE, 0xD4, 0xC1, 0xA8, 0x88, 0x6F, 0x5E, 0x59, 0x5C, 0x5F, 0x6B,
+  0x83, 0x93, 0x97, 0x9D, 0xA0, 0x8D, 0x71, 0x5C, 0x41, 0x26, 0x17, 0x14,
+  0x1A, 0x23, 0x36, 0x52, 0x6D, 0x81, 0x89, 0x89, 0x88, 0x82, 0x6D, 0x5A,
+  0x5A, 0x55, 0x4E, 0x5A, 0x78, 0x8F, 0xAB, 0xC9, 0xDD, 0xE1, 0xDE, 0xD5,
+  0xC3, 0xA7, 0x8A, 0x73, 0x67, 0x64, 0x67, 0x6D, 0x81, 0x9C, 0xA0, 0xA1,
+  0xA7, 0xA2, 0x71, 0x53, 0x33, 0x2A, 0x3F, 0x3C, 0x3D, 0x5B, 0x82, 0x96,
+  0xAF, 0xA5, 0xA4, 0xA9, 0xA0, 0x89, 0x72, 0x5B, 0x3F, 0x2B, 0x22, 0x25,
+  0x2B, 0x3A, 0x52, 0x6C, 0x79, 0x85, 0x87, 0x84, 0x7E, 0x6D, 0x56, 0x45,
+  0x3B, 0x31, 0x33, 0x45, 0x5D, 0x77, 0x96, 0xB4, 0xC0, 0xBE, 0xBC, 0xB7,
+  0xA4, 0x8A, 0x7D, 0x74, 0x6D, 0x70, 0x80, 0x93, 0xAB, 0xC5, 0xD7, 0xDE,
+  0xE0, 0xD5, 0xC1, 0xAA, 0x8B, 0x72, 0x61, 0x5E, 0x60, 0x64, 0x72, 0x8B,
+  0x99, 0x9D, 0xA4, 0xA5, 0x8E, 0x75, 0x5F, 0x41, 0x27, 0x18, 0x17, 0x1C,
+  0x27, 0x3C, 0x5B, 0x75, 0x87, 0x8E, 0x8E, 0x8D, 0x85, 0x6D, 0x5B, 0x5B,
+  0x56, 0x50, 0x61, 0x7D, 0x94, 0xB2, 0xCD, 0xE0, 0xE3, 0xDF, 0xD5, 0xC3,
+  0xA5, 0x8A, 0x74, 0x69, 0x67, 0x6A, 0x72, 0x88, 0xA1, 0xA4, 0xA7, 0xAE,
+  0xA2, 0x72, 0x58, 0x37, 0x32, 0x45, 0x41, 0x43, 0x66, 0x8A, 0x9F, 0xB6,
+  0xAA, 0xAA, 0xAF, 0xA4, 0x8B, 0x75, 0x5B, 0x3F, 0x2B, 0x23, 0x27, 0x2F,
+  0x3F, 0x59, 0x74, 0x80, 0x8B, 0x8E, 0x8A, 0x81, 0x6F, 0x55, 0x44, 0x3A,
+  0x31, 0x35, 0x49, 0x60, 0x7B, 0x9D, 0xB9, 0xC2, 0xBF, 0xBD, 0xB6, 0xA1,
+  0x87, 0x7B, 0x72, 0x6A, 0x70, 0x7F, 0x94, 0xAE, 0xC6, 0xD7, 0xDE, 0xDE,
+  0xD2, 0xBF, 0xA6, 0x87, 0x6F, 0x60, 0x5D, 0x61, 0x66, 0x77, 0x90, 0x9E,
+  0xA3, 0xAB, 0xA9, 0x92, 0x79, 0x61, 0x42, 0x28, 0x1A, 0x1A, 0x20, 0x2D,
+  0x44, 0x63, 0x7C, 0x8E, 0x93, 0x92, 0x90, 0x85, 0x6B, 0x5B, 0x59, 0x53,
+  0x4F, 0x61, 0x7D, 0x95, 0xB4, 0xCE, 0xDF, 0xE1, 0xDC, 0xD1, 0xBE, 0x9F,
+  0x84, 0x6F, 0x65, 0x64, 0x69, 0x72, 0x8B, 0xA4, 0xA8, 0xAB, 0xB2, 0xA2,
+  0x75, 0x5D, 0x3A, 0x37, 0x46, 0x40, 0x47, 0x6C, 0x8A, 0xA2, 0xB9, 0xAC,
+  0xAF, 0xB2, 0xA4, 0x8C, 0x76, 0x5A, 0x3D, 0x28, 0x20, 0x23, 0x2C, 0x3F,
+  0x5D, 0x79, 0x85, 0x90, 0x94, 0x98, 0x9B, 0x9A, 0x99, 0x9A, 0x9C, 0x9B,
+  0x9D, 0xA5, 0xA7, 0xA5, 0xAA, 0xB3, 0xB2, 0xB0, 0xB6, 0xBB, 0xB8, 0xB7,
+  0xBD, 0xBE, 0xBB, 0xBB, 0xBC, 0xBC, 0xB9, 0xBA, 0xBC, 0xBA, 0xB9, 0xB4,
+  0xB1, 0xB1, 0xAF, 0xAB, 0xA8, 0xA9, 0xA3, 0x99, 0x97, 0x95, 0x8C, 0x83,
+  0x83, 0x80, 0x70, 0x68, 0x69, 0x65, 0x5D, 0x5B, 0x5C, 0x59, 0x57, 0x56,
+  0x58, 0x5C, 0x61, 0x60, 0x64, 0x6D, 0x72, 0x6F, 0x79, 0x88, 0x89, 0x88,
+  0x94, 0xA0, 0x9E, 0x9E, 0xA4, 0xA7, 0xA3, 0xA5, 0xA6, 0xA7, 0xA4, 0xA1,
+  0x9B, 0x9C, 0x99, 0x92, 0x8B, 0x8C, 0x85, 0x76, 0x6F, 0x73, 0x63, 0x46,
+  0x44, 0x43, 0x5E, 0x75, 0x75, 0x78, 0x93, 0x9F, 0x9F, 0x96, 0x77, 0x73,
+  0x73, 0x6B, 0x5F, 0x60, 0x60, 0x58, 0x53, 0x54, 0x54, 0x51, 0x51, 0x52,
+  0x51, 0x4D, 0x4F, 0x4F, 0x54, 0x59, 0x59, 0x5A, 0x60, 0x63, 0x63, 0x67,
+  0x70, 0x73, 0x72, 0x7A, 0x86, 0x86, 0x85, 0x8E, 0x94, 0x93, 0x94, 0x9B,
+  0x9D, 0x9B, 0x9D, 0x9F, 0x9E, 0x9D, 0x9E, 0xA0, 0x9F, 0x9D, 0x99, 0x96,
+  0x96, 0x94, 0x8E, 0x8C, 0x8D, 0x87, 0x7F, 0x7E, 0x7D, 0x75, 0x6D, 0x6F,
+  0x6B, 0x5D, 0x57, 0x5A, 0x57, 0x4F, 0x4E, 0x50, 0x4D, 0x4C, 0x4D, 0x4E,
+  0x54, 0x58, 0x58, 0x5C, 0x65, 0x69, 0x68, 0x73, 0x81, 0x81, 0x82, 0x8F,
+  0x98, 0x96, 0x98, 0x9D, 0x9F, 0x9E, 0x9F, 0xA0, 0xA0, 0x9E, 0x9B, 0x96,
+  0x96, 0x93, 0x8D, 0x86, 0x88, 0x81, 0x74, 0x6E, 0x71, 0x60, 0x47, 0x47,
+  0x46, 0x62, 0x75, 0x74, 0x79, 0x93, 0x9B, 0x9C, 0x90, 0x75, 0x73, 0x72,
+  0x6B, 0x60, 0x63, 0x61, 0x5A, 0x57, 0x58, 0x58, 0x56, 0x55, 0x58, 0x56,
+  0x54, 0x55, 0x55, 0x5B, 0x5F, 0x5F, 0x61, 0x66, 0x68, 0x68, 0x6C, 0x75,
+  0x77, 0x77, 0x80, 0x8A, 0x89, 0x8A, 0x93, 0x99, 0x96, 0x99, 0xA1, 0xA2,
+  0xA0, 0xA1, 0xA4, 0xA3, 0xA2, 0xA2, 0xA1, 0xA0, 0x9E, 0x9A, 0x98, 0x98,
+  0x95, 0x91, 0x90, 0x8F, 0x89, 0x82, 0x82, 0x80, 0x78, 0x72, 0x74, 0x6F,
+  0x61, 0x5E, 0x60, 0x5B, 0x55, 0x55, 0x56, 0x54, 0x52, 0x53, 0x55, 0x5A,
+  0x5E, 0x5E, 0x63, 0x6B, 0x6E, 0x6E, 0x79, 0x85, 0x85, 0x86, 0x93, 0x9A,
+  0x99, 0x9A, 0xA0, 0xA1, 0x9F, 0xA1, 0xA2, 0xA2, 0xA0, 0x9D, 0x99, 0x9A,
+  0x96, 0x90, 0x8B, 0x8D, 0x85, 0x78, 0x74, 0x77, 0x62, 0x4F, 0x4F, 0x50,
+  0x6B, 0x79, 0x78, 0x80, 0x98, 0x9C, 0x9D, 0x8F, 0x78, 0x77, 0x75, 0x6D,
+  0x65, 0x68, 0x65, 0x5F, 0x5C, 0x5E, 0x5C, 0x5B, 0x5B, 0x5D, 0x5A, 0x58,
+  0x59, 0x5A, 0x5F, 0x62, 0x63, 0x65, 0x6A, 0x6B, 0x6B, 0x71, 0x79, 0x7A,
+  0x7B, 0x85, 0x8C, 0x8B, 0x8E, 0x96, 0x99, 0x98, 0x9B, 0xA2, 0xA2, 0xA1,
+  0xA3, 0xA4, 0xA3, 0xA3, 0xA5, 0xA5, 0xA4, 0xA2, 0x9E, 0x9C, 0x9B, 0x98,
+  0x94, 0x93, 0x92, 0x8C, 0x86, 0x83, 0x80, 0x78, 0x75, 0x76, 0x71, 0x67,
+  0x64, 0x65, 0x61, 0x5D, 0x5E, 0x5E, 0x5C, 0x5B, 0x5C, 0x5E, 0x62, 0x64,
+  0x64, 0x69, 0x6F, 0x71, 0x71, 0x7B, 0x83, 0x83, 0x85, 0x90, 0x94, 0x93,
+  0x95, 0x99, 0x9A, 0x99, 0x9A, 0x9B, 0x9C, 0x9A, 0x97, 0x94, 0x95, 0x92,
+  0x8D, 0x8A, 0x8B, 0x83, 0x7A, 0x78, 0x79, 0x67, 0x59, 0x59, 0x5D, 0x74,
+  0x7C, 0x7C, 0x83, 0x96, 0x98, 0x99, 0x8D, 0x7B, 0x7B, 0x79, 0x72, 0x6C,
+  0x6D, 0x6B, 0x66, 0x64, 0x65, 0x63, 0x62, 0x62, 0x63, 0x61, 0x60, 0x61,
+  0x62, 0x66, 0x68, 0x68, 0x6A, 0x6E, 0x6F, 0x6F, 0x74, 0x7A, 0x7A, 0x7C,
+  0x83, 0x89, 0x88, 0x8A, 0x91, 0x94, 0x92, 0x96, 0x9A, 0x9B, 0x9A, 0x9C,
+  0x9E, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9C, 0x98, 0x97, 0x96, 0x94, 0x91,
+  0x91, 0x8F, 0x89, 0x85, 0x86, 0x83, 0x7C, 0x79, 0x7B, 0x74, 0x6B, 0x6C,
+  0x6D, 0x69, 0x66, 0x67, 0x66, 0x63, 0x4B, 0x20, 0x05, 0x0A, 0x2D, 0x5B,
+  0x77, 0x74, 0x50, 0x2A, 0x25, 0x3D, 0x69, 0x8D, 0x99, 0x83, 0x59, 0x41,
+  0x48, 0x6C, 0x9A, 0xB0, 0xA3, 0x75, 0x4C, 0x40, 0x58, 0x8C, 0xAD, 0xAA,
+  0x85, 0x53, 0x33, 0x37, 0x64, 0x94, 0x94, 0x78, 0x45, 0x24, 0x32, 0x57,
+  0x8B, 0xB2, 0xBD, 0x95, 0x65, 0x45, 0x49, 0x79, 0xA3, 0xA8, 0x8B, 0x5A,
+  0x35, 0x31, 0x53, 0x89, 0xA2, 0x97, 0x6A, 0x3A, 0x28, 0x3E, 0x73, 0x9D,
+  0xA6, 0x88, 0x54, 0x36, 0x3D, 0x68, 0x9C, 0xB4, 0xA9, 0x79, 0x50, 0x4B,
+  0x6A, 0x9E, 0xC3, 0xC8, 0xA6, 0x73, 0x5C, 0x6A, 0x97, 0xC5, 0xD5, 0xC2,
+  0x91, 0x68, 0x64, 0x84, 0xB7, 0xD3, 0xCC, 0xA5, 0x72, 0x5A, 0x68, 0x99,
+  0xC2, 0xC8, 0xAE, 0x7A, 0x53, 0x4C, 0x70, 0xA4, 0xB7, 0xA8, 0x7A, 0x47,
+  0x31, 0x45, 0x7C, 0xA4, 0xA8, 0x89, 0x53, 0x33, 0x3C, 0x69, 0x9C, 0xB5,
+  0xAB, 0x7D, 0x51, 0x4E, 0x6E, 0xA1, 0xC6, 0xCE, 0xAC, 0x78, 0x5D, 0x69,
+  0x98, 0xC7, 0xD8, 0xC5, 0x92, 0x67, 0x5E, 0x7C, 0xB1, 0xCB, 0xC4, 0x9D,
+  0x6A, 0x4C, 0x56, 0x87, 0xB1, 0xAE, 0x91, 0x5A, 0x39, 0x48, 0x72, 0xA6,
+  0xCA, 0xCD, 0xA1, 0x6D, 0x4E, 0x5C, 0x91, 0xB8, 0xBA, 0x99, 0x63, 0x3F,
+  0x40, 0x69, 0x9E, 0xB2, 0xA3, 0x73, 0x42, 0x32, 0x4E, 0x87, 0xAE, 0xB2,
+  0x8F, 0x58, 0x3D, 0x48, 0x78, 0xAA, 0xBD, 0xAE, 0x7B, 0x52, 0x50, 0x73,
+  0xA8, 0xC9, 0xC9, 0xA3, 0x6F, 0x5A, 0x6C, 0x9C, 0xC8, 0xD3, 0xBC, 0x88,
+  0x62, 0x62, 0x85, 0xB8, 0xD2, 0xC8, 0x9C, 0x69, 0x55, 0x69, 0x9B, 0xC1,
+  0xC5, 0xA6, 0x70, 0x4A, 0x4A, 0x73, 0xA6, 0xB7, 0xA4, 0x73, 0x41, 0x31,
+  0x4A, 0x83, 0xA7, 0xA8, 0x85, 0x4F, 0x33, 0x3F, 0x6F, 0xA2, 0xB6, 0xA6,
+  0x73, 0x4C, 0x4C, 0x6E, 0xA4, 0xC7, 0xCA, 0xA3, 0x6F, 0x5A, 0x6B, 0x9C,
+  0xC9, 0xD7, 0xBF, 0x89, 0x61, 0x5A, 0x7B, 0xB0, 0xC8, 0xBD, 0x91, 0x5E,
+  0x45, 0x54, 0x89, 0xB0, 0xAB, 0x8B, 0x52, 0x35, 0x45, 0x72, 0xA7, 0xC7,
+  0xC2, 0x91, 0x60, 0x47, 0x5B, 0x91, 0xB6, 0xB4, 0x8F, 0x59, 0x39, 0x3E,
+  0x6D, 0xA0, 0xB0, 0x9E, 0x6A, 0x3B, 0x31, 0x53, 0x8B, 0xAE, 0xAD, 0x86,
+  0x51, 0x38, 0x48, 0x7C, 0xAC, 0xBC, 0xA6, 0x70, 0x4A, 0x4B, 0x73, 0xA9,
+  0xC7, 0xC3, 0x97, 0x63, 0x52, 0x69, 0x9D, 0xC6, 0xCF, 0xB2, 0x7B, 0x58,
+  0x5C, 0x86, 0xB9, 0xCE, 0xC0, 0x90, 0x5D, 0x4D, 0x67, 0x9C, 0xBF, 0xBF,
+  0x9B, 0x65, 0x43, 0x48, 0x76, 0xA7, 0xB4, 0x9E, 0x6A, 0x3C, 0x30, 0x4F,
+  0x88, 0xA8, 0xA5, 0x7E, 0x48, 0x30, 0x41, 0x73, 0xA3, 0xB4, 0x9F, 0x69,
+  0x45, 0x47, 0x6E, 0xA4, 0xC5, 0xC4, 0x98, 0x65, 0x54, 0x69, 0x9C, 0xC8,
+  0xD2, 0xB4, 0x7C, 0x57, 0x58, 0x80, 0xB4, 0xC8, 0xB9, 0x89, 0x57, 0x43,
+  0x59, 0x8F, 0xB2, 0xA9, 0x84, 0x4C, 0x35, 0x46, 0x76, 0xAA, 0xC4, 0xB8,
+  0x82, 0x53, 0x41, 0x5D, 0x95, 0xB7, 0xB2, 0x89, 0x53, 0x37, 0x42, 0x74,
+  0xA5, 0xB3, 0x9A, 0x64, 0x3A, 0x35, 0x5A, 0x92, 0xB2, 0xAC, 0x7F, 0x4B,
+  0x38, 0x4C, 0x81, 0xAF, 0xBB, 0x9F, 0x67, 0x44, 0x49, 0x73, 0xAA, 0xC5,
+  0xBB, 0x8B, 0x58, 0x4B, 0x65, 0x9C, 0xC4, 0xC8, 0xA6, 0x6E, 0x4F, 0x56,
+  0x85, 0xB8, 0xCA, 0xB8, 0x84, 0x54, 0x4A, 0x67, 0x9E, 0xC0, 0xBD, 0x95,
+  0x5E, 0x41, 0x4B, 0x7E, 0xAD, 0xB7, 0x9E, 0x68, 0x3B, 0x34, 0x59, 0x91,
+  0xAE, 0xA8, 0x7C, 0x46, 0x32, 0x46, 0x7C, 0xAA, 0xB6, 0x9C, 0x64, 0x40,
+  0x46, 0x71, 0xA8, 0xC4, 0xBB, 0x8B, 0x59, 0x4A, 0x64, 0x9B, 0xC4, 0xC9,
+  0xA7, 0x6E, 0x4C, 0x52, 0x81, 0xB4, 0xC7, 0xB4, 0x81, 0x50, 0x41, 0x5E,
+  0x96, 0xB6, 0xAC, 0x85, 0x4B, 0x34, 0x4B, 0x7E, 0xB3, 0xCC, 0xB7, 0x7D,
+  0x4D, 0x3E, 0x64, 0x9F, 0xC0, 0xB4, 0x9D, 0x98, 0x94, 0x92, 0x91, 0x90,
+  0x8F, 0x8E, 0x8D, 0x8D, 0x8B, 0x8B, 0x8A, 0x8A, 0x8B, 0x8B, 0x8A, 0x8A,
+  0x8B, 0x8A, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8E, 0x8E, 0x8D, 0x8F, 0x91,
+  0x90, 0x8F, 0x91, 0x91, 0x90, 0x90, 0x91, 0x90, 0x8F, 0x90, 0x90, 0x8F,
+  0x8F, 0x8E, 0x8C, 0x8D, 0x8C, 0x8A, 0x89, 0x89, 0x87, 0x85, 0x85, 0x84,
+  0x82, 0x80, 0x80, 0x7F, 0x7C, 0x79, 0x7A, 0x79, 0x77, 0x76, 0x77, 0x76,
+  0x76, 0x75, 0x76, 0x77, 0x78, 0x77, 0x78, 0x79, 0x7A, 0x7A, 0x7C, 0x7F,
+  0x7E, 0x7F, 0x81, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84, 0x85, 0x86, 0x85,
+  0x84, 0x84, 0x83, 0x83, 0x82, 0x80, 0x7F, 0x80, 0x7E, 0x7B, 0x79, 0x7A,
+  0x76, 0x70, 0x70, 0x6F, 0x76, 0x7B, 0x7B, 0x7D, 0x83, 0x85, 0x86, 0x83,
+  0x7C, 0x7C, 0x7B, 0x79, 0x77, 0x77, 0x76, 0x76, 0x74, 0x75, 0x74, 0x73,
+  0x73, 0x74, 0x74, 0x73, 0x73, 0x73, 0x76, 0x78, 0x78, 0x79, 0x78, 0x7A,
+  0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7F, 0x7E,
+  0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B,
+  0x7A, 0x7B, 0x7B, 0x79, 0x78, 0x79, 0x78, 0x77, 0x77, 0x78, 0x77, 0x78,
+  0x77, 0x78, 0x78, 0x79, 0x78, 0x79, 0x7A, 0x7B, 0x7A, 0x7C, 0x7E, 0x7D,
+  0x7E, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7B, 0x7A, 0x7B, 0x79,
+  0x76, 0x75, 0x76, 0x79, 0x7B, 0x7B, 0x7C, 0x7F, 0x80, 0x80, 0x7F, 0x7C,
+  0x7C, 0x7B, 0x7B, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A, 0x7A,
+  0x7B, 0x7A, 0x79, 0x7A, 0x7A, 0x7B, 0x7A, 0x7A, 0x7B, 0x7C, 0x7B, 0x7B,
+  0x7C, 0x7E, 0x7D, 0x7E, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
+  0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7D, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x80,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x7F, 0x81, 0x7E, 0x8A, 0x86, 0x63, 0x52, 0x55, 0x6D,
+  0x94, 0xB7, 0xC6, 0xC2, 0xAA, 0x81, 0x5E, 0x4E, 0x52, 0x6D, 0x94, 0xB5,
+  0xC2, 0xBC, 0xA2, 0x79, 0x58, 0x4A, 0x51, 0x6D, 0x95, 0xB5, 0xBF, 0xB8,
+  0x9C, 0x74, 0x53, 0x47, 0x50, 0x6E, 0x96, 0xB4, 0xBD, 0xB4, 0x96, 0x6F,
+  0x50, 0x45, 0x51, 0x71, 0x99, 0xB6, 0xBD, 0xB3, 0x93, 0x6B, 0x4D, 0x45,
+  0x53, 0x74, 0x9C, 0xB6, 0xBC, 0xAF, 0x8E, 0x65, 0x4B, 0x44, 0x54, 0x77,
+  0x9E, 0xB6, 0xBB, 0xAC, 0x89, 0x62, 0x48, 0x44, 0x56, 0x79, 0xA1, 0xB7,
+  0xB9, 0xA8, 0x84, 0x5D, 0x45, 0x43, 0x56, 0x7B, 0xA1, 0xB6, 0xB7, 0xA3,
+  0x7F, 0x59, 0x42, 0x43, 0x59, 0x7F, 0xA4, 0xB7, 0xB5, 0xA1, 0x7B, 0x56,
+  0x42, 0x43, 0x5C, 0x83, 0xA6, 0xB7, 0xB4, 0x9E, 0x77, 0x54, 0x42, 0x47,
+  0x61, 0x88, 0xAB, 0xB9, 0xB5, 0x9D, 0x75, 0x52, 0x43, 0x48, 0x64, 0x8D,
+  0xAD, 0xBA, 0xB3, 0x99, 0x70, 0x4F, 0x41, 0x47, 0x64, 0x8E, 0xAC, 0xB8,
+  0xB0, 0x93, 0x6B, 0x4A, 0x3E, 0x49, 0x67, 0x91, 0xAF, 0xB8, 0xAE, 0x90,
+  0x67, 0x48, 0x3E, 0x4B, 0x6B, 0x94, 0xB1, 0xB8, 0xAD, 0x8C, 0x64, 0x46,
+  0x3F, 0x4D, 0x6F, 0x99, 0xB2, 0xB8, 0xAA, 0x89, 0x60, 0x45, 0x3F, 0x50,
+  0x74, 0x9C, 0xB5, 0xB8, 0xA8, 0x86, 0x5D, 0x45, 0x42, 0x54, 0x79, 0xA0,
+  0xB6, 0xB9, 0xA7, 0x83, 0x5C, 0x44, 0x43, 0x57, 0x7D, 0xA3, 0xB7, 0xB8,
+  0xA4, 0x7E, 0x59, 0x43, 0x44, 0x5A, 0x81, 0xA6, 0xB8, 0xB7, 0xA2, 0x7B,
+  0x55, 0x41, 0x44, 0x5C, 0x83, 0xA7, 0xB8, 0xB5, 0x9D, 0x75, 0x51, 0x40,
+  0x45, 0x5F, 0x87, 0xAA, 0xB8, 0xB4, 0x9B, 0x72, 0x4F, 0x40, 0x47, 0x63,
+  0x8C, 0xAD, 0xB8, 0xB3, 0x97, 0x6E, 0x4E, 0x40, 0x49, 0x67, 0x90, 0xAF,
+  0xBA, 0xB3, 0x95, 0x6D, 0x4D, 0x41, 0x4D, 0x6D, 0x96, 0xB3, 0xBB, 0xB1,
+  0x92, 0x69, 0x4C, 0x42, 0x4F, 0x71, 0x99, 0xB4, 0xBA, 0xAE, 0x8D, 0x64,
+  0x46, 0x40, 0x4F, 0x72, 0x9B, 0xB5, 0xBA, 0xAC, 0x89, 0x60, 0x46, 0x40,
+  0x51, 0x75, 0x9E, 0xB5, 0xB9, 0xA9, 0x85, 0x5C, 0x44, 0x41, 0x54, 0x7A,
+  0xA1, 0xB7, 0xB9, 0xA6, 0x81, 0x5A, 0x43, 0x41, 0x57, 0x7E, 0xA4, 0xB8,
+  0xB9, 0xA4, 0x7D, 0x58, 0x43, 0x43, 0x5B, 0x82, 0xA8, 0xBB, 0xB9, 0xA3,
+  0x7A, 0x55, 0x42, 0x45, 0x5E, 0x87, 0xAB, 0xBB, 0xB7, 0x9F, 0x77, 0x53,
+  0x42, 0x48, 0x62, 0x8B, 0xAD, 0xBB, 0xB7, 0x9C, 0x73, 0x50, 0x41, 0x49,
+  0x65, 0x8F, 0xB0, 0xBB, 0xB3, 0x98, 0x6D, 0x4C, 0x40, 0x49, 0x67, 0x91,
+  0xB0, 0xBA, 0xB2, 0x93, 0x6A, 0x4A, 0x3F, 0x4B, 0x6B, 0x95, 0xB2, 0xBB,
+  0xB0, 0x90, 0x67, 0x49, 0x40, 0x4E, 0x70, 0x99, 0xB4, 0xBC, 0xAE, 0x8D,
+  0x64, 0x48, 0x42, 0x52, 0x76, 0x9E, 0xB8, 0xBC, 0xAE, 0x8B, 0x62, 0x48,
+  0x43, 0x55, 0x79, 0xA1, 0xB9, 0xBB, 0xAB, 0x85, 0x5B, 0x42, 0x40, 0x53,
+  0x7A, 0xA3, 0xB8, 0xB9, 0xA7, 0x81, 0x59, 0x42, 0x41, 0x57, 0x7F, 0xA6,
+  0xB9, 0xB9, 0xA4, 0x7C, 0x55, 0x41, 0x42, 0x5A, 0x82, 0xA8, 0xBA, 0xB8,
+  0xA1, 0x78, 0x53, 0x3F, 0x43, 0x5D, 0x86, 0xAB, 0xBB, 0xB7, 0x9E, 0x75,
+  0x51, 0x40, 0x46, 0x61, 0x8B, 0xAE, 0xBC, 0xB6, 0x9C, 0x73, 0x4F, 0x41,
+  0x49, 0x66, 0x91, 0xB2, 0xBD, 0xB5, 0x98, 0x6E, 0x4D, 0x40, 0x4A, 0x6A,
+  0x94, 0xB3, 0xBD, 0xB4, 0x95, 0x6A, 0x4B, 0x41, 0x4C, 0x6E, 0x98, 0xB5,
+  0xBD, 0xB2, 0x92, 0x66, 0x49, 0x40, 0x4E, 0x71, 0x9A, 0xB5, 0xBB, 0xAE,
+  0x8C, 0x62, 0x46, 0x3F, 0x50, 0x74, 0x9D, 0xB7, 0xBB, 0xAC, 0x89, 0x5F,
+  0x44, 0x40, 0x52, 0x78, 0xA1, 0xB8, 0xBB, 0xAA, 0x85, 0x5C, 0x44, 0x42,
+  0x57, 0x7D, 0xA6, 0xBA, 0xBC, 0xA9, 0x83, 0x5C, 0x46, 0x47, 0x5C, 0x83,
+  0xA9, 0xBB, 0xBA, 0xA6, 0x7E, 0x58, 0x44, 0x43, 0x46, 0x48, 0x4A, 0x4B,
+  0x4E, 0x4F, 0x50, 0x51, 0x53, 0x54, 0x56, 0x57, 0x58, 0x5A, 0x5B, 0x5D,
+  0x5D, 0x5E, 0x60, 0x61, 0x61, 0x63, 0x63, 0x65, 0x65, 0x66, 0x67, 0x68,
+  0x69, 0x6A, 0x6B, 0x6C, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x70, 0x71, 0x72,
+  0x73, 0x73, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x78, 0x79, 0x7A,
+  0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x82, 0x83,
+  0x83, 0x82, 0x83, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
+  0x83, 0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85,
+  0x84, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x87, 0x86, 0x87,
+  0x86, 0x87, 0x86, 0x87, 0x87, 0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x88,
+  0x89, 0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x87, 0x85, 0x86, 0x85, 0x86,
+  0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x87,
+  0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86,
+  0x85, 0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x85, 0x86, 0x86, 0x86, 0x85,
+  0x86, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87,
+  0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x86, 0x87, 0x86,
+  0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86,
+  0x87, 0x86, 0x87, 0x86, 0x85, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x84,
+  0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
+  0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
+  0x84, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x85, 0x86, 0x85, 0x86, 0x85,
+  0x86, 0x85, 0x86, 0x86, 0x85, 0x84, 0x85, 0x84, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
+  0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x82, 0x83, 0x82, 0x82,
+  0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81, 0x7B, 0x79, 0x79, 0x7A,
+  0x7B, 0x7A, 0x7B, 0x7A, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7D,
+  0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F,
+  0x80, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81,
+  0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x85, 0x95, 0xA1, 0xBF, 0xC3,
+  0xC6, 0xC3, 0xAD, 0x99, 0x73, 0x57, 0x4C, 0x50, 0x5D, 0x7D, 0x9A, 0xB8,
+  0xD0, 0xD1, 0xD6, 0xC5, 0xAF, 0x9F, 0x92, 0x95, 0xA0, 0xAF, 0xC3, 0xD3,
+  0xD1, 0xCE, 0xB2, 0x96, 0x73, 0x47, 0x31, 0x4E, 0x6F, 0x8F, 0xC5, 0xD9,
+  0xC8, 0xB0, 0x9F, 0x77, 0x5B, 0x3F, 0x31, 0x38, 0x46, 0x63, 0x79, 0x87,
+  0x8F, 0x8D, 0x7C, 0x65, 0x4A, 0x3E, 0x44, 0x52, 0x76, 0x97, 0xB7, 0xD2,
+  0xD5, 0xD4, 0xBF, 0xA2, 0x8C, 0x7C, 0x7E, 0x8B, 0x9D, 0xB7, 0xCB, 0xD0,
+  0xCD, 0xB7, 0x98, 0x79, 0x54, 0x45, 0x38, 0x3B, 0x53, 0x67, 0x7A, 0x7F,
+  0x79, 0x6D, 0x5B, 0x3D, 0x32, 0x2D, 0x39, 0x61, 0x7E, 0xAE, 0xCB, 0xD6,
+  0xD8, 0xC5, 0xAB, 0x8C, 0x78, 0x69, 0x73, 0x78, 0x98, 0xAB, 0xAB, 0xAA,
+  0x7D, 0x54, 0x4F, 0x51, 0x46, 0x61, 0x7E, 0x7E, 0x83, 0x99, 0x97, 0x95,
+  0x83, 0x62, 0x43, 0x23, 0x16, 0x14, 0x24, 0x3E, 0x67, 0x7E, 0x8E, 0x90,
+  0x85, 0x79, 0x5C, 0x52, 0x50, 0x55, 0x73, 0x8C, 0xB3, 0xD0, 0xDC, 0xDB,
+  0xC8, 0xAC, 0x8E, 0x79, 0x6A, 0x70, 0x7B, 0x93, 0xAC, 0xB2, 0xB8, 0xA4,
+  0x8F, 0x69, 0x3A, 0x26, 0x14, 0x1E, 0x33, 0x50, 0x6C, 0x80, 0x86, 0x83,
+  0x7A, 0x5E, 0x58, 0x4D, 0x57, 0x71, 0x86, 0xB0, 0xC9, 0xDF, 0xE4, 0xD7,
+  0xB5, 0x90, 0x6D, 0x58, 0x54, 0x4F, 0x67, 0x71, 0x6A, 0x85, 0xA4, 0x9B,
+  0x97, 0x90, 0x6F, 0x43, 0x3F, 0x44, 0x59, 0x79, 0x81, 0x8D, 0x81, 0x70,
+  0x4F, 0x2C, 0x16, 0x15, 0x25, 0x3D, 0x62, 0x7F, 0x9B, 0xA4, 0xA4, 0x9E,
+  0x81, 0x72, 0x64, 0x64, 0x77, 0x8A, 0xB0, 0xCD, 0xE1, 0xE7, 0xD5, 0xB6,
+  0x93, 0x77, 0x64, 0x61, 0x63, 0x77, 0x8C, 0x9B, 0xA3, 0x8F, 0x81, 0x62,
+  0x3B, 0x22, 0x0E, 0x12, 0x2A, 0x4C, 0x6E, 0x8F, 0x9A, 0xA6, 0xA2, 0x8E,
+  0x84, 0x71, 0x70, 0x77, 0x88, 0xA3, 0xBE, 0xCC, 0xD3, 0xC7, 0xAC, 0x90,
+  0x63, 0x4D, 0x36, 0x24, 0x37, 0x72, 0x98, 0xB2, 0xD0, 0xC3, 0x99, 0x73,
+  0x54, 0x37, 0x34, 0x35, 0x4A, 0x65, 0x7A, 0x87, 0x85, 0x7A, 0x68, 0x4E,
+  0x35, 0x2C, 0x2D, 0x46, 0x65, 0x87, 0xAB, 0xBB, 0xC4, 0xBD, 0xA4, 0x8E,
+  0x78, 0x6F, 0x73, 0x84, 0xA2, 0xC2, 0xD5, 0xDB, 0xD3, 0xB9, 0x9C, 0x75,
+  0x5B, 0x4C, 0x47, 0x5A, 0x66, 0x7D, 0x8A, 0x89, 0x82, 0x6D, 0x4E, 0x33,
+  0x24, 0x1E, 0x36, 0x50, 0x7B, 0xA7, 0xB8, 0xCD, 0xC5, 0xB5, 0x9B, 0x82,
+  0x76, 0x74, 0x7C, 0x8D, 0xAB, 0xB9, 0xC9, 0xB8, 0xA1, 0x81, 0x46, 0x28,
+  0x33, 0x47, 0x5F, 0x93, 0xB7, 0xB4, 0xAC, 0xA6, 0x89, 0x71, 0x4B, 0x30,
+  0x24, 0x27, 0x3A, 0x51, 0x6D, 0x80, 0x90, 0x8B, 0x81, 0x67, 0x4E, 0x44,
+  0x3D, 0x55, 0x6D, 0x8F, 0xB6, 0xC8, 0xDA, 0xD3, 0xC0, 0xA2, 0x87, 0x79,
+  0x75, 0x7C, 0x8D, 0xAB, 0xC0, 0xCD, 0xC8, 0xB4, 0x9D, 0x6E, 0x53, 0x35,
+  0x27, 0x36, 0x45, 0x68, 0x7D, 0x87, 0x89, 0x82, 0x6C, 0x54, 0x41, 0x37,
+  0x4D, 0x5E, 0x88, 0xB3, 0xCD, 0xE3, 0xE0, 0xD4, 0xB3, 0x8D, 0x6F, 0x63,
+  0x5F, 0x71, 0x86, 0x9B, 0xAC, 0x98, 0x7C, 0x7C, 0x77, 0x5E, 0x63, 0x6A,
+  0x60, 0x5C, 0x7D, 0x90, 0x9E, 0x9F, 0x8B, 0x76, 0x4A, 0x2C, 0x15, 0x11,
+  0x25, 0x46, 0x6A, 0x89, 0x9B, 0x9E, 0x9D, 0x88, 0x73, 0x62, 0x55, 0x61,
+  0x70, 0x8F, 0xB5, 0xCF, 0xE3, 0xE0, 0xD1, 0xB5, 0x92, 0x77, 0x69, 0x68,
+  0x76, 0x8D, 0xA3, 0xB5, 0xB4, 0xAB, 0x95, 0x6A, 0x47, 0x27, 0x18, 0x1F,
+  0x33, 0x54, 0x78, 0x8C, 0x99, 0x9A, 0x8A, 0x7D, 0x64, 0x5B, 0x62, 0x6D,
+  0x89, 0xA8, 0xC8, 0xDB, 0xE2, 0xD0, 0xB8, 0x8E, 0x6E, 0x58, 0x44, 0x4E,
+  0x52, 0x5A, 0x80, 0xAB, 0xB2, 0xB8, 0xB4, 0x8A, 0x59, 0x42, 0x3A, 0x42,
+  0x5C, 0x73, 0x8A, 0x93, 0x90, 0x7F, 0x61, 0x3E, 0x2D, 0x29, 0x2C, 0x32,
+  0x34, 0x3E, 0x43, 0x4B, 0x5A, 0x5C, 0x6A, 0x6F, 0x75, 0x7E, 0x7E, 0x84,
+  0x85, 0x87, 0x8B, 0x8A, 0x86, 0x85, 0x82, 0x7F, 0x7E, 0x73, 0x72, 0x6A,
+  0x62, 0x5F, 0x4D, 0x4C, 0x45, 0x40, 0x41, 0x3D, 0x3E, 0x45, 0x4A, 0x4D,
+  0x5B, 0x5C, 0x6D, 0x79, 0x7E, 0x92, 0x92, 0x9B, 0x9E, 0xA0, 0xA3, 0xA3,
+  0x9E, 0x9C, 0x98, 0x8F, 0x8F, 0x7C, 0x77, 0x66, 0x4A, 0x4B, 0x6C, 0x7A,
+  0x89, 0xA5, 0xA4, 0x89, 0x7A, 0x74, 0x67, 0x69, 0x5E, 0x5D, 0x5B, 0x59,
+  0x5A, 0x56, 0x56, 0x5B, 0x60, 0x61, 0x68, 0x69, 0x72, 0x79, 0x7C, 0x8C,
+  0x8E, 0x97, 0xA0, 0xA1, 0xAB, 0xAA, 0xAD, 0xAF, 0xAF, 0xB1, 0xB1, 0xAC,
+  0xA9, 0xA6, 0xA1, 0xA0, 0x96, 0x91, 0x8C, 0x80, 0x7F, 0x6E, 0x66, 0x63,
+  0x5A, 0x5B, 0x57, 0x56, 0x5A, 0x60, 0x61, 0x6D, 0x71, 0x7B, 0x8C, 0x8E,
+  0xA2, 0xA6, 0xAB, 0xB0, 0xB1, 0xB5, 0xB4, 0xB1, 0xAB, 0xA7, 0x9B, 0x9B,
+  0x8D, 0x83, 0x79, 0x5D, 0x54, 0x6E, 0x82, 0x8A, 0xA5, 0xAC, 0x95, 0x83,
+  0x80, 0x72, 0x71, 0x69, 0x65, 0x64, 0x61, 0x62, 0x5E, 0x5E, 0x60, 0x66,
+  0x67, 0x6C, 0x6E, 0x73, 0x7C, 0x7D, 0x8A, 0x8F, 0x95, 0x9F, 0x9F, 0xA8,
+  0xAA, 0xAC, 0xAE, 0xAD, 0xB0, 0xB0, 0xAC, 0xA8, 0xA8, 0xA1, 0xA0, 0x9A,
+  0x91, 0x90, 0x82, 0x81, 0x76, 0x6A, 0x69, 0x5F, 0x5E, 0x5B, 0x5A, 0x5C,
+  0x63, 0x64, 0x6D, 0x73, 0x78, 0x8A, 0x8C, 0x9A, 0xA3, 0xA4, 0xAC, 0xAB,
+  0xAF, 0xAF, 0xAD, 0xA7, 0xA7, 0x9D, 0x9B, 0x91, 0x83, 0x7E, 0x64, 0x53,
+  0x65, 0x7E, 0x86, 0x9F, 0xAD, 0x9B, 0x83, 0x80, 0x72, 0x6E, 0x69, 0x60,
+  0x62, 0x5D, 0x5F, 0x5C, 0x5A, 0x5B, 0x61, 0x64, 0x67, 0x6B, 0x6E, 0x78,
+  0x79, 0x84, 0x8D, 0x8F, 0x9B, 0x9C, 0xA3, 0xA8, 0xA7, 0xAC, 0xAA, 0xAD,
+  0xAE, 0xAC, 0xA7, 0xA6, 0xA1, 0x9F, 0x9B, 0x91, 0x90, 0x83, 0x7E, 0x78,
+  0x69, 0x68, 0x5F, 0x5D, 0x5C, 0x59, 0x5A, 0x5F, 0x62, 0x68, 0x70, 0x72,
+  0x82, 0x87, 0x8F, 0x9D, 0x9D, 0xA5, 0xA5, 0xA8, 0xA8, 0xA8, 0xA2, 0xA2,
+  0x9B, 0x96, 0x91, 0x81, 0x7D, 0x6A, 0x54, 0x5B, 0x77, 0x7F, 0x92, 0xA6,
+  0x9C, 0x84, 0x7E, 0x75, 0x6C, 0x6B, 0x62, 0x63, 0x5F, 0x5F, 0x5E, 0x5B,
+  0x5B, 0x60, 0x64, 0x66, 0x6B, 0x6C, 0x74, 0x78, 0x7F, 0x8A, 0x8B, 0x96,
+  0x9A, 0x9D, 0xA4, 0xA4, 0xA7, 0xA7, 0xA8, 0xAA, 0xA9, 0xA4, 0xA2, 0x9E,
+  0x9A, 0x99, 0x8F, 0x8D, 0x86, 0x7D, 0x7B, 0x6B, 0x68, 0x62, 0x5D, 0x5D,
+  0x59, 0x59, 0x5D, 0x62, 0x64, 0x6F, 0x70, 0x7D, 0x86, 0x89, 0x99, 0x9A,
+  0xA0, 0xA3, 0xA4, 0xA5, 0xA6, 0xA1, 0x9F, 0x9B, 0x92, 0x92, 0x82, 0x7D,
+  0x70, 0x56, 0x56, 0x72, 0x7C, 0x89, 0xA1, 0xA0, 0x88, 0x7D, 0x77, 0x6B,
+  0x6C, 0x63, 0x62, 0x60, 0x5F, 0x5E, 0x5C, 0x5C, 0x5F, 0x65, 0x66, 0x6B,
+  0x6B, 0x72, 0x77, 0x79, 0x84, 0x85, 0x8B, 0x91, 0x92, 0x99, 0x99, 0x9C,
+  0x9C, 0x9C, 0x9F, 0x9E, 0x9B, 0x98, 0x97, 0x93, 0x92, 0x8B, 0x88, 0x85,
+  0x7D, 0x7B, 0x70, 0x6A, 0x67, 0x61, 0x62, 0x5F, 0x5E, 0x61, 0x64, 0x66,
+  0x6E, 0x70, 0x77, 0x83, 0x85, 0x92, 0x95, 0x97, 0x9B, 0x9C, 0x9E, 0x9D,
+  0x9B, 0x98, 0x98, 0x8F, 0x8F, 0x85, 0x7E, 0x77, 0x62, 0x5B, 0x6E, 0x7C,
+  0x82, 0x97, 0x9D, 0x8D, 0x7F, 0x7C, 0x72, 0x70, 0x6B, 0x67, 0x67, 0x65,
+  0x66, 0x63, 0x62, 0x64, 0x68, 0x69, 0x6D, 0x6E, 0x73, 0x79, 0x7A, 0x84,
+  0x88, 0x8B, 0x93, 0x94, 0x9A, 0x9C, 0x9D, 0x9E, 0x9D, 0x9F, 0x9F, 0x9C,
+  0x99, 0x98, 0x93, 0x93, 0x8E, 0x88, 0x86, 0x7D, 0x7C, 0x73, 0x6A, 0x6A,
+  0x62, 0x62, 0x60, 0x5E, 0x60, 0x65, 0x66, 0x6B, 0x72, 0x74, 0x82, 0x83,
+  0x8E, 0x94, 0x95, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x97, 0xA8, 0xB3, 0xC3,
+  0xE5, 0xF4, 0xDF, 0xB5, 0x8D, 0x7A, 0x67, 0x7F, 0x9C, 0xAD, 0xB9, 0x97,
+  0x79, 0x89, 0xBB, 0xDF, 0xF4, 0xD5, 0x9F, 0x78, 0x66, 0x6A, 0x8D, 0xAF,
+  0xAD, 0x8B, 0x5C, 0x44, 0x44, 0x65, 0x8D, 0x9F, 0x8D, 0x5E, 0x32, 0x2A,
+  0x4C, 0x81, 0x9F, 0xA2, 0x87, 0x59, 0x41, 0x54, 0x85, 0xAB, 0xBA, 0xB4,
+  0x91, 0x6C, 0x6E, 0x93, 0xBE, 0xD3, 0xD4, 0xBA, 0x90, 0x7E, 0x8E, 0xB5,
+  0xD5, 0xDE, 0xCD, 0xA2, 0x83, 0x7F, 0x96, 0xBE, 0xD1, 0xC5, 0x9D, 0x76,
+  0x65, 0x6D, 0x90, 0xB0, 0xAF, 0x8A, 0x5D, 0x45, 0x3C, 0x50, 0x7A, 0x89,
+  0x74, 0x46, 0x23, 0x18, 0x2C, 0x58, 0x78, 0x7C, 0x64, 0x3B, 0x26, 0x37,
+  0x64, 0x8A, 0x99, 0x9B, 0x7B, 0x56, 0x59, 0x85, 0xB4, 0xCD, 0xCE, 0xB1,
+  0x84, 0x70, 0x80, 0xAC, 0xD0, 0xD6, 0xBA, 0x8C, 0x6B, 0x65, 0x7C, 0xA5,
+  0xBA, 0xA1, 0x71, 0x47, 0x37, 0x25, 0x47, 0x66, 0x7E, 0x86, 0x5D, 0x42,
+  0x5B, 0x96, 0xBC, 0xCD, 0xA3, 0x6F, 0x4C, 0x3E, 0x49, 0x6D, 0x8C, 0x86,
+  0x63, 0x3A, 0x26, 0x2B, 0x4E, 0x75, 0x82, 0x6D, 0x45, 0x23, 0x20, 0x40,
+  0x6F, 0x89, 0x89, 0x6D, 0x44, 0x32, 0x47, 0x76, 0x9A, 0xA8, 0xA0, 0x79,
+  0x57, 0x5C, 0x87, 0xB5, 0xCA, 0xCA, 0xA9, 0x7C, 0x6C, 0x83, 0xB3, 0xD4,
+  0xDA, 0xC3, 0x91, 0x72, 0x72, 0x91, 0xBC, 0xCE, 0xBD, 0x8F, 0x68, 0x5B,
+  0x67, 0x8F, 0xAE, 0xA8, 0x81, 0x54, 0x3E, 0x38, 0x53, 0x7C, 0x88, 0x70,
+  0x41, 0x20, 0x18, 0x31, 0x5F, 0x7A, 0x7B, 0x61, 0x37, 0x27, 0x3D, 0x6C,
+  0x8E, 0x9E, 0x9A, 0x77, 0x56, 0x5E, 0x8B, 0xB8, 0xD0, 0xCE, 0xAC, 0x7E,
+  0x70, 0x83, 0xB0, 0xD3, 0xD7, 0xB6, 0x87, 0x66, 0x67, 0x88, 0xB1, 0xB9,
+  0x98, 0x63, 0x43, 0x2F, 0x2C, 0x5A, 0x71, 0x88, 0x80, 0x53, 0x46, 0x71,
+  0xA7, 0xCB, 0xCB, 0x95, 0x64, 0x47, 0x40, 0x52, 0x7D, 0x93, 0x84, 0x5A,
+  0x34, 0x27, 0x35, 0x60, 0x83, 0x86, 0x69, 0x3C, 0x20, 0x2A, 0x52, 0x7F,
+  0x92, 0x8A, 0x65, 0x3E, 0x37, 0x57, 0x89, 0xA6, 0xAE, 0x9B, 0x6F, 0x59,
+  0x69, 0x9A, 0xC2, 0xD0, 0xC6, 0x9D, 0x77, 0x72, 0x92, 0xC1, 0xDA, 0xD8,
+  0xB5, 0x86, 0x71, 0x7A, 0xA2, 0xC7, 0xCF, 0xB5, 0x85, 0x64, 0x5E, 0x75,
+  0x9F, 0xB4, 0xA3, 0x76, 0x4E, 0x3C, 0x3F, 0x65, 0x89, 0x89, 0x67, 0x38,
+  0x1C, 0x1E, 0x42, 0x70, 0x83, 0x7D, 0x59, 0x32, 0x2C, 0x4D, 0x7D, 0x99,
+  0xA6, 0x96, 0x6D, 0x55, 0x6B, 0x9D, 0xC5, 0xD4, 0xC9, 0xA0, 0x79, 0x74,
+  0x93, 0xC1, 0xDA, 0xD3, 0xAB, 0x7E, 0x66, 0x6E, 0x91, 0xB8, 0xBB, 0x97,
+  0x63, 0x46, 0x32, 0x36, 0x64, 0x79, 0x8E, 0x7E, 0x50, 0x49, 0x79, 0xAE,
+  0xCF, 0xCA, 0x92, 0x61, 0x46, 0x42, 0x59, 0x85, 0x96, 0x83, 0x55, 0x32,
+  0x27, 0x3B, 0x67, 0x87, 0x86, 0x64, 0x38, 0x20, 0x2D, 0x5B, 0x87, 0x98,
+  0x8C, 0x64, 0x3E, 0x3C, 0x60, 0x91, 0xAC, 0xB1, 0x99, 0x6C, 0x59, 0x6F,
+  0xA0, 0xC6, 0xD1, 0xC3, 0x96, 0x73, 0x73, 0x96, 0xC4, 0xDA, 0xD5, 0xAF,
+  0x82, 0x70, 0x7D, 0xA7, 0xCB, 0xCF, 0xB1, 0x80, 0x62, 0x5E, 0x7A, 0xA6,
+  0xB8, 0xA3, 0x73, 0x4C, 0x3B, 0x43, 0x6E, 0x90, 0x8D, 0x67, 0x36, 0x1D,
+  0x24, 0x4C, 0x79, 0x8A, 0x7E, 0x56, 0x31, 0x2F, 0x53, 0x85, 0x9F, 0xA8,
+  0x93, 0x68, 0x54, 0x6E, 0xA2, 0xC8, 0xD5, 0xC6, 0x98, 0x74, 0x74, 0x96,
+  0xC5, 0xDB, 0xD0, 0xA4, 0x79, 0x65, 0x70, 0x98, 0xBD, 0xBA, 0x95, 0x60,
+  0x45, 0x33, 0x41, 0x6F, 0x84, 0x97, 0x7C, 0x50, 0x4C, 0x7F, 0xB3, 0xD4,
+  0xC7, 0x8E, 0x5F, 0x44, 0x43, 0x60, 0x8D, 0x99, 0x83, 0x53, 0x31, 0x29,
+  0x41, 0x6F, 0x8D, 0x88, 0x63, 0x35, 0x21, 0x33, 0x62, 0x8C, 0x99, 0x88,
+  0x5E, 0x3D, 0x3F, 0x67, 0x96, 0xB0, 0xB3, 0x94, 0x68, 0x5A, 0x6E, 0x92,
+  0xB4, 0xCF, 0xDA, 0xCC, 0xAB, 0x88, 0x72, 0x6E, 0x7D, 0xA1, 0xC6, 0xD9,
+  0xD7, 0xC3, 0xA1, 0x7E, 0x66, 0x5F, 0x70, 0x93, 0xB0, 0xBA, 0xBA, 0xA7,
+  0x7E, 0x56, 0x45, 0x3D, 0x40, 0x62, 0x88, 0x94, 0x8C, 0x7A, 0x56, 0x32,
+  0x21, 0x24, 0x3B, 0x63, 0x87, 0x95, 0x9A, 0x8D, 0x69, 0x49, 0x46, 0x56,
+  0x6B, 0x91, 0xBC, 0xCF, 0xCC, 0xB9, 0x9B, 0x7A, 0x69, 0x71, 0x8D, 0xB1,
+  0xCD, 0xD4, 0xCB, 0xB4, 0x8C, 0x67, 0x58, 0x61, 0x71, 0x8A, 0xA3, 0xAE,
+  0x8F, 0x66, 0x43, 0x2A, 0x3B, 0x4F, 0x68, 0x9A, 0xCD, 0xD4, 0xCC, 0xA0,
+  0x67, 0x4E, 0x44, 0x45, 0x5A, 0x81, 0x96, 0x97, 0x8B, 0x70, 0x49, 0x2F,
+  0x28, 0x34, 0x50, 0x73, 0x8C, 0x94, 0x8C, 0x6E, 0x47, 0x31, 0x33, 0x44,
+  0x65, 0x8E, 0xAC, 0xB0, 0xA5, 0x8E, 0x6F, 0x56, 0x56, 0x71, 0x95, 0xB6,
+  0xCF, 0xD7, 0xC9, 0xA7, 0x83, 0x6F, 0x6E, 0x80, 0xA6, 0xC9, 0xD7, 0xD3,
+  0xBE, 0x9A, 0x77, 0x61, 0x5D, 0x72, 0x96, 0xB2, 0xBB, 0xBA, 0xA2, 0x77,
+  0x53, 0x42, 0x3B, 0x44, 0x69, 0x8D, 0x96, 0x8F, 0x7A, 0x54, 0x31, 0x21,
+  0x27, 0x41, 0x6C, 0x8C, 0x9B, 0x9C, 0x8C, 0x66, 0x47, 0x48, 0x57, 0x6E,
+  0x95, 0xC0, 0xCF, 0xCA, 0xB5, 0x94, 0x73, 0x65, 0x70, 0x8E, 0xB3, 0xCD,
+  0xD2, 0xC8, 0xAE, 0x84, 0x61, 0x55, 0x5F, 0x72, 0x8D, 0xA6, 0xAE, 0x8D,
+  0x65, 0x41, 0x2B, 0x3C, 0x4F, 0x6C, 0xA0, 0xCE, 0xD3, 0xC9, 0x9A, 0x64,
+  0x4C, 0x41, 0x46, 0x61, 0x87, 0x9A, 0x9A, 0x8B, 0x6D, 0x46, 0x2F, 0x29,
+  0x38, 0x56, 0x7B, 0x93, 0x99, 0x8E, 0x6C, 0x46, 0x32, 0x35, 0x49, 0x6C,
+  0x97, 0xB1, 0xB2, 0xA5, 0x8B, 0x6A, 0x52, 0x57, 0x73, 0x97, 0xB9, 0xCF,
+  0xD6, 0xC4, 0xA0, 0x7D, 0x6B, 0x6A, 0x80, 0xA8, 0xC9, 0xD7, 0xD1, 0xBA,
+  0x95, 0x73, 0x5F, 0x5D, 0x74, 0x99, 0xB3, 0xBB, 0xB8, 0x9D, 0x71, 0x4E,
+  0x3F, 0x3A, 0x47, 0x6F, 0x92, 0x9A, 0x90, 0x79, 0x52, 0x2F, 0x23, 0x2A,
+  0x47, 0x72, 0x92, 0x9E, 0x9E, 0x8A, 0x62, 0x46, 0x47, 0x57, 0x72, 0x9B,
+  0xC2, 0xCF, 0xC8, 0xB1, 0x8E, 0x6E, 0x63, 0x6F, 0x90, 0xB5, 0xCE, 0xD1,
+  0xC6, 0xA9, 0x7E, 0x5D, 0x54, 0x60, 0x73, 0x91, 0xAA, 0xAE, 0x8B, 0x65,
+  0x3E, 0x2E, 0x3E, 0x51, 0x71, 0xA5, 0xCF, 0xD0, 0xC3, 0x8F, 0x5E, 0x47,
+  0x3F, 0x47, 0x65, 0x8B, 0x9C, 0x9B, 0x8B, 0x6B, 0x43, 0x2C, 0x2A, 0x3C,
+  0x5B, 0x82, 0x98, 0x9B, 0x8E, 0x69, 0x44, 0x32, 0x37, 0x4D, 0x71, 0x9B,
+  0xB3, 0xB3, 0xA3, 0x87, 0x66, 0x51, 0x58, 0x76, 0x9C, 0xBD, 0xD1, 0xD5,
+  0xC1, 0x9A, 0x78, 0x68, 0x6A, 0x82, 0xAB, 0xCB, 0xD6, 0xD0, 0xB4, 0x8E,
+  0x6C, 0x5A, 0x5C, 0x76, 0x9C, 0xB4, 0xBC, 0xB6, 0x99, 0x6D, 0x4B, 0x3F,
+  0x3A, 0x4C, 0x75, 0x93, 0x99, 0x8E, 0x74, 0x4C, 0x2C, 0x22, 0x2E, 0x4E,
+  0x79, 0x99, 0xA3, 0xA1, 0x88, 0x5E, 0x44, 0x45, 0x55, 0x73, 0x9E, 0xC3,
+  0xCC, 0xC3, 0xA8, 0x82, 0x62, 0x5A, 0x69, 0x8C, 0xB4, 0xCC, 0xCE, 0xC2,
+  0xA0, 0x74, 0x56, 0x4F, 0x5D, 0x77, 0x98, 0xB0, 0xB1, 0x90, 0x68, 0x41,
+  0x32, 0x3E, 0x52, 0x76, 0xAA, 0xCC, 0xCD, 0xBD, 0x89, 0x5A, 0x43, 0x3E,
+  0x49, 0x6C, 0x93, 0xA3, 0xA1, 0x8F, 0x6B, 0x44, 0x2E, 0x2E, 0x42, 0x65,
+  0x8D, 0xA0, 0xA2, 0x90, 0x69, 0x43, 0x33, 0x39, 0x51, 0x79, 0xA2, 0xB7,
+  0xB5, 0xA3, 0x81, 0x5F, 0x4D, 0x55, 0x74, 0x9C, 0xBD, 0xD0, 0xD0, 0xB8,
+  0x8F, 0x6D, 0x5E, 0x63, 0x7F, 0xAA, 0xC9, 0xD4, 0xCC, 0xB0, 0x88, 0x65,
+  0x54, 0x59, 0x78, 0x9F, 0xB8, 0xBF, 0xB7, 0x96, 0x69, 0x4A, 0x3D, 0x3D,
+  0x54, 0x7F, 0x9C, 0xA1, 0x95, 0x78, 0x4D, 0x2E, 0x25, 0x33, 0x56, 0x80,
+  0x9C, 0xA3, 0x9E, 0x84, 0x5E, 0x47, 0x4A, 0x5B, 0x78, 0xA2, 0xBD, 0xBF,
+  0xC0, 0xC3, 0xC5, 0xC2, 0xC1, 0xC1, 0xC1, 0xBF, 0xBD, 0xB9, 0xB9, 0xB7,
+  0xB2, 0xAD, 0xAC, 0xAB, 0xA1, 0x9B, 0x9D, 0x96, 0x82, 0x7F, 0x7C, 0x87,
+  0x98, 0x98, 0x98, 0xA6, 0xAF, 0xAD, 0xAB, 0x98, 0x90, 0x90, 0x8B, 0x83,
+  0x81, 0x81, 0x7C, 0x78, 0x77, 0x76, 0x75, 0x73, 0x72, 0x72, 0x6F, 0x6E,
+  0x6F, 0x71, 0x73, 0x74, 0x74, 0x76, 0x78, 0x77, 0x79, 0x7E, 0x80, 0x7F,
+  0x83, 0x8A, 0x8B, 0x8A, 0x8F, 0x93, 0x92, 0x93, 0x97, 0x99, 0x98, 0x98,
+  0x99, 0x99, 0x98, 0x99, 0x9A, 0x98, 0x98, 0x95, 0x92, 0x91, 0x90, 0x8C,
+  0x8A, 0x8B, 0x87, 0x82, 0x80, 0x80, 0x7A, 0x75, 0x75, 0x74, 0x6A, 0x65,
+  0x66, 0x63, 0x5F, 0x5D, 0x5F, 0x5E, 0x5C, 0x5B, 0x5C, 0x5F, 0x61, 0x61,
+  0x63, 0x69, 0x6C, 0x6B, 0x71, 0x7A, 0x7C, 0x7B, 0x82, 0x8B, 0x8A, 0x8A,
+  0x8E, 0x90, 0x8F, 0x8F, 0x90, 0x91, 0x90, 0x8E, 0x8A, 0x8B, 0x89, 0x83,
+  0x7F, 0x7F, 0x7C, 0x74, 0x71, 0x73, 0x6C, 0x5D, 0x5C, 0x5B, 0x68, 0x74,
+  0x75, 0x77, 0x84, 0x8C, 0x8C, 0x88, 0x78, 0x75, 0x74, 0x71, 0x6B, 0x6A,
+  0x6B, 0x67, 0x64, 0x65, 0x64, 0x63, 0x63, 0x64, 0x63, 0x61, 0x62, 0x62,
+  0x64, 0x67, 0x67, 0x68, 0x6B, 0x6C, 0x6C, 0x6E, 0x73, 0x75, 0x75, 0x78,
+  0x7F, 0x7F, 0x7F, 0x84, 0x88, 0x87, 0x87, 0x8C, 0x8D, 0x8C, 0x8D, 0x8E,
+  0x8F, 0x8D, 0x8E, 0x8F, 0x8F, 0x8E, 0x8C, 0x8A, 0x8A, 0x89, 0x86, 0x85,
+  0x85, 0x82, 0x7E, 0x7E, 0x7D, 0x79, 0x74, 0x75, 0x73, 0x6B, 0x68, 0x68,
+  0x67, 0x63, 0x62, 0x64, 0x62, 0x60, 0x61, 0x62, 0x65, 0x67, 0x67, 0x6A,
+  0x6F, 0x71, 0x71, 0x77, 0x7E, 0x7F, 0x7F, 0x86, 0x8C, 0x8B, 0x8B, 0x8D,
+  0x8F, 0x8E, 0x8E, 0x8F, 0x8F, 0x8E, 0x8D, 0x8A, 0x8A, 0x89, 0x86, 0x82,
+  0x83, 0x80, 0x78, 0x74, 0x76, 0x6E, 0x5F, 0x5E, 0x5E, 0x6C, 0x77, 0x78,
+  0x79, 0x85, 0x8B, 0x8B, 0x87, 0x7A, 0x78, 0x78, 0x75, 0x71, 0x72, 0x71,
+  0x6E, 0x6C, 0x6D, 0x6C, 0x6B, 0x6B, 0x6C, 0x6B, 0x69, 0x6A, 0x6B, 0x6D,
+  0x6E, 0x6F, 0x70, 0x71, 0x73, 0x73, 0x75, 0x79, 0x7B, 0x7A, 0x7E, 0x83,
+  0x83, 0x84, 0x88, 0x8A, 0x8A, 0x8A, 0x8E, 0x8F, 0x8E, 0x8E, 0x90, 0x8F,
+  0x8E, 0x8F, 0x90, 0x8F, 0x8E, 0x8D, 0x8B, 0x8B, 0x89, 0x88, 0x86, 0x87,
+  0x84, 0x80, 0x80, 0x7F, 0x7B, 0x78, 0x79, 0x77, 0x70, 0x6E, 0x6E, 0x6D,
+  0x6A, 0x69, 0x6A, 0x69, 0x69, 0x69, 0x6A, 0x6D, 0x6E, 0x6E, 0x71, 0x75,
+  0x77, 0x76, 0x7B, 0x82, 0x82, 0x82, 0x89, 0x8D, 0x8C, 0x8D, 0x8F, 0x91,
+  0x8F, 0x90, 0x91, 0x91, 0x90, 0x8E, 0x8C, 0x8C, 0x8B, 0x88, 0x85, 0x85,
+  0x82, 0x7B, 0x78, 0x7A, 0x6F, 0x65, 0x65, 0x65, 0x72, 0x7B, 0x7A, 0x7E,
+  0x8B, 0x8D, 0x8E, 0x88, 0x7C, 0x7A, 0x79, 0x76, 0x71, 0x72, 0x72, 0x71,
+  0x70, 0x71, 0x71, 0x70, 0x70, 0x71, 0x70, 0x6F, 0x70, 0x71, 0x73, 0x76,
+  0x75, 0x76, 0x77, 0x78, 0x78, 0x79, 0x7C, 0x7D, 0x7D, 0x80, 0x83, 0x83,
+  0x84, 0x86, 0x88, 0x88, 0x89, 0x8B, 0x8C, 0x8B, 0x8C, 0x8C, 0x8B, 0x8B,
+  0x8C, 0x8D, 0x8C, 0x8B, 0x8A, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x83,
+  0x81, 0x81, 0x80, 0x7C, 0x7B, 0x7B, 0x79, 0x75, 0x73, 0x74, 0x72, 0x70,
+  0x70, 0x71, 0x70, 0x70, 0x6F, 0x70, 0x72, 0x73, 0x73, 0x75, 0x78, 0x79,
+  0x7A, 0x7E, 0x81, 0x81, 0x82, 0x87, 0x8A, 0x89, 0x8A, 0x8C, 0x8D, 0x8B,
+  0x8C, 0x8D, 0x8D, 0x8C, 0x8A, 0x89, 0x8A, 0x89, 0x86, 0x84, 0x85, 0x82,
+  0x7E, 0x7D, 0x7D, 0x76, 0x6E, 0x6F, 0x6F, 0x79, 0x7E, 0x7E, 0x81, 0x89,
+  0x8B, 0x8B, 0x85, 0x7C, 0x7C, 0x7B, 0x78, 0x75, 0x76, 0x75, 0x73, 0x72,
+  0x73, 0x72, 0x72, 0x71, 0x72, 0x71, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
+  0x78, 0x7A, 0x7B, 0x7A, 0x7C, 0x7E, 0x7E, 0x7E, 0x81, 0x83, 0x83, 0x84,
+  0x87, 0x88, 0x87, 0x88, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A,
+  0x8A, 0x89, 0x89, 0x88, 0x88, 0x87, 0x86, 0x85, 0x86, 0x85, 0x83, 0x82,
+  0x82, 0x81, 0x7F, 0x7E, 0x7E, 0x7D, 0x79, 0x78, 0x79, 0x77, 0x75, 0x76,
+  0x76, 0x75, 0x74, 0x75, 0x75, 0x76, 0x78, 0x77, 0x79, 0x7B, 0x7B, 0x7C,
+  0x7F, 0x81, 0x81, 0x82, 0x85, 0x86, 0x86, 0x87, 0x88, 0x88, 0x87, 0x88,
+  0x89, 0x88, 0x88, 0x87, 0x86, 0x87, 0x86, 0x85, 0x83, 0x84, 0x81, 0x7F,
+  0x7E, 0x7E, 0x79, 0x74, 0x75, 0x75, 0x7C, 0x7F, 0x7F, 0x81, 0x87, 0x87,
+  0x89, 0x84, 0x7E, 0x7F, 0x7E, 0x7C, 0x7A, 0x7B, 0x79, 0x78, 0x77, 0x78,
+  0x77, 0x76, 0x77, 0x76, 0x75, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x78,
+  0x79, 0x7A, 0x79, 0x7B, 0x7D, 0x7D, 0x7E, 0x80, 0x82, 0x81, 0x83, 0x83,
+  0x82, 0x82, 0x83, 0x84, 0x83, 0x83, 0x84, 0x85, 0x84, 0x85, 0x85, 0x84,
+  0x85, 0x86, 0x85, 0x85, 0x85, 0x84, 0x83, 0x84, 0x83, 0x82, 0x82, 0x81,
+  0x82, 0x80, 0x7F, 0x80, 0x7F, 0x7D, 0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7C,
+  0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F,
+  0x81, 0x80, 0x81, 0x82, 0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83,
+  0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7E, 0x7F,
+  0x7E, 0x7B, 0x79, 0x79, 0x7A, 0x7E, 0x7F, 0x7F, 0x81, 0x84, 0x85, 0x84,
+  0x82, 0x7F, 0x80, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C,
+  0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C, 0x7D, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x82,
+  0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x81,
+  0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x80, 0x78,
+  0x60, 0x57, 0x4D, 0x39, 0x24, 0x17, 0x12, 0x1B, 0x2C, 0x46, 0x60, 0x6F,
+  0x76, 0x71, 0x64, 0x4F, 0x3C, 0x30, 0x2D, 0x37, 0x47, 0x60, 0x77, 0x85,
+  0x89, 0x80, 0x6F, 0x53, 0x3D, 0x31, 0x30, 0x3E, 0x54, 0x73, 0x8A, 0x9A,
+  0x9B, 0x8E, 0x76, 0x56, 0x3F, 0x33, 0x36, 0x48, 0x64, 0x85, 0x9E, 0xAC,
+  0xA8, 0x98, 0x7A, 0x57, 0x42, 0x36, 0x3F, 0x54, 0x73, 0x96, 0xAC, 0xB6,
+  0xAF, 0x9C, 0x7B, 0x5A, 0x45, 0x3E, 0x49, 0x60, 0x83, 0xA4, 0xB7, 0xBC,
+  0xB3, 0x9D, 0x79, 0x5B, 0x48, 0x44, 0x54, 0x6D, 0x92, 0xAF, 0xC0, 0xC2,
+  0xB5, 0x9D, 0x78, 0x5C, 0x4C, 0x4C, 0x5D, 0x79, 0x9D, 0xB7, 0xC6, 0xC3,
+  0xB4, 0x98, 0x74, 0x5B, 0x4D, 0x52, 0x65, 0x82, 0xA6, 0xBD, 0xC8, 0xC3,
+  0xB1, 0x92, 0x6F, 0x59, 0x4E, 0x56, 0x6A, 0x8C, 0xAD, 0xC0, 0xC8, 0xBF,
+  0xAB, 0x89, 0x69, 0x54, 0x4D, 0x59, 0x70, 0x94, 0xB2, 0xC3, 0xC8, 0xBB,
+  0xA7, 0x84, 0x65, 0x53, 0x50, 0x5F, 0x79, 0x9D, 0xB8, 0xC8, 0xC8, 0xBA,
+  0xA0, 0x7D, 0x62, 0x51, 0x52, 0x64, 0x82, 0xA6, 0xBD, 0xCA, 0xC6, 0xB7,
+  0x9A, 0x76, 0x5D, 0x50, 0x56, 0x6A, 0x88, 0xAA, 0xC0, 0xCA, 0xC3, 0xB1,
+  0x91, 0x6F, 0x58, 0x4E, 0x58, 0x6D, 0x8F, 0xB0, 0xC2, 0xC9, 0xBF, 0xAA,
+  0x88, 0x68, 0x53, 0x4D, 0x5A, 0x72, 0x96, 0xB3, 0xC4, 0xC7, 0xBA, 0xA2,
+  0x7E, 0x61, 0x4F, 0x4D, 0x5C, 0x78, 0x9D, 0xB6, 0xC6, 0xC5, 0xB5, 0x9A,
+  0x75, 0x5B, 0x4C, 0x4F, 0x61, 0x7F, 0xA3, 0xBB, 0xC7, 0xC2, 0xB1, 0x92,
+  0x6F, 0x57, 0x4B, 0x52, 0x66, 0x87, 0xA9, 0xBE, 0xC7, 0xBF, 0xAB, 0x8A,
+  0x67, 0x52, 0x49, 0x54, 0x6B, 0x8E, 0xAE, 0xC1, 0xC6, 0xBB, 0xA5, 0x81,
+  0x61, 0x4E, 0x4A, 0x57, 0x71, 0x95, 0xB2, 0xC2, 0xC4, 0xB6, 0x9B, 0x76,
+  0x59, 0x49, 0x48, 0x59, 0x75, 0x9A, 0xB4, 0xC1, 0xC0, 0xAF, 0x93, 0x6F,
+  0x55, 0x46, 0x4B, 0x5E, 0x7E, 0xA2, 0xB9, 0xC5, 0xBF, 0xAC, 0x8D, 0x68,
+  0x51, 0x45, 0x4E, 0x64, 0x85, 0xA8, 0xBC, 0xC5, 0xBD, 0xA8, 0x84, 0x63,
+  0x4E, 0x47, 0x52, 0x6A, 0x8E, 0xAE, 0xC0, 0xC4, 0xB8, 0xA0, 0x7B, 0x5C,
+  0x4A, 0x46, 0x56, 0x70, 0x95, 0xB2, 0xC1, 0xC2, 0xB3, 0x98, 0x73, 0x56,
+  0x46, 0x48, 0x59, 0x77, 0x9B, 0xB4, 0xC2, 0xBE, 0xAD, 0x8E, 0x6A, 0x51,
+  0x42, 0x48, 0x5C, 0x7D, 0xA1, 0xB8, 0xC1, 0xBB, 0xA7, 0x86, 0x62, 0x4C,
+  0x42, 0x4B, 0x62, 0x84, 0xA6, 0xBB, 0xC1, 0xB6, 0xA1, 0x7D, 0x5D, 0x48,
+  0x42, 0x4F, 0x68, 0x8D, 0xAC, 0xBE, 0xC1, 0xB4, 0x9B, 0x76, 0x57, 0x46,
+  0x44, 0x54, 0x6F, 0x95, 0xB1, 0xBF, 0xBE, 0xAF, 0x92, 0x6D, 0x52, 0x43,
+  0x46, 0x58, 0x77, 0x9C, 0xB4, 0xC0, 0xBB, 0xAA, 0x8A, 0x65, 0x4D, 0x40,
+  0x46, 0x5B, 0x7D, 0xA0, 0xB5, 0xBE, 0xB6, 0xA2, 0x80, 0x5E, 0x48, 0x3F,
+  0x4B, 0x62, 0x86, 0xA8, 0xBB, 0xC2, 0xB7, 0x9F, 0x7A, 0x5A, 0x45, 0x40,
+  0x4F, 0x69, 0x8E, 0xAD, 0xBE, 0xC0, 0xB2, 0x98, 0x73, 0x56, 0x44, 0x43,
+  0x54, 0x72, 0x98, 0xB2, 0xC1, 0xBF, 0xAE, 0x90, 0x6B, 0x50, 0x41, 0x45,
+  0x59, 0x79, 0x9D, 0xB6, 0xC2, 0xBB, 0xA8, 0x87, 0x63, 0x4C, 0x3F, 0x48,
+  0x5E, 0x7F, 0xA3, 0xB8, 0xC1, 0xB7, 0xA2, 0x7F, 0x5D, 0x46, 0x3E, 0x4B,
+  0x63, 0x87, 0xA8, 0xBB, 0xBF, 0xB3, 0x9B, 0x76, 0x56, 0x42, 0x3E, 0x4F,
+  0x6A, 0x8F, 0xAC, 0xBC, 0xBE, 0xAE, 0x93, 0x6D, 0x50, 0x40, 0x41, 0x53,
+  0x72, 0x97, 0xB2, 0xBF, 0xBC, 0xAA, 0x8B, 0x67, 0x4D, 0x3F, 0x44, 0x59,
+  0x7A, 0x9E, 0xB5, 0xC0, 0xB9, 0xA5, 0x84, 0x60, 0x48, 0x3E, 0x48, 0x5F,
+  0x82, 0xA4, 0xB8, 0xC0, 0xB6, 0x9F, 0x7B, 0x59, 0x44, 0x3E, 0x4C, 0x64,
+  0x89, 0xA8, 0xBA, 0xBD, 0xAF, 0x96, 0x71, 0x52, 0x40, 0x3D, 0x4E, 0x6B,
+  0x90, 0xAE, 0xBE, 0xBD, 0xAD, 0x90, 0x6B, 0x4E, 0x3E, 0x41, 0x54, 0x74,
+  0x99, 0xB2, 0xC0, 0xBB, 0xA8, 0x88, 0x63, 0x4B, 0x3D, 0x46, 0x5C, 0x7D,
+  0xA1, 0xB8, 0xC1, 0xB9, 0xA4, 0x81, 0x5F, 0x47, 0x3E, 0x4A, 0x61, 0x85,
+  0xA6, 0xBA, 0xC0, 0xB4, 0x9E, 0x78, 0x58, 0x43, 0x3E, 0x4D, 0x67, 0x8D,
+  0xAB, 0xBD, 0xBF, 0xB0, 0x96, 0x6F, 0x52, 0x40, 0x3F, 0x50, 0x6F, 0x93,
+  0xAF, 0xBF, 0xBC, 0xAB, 0x8D, 0x67, 0x4D, 0x3D, 0x42, 0x56, 0x76, 0x9A,
+  0xB3, 0xBF, 0xB9, 0xA5, 0x85, 0x61, 0x48, 0x3B, 0x45, 0x5B, 0x7E, 0xA0,
+  0xB7, 0xC0, 0xB6, 0xA1, 0x7D, 0x5C, 0x45, 0x3D, 0x4A, 0x62, 0x87, 0xA7,
+  0xBB, 0xC0, 0xB3, 0x9A, 0x75, 0x55, 0x41, 0x3E, 0x4E, 0x6A, 0x8F, 0xAC,
+  0xBE, 0xBE, 0xAE, 0x92, 0x6D, 0x50, 0x3F, 0x40, 0x53, 0x70, 0x96, 0xB0,
+  0xBE, 0xBA, 0xA8, 0x89, 0x64, 0x49, 0x3B, 0x42, 0x56, 0x78, 0x9B, 0xB2,
+  0xBF, 0xB9, 0xA5, 0x83, 0x5F, 0x47, 0x3C, 0x47, 0x5E, 0x80, 0xA4, 0xB9,
+  0xC0, 0xB5, 0x9E, 0x7B, 0x59, 0x44, 0x3D, 0x4B, 0x65, 0x89, 0xAA, 0xBD,
+  0xC1, 0xB3, 0x99, 0x74, 0x55, 0x42, 0x3F, 0x51, 0x6D, 0x92, 0xAF, 0xBF,
+  0xBF, 0xAE, 0x91, 0x6B, 0x4F, 0x3E, 0x42, 0x54, 0x74, 0x9A, 0xB3, 0xC0,
+  0xBC, 0xA9, 0x89, 0x64, 0x4A, 0x3C, 0x44, 0x5A, 0x7C, 0xA0, 0xB6, 0xC1,
+  0xB7, 0xA2, 0x7F, 0x5C, 0x46, 0x3B, 0x47, 0x5F, 0x83, 0xA5, 0xB9, 0xBF,
+  0xB4, 0x9C, 0x76, 0x57, 0x41, 0x3C, 0x4B, 0x65, 0x8B, 0xAA, 0xBC, 0xBE,
+  0xB0, 0x95, 0x6F, 0x51, 0x3F, 0x3E, 0x51, 0x6E, 0x94, 0xAF, 0xBF, 0xBD,
+  0xAC, 0x8E, 0x68, 0x4D, 0x3D, 0x42, 0x56, 0x77, 0x9C, 0xB4, 0xC0, 0xB9,
+  0xA6, 0x85, 0x61, 0x49, 0x3D, 0x45, 0x5C, 0x7E, 0xA1, 0xB8, 0xC0, 0xB6,
+  0xA0, 0x7C, 0x5A, 0x43, 0x3A, 0x48, 0x60, 0x85, 0xA5, 0xB9, 0xBE, 0xB0,
+  0x98, 0x75, 0x55, 0x40, 0x3D, 0x4D, 0x69, 0x8F, 0xAD, 0xBE, 0xBF, 0xAF,
+  0x93, 0x6D, 0x4F, 0x3D, 0x3F, 0x52, 0x70, 0x96, 0xB1, 0xC0, 0xBD, 0xAB,
+  0x8C, 0x67, 0x4D, 0x3E, 0x43, 0x59, 0x7A, 0x9F, 0xB7, 0xC2, 0xBA, 0xA5,
+  0x83, 0x60, 0x48, 0x3C, 0x46, 0x5E, 0x82, 0xA4, 0xB9, 0xC2, 0xB6, 0x9F,
+  0x7B, 0x59, 0x43, 0x3D, 0x4B, 0x64, 0x8A, 0xA9, 0xBC, 0xC0, 0xB2, 0x98,
+  0x72, 0x52, 0x3F, 0x3E, 0x4E, 0x6A, 0x91, 0xAD, 0xBE, 0xBD, 0xAC, 0x90,
+  0x6A, 0x4E, 0x3C, 0x3F, 0x53, 0x72, 0x98, 0xB2, 0xBF, 0xBA, 0xA7, 0x88,
+  0x62, 0x49, 0x3C, 0x42, 0x59, 0x7C, 0x9F, 0xB6, 0xC1, 0xB8, 0xA3, 0x80,
+  0x5C, 0x45, 0x3C, 0x47, 0x60, 0x84, 0xA6, 0xBA, 0xC0, 0xB5, 0x9C, 0x77,
+  0x57, 0x42, 0x3D, 0x4C, 0x66, 0x8D, 0xAA, 0xBD, 0xBF, 0xB0, 0x96, 0x6F,
+  0x52, 0x3E, 0x3D, 0x4F, 0x6D, 0x92, 0xAD, 0xBC, 0xBA, 0xA9, 0x8C, 0x66,
+  0x4B, 0x3D, 0x42, 0x56, 0x78, 0x9D, 0xB7, 0xC5, 0xBE, 0xAA, 0x88, 0x63,
+  0x49, 0x3C, 0x45, 0x5C, 0x7F, 0xA3, 0xBA, 0xC3, 0xBA, 0xA3, 0x7F, 0x5C,
+  0x45, 0x3D, 0x4A, 0x64, 0x89, 0xA9, 0xBD, 0xC3, 0xB6, 0x9E, 0x78, 0x57,
+  0x42, 0x3D, 0x4E, 0x69, 0x8F, 0xAE, 0xBF, 0xC0, 0xB1, 0x95, 0x6E, 0x51,
+  0x3E, 0x3F, 0x52, 0x70, 0x97, 0xB2, 0xC1, 0xBE, 0xAB, 0x8C, 0x66, 0x4B,
+  0x3B, 0x41, 0x57, 0x77, 0x9D, 0xB5, 0xC0, 0xB9, 0xA5, 0x83, 0x5E, 0x45,
+  0x3A, 0x45, 0x5C, 0x80, 0xA2, 0xB8, 0xC1, 0xB6, 0x9E, 0x7A, 0x58, 0x41,
+  0x3A, 0x48, 0x63, 0x88, 0xA9, 0xBC, 0xC0, 0xB2, 0x98, 0x72, 0x53, 0x40,
+  0x3C, 0x4D, 0x6A, 0x91, 0xAE, 0xBF, 0xBE, 0xAE, 0x91, 0x6A, 0x4E, 0x3D,
+  0x3F, 0x52, 0x71, 0x98, 0xB3, 0xC1, 0xBC, 0xA9, 0x88, 0x63, 0x49, 0x3C,
+  0x43, 0x57, 0x7A, 0xA0, 0xB8, 0xC3, 0xBA, 0xA4, 0x7D, 0x59, 0x40, 0x36,
+  0x42, 0x53, 0x58, 0x5B, 0x6A, 0x6C, 0x7D, 0x8D, 0x92, 0xAB, 0xAA, 0xB4,
+  0xB8, 0xB8, 0xBB, 0xBB, 0xB4, 0xB0, 0xAC, 0x9E, 0x9F, 0x87, 0x7F, 0x6B,
+  0x45, 0x43, 0x6C, 0x7F, 0x8F, 0xB4, 0xB4, 0x91, 0x7D, 0x77, 0x64, 0x66,
+  0x58, 0x55, 0x53, 0x4F, 0x50, 0x4B, 0x4A, 0x4F, 0x57, 0x57, 0x5F, 0x61,
+  0x6A, 0x74, 0x77, 0x8A, 0x8D, 0x98, 0xA3, 0xA4, 0xB0, 0xB0, 0xB4, 0xB5,
+  0xB5, 0xB8, 0xB7, 0xB2, 0xAD, 0xAB, 0xA2, 0xA2, 0x96, 0x8E, 0x89, 0x78,
+  0x78, 0x62, 0x57, 0x54, 0x48, 0x48, 0x43, 0x42, 0x46, 0x4F, 0x50, 0x5F,
+  0x64, 0x6E, 0x85, 0x86, 0x9E, 0xA5, 0xA9, 0xB2, 0xB1, 0xB5, 0xB5, 0xB3,
+  0xAB, 0xAB, 0x9B, 0x9C, 0x89, 0x7B, 0x6F, 0x49, 0x39, 0x5C, 0x79, 0x81,
+  0xA6, 0xB2, 0x93, 0x7A, 0x76, 0x62, 0x61, 0x58, 0x50, 0x51, 0x4A, 0x4D,
+  0x48, 0x47, 0x49, 0x52, 0x53, 0x5A, 0x5D, 0x62, 0x6F, 0x70, 0x81, 0x89,
+  0x90, 0x9D, 0x9B, 0xA6, 0xAA, 0xAB, 0xAF, 0xAD, 0xB1, 0xB2, 0xAE, 0xA8,
+  0xA7, 0xA0, 0x9E, 0x97, 0x8C, 0x8A, 0x78, 0x77, 0x69, 0x58, 0x58, 0x4B,
+  0x4A, 0x47, 0x44, 0x46, 0x4F, 0x52, 0x5C, 0x66, 0x6B, 0x83, 0x85, 0x97,
+  0xA4, 0xA5, 0xB0, 0xAE, 0xB3, 0xB2, 0xB2, 0xA9, 0xAA, 0x9D, 0x99, 0x8E,
+  0x7B, 0x77, 0x56, 0x3D, 0x52, 0x75, 0x7E, 0x9D, 0xB2, 0x9C, 0x7D, 0x79,
+  0x69, 0x61, 0x5C, 0x51, 0x54, 0x4D, 0x4F, 0x4B, 0x49, 0x4A, 0x52, 0x55,
+  0x59, 0x5F, 0x61, 0x6F, 0x71, 0x7D, 0x8B, 0x8C, 0x9C, 0x9E, 0xA5, 0xAD,
+  0xAC, 0xB1, 0xB0, 0xB3, 0xB5, 0xB2, 0xAB, 0xA9, 0xA4, 0xA0, 0x9C, 0x8E,
+  0x8F, 0x80, 0x79, 0x72, 0x5C, 0x5B, 0x4F, 0x4C, 0x4A, 0x46, 0x47, 0x4E,
+  0x53, 0x59, 0x66, 0x68, 0x7F, 0x86, 0x90, 0xA4, 0xA4, 0xAF, 0xAF, 0xB2,
+  0xB3, 0xB3, 0xAB, 0xAA, 0xA2, 0x98, 0x94, 0x7D, 0x79, 0x5F, 0x3E, 0x46,
+  0x6D, 0x79, 0x8F, 0xAC, 0xA1, 0x81, 0x77, 0x6D, 0x60, 0x60, 0x52, 0x54,
+  0x4F, 0x50, 0x4E, 0x4B, 0x4B, 0x51, 0x56, 0x58, 0x5F, 0x5F, 0x6C, 0x71,
+  0x79, 0x88, 0x89, 0x97, 0x9D, 0xA1, 0xAC, 0xAB, 0xB0, 0xAF, 0xB1, 0xB4,
+  0xB2, 0xAD, 0xA9, 0xA5, 0x9F, 0x9E, 0x90, 0x8E, 0x85, 0x79, 0x78, 0x62,
+  0x5D, 0x56, 0x4E, 0x4F, 0x49, 0x49, 0x4E, 0x54, 0x57, 0x66, 0x67, 0x78,
+  0x87, 0x8A, 0xA0, 0xA2, 0xAA, 0xAD, 0xAD, 0xB1, 0xB0, 0xAB, 0xA7, 0xA4,
+  0x97, 0x97, 0x82, 0x7A, 0x6C, 0x48, 0x45, 0x69, 0x7A, 0x89, 0xAA, 0xAA,
+  0x8B, 0x7A, 0x73, 0x63, 0x64, 0x58, 0x56, 0x54, 0x51, 0x51, 0x4D, 0x4D,
+  0x52, 0x58, 0x59, 0x61, 0x62, 0x6B, 0x74, 0x76, 0x88, 0x8B, 0x94, 0x9E,
+  0x9F, 0xAB, 0xAB, 0xAF, 0xB1, 0xB0, 0xB3, 0xB3, 0xAE, 0xA9, 0xA7, 0xA0,
+  0x9F, 0x95, 0x8E, 0x89, 0x7B, 0x79, 0x66, 0x5C, 0x59, 0x4D, 0x4D, 0x49,
+  0x47, 0x4C, 0x53, 0x54, 0x61, 0x66, 0x6F, 0x82, 0x83, 0x97, 0x9D, 0xA1,
+  0xA8, 0xA7, 0xAB, 0xAB, 0xA9, 0xA2, 0xA2, 0x95, 0x96, 0x86, 0x7B, 0x71,
+  0x51, 0x44, 0x60, 0x79, 0x81, 0x9F, 0xAB, 0x94, 0x7D, 0x79, 0x68, 0x67,
+  0x5F, 0x58, 0x5A, 0x55, 0x56, 0x52, 0x51, 0x53, 0x5B, 0x5C, 0x62, 0x64,
+  0x69, 0x74, 0x75, 0x84, 0x8B, 0x90, 0x9C, 0x9C, 0xA6, 0xA9, 0xA9, 0xAD,
+  0xAC, 0xAF, 0xB0, 0xAC, 0xA7, 0xA6, 0x9F, 0x9D, 0x96, 0x8C, 0x8B, 0x7C,
+  0x7A, 0x6E, 0x5F, 0x5E, 0x52, 0x52, 0x4F, 0x4C, 0x4E, 0x56, 0x57, 0x60,
+  0x69, 0x6D, 0x82, 0x85, 0x94, 0xA1, 0xA1, 0xAB, 0xAA, 0xAD, 0xAD, 0xAC,
+  0xA5, 0xA6, 0x9B, 0x98, 0x90, 0x7E, 0x79, 0x5D, 0x46, 0x58, 0x78, 0x7F,
+  0x99, 0xAE, 0x9B, 0x80, 0x7B, 0x6D, 0x66, 0x64, 0x59, 0x5B, 0x55, 0x57,
+  0x53, 0x51, 0x52, 0x59, 0x5C, 0x5F, 0x64, 0x67, 0x72, 0x74, 0x7E, 0x89,
+  0x8C, 0x98, 0x98, 0x9E, 0xA4, 0xA4, 0xA8, 0xA7, 0xAA, 0xAB, 0xA9, 0xA4,
+  0xA1, 0x9D, 0x9A, 0x97, 0x8B, 0x8A, 0x7F, 0x79, 0x73, 0x61, 0x60, 0x58,
+  0x54, 0x52, 0x4F, 0x50, 0x55, 0x59, 0x5E, 0x6A, 0x6C, 0x7F, 0x86, 0x8F,
+  0xA0, 0x9F, 0xA8, 0xA8, 0xAB, 0xAC, 0xAC, 0xA5, 0xA4, 0x9E, 0x96, 0x93,
+  0x7F, 0x7C, 0x67, 0x4C, 0x52, 0x72, 0x7D, 0x91, 0xAA, 0xA1, 0x84, 0x7C,
+  0x73, 0x68, 0x67, 0x5C, 0x5C, 0x59, 0x58, 0x57, 0x54, 0x54, 0x59, 0x5D,
+  0x5F, 0x65, 0x66, 0x70, 0x75, 0x7A, 0x89, 0x89, 0x96, 0x9A, 0x9D, 0xA7,
+  0xA5, 0xA9, 0xA9, 0xAB, 0xAD, 0xAC, 0xA7, 0xA3, 0xA1, 0x9C, 0x9A, 0x8F,
+  0x8D, 0x84, 0x7A, 0x79, 0x67, 0x62, 0x5C, 0x55, 0x55, 0x51, 0x51, 0x56,
+  0x5B, 0x5D, 0x6A, 0x6B, 0x7A, 0x86, 0x89, 0x9D, 0x9F, 0xA6, 0xA9, 0xA9,
+  0xAC, 0xAB, 0xA7, 0xA3, 0xA0, 0x96, 0x95, 0x83, 0x7D, 0x6F, 0x51, 0x4B,
+  0x69, 0x7A, 0x85, 0x9F, 0xA0, 0x87, 0x78, 0x74, 0x66, 0x67, 0x5D, 0x5C,
+  0x5A, 0x58, 0x58, 0x54, 0x54, 0x57, 0x5D, 0x5E, 0x65, 0x65, 0x6C, 0x73,
+  0x77, 0x85, 0x87, 0x8F, 0x98, 0x97, 0xA1, 0xA2, 0xA5, 0xA7, 0xA7, 0xAA,
+  0xAA, 0xA6, 0xA2, 0xA1, 0x9B, 0x9A, 0x91, 0x8B, 0x89, 0x7C, 0x7B, 0x6B,
+  0x64, 0x61, 0x58, 0x59, 0x55, 0x54, 0x57, 0x5D, 0x5E, 0x68, 0x6C, 0x74,
+  0x85, 0x86, 0x96, 0x9C, 0xA0, 0xA6, 0xA5, 0xA8, 0xA8, 0xA6, 0xA0, 0xA0,
+  0x94, 0x94, 0x88, 0x7C, 0x75, 0x5A, 0x4C, 0x65, 0x7A, 0x81, 0x9C, 0xA6,
+  0x91, 0x7D, 0x79, 0x6A, 0x6A, 0x62, 0x5D, 0x5D, 0x59, 0x5B, 0x58, 0x56,
+  0x58, 0x5F, 0x60, 0x65, 0x67, 0x6C, 0x76, 0x77, 0x84, 0x8A, 0x8D, 0x99,
+  0x99, 0xA1, 0xA5, 0xA5, 0xA8, 0xA7, 0xAA, 0xAA, 0xA7, 0xA3, 0xA1, 0x9C,
+  0x9B, 0x95, 0x8C, 0x8B, 0x7E, 0x7B, 0x71, 0x64, 0x63, 0x5A, 0x58, 0x56,
+  0x53, 0x54, 0x5B, 0x5C, 0x63, 0x6B, 0x6E, 0x7F, 0x82, 0x8E, 0x98, 0x98,
+  0xA1, 0xA0, 0xA3, 0xA3, 0xA2, 0x9C, 0x9D, 0x94, 0x91, 0x8A, 0x7C, 0x78,
+  0x61, 0x4F, 0x5E, 0x77, 0x7D, 0x92, 0xA3, 0x96, 0x7F, 0x7B, 0x70, 0x6B,
+  0x69, 0x60, 0x62, 0x5E, 0x5F, 0x5C, 0x5A, 0x5B, 0x61, 0x63, 0x65, 0x6A,
+  0x6C, 0x75, 0x77, 0x7F, 0x89, 0x8A, 0x95, 0x97, 0x9C, 0xA2, 0xA1, 0xA5,
+  0xA4, 0xA6, 0xA8, 0xA5, 0xA1, 0xA0, 0x9C, 0x98, 0x96, 0x8C, 0x8A, 0x80,
+  0x7A, 0x76, 0x66, 0x66, 0x5E, 0x5A, 0x59, 0x56, 0x57, 0x5C, 0x5E, 0x63,
+  0x6C, 0x6E, 0x7E, 0x84, 0x8C, 0x9A, 0x9A, 0xA1, 0xA2, 0xA4, 0xA5, 0xA5,
+  0x9F, 0x9E, 0x99, 0x92, 0x91, 0x80, 0x7D, 0x6B, 0x53, 0x59, 0x74, 0x7D,
+  0x8C, 0xA3, 0x9C, 0x84, 0x7D, 0x75, 0x6B, 0x6B, 0x61, 0x61, 0x5E, 0x5E,
+  0x5D, 0x5A, 0x5B, 0x5E, 0x62, 0x65, 0x69, 0x6A, 0x72, 0x77, 0x7B, 0x88,
+  0x89, 0x92, 0x93, 0x90, 0x97, 0x95, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x97,
+  0x95, 0x93, 0x90, 0x8F, 0x87, 0x86, 0x81, 0x79, 0x78, 0x6C, 0x69, 0x65,
+  0x5F, 0x5F, 0x5D, 0x5D, 0x60, 0x64, 0x66, 0x6E, 0x6F, 0x79, 0x82, 0x85,
+  0x93, 0x95, 0x9A, 0x9C, 0x9C, 0x9E, 0x9F, 0x9B, 0x98, 0x97, 0x90, 0x8F,
+  0x82, 0x7E, 0x75, 0x60, 0x5C, 0x71, 0x7D, 0x86, 0x9A, 0x9A, 0x88, 0x7E,
+  0x7B, 0x70, 0x70, 0x69, 0x68, 0x66, 0x64, 0x65, 0x62, 0x61, 0x63, 0x67,
+  0x68, 0x6D, 0x6D, 0x73, 0x78, 0x7A, 0x83, 0x87, 0x8C, 0x93, 0x93, 0x99,
+  0x9A, 0x9B, 0x9D, 0x9D, 0x9F, 0x9E, 0x9C, 0x99, 0x98, 0x93, 0x93, 0x8D,
+  0x88, 0x86, 0x7D, 0x7D, 0x72, 0x6B, 0x69, 0x63, 0x63, 0x61, 0x60, 0x61,
+  0x66, 0x67, 0x6F, 0x72, 0x78, 0x84, 0x85, 0x91, 0x96, 0x98, 0x9D, 0x9C,
+  0x9F, 0x9E, 0x9D, 0x98, 0x97, 0x8E, 0x8F, 0x86, 0x7E, 0x7B, 0x68, 0x60,
+  0x6D, 0x7E, 0x84, 0xBC, 0xE3, 0xF5, 0xF1, 0xD4, 0xCA, 0xBA, 0x98, 0x72,
+  0x60, 0x4E, 0x41, 0x46, 0x55, 0x65, 0x7D, 0x91, 0x9A, 0x9B, 0x97, 0x8A,
+  0x7A, 0x62, 0x49, 0x3D, 0x3A, 0x43, 0x51, 0x72, 0x98, 0xAB, 0xB9, 0xCA,
+  0xC7, 0xB9, 0xB0, 0x9F, 0x89, 0x7D, 0x7F, 0x85, 0x8F, 0xA4, 0xBF, 0xD1,
+  0xDB, 0xE4, 0xE0, 0xD6, 0xC1, 0xA1, 0x8A, 0x7A, 0x6E, 0x6E, 0x7A, 0x84,
+  0x92, 0xA6, 0xB0, 0xAC, 0xA5, 0x9E, 0x82, 0x56, 0x3D, 0x2C, 0x19, 0x18,
+  0x28, 0x39, 0x51, 0x6A, 0x7A, 0x86, 0x88, 0x7F, 0x75, 0x67, 0x51, 0x44,
+  0x4B, 0x56, 0x5D, 0x76, 0xA2, 0xBF, 0xCE, 0xDE, 0xE1, 0xD5, 0xC2, 0xAA,
+  0x8E, 0x7F, 0x70, 0x6D, 0x76, 0x83, 0x90, 0xA5, 0xB3, 0xAF, 0xA2, 0x9D,
+  0x85, 0x4A, 0x2A, 0x1B, 0x2D, 0x49, 0x4F, 0x67, 0x99, 0xB6, 0xC5, 0xBC,
+  0xA4, 0x9E, 0x8B, 0x6B, 0x4D, 0x41, 0x31, 0x28, 0x30, 0x3D, 0x4F, 0x67,
+  0x7A, 0x81, 0x81, 0x7B, 0x6E, 0x5E, 0x47, 0x35, 0x2C, 0x2C, 0x34, 0x42,
+  0x65, 0x87, 0x99, 0xAC, 0xBA, 0xB3, 0xA6, 0x9A, 0x86, 0x71, 0x69, 0x6C,
+  0x73, 0x81, 0x9C, 0xBB, 0xCF, 0xDC, 0xE3, 0xDC, 0xCD, 0xB1, 0x8F, 0x78,
+  0x68, 0x5F, 0x65, 0x72, 0x7E, 0x90, 0xA5, 0xAC, 0xA7, 0x9F, 0x95, 0x72,
+  0x49, 0x35, 0x25, 0x15, 0x1A, 0x2A, 0x3C, 0x57, 0x6E, 0x7D, 0x88, 0x87,
+  0x7C, 0x72, 0x60, 0x4C, 0x42, 0x4C, 0x55, 0x5E, 0x7E, 0xA9, 0xC2, 0xD1,
+  0xDF, 0xDE, 0xCE, 0xBB, 0xA0, 0x87, 0x78, 0x6A, 0x6B, 0x76, 0x83, 0x93,
+  0xAB, 0xB4, 0xAD, 0xA0, 0x9C, 0x77, 0x41, 0x26, 0x1D, 0x36, 0x4A, 0x51,
+  0x71, 0xA2, 0xBB, 0xC7, 0xB6, 0xA4, 0x9E, 0x86, 0x64, 0x4B, 0x3F, 0x2E,
+  0x2A, 0x33, 0x42, 0x58, 0x71, 0x81, 0x87, 0x84, 0x7C, 0x6F, 0x5C, 0x44,
+  0x35, 0x2E, 0x30, 0x39, 0x4E, 0x73, 0x92, 0xA3, 0xB5, 0xBF, 0xB4, 0xA9,
+  0x9B, 0x85, 0x71, 0x6B, 0x6F, 0x77, 0x88, 0xA5, 0xC2, 0xD1, 0xDE, 0xE1,
+  0xD8, 0xC8, 0xA9, 0x88, 0x74, 0x66, 0x5F, 0x68, 0x75, 0x82, 0x97, 0xA9,
+  0xAE, 0xA8, 0xA0, 0x91, 0x6A, 0x45, 0x32, 0x20, 0x16, 0x1F, 0x30, 0x45,
+  0x61, 0x76, 0x85, 0x8E, 0x89, 0x7E, 0x72, 0x5F, 0x4B, 0x46, 0x50, 0x59,
+  0x66, 0x8B, 0xB3, 0xC7, 0xD7, 0xE2, 0xDC, 0xCB, 0xB7, 0x9B, 0x83, 0x75,
+  0x6A, 0x6F, 0x7B, 0x89, 0x9C, 0xB1, 0xB6, 0xAD, 0xA3, 0x9B, 0x6D, 0x3E,
+  0x27, 0x22, 0x3D, 0x4D, 0x57, 0x7F, 0xAB, 0xC1, 0xC8, 0xB2, 0xA6, 0x9D,
+  0x80, 0x5D, 0x49, 0x3C, 0x2C, 0x2C, 0x39, 0x49, 0x60, 0x7A, 0x86, 0x8A,
+  0x86, 0x7D, 0x6E, 0x58, 0x41, 0x34, 0x2F, 0x34, 0x3F, 0x57, 0x7E, 0x9A,
+  0xA9, 0xBC, 0xBF, 0xB2, 0xA7, 0x97, 0x7F, 0x70, 0x6E, 0x73, 0x7D, 0x90,
+  0xAF, 0xC8, 0xD6, 0xE1, 0xE1, 0xD6, 0xC3, 0xA3, 0x86, 0x74, 0x66, 0x64,
+  0x6E, 0x7C, 0x89, 0x9E, 0xAD, 0xAE, 0xA8, 0xA0, 0x8C, 0x61, 0x40, 0x2F,
+  0x1D, 0x18, 0x24, 0x36, 0x4D, 0x6A, 0x7E, 0x8A, 0x90, 0x88, 0x7D, 0x6F,
+  0x59, 0x46, 0x45, 0x4F, 0x57, 0x6A, 0x93, 0xB6, 0xC8, 0xD8, 0xDF, 0xD6,
+  0xC4, 0xAE, 0x90, 0x7C, 0x6D, 0x66, 0x6E, 0x7D, 0x8C, 0xA2, 0xB5, 0xB7,
+  0xAE, 0xA5, 0x98, 0x65, 0x3B, 0x27, 0x2A, 0x43, 0x4E, 0x5F, 0x8C, 0xB1,
+  0xC5, 0xC5, 0xB1, 0xA9, 0x9A, 0x7B, 0x59, 0x48, 0x38, 0x2C, 0x30, 0x3E,
+  0x51, 0x6B, 0x82, 0x8D, 0x8F, 0x8A, 0x7D, 0x6C, 0x55, 0x3E, 0x33, 0x2E,
+  0x35, 0x43, 0x61, 0x87, 0x9E, 0xAF, 0xC0, 0xBD, 0xAF, 0xA4, 0x90, 0x78,
+  0x6B, 0x6A, 0x71, 0x7D, 0x94, 0xB3, 0xCB, 0xD8, 0xE1, 0xDD, 0xD1, 0xBA,
+  0x98, 0x7F, 0x6E, 0x62, 0x63, 0x70, 0x7D, 0x8F, 0xA6, 0xB1, 0xB0, 0xA9,
+  0xA1, 0x85, 0x59, 0x3C, 0x29, 0x16, 0x15, 0x27, 0x3A, 0x56, 0x72, 0x85,
+  0x94, 0x95, 0x8A, 0x7F, 0x83, 0x84, 0x83, 0x92, 0x9A, 0x99, 0x9F, 0xAE,
+  0xB1, 0xAE, 0xB4, 0xB8, 0xB5, 0xB5, 0xB8, 0xB6, 0xB5, 0xAF, 0xAC, 0xAB,
+  0xA8, 0x9E, 0x9B, 0x9A, 0x8D, 0x7E, 0x81, 0x78, 0x57, 0x51, 0x51, 0x69,
+  0x82, 0x80, 0x89, 0xA5, 0xAB, 0xAB, 0x99, 0x7F, 0x81, 0x7B, 0x70, 0x6A,
+  0x6C, 0x65, 0x5E, 0x5F, 0x5F, 0x5B, 0x5B, 0x5C, 0x5A, 0x57, 0x58, 0x59,
+  0x5F, 0x62, 0x62, 0x66, 0x69, 0x6B, 0x6C, 0x76, 0x7B, 0x7A, 0x81, 0x8D,
+  0x8E, 0x8E, 0x97, 0x9D, 0x9B, 0x9F, 0xA7, 0xA6, 0xA5, 0xA8, 0xA9, 0xA7,
+  0xA7, 0xA9, 0xA9, 0xA7, 0xA3, 0x9F, 0x9E, 0x9C, 0x96, 0x95, 0x94, 0x8C,
+  0x85, 0x85, 0x80, 0x75, 0x72, 0x74, 0x67, 0x5A, 0x5C, 0x59, 0x51, 0x4F,
+  0x51, 0x4F, 0x4D, 0x4E, 0x50, 0x57, 0x59, 0x5A, 0x62, 0x6A, 0x6A, 0x6E,
+  0x80, 0x86, 0x84, 0x8F, 0x9D, 0x9C, 0x9D, 0xA4, 0xA6, 0xA4, 0xA6, 0xA8,
+  0xA7, 0xA5, 0xA0, 0x9C, 0x98, 0x95, 0x8C, 0x8C, 0x89, 0x7B, 0x70, 0x75,
+  0x63, 0x4A, 0x48, 0x4A, 0x67, 0x77, 0x74, 0x82, 0x9A, 0x9D, 0x9C, 0x85,
+  0x73, 0x76, 0x6F, 0x65, 0x62, 0x64, 0x5C, 0x58, 0x59, 0x59, 0x56, 0x56,
+  0x58, 0x55, 0x54, 0x54, 0x57, 0x5C, 0x5F, 0x60, 0x64, 0x69, 0x69, 0x6C,
+  0x75, 0x78, 0x78, 0x81, 0x8B, 0x8A, 0x8D, 0x96, 0x99, 0x98, 0x9D, 0xA3,
+  0xA2, 0xA2, 0xA5, 0xA5, 0xA3, 0xA5, 0xA7, 0xA6, 0xA4, 0xA0, 0x9D, 0x9C,
+  0x99, 0x94, 0x94, 0x92, 0x89, 0x84, 0x85, 0x7F, 0x74, 0x74, 0x73, 0x64,
+  0x5D, 0x5F, 0x5A, 0x54, 0x54, 0x54, 0x51, 0x51, 0x51, 0x54, 0x5A, 0x5B,
+  0x5D, 0x66, 0x6C, 0x6B, 0x73, 0x82, 0x85, 0x85, 0x92, 0x9C, 0x9A, 0x9E,
+  0xA3, 0xA4, 0xA2, 0xA5, 0xA6, 0xA5, 0xA3, 0x9F, 0x9D, 0x9B, 0x96, 0x8E,
+  0x90, 0x88, 0x7B, 0x75, 0x79, 0x62, 0x4D, 0x4C, 0x52, 0x71, 0x7C, 0x79,
+  0x8E, 0xA0, 0xA2, 0x9C, 0x80, 0x77, 0x79, 0x6F, 0x67, 0x67, 0x67, 0x5F,
+  0x5C, 0x5D, 0x5B, 0x59, 0x5A, 0x5A, 0x58, 0x57, 0x58, 0x5B, 0x61, 0x61,
+  0x63, 0x67, 0x69, 0x69, 0x6E, 0x76, 0x77, 0x79, 0x84, 0x8A, 0x88, 0x8E,
+  0x97, 0x96, 0x97, 0x9E, 0xA1, 0xA0, 0xA0, 0xA3, 0xA3, 0xA2, 0xA4, 0xA6,
+  0xA5, 0xA2, 0x9E, 0x9D, 0x9B, 0x97, 0x94, 0x94, 0x91, 0x89, 0x86, 0x86,
+  0x7F, 0x77, 0x78, 0x74, 0x66, 0x62, 0x63, 0x5D, 0x58, 0x59, 0x59, 0x56,
+  0x56, 0x57, 0x5B, 0x60, 0x60, 0x63, 0x6C, 0x6F, 0x6F, 0x7A, 0x86, 0x85,
+  0x88, 0x96, 0x9C, 0x99, 0x9E, 0xA1, 0xA2, 0xA1, 0xA3, 0xA3, 0xA3, 0xA0,
+  0x9C, 0x9B, 0x99, 0x91, 0x8D, 0x8F, 0x87, 0x79, 0x76, 0x77, 0x5C, 0x50,
+  0x4F, 0x5D, 0x78, 0x7B, 0x7E, 0x95, 0xA1, 0xA1, 0x96, 0x7D, 0x7B, 0x79,
+  0x71, 0x69, 0x6B, 0x68, 0x60, 0x60, 0x60, 0x5F, 0x5D, 0x5E, 0x5D, 0x5B,
+  0x5B, 0x5C, 0x60, 0x65, 0x68, 0x6B, 0x6E, 0x70, 0x70, 0x75, 0x7B, 0x7A,
+  0x7D, 0x86, 0x88, 0x87, 0x8D, 0x92, 0x92, 0x93, 0x98, 0x9A, 0x99, 0x9A,
+  0x9C, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x99, 0x96, 0x96, 0x94, 0x91, 0x8F,
+  0x8F, 0x8B, 0x85, 0x85, 0x83, 0x7C, 0x78, 0x7A, 0x73, 0x69, 0x69, 0x69,
+  0x65, 0x61, 0x62, 0x62, 0x60, 0x60, 0x61, 0x64, 0x68, 0x68, 0x6C, 0x73,
+  0x74, 0x75, 0x7F, 0x87, 0x86, 0x8A, 0x95, 0x97, 0x96, 0x9A, 0x9D, 0x9C,
+  0x9C, 0x9E, 0x9D, 0x9D, 0x9A, 0x97, 0x96, 0x95, 0x8E, 0x8C, 0x8B, 0x83,
+  0x79, 0x7B, 0x75, 0x5F, 0x5A, 0x5A, 0x6A, 0x7C, 0x7B, 0x81, 0x94, 0x9A,
+  0x9A, 0x8D, 0x7B, 0x7C, 0x79, 0x71, 0x6D, 0x6E, 0x6A, 0x66, 0x65, 0x66,
+  0x64, 0x64, 0x65, 0x64, 0x62, 0x62, 0x65, 0x68, 0x6B, 0x6B, 0x6D, 0x70,
+  0x71, 0x72, 0x79, 0x7C, 0x7C, 0x81, 0x88, 0x8A, 0x8B, 0x92, 0x95, 0x94,
+  0x96, 0x9C, 0x9B, 0x9D, 0x87, 0x53, 0x3D, 0x56, 0x93, 0xBD, 0xBE, 0x90,
+  0x55, 0x3F, 0x54, 0x8A, 0xB3, 0xB4, 0x86, 0x4E, 0x3A, 0x4C, 0x7A, 0xA0,
+  0xA2, 0x77, 0x3B, 0x26, 0x39, 0x68, 0x90, 0x93, 0x6C, 0x36, 0x21, 0x36,
+  0x6E, 0x98, 0x99, 0x7A, 0x4A, 0x34, 0x49, 0x86, 0xB4, 0xB5, 0x97, 0x69,
+  0x52, 0x67, 0x9F, 0xCC, 0xCF, 0xA8, 0x72, 0x5A, 0x6C, 0x9C, 0xC6, 0xC9,
+  0xA2, 0x67, 0x4C, 0x5D, 0x8A, 0xAF, 0xB5, 0x86, 0x40, 0x22, 0x36, 0x7D,
+  0xB4, 0xB7, 0x9A, 0x72, 0x5A, 0x6B, 0x91, 0xB2, 0xB9, 0x8F, 0x53, 0x36,
+  0x48, 0x77, 0xA2, 0xA9, 0x82, 0x46, 0x29, 0x3D, 0x72, 0x9E, 0xA4, 0x81,
+  0x4C, 0x30, 0x43, 0x7A, 0xA8, 0xB0, 0x8E, 0x5C, 0x42, 0x52, 0x8B, 0xBD,
+  0xC3, 0xA3, 0x72, 0x58, 0x66, 0x9D, 0xCC, 0xD2, 0xB1, 0x7D, 0x61, 0x6E,
+  0xA2, 0xCE, 0xD5, 0xB3, 0x7A, 0x5C, 0x69, 0x9A, 0xC3, 0xCA, 0xA8, 0x6D,
+  0x4D, 0x5B, 0x8A, 0xB0, 0xB7, 0x96, 0x56, 0x32, 0x41, 0x73, 0x9E, 0xA7,
+  0x87, 0x4C, 0x2A, 0x38, 0x6E, 0xA0, 0xAA, 0x8A, 0x57, 0x3A, 0x47, 0x7E,
+  0xB4, 0xC1, 0xA0, 0x70, 0x54, 0x5F, 0x94, 0xC7, 0xD4, 0xB1, 0x7A, 0x5A,
+  0x65, 0x95, 0xC2, 0xCC, 0xAD, 0x73, 0x4D, 0x59, 0x88, 0xB1, 0xB9, 0x9C,
+  0x58, 0x2B, 0x35, 0x6D, 0xAD, 0xBF, 0x9E, 0x71, 0x59, 0x62, 0x93, 0xB6,
+  0xBE, 0xA0, 0x62, 0x3B, 0x43, 0x75, 0xA3, 0xB0, 0x91, 0x56, 0x30, 0x39,
+  0x6E, 0x9E, 0xAB, 0x8E, 0x56, 0x35, 0x3E, 0x72, 0xA5, 0xB5, 0x98, 0x61,
+  0x42, 0x4A, 0x7D, 0xB3, 0xC6, 0xA9, 0x73, 0x54, 0x5C, 0x8D, 0xC1, 0xD2,
+  0xB6, 0x7E, 0x5B, 0x61, 0x91, 0xC4, 0xD3, 0xB8, 0x7F, 0x59, 0x5D, 0x8B,
+  0xBC, 0xCA, 0xB0, 0x76, 0x4C, 0x50, 0x80, 0xAE, 0xBA, 0xA1, 0x67, 0x37,
+  0x3A, 0x6C, 0x9C, 0xA9, 0x90, 0x57, 0x2E, 0x32, 0x64, 0x9A, 0xAD, 0x94,
+  0x5E, 0x3B, 0x42, 0x71, 0xAB, 0xC3, 0xA9, 0x73, 0x51, 0x58, 0x85, 0xBC,
+  0xD2, 0xB8, 0x7F, 0x58, 0x5B, 0x88, 0xBA, 0xCB, 0xB3, 0x7B, 0x4D, 0x4E,
+  0x7D, 0xAE, 0xBB, 0xA3, 0x6B, 0x34, 0x30, 0x5D, 0x9A, 0xBB, 0xA5, 0x6E,
+  0x4F, 0x57, 0x84, 0xB6, 0xBE, 0xA5, 0x6D, 0x3F, 0x3D, 0x6A, 0x9F, 0xB2,
+  0x9A, 0x62, 0x35, 0x35, 0x65, 0x9B, 0xAF, 0x99, 0x61, 0x37, 0x3A, 0x67,
+  0x9F, 0xB6, 0xA2, 0x6A, 0x41, 0x45, 0x71, 0xA9, 0xC4, 0xB1, 0x79, 0x51,
+  0x54, 0x7F, 0xB5, 0xCF, 0xBC, 0x84, 0x59, 0x59, 0x84, 0xBA, 0xD1, 0xBD,
+  0x85, 0x59, 0x55, 0x7F, 0xB5, 0xC9, 0xB5, 0x7E, 0x50, 0x4A, 0x73, 0xAA,
+  0xBC, 0xA7, 0x72, 0x40, 0x37, 0x61, 0x99, 0xAD, 0x99, 0x64, 0x33, 0x2F,
+  0x5A, 0x93, 0xAD, 0x9D, 0x68, 0x3B, 0x3D, 0x66, 0x9F, 0xBE, 0xB1, 0x7B,
+  0x4F, 0x52, 0x7B, 0xB3, 0xD0, 0xC0, 0x89, 0x5B, 0x58, 0x7E, 0xB6, 0xCE,
+  0xBB, 0x86, 0x55, 0x4D, 0x71, 0xA6, 0xBE, 0xAA, 0x75, 0x42, 0x32, 0x57,
+  0x91, 0xB5, 0xAC, 0x77, 0x47, 0x47, 0x71, 0xAB, 0xC3, 0xAC, 0x76, 0x44,
+  0x39, 0x5E, 0x98, 0xB4, 0xA3, 0x6E, 0x3D, 0x34, 0x5A, 0x94, 0xB1, 0xA2,
+  0x6D, 0x3B, 0x35, 0x5C, 0x96, 0xB5, 0xA9, 0x74, 0x43, 0x3C, 0x63, 0x9D,
+  0xBD, 0xB4, 0x80, 0x4F, 0x48, 0x70, 0xA9, 0xC8, 0xBE, 0x8A, 0x58, 0x4E,
+  0x73, 0xAC, 0xCB, 0xC0, 0x8B, 0x59, 0x4D, 0x6F, 0xA9, 0xC7, 0xBB, 0x86,
+  0x53, 0x46, 0x67, 0xA1, 0xC0, 0xB1, 0x7D, 0x4A, 0x3A, 0x5A, 0x95, 0xB3,
+  0xA6, 0x73, 0x3F, 0x31, 0x55, 0x8F, 0xB0, 0xA8, 0x76, 0x42, 0x37, 0x5C,
+  0x97, 0xB9, 0xB4, 0x83, 0x50, 0x45, 0x6B, 0xA5, 0xC7, 0xC0, 0x8E, 0x59,
+  0x4C, 0x6E, 0xA7, 0xCA, 0xC0, 0x8C, 0x56, 0x47, 0x66, 0xA0, 0xC2, 0xB5,
+  0x81, 0x4E, 0x3A, 0x54, 0x8C, 0xAC, 0xAC, 0x83, 0x50, 0x46, 0x6C, 0xA3,
+  0xC2, 0xB5, 0x83, 0x52, 0x41, 0x41, 0x40, 0x43, 0x42, 0x43, 0x45, 0x47,
+  0x48, 0x49, 0x4A, 0x4B, 0x4B, 0x4C, 0x4D, 0x50, 0x51, 0x50, 0x52, 0x53,
+  0x54, 0x56, 0x59, 0x5C, 0x5D, 0x60, 0x63, 0x65, 0x66, 0x69, 0x6C, 0x6D,
+  0x6F, 0x71, 0x72, 0x73, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x79, 0x7A,
+  0x79, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x79, 0x78,
+  0x79, 0x76, 0x74, 0x75, 0x75, 0x73, 0x74, 0x75, 0x74, 0x74, 0x75, 0x76,
+  0x77, 0x78, 0x79, 0x7B, 0x7D, 0x7D, 0x80, 0x83, 0x84, 0x85, 0x88, 0x8B,
+  0x8A, 0x8C, 0x8D, 0x8E, 0x8D, 0x8D, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C,
+  0x8B, 0x8A, 0x8A, 0x89, 0x85, 0x84, 0x85, 0x80, 0x7B, 0x7A, 0x7C, 0x84,
+  0x87, 0x86, 0x8B, 0x8F, 0x90, 0x8F, 0x89, 0x87, 0x86, 0x85, 0x83, 0x83,
+  0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
+  0x83, 0x82, 0x83, 0x84, 0x85, 0x84, 0x86, 0x87, 0x86, 0x87, 0x88, 0x8A,
+  0x89, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8D, 0x8C, 0x8B, 0x8C, 0x8B, 0x8C,
+  0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x8A, 0x8B, 0x8A, 0x89, 0x8A, 0x89, 0x89,
+  0x88, 0x87, 0x87, 0x86, 0x87, 0x86, 0x84, 0x83, 0x84, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x86, 0x87, 0x87, 0x88,
+  0x8A, 0x89, 0x8A, 0x8B, 0x8D, 0x8C, 0x8D, 0x8C, 0x8D, 0x8C, 0x8D, 0x8D,
+  0x8C, 0x8D, 0x8C, 0x8B, 0x8C, 0x8A, 0x89, 0x8A, 0x89, 0x87, 0x86, 0x87,
+  0x83, 0x81, 0x81, 0x83, 0x86, 0x87, 0x87, 0x89, 0x8B, 0x8B, 0x8A, 0x86,
+  0x85, 0x86, 0x84, 0x83, 0x83, 0x83, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
+  0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x82, 0x83, 0x83, 0x82, 0x83,
+  0x85, 0x84, 0x85, 0x87, 0x88, 0x87, 0x88, 0x89, 0x88, 0x89, 0x89, 0x8A,
+  0x89, 0x89, 0x8A, 0x8A, 0x89, 0x85, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x82,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x84, 0x83, 0x83,
+  0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x84, 0x83,
+  0x84, 0x83, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80,
+  0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x80, 0x80, 0x80, 0x81, 0x7F, 0x96, 0xB9, 0xD7, 0xED, 0xEF, 0xE2, 0xC2,
+  0xA1, 0x8C, 0x8B, 0x9A, 0xB6, 0xCF, 0xD8, 0xD2, 0xBB, 0x9B, 0x82, 0x7A,
+  0x83, 0x9E, 0xBE, 0xD2, 0xD2, 0xBF, 0x9D, 0x7C, 0x6D, 0x70, 0x89, 0xAD,
+  0xC9, 0xD1, 0xC4, 0xA4, 0x7D, 0x64, 0x60, 0x72, 0x97, 0xBB, 0xCB, 0xC7,
+  0xAB, 0x81, 0x60, 0x54, 0x5F, 0x80, 0xA9, 0xC2, 0xC4, 0xB0, 0x89, 0x63,
+  0x4E, 0x50, 0x6B, 0x95, 0xB6, 0xC0, 0xB6, 0x94, 0x69, 0x4B, 0x47, 0x59,
+  0x80, 0xA8, 0xBA, 0xB7, 0x9D, 0x72, 0x4E, 0x41, 0x4B, 0x6B, 0x95, 0xB0,
+  0xB5, 0xA5, 0x7F, 0x56, 0x40, 0x41, 0x5A, 0x83, 0xA6, 0xB3, 0xAA, 0x8A,
+  0x5F, 0x41, 0x3B, 0x4C, 0x72, 0x99, 0xAE, 0xAD, 0x97, 0x6D, 0x48, 0x38,
+  0x40, 0x5F, 0x8A, 0xA8, 0xAE, 0xA0, 0x7B, 0x52, 0x39, 0x39, 0x51, 0x7A,
+  0x9F, 0xAD, 0xA7, 0x8A, 0x60, 0x40, 0x36, 0x46, 0x6A, 0x93, 0xAA, 0xAA,
+  0x97, 0x6F, 0x49, 0x37, 0x3D, 0x5A, 0x84, 0xA4, 0xAC, 0xA0, 0x7D, 0x53,
+  0x39, 0x35, 0x4B, 0x74, 0x9A, 0xAB, 0xA8, 0x8D, 0x63, 0x40, 0x34, 0x41,
+  0x64, 0x8F, 0xA7, 0xAA, 0x98, 0x70, 0x48, 0x34, 0x38, 0x54, 0x7E, 0x9F,
+  0xAB, 0xA1, 0x82, 0x57, 0x3A, 0x34, 0x48, 0x70, 0x97, 0xAA, 0xA8, 0x90,
+  0x66, 0x43, 0x35, 0x3F, 0x62, 0x8C, 0xA8, 0xAD, 0x9E, 0x78, 0x50, 0x38,
+  0x3A, 0x55, 0x7F, 0xA3, 0xB0, 0xA8, 0x89, 0x5E, 0x3F, 0x38, 0x4A, 0x70,
+  0x99, 0xAF, 0xAD, 0x97, 0x6E, 0x49, 0x39, 0x40, 0x60, 0x8C, 0xA9, 0xB0,
+  0xA3, 0x7F, 0x54, 0x3C, 0x3C, 0x53, 0x7E, 0xA2, 0xB1, 0xAB, 0x8E, 0x62,
+  0x42, 0x38, 0x47, 0x6C, 0x97, 0xAE, 0xB0, 0x9B, 0x73, 0x4C, 0x39, 0x3F,
+  0x5E, 0x89, 0xA9, 0xB2, 0xA6, 0x82, 0x58, 0x3E, 0x3B, 0x52, 0x7A, 0xA0,
+  0xB2, 0xAE, 0x93, 0x69, 0x46, 0x3B, 0x47, 0x6B, 0x96, 0xAF, 0xB3, 0xA1,
+  0x7A, 0x51, 0x3D, 0x41, 0x5D, 0x88, 0xA9, 0xB4, 0xAB, 0x8A, 0x5E, 0x41,
+  0x3B, 0x4E, 0x77, 0xA0, 0xB3, 0xB2, 0x99, 0x6D, 0x49, 0x3A, 0x45, 0x68,
+  0x94, 0xAF, 0xB4, 0xA3, 0x7C, 0x53, 0x3C, 0x3D, 0x57, 0x82, 0xA6, 0xB4,
+  0xAC, 0x8D, 0x61, 0x43, 0x3B, 0x4C, 0x73, 0x9D, 0xB3, 0xB3, 0x9B, 0x71,
+  0x4B, 0x3B, 0x45, 0x63, 0x8F, 0xAE, 0xB6, 0xA8, 0x84, 0x59, 0x40, 0x3F,
+  0x57, 0x82, 0xA9, 0xB9, 0xB3, 0x95, 0x69, 0x48, 0x3D, 0x4E, 0x74, 0x9E,
+  0xB5, 0xB7, 0xA3, 0x7A, 0x52, 0x3F, 0x45, 0x63, 0x8F, 0xAF, 0xB9, 0xAC,
+  0x89, 0x5F, 0x43, 0x41, 0x57, 0x80, 0xA7, 0xB8, 0xB3, 0x99, 0x6E, 0x4A,
+  0x3E, 0x4B, 0x6E, 0x99, 0xB4, 0xB8, 0xA5, 0x7D, 0x54, 0x3F, 0x43, 0x60,
+  0x8B, 0xAE, 0xB9, 0xAE, 0x8C, 0x61, 0x44, 0x3F, 0x52, 0x7A, 0xA3, 0xB7,
+  0xB5, 0x9C, 0x72, 0x4D, 0x3F, 0x49, 0x6B, 0x97, 0xB3, 0xBA, 0xA9, 0x82,
+  0x59, 0x42, 0x44, 0x5E, 0x89, 0xAD, 0xBA, 0xB3, 0x92, 0x66, 0x46, 0x3D,
+  0x4F, 0x76, 0xA1, 0xB8, 0xB8, 0xA0, 0x76, 0x4E, 0x3E, 0x46, 0x67, 0x94,
+  0xB3, 0xBA, 0xAC, 0x87, 0x5B, 0x40, 0x3F, 0x57, 0x82, 0xA8, 0xB8, 0xB2,
+  0x94, 0x69, 0x47, 0x3D, 0x4C, 0x72, 0x9E, 0xB6, 0xB7, 0xA2, 0x79, 0x51,
+  0x3E, 0x44, 0x63, 0x8F, 0xB0, 0xBB, 0xAE, 0x8B, 0x5F, 0x43, 0x40, 0x56,
+  0x80, 0xA9, 0xBB, 0xB7, 0x9C, 0x6F, 0x4B, 0x3F, 0x4C, 0x70, 0x9C, 0xB7,
+  0xBC, 0xA9, 0x80, 0x57, 0x42, 0x45, 0x62, 0x8E, 0xB1, 0xBD, 0xB3, 0x90,
+  0x64, 0x47, 0x41, 0x55, 0x7E, 0xA7, 0xBB, 0xB9, 0xA0, 0x75, 0x4F, 0x3F,
+  0x4A, 0x6C, 0x98, 0xB6, 0xBC, 0xAB, 0x84, 0x59, 0x41, 0x42, 0x5E, 0x89,
+  0xAE, 0xBC, 0xB3, 0x94, 0x68, 0x47, 0x40, 0x51, 0x78, 0xA2, 0xB9, 0xB9,
+  0xA2, 0x78, 0x51, 0x40, 0x49, 0x69, 0x95, 0xB4, 0xBB, 0xAC, 0x88, 0x5E,
+  0x44, 0x43, 0x5B, 0x85, 0xAC, 0xBD, 0xBA, 0xB5, 0xB4, 0xB3, 0xB1, 0xAF,
+  0xAE, 0xAC, 0xAB, 0xA9, 0xA8, 0xA7, 0xA5, 0xA4, 0xA3, 0xA2, 0xA1, 0x9F,
+  0x9F, 0x9E, 0x9C, 0x9B, 0x9A, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92,
+  0x91, 0x91, 0x90, 0x8F, 0x8E, 0x8D, 0x8D, 0x8D, 0x8C, 0x8B, 0x8A, 0x8A,
+  0x89, 0x89, 0x88, 0x87, 0x87, 0x86, 0x87, 0x86, 0x85, 0x85, 0x84, 0x85,
+  0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81,
+  0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B,
+  0x7A, 0x7B, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x78, 0x79, 0x78, 0x79,
+  0x79, 0x78, 0x79, 0x78, 0x79, 0x78, 0x77, 0x78, 0x77, 0x77, 0x78, 0x77,
+  0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x78, 0x77, 0x78,
+  0x79, 0x78, 0x79, 0x78, 0x79, 0x78, 0x77, 0x78, 0x78, 0x77, 0x78, 0x77,
+  0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x77, 0x78, 0x77, 0x78,
+  0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76,
+  0x77, 0x76, 0x77, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x77,
+  0x76, 0x77, 0x76, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x77, 0x78,
+  0x77, 0x78, 0x79, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x7A, 0x79, 0x7A,
+  0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A, 0x7B,
+  0x7A, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A,
+  0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x79,
+  0x7A, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A,
+  0x7B, 0x7A, 0x7B, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7C,
+  0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C,
+  0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C,
+  0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B, 0x7A,
+  0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7C, 0x7B,
+  0x7C, 0x7B, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C,
+  0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D,
+  0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x80, 0x7E, 0x80, 0x7E, 0x81, 0x7D, 0x8C, 0x98, 0x84, 0x6B, 0x54, 0x4A,
+  0x53, 0x61, 0x7D, 0x9B, 0xA2, 0xA4, 0x8A, 0x6F, 0x44, 0x11, 0x0F, 0x2F,
+  0x49, 0x77, 0xA8, 0xA4, 0x96, 0x8A, 0x6D, 0x50, 0x33, 0x22, 0x23, 0x2E,
+  0x45, 0x5B, 0x6C, 0x79, 0x77, 0x69, 0x52, 0x3A, 0x38, 0x39, 0x53, 0x73,
+  0x94, 0xB5, 0xC2, 0xC9, 0xBB, 0xA1, 0x85, 0x75, 0x73, 0x7F, 0x91, 0xB0,
+  0xC4, 0xCD, 0xC5, 0xA8, 0x8A, 0x5C, 0x47, 0x30, 0x32, 0x46, 0x5E, 0x77,
+  0x7F, 0x7D, 0x75, 0x5E, 0x44, 0x3D, 0x35, 0x55, 0x6F, 0x9F, 0xC6, 0xD8,
+  0xE3, 0xD7, 0xC1, 0x9F, 0x81, 0x73, 0x77, 0x81, 0xA1, 0xAB, 0xB4, 0xA0,
+  0x6E, 0x66, 0x65, 0x59, 0x67, 0x84, 0x7C, 0x85, 0x9F, 0xA1, 0xA2, 0x8B,
+  0x6B, 0x43, 0x24, 0x18, 0x1C, 0x33, 0x58, 0x7B, 0x90, 0x9B, 0x95, 0x8D,
+  0x6E, 0x64, 0x5C, 0x65, 0x80, 0x9A, 0xC4, 0xD8, 0xE5, 0xDC, 0xCA, 0xAC,
+  0x91, 0x7C, 0x7A, 0x83, 0x99, 0xB4, 0xBC, 0xC3, 0xAE, 0x9B, 0x6D, 0x46,
+  0x2F, 0x24, 0x32, 0x48, 0x69, 0x84, 0x92, 0x93, 0x8D, 0x73, 0x69, 0x5B,
+  0x65, 0x7B, 0x96, 0xBD, 0xD6, 0xEA, 0xEA, 0xD5, 0xB2, 0x8A, 0x6D, 0x60,
+  0x57, 0x68, 0x72, 0x70, 0x94, 0xAD, 0xA9, 0xA8, 0x97, 0x68, 0x46, 0x48,
+  0x4E, 0x71, 0x86, 0x92, 0x92, 0x80, 0x63, 0x39, 0x23, 0x20, 0x30, 0x49,
+  0x6E, 0x8D, 0xA8, 0xAD, 0xB0, 0x9D, 0x85, 0x76, 0x6C, 0x7C, 0x8C, 0xB1,
+  0xCF, 0xE3, 0xE9, 0xDA, 0xBD, 0x9B, 0x7D, 0x6E, 0x6A, 0x72, 0x8B, 0x9B,
+  0xAC, 0xA0, 0x91, 0x78, 0x4F, 0x33, 0x1E, 0x1E, 0x36, 0x55, 0x7E, 0x9B,
+  0xA7, 0xB3, 0xA2, 0x93, 0x81, 0x75, 0x7A, 0x87, 0xA0, 0xBE, 0xCE, 0xD6,
+  0xCB, 0xB3, 0x92, 0x65, 0x50, 0x34, 0x29, 0x56, 0x8D, 0xAC, 0xCF, 0xD4,
+  0xAA, 0x82, 0x5E, 0x40, 0x38, 0x39, 0x4F, 0x6C, 0x80, 0x8D, 0x86, 0x79,
+  0x62, 0x46, 0x36, 0x32, 0x41, 0x63, 0x84, 0xAC, 0xBE, 0xC7, 0xC2, 0xA9,
+  0x91, 0x7B, 0x76, 0x7D, 0x94, 0xB6, 0xD2, 0xDB, 0xDB, 0xC6, 0xAA, 0x82,
+  0x65, 0x54, 0x4E, 0x60, 0x6E, 0x86, 0x8F, 0x8D, 0x80, 0x66, 0x44, 0x31,
+  0x23, 0x31, 0x4B, 0x71, 0xA5, 0xB8, 0xCC, 0xC7, 0xB7, 0x9B, 0x81, 0x76,
+  0x79, 0x83, 0x9E, 0xB5, 0xC3, 0xC5, 0xAA, 0x91, 0x5A, 0x2B, 0x32, 0x47,
+  0x61, 0x98, 0xC0, 0xB8, 0xB2, 0xA3, 0x86, 0x64, 0x3E, 0x2B, 0x27, 0x37,
+  0x4F, 0x6D, 0x84, 0x93, 0x91, 0x83, 0x67, 0x4E, 0x45, 0x44, 0x62, 0x7A,
+  0xA5, 0xC3, 0xD3, 0xDA, 0xC7, 0xAE, 0x8E, 0x7D, 0x78, 0x80, 0x91, 0xB2,
+  0xC5, 0xD2, 0xC6, 0xB0, 0x8F, 0x63, 0x4C, 0x30, 0x36, 0x45, 0x62, 0x7A,
+  0x86, 0x86, 0x7F, 0x67, 0x4F, 0x3E, 0x3A, 0x54, 0x6C, 0xA1, 0xC3, 0xDC,
+  0xE4, 0xDA, 0xC2, 0x9A, 0x7A, 0x6B, 0x69, 0x78, 0x93, 0xA3, 0xB1, 0x94,
+  0x74, 0x76, 0x6A, 0x5B, 0x6A, 0x74, 0x66, 0x79, 0x95, 0x9F, 0xA3, 0x8E,
+  0x73, 0x49, 0x28, 0x15, 0x18, 0x31, 0x56, 0x7B, 0x95, 0xA0, 0x9C, 0x90,
+  0x71, 0x62, 0x53, 0x5E, 0x71, 0x92, 0xBA, 0xD1, 0xE1, 0xD7, 0xC6, 0xA4,
+  0x84, 0x6E, 0x6A, 0x71, 0x8A, 0xA2, 0xB5, 0xBA, 0xAB, 0x97, 0x66, 0x43,
+  0x26, 0x1C, 0x29, 0x40, 0x64, 0x85, 0x92, 0x99, 0x8D, 0x78, 0x67, 0x55,
+  0x5F, 0x6E, 0x8A, 0xB0, 0xCC, 0xDF, 0xE0, 0xCB, 0xAB, 0x7F, 0x63, 0x50,
+  0x4B, 0x5C, 0x62, 0x74, 0xA1, 0xB2, 0xAF, 0xAE, 0x8C, 0x5A, 0x42, 0x3E,
+  0x4A, 0x6D, 0x82, 0x95, 0x94, 0x86, 0x68, 0x3E, 0x28, 0x22, 0x2D, 0x47,
+  0x6A, 0x8F, 0xA8, 0xB0, 0xB4, 0x9E, 0x86, 0x70, 0x66, 0x6F, 0x82, 0xA3,
+  0xC5, 0xDD, 0xE3, 0xD4, 0xB8, 0x94, 0x73, 0x63, 0x59, 0x68, 0x7B, 0x95,
+  0xA4, 0x9B, 0x93, 0x76, 0x52, 0x30, 0x18, 0x14, 0x29, 0x4A, 0x7F, 0x9C,
+  0xB4, 0xBC, 0xA9, 0x98, 0x7A, 0x6D, 0x6C, 0x77, 0x7E, 0x7E, 0x79, 0x7A,
+  0x71, 0x6F, 0x66, 0x58, 0x51, 0x32, 0x2B, 0x4A, 0x5D, 0x6C, 0x8B, 0x86,
+  0x69, 0x62, 0x56, 0x50, 0x4D, 0x44, 0x46, 0x42, 0x44, 0x42, 0x40, 0x45,
+  0x4B, 0x4E, 0x54, 0x56, 0x5F, 0x66, 0x6C, 0x7B, 0x7C, 0x8A, 0x8D, 0x95,
+  0x9B, 0x9C, 0xA1, 0x9F, 0xA3, 0xA4, 0xA1, 0x9D, 0x9B, 0x95, 0x95, 0x89,
+  0x88, 0x7D, 0x76, 0x70, 0x5F, 0x5E, 0x54, 0x52, 0x50, 0x4E, 0x51, 0x58,
+  0x5A, 0x67, 0x6A, 0x79, 0x87, 0x8C, 0x9E, 0xA1, 0xA8, 0xAC, 0xAD, 0xB0,
+  0xAD, 0xA8, 0xA6, 0x9D, 0x9A, 0x8D, 0x81, 0x78, 0x56, 0x52, 0x71, 0x81,
+  0x91, 0xAE, 0xA5, 0x89, 0x81, 0x74, 0x6D, 0x69, 0x61, 0x61, 0x5C, 0x5E,
+  0x5A, 0x58, 0x5D, 0x62, 0x64, 0x6A, 0x6B, 0x75, 0x7A, 0x82, 0x8F, 0x90,
+  0x9E, 0x9F, 0xA8, 0xAC, 0xAE, 0xB1, 0xB0, 0xB3, 0xB3, 0xAF, 0xAA, 0xA8,
+  0xA3, 0xA1, 0x95, 0x93, 0x88, 0x82, 0x79, 0x69, 0x67, 0x5E, 0x5D, 0x5B,
+  0x58, 0x5B, 0x62, 0x63, 0x6F, 0x71, 0x80, 0x8A, 0x91, 0xA1, 0xA2, 0xAA,
+  0xAB, 0xAD, 0xAE, 0xAB, 0xA7, 0xA6, 0x9C, 0x9A, 0x8D, 0x82, 0x79, 0x59,
+  0x58, 0x75, 0x82, 0x93, 0xAC, 0xA0, 0x87, 0x80, 0x74, 0x6E, 0x69, 0x62,
+  0x62, 0x5E, 0x5E, 0x5B, 0x5A, 0x5E, 0x63, 0x66, 0x6B, 0x6C, 0x76, 0x7A,
+  0x82, 0x8D, 0x8F, 0x9C, 0x9C, 0xA5, 0xA7, 0xAA, 0xAC, 0xAC, 0xAF, 0xAE,
+  0xAA, 0xA6, 0xA4, 0x9F, 0x9E, 0x93, 0x92, 0x86, 0x82, 0x78, 0x6A, 0x68,
+  0x5F, 0x5E, 0x5B, 0x59, 0x5C, 0x62, 0x64, 0x70, 0x72, 0x81, 0x89, 0x92,
+  0xA0, 0xA2, 0xA9, 0xAB, 0xAD, 0xAE, 0xAB, 0xA6, 0xA4, 0x9B, 0x99, 0x89,
+  0x80, 0x73, 0x55, 0x5A, 0x77, 0x81, 0x93, 0xAB, 0x9D, 0x85, 0x7E, 0x72,
+  0x6D, 0x68, 0x61, 0x61, 0x5D, 0x5F, 0x5A, 0x5A, 0x5E, 0x62, 0x65, 0x6A,
+  0x6B, 0x75, 0x79, 0x82, 0x8C, 0x8F, 0x9B, 0x9A, 0xA1, 0xA2, 0xA5, 0xA6,
+  0xA8, 0xAA, 0xA9, 0xA4, 0xA2, 0x9F, 0x9B, 0x98, 0x8E, 0x8D, 0x81, 0x7F,
+  0x73, 0x68, 0x66, 0x5E, 0x5D, 0x5B, 0x59, 0x5D, 0x61, 0x64, 0x6F, 0x70,
+  0x80, 0x86, 0x90, 0x9C, 0x9E, 0xA4, 0xA5, 0xA6, 0xA8, 0xA4, 0xA0, 0x9D,
+  0x94, 0x93, 0x84, 0x7C, 0x6E, 0x53, 0x5B, 0x76, 0x80, 0x93, 0xA6, 0x94,
+  0x80, 0x7B, 0x6F, 0x6C, 0x65, 0x61, 0x60, 0x5D, 0x5E, 0x5A, 0x5B, 0x5E,
+  0x63, 0x66, 0x6A, 0x6C, 0x76, 0x78, 0x83, 0x8B, 0x8E, 0x99, 0x99, 0xA3,
+  0xA3, 0xA6, 0xA7, 0xA8, 0xAA, 0xA8, 0xA4, 0xA2, 0x9E, 0x9B, 0x97, 0x8D,
+  0x8D, 0x80, 0x7E, 0x71, 0x68, 0x65, 0x5D, 0x5D, 0x59, 0x58, 0x5D, 0x61,
+  0x65, 0x6F, 0x70, 0x80, 0x85, 0x90, 0x9B, 0x9D, 0xA3, 0xA4, 0xA6, 0xA7,
+  0xA3, 0xA0, 0x9D, 0x95, 0x92, 0x83, 0x7D, 0x6D, 0x53, 0x5D, 0x76, 0x80,
+  0x95, 0xA6, 0x92, 0x80, 0x79, 0x6F, 0x6C, 0x65, 0x62, 0x61, 0x5F, 0x60,
+  0x5D, 0x5E, 0x62, 0x65, 0x67, 0x6B, 0x6C, 0x74, 0x75, 0x7F, 0x84, 0x88,
+  0x90, 0x90, 0x98, 0x98, 0x9B, 0x9B, 0x9C, 0x9E, 0x9D, 0x99, 0x97, 0x95,
+  0x92, 0x8F, 0x88, 0x86, 0x7D, 0x7C, 0x71, 0x6A, 0x66, 0x60, 0x60, 0x5D,
+  0x5D, 0x60, 0x63, 0x67, 0x6E, 0x71, 0x7F, 0x82, 0x8C, 0x93, 0x95, 0x9A,
+  0x9B, 0x9C, 0x9D, 0x9A, 0x98, 0x95, 0x8F, 0x8D, 0x81, 0x7C, 0x6E, 0x5A,
+  0x65, 0x78, 0x80, 0x91, 0x9D, 0x8D, 0x80, 0x7C, 0x73, 0x70, 0x6A, 0x68,
+  0x67, 0x65, 0x65, 0x62, 0x63, 0x67, 0x69, 0x6B, 0x6F, 0x71, 0x79, 0x7A,
+  0x84, 0x88, 0x8D, 0x93, 0x94, 0x9C, 0x9B, 0x9F, 0x9D, 0x9F, 0xA0, 0x9F,
+  0x9B, 0x9A, 0x96, 0x95, 0x8F, 0x8A, 0x88, 0x7E, 0x7D, 0x71, 0x6B, 0x68,
+  0x63, 0x62, 0x5F, 0x5F, 0x64, 0x65, 0x6A, 0x71, 0x74, 0x81, 0x84, 0x8E,
+  0x94, 0x96, 0x9B, 0x9A, 0x9D, 0x9D, 0x9A, 0x99, 0xBB, 0xDD, 0xF0, 0xED,
+  0xBF, 0x87, 0x77, 0x86, 0x8E, 0x9E, 0x9A, 0x8B, 0x80, 0x72, 0x86, 0xCA,
+  0xEF, 0xEF, 0xC3, 0x7A, 0x67, 0x77, 0x98, 0xAD, 0xAD, 0x85, 0x50, 0x3F,
+  0x52, 0x7C, 0x96, 0x98, 0x73, 0x3C, 0x25, 0x3D, 0x76, 0x9D, 0x9B, 0x7A,
+  0x4D, 0x3D, 0x52, 0x8C, 0xB2, 0xB0, 0x94, 0x75, 0x66, 0x77, 0xAC, 0xD4,
+  0xD1, 0xB2, 0x8F, 0x7F, 0x8F, 0xBD, 0xDE, 0xDD, 0xBC, 0x93, 0x80, 0x90,
+  0xB7, 0xD2, 0xD1, 0xAE, 0x7E, 0x69, 0x7A, 0x9E, 0xB4, 0xB5, 0x93, 0x5D,
+  0x44, 0x56, 0x76, 0x87, 0x88, 0x67, 0x30, 0x15, 0x2B, 0x57, 0x76, 0x79,
+  0x5A, 0x32, 0x22, 0x34, 0x68, 0x92, 0x96, 0x78, 0x5E, 0x55, 0x62, 0x96,
+  0xC9, 0xCF, 0xAD, 0x87, 0x76, 0x83, 0xB2, 0xDB, 0xDC, 0xB9, 0x83, 0x6B,
+  0x78, 0xA2, 0xB8, 0xBB, 0x9B, 0x5F, 0x3A, 0x4D, 0x6E, 0x6D, 0x6D, 0x4F,
+  0x40, 0x43, 0x4E, 0x85, 0xC6, 0xD1, 0xB1, 0x6F, 0x41, 0x50, 0x74, 0x8C,
+  0x8B, 0x71, 0x3F, 0x26, 0x32, 0x5B, 0x7B, 0x7F, 0x65, 0x35, 0x1A, 0x28,
+  0x55, 0x7F, 0x88, 0x6C, 0x43, 0x30, 0x3D, 0x6A, 0x99, 0xA3, 0x86, 0x5F,
+  0x54, 0x60, 0x8D, 0xBF, 0xCC, 0xAD, 0x81, 0x71, 0x7C, 0xA8, 0xD4, 0xDD,
+  0xBC, 0x8A, 0x73, 0x7D, 0xAB, 0xCE, 0xD0, 0xB1, 0x7D, 0x60, 0x69, 0x93,
+  0xB0, 0xB0, 0x97, 0x63, 0x3F, 0x47, 0x72, 0x8A, 0x85, 0x6D, 0x3C, 0x17,
+  0x20, 0x4E, 0x72, 0x79, 0x60, 0x35, 0x20, 0x2E, 0x59, 0x87, 0x98, 0x7E,
+  0x57, 0x50, 0x5E, 0x84, 0xB8, 0xCF, 0xB3, 0x87, 0x73, 0x7E, 0xA6, 0xD5,
+  0xE0, 0xC1, 0x8F, 0x6E, 0x74, 0x9D, 0xBF, 0xBE, 0xA7, 0x73, 0x47, 0x45,
+  0x75, 0x87, 0x76, 0x5C, 0x30, 0x34, 0x4E, 0x74, 0xB0, 0xD3, 0xBC, 0x8A,
+  0x53, 0x4B, 0x76, 0x95, 0x93, 0x7A, 0x4F, 0x2C, 0x2E, 0x55, 0x7C, 0x83,
+  0x6E, 0x3F, 0x1D, 0x22, 0x4E, 0x7A, 0x8B, 0x75, 0x49, 0x30, 0x3B, 0x63,
+  0x91, 0xA6, 0x92, 0x63, 0x50, 0x60, 0x85, 0xB5, 0xCC, 0xB8, 0x87, 0x6E,
+  0x7A, 0xA1, 0xCD, 0xDE, 0xC8, 0x94, 0x76, 0x7D, 0xA4, 0xD0, 0xD6, 0xBC,
+  0x8C, 0x68, 0x6A, 0x8F, 0xB8, 0xBB, 0xA2, 0x74, 0x4E, 0x48, 0x6E, 0x97,
+  0x93, 0x77, 0x4A, 0x22, 0x1F, 0x49, 0x76, 0x80, 0x6B, 0x3D, 0x1E, 0x29,
+  0x52, 0x7F, 0x96, 0x89, 0x5C, 0x44, 0x58, 0x7D, 0xA9, 0xC9, 0xBD, 0x8D,
+  0x6F, 0x78, 0x9F, 0xCC, 0xE1, 0xCA, 0x99, 0x74, 0x71, 0x96, 0xC0, 0xC8,
+  0xAE, 0x83, 0x58, 0x4B, 0x6B, 0x9C, 0x90, 0x69, 0x39, 0x1F, 0x42, 0x73,
+  0x9E, 0xC7, 0xC7, 0x98, 0x6E, 0x50, 0x6D, 0x9C, 0xA3, 0x86, 0x59, 0x38,
+  0x2E, 0x4F, 0x7D, 0x8C, 0x78, 0x4B, 0x24, 0x20, 0x46, 0x77, 0x8C, 0x81,
+  0x51, 0x30, 0x35, 0x5D, 0x8A, 0xA1, 0x9A, 0x6C, 0x4B, 0x58, 0x81, 0xAD,
+  0xC6, 0xBF, 0x90, 0x6D, 0x74, 0x9B, 0xC8, 0xDC, 0xCD, 0x9B, 0x74, 0x74,
+  0x9A, 0xC8, 0xDA, 0xC3, 0x94, 0x6D, 0x67, 0x87, 0xB5, 0xC4, 0xAC, 0x7D,
+  0x57, 0x4B, 0x66, 0x97, 0xA5, 0x86, 0x56, 0x2F, 0x23, 0x44, 0x76, 0x8A,
+  0x78, 0x49, 0x21, 0x23, 0x4D, 0x7D, 0x96, 0x90, 0x67, 0x40, 0x49, 0x77,
+  0xA4, 0xBD, 0xBE, 0x96, 0x6D, 0x6D, 0x94, 0xC6, 0xDD, 0xD0, 0x9F, 0x77,
+  0x6D, 0x8C, 0xBA, 0xCC, 0xB8, 0x88, 0x61, 0x51, 0x65, 0x94, 0xA9, 0x7E,
+  0x46, 0x1B, 0x25, 0x66, 0x99, 0xB4, 0xC1, 0x9E, 0x76, 0x63, 0x69, 0x97,
+  0xAE, 0x97, 0x62, 0x3E, 0x33, 0x4B, 0x7A, 0x93, 0x84, 0x54, 0x2A, 0x20,
+  0x40, 0x74, 0x8E, 0x87, 0x5E, 0x33, 0x2F, 0x54, 0x88, 0xA1, 0x9E, 0x78,
+  0x4C, 0x4A, 0x76, 0xA8, 0xC0, 0xBF, 0x9A, 0x6F, 0x68, 0x8F, 0xC1, 0xD8,
+  0xD0, 0xA6, 0x7A, 0x73, 0x92, 0xC3, 0xDC, 0xCF, 0x9E, 0x73, 0x69, 0x81,
+  0xAD, 0xC5, 0xB6, 0x86, 0x5B, 0x4F, 0x63, 0x8F, 0xA8, 0x9A, 0x74, 0x4C,
+  0x2E, 0x20, 0x2D, 0x52, 0x76, 0x89, 0x8A, 0x78, 0x57, 0x39, 0x2A, 0x37,
+  0x5B, 0x82, 0x9F, 0xB4, 0xB2, 0x8F, 0x70, 0x65, 0x65, 0x7B, 0xA7, 0xCA,
+  0xD5, 0xD1, 0xBC, 0x94, 0x75, 0x67, 0x72, 0x92, 0xB8, 0xC7, 0xC8, 0xB3,
+  0x81, 0x4F, 0x40, 0x38, 0x37, 0x5C, 0x7D, 0x9F, 0xAA, 0x86, 0x65, 0x65,
+  0x68, 0x7D, 0x8F, 0x9E, 0xB1, 0xA8, 0x87, 0x58, 0x38, 0x23, 0x2A, 0x4D,
+  0x78, 0x8F, 0x93, 0x83, 0x5B, 0x35, 0x23, 0x29, 0x47, 0x70, 0x91, 0x9F,
+  0x9A, 0x7D, 0x58, 0x47, 0x45, 0x55, 0x7E, 0xAD, 0xC1, 0xC1, 0xB4, 0x92,
+  0x6F, 0x66, 0x75, 0x93, 0xBA, 0xD5, 0xDB, 0xCC, 0xAB, 0x88, 0x71, 0x71,
+  0x83, 0xA6, 0xC6, 0xCF, 0xC4, 0xA7, 0x81, 0x5D, 0x50, 0x60, 0x7D, 0x99,
+  0xAC, 0xAC, 0x8C, 0x5B, 0x3B, 0x2A, 0x29, 0x42, 0x6B, 0x86, 0x8D, 0x80,
+  0x61, 0x40, 0x2D, 0x2E, 0x49, 0x74, 0x96, 0xA9, 0xB3, 0x9E, 0x74, 0x5F,
+  0x60, 0x6D, 0x91, 0xBC, 0xD3, 0xD4, 0xC5, 0xA3, 0x7C, 0x69, 0x68, 0x82,
+  0xAC, 0xC9, 0xCC, 0xC1, 0x9A, 0x64, 0x3F, 0x40, 0x41, 0x52, 0x7A, 0x8E,
+  0xA5, 0x9C, 0x6E, 0x59, 0x62, 0x70, 0x91, 0xA3, 0xAE, 0xB4, 0x9C, 0x6E,
+  0x43, 0x2E, 0x29, 0x42, 0x6D, 0x8E, 0x96, 0x8D, 0x6F, 0x44, 0x28, 0x24,
+  0x37, 0x60, 0x88, 0x9C, 0x9F, 0x8B, 0x63, 0x44, 0x3F, 0x4B, 0x69, 0x99,
+  0xBC, 0xC1, 0xB6, 0x9B, 0x76, 0x5F, 0x66, 0x82, 0xA8, 0xC9, 0xD9, 0xD3,
+  0xB7, 0x90, 0x73, 0x6C, 0x79, 0x99, 0xBE, 0xD0, 0xCC, 0xB4, 0x8F, 0x6B,
+  0x53, 0x56, 0x73, 0x96, 0xA9, 0xB1, 0xA3, 0x74, 0x48, 0x31, 0x2B, 0x39,
+  0x5F, 0x85, 0x92, 0x8D, 0x71, 0x4B, 0x33, 0x2B, 0x3A, 0x63, 0x8E, 0xA5,
+  0xAE, 0xA9, 0x86, 0x61, 0x5B, 0x67, 0x80, 0xAB, 0xCC, 0xD6, 0xCB, 0xB0,
+  0x88, 0x6D, 0x67, 0x77, 0x9D, 0xC2, 0xCF, 0xC5, 0xAB, 0x78, 0x4A, 0x38,
+  0x46, 0x52, 0x6D, 0x8A, 0x96, 0x9F, 0x7F, 0x54, 0x52, 0x64, 0x80, 0xA6,
+  0xAF, 0xB5, 0xAD, 0x85, 0x51, 0x32, 0x2B, 0x37, 0x5F, 0x87, 0x9A, 0x97,
+  0x81, 0x58, 0x33, 0x25, 0x2E, 0x50, 0x7E, 0x9B, 0xA2, 0x96, 0x75, 0x4C,
+  0x3C, 0x44, 0x5C, 0x85, 0xB0, 0xC2, 0xBB, 0xA5, 0x82, 0x63, 0x5A, 0x6F,
+  0x97, 0xBD, 0xD3, 0xD6, 0xC2, 0x9A, 0x76, 0x66, 0x6C, 0x88, 0xAE, 0xCA,
+  0xCF, 0xBF, 0x9A, 0x73, 0x58, 0x4E, 0x62, 0x88, 0xA6, 0xAF, 0xAC, 0x8C,
+  0x57, 0x37, 0x2D, 0x34, 0x52, 0x7D, 0x96, 0x95, 0x81, 0x5B, 0x3A, 0x2D,
+  0x33, 0x4F, 0x7F, 0xA2, 0xAB, 0xAC, 0x95, 0x6C, 0x53, 0x5C, 0x75, 0x99,
+  0xC1, 0xD5, 0xD3, 0xBB, 0x95, 0x72, 0x64, 0x6D, 0x8D, 0xB7, 0xD1, 0xCD,
+  0xB7, 0x92, 0x61, 0x3F, 0x40, 0x57, 0x69, 0x84, 0x8F, 0x94, 0x8C, 0x63,
+  0x47, 0x58, 0x74, 0x9C, 0xBA, 0xB6, 0xB2, 0x99, 0x67, 0x3B, 0x2B, 0x31,
+  0x4F, 0x7C, 0x9A, 0x9F, 0x90, 0x6C, 0x43, 0x2A, 0x2A, 0x43, 0x6F, 0x97,
+  0xA6, 0xA1, 0x85, 0x5B, 0x3C, 0x3A, 0x4E, 0x72, 0x9E, 0xBD, 0xC0, 0xAC,
+  0x88, 0x66, 0x54, 0x5C, 0x80, 0xAC, 0xCA, 0xD3, 0xC8, 0xA4, 0x7A, 0x61,
+  0x5F, 0x75, 0x9C, 0xBF, 0xCE, 0xC7, 0xA9, 0x7D, 0x5C, 0x4C, 0x53, 0x77,
+  0xA0, 0xB3, 0xB1, 0xA0, 0x71, 0x42, 0x2F, 0x33, 0x49, 0x72, 0x96, 0x9F,
+  0x92, 0x70, 0x47, 0x30, 0x2F, 0x41, 0x6C, 0x99, 0xAD, 0xAB, 0x9C, 0x78,
+  0x53, 0x4C, 0x61, 0x84, 0xAD, 0xCC, 0xD3, 0xC2, 0x9D, 0x76, 0x5E, 0x60,
+  0x78, 0xA3, 0xC6, 0xD2, 0xC3, 0xA1, 0x73, 0x4B, 0x3C, 0x50, 0x71, 0x88,
+  0x9B, 0x99, 0x91, 0x74, 0x4C, 0x42, 0x5D, 0x84, 0xB1, 0xC2, 0xBA, 0xAC,
+  0x81, 0x4F, 0x31, 0x33, 0x48, 0x70, 0x95, 0xA4, 0x9B, 0x7D, 0x55, 0x35,
+  0x2C, 0x3B, 0x60, 0x8B, 0xA4, 0xA5, 0x93, 0x6D, 0x46, 0x33, 0x35, 0x39,
+  0x3A, 0x40, 0x49, 0x4A, 0x4B, 0x54, 0x59, 0x59, 0x5D, 0x64, 0x66, 0x68,
+  0x6B, 0x6E, 0x6E, 0x70, 0x73, 0x74, 0x75, 0x73, 0x72, 0x73, 0x73, 0x70,
+  0x71, 0x71, 0x6D, 0x6A, 0x6C, 0x6A, 0x64, 0x63, 0x65, 0x5E, 0x57, 0x59,
+  0x58, 0x54, 0x54, 0x56, 0x54, 0x54, 0x55, 0x57, 0x5C, 0x5E, 0x5F, 0x64,
+  0x69, 0x6B, 0x6E, 0x79, 0x7E, 0x7D, 0x86, 0x8E, 0x8E, 0x90, 0x94, 0x96,
+  0x95, 0x97, 0x98, 0x98, 0x97, 0x95, 0x94, 0x94, 0x91, 0x8C, 0x8C, 0x8A,
+  0x81, 0x7B, 0x7F, 0x72, 0x63, 0x62, 0x65, 0x78, 0x84, 0x82, 0x8D, 0x9C,
+  0x9F, 0x9D, 0x8C, 0x83, 0x84, 0x7F, 0x79, 0x78, 0x78, 0x73, 0x71, 0x72,
+  0x72, 0x70, 0x71, 0x71, 0x6F, 0x6E, 0x6F, 0x71, 0x74, 0x76, 0x77, 0x79,
+  0x7C, 0x7C, 0x7E, 0x84, 0x86, 0x86, 0x8D, 0x93, 0x92, 0x94, 0x9A, 0x9D,
+  0x9C, 0xA0, 0xA3, 0xA2, 0xA3, 0xA4, 0xA5, 0xA3, 0xA5, 0xA3, 0x9E, 0x9D,
+  0x9B, 0x99, 0x98, 0x97, 0x95, 0x95, 0x94, 0x8F, 0x8C, 0x8C, 0x89, 0x83,
+  0x84, 0x83, 0x7A, 0x77, 0x78, 0x75, 0x72, 0x71, 0x72, 0x70, 0x6F, 0x70,
+  0x72, 0x75, 0x76, 0x77, 0x7C, 0x7F, 0x7F, 0x83, 0x8D, 0x8D, 0x8E, 0x96,
+  0x9B, 0x9A, 0x9B, 0x9E, 0x9F, 0x9E, 0x9F, 0xA0, 0x9F, 0x9D, 0x9A, 0x99,
+  0x98, 0x95, 0x90, 0x91, 0x8D, 0x85, 0x82, 0x84, 0x76, 0x6B, 0x6A, 0x6E,
+  0x80, 0x86, 0x85, 0x91, 0x9B, 0x9B, 0x98, 0x88, 0x84, 0x84, 0x7F, 0x79,
+  0x7A, 0x79, 0x75, 0x73, 0x74, 0x74, 0x72, 0x73, 0x73, 0x72, 0x71, 0x73,
+  0x74, 0x77, 0x77, 0x79, 0x7B, 0x7C, 0x7C, 0x80, 0x84, 0x84, 0x86, 0x8B,
+  0x90, 0x8E, 0x92, 0x97, 0x97, 0x97, 0x9B, 0x9D, 0x9C, 0x9C, 0x9D, 0x9E,
+  0x9D, 0x9E, 0x9E, 0x9D, 0x9C, 0x99, 0x98, 0x97, 0x95, 0x93, 0x93, 0x90,
+  0x8B, 0x8A, 0x89, 0x84, 0x80, 0x80, 0x7E, 0x75, 0x73, 0x73, 0x6F, 0x6D,
+  0x6E, 0x6E, 0x6C, 0x6C, 0x6D, 0x6F, 0x72, 0x72, 0x74, 0x78, 0x7B, 0x7A,
+  0x80, 0x86, 0x86, 0x88, 0x8F, 0x92, 0x91, 0x93, 0x96, 0x96, 0x95, 0x96,
+  0x96, 0x96, 0x94, 0x92, 0x92, 0x91, 0x8D, 0x8B, 0x8B, 0x87, 0x80, 0x7F,
+  0x7E, 0x71, 0x6B, 0x6B, 0x72, 0x7F, 0x80, 0x82, 0x8E, 0x93, 0x94, 0x8E,
+  0x80, 0x7F, 0x7E, 0x79, 0x75, 0x76, 0x74, 0x71, 0x70, 0x71, 0x70, 0x6F,
+  0x70, 0x70, 0x6E, 0x6F, 0x6E, 0x71, 0x73, 0x73, 0x75, 0x77, 0x78, 0x78,
+  0x7C, 0x7F, 0x7F, 0x81, 0x87, 0x89, 0x88, 0x8C, 0x90, 0x90, 0x92, 0x95,
+  0x96, 0x95, 0x96, 0x97, 0x96, 0x96, 0x97, 0x96, 0x97, 0x95, 0x93, 0x92,
+  0x91, 0x8F, 0x8E, 0x8E, 0x8B, 0x87, 0x87, 0x85, 0x80, 0x7E, 0x7F, 0x7B,
+  0x74, 0x74, 0x73, 0x70, 0x6E, 0x6F, 0x6D, 0x6C, 0x6C, 0x6D, 0x70, 0x71,
+  0x71, 0x74, 0x78, 0x79, 0x7A, 0x80, 0x85, 0x84, 0x88, 0x8E, 0x8A, 0x88,
+  0x8A, 0x8B, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8A, 0x8A, 0x88, 0x88, 0x85,
+  0x85, 0x84, 0x80, 0x7D, 0x7D, 0x7A, 0x71, 0x6F, 0x6F, 0x77, 0x7E, 0x7E,
+  0x81, 0x89, 0x8C, 0x8D, 0x86, 0x7F, 0x7F, 0x7D, 0x7A, 0x78, 0x79, 0x76,
+  0x74, 0x75, 0x75, 0x74, 0x73, 0x75, 0x74, 0x73, 0x73, 0x74, 0x75, 0x76,
+  0x77, 0x77, 0x78, 0x79, 0x79, 0x7C, 0x7D, 0x7D, 0x80, 0x83, 0x83, 0x84,
+  0x87, 0x89, 0x88, 0x8A, 0x8C, 0x8D, 0x8C, 0x8D, 0x8E, 0x8D, 0x8D, 0x8E,
+  0x8D, 0x8E, 0x8C, 0x8B, 0x8B, 0x8A, 0x89, 0x88, 0x88, 0x86, 0x84, 0x85,
+  0x83, 0x80, 0x7F, 0x7F, 0x7B, 0x77, 0x78, 0x77, 0x74, 0x73, 0x74, 0x73,
+  0x73, 0x72, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7C, 0x7B, 0x7D, 0x82, 0x84,
+  0x84, 0x87, 0x8B, 0x8B, 0x8C, 0x8E, 0x8E, 0x8D, 0x8E, 0x8E, 0x8E, 0x8D,
+  0x8C, 0x8B, 0x8A, 0x89, 0x86, 0x86, 0x85, 0x80, 0x7D, 0x7E, 0x77, 0x71,
+  0x70, 0x71, 0x77, 0x7C, 0x7B, 0x7E, 0x85, 0x86, 0x85, 0x7F, 0x7C, 0x7D,
+  0x7B, 0x79, 0x78, 0x79, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76,
+  0x75, 0x75, 0x76, 0x78, 0x79, 0x78, 0x7A, 0x7B, 0x7A, 0x7B, 0x7D, 0x7E,
+  0x7E, 0x80, 0x83, 0x82, 0x84, 0x86, 0x87, 0x86, 0x87, 0x89, 0x88, 0x89,
+  0x88, 0x89, 0x88, 0x88, 0x89, 0x88, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84,
+  0x84, 0x83, 0x81, 0x80, 0x81, 0x7F, 0x7D, 0x7C, 0x7C, 0x79, 0x77, 0x78,
+  0x77, 0x75, 0x76, 0x75, 0x74, 0x74, 0x75, 0x76, 0x77, 0x77, 0x78, 0x7B,
+  0x7D, 0x7D, 0x7F, 0x83, 0x83, 0x83, 0x87, 0x89, 0x88, 0x89, 0x8A, 0x8B,
+  0x8A, 0x8B, 0x8A, 0x8B, 0x8A, 0x89, 0x88, 0x87, 0x87, 0x85, 0x85, 0x84,
+  0x80, 0x7E, 0x7F, 0x79, 0x75, 0x74, 0x76, 0x7D, 0x7F, 0x80, 0x84, 0x88,
+  0x89, 0x87, 0x80, 0x7E, 0x7F, 0x7C, 0x7A, 0x7A, 0x7A, 0x78, 0x77, 0x78,
+  0x78, 0x77, 0x78, 0x78, 0x77, 0x78, 0x77, 0x78, 0x79, 0x79, 0x7A, 0x7A,
+  0x7B, 0x7A, 0x7B, 0x7D, 0x7C, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x82, 0x82,
+  0x81, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x84, 0x83,
+  0x84, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x7F, 0x7E,
+  0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x7A, 0x79, 0x7A, 0x79, 0x79, 0x78, 0x79,
+  0x79, 0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7C, 0x7E, 0x80, 0x7F, 0x80, 0x82,
+  0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83,
+  0x84, 0x83, 0x83, 0x83, 0x81, 0x81, 0x80, 0x80, 0x7D, 0x7B, 0x7B, 0x7C,
+  0x80, 0x81, 0x80, 0x83, 0x85, 0x85, 0x84, 0x80, 0x81, 0x80, 0x7F, 0x7D,
+  0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B,
+  0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x80, 0x81, 0x82, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7E, 0x7F, 0x7E, 0x7F, 0x7C, 0x7E,
+  0x8D, 0xAA, 0xCB, 0xDF, 0xE5, 0xDC, 0xC6, 0xA2, 0x83, 0x70, 0x6D, 0x7C,
+  0x94, 0xB3, 0xC8, 0xD0, 0xC9, 0xB6, 0x97, 0x79, 0x65, 0x60, 0x6E, 0x87,
+  0xAA, 0xC2, 0xCD, 0xC7, 0xB5, 0x95, 0x73, 0x5D, 0x55, 0x61, 0x7A, 0xA0,
+  0xBB, 0xC8, 0xC4, 0xB1, 0x92, 0x6E, 0x55, 0x4B, 0x57, 0x70, 0x95, 0xB3,
+  0xC2, 0xC1, 0xB0, 0x91, 0x6B, 0x52, 0x45, 0x4E, 0x65, 0x89, 0xA8, 0xBA,
+  0xBB, 0xAD, 0x8F, 0x68, 0x4E, 0x3F, 0x48, 0x5D, 0x80, 0xA3, 0xB6, 0xB8,
+  0xAB, 0x8F, 0x69, 0x4E, 0x3D, 0x43, 0x57, 0x7A, 0x9D, 0xB2, 0xB7, 0xAB,
+  0x92, 0x6C, 0x4E, 0x3E, 0x41, 0x54, 0x76, 0x9A, 0xAF, 0xB8, 0xAD, 0x96,
+  0x70, 0x50, 0x3E, 0x3E, 0x50, 0x6F, 0x95, 0xAC, 0xB6, 0xAD, 0x99, 0x73,
+  0x52, 0x3F, 0x3B, 0x4D, 0x6B, 0x90, 0xA9, 0xB5, 0xAE, 0x9B, 0x76, 0x54,
+  0x3F, 0x3A, 0x49, 0x64, 0x8A, 0xA7, 0xB3, 0xAF, 0x9C, 0x79, 0x56, 0x41,
+  0x39, 0x47, 0x60, 0x87, 0xA4, 0xB4, 0xB3, 0xA0, 0x80, 0x5A, 0x42, 0x38,
+  0x43, 0x5C, 0x83, 0xA1, 0xB3, 0xB3, 0xA3, 0x85, 0x5E, 0x44, 0x39, 0x42,
+  0x5A, 0x80, 0xA0, 0xB3, 0xB5, 0xA6, 0x8A, 0x63, 0x48, 0x39, 0x40, 0x57,
+  0x7A, 0x9D, 0xB1, 0xB5, 0xA8, 0x8D, 0x66, 0x4A, 0x3A, 0x3F, 0x53, 0x75,
+  0x9A, 0xAF, 0xB5, 0xAB, 0x91, 0x6B, 0x4D, 0x39, 0x3D, 0x4F, 0x70, 0x96,
+  0xAB, 0xB5, 0xAB, 0x94, 0x6F, 0x4E, 0x3B, 0x3A, 0x4C, 0x6C, 0x92, 0xAA,
+  0xB5, 0xAD, 0x98, 0x73, 0x51, 0x3E, 0x3A, 0x4A, 0x68, 0x8F, 0xA9, 0xB6,
+  0xB0, 0x9C, 0x79, 0x56, 0x41, 0x3A, 0x4A, 0x65, 0x8C, 0xAA, 0xB7, 0xB3,
+  0xA2, 0x7F, 0x5A, 0x44, 0x3B, 0x49, 0x62, 0x89, 0xA7, 0xB6, 0xB5, 0xA5,
+  0x83, 0x5E, 0x46, 0x3B, 0x46, 0x5F, 0x85, 0xA5, 0xB6, 0xB7, 0xA7, 0x89,
+  0x63, 0x48, 0x3C, 0x44, 0x5B, 0x81, 0xA1, 0xB4, 0xB7, 0xA8, 0x8D, 0x67,
+  0x4B, 0x3C, 0x42, 0x58, 0x7D, 0xA0, 0xB4, 0xBA, 0xAC, 0x92, 0x6B, 0x4E,
+  0x3D, 0x40, 0x55, 0x77, 0x9C, 0xB3, 0xB9, 0xAF, 0x97, 0x6F, 0x51, 0x3E,
+  0x3F, 0x53, 0x74, 0x9A, 0xB2, 0xBB, 0xB2, 0x9B, 0x74, 0x54, 0x40, 0x3F,
+  0x51, 0x6F, 0x97, 0xAF, 0xBB, 0xB5, 0x9F, 0x7A, 0x57, 0x42, 0x3E, 0x4D,
+  0x6B, 0x93, 0xAD, 0xBB, 0xB6, 0xA2, 0x7F, 0x5A, 0x43, 0x3C, 0x4A, 0x65,
+  0x8C, 0xA9, 0xB9, 0xB5, 0xA3, 0x81, 0x5B, 0x44, 0x3B, 0x47, 0x61, 0x88,
+  0xA8, 0xB8, 0xB7, 0xA7, 0x87, 0x60, 0x47, 0x3B, 0x46, 0x5E, 0x84, 0xA6,
+  0xB7, 0xB9, 0xAA, 0x8C, 0x65, 0x4A, 0x3C, 0x45, 0x5D, 0x83, 0xA5, 0xB8,
+  0xBC, 0xAE, 0x93, 0x6B, 0x4E, 0x3F, 0x44, 0x59, 0x7E, 0xA2, 0xB6, 0xBC,
+  0xAF, 0x96, 0x6F, 0x50, 0x3F, 0x42, 0x57, 0x78, 0x9E, 0xB5, 0xBD, 0xB2,
+  0x9A, 0x73, 0x53, 0x40, 0x40, 0x54, 0x73, 0x99, 0xB2, 0xBC, 0xB4, 0x9E,
+  0x78, 0x56, 0x42, 0x3F, 0x51, 0x70, 0x97, 0xB2, 0xBE, 0xB8, 0xA3, 0x7D,
+  0x5A, 0x44, 0x3E, 0x4E, 0x6B, 0x93, 0xAF, 0xBD, 0xB9, 0xA4, 0x83, 0x5D,
+  0x45, 0x3E, 0x4B, 0x67, 0x8F, 0xAD, 0xBD, 0xBB, 0xA8, 0x87, 0x61, 0x48,
+  0x3E, 0x49, 0x64, 0x8A, 0xAA, 0xBC, 0xBC, 0xAB, 0x8B, 0x64, 0x4A, 0x3D,
+  0x47, 0x60, 0x85, 0xA8, 0xBA, 0xBD, 0xAE, 0x90, 0x68, 0x4C, 0x3C, 0x44,
+  0x5B, 0x7F, 0xA3, 0xB7, 0xBC, 0xAE, 0x92, 0x6B, 0x4D, 0x3D, 0x42, 0x57,
+  0x7A, 0xA0, 0xB6, 0xBD, 0xB0, 0x97, 0x70, 0x4F, 0x3E, 0x40, 0x54, 0x76,
+  0x9C, 0xB4, 0xBE, 0xB3, 0x9B, 0x75, 0x53, 0x40, 0x40, 0x53, 0x74, 0x9A,
+  0xB4, 0xBF, 0xB6, 0xA1, 0x7A, 0x58, 0x43, 0x3F, 0x50, 0x6E, 0x96, 0xB2,
+  0xBE, 0xB8, 0xA3, 0x7F, 0x5B, 0x44, 0x3E, 0x4E, 0x6A, 0x92, 0xAF, 0xBD,
+  0xBA, 0xA6, 0x84, 0x5E, 0x46, 0x3D, 0x4B, 0x66, 0x8D, 0xAC, 0xBB, 0xBB,
+  0xAA, 0x8A, 0x62, 0x48, 0x3D, 0x48, 0x62, 0x89, 0xA9, 0xBD, 0xBE, 0xAC,
+  0x8D, 0x66, 0x4A, 0x3D, 0x46, 0x5F, 0x84, 0xA6, 0xBB, 0xBD, 0xAF, 0x92,
+  0x6A, 0x4D, 0x3D, 0x44, 0x5B, 0x80, 0xA4, 0xBA, 0xBF, 0xB2, 0x96, 0x6F,
+  0x50, 0x3E, 0x43, 0x58, 0x7B, 0xA1, 0xB8, 0xBF, 0xB4, 0x9A, 0x73, 0x53,
+  0x40, 0x41, 0x54, 0x76, 0x9D, 0xB5, 0xC0, 0xB6, 0x9E, 0x77, 0x55, 0x40,
+  0x3E, 0x50, 0x70, 0x97, 0xB1, 0xBE, 0xB5, 0x9F, 0x7A, 0x56, 0x41, 0x3D,
+  0x4D, 0x6C, 0x93, 0xAF, 0xBD, 0xB8, 0xA3, 0x7F, 0x5B, 0x43, 0x3C, 0x4B,
+  0x67, 0x8F, 0xAE, 0xBD, 0xBA, 0xA7, 0x84, 0x5E, 0x46, 0x3D, 0x4B, 0x65,
+  0x8D, 0xAD, 0xBE, 0xBD, 0xAB, 0x8B, 0x64, 0x4A, 0x3D, 0x48, 0x61, 0x88,
+  0xA9, 0xBC, 0xBE, 0xAD, 0x8F, 0x67, 0x4B, 0x3D, 0x45, 0x5E, 0x84, 0xA6,
+  0xBB, 0xBE, 0xB0, 0x93, 0x6B, 0x4E, 0x3E, 0x44, 0x5A, 0x7F, 0xA2, 0xB9,
+  0xC0, 0xB3, 0x98, 0x70, 0x51, 0x3E, 0x42, 0x57, 0x79, 0x9F, 0xB8, 0xC0,
+  0xB5, 0x9B, 0x74, 0x54, 0x3F, 0x40, 0x54, 0x74, 0x9C, 0xB5, 0xBF, 0xB7,
+  0x9F, 0x79, 0x56, 0x42, 0x40, 0x51, 0x72, 0x99, 0xB3, 0xC1, 0xB9, 0xA3,
+  0x7E, 0x59, 0x43, 0x3F, 0x4E, 0x6D, 0x95, 0xB1, 0xC0, 0xBA, 0xA7, 0x83,
+  0x5E, 0x46, 0x3D, 0x4C, 0x68, 0x90, 0xAE, 0xBF, 0xBB, 0xA9, 0x87, 0x61,
+  0x46, 0x3B, 0x48, 0x62, 0x89, 0xAA, 0xBC, 0xBC, 0xAB, 0x89, 0x63, 0x48,
+  0x3B, 0x46, 0x5E, 0x84, 0xA7, 0xBA, 0xBD, 0xAC, 0x8E, 0x67, 0x4A, 0x3C,
+  0x44, 0x5B, 0x81, 0xA4, 0xB9, 0xBF, 0xB0, 0x94, 0x6C, 0x4D, 0x3E, 0x42,
+  0x59, 0x7E, 0xA2, 0xB9, 0xC0, 0xB4, 0x99, 0x71, 0x52, 0x3F, 0x42, 0x57,
+  0x79, 0x9F, 0xB7, 0xBF, 0xB6, 0x9D, 0x75, 0x55, 0x40, 0x40, 0x53, 0x73,
+  0x9B, 0xB5, 0xC0, 0xB8, 0xA0, 0x79, 0x58, 0x42, 0x3F, 0x50, 0x6E, 0x96,
+  0xB3, 0xC1, 0xBA, 0xA4, 0x7F, 0x5B, 0x44, 0x3E, 0x4D, 0x6A, 0x93, 0xB0,
+  0xC0, 0xBB, 0xA7, 0x84, 0x5D, 0x45, 0x3D, 0x4A, 0x66, 0x8E, 0xAD, 0xBE,
+  0xBC, 0xAA, 0x89, 0x62, 0x48, 0x3C, 0x48, 0x63, 0x8A, 0xAB, 0xBE, 0xBE,
+  0xAE, 0x8E, 0x65, 0x4B, 0x3C, 0x47, 0x5F, 0x85, 0xA8, 0xBB, 0xBF, 0xB0,
+  0x91, 0x6A, 0x4D, 0x3C, 0x44, 0x5B, 0x81, 0xA5, 0xBA, 0xC0, 0xB2, 0x96,
+  0x6E, 0x4F, 0x3D, 0x41, 0x56, 0x7A, 0x9F, 0xB6, 0xBE, 0xB2, 0x99, 0x71,
+  0x51, 0x3D, 0x3F, 0x53, 0x76, 0x9C, 0xB4, 0xBF, 0xB5, 0x9D, 0x76, 0x54,
+  0x3F, 0x3E, 0x50, 0x70, 0x98, 0xB3, 0xBE, 0xB8, 0xA1, 0x7A, 0x57, 0x41,
+  0x3D, 0x50, 0x6E, 0x96, 0xB2, 0xC0, 0xBB, 0xA5, 0x80, 0x5C, 0x44, 0x3D,
+  0x4E, 0x69, 0x92, 0xAF, 0xBF, 0xBC, 0xA8, 0x86, 0x60, 0x46, 0x3D, 0x4A,
+  0x65, 0x8D, 0xAC, 0xBE, 0xBC, 0xAB, 0x8A, 0x63, 0x49, 0x3D, 0x48, 0x62,
+  0x8A, 0xAC, 0xC1, 0xC2, 0xB1, 0x91, 0x68, 0x4C, 0x3D, 0x45, 0x5E, 0x84,
+  0xA8, 0xBD, 0xC1, 0xB2, 0x95, 0x6C, 0x4F, 0x3D, 0x43, 0x59, 0x7E, 0xA4,
+  0xBB, 0xC1, 0xB4, 0x99, 0x70, 0x51, 0x3D, 0x42, 0x57, 0x7B, 0xA2, 0xB8,
+  0xC2, 0xB6, 0x9D, 0x76, 0x53, 0x3F, 0x40, 0x53, 0x75, 0x9D, 0xB6, 0xC2,
+  0xB8, 0xA0, 0x7A, 0x56, 0x41, 0x3E, 0x50, 0x71, 0x99, 0xB4, 0xC1, 0xB9,
+  0xA4, 0x7E, 0x59, 0x42, 0x3B, 0x4C, 0x6A, 0x92, 0xAF, 0xBE, 0xB9, 0xA5,
+  0x81, 0x5B, 0x42, 0x3A, 0x49, 0x65, 0x8E, 0xAD, 0xBD, 0xBB, 0xA9, 0x85,
+  0x5F, 0x45, 0x3A, 0x47, 0x61, 0x8A, 0xAB, 0xBD, 0xBD, 0xAB, 0x8B, 0x64,
+  0x47, 0x3C, 0x46, 0x60, 0x87, 0xA9, 0xBD, 0xBF, 0xAF, 0x91, 0x68, 0x4B,
+  0x3C, 0x44, 0x5C, 0x82, 0xA5, 0xBB, 0xC0, 0xB1, 0x95, 0x6C, 0x50, 0x3E,
+  0x44, 0x59, 0x7C, 0xA1, 0xB9, 0xC0, 0xB6, 0x99, 0x70, 0x4F, 0x3B, 0x3D,
+  0x42, 0x41, 0x47, 0x4C, 0x4F, 0x60, 0x61, 0x79, 0x83, 0x90, 0xA3, 0xA5,
+  0xAF, 0xAF, 0xB2, 0xB4, 0xAF, 0xAA, 0xA7, 0x9A, 0x98, 0x84, 0x78, 0x67,
+  0x3D, 0x44, 0x6D, 0x7B, 0x95, 0xB5, 0x9D, 0x7E, 0x77, 0x66, 0x61, 0x59,
+  0x50, 0x51, 0x4C, 0x4D, 0x48, 0x48, 0x4F, 0x54, 0x57, 0x5E, 0x60, 0x6E,
+  0x72, 0x81, 0x8C, 0x92, 0xA1, 0xA1, 0xAE, 0xB0, 0xB3, 0xB5, 0xB6, 0xB9,
+  0xB7, 0xB1, 0xAE, 0xA9, 0xA2, 0x9E, 0x8F, 0x8E, 0x7C, 0x79, 0x69, 0x58,
+  0x55, 0x49, 0x49, 0x44, 0x42, 0x48, 0x4F, 0x54, 0x63, 0x65, 0x7E, 0x85,
+  0x95, 0xA6, 0xA8, 0xB2, 0xB2, 0xB5, 0xB7, 0xB1, 0xAD, 0xA8, 0x9D, 0x9A,
+  0x83, 0x7A, 0x64, 0x3C, 0x4E, 0x74, 0x81, 0x9F, 0xB9, 0x9E, 0x80, 0x78,
+  0x67, 0x63, 0x59, 0x53, 0x52, 0x4D, 0x4F, 0x49, 0x4A, 0x50, 0x56, 0x59,
+  0x5F, 0x62, 0x71, 0x73, 0x83, 0x8D, 0x94, 0xA3, 0xA3, 0xB1, 0xB0, 0xB5,
+  0xB3, 0xB3, 0xB5, 0xB3, 0xAD, 0xAA, 0xA4, 0xA0, 0x9B, 0x8E, 0x8D, 0x7B,
+  0x7A, 0x65, 0x5B, 0x56, 0x4C, 0x4C, 0x47, 0x46, 0x4C, 0x51, 0x57, 0x65,
+  0x67, 0x80, 0x86, 0x96, 0xA4, 0xA7, 0xB0, 0xB0, 0xB4, 0xB5, 0xAF, 0xAD,
+  0xA6, 0x9C, 0x98, 0x83, 0x7B, 0x62, 0x3F, 0x52, 0x75, 0x81, 0xA0, 0xB5,
+  0x96, 0x7E, 0x76, 0x67, 0x63, 0x59, 0x55, 0x53, 0x50, 0x50, 0x4B, 0x4C,
+  0x52, 0x57, 0x5B, 0x61, 0x64, 0x72, 0x73, 0x83, 0x8B, 0x92, 0x9F, 0xA0,
+  0xAC, 0xAC, 0xB1, 0xB1, 0xB3, 0xB5, 0xB3, 0xAC, 0xAB, 0xA4, 0xA1, 0x99,
+  0x8E, 0x8B, 0x7A, 0x7A, 0x65, 0x5C, 0x55, 0x4C, 0x4C, 0x47, 0x47, 0x4E,
+  0x52, 0x5A, 0x66, 0x6A, 0x83, 0x87, 0x9A, 0xA6, 0xA9, 0xB2, 0xB2, 0xB5,
+  0xB7, 0xB0, 0xAD, 0xA6, 0x9C, 0x97, 0x82, 0x7B, 0x5F, 0x3F, 0x55, 0x77,
+  0x83, 0xA3, 0xB4, 0x93, 0x7E, 0x75, 0x65, 0x63, 0x58, 0x55, 0x52, 0x50,
+  0x50, 0x4B, 0x4D, 0x54, 0x57, 0x5B, 0x60, 0x65, 0x71, 0x74, 0x85, 0x89,
+  0x92, 0x9E, 0x9F, 0xAB, 0xAA, 0xAF, 0xAE, 0xB1, 0xB2, 0xB0, 0xAA, 0xA8,
+  0xA2, 0xA0, 0x98, 0x8D, 0x8A, 0x7A, 0x79, 0x64, 0x5D, 0x56, 0x4E, 0x4E,
+  0x4A, 0x4A, 0x52, 0x54, 0x5D, 0x68, 0x6D, 0x84, 0x87, 0x9B, 0xA3, 0xA8,
+  0xAF, 0xAF, 0xB2, 0xB2, 0xAC, 0xAA, 0xA1, 0x9A, 0x95, 0x80, 0x7A, 0x5D,
+  0x41, 0x59, 0x77, 0x83, 0xA3, 0xB0, 0x90, 0x7C, 0x73, 0x64, 0x62, 0x57,
+  0x54, 0x52, 0x50, 0x50, 0x4B, 0x4D, 0x54, 0x57, 0x5C, 0x60, 0x66, 0x72,
+  0x74, 0x86, 0x89, 0x95, 0x9D, 0xA1, 0xAB, 0xAB, 0xB0, 0xAE, 0xB2, 0xB3,
+  0xB0, 0xAA, 0xA9, 0xA1, 0xA0, 0x96, 0x8F, 0x8B, 0x7C, 0x7A, 0x64, 0x5F,
+  0x57, 0x50, 0x4F, 0x4B, 0x4B, 0x53, 0x55, 0x5F, 0x68, 0x6F, 0x85, 0x88,
+  0x9C, 0xA4, 0xA9, 0xB0, 0xAF, 0xB3, 0xB2, 0xAC, 0xAA, 0xA1, 0x9A, 0x92,
+  0x7D, 0x75, 0x57, 0x43, 0x5F, 0x76, 0x83, 0xA1, 0xA8, 0x8A, 0x7A, 0x72,
+  0x64, 0x63, 0x58, 0x57, 0x54, 0x53, 0x52, 0x4E, 0x50, 0x57, 0x59, 0x5E,
+  0x62, 0x67, 0x72, 0x75, 0x85, 0x88, 0x94, 0x9A, 0x9F, 0xA8, 0xA7, 0xAC,
+  0xAB, 0xAE, 0xAF, 0xAD, 0xA7, 0xA5, 0x9F, 0x9E, 0x93, 0x8D, 0x86, 0x7A,
+  0x78, 0x63, 0x61, 0x58, 0x52, 0x51, 0x4D, 0x4E, 0x56, 0x57, 0x62, 0x69,
+  0x71, 0x84, 0x87, 0x9A, 0xA0, 0xA7, 0xAB, 0xAC, 0xAE, 0xAC, 0xA6, 0xA5,
+  0x9B, 0x96, 0x8D, 0x7B, 0x76, 0x56, 0x45, 0x62, 0x79, 0x86, 0xA5, 0xA6,
+  0x87, 0x7A, 0x70, 0x65, 0x63, 0x58, 0x59, 0x55, 0x55, 0x53, 0x50, 0x52,
+  0x58, 0x5B, 0x61, 0x64, 0x6B, 0x74, 0x78, 0x89, 0x8B, 0x98, 0x9D, 0xA2,
+  0xAA, 0xAA, 0xAF, 0xAD, 0xB0, 0xB0, 0xAD, 0xA8, 0xA7, 0x9F, 0x9F, 0x93,
+  0x8F, 0x86, 0x7C, 0x77, 0x64, 0x61, 0x57, 0x53, 0x51, 0x4E, 0x50, 0x57,
+  0x59, 0x64, 0x69, 0x74, 0x84, 0x86, 0x99, 0x9D, 0xA3, 0xA7, 0xA8, 0xAB,
+  0xAA, 0xA4, 0xA2, 0x99, 0x95, 0x8C, 0x7C, 0x75, 0x56, 0x49, 0x66, 0x7A,
+  0x87, 0xA5, 0xA3, 0x85, 0x7B, 0x70, 0x67, 0x64, 0x5B, 0x5B, 0x57, 0x57,
+  0x55, 0x53, 0x56, 0x5C, 0x5F, 0x64, 0x66, 0x6F, 0x76, 0x7B, 0x89, 0x8A,
+  0x97, 0x9A, 0xA1, 0xA7, 0xA7, 0xAB, 0xAA, 0xAD, 0xAD, 0xAA, 0xA5, 0xA3,
+  0x9D, 0x9C, 0x91, 0x8E, 0x84, 0x7B, 0x76, 0x64, 0x62, 0x58, 0x54, 0x52,
+  0x4F, 0x51, 0x58, 0x59, 0x66, 0x69, 0x75, 0x83, 0x89, 0x9B, 0x9D, 0xA5,
+  0xA7, 0xA8, 0xAB, 0xA9, 0xA3, 0xA3, 0x99, 0x95, 0x8A, 0x7C, 0x74, 0x54,
+  0x4A, 0x69, 0x7B, 0x8A, 0xA7, 0xA1, 0x84, 0x7B, 0x70, 0x68, 0x66, 0x5C,
+  0x5D, 0x59, 0x59, 0x56, 0x54, 0x58, 0x5D, 0x5F, 0x65, 0x67, 0x70, 0x76,
+  0x7D, 0x8A, 0x8B, 0x99, 0x9A, 0xA3, 0xA7, 0xA9, 0xAC, 0xAB, 0xAD, 0xAE,
+  0xA9, 0xA1, 0x9F, 0x98, 0x98, 0x8C, 0x8A, 0x81, 0x7A, 0x73, 0x63, 0x62,
+  0x59, 0x56, 0x54, 0x51, 0x54, 0x5A, 0x5B, 0x67, 0x6A, 0x77, 0x83, 0x88,
+  0x99, 0x9B, 0xA2, 0xA4, 0xA6, 0xA8, 0xA5, 0xA1, 0x9F, 0x96, 0x94, 0x87,
+  0x7B, 0x71, 0x53, 0x52, 0x6F, 0x7D, 0x8E, 0xA6, 0x9D, 0x83, 0x7B, 0x70,
+  0x6A, 0x66, 0x5E, 0x5E, 0x5A, 0x5B, 0x57, 0x56, 0x5A, 0x5F, 0x61, 0x67,
+  0x68, 0x71, 0x76, 0x7C, 0x89, 0x8A, 0x97, 0x98, 0xA0, 0xA3, 0xA5, 0xA6,
+  0xA6, 0xA9, 0xA8, 0xA4, 0xA0, 0x9E, 0x98, 0x97, 0x8B, 0x8B, 0x7F, 0x7A,
+  0x71, 0x63, 0x62, 0x59, 0x57, 0x54, 0x52, 0x55, 0x5B, 0x5D, 0x69, 0x6A,
+  0x7A, 0x83, 0x8B, 0x9B, 0x9C, 0xA4, 0xA5, 0xA7, 0xA9, 0xA6, 0xA2, 0xA1,
+  0x98, 0x95, 0x87, 0x7E, 0x72, 0x53, 0x55, 0x71, 0x7F, 0x90, 0xA9, 0x9A,
+  0x82, 0x7C, 0x6F, 0x6A, 0x65, 0x5F, 0x5E, 0x5B, 0x5C, 0x58, 0x57, 0x5B,
+  0x60, 0x62, 0x67, 0x69, 0x72, 0x75, 0x7D, 0x87, 0x89, 0x95, 0x95, 0x9E,
+  0x9F, 0xA2, 0xA3, 0xA3, 0xA6, 0xA5, 0xA1, 0x9E, 0x9C, 0x97, 0x95, 0x8B,
+  0x89, 0x7E, 0x7B, 0x71, 0x65, 0x63, 0x5B, 0x5A, 0x57, 0x56, 0x5A, 0x5E,
+  0x61, 0x6B, 0x6D, 0x7D, 0x84, 0x8C, 0x9A, 0x9C, 0xA3, 0xA3, 0xA4, 0xA7,
+  0xA3, 0xA0, 0x9E, 0x95, 0x93, 0x85, 0x7D, 0x70, 0x55, 0x59, 0x73, 0x7E,
+  0x91, 0xA5, 0x96, 0x81, 0x7B, 0x6F, 0x6B, 0x66, 0x60, 0x61, 0x5D, 0x5D,
+  0x59, 0x58, 0x5D, 0x60, 0x62, 0x67, 0x69, 0x73, 0x75, 0x7F, 0x87, 0x89,
+  0x95, 0x95, 0x9D, 0x9F, 0xA2, 0xA3, 0xA3, 0xA6, 0xA5, 0xA1, 0x9F, 0x9B,
+  0x97, 0x95, 0x8A, 0x8A, 0x7E, 0x7B, 0x70, 0x66, 0x63, 0x5B, 0x5B, 0x58,
+  0x58, 0x5C, 0x60, 0x63, 0x6E, 0x6F, 0x80, 0x85, 0x90, 0x9B, 0x9C, 0xA4,
+  0xA4, 0xA6, 0xA7, 0xA3, 0xA0, 0x9D, 0x94, 0x93, 0x84, 0x7D, 0x6F, 0x53,
+  0x5B, 0x72, 0x79, 0x89, 0x98, 0x8B, 0x7C, 0x77, 0x6D, 0x6B, 0x66, 0x62,
+  0x62, 0x5F, 0x60, 0x5D, 0x5E, 0x61, 0x64, 0x66, 0x69, 0x6C, 0x73, 0x75,
+  0x7E, 0x83, 0x87, 0x8F, 0x90, 0x97, 0x97, 0x99, 0x9A, 0x9B, 0x9C, 0x9C,
+  0x98, 0x97, 0x94, 0x91, 0x8F, 0x87, 0x87, 0x7E, 0x7C, 0x72, 0x6B, 0x68,
+  0x62, 0x61, 0x5F, 0x5E, 0x62, 0x64, 0x68, 0x70, 0x72, 0x80, 0x83, 0x8D,
+  0x95, 0x96, 0x9C, 0x9C, 0x9E, 0x9E, 0x9B, 0x99, 0x96, 0x90, 0x8E, 0x82,
+  0x7D, 0x6E, 0x5A, 0x64, 0x78, 0x7F, 0x90, 0x9C, 0x8D, 0x7E, 0x79, 0x70,
+  0x6E, 0x68, 0x65, 0x65, 0x62, 0x63, 0x5F, 0x60, 0x64, 0x67, 0x69, 0x6C,
+  0x6E, 0x77, 0x78, 0x81, 0x86, 0x8A, 0x92, 0x92, 0x99, 0x9A, 0x9D, 0x9D,
+  0x9E, 0xA0, 0xA0, 0x9B, 0x9B, 0x97, 0x95, 0x90, 0x8B, 0x88, 0x7F, 0x7D,
+  0x72, 0x6C, 0x6A, 0x66, 0x68, 0x66, 0x67, 0x6B, 0x6C, 0x6F, 0x74, 0x77,
+  0x80, 0x8B, 0x9F, 0xC3, 0xD9, 0xE1, 0xE9, 0xEE, 0xE5, 0xD8, 0xC8, 0xB3,
+  0xA1, 0x94, 0x8B, 0x8B, 0x95, 0x9E, 0xAA, 0xB6, 0xC3, 0xBD, 0xB3, 0xAB,
+  0xA2, 0x72, 0x49, 0x37, 0x34, 0x52, 0x61, 0x6B, 0x87, 0xB7, 0xCB, 0xD8,
+  0xC8, 0xB2, 0xAB, 0x99, 0x77, 0x56, 0x4A, 0x3B, 0x30, 0x35, 0x45, 0x54,
+  0x6B, 0x7E, 0x8B, 0x8D, 0x89, 0x7F, 0x71, 0x5D, 0x48, 0x37, 0x2F, 0x31,
+  0x39, 0x47, 0x68, 0x8F, 0xA1, 0xAF, 0xBF, 0xC0, 0xB1, 0xA5, 0x97, 0x83,
+  0x73, 0x6F, 0x76, 0x7F, 0x8C, 0xA7, 0xC3, 0xD2, 0xDC, 0xE2, 0xDD, 0xD1,
+  0xBA, 0x98, 0x80, 0x71, 0x65, 0x62, 0x6D, 0x79, 0x86, 0x96, 0xA6, 0xAB,
+  0xA3, 0x9A, 0x90, 0x70, 0x46, 0x33, 0x26, 0x19, 0x16, 0x25, 0x34, 0x4A,
+  0x62, 0x72, 0x7E, 0x85, 0x80, 0x74, 0x6B, 0x5B, 0x4A, 0x40, 0x4A, 0x55,
+  0x5E, 0x76, 0xA3, 0xBF, 0xCC, 0xD9, 0xDE, 0xD3, 0xC4, 0xAF, 0x94, 0x80,
+  0x74, 0x69, 0x6A, 0x77, 0x82, 0x94, 0xA5, 0xB2, 0xAC, 0x9F, 0x97, 0x87,
+  0x4E, 0x29, 0x1A, 0x1C, 0x3D, 0x4B, 0x57, 0x7A, 0xA8, 0xB8, 0xC4, 0xB1,
+  0x9F, 0x97, 0x85, 0x64, 0x49, 0x3F, 0x2F, 0x27, 0x2C, 0x3B, 0x4C, 0x63,
+  0x75, 0x82, 0x82, 0x7E, 0x75, 0x67, 0x54, 0x41, 0x33, 0x2C, 0x2E, 0x36,
+  0x45, 0x65, 0x8A, 0x9C, 0xAA, 0xB9, 0xB8, 0xA9, 0x9D, 0x8F, 0x7B, 0x6B,
+  0x69, 0x70, 0x7A, 0x8B, 0xA7, 0xC3, 0xD2, 0xDC, 0xE2, 0xDC, 0xCE, 0xB6,
+  0x93, 0x7B, 0x6C, 0x61, 0x61, 0x6D, 0x79, 0x86, 0x98, 0xA8, 0xAA, 0xA3,
+  0x9B, 0x8F, 0x6D, 0x44, 0x32, 0x25, 0x17, 0x19, 0x27, 0x38, 0x50, 0x67,
+  0x77, 0x83, 0x88, 0x81, 0x75, 0x6A, 0x5A, 0x48, 0x41, 0x4B, 0x56, 0x5F,
+  0x7B, 0xA8, 0xC1, 0xCE, 0xDB, 0xDF, 0xD3, 0xC3, 0xAB, 0x92, 0x80, 0x73,
+  0x6B, 0x6F, 0x7D, 0x8A, 0x9B, 0xAC, 0xB7, 0xB0, 0xA3, 0x9A, 0x87, 0x4C,
+  0x2C, 0x1C, 0x23, 0x41, 0x4F, 0x5C, 0x83, 0xAE, 0xBD, 0xC9, 0xB4, 0xA4,
+  0x9A, 0x86, 0x64, 0x4B, 0x3F, 0x30, 0x29, 0x30, 0x41, 0x52, 0x6B, 0x7D,
+  0x88, 0x89, 0x84, 0x78, 0x6A, 0x56, 0x41, 0x33, 0x2D, 0x30, 0x3A, 0x4A,
+  0x6E, 0x91, 0xA2, 0xAF, 0xBC, 0xB9, 0xAB, 0x9F, 0x8E, 0x7A, 0x6C, 0x6B,
+  0x72, 0x7D, 0x8E, 0xAC, 0xC6, 0xD3, 0xDE, 0xE2, 0xDA, 0xCD, 0xB2, 0x90,
+  0x7B, 0x6D, 0x63, 0x64, 0x70, 0x7E, 0x8C, 0x9E, 0xAE, 0xB0, 0xA8, 0xA0,
+  0x93, 0x6D, 0x45, 0x35, 0x27, 0x1A, 0x1C, 0x2C, 0x3E, 0x58, 0x6E, 0x7D,
+  0x89, 0x8D, 0x84, 0x78, 0x6B, 0x5A, 0x47, 0x42, 0x4D, 0x57, 0x62, 0x80,
+  0xAD, 0xC3, 0xD1, 0xDC, 0xDE, 0xD1, 0xBF, 0xA8, 0x8E, 0x7C, 0x71, 0x69,
+  0x70, 0x7E, 0x8C, 0x9E, 0xB0, 0xBA, 0xB1, 0xA6, 0x9E, 0x86, 0x4B, 0x2F,
+  0x1E, 0x2C, 0x48, 0x53, 0x62, 0x8B, 0xB4, 0xC3, 0xCB, 0xB3, 0xA7, 0x9C,
+  0x86, 0x62, 0x4B, 0x3E, 0x2F, 0x2A, 0x35, 0x45, 0x59, 0x72, 0x83, 0x8F,
+  0x8E, 0x89, 0x7C, 0x6C, 0x56, 0x42, 0x33, 0x2D, 0x31, 0x3C, 0x4F, 0x75,
+  0x96, 0xA5, 0xB4, 0xC0, 0xB9, 0xAA, 0x9D, 0x8A, 0x76, 0x68, 0x68, 0x6F,
+  0x7B, 0x8E, 0xAD, 0xC6, 0xD4, 0xDE, 0xE0, 0xD7, 0xC8, 0xAD, 0x8C, 0x77,
+  0x68, 0x60, 0x63, 0x71, 0x7E, 0x8F, 0xA3, 0xB2, 0xB3, 0xAB, 0xA3, 0x93,
+  0x6B, 0x45, 0x34, 0x26, 0x1B, 0x21, 0x32, 0x44, 0x5F, 0x77, 0x86, 0x90,
+  0x92, 0x88, 0x7C, 0x6D, 0x59, 0x48, 0x43, 0x4D, 0x57, 0x64, 0x86, 0xB1,
+  0xC5, 0xD2, 0xDC, 0xDC, 0xCE, 0xBC, 0xA2, 0x89, 0x78, 0x6C, 0x66, 0x6F,
+  0x7C, 0x8C, 0xA0, 0xB1, 0xB8, 0xB0, 0xA5, 0x9D, 0x81, 0x49, 0x2F, 0x20,
+  0x2E, 0x48, 0x53, 0x63, 0x8F, 0xB5, 0xC4, 0xCB, 0xB4, 0xA9, 0x9D, 0x84,
+  0x5F, 0x4A, 0x3B, 0x29, 0x23, 0x2F, 0x41, 0x59, 0x75, 0x89, 0x95, 0x93,
+  0x8C, 0x7C, 0x74, 0x77, 0x77, 0x78, 0x7C, 0x7E, 0x7E, 0x81, 0x89, 0x8C,
+  0x8B, 0x92, 0x9D, 0x9E, 0x9C, 0xA5, 0xAC, 0xAA, 0xAB, 0xB2, 0xB5, 0xB2,
+  0xB2, 0xB4, 0xB4, 0xB2, 0xB3, 0xB4, 0xB2, 0xB1, 0xAC, 0xA8, 0xA7, 0xA4,
+  0x9F, 0x9D, 0x9D, 0x97, 0x8D, 0x8C, 0x8B, 0x81, 0x79, 0x7A, 0x77, 0x67,
+  0x60, 0x62, 0x5F, 0x56, 0x55, 0x57, 0x54, 0x52, 0x52, 0x54, 0x59, 0x5D,
+  0x5E, 0x62, 0x6B, 0x70, 0x6E, 0x78, 0x87, 0x8A, 0x88, 0x96, 0xA1, 0x9F,
+  0xA0, 0xA6, 0xA9, 0xA7, 0xA8, 0xA9, 0xA9, 0xA7, 0xA4, 0x9E, 0x9E, 0x9A,
+  0x94, 0x8D, 0x8E, 0x88, 0x79, 0x71, 0x75, 0x63, 0x47, 0x47, 0x45, 0x60,
+  0x77, 0x77, 0x7C, 0x98, 0xA2, 0xA2, 0x99, 0x79, 0x75, 0x75, 0x6D, 0x62,
+  0x63, 0x62, 0x5B, 0x55, 0x58, 0x58, 0x55, 0x55, 0x57, 0x56, 0x52, 0x54,
+  0x54, 0x5A, 0x5E, 0x5F, 0x60, 0x65, 0x68, 0x68, 0x6D, 0x76, 0x79, 0x77,
+  0x80, 0x8C, 0x8B, 0x8B, 0x94, 0x99, 0x98, 0x9A, 0xA1, 0xA3, 0xA2, 0xA3,
+  0xA5, 0xA5, 0xA3, 0xA5, 0xA6, 0xA4, 0xA3, 0x9F, 0x9B, 0x9B, 0x98, 0x93,
+  0x92, 0x92, 0x8C, 0x83, 0x83, 0x82, 0x79, 0x72, 0x73, 0x70, 0x61, 0x5B,
+  0x5E, 0x5A, 0x52, 0x52, 0x54, 0x51, 0x50, 0x50, 0x53, 0x58, 0x5B, 0x5C,
+  0x60, 0x6A, 0x6D, 0x6D, 0x78, 0x85, 0x86, 0x86, 0x93, 0x9D, 0x9B, 0x9D,
+  0xA2, 0xA4, 0xA2, 0xA4, 0xA5, 0xA5, 0xA3, 0xA0, 0x9B, 0x9C, 0x99, 0x92,
+  0x8C, 0x8F, 0x86, 0x78, 0x73, 0x77, 0x63, 0x4B, 0x4C, 0x4C, 0x69, 0x79,
+  0x78, 0x7E, 0x98, 0x9F, 0xA0, 0x92, 0x78, 0x77, 0x75, 0x6D, 0x63, 0x66,
+  0x63, 0x5D, 0x58, 0x5B, 0x5A, 0x58, 0x57, 0x59, 0x58, 0x55, 0x56, 0x57,
+  0x5C, 0x60, 0x61, 0x63, 0x67, 0x6A, 0x6A, 0x6F, 0x78, 0x7A, 0x7B, 0x83,
+  0x8D, 0x8C, 0x8E, 0x97, 0x9B, 0x9A, 0x9C, 0xA4, 0xA5, 0xA4, 0xA5, 0xA7,
+  0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA1, 0x9D, 0x9B, 0x9B, 0x98, 0x94, 0x93,
+  0x92, 0x8B, 0x85, 0x85, 0x83, 0x7A, 0x74, 0x76, 0x71, 0x62, 0x60, 0x61,
+  0x5D, 0x56, 0x57, 0x58, 0x56, 0x54, 0x55, 0x57, 0x5C, 0x5F, 0x5F, 0x65,
+  0x6D, 0x6F, 0x6F, 0x7A, 0x85, 0x85, 0x88, 0x95, 0x9B, 0x99, 0x9C, 0xA1,
+  0xA2, 0xA0, 0xA2, 0xA4, 0xA3, 0xA2, 0x9F, 0x9B, 0x9C, 0x98, 0x91, 0x8D,
+  0x8F, 0x86, 0x7B, 0x76, 0x7A, 0x64, 0x50, 0x50, 0x53, 0x6F, 0x7C, 0x7B,
+  0x83, 0x9C, 0xA0, 0xA1, 0x91, 0x7A, 0x7A, 0x78, 0x70, 0x68, 0x6A, 0x67,
+  0x60, 0x5D, 0x5F, 0x5D, 0x5B, 0x5B, 0x5D, 0x5A, 0x59, 0x5A, 0x5B, 0x60,
+  0x62, 0x64, 0x66, 0x6A, 0x6C, 0x6B, 0x71, 0x79, 0x79, 0x7B, 0x84, 0x8C,
+  0x8A, 0x8D, 0x96, 0x99, 0x97, 0x9B, 0xA2, 0xA2, 0xA1, 0xA3, 0xA5, 0xA4,
+  0xA4, 0xA6, 0xA7, 0xA6, 0xA4, 0x9F, 0x9D, 0x9C, 0x99, 0x95, 0x95, 0x93,
+  0x8C, 0x87, 0x85, 0x80, 0x79, 0x75, 0x76, 0x70, 0x66, 0x65, 0x66, 0x62,
+  0x5D, 0x5E, 0x5F, 0x5C, 0x5C, 0x5D, 0x5E, 0x62, 0x65, 0x64, 0x6A, 0x70,
+  0x71, 0x71, 0x7B, 0x83, 0x82, 0x85, 0x90, 0x94, 0x93, 0x96, 0x99, 0x9A,
+  0x98, 0x9A, 0x9B, 0x9A, 0x99, 0x96, 0x94, 0x94, 0x91, 0x8C, 0x89, 0x8B,
+  0x83, 0x79, 0x77, 0x79, 0x65, 0x59, 0x5A, 0x5D, 0x74, 0x7D, 0x7C, 0x85,
+  0x98, 0x99, 0x9A, 0x8C, 0x7B, 0x7C, 0x79, 0x72, 0x6C, 0x6F, 0x6C, 0x67,
+  0x65, 0x67, 0x65, 0x64, 0x64, 0x66, 0x63, 0x62, 0x63, 0x64, 0x69, 0x6A,
+  0x6A, 0x6B, 0x6E, 0x70, 0x6F, 0x75, 0x7A, 0x7A, 0x7B, 0x84, 0x89, 0x87,
+  0x8A, 0x91, 0x94, 0x92, 0x96, 0x9A, 0x9A, 0x99, 0x9B, 0x9C, 0x9B, 0x9C,
+  0x9E, 0x9D, 0x9C, 0x9B, 0x97, 0x96, 0x96, 0x93, 0x90, 0x90, 0x8F, 0x89,
+  0x86, 0x87, 0x84, 0x7C, 0x79, 0x7B, 0x74, 0x6A, 0x6A, 0x69, 0x64, 0x61,
+  0x62, 0x62, 0x60, 0x40, 0x15, 0x0F, 0x31, 0x69, 0x8D, 0x93, 0x73, 0x42,
+  0x2A, 0x3E, 0x72, 0x9F, 0xB0, 0xA5, 0x78, 0x50, 0x4D, 0x70, 0xA6, 0xC5,
+  0xC2, 0x97, 0x64, 0x4F, 0x5D, 0x8C, 0xB9, 0xC1, 0xA2, 0x6C, 0x48, 0x41,
+  0x60, 0x94, 0xAE, 0x93, 0x5C, 0x2C, 0x22, 0x4B, 0x85, 0xAD, 0xBC, 0xAB,
+  0x75, 0x57, 0x50, 0x6F, 0xA1, 0xB3, 0x9E, 0x6A, 0x41, 0x33, 0x49, 0x7D,
+  0xA4, 0xA2, 0x7B, 0x45, 0x2B, 0x35, 0x64, 0x95, 0xA6, 0x94, 0x63, 0x3A,
+  0x35, 0x5A, 0x90, 0xB0, 0xAE, 0x8A, 0x58, 0x43, 0x5A, 0x90, 0xBB, 0xC7,
+  0xB2, 0x80, 0x5A, 0x5C, 0x86, 0xB9, 0xD1, 0xC8, 0x9E, 0x6D, 0x5C, 0x74,
+  0xA7, 0xCD, 0xD1, 0xB0, 0x7B, 0x5A, 0x5D, 0x85, 0xB5, 0xC9, 0xB5, 0x82,
+  0x55, 0x48, 0x5E, 0x91, 0xB4, 0xAE, 0x84, 0x4E, 0x31, 0x39, 0x65, 0x97,
+  0xA5, 0x91, 0x5E, 0x33, 0x2F, 0x54, 0x8B, 0xAA, 0xAA, 0x87, 0x54, 0x3F,
+  0x59, 0x8F, 0xBA, 0xC6, 0xB4, 0x81, 0x5B, 0x5B, 0x84, 0xB9, 0xD3, 0xCB,
+  0x9E, 0x6B, 0x5A, 0x6D, 0x9F, 0xC6, 0xC9, 0xA8, 0x72, 0x50, 0x4E, 0x74,
+  0xA5, 0xB9, 0x9B, 0x66, 0x35, 0x31, 0x5C, 0x94, 0xB8, 0xC3, 0xAB, 0x74,
+  0x57, 0x54, 0x7C, 0xAD, 0xBB, 0xA2, 0x6B, 0x42, 0x38, 0x55, 0x8B, 0xAC,
+  0xA8, 0x7D, 0x47, 0x2F, 0x3D, 0x72, 0xA0, 0xAD, 0x97, 0x62, 0x3B, 0x3B,
+  0x64, 0x9B, 0xB6, 0xB1, 0x87, 0x54, 0x45, 0x60, 0x96, 0xBE, 0xC7, 0xAD,
+  0x79, 0x57, 0x5E, 0x8A, 0xBC, 0xD2, 0xC5, 0x96, 0x66, 0x5A, 0x76, 0xAA,
+  0xCD, 0xCE, 0xA8, 0x72, 0x55, 0x5C, 0x88, 0xB7, 0xC7, 0xB0, 0x7A, 0x50,
+  0x47, 0x61, 0x96, 0xB6, 0xAC, 0x7E, 0x49, 0x32, 0x3D, 0x6E, 0x9D, 0xA8,
+  0x8C, 0x57, 0x31, 0x31, 0x5B, 0x91, 0xAD, 0xA7, 0x7F, 0x4D, 0x3D, 0x5A,
+  0x92, 0xBB, 0xC5, 0xAF, 0x7A, 0x58, 0x5E, 0x8B, 0xBE, 0xD4, 0xC7, 0x96,
+  0x67, 0x59, 0x70, 0xA2, 0xC4, 0xC4, 0x9E, 0x68, 0x49, 0x4D, 0x78, 0xA9,
+  0xB7, 0x98, 0x60, 0x33, 0x33, 0x60, 0x99, 0xBA, 0xC1, 0xA1, 0x6A, 0x50,
+  0x54, 0x80, 0xAF, 0xB9, 0x9C, 0x65, 0x3E, 0x38, 0x5B, 0x92, 0xAF, 0xA5,
+  0x77, 0x43, 0x2F, 0x43, 0x79, 0xA4, 0xAD, 0x91, 0x5B, 0x38, 0x3C, 0x69,
+  0x9E, 0xB6, 0xAC, 0x7D, 0x4D, 0x41, 0x61, 0x99, 0xBF, 0xC3, 0xA4, 0x6E,
+  0x4F, 0x5C, 0x8D, 0xBD, 0xCF, 0xBD, 0x8A, 0x5D, 0x55, 0x75, 0xAB, 0xCC,
+  0xC8, 0x9F, 0x69, 0x50, 0x5C, 0x8C, 0xBB, 0xC5, 0xAB, 0x73, 0x4B, 0x47,
+  0x67, 0x9C, 0xB7, 0xAB, 0x7A, 0x46, 0x31, 0x42, 0x76, 0xA2, 0xA9, 0x8A,
+  0x53, 0x30, 0x35, 0x61, 0x97, 0xAF, 0xA5, 0x78, 0x48, 0x3D, 0x5C, 0x94,
+  0xBB, 0xC2, 0xA4, 0x6E, 0x50, 0x5A, 0x8A, 0xBD, 0xD0, 0xBE, 0x8A, 0x5C,
+  0x53, 0x70, 0xA6, 0xC7, 0xC3, 0x98, 0x63, 0x49, 0x50, 0x7E, 0xAE, 0xB7,
+  0x93, 0x5B, 0x31, 0x36, 0x64, 0x9D, 0xBB, 0xBB, 0x93, 0x5E, 0x48, 0x53,
+  0x85, 0xB2, 0xB9, 0x98, 0x60, 0x3C, 0x3C, 0x64, 0x9B, 0xB4, 0xA6, 0x75,
+  0x42, 0x33, 0x4B, 0x84, 0xAB, 0xB0, 0x8F, 0x57, 0x38, 0x40, 0x70, 0xA5,
+  0xB8, 0xA9, 0x76, 0x49, 0x40, 0x62, 0x9C, 0xBE, 0xBF, 0x99, 0x62, 0x49,
+  0x57, 0x8B, 0xBB, 0xCA, 0xB3, 0x7C, 0x52, 0x4E, 0x74, 0xAB, 0xC9, 0xC1,
+  0x95, 0x5F, 0x49, 0x5C, 0x90, 0xBB, 0xC3, 0xA5, 0x6C, 0x46, 0x45, 0x6D,
+  0xA3, 0xBB, 0xAB, 0x78, 0x46, 0x35, 0x4C, 0x83, 0xAC, 0xAF, 0x8C, 0x54,
+  0x34, 0x3C, 0x6D, 0xA1, 0xB5, 0xA7, 0x74, 0x45, 0x3D, 0x60, 0x99, 0xBD,
+  0xBE, 0x9B, 0x64, 0x48, 0x58, 0x8B, 0xBC, 0xCA, 0xB4, 0x7D, 0x52, 0x4D,
+  0x6F, 0xA6, 0xC4, 0xBC, 0x8E, 0x5A, 0x42, 0x51, 0x84, 0xB2, 0xB7, 0x92,
+  0x59, 0x32, 0x3C, 0x6D, 0xA4, 0xC0, 0xBC, 0x8E, 0x5A, 0x48, 0x58, 0x90,
+  0xB9, 0xBD, 0x94, 0x60, 0x50, 0x4D, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x52,
+  0x53, 0x54, 0x55, 0x56, 0x58, 0x5A, 0x5B, 0x5D, 0x5F, 0x60, 0x61, 0x63,
+  0x65, 0x67, 0x68, 0x6A, 0x6D, 0x6E, 0x6F, 0x71, 0x74, 0x74, 0x75, 0x78,
+  0x79, 0x79, 0x7A, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7B, 0x7C, 0x7B, 0x7A, 0x79, 0x7A,
+  0x7A, 0x77, 0x75, 0x76, 0x75, 0x74, 0x74, 0x75, 0x74, 0x75, 0x75, 0x76,
+  0x76, 0x78, 0x78, 0x79, 0x7C, 0x7D, 0x7D, 0x80, 0x83, 0x83, 0x84, 0x87,
+  0x89, 0x89, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x89,
+  0x8A, 0x89, 0x88, 0x86, 0x87, 0x85, 0x82, 0x80, 0x81, 0x7D, 0x77, 0x78,
+  0x77, 0x7D, 0x83, 0x83, 0x83, 0x8A, 0x8D, 0x8D, 0x8A, 0x84, 0x83, 0x83,
+  0x82, 0x7F, 0x80, 0x7F, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7D, 0x7F, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x83, 0x82, 0x83, 0x84,
+  0x85, 0x84, 0x86, 0x87, 0x86, 0x87, 0x88, 0x89, 0x88, 0x89, 0x89, 0x8A,
+  0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x8A, 0x89, 0x89, 0x88, 0x89,
+  0x88, 0x87, 0x88, 0x88, 0x87, 0x85, 0x86, 0x85, 0x84, 0x83, 0x84, 0x83,
+  0x81, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
+  0x81, 0x82, 0x82, 0x83, 0x84, 0x83, 0x84, 0x86, 0x87, 0x87, 0x88, 0x89,
+  0x89, 0x88, 0x89, 0x8A, 0x89, 0x8A, 0x8A, 0x89, 0x8A, 0x89, 0x88, 0x89,
+  0x88, 0x87, 0x86, 0x87, 0x85, 0x84, 0x83, 0x84, 0x81, 0x7E, 0x7E, 0x7D,
+  0x80, 0x82, 0x82, 0x83, 0x86, 0x87, 0x87, 0x85, 0x82, 0x82, 0x81, 0x80,
+  0x7F, 0x80, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E,
+  0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83, 0x84,
+  0x83, 0x85, 0x86, 0x85, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83,
+  0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81,
+  0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
+  0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81,
+  0x80, 0x81, 0x7F, 0x83, 0x9A, 0x99, 0x9B, 0xAF, 0xCC, 0xE5, 0xEC, 0xE6,
+  0xCF, 0xAD, 0x91, 0x85, 0x88, 0x9C, 0xB8, 0xCE, 0xD5, 0xCE, 0xB8, 0x99,
+  0x80, 0x76, 0x7C, 0x93, 0xB3, 0xCC, 0xD3, 0xC9, 0xAF, 0x8B, 0x71, 0x67,
+  0x70, 0x8B, 0xB0, 0xC8, 0xCE, 0xC3, 0xA4, 0x7E, 0x63, 0x5B, 0x66, 0x85,
+  0xAC, 0xC4, 0xC8, 0xBB, 0x99, 0x71, 0x56, 0x4F, 0x5D, 0x7F, 0xA7, 0xBE,
+  0xC1, 0xB2, 0x8F, 0x67, 0x4D, 0x49, 0x5B, 0x7F, 0xA4, 0xBA, 0xBC, 0xAA,
+  0x86, 0x5E, 0x46, 0x44, 0x58, 0x7D, 0xA1, 0xB6, 0xB6, 0xA2, 0x7D, 0x57,
+  0x41, 0x41, 0x57, 0x7D, 0xA1, 0xB3, 0xB1, 0x9C, 0x75, 0x50, 0x3D, 0x3F,
+  0x56, 0x7D, 0xA0, 0xAF, 0xAD, 0x95, 0x6E, 0x4A, 0x38, 0x3C, 0x56, 0x7E,
+  0xA0, 0xAD, 0xA9, 0x91, 0x68, 0x47, 0x37, 0x3D, 0x58, 0x80, 0xA1, 0xAD,
+  0xA7, 0x8C, 0x64, 0x43, 0x35, 0x3E, 0x5B, 0x84, 0xA3, 0xAD, 0xA5, 0x89,
+  0x62, 0x43, 0x37, 0x42, 0x5F, 0x87, 0xA4, 0xAD, 0xA3, 0x85, 0x5D, 0x3D,
+  0x34, 0x41, 0x62, 0x8B, 0xA7, 0xAD, 0xA1, 0x82, 0x58, 0x3C, 0x35, 0x43,
+  0x66, 0x8E, 0xA8, 0xAC, 0xA0, 0x7E, 0x55, 0x3B, 0x36, 0x46, 0x69, 0x92,
+  0xA8, 0xAC, 0x9D, 0x7A, 0x52, 0x39, 0x36, 0x49, 0x6E, 0x95, 0xAB, 0xAC,
+  0x9B, 0x77, 0x50, 0x39, 0x38, 0x4C, 0x72, 0x99, 0xAC, 0xAC, 0x9A, 0x74,
+  0x4E, 0x38, 0x39, 0x51, 0x77, 0x9D, 0xAE, 0xAD, 0x99, 0x71, 0x4C, 0x39,
+  0x3D, 0x55, 0x7D, 0xA1, 0xB0, 0xAD, 0x96, 0x6E, 0x4B, 0x39, 0x3E, 0x59,
+  0x82, 0xA4, 0xB1, 0xAC, 0x93, 0x6B, 0x49, 0x39, 0x40, 0x5D, 0x86, 0xA6,
+  0xB2, 0xAB, 0x8F, 0x67, 0x45, 0x37, 0x41, 0x60, 0x88, 0xA7, 0xB1, 0xA9,
+  0x8C, 0x63, 0x44, 0x39, 0x44, 0x63, 0x8C, 0xAA, 0xB3, 0xA8, 0x89, 0x60,
+  0x42, 0x39, 0x47, 0x68, 0x91, 0xAD, 0xB3, 0xA7, 0x86, 0x5D, 0x42, 0x3B,
+  0x4B, 0x6F, 0x97, 0xB0, 0xB5, 0xA6, 0x83, 0x5A, 0x3F, 0x3B, 0x4C, 0x71,
+  0x9A, 0xB1, 0xB4, 0xA4, 0x81, 0x58, 0x40, 0x3D, 0x50, 0x76, 0x9D, 0xB3,
+  0xB4, 0xA2, 0x7C, 0x56, 0x3F, 0x3E, 0x53, 0x7A, 0xA1, 0xB3, 0xB4, 0x9F,
+  0x79, 0x52, 0x3D, 0x3F, 0x56, 0x7E, 0xA3, 0xB5, 0xB2, 0x9D, 0x75, 0x50,
+  0x3C, 0x41, 0x5A, 0x83, 0xA7, 0xB6, 0xB3, 0x9B, 0x72, 0x4D, 0x3D, 0x43,
+  0x5E, 0x87, 0xAA, 0xB7, 0xB2, 0x98, 0x6F, 0x4D, 0x3E, 0x46, 0x63, 0x8C,
+  0xAD, 0xB9, 0xB2, 0x95, 0x6C, 0x4B, 0x3E, 0x48, 0x67, 0x91, 0xAF, 0xB9,
+  0xB0, 0x92, 0x69, 0x49, 0x3E, 0x4A, 0x6B, 0x95, 0xB1, 0xBA, 0xAE, 0x8E,
+  0x65, 0x47, 0x3F, 0x4D, 0x6E, 0x97, 0xB2, 0xB7, 0xAA, 0x89, 0x5F, 0x44,
+  0x3E, 0x4D, 0x71, 0x9A, 0xB4, 0xB7, 0xA9, 0x85, 0x5C, 0x43, 0x3F, 0x50,
+  0x76, 0x9F, 0xB5, 0xB8, 0xA7, 0x83, 0x5B, 0x43, 0x40, 0x54, 0x7B, 0xA2,
+  0xB7, 0xB8, 0xA6, 0x81, 0x59, 0x40, 0x3F, 0x55, 0x7D, 0xA4, 0xB7, 0xB7,
+  0xA2, 0x7B, 0x54, 0x3F, 0x41, 0x59, 0x82, 0xA8, 0xB9, 0xB6, 0xA0, 0x77,
+  0x52, 0x3F, 0x43, 0x5D, 0x86, 0xAB, 0xB9, 0xB5, 0x9C, 0x74, 0x4F, 0x3F,
+  0x45, 0x61, 0x8B, 0xAD, 0xB9, 0xB4, 0x99, 0x6F, 0x4C, 0x3E, 0x46, 0x64,
+  0x8E, 0xAF, 0xBA, 0xB3, 0x96, 0x6C, 0x4B, 0x3E, 0x48, 0x68, 0x93, 0xB2,
+  0xBB, 0xB1, 0x92, 0x69, 0x49, 0x3F, 0x4B, 0x6D, 0x98, 0xB5, 0xBD, 0xB1,
+  0x91, 0x67, 0x49, 0x41, 0x4E, 0x72, 0x9C, 0xB6, 0xBC, 0xAF, 0x8D, 0x62,
+  0x47, 0x41, 0x51, 0x75, 0x9F, 0xB8, 0xBC, 0xAD, 0x88, 0x5F, 0x45, 0x41,
+  0x54, 0x79, 0xA2, 0xB9, 0xBB, 0xA9, 0x84, 0x5B, 0x43, 0x40, 0x55, 0x7D,
+  0xA4, 0xB8, 0xB8, 0xA6, 0x7E, 0x57, 0x41, 0x41, 0x58, 0x80, 0xA7, 0xB9,
+  0xB9, 0xA3, 0x7A, 0x54, 0x3F, 0x43, 0x5B, 0x84, 0xAA, 0xBB, 0xB8, 0xA0,
+  0x78, 0x53, 0x40, 0x46, 0x60, 0x6D, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x72,
+  0x72, 0x73, 0x73, 0x74, 0x74, 0x75, 0x74, 0x75, 0x76, 0x75, 0x76, 0x77,
+  0x76, 0x77, 0x78, 0x77, 0x78, 0x79, 0x78, 0x79, 0x79, 0x7A, 0x79, 0x7A,
+  0x79, 0x7A, 0x7B, 0x7A, 0x7A, 0x7B, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B,
+  0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x83, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
+  0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x80,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7C, 0x79, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C,
+  0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80,
+  0x7F, 0x80, 0x7F, 0x7E, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x8D, 0xA7, 0xBF, 0xB8, 0xA9, 0x97, 0x6B,
+  0x47, 0x2B, 0x1E, 0x2A, 0x45, 0x62, 0x8B, 0xA2, 0xB3, 0xC0, 0xB0, 0xA8,
+  0x91, 0x84, 0x82, 0x88, 0x9B, 0xB2, 0xC9, 0xD3, 0xDA, 0xC6, 0xB5, 0x8D,
+  0x6A, 0x53, 0x30, 0x2C, 0x55, 0x88, 0xA5, 0xCD, 0xD9, 0xB9, 0x94, 0x76,
+  0x4F, 0x3E, 0x35, 0x3A, 0x51, 0x69, 0x7F, 0x87, 0x85, 0x7B, 0x6D, 0x4E,
+  0x3C, 0x30, 0x38, 0x54, 0x6D, 0x99, 0xB4, 0xC4, 0xCE, 0xBF, 0xAF, 0x94,
+  0x80, 0x7A, 0x7F, 0x92, 0xAE, 0xCA, 0xD7, 0xDE, 0xCF, 0xBA, 0x98, 0x72,
+  0x60, 0x48, 0x4E, 0x56, 0x64, 0x7E, 0x82, 0x85, 0x7A, 0x66, 0x4A, 0x34,
+  0x24, 0x27, 0x3D, 0x58, 0x8D, 0xA9, 0xC6, 0xD3, 0xC7, 0xBB, 0x9B, 0x88,
+  0x7A, 0x79, 0x7E, 0x94, 0xA9, 0xBD, 0xC0, 0xAC, 0x9A, 0x68, 0x34, 0x2F,
+  0x41, 0x4C, 0x76, 0xA3, 0xAF, 0xA6, 0xAA, 0x99, 0x83, 0x66, 0x3E, 0x2C,
+  0x1D, 0x27, 0x36, 0x50, 0x6C, 0x83, 0x8E, 0x8A, 0x7F, 0x64, 0x53, 0x45,
+  0x48, 0x5D, 0x73, 0x9C, 0xB9, 0xD2, 0xDF, 0xD3, 0xC1, 0xA0, 0x89, 0x7B,
+  0x76, 0x7C, 0x8F, 0xAA, 0xBE, 0xC9, 0xBE, 0xB1, 0x90, 0x6B, 0x4C, 0x29,
+  0x27, 0x2F, 0x45, 0x65, 0x76, 0x82, 0x85, 0x7C, 0x68, 0x54, 0x3F, 0x45,
+  0x52, 0x69, 0x98, 0xB8, 0xD7, 0xE4, 0xE4, 0xD5, 0xB5, 0x8A, 0x73, 0x61,
+  0x61, 0x74, 0x7D, 0x9B, 0x98, 0x7C, 0x7C, 0x8D, 0x76, 0x6E, 0x77, 0x67,
+  0x50, 0x5D, 0x79, 0x88, 0x9A, 0x90, 0x85, 0x68, 0x44, 0x24, 0x0E, 0x0F,
+  0x29, 0x48, 0x6C, 0x8A, 0x96, 0xA1, 0x99, 0x89, 0x77, 0x62, 0x60, 0x68,
+  0x79, 0x9B, 0xBB, 0xD8, 0xE6, 0xE1, 0xD2, 0xB3, 0x8F, 0x79, 0x6B, 0x6B,
+  0x7A, 0x89, 0xA3, 0xAD, 0xAB, 0xA2, 0x80, 0x60, 0x3A, 0x1D, 0x14, 0x1A,
+  0x30, 0x56, 0x77, 0x89, 0x9A, 0x93, 0x8D, 0x7E, 0x67, 0x6A, 0x68, 0x7A,
+  0x91, 0xAF, 0xCC, 0xDC, 0xDC, 0xCC, 0xB1, 0x85, 0x6E, 0x4D, 0x46, 0x49,
+  0x42, 0x5E, 0x93, 0xAE, 0xB7, 0xC4, 0xAF, 0x78, 0x52, 0x3F, 0x33, 0x45,
+  0x56, 0x73, 0x86, 0x8C, 0x89, 0x75, 0x59, 0x3C, 0x2D, 0x23, 0x31, 0x47,
+  0x6C, 0x91, 0xA5, 0xBB, 0xB7, 0xAD, 0x98, 0x7B, 0x74, 0x6D, 0x7A, 0x8F,
+  0xAE, 0xD0, 0xE3, 0xE3, 0xD1, 0xB8, 0x91, 0x77, 0x5E, 0x54, 0x5E, 0x67,
+  0x86, 0x8E, 0x92, 0x92, 0x7D, 0x67, 0x42, 0x25, 0x16, 0x1E, 0x31, 0x57,
+  0x7D, 0x9B, 0xB9, 0xB7, 0xB9, 0xA5, 0x8A, 0x7D, 0x71, 0x79, 0x88, 0x9E,
+  0xB6, 0xC9, 0xC8, 0xC3, 0xA6, 0x7F, 0x5D, 0x31, 0x1C, 0x39, 0x60, 0x82,
+  0xB7, 0xD0, 0xBF, 0xA6, 0x92, 0x6A, 0x4D, 0x36, 0x2B, 0x36, 0x46, 0x65,
+  0x78, 0x85, 0x8A, 0x86, 0x72, 0x57, 0x40, 0x33, 0x3D, 0x4D, 0x70, 0x96,
+  0xB2, 0xCC, 0xCE, 0xC9, 0xB4, 0x94, 0x80, 0x72, 0x77, 0x85, 0x9D, 0xB9,
+  0xCE, 0xD4, 0xCC, 0xB7, 0x92, 0x73, 0x4E, 0x3F, 0x3B, 0x40, 0x5E, 0x74,
+  0x85, 0x8C, 0x85, 0x75, 0x5D, 0x40, 0x31, 0x31, 0x3E, 0x65, 0x88, 0xB3,
+  0xD1, 0xD7, 0xD6, 0xC0, 0xA2, 0x85, 0x72, 0x66, 0x73, 0x81, 0xA1, 0xB7,
+  0xB7, 0xB5, 0x8D, 0x61, 0x4E, 0x50, 0x44, 0x59, 0x7E, 0x88, 0x91, 0xA7,
+  0xA9, 0x9F, 0x8E, 0x69, 0x47, 0x28, 0x1B, 0x1E, 0x2F, 0x4D, 0x74, 0x8C,
+  0x99, 0x9A, 0x8B, 0x79, 0x5C, 0x4E, 0x50, 0x59, 0x76, 0x95, 0xB9, 0xD5,
+  0xDE, 0xDA, 0xC4, 0xA6, 0x89, 0x76, 0x6A, 0x73, 0x83, 0x9F, 0xB8, 0xBD,
+  0xC1, 0xAC, 0x93, 0x6E, 0x3F, 0x2B, 0x1F, 0x29, 0x44, 0x62, 0x7C, 0x8E,
+  0x92, 0x8A, 0x7D, 0x5F, 0x57, 0x4E, 0x56, 0x75, 0x8D, 0xB8, 0xD4, 0xE6,
+  0xE8, 0xD8, 0xB2, 0x8C, 0x6C, 0x57, 0x59, 0x57, 0x73, 0x83, 0x7C, 0x8B,
+  0xA5, 0x9E, 0x90, 0x89, 0x6C, 0x47, 0x46, 0x53, 0x68, 0x88, 0x8F, 0x97,
+  0x89, 0x76, 0x54, 0x33, 0x1F, 0x1E, 0x2A, 0x2E, 0x36, 0x36, 0x40, 0x46,
+  0x4D, 0x5D, 0x60, 0x6C, 0x72, 0x76, 0x80, 0x81, 0x86, 0x87, 0x89, 0x8D,
+  0x8D, 0x8A, 0x87, 0x86, 0x81, 0x81, 0x76, 0x74, 0x6E, 0x64, 0x64, 0x52,
+  0x4E, 0x49, 0x42, 0x43, 0x40, 0x40, 0x45, 0x4B, 0x4F, 0x5B, 0x5E, 0x6C,
+  0x7A, 0x7D, 0x91, 0x94, 0x9B, 0x9F, 0xA0, 0xA3, 0xA4, 0xA0, 0x9D, 0x9A,
+  0x90, 0x91, 0x7F, 0x78, 0x6C, 0x4E, 0x48, 0x69, 0x79, 0x86, 0xA3, 0xA5,
+  0x8B, 0x7B, 0x77, 0x68, 0x68, 0x5F, 0x5D, 0x5B, 0x59, 0x5B, 0x58, 0x56,
+  0x5A, 0x61, 0x61, 0x68, 0x69, 0x71, 0x79, 0x7C, 0x8B, 0x8F, 0x96, 0xA0,
+  0xA1, 0xAB, 0xAC, 0xAE, 0xB0, 0xB0, 0xB4, 0xB3, 0xAF, 0xAB, 0xA9, 0xA3,
+  0xA3, 0x9A, 0x93, 0x8F, 0x82, 0x80, 0x71, 0x67, 0x64, 0x5A, 0x5B, 0x58,
+  0x55, 0x59, 0x5F, 0x61, 0x6C, 0x70, 0x78, 0x8B, 0x8C, 0x9E, 0xA5, 0xA9,
+  0xB0, 0xAE, 0xB2, 0xB2, 0xB0, 0xAA, 0xA7, 0x9A, 0x9A, 0x8E, 0x82, 0x7D,
+  0x61, 0x53, 0x6A, 0x80, 0x88, 0xA3, 0xAE, 0x9A, 0x85, 0x81, 0x73, 0x71,
+  0x6B, 0x65, 0x66, 0x61, 0x63, 0x5F, 0x5E, 0x5F, 0x66, 0x67, 0x6C, 0x6E,
+  0x72, 0x7D, 0x7D, 0x8A, 0x90, 0x94, 0x9F, 0xA0, 0xA8, 0xAB, 0xAC, 0xAF,
+  0xAD, 0xB0, 0xB0, 0xAD, 0xA9, 0xA7, 0xA2, 0xA0, 0x9B, 0x91, 0x91, 0x84,
+  0x81, 0x78, 0x69, 0x69, 0x5F, 0x5E, 0x5C, 0x59, 0x5B, 0x61, 0x63, 0x6A,
+  0x72, 0x75, 0x87, 0x8B, 0x97, 0xA2, 0xA3, 0xAB, 0xAB, 0xAE, 0xAE, 0xAE,
+  0xA7, 0xA8, 0x9E, 0x9B, 0x94, 0x84, 0x80, 0x68, 0x53, 0x61, 0x7D, 0x83,
+  0x9A, 0xAD, 0x9E, 0x86, 0x81, 0x75, 0x6F, 0x6D, 0x63, 0x64, 0x5F, 0x61,
+  0x5E, 0x5C, 0x5C, 0x63, 0x65, 0x67, 0x6C, 0x6C, 0x77, 0x79, 0x81, 0x8C,
+  0x8E, 0x99, 0x9C, 0xA1, 0xA7, 0xA7, 0xAB, 0xAA, 0xAB, 0xAD, 0xAB, 0xA7,
+  0xA5, 0xA1, 0x9D, 0x9A, 0x90, 0x8F, 0x83, 0x7C, 0x78, 0x68, 0x67, 0x60,
+  0x5C, 0x5B, 0x58, 0x59, 0x5E, 0x62, 0x66, 0x70, 0x71, 0x81, 0x88, 0x8E,
+  0x9D, 0x9D, 0xA4, 0xA5, 0xA7, 0xA8, 0xA8, 0xA3, 0xA1, 0x9D, 0x95, 0x94,
+  0x83, 0x7F, 0x6E, 0x56, 0x5A, 0x75, 0x7F, 0x8D, 0xA6, 0x9F, 0x87, 0x7E,
+  0x78, 0x6D, 0x6D, 0x64, 0x63, 0x60, 0x5F, 0x5F, 0x5C, 0x5B, 0x5F, 0x64,
+  0x65, 0x6B, 0x6B, 0x73, 0x78, 0x7C, 0x88, 0x8A, 0x94, 0x98, 0x9B, 0xA3,
+  0xA2, 0xA6, 0xA6, 0xA7, 0xA9, 0xA8, 0xA3, 0xA1, 0x9F, 0x9A, 0x99, 0x90,
+  0x8E, 0x87, 0x7E, 0x7D, 0x6D, 0x68, 0x63, 0x5C, 0x5D, 0x59, 0x59, 0x5D,
+  0x61, 0x63, 0x6E, 0x6F, 0x7B, 0x87, 0x89, 0x9A, 0x9B, 0xA1, 0xA5, 0xA5,
+  0xA8, 0xA8, 0xA4, 0xA0, 0x9E, 0x95, 0x94, 0x84, 0x7D, 0x72, 0x59, 0x52,
+  0x6C, 0x7B, 0x87, 0x9F, 0xA2, 0x8B, 0x7C, 0x78, 0x6B, 0x6B, 0x63, 0x61,
+  0x60, 0x5D, 0x5E, 0x5A, 0x59, 0x5C, 0x62, 0x64, 0x69, 0x6A, 0x6E, 0x75,
+  0x77, 0x81, 0x84, 0x89, 0x90, 0x91, 0x98, 0x9A, 0x9B, 0x9D, 0x9C, 0x9E,
+  0x9E, 0x9B, 0x99, 0x98, 0x94, 0x92, 0x8D, 0x88, 0x86, 0x7D, 0x7D, 0x72,
+  0x6B, 0x69, 0x62, 0x62, 0x60, 0x5F, 0x61, 0x65, 0x66, 0x6E, 0x72, 0x76,
+  0x83, 0x84, 0x90, 0x95, 0x97, 0x9C, 0x9B, 0x9E, 0x9D, 0x9C, 0x98, 0x98,
+  0x90, 0x8F, 0x87, 0x7E, 0x79, 0x65, 0x5A, 0x6B, 0x7B, 0x81, 0x95, 0x9C,
+  0x8E, 0x7F, 0x7C, 0x72, 0x70, 0x6C, 0x66, 0x67, 0x64, 0x65, 0x63, 0x62,
+  0x63, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x79, 0x7A, 0x83, 0x88, 0x8A, 0x93,
+  0x94, 0x99, 0x9C, 0x9D, 0x9F, 0x9E, 0xA0, 0xA0, 0x9E, 0x9B, 0x9A, 0x96,
+  0x95, 0x91, 0x8A, 0x89, 0x80, 0x7E, 0x76, 0x6C, 0x6B, 0x63, 0x62, 0x60,
+  0x5E, 0x60, 0x63, 0x65, 0x6B, 0x71, 0x72, 0x80, 0x83, 0x8B, 0x93, 0x94,
+  0x99, 0x99, 0x9A, 0x9B, 0x9B, 0x95, 0x9D, 0xBF, 0xDE, 0xF2, 0xF1, 0xCA,
+  0x97, 0x7D, 0x80, 0x7E, 0x96, 0xA2, 0xA1, 0x9C, 0x81, 0x76, 0x9A, 0xD7,
+  0xEE, 0xF3, 0xBE, 0x81, 0x6C, 0x6F, 0x88, 0xA6, 0xB5, 0x9D, 0x6B, 0x48,
+  0x46, 0x5C, 0x84, 0x9B, 0x9A, 0x70, 0x3D, 0x28, 0x3B, 0x71, 0x9C, 0xA4,
+  0x90, 0x65, 0x45, 0x45, 0x70, 0xA5, 0xB6, 0xB0, 0x98, 0x76, 0x66, 0x7D,
+  0xB3, 0xD2, 0xD3, 0xC0, 0x9B, 0x80, 0x83, 0xA9, 0xD2, 0xDE, 0xD3, 0xAE,
+  0x89, 0x7F, 0x90, 0xB5, 0xCF, 0xCF, 0xAD, 0x7E, 0x68, 0x6E, 0x88, 0xA8,
+  0xB6, 0xA0, 0x6C, 0x48, 0x46, 0x52, 0x6F, 0x88, 0x83, 0x59, 0x28, 0x18,
+  0x25, 0x4C, 0x71, 0x7B, 0x69, 0x45, 0x27, 0x28, 0x51, 0x83, 0x96, 0x93,
+  0x81, 0x62, 0x51, 0x6B, 0xA8, 0xCB, 0xCE, 0xB8, 0x91, 0x74, 0x77, 0x9E,
+  0xCB, 0xDB, 0xCB, 0x9B, 0x71, 0x67, 0x78, 0x9B, 0xB6, 0xB6, 0x89, 0x50,
+  0x3B, 0x3E, 0x40, 0x61, 0x6C, 0x6B, 0x63, 0x45, 0x40, 0x72, 0xB3, 0xCA,
+  0xC7, 0x88, 0x50, 0x42, 0x49, 0x64, 0x83, 0x8E, 0x75, 0x46, 0x29, 0x2B,
+  0x44, 0x6C, 0x81, 0x7A, 0x52, 0x2A, 0x1B, 0x31, 0x61, 0x84, 0x89, 0x75,
+  0x4E, 0x33, 0x38, 0x62, 0x94, 0xA4, 0x9C, 0x82, 0x60, 0x54, 0x71, 0xAA,
+  0xC9, 0xC8, 0xB2, 0x88, 0x6F, 0x77, 0xA4, 0xD0, 0xDB, 0xCB, 0x9F, 0x78,
+  0x72, 0x89, 0xB4, 0xCE, 0xCA, 0xA2, 0x70, 0x5E, 0x67, 0x86, 0xA6, 0xB2,
+  0x95, 0x60, 0x40, 0x41, 0x51, 0x70, 0x88, 0x7E, 0x51, 0x23, 0x18, 0x28,
+  0x51, 0x74, 0x7B, 0x67, 0x41, 0x27, 0x2C, 0x58, 0x88, 0x97, 0x93, 0x7D,
+  0x5D, 0x52, 0x70, 0xAD, 0xCC, 0xCD, 0xB4, 0x8C, 0x72, 0x7A, 0xA4, 0xD0,
+  0xDC, 0xC8, 0x96, 0x70, 0x69, 0x7E, 0xA3, 0xBC, 0xB6, 0x84, 0x4F, 0x3E,
+  0x42, 0x49, 0x6C, 0x72, 0x70, 0x63, 0x46, 0x46, 0x7F, 0xBD, 0xD1, 0xC8,
+  0x83, 0x50, 0x44, 0x4E, 0x6B, 0x8A, 0x91, 0x73, 0x42, 0x29, 0x2D, 0x4B,
+  0x74, 0x86, 0x7C, 0x4F, 0x28, 0x1D, 0x38, 0x6A, 0x8B, 0x8E, 0x76, 0x4E,
+  0x36, 0x3E, 0x6F, 0x9D, 0xA9, 0xA0, 0x83, 0x60, 0x57, 0x7B, 0xB3, 0xCD,
+  0xC9, 0xAF, 0x87, 0x70, 0x7D, 0xAC, 0xD4, 0xDB, 0xC8, 0x9C, 0x78, 0x76,
+  0x91, 0xBB, 0xD1, 0xCA, 0x9F, 0x70, 0x61, 0x6D, 0x8E, 0xAE, 0xB5, 0x96,
+  0x5D, 0x41, 0x44, 0x57, 0x7A, 0x8F, 0x81, 0x50, 0x23, 0x1A, 0x2F, 0x5C,
+  0x7D, 0x80, 0x67, 0x40, 0x26, 0x32, 0x61, 0x90, 0x9C, 0x95, 0x7C, 0x5C,
+  0x54, 0x78, 0xB5, 0xCF, 0xCD, 0xB2, 0x89, 0x73, 0x7F, 0xAC, 0xD5, 0xDE,
+  0xC7, 0x92, 0x70, 0x6B, 0x85, 0xAA, 0xC0, 0xB6, 0x83, 0x4F, 0x42, 0x47,
+  0x54, 0x75, 0x79, 0x79, 0x64, 0x47, 0x4D, 0x8A, 0xC5, 0xD7, 0xC6, 0x7D,
+  0x4F, 0x45, 0x54, 0x72, 0x92, 0x94, 0x70, 0x3F, 0x2A, 0x31, 0x53, 0x7A,
+  0x8A, 0x7A, 0x4A, 0x26, 0x1F, 0x3E, 0x72, 0x92, 0x91, 0x74, 0x4B, 0x35,
+  0x43, 0x76, 0xA3, 0xAC, 0x9F, 0x7E, 0x5D, 0x59, 0x80, 0xB7, 0xCE, 0xC8,
+  0xAA, 0x82, 0x6F, 0x81, 0xB1, 0xD6, 0xDB, 0xC3, 0x96, 0x76, 0x77, 0x96,
+  0xBF, 0xD3, 0xC7, 0x99, 0x6C, 0x61, 0x70, 0x95, 0xB4, 0xB8, 0x93, 0x5B,
+  0x42, 0x47, 0x5F, 0x83, 0x96, 0x83, 0x4E, 0x24, 0x1E, 0x37, 0x66, 0x85,
+  0x85, 0x67, 0x3E, 0x27, 0x37, 0x6B, 0x97, 0xA1, 0x97, 0x7A, 0x5A, 0x55,
+  0x80, 0xBA, 0xD0, 0xCB, 0xAB, 0x82, 0x6E, 0x80, 0xAF, 0xD7, 0xDD, 0xC0,
+  0x8B, 0x6A, 0x6A, 0x88, 0xAE, 0xC4, 0xB4, 0x7E, 0x4C, 0x42, 0x48, 0x5B,
+  0x7E, 0x80, 0x7C, 0x61, 0x45, 0x52, 0x95, 0xC9, 0xD9, 0xC2, 0x78, 0x4E,
+  0x46, 0x58, 0x7C, 0x9A, 0x98, 0x70, 0x3E, 0x2B, 0x36, 0x5C, 0x84, 0x90,
+  0x7B, 0x49, 0x25, 0x23, 0x46, 0x7B, 0x96, 0x91, 0x71, 0x48, 0x36, 0x49,
+  0x7E, 0xA7, 0xAE, 0x9E, 0x79, 0x5B, 0x5D, 0x86, 0xB3, 0xC9, 0xD1, 0xCC,
+  0xAE, 0x87, 0x70, 0x6C, 0x7B, 0x9A, 0xC1, 0xD7, 0xDA, 0xCA, 0xA6, 0x7F,
+  0x68, 0x63, 0x70, 0x91, 0xB6, 0xC2, 0xBB, 0xAA, 0x88, 0x5E, 0x43, 0x42,
+  0x4F, 0x63, 0x84, 0x99, 0x95, 0x7C, 0x58, 0x37, 0x22, 0x22, 0x36, 0x5A,
+  0x82, 0x96, 0x95, 0x86, 0x6B, 0x4C, 0x3B, 0x4A, 0x6A, 0x8D, 0xAD, 0xC7,
+  0xCF, 0xB9, 0x98, 0x7B, 0x6C, 0x6E, 0x88, 0xAF, 0xCB, 0xD4, 0xCE, 0xB4,
+  0x91, 0x70, 0x5E, 0x5E, 0x77, 0x95, 0xA5, 0xAA, 0xA8, 0x7E, 0x46, 0x2A,
+  0x1D, 0x3C, 0x67, 0x8C, 0xAE, 0xCE, 0xCB, 0xB3, 0x86, 0x52, 0x46, 0x4D,
+  0x62, 0x7D, 0x97, 0x9E, 0x8F, 0x70, 0x4C, 0x30, 0x26, 0x31, 0x4E, 0x73,
+  0x8C, 0x93, 0x89, 0x6E, 0x4A, 0x31, 0x2F, 0x42, 0x63, 0x88, 0xA4, 0xB1,
+  0xA7, 0x86, 0x68, 0x59, 0x53, 0x65, 0x8E, 0xB6, 0xC9, 0xD0, 0xCA, 0xAA,
+  0x83, 0x6E, 0x6D, 0x7E, 0xA0, 0xC4, 0xD8, 0xD7, 0xC4, 0x9E, 0x78, 0x62,
+  0x5E, 0x6E, 0x91, 0xB6, 0xC0, 0xB8, 0xA6, 0x82, 0x58, 0x40, 0x42, 0x50,
+  0x68, 0x89, 0x9D, 0x97, 0x7C, 0x57, 0x35, 0x23, 0x25, 0x3C, 0x63, 0x89,
+  0x9B, 0x98, 0x86, 0x68, 0x49, 0x3B, 0x4B, 0x6D, 0x91, 0xB0, 0xC9, 0xCD,
+  0xB5, 0x91, 0x75, 0x69, 0x6D, 0x8A, 0xB1, 0xCC, 0xD4, 0xCC, 0xB0, 0x8C,
+  0x6B, 0x5A, 0x5E, 0x7B, 0x96, 0xA7, 0xAC, 0xA7, 0x7A, 0x45, 0x29, 0x20,
+  0x42, 0x6B, 0x90, 0xB2, 0xCF, 0xC8, 0xAD, 0x7A, 0x4C, 0x44, 0x4D, 0x64,
+  0x81, 0x9B, 0x9E, 0x8E, 0x6E, 0x4A, 0x2E, 0x27, 0x35, 0x56, 0x7B, 0x92,
+  0x97, 0x8A, 0x6D, 0x48, 0x32, 0x31, 0x45, 0x69, 0x8E, 0xA9, 0xB3, 0xA5,
+  0x82, 0x65, 0x56, 0x54, 0x68, 0x93, 0xBA, 0xCB, 0xD1, 0xC8, 0xA5, 0x7E,
+  0x6B, 0x6C, 0x80, 0xA2, 0xC7, 0xD8, 0xD6, 0xC1, 0x9A, 0x76, 0x62, 0x60,
+  0x71, 0x97, 0xB9, 0xC1, 0xB7, 0xA3, 0x7E, 0x54, 0x3E, 0x41, 0x51, 0x6B,
+  0x8E, 0x9D, 0x95, 0x78, 0x52, 0x32, 0x22, 0x27, 0x40, 0x68, 0x8D, 0x9C,
+  0x97, 0x84, 0x64, 0x45, 0x3B, 0x4D, 0x70, 0x94, 0xB4, 0xCB, 0xCA, 0xB1,
+  0x8C, 0x71, 0x64, 0x6C, 0x8D, 0xB4, 0xCD, 0xD4, 0xC8, 0xAA, 0x85, 0x66,
+  0x58, 0x5F, 0x7D, 0x99, 0xAA, 0xAF, 0xA5, 0x74, 0x43, 0x28, 0x24, 0x47,
+  0x6F, 0x95, 0xB7, 0xCF, 0xC4, 0xA7, 0x72, 0x49, 0x43, 0x50, 0x68, 0x87,
+  0x9F, 0xA0, 0x8E, 0x6B, 0x48, 0x2E, 0x29, 0x38, 0x5B, 0x80, 0x96, 0x99,
+  0x89, 0x69, 0x45, 0x30, 0x32, 0x49, 0x6D, 0x92, 0xAB, 0xB4, 0xA3, 0x7F,
+  0x63, 0x53, 0x53, 0x6B, 0x97, 0xBB, 0xCB, 0xD1, 0xC3, 0x9E, 0x79, 0x67,
+  0x6B, 0x80, 0xA6, 0xCA, 0xD8, 0xD4, 0xBD, 0x95, 0x71, 0x5F, 0x60, 0x75,
+  0x9C, 0xBC, 0xC1, 0xB7, 0xA1, 0x79, 0x50, 0x3F, 0x43, 0x55, 0x71, 0x92,
+  0x9E, 0x92, 0x74, 0x4F, 0x30, 0x22, 0x28, 0x45, 0x71, 0x94, 0xA2, 0x9B,
+  0x84, 0x60, 0x42, 0x38, 0x4C, 0x70, 0x94, 0xB5, 0xC8, 0xC3, 0xA6, 0x7E,
+  0x63, 0x59, 0x65, 0x87, 0xB0, 0xCA, 0xD0, 0xC3, 0xA2, 0x7B, 0x5C, 0x51,
+  0x5C, 0x7D, 0x9D, 0xAE, 0xB3, 0xA6, 0x73, 0x45, 0x2B, 0x2A, 0x4C, 0x74,
+  0x9B, 0xBC, 0xCE, 0xC0, 0x9F, 0x6B, 0x46, 0x43, 0x51, 0x6D, 0x90, 0xA6,
+  0xA7, 0x92, 0x6D, 0x47, 0x2F, 0x2C, 0x3F, 0x65, 0x8A, 0x9F, 0xA0, 0x8F,
+  0x6B, 0x45, 0x31, 0x34, 0x4E, 0x75, 0x9A, 0xB1, 0xB6, 0xA1, 0x7B, 0x5C,
+  0x4E, 0x4F, 0x6B, 0x98, 0xBB, 0xCB, 0xCD, 0xBB, 0x93, 0x6D, 0x5E, 0x63,
+  0x7C, 0xA4, 0xC7, 0xD5, 0xCF, 0xB6, 0x8B, 0x68, 0x57, 0x5B, 0x75, 0x9E,
+  0xBE, 0xC3, 0xB8, 0x9E, 0x74, 0x4D, 0x3E, 0x46, 0x5A, 0x7D, 0x9E, 0xA8,
+  0x9B, 0x7A, 0x52, 0x33, 0x27, 0x31, 0x51, 0x7A, 0x9A, 0xA2, 0x9A, 0x81,
+  0x60, 0x45, 0x3F, 0x55, 0x75, 0x99, 0xB5, 0xC4, 0xC1, 0xBF, 0xC1, 0xC2,
+  0xC0, 0xBE, 0xBF, 0xBE, 0xBC, 0xBA, 0xB7, 0xB6, 0xB5, 0xB0, 0xAB, 0xA9,
+  0xAA, 0xA1, 0x9B, 0x9A, 0x98, 0x84, 0x7D, 0x7C, 0x84, 0x95, 0x98, 0x96,
+  0xA1, 0xAE, 0xAD, 0xAC, 0x9A, 0x90, 0x8F, 0x8C, 0x84, 0x80, 0x81, 0x7C,
+  0x78, 0x76, 0x77, 0x75, 0x74, 0x73, 0x72, 0x70, 0x70, 0x6F, 0x70, 0x73,
+  0x74, 0x74, 0x75, 0x78, 0x77, 0x78, 0x7D, 0x80, 0x7F, 0x81, 0x89, 0x8B,
+  0x89, 0x8D, 0x92, 0x92, 0x91, 0x95, 0x98, 0x97, 0x97, 0x98, 0x98, 0x96,
+  0x97, 0x98, 0x97, 0x96, 0x94, 0x91, 0x90, 0x8F, 0x8C, 0x8A, 0x8A, 0x88,
+  0x82, 0x80, 0x80, 0x7C, 0x76, 0x75, 0x75, 0x6C, 0x65, 0x66, 0x65, 0x60,
+  0x5D, 0x5F, 0x5E, 0x5C, 0x5C, 0x5D, 0x5F, 0x63, 0x63, 0x64, 0x69, 0x6E,
+  0x6E, 0x71, 0x7A, 0x7E, 0x7D, 0x83, 0x8C, 0x8B, 0x8B, 0x8D, 0x90, 0x8F,
+  0x8F, 0x90, 0x90, 0x8F, 0x8E, 0x8B, 0x8A, 0x89, 0x84, 0x7E, 0x7E, 0x7D,
+  0x76, 0x70, 0x71, 0x6E, 0x5D, 0x5A, 0x59, 0x62, 0x71, 0x73, 0x74, 0x7F,
+  0x8A, 0x89, 0x88, 0x79, 0x73, 0x73, 0x71, 0x6C, 0x6A, 0x6B, 0x68, 0x65,
+  0x65, 0x65, 0x63, 0x64, 0x63, 0x64, 0x62, 0x62, 0x62, 0x64, 0x67, 0x68,
+  0x68, 0x6A, 0x6D, 0x6D, 0x6E, 0x73, 0x76, 0x75, 0x78, 0x7F, 0x80, 0x80,
+  0x83, 0x88, 0x88, 0x88, 0x8C, 0x8E, 0x8D, 0x8D, 0x8E, 0x8F, 0x8E, 0x8E,
+  0x90, 0x8F, 0x8E, 0x8C, 0x8A, 0x8A, 0x88, 0x86, 0x85, 0x85, 0x83, 0x7E,
+  0x7C, 0x7D, 0x79, 0x74, 0x74, 0x74, 0x6C, 0x67, 0x68, 0x66, 0x63, 0x61,
+  0x63, 0x62, 0x61, 0x62, 0x63, 0x65, 0x67, 0x68, 0x69, 0x6E, 0x72, 0x71,
+  0x75, 0x7D, 0x80, 0x7F, 0x85, 0x8C, 0x8B, 0x8C, 0x8E, 0x91, 0x90, 0x90,
+  0x91, 0x91, 0x90, 0x90, 0x8C, 0x8C, 0x8B, 0x88, 0x84, 0x84, 0x82, 0x7A,
+  0x75, 0x76, 0x70, 0x5F, 0x5E, 0x5C, 0x68, 0x77, 0x78, 0x79, 0x83, 0x8A,
+  0x8A, 0x88, 0x7B, 0x77, 0x77, 0x75, 0x70, 0x6F, 0x6F, 0x6D, 0x6A, 0x6B,
+  0x6A, 0x6A, 0x69, 0x6A, 0x6A, 0x68, 0x69, 0x69, 0x6C, 0x6E, 0x6F, 0x70,
+  0x72, 0x74, 0x73, 0x75, 0x7A, 0x7B, 0x7A, 0x7E, 0x83, 0x84, 0x83, 0x87,
+  0x8A, 0x8A, 0x8A, 0x8E, 0x8F, 0x8E, 0x8F, 0x90, 0x90, 0x8F, 0x90, 0x91,
+  0x90, 0x90, 0x8E, 0x8C, 0x8C, 0x8A, 0x88, 0x87, 0x87, 0x85, 0x81, 0x80,
+  0x80, 0x7C, 0x78, 0x79, 0x78, 0x71, 0x6E, 0x6E, 0x6D, 0x69, 0x69, 0x6A,
+  0x68, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x6D, 0x6F, 0x73, 0x75, 0x75, 0x7A,
+  0x80, 0x81, 0x82, 0x87, 0x8D, 0x8C, 0x8D, 0x90, 0x91, 0x90, 0x90, 0x91,
+  0x91, 0x90, 0x8F, 0x8D, 0x8D, 0x8C, 0x88, 0x86, 0x86, 0x84, 0x7D, 0x7A,
+  0x7B, 0x74, 0x68, 0x67, 0x66, 0x72, 0x7C, 0x7C, 0x7E, 0x89, 0x8F, 0x8E,
+  0x8A, 0x7D, 0x7A, 0x7A, 0x76, 0x71, 0x72, 0x71, 0x70, 0x6F, 0x70, 0x71,
+  0x70, 0x6F, 0x70, 0x70, 0x6F, 0x70, 0x6F, 0x72, 0x73, 0x73, 0x73, 0x75,
+  0x76, 0x76, 0x78, 0x7B, 0x7C, 0x7B, 0x7E, 0x81, 0x83, 0x82, 0x87, 0x89,
+  0x88, 0x89, 0x8B, 0x8C, 0x8B, 0x8C, 0x8C, 0x8D, 0x8C, 0x8C, 0x8D, 0x8D,
+  0x8C, 0x8B, 0x8A, 0x89, 0x89, 0x87, 0x86, 0x87, 0x84, 0x81, 0x82, 0x81,
+  0x7E, 0x7C, 0x7C, 0x7B, 0x76, 0x74, 0x75, 0x73, 0x71, 0x70, 0x71, 0x70,
+  0x70, 0x6F, 0x70, 0x72, 0x73, 0x73, 0x75, 0x77, 0x79, 0x78, 0x7C, 0x81,
+  0x81, 0x82, 0x85, 0x89, 0x88, 0x89, 0x8B, 0x8C, 0x8A, 0x8B, 0x8B, 0x8C,
+  0x8B, 0x8B, 0x89, 0x89, 0x88, 0x87, 0x85, 0x85, 0x83, 0x7E, 0x7D, 0x7E,
+  0x78, 0x6F, 0x6F, 0x6F, 0x78, 0x7E, 0x7E, 0x80, 0x88, 0x8B, 0x8B, 0x88,
+  0x7F, 0x7E, 0x7E, 0x7B, 0x77, 0x78, 0x77, 0x75, 0x73, 0x74, 0x74, 0x73,
+  0x72, 0x73, 0x72, 0x70, 0x71, 0x70, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A,
+  0x79, 0x7B, 0x7D, 0x7D, 0x7E, 0x80, 0x82, 0x81, 0x82, 0x85, 0x86, 0x85,
+  0x86, 0x87, 0x88, 0x87, 0x88, 0x89, 0x88, 0x89, 0x88, 0x88, 0x89, 0x8A,
+  0x89, 0x88, 0x87, 0x88, 0x86, 0x85, 0x86, 0x84, 0x82, 0x83, 0x82, 0x80,
+  0x7E, 0x7F, 0x7D, 0x7A, 0x79, 0x79, 0x77, 0x76, 0x77, 0x76, 0x76, 0x75,
+  0x76, 0x77, 0x78, 0x78, 0x78, 0x7A, 0x7C, 0x7B, 0x7C, 0x7F, 0x81, 0x81,
+  0x82, 0x85, 0x87, 0x86, 0x86, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x87,
+  0x87, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83, 0x81, 0x7E, 0x7D, 0x7D, 0x77,
+  0x73, 0x73, 0x75, 0x7B, 0x7F, 0x7F, 0x82, 0x88, 0x88, 0x89, 0x84, 0x80,
+  0x7F, 0x7E, 0x7C, 0x7A, 0x7B, 0x7A, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77,
+  0x78, 0x77, 0x77, 0x76, 0x77, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7C,
+  0x7C, 0x7E, 0x7D, 0x7E, 0x80, 0x82, 0x81, 0x82, 0x83, 0x83, 0x82, 0x83,
+  0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
+  0x82, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x7F,
+  0x80, 0x7F, 0x7D, 0x7D, 0x7E, 0x7D, 0x7C, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B,
+  0x7C, 0x7D, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x81, 0x82, 0x81, 0x82,
+  0x83, 0x84, 0x83, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84, 0x85, 0x84, 0x83,
+  0x82, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7A, 0x79,
+  0x79, 0x7A, 0x7E, 0x7F, 0x7E, 0x80, 0x83, 0x83, 0x84, 0x81, 0x7F, 0x7F,
+  0x7E, 0x7D, 0x7C, 0x7D, 0x7C, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7C,
+  0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7D, 0x7F,
+  0x80, 0x7F, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x83, 0x84,
+  0x83, 0x84, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x7F, 0x7D, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x80, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E,
+  0x7F, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7D, 0x80, 0x65, 0x45, 0x2F,
+  0x1C, 0x13, 0x13, 0x20, 0x33, 0x50, 0x65, 0x71, 0x73, 0x6B, 0x5C, 0x44,
+  0x35, 0x2C, 0x2F, 0x3B, 0x4E, 0x69, 0x7B, 0x85, 0x84, 0x79, 0x62, 0x48,
+  0x37, 0x2E, 0x34, 0x44, 0x5F, 0x7D, 0x91, 0x9B, 0x96, 0x86, 0x69, 0x4B,
+  0x39, 0x32, 0x3D, 0x51, 0x71, 0x90, 0xA4, 0xAC, 0xA3, 0x8E, 0x6B, 0x4E,
+  0x3B, 0x38, 0x46, 0x5F, 0x82, 0xA0, 0xB2, 0xB5, 0xA8, 0x91, 0x6D, 0x51,
+  0x40, 0x41, 0x51, 0x6D, 0x92, 0xAC, 0xBB, 0xBA, 0xAC, 0x90, 0x6C, 0x52,
+  0x44, 0x48, 0x5B, 0x7A, 0x9F, 0xB6, 0xC1, 0xBD, 0xAC, 0x8D, 0x6A, 0x54,
+  0x48, 0x50, 0x65, 0x86, 0xA8, 0xBE, 0xC6, 0xBE, 0xAB, 0x88, 0x68, 0x54,
+  0x4C, 0x58, 0x6F, 0x92, 0xB1, 0xC3, 0xC9, 0xBD, 0xA6, 0x83, 0x65, 0x53,
+  0x4F, 0x5E, 0x77, 0x9A, 0xB7, 0xC6, 0xC8, 0xBA, 0xA1, 0x7C, 0x61, 0x51,
+  0x52, 0x63, 0x7F, 0xA3, 0xBB, 0xC8, 0xC4, 0xB5, 0x98, 0x75, 0x5C, 0x4F,
+  0x54, 0x67, 0x87, 0xA9, 0xC0, 0xCA, 0xC3, 0xB1, 0x92, 0x6F, 0x58, 0x4E,
+  0x57, 0x6D, 0x8F, 0xAE, 0xC2, 0xCA, 0xC0, 0xAB, 0x89, 0x69, 0x54, 0x4E,
+  0x5B, 0x73, 0x96, 0xB4, 0xC5, 0xC9, 0xBD, 0xA6, 0x83, 0x65, 0x52, 0x50,
+  0x60, 0x7A, 0x9F, 0xB9, 0xC7, 0xC7, 0xB9, 0x9F, 0x7B, 0x5F, 0x4F, 0x51,
+  0x63, 0x81, 0xA4, 0xBC, 0xC8, 0xC4, 0xB3, 0x95, 0x72, 0x59, 0x4C, 0x53,
+  0x68, 0x88, 0xA9, 0xBF, 0xC8, 0xC0, 0xAC, 0x8B, 0x6A, 0x54, 0x4A, 0x55,
+  0x6B, 0x8D, 0xAE, 0xC0, 0xC7, 0xBC, 0xA5, 0x83, 0x63, 0x4F, 0x4A, 0x58,
+  0x71, 0x95, 0xB2, 0xC3, 0xC5, 0xB8, 0x9F, 0x7A, 0x5E, 0x4B, 0x4B, 0x5C,
+  0x77, 0x9D, 0xB7, 0xC5, 0xC3, 0xB4, 0x98, 0x72, 0x58, 0x4A, 0x4E, 0x60,
+  0x7F, 0xA2, 0xBA, 0xC6, 0xC0, 0xAE, 0x8F, 0x6B, 0x53, 0x47, 0x50, 0x65,
+  0x86, 0xA8, 0xBC, 0xC5, 0xBD, 0xA7, 0x85, 0x63, 0x4D, 0x46, 0x52, 0x69,
+  0x8D, 0xAC, 0xBF, 0xC4, 0xB8, 0xA0, 0x7C, 0x5D, 0x4A, 0x45, 0x55, 0x6E,
+  0x93, 0xB1, 0xC1, 0xC2, 0xB4, 0x99, 0x73, 0x58, 0x47, 0x47, 0x59, 0x76,
+  0x9B, 0xB5, 0xC3, 0xC0, 0xAF, 0x91, 0x6C, 0x54, 0x46, 0x4B, 0x5F, 0x7E,
+  0xA3, 0xBA, 0xC4, 0xBE, 0xAB, 0x8A, 0x66, 0x4F, 0x44, 0x4E, 0x63, 0x85,
+  0xA8, 0xBC, 0xC3, 0xBA, 0xA3, 0x80, 0x60, 0x4A, 0x43, 0x50, 0x69, 0x8E,
+  0xAC, 0xBE, 0xC2, 0xB4, 0x9C, 0x78, 0x58, 0x46, 0x44, 0x53, 0x6F, 0x93,
+  0xAF, 0xBF, 0xBF, 0xB0, 0x94, 0x6E, 0x53, 0x43, 0x45, 0x57, 0x75, 0x9A,
+  0xB4, 0xC0, 0xBD, 0xAA, 0x8C, 0x67, 0x4E, 0x41, 0x48, 0x5C, 0x7D, 0xA1,
+  0xB7, 0xC0, 0xBA, 0xA6, 0x83, 0x61, 0x4B, 0x41, 0x4C, 0x63, 0x86, 0xA7,
+  0xBA, 0xC1, 0xB6, 0xA0, 0x7B, 0x5A, 0x47, 0x41, 0x50, 0x69, 0x8E, 0xAB,
+  0xBD, 0xBF, 0xB2, 0x98, 0x72, 0x56, 0x44, 0x43, 0x53, 0x6E, 0x96, 0xB1,
+  0xC0, 0xBF, 0xAE, 0x91, 0x6C, 0x50, 0x40, 0x44, 0x58, 0x77, 0x9C, 0xB4,
+  0xC0, 0xBB, 0xA9, 0x88, 0x64, 0x4B, 0x3F, 0x47, 0x5C, 0x7F, 0xA2, 0xB7,
+  0xC1, 0xB8, 0xA3, 0x80, 0x5E, 0x47, 0x3F, 0x4B, 0x64, 0x89, 0xAA, 0xBD,
+  0xC1, 0xB5, 0x9D, 0x78, 0x5A, 0x45, 0x41, 0x50, 0x6B, 0x90, 0xAD, 0xBE,
+  0xC0, 0xB0, 0x96, 0x70, 0x52, 0x42, 0x42, 0x54, 0x71, 0x97, 0xB1, 0xBF,
+  0xBD, 0xAB, 0x8D, 0x68, 0x4D, 0x3F, 0x44, 0x58, 0x78, 0x9D, 0xB4, 0xBF,
+  0xB9, 0xA5, 0x84, 0x60, 0x48, 0x3D, 0x47, 0x5D, 0x80, 0xA3, 0xB8, 0xBF,
+  0xB5, 0x9F, 0x7B, 0x5A, 0x44, 0x3D, 0x4B, 0x64, 0x89, 0xA8, 0xBA, 0xBF,
+  0xB1, 0x98, 0x73, 0x55, 0x42, 0x40, 0x51, 0x6B, 0x91, 0xAE, 0xBD, 0xBE,
+  0xAE, 0x91, 0x6D, 0x50, 0x40, 0x42, 0x54, 0x73, 0x98, 0xB2, 0xBF, 0xBB,
+  0xA9, 0x8A, 0x65, 0x4C, 0x3D, 0x44, 0x5A, 0x7B, 0x9E, 0xB6, 0xC1, 0xB9,
+  0xA4, 0x81, 0x5E, 0x46, 0x3D, 0x47, 0x5F, 0x83, 0xA4, 0xB9, 0xC0, 0xB5,
+  0x9D, 0x78, 0x58, 0x43, 0x3D, 0x4C, 0x65, 0x8B, 0xAA, 0xBB, 0xBF, 0xB1,
+  0x96, 0x70, 0x52, 0x40, 0x3F, 0x51, 0x6D, 0x93, 0xAF, 0xBF, 0xBE, 0xAE,
+  0x91, 0x6A, 0x4F, 0x3E, 0x43, 0x57, 0x76, 0x9C, 0xB4, 0xC1, 0xBB, 0xA8,
+  0x88, 0x63, 0x4A, 0x3E, 0x46, 0x5B, 0x7E, 0xA1, 0xB8, 0xC1, 0xB7, 0xA2,
+  0x7E, 0x5C, 0x46, 0x3D, 0x49, 0x61, 0x86, 0xA7, 0xBA, 0xBF, 0xB3, 0x9A,
+  0x76, 0x55, 0x41, 0x3D, 0x4D, 0x68, 0x8D, 0xAA, 0xBC, 0xBE, 0xAE, 0x93,
+  0x6D, 0x50, 0x3E, 0x3F, 0x52, 0x6F, 0x95, 0xB0, 0xBE, 0xBB, 0xA9, 0x8C,
+  0x67, 0x4C, 0x3D, 0x42, 0x57, 0x79, 0x9D, 0xB5, 0xC0, 0xB9, 0xA6, 0x84,
+  0x60, 0x49, 0x3D, 0x47, 0x5D, 0x80, 0xA3, 0xB8, 0xC0, 0xB6, 0x9F, 0x7C,
+  0x5A, 0x44, 0x3D, 0x4A, 0x64, 0x88, 0xA8, 0xBB, 0xBF, 0xB2, 0x9A, 0x74,
+  0x55, 0x41, 0x3E, 0x4F, 0x6A, 0x91, 0xAE, 0xBE, 0xBE, 0xAD, 0x91, 0x6B,
+  0x4F, 0x3E, 0x3F, 0x53, 0x72, 0x97, 0xB1, 0xBF, 0xBB, 0xA8, 0x89, 0x64,
+  0x4A, 0x3C, 0x43, 0x58, 0x79, 0x9E, 0xB5, 0xC1, 0xB9, 0xA4, 0x82, 0x5F,
+  0x48, 0x3D, 0x48, 0x60, 0x84, 0xA6, 0xBA, 0xC1, 0xB6, 0x9E, 0x7A, 0x59,
+  0x43, 0x3D, 0x4C, 0x66, 0x8C, 0xAB, 0xBD, 0xBF, 0xB1, 0x97, 0x71, 0x53,
+  0x40, 0x3E, 0x50, 0x6D, 0x93, 0xAF, 0xBF, 0xBD, 0xAC, 0x8F, 0x68, 0x4D,
+  0x3D, 0x41, 0x54, 0x73, 0x99, 0xB2, 0xC0, 0xBA, 0xA6, 0x86, 0x61, 0x48,
+  0x3C, 0x44, 0x59, 0x7C, 0xA0, 0xB6, 0xC0, 0xB7, 0xA1, 0x7E, 0x5B, 0x44,
+  0x3B, 0x48, 0x60, 0x85, 0xA6, 0xBA, 0xC1, 0xB4, 0x9C, 0x76, 0x56, 0x42,
+  0x3D, 0x4D, 0x69, 0x8E, 0xAC, 0xBD, 0xBE, 0xAF, 0x94, 0x6E, 0x51, 0x3E,
+  0x3F, 0x51, 0x70, 0x96, 0xB0, 0xBF, 0xBC, 0xAA, 0x8C, 0x67, 0x4D, 0x3E,
+  0x43, 0x58, 0x77, 0x9C, 0xB5, 0xC0, 0xBA, 0xA6, 0x84, 0x5F, 0x46, 0x3B,
+  0x45, 0x5C, 0x7F, 0xA2, 0xB8, 0xC0, 0xB6, 0xA0, 0x7B, 0x59, 0x42, 0x3B,
+  0x49, 0x62, 0x88, 0xA8, 0xBB, 0xBF, 0xB2, 0x99, 0x73, 0x54, 0x40, 0x3E,
+  0x4F, 0x6C, 0x92, 0xAE, 0xBF, 0xBF, 0xAF, 0x92, 0x6C, 0x50, 0x3E, 0x41,
+  0x54, 0x73, 0x98, 0xB3, 0xC1, 0xBD, 0xAA, 0x89, 0x65, 0x4A, 0x3C, 0x44,
+  0x58, 0x7B, 0x9F, 0xB6, 0xC1, 0xB8, 0xA4, 0x82, 0x5E, 0x45, 0x3B, 0x46,
+  0x5E, 0x82, 0xA5, 0xB9, 0xC0, 0xB4, 0x9D, 0x78, 0x57, 0x42, 0x3C, 0x4A,
+  0x65, 0x8A, 0xA9, 0xBC, 0xBF, 0xB0, 0x95, 0x6F, 0x52, 0x3E, 0x3E, 0x50,
+  0x6C, 0x92, 0xAF, 0xBE, 0xBD, 0xAB, 0x8E, 0x69, 0x4D, 0x3D, 0x41, 0x55,
+  0x75, 0x9B, 0xB3, 0xC0, 0xBB, 0xA8, 0x87, 0x62, 0x49, 0x3B, 0x45, 0x5B,
+  0x7D, 0xA0, 0xB7, 0xC0, 0xB6, 0xA1, 0x7F, 0x5C, 0x45, 0x3C, 0x4A, 0x64,
+  0x89, 0xAB, 0xBF, 0xC4, 0xB8, 0x9E, 0x78, 0x58, 0x42, 0x3D, 0x4D, 0x68,
+  0x8E, 0xAD, 0xBE, 0xC0, 0xB1, 0x96, 0x70, 0x51, 0x3E, 0x3E, 0x51, 0x6F,
+  0x95, 0xB1, 0xC0, 0xBE, 0xAC, 0x8D, 0x67, 0x4C, 0x3C, 0x41, 0x56, 0x77,
+  0x9D, 0xB6, 0xC3, 0xBC, 0xA8, 0x86, 0x62, 0x49, 0x3C, 0x46, 0x5D, 0x80,
+  0xA3, 0xBA, 0xC2, 0xB7, 0xA1, 0x7C, 0x5A, 0x44, 0x3C, 0x4A, 0x62, 0x88,
+  0xA9, 0xBC, 0xC1, 0xB4, 0x9A, 0x74, 0x54, 0x40, 0x3D, 0x4D, 0x69, 0x90,
+  0xAE, 0xBE, 0xBE, 0xAE, 0x91, 0x6B, 0x4E, 0x3C, 0x3E, 0x51, 0x71, 0x97,
+  0xB1, 0xBF, 0xBB, 0xA9, 0x89, 0x63, 0x49, 0x3B, 0x41, 0x57, 0x79, 0x9D,
+  0xB5, 0xC0, 0xB8, 0xA3, 0x80, 0x5D, 0x45, 0x3A, 0x46, 0x5D, 0x82, 0xA5,
+  0xBA, 0xC2, 0xB6, 0x9E, 0x79, 0x57, 0x41, 0x3B, 0x49, 0x63, 0x8B, 0xAC,
+  0xBE, 0xC1, 0xB2, 0x97, 0x71, 0x54, 0x43, 0x44, 0x53, 0x6F, 0x8C, 0x91,
+  0x90, 0x9A, 0x9C, 0xA6, 0xB4, 0xB3, 0xC6, 0xC8, 0xCB, 0xD0, 0xCD, 0xD0,
+  0xCE, 0xCA, 0xC3, 0xC1, 0xB4, 0xB4, 0xA1, 0x97, 0x8C, 0x6C, 0x60, 0x7E,
+  0x92, 0x9E, 0xC0, 0xC8, 0xA9, 0x91, 0x8C, 0x78, 0x77, 0x6B, 0x64, 0x63,
+  0x5E, 0x5F, 0x59, 0x58, 0x5B, 0x63, 0x62, 0x6A, 0x6B, 0x71, 0x7E, 0x7E,
+  0x8F, 0x96, 0x9D, 0xA9, 0xA8, 0xB4, 0xB5, 0xB7, 0xBA, 0xB9, 0xBC, 0xBC,
+  0xB6, 0xAF, 0xAE, 0xA5, 0xA4, 0x99, 0x8F, 0x8C, 0x7A, 0x79, 0x67, 0x57,
+  0x55, 0x48, 0x48, 0x43, 0x40, 0x42, 0x4B, 0x4D, 0x59, 0x60, 0x68, 0x80,
+  0x81, 0x95, 0xA0, 0xA2, 0xAC, 0xAA, 0xAF, 0xAE, 0xAD, 0xA3, 0xA4, 0x96,
+  0x94, 0x85, 0x73, 0x6E, 0x49, 0x32, 0x4B, 0x6F, 0x78, 0x9A, 0xAD, 0x93,
+  0x74, 0x71, 0x5E, 0x59, 0x53, 0x48, 0x4A, 0x43, 0x46, 0x41, 0x3F, 0x41,
+  0x49, 0x4B, 0x51, 0x56, 0x59, 0x68, 0x6A, 0x78, 0x84, 0x86, 0x96, 0x95,
+  0x9E, 0xA4, 0xA4, 0xA9, 0xA7, 0xAA, 0xAB, 0xA7, 0xA0, 0x9F, 0x98, 0x95,
+  0x90, 0x83, 0x83, 0x73, 0x6E, 0x65, 0x51, 0x50, 0x44, 0x41, 0x3F, 0x3B,
+  0x3D, 0x44, 0x48, 0x51, 0x5D, 0x5E, 0x76, 0x7C, 0x88, 0x9B, 0x9A, 0xA6,
+  0xA5, 0xA8, 0xA9, 0xA9, 0xA2, 0xA2, 0x98, 0x92, 0x8C, 0x75, 0x72, 0x57,
+  0x37, 0x47, 0x6C, 0x75, 0x8F, 0xAA, 0x9C, 0x7A, 0x72, 0x65, 0x5B, 0x59,
+  0x4B, 0x4E, 0x49, 0x49, 0x47, 0x43, 0x44, 0x4B, 0x4F, 0x53, 0x5A, 0x5A,
+  0x66, 0x6B, 0x74, 0x84, 0x85, 0x94, 0x97, 0x9C, 0xA7, 0xA6, 0xAA, 0xA9,
+  0xAC, 0xAE, 0xAC, 0xA7, 0xA3, 0x9F, 0x99, 0x98, 0x89, 0x87, 0x7D, 0x72,
+  0x6E, 0x57, 0x55, 0x4C, 0x45, 0x46, 0x40, 0x41, 0x47, 0x4D, 0x51, 0x60,
+  0x62, 0x75, 0x82, 0x88, 0x9E, 0x9E, 0xA8, 0xAB, 0xAC, 0xAE, 0xAE, 0xA7,
+  0xA5, 0x9F, 0x94, 0x93, 0x7C, 0x76, 0x64, 0x40, 0x40, 0x68, 0x76, 0x86,
+  0xA7, 0xA4, 0x84, 0x75, 0x6D, 0x5E, 0x5F, 0x51, 0x51, 0x4D, 0x4B, 0x4C,
+  0x47, 0x47, 0x4C, 0x52, 0x53, 0x5A, 0x5C, 0x66, 0x6E, 0x72, 0x83, 0x85,
+  0x90, 0x99, 0x9A, 0xA6, 0xA5, 0xA9, 0xAA, 0xAB, 0xAE, 0xAD, 0xA8, 0xA4,
+  0xA1, 0x9B, 0x9A, 0x8F, 0x89, 0x84, 0x77, 0x77, 0x62, 0x5B, 0x56, 0x4C,
+  0x4C, 0x48, 0x47, 0x4B, 0x52, 0x54, 0x61, 0x65, 0x71, 0x84, 0x86, 0x9C,
+  0xA0, 0xA5, 0xAC, 0xAB, 0xAF, 0xAE, 0xAB, 0xA5, 0xA4, 0x97, 0x97, 0x85,
+  0x7A, 0x6D, 0x4A, 0x40, 0x60, 0x78, 0x81, 0xA3, 0xAA, 0x8C, 0x78, 0x74,
+  0x62, 0x62, 0x59, 0x53, 0x53, 0x4E, 0x50, 0x4C, 0x4B, 0x4E, 0x55, 0x56,
+  0x5D, 0x5F, 0x66, 0x71, 0x72, 0x83, 0x89, 0x90, 0x9C, 0x9C, 0xA7, 0xA9,
+  0xAC, 0xAF, 0xAE, 0xB1, 0xB2, 0xAE, 0xA8, 0xA7, 0x9F, 0x9E, 0x96, 0x8C,
+  0x8A, 0x7A, 0x79, 0x6A, 0x5C, 0x5B, 0x4F, 0x4E, 0x4A, 0x48, 0x4B, 0x53,
+  0x56, 0x60, 0x67, 0x6E, 0x83, 0x84, 0x95, 0x9E, 0x9F, 0xA8, 0xA7, 0xAA,
+  0xA9, 0xA9, 0xA0, 0xA2, 0x96, 0x94, 0x88, 0x79, 0x74, 0x56, 0x43, 0x58,
+  0x75, 0x7D, 0x9B, 0xA9, 0x95, 0x7B, 0x78, 0x69, 0x64, 0x60, 0x56, 0x58,
+  0x53, 0x55, 0x51, 0x4F, 0x50, 0x58, 0x5A, 0x60, 0x64, 0x67, 0x73, 0x74,
+  0x80, 0x8B, 0x8E, 0x9B, 0x9B, 0xA3, 0xA9, 0xA9, 0xAD, 0xAB, 0xAE, 0xAF,
+  0xAD, 0xA7, 0xA5, 0xA0, 0x9C, 0x98, 0x8D, 0x8C, 0x7E, 0x7B, 0x73, 0x60,
+  0x5F, 0x54, 0x52, 0x50, 0x4D, 0x4E, 0x55, 0x57, 0x5E, 0x69, 0x6A, 0x7F,
+  0x84, 0x8F, 0xA0, 0x9F, 0xA8, 0xA9, 0xAB, 0xAC, 0xAC, 0xA5, 0xA5, 0x9C,
+  0x96, 0x91, 0x7D, 0x7A, 0x61, 0x46, 0x51, 0x72, 0x7C, 0x94, 0xAB, 0x9E,
+  0x81, 0x7A, 0x71, 0x66, 0x65, 0x59, 0x5B, 0x55, 0x56, 0x55, 0x51, 0x52,
+  0x58, 0x5B, 0x5E, 0x65, 0x65, 0x71, 0x74, 0x7C, 0x8A, 0x8B, 0x98, 0x9B,
+  0x9E, 0xA6, 0xA5, 0xAA, 0xA9, 0xAA, 0xAD, 0xAB, 0xA5, 0xA3, 0x9E, 0x9A,
+  0x98, 0x8C, 0x8A, 0x81, 0x78, 0x75, 0x63, 0x60, 0x59, 0x53, 0x53, 0x4F,
+  0x4F, 0x54, 0x59, 0x5C, 0x68, 0x6A, 0x7A, 0x85, 0x89, 0x9B, 0x9C, 0xA4,
+  0xA7, 0xA8, 0xAA, 0xAA, 0xA5, 0xA2, 0x9E, 0x95, 0x94, 0x83, 0x7D, 0x6E,
+  0x4F, 0x50, 0x70, 0x7C, 0x8B, 0xA7, 0xA5, 0x89, 0x7C, 0x75, 0x67, 0x69,
+  0x5D, 0x5D, 0x5A, 0x58, 0x58, 0x54, 0x54, 0x58, 0x5E, 0x5F, 0x65, 0x66,
+  0x6E, 0x75, 0x79, 0x88, 0x8A, 0x93, 0x9A, 0x9B, 0xA5, 0xA5, 0xA9, 0xA9,
+  0xAA, 0xAC, 0xAB, 0xA7, 0xA3, 0xA1, 0x9B, 0x9B, 0x90, 0x8C, 0x87, 0x7A,
+  0x79, 0x67, 0x60, 0x5D, 0x54, 0x55, 0x51, 0x4F, 0x53, 0x59, 0x5B, 0x67,
+  0x6A, 0x74, 0x85, 0x87, 0x9B, 0x9E, 0xA3, 0xA8, 0xA8, 0xAB, 0xAB, 0xA8,
+  0xA3, 0xA2, 0x95, 0x97, 0x86, 0x7C, 0x75, 0x56, 0x4A, 0x67, 0x7B, 0x83,
+  0x9E, 0xA5, 0x8F, 0x7C, 0x78, 0x6A, 0x69, 0x62, 0x5D, 0x5D, 0x58, 0x5A,
+  0x56, 0x55, 0x57, 0x5D, 0x5E, 0x64, 0x65, 0x6A, 0x73, 0x75, 0x81, 0x87,
+  0x8C, 0x96, 0x97, 0x9F, 0xA2, 0xA3, 0xA5, 0xA4, 0xA7, 0xA8, 0xA4, 0xA0,
+  0xA0, 0x99, 0x98, 0x92, 0x8A, 0x88, 0x7C, 0x7A, 0x6F, 0x63, 0x63, 0x5A,
+  0x59, 0x56, 0x54, 0x56, 0x5C, 0x5E, 0x66, 0x6D, 0x71, 0x83, 0x86, 0x94,
+  0x9D, 0x9F, 0xA6, 0xA5, 0xA8, 0xA8, 0xA7, 0xA1, 0xA1, 0x97, 0x95, 0x8C,
+  0x7E, 0x79, 0x5E, 0x4D, 0x5F, 0x7A, 0x7F, 0x97, 0xA6, 0x94, 0x7E, 0x7A,
+  0x6E, 0x69, 0x66, 0x5D, 0x5E, 0x59, 0x5B, 0x58, 0x57, 0x57, 0x5D, 0x60,
+  0x63, 0x67, 0x69, 0x74, 0x75, 0x80, 0x89, 0x8B, 0x97, 0x98, 0x9E, 0xA3,
+  0xA3, 0xA6, 0xA6, 0xA8, 0xAA, 0xA8, 0xA3, 0xA2, 0x9D, 0x99, 0x97, 0x8D,
+  0x8B, 0x80, 0x7B, 0x75, 0x64, 0x64, 0x5B, 0x58, 0x57, 0x54, 0x55, 0x5B,
+  0x5F, 0x64, 0x6D, 0x6F, 0x80, 0x84, 0x8D, 0x9A, 0x99, 0xA2, 0xA2, 0xA4,
+  0xA4, 0xA3, 0x9D, 0x9D, 0x96, 0x90, 0x8C, 0x7C, 0x7A, 0x66, 0x50, 0x59,
+  0x73, 0x7B, 0x8F, 0xA2, 0x98, 0x80, 0x7A, 0x72, 0x69, 0x69, 0x5F, 0x60,
+  0x5C, 0x5D, 0x5B, 0x59, 0x59, 0x5D, 0x61, 0x63, 0x69, 0x6A, 0x73, 0x77,
+  0x7E, 0x89, 0x8A, 0x95, 0x97, 0x9B, 0xA2, 0xA1, 0xA5, 0xA5, 0xA6, 0xA7,
+  0xA6, 0xA1, 0xA0, 0x9D, 0x98, 0x97, 0x8D, 0x8B, 0x83, 0x7B, 0x79, 0x69,
+  0x66, 0x60, 0x5B, 0x5B, 0x58, 0x57, 0x5B, 0x60, 0x62, 0x6D, 0x6E, 0x7B,
+  0x84, 0x88, 0x98, 0x99, 0xA0, 0xA2, 0xA3, 0xA5, 0xA4, 0xA0, 0x9E, 0x9A,
+  0x92, 0x91, 0x81, 0x7C, 0x6F, 0x55, 0x54, 0x6F, 0x7C, 0x88, 0xA1, 0x9F,
+  0x87, 0x7C, 0x77, 0x6B, 0x6B, 0x62, 0x61, 0x60, 0x5E, 0x5E, 0x5B, 0x5A,
+  0x5E, 0x63, 0x64, 0x69, 0x69, 0x71, 0x77, 0x7A, 0x87, 0x89, 0x91, 0x96,
+  0x94, 0x99, 0x99, 0x9C, 0x9C, 0x9D, 0x9E, 0x9E, 0x9B, 0x98, 0x97, 0x93,
+  0x92, 0x8B, 0x87, 0x84, 0x7B, 0x7A, 0x6F, 0x69, 0x66, 0x60, 0x60, 0x5E,
+  0x5D, 0x5F, 0x63, 0x65, 0x6D, 0x6F, 0x76, 0x82, 0x83, 0x8F, 0x93, 0x97,
+  0x9A, 0x9B, 0x9D, 0x9C, 0x9A, 0x97, 0x97, 0x8E, 0x8F, 0x84, 0x7D, 0x77,
+  0x64, 0x5C, 0x6F, 0x7D, 0x83, 0x97, 0x9C, 0x8C, 0x7F, 0x7B, 0x71, 0x70,
+  0x6B, 0x67, 0x67, 0x65, 0x66, 0x62, 0x61, 0x63, 0x68, 0x69, 0x6C, 0x6E,
+  0x72, 0x79, 0x7A, 0x83, 0x87, 0x8B, 0x92, 0x92, 0x99, 0x9B, 0x9C, 0x9D,
+  0x9D, 0x9E, 0x9F, 0x9C, 0x99, 0x97, 0x93, 0x92, 0x8E, 0x88, 0x87, 0x7E,
+  0x7C, 0x73, 0x6A, 0x69, 0x62, 0x62, 0x60, 0x5E, 0x60, 0x65, 0x66, 0x6C,
+  0x72, 0x74, 0x82, 0x84, 0x8E, 0x95, 0x96, 0x9C, 0x9B, 0x9E, 0x9E, 0x9D,
+  0x98, 0x99, 0x91, 0x91, 0x89, 0x7F, 0x7B, 0x6A, 0x5E, 0x6B, 0x7B, 0x81,
+  0xAE, 0xD1, 0xBF, 0x9B, 0x86, 0x5B, 0x3D, 0x28, 0x16, 0x20, 0x2A, 0x44,
+  0x5F, 0x6F, 0x7A, 0x7F, 0x76, 0x66, 0x4F, 0x3B, 0x3B, 0x3A, 0x50, 0x6C,
+  0x89, 0xB1, 0xC2, 0xD3, 0xD2, 0xC1, 0xA9, 0x8C, 0x7D, 0x75, 0x77, 0x7F,
+  0x95, 0xAD, 0xBF, 0xC6, 0xBA, 0xAE, 0x8D, 0x6B, 0x48, 0x23, 0x1F, 0x21,
+  0x35, 0x53, 0x6A, 0x7B, 0x87, 0x84, 0x7C, 0x6F, 0x54, 0x57, 0x52, 0x60,
+  0x7E, 0x93, 0xBC, 0xD3, 0xE4, 0xE6, 0xDB, 0xBF, 0x9F, 0x7D, 0x67, 0x5E,
+  0x53, 0x60, 0x62, 0x62, 0x7F, 0xAB, 0xAD, 0xB5, 0xB7, 0x8B, 0x57, 0x43,
+  0x38, 0x3C, 0x54, 0x67, 0x80, 0x87, 0x8A, 0x7E, 0x68, 0x4A, 0x35, 0x28,
+  0x24, 0x35, 0x48, 0x71, 0x90, 0xA7, 0xBD, 0xBB, 0xBB, 0xA7, 0x8F, 0x84,
+  0x77, 0x7C, 0x87, 0x9E, 0xC0, 0xD7, 0xE0, 0xE1, 0xD2, 0xB9, 0x9C, 0x75,
+  0x62, 0x4F, 0x4D, 0x5B, 0x61, 0x7C, 0x84, 0x87, 0x84, 0x74, 0x5F, 0x45,
+  0x32, 0x25, 0x32, 0x42, 0x69, 0x93, 0xB1, 0xD4, 0xD8, 0xD8, 0xC8, 0xAE,
+  0x93, 0x80, 0x72, 0x75, 0x81, 0x92, 0xB2, 0xB3, 0xB9, 0xA3, 0x71, 0x5A,
+  0x5D, 0x54, 0x56, 0x72, 0x7B, 0x70, 0x84, 0x99, 0x9A, 0xA0, 0x8B, 0x78,
+  0x56, 0x34, 0x1E, 0x0F, 0x16, 0x2F, 0x52, 0x73, 0x8E, 0x99, 0xA1, 0x9C,
+  0x8B, 0x7D, 0x69, 0x66, 0x69, 0x74, 0x91, 0xAE, 0xD0, 0xE4, 0xEC, 0xE6,
+  0xD2, 0xB0, 0x8E, 0x7A, 0x6A, 0x6D, 0x72, 0x82, 0x9A, 0xA1, 0xAC, 0x9B,
+  0x8A, 0x73, 0x4C, 0x30, 0x18, 0x11, 0x22, 0x3E, 0x5E, 0x86, 0x99, 0xAB,
+  0xB6, 0xA8, 0xA1, 0x89, 0x7C, 0x77, 0x78, 0x88, 0x9C, 0xB4, 0xC6, 0xD2,
+  0xC9, 0xBE, 0x9C, 0x77, 0x57, 0x2D, 0x1E, 0x3F, 0x63, 0x85, 0xB9, 0xCD,
+  0xBD, 0xA8, 0x99, 0x75, 0x58, 0x3C, 0x2B, 0x2D, 0x37, 0x4D, 0x65, 0x7A,
+  0x89, 0x91, 0x88, 0x7D, 0x63, 0x4D, 0x47, 0x42, 0x59, 0x6E, 0x8E, 0xB7,
+  0xC9, 0xDD, 0xDC, 0xCF, 0xB7, 0x98, 0x85, 0x78, 0x75, 0x7C, 0x8F, 0xA7,
+  0xBD, 0xC3, 0xBF, 0xB5, 0x97, 0x7A, 0x50, 0x2D, 0x21, 0x1E, 0x32, 0x4D,
+  0x69, 0x7D, 0x8D, 0x8C, 0x89, 0x7A, 0x61, 0x5E, 0x51, 0x5E, 0x73, 0x89,
+  0xB0, 0xCA, 0xDD, 0xE3, 0xDB, 0xC1, 0xA5, 0x7C, 0x69, 0x55, 0x4C, 0x57,
+  0x56, 0x60, 0x89, 0xAF, 0xB3, 0xC1, 0xBC, 0x8B, 0x5B, 0x46, 0x34, 0x3B,
+  0x4B, 0x62, 0x7F, 0x89, 0x91, 0x86, 0x74, 0x5A, 0x42, 0x2F, 0x27, 0x31,
+  0x45, 0x6A, 0x8A, 0xAA, 0xBF, 0xC1, 0xC2, 0xAE, 0x97, 0x84, 0x74, 0x74,
+  0x7D, 0x92, 0xB0, 0xCB, 0xD8, 0xDE, 0xD0, 0xBC, 0x9E, 0x75, 0x61, 0x47,
+  0x46, 0x4D, 0x55, 0x74, 0x7F, 0x88, 0x88, 0x7C, 0x69, 0x51, 0x39, 0x2C,
+  0x31, 0x3C, 0x62, 0x85, 0xAF, 0xD1, 0xD9, 0xDE, 0xCD, 0xB6, 0x97, 0x81,
+  0x6D, 0x6F, 0x74, 0x86, 0xA4, 0xAB, 0xB6, 0x9D, 0x75, 0x6D, 0x6F, 0x5A,
+  0x5B, 0x6A, 0x69, 0x5F, 0x77, 0x8F, 0x99, 0xA3, 0x93, 0x85, 0x63, 0x3F,
+  0x24, 0x11, 0x13, 0x2B, 0x49, 0x6D, 0x8C, 0x9A, 0xA7, 0xA2, 0x96, 0x84,
+  0x69, 0x63, 0x5E, 0x69, 0x81, 0x9C, 0xC1, 0xDA, 0xE8, 0xE6, 0xD3, 0xB2,
+  0x8F, 0x74, 0x62, 0x61, 0x63, 0x75, 0x8B, 0x9C, 0xA7, 0x9B, 0x92, 0x7B,
+  0x58, 0x38, 0x1E, 0x12, 0x1F, 0x38, 0x59, 0x83, 0x98, 0xB1, 0xBA, 0xB1,
+  0xAB, 0x8C, 0x7D, 0x72, 0x70, 0x7D, 0x8F, 0xA7, 0xBF, 0xCC, 0xCA, 0xC1,
+  0xA1, 0x80, 0x57, 0x2C, 0x22, 0x41, 0x5C, 0x7F, 0xB4, 0xC4, 0xB8, 0xAD,
+  0x9C, 0x7E, 0x61, 0x3F, 0x2E, 0x28, 0x32, 0x45, 0x5E, 0x78, 0x8B, 0x96,
+  0x91, 0x88, 0x6E, 0x58, 0x49, 0x40, 0x52, 0x63, 0x84, 0xAB, 0xC3, 0xDC,
+  0xDD, 0xD3, 0xBD, 0x9E, 0x86, 0x75, 0x6D, 0x73, 0x83, 0x9A, 0xB5, 0xBD,
+  0xC0, 0xB7, 0x9D, 0x84, 0x54, 0x34, 0x22, 0x1C, 0x2E, 0x46, 0x66, 0x7F,
+  0x92, 0x95, 0x94, 0x82, 0x6A, 0x5E, 0x4F, 0x5E, 0x71, 0x8D, 0xB5, 0xD1,
+  0xE4, 0xE6, 0xD2, 0xAF, 0x8A, 0x66, 0x57, 0x4C, 0x54, 0x69, 0x70, 0x7D,
+  0xA1, 0xAE, 0xA6, 0xA2, 0x87, 0x5B, 0x3C, 0x3F, 0x46, 0x67, 0x81, 0x91,
+  0x99, 0x8D, 0x7A, 0x54, 0x32, 0x1F, 0x1F, 0x2D, 0x4C, 0x6F, 0x8F, 0xA8,
+  0xAE, 0xB0, 0xA0, 0x85, 0x72, 0x62, 0x67, 0x76, 0x8F, 0xB4, 0xD0, 0xE4,
+  0xE5, 0xD2, 0xB2, 0x8F, 0x72, 0x61, 0x5C, 0x64, 0x7C, 0x91, 0xA6, 0xA7,
+  0x99, 0x8A, 0x67, 0x44, 0x27, 0x15, 0x1D, 0x38, 0x59, 0x83, 0x9D, 0xAA,
+  0xB6, 0xA6, 0x94, 0x7F, 0x6D, 0x6B, 0x72, 0x87, 0xA3, 0xBD, 0xCB, 0xD3,
+  0xC2, 0xAC, 0x85, 0x5E, 0x4A, 0x2E, 0x29, 0x4B, 0x81, 0xA1, 0xC4, 0xD3,
+  0xB9, 0x92, 0x72, 0x4D, 0x38, 0x33, 0x39, 0x53, 0x6E, 0x86, 0x90, 0x8F,
+  0x83, 0x71, 0x52, 0x3B, 0x2E, 0x33, 0x50, 0x6D, 0x97, 0xB5, 0xC4, 0xCB,
+  0xBC, 0xA4, 0x86, 0x71, 0x68, 0x6D, 0x81, 0xA0, 0xC0, 0xD3, 0xDB, 0xCD,
+  0xB7, 0x94, 0x6C, 0x57, 0x43, 0x49, 0x58, 0x6B, 0x88, 0x91, 0x94, 0x8A,
+  0x73, 0x53, 0x38, 0x25, 0x26, 0x3C, 0x56, 0x89, 0xAA, 0xC2, 0xD1, 0xC3,
+  0xB3, 0x91, 0x79, 0x6A, 0x6A, 0x73, 0x8B, 0xA6, 0xBC, 0xC7, 0xB6, 0xA4,
+  0x79, 0x42, 0x32, 0x3D, 0x46, 0x68, 0x98, 0xB1, 0xB2, 0xB6, 0xA8, 0x90,
+  0x73, 0x49, 0x34, 0x24, 0x2E, 0x40, 0x5C, 0x7C, 0x92, 0x9D, 0x98, 0x8A,
+  0x6B, 0x54, 0x43, 0x42, 0x58, 0x6E, 0x98, 0xB8, 0xCF, 0xDC, 0xD1, 0xBC,
+  0x99, 0x7E, 0x6E, 0x6A, 0x74, 0x88, 0xA6, 0xBE, 0xCC, 0xC3, 0xB3, 0x95,
+  0x6C, 0x4D, 0x2C, 0x2A, 0x36, 0x4E, 0x71, 0x85, 0x91, 0x92, 0x88, 0x6F,
+  0x57, 0x40, 0x3E, 0x4D, 0x64, 0x91, 0xB4, 0xD4, 0xE3, 0xE0, 0xCE, 0xAC,
+  0x82, 0x69, 0x5A, 0x5B, 0x71, 0x84, 0xA2, 0xA8, 0x94, 0x8A, 0x90, 0x78,
+  0x64, 0x64, 0x5B, 0x51, 0x5E, 0x80, 0x95, 0xA9, 0xA3, 0x95, 0x79, 0x50,
+  0x2F, 0x19, 0x17, 0x2E, 0x50, 0x76, 0x95, 0xA4, 0xAA, 0xA1, 0x8A, 0x71,
+  0x5A, 0x51, 0x5A, 0x6C, 0x8E, 0xB2, 0xCF, 0xDF, 0xDA, 0xC9, 0xA9, 0x84,
+  0x6A, 0x5D, 0x5F, 0x70, 0x87, 0xA4, 0xB4, 0xB4, 0xAD, 0x8E, 0x69, 0x44,
+  0x24, 0x1A, 0x23, 0x3B, 0x62, 0x85, 0x98, 0xA6, 0x9F, 0x93, 0x7F, 0x62,
+  0x5F, 0x5C, 0x6C, 0x88, 0xA8, 0xC7, 0xD9, 0xDB, 0xCA, 0xB0, 0x83, 0x69,
+  0x4D, 0x44, 0x4B, 0x4F, 0x69, 0x98, 0xB5, 0xB9, 0xBF, 0xAB, 0x78, 0x50,
+  0x3F, 0x36, 0x47, 0x5F, 0x7D, 0x93, 0x9B, 0x99, 0x84, 0x64, 0x42, 0x2F,
+  0x24, 0x32, 0x49, 0x6E, 0x96, 0xAA, 0xBD, 0xBA, 0xAB, 0x92, 0x72, 0x66,
+  0x60, 0x6C, 0x84, 0xA6, 0xC9, 0xDE, 0xDF, 0xCE, 0xB3, 0x8C, 0x6F, 0x58,
+  0x4E, 0x5A, 0x68, 0x8A, 0x9B, 0xA0, 0xA0, 0x8C, 0x73, 0x4E, 0x2E, 0x1C,
+  0x23, 0x37, 0x5B, 0x86, 0xA3, 0xBD, 0xBB, 0xB3, 0x9C, 0x7B, 0x68, 0x5A,
+  0x62, 0x73, 0x8F, 0xAC, 0xC3, 0xC9, 0xC1, 0xA9, 0x82, 0x5F, 0x3A, 0x23,
+  0x35, 0x59, 0x7E, 0xAC, 0xC8, 0xC4, 0xAD, 0x97, 0x70, 0x4F, 0x38, 0x2D,
+  0x3A, 0x4E, 0x71, 0x8A, 0x9A, 0x9F, 0x97, 0x82, 0x61, 0x45, 0x33, 0x39,
+  0x4A, 0x6A, 0x93, 0xB1, 0xC9, 0xCC, 0xC1, 0xA8, 0x84, 0x6C, 0x5C, 0x60,
+  0x72, 0x8E, 0xB0, 0xC9, 0xD3, 0xCC, 0xB8, 0x93, 0x6F, 0x4E, 0x3C, 0x3E,
+  0x48, 0x69, 0x85, 0x99, 0xA1, 0x99, 0x87, 0x6A, 0x49, 0x35, 0x31, 0x3D,
+  0x60, 0x87, 0xAE, 0xCD, 0xD4, 0xCF, 0xB7, 0x94, 0x75, 0x60, 0x57, 0x64,
+  0x77, 0x99, 0xB6, 0xBC, 0xBE, 0xA1, 0x76, 0x56, 0x4C, 0x3F, 0x4A, 0x6A,
+  0x81, 0x96, 0xAD, 0xB6, 0xAE, 0x9C, 0x79, 0x53, 0x33, 0x23, 0x28, 0x3B,
+  0x5A, 0x82, 0x9C, 0xA9, 0xA8, 0x97, 0x7E, 0x5D, 0x4A, 0x46, 0x4F, 0x6B,
+  0x8F, 0xB2, 0xCD, 0xD6, 0xCC, 0xB2, 0x8C, 0x6D, 0x5B, 0x59, 0x6A, 0x88,
+  0xAB, 0xC3, 0xC7, 0xBC, 0xA0, 0x76, 0x54, 0x34, 0x2F, 0x3E, 0x5A, 0x80,
+  0x98, 0xA3, 0x9F, 0x8D, 0x69, 0x4E, 0x37, 0x3B, 0x52, 0x71, 0xA3, 0xC1,
+  0xD4, 0xD1, 0xBE, 0x9B, 0x74, 0x59, 0x51, 0x5D, 0x74, 0x9C, 0xB1, 0xBE,
+  0xB3, 0x8D, 0x6B, 0x56, 0x44, 0x41, 0x5D, 0x79, 0x92, 0xAC, 0xBA, 0xB2,
+  0xA0, 0x79, 0x51, 0x33, 0x26, 0x32, 0x4A, 0x70, 0x92, 0xA8, 0xAA, 0xA0,
+  0x82, 0x5F, 0x48, 0x3B, 0x4C, 0x65, 0x8C, 0xB3, 0xC9, 0xD4, 0xC7, 0xAB,
+  0x85, 0x69, 0x59, 0x5F, 0x72, 0x92, 0xB6, 0xC8, 0xCE, 0xBB, 0x9E, 0x76,
+  0x51, 0x3D, 0x37, 0x46, 0x67, 0x88, 0x9D, 0xA4, 0x99, 0x83, 0x61, 0x41,
+  0x33, 0x35, 0x4C, 0x77, 0x9F, 0xC1, 0xD0, 0xC9, 0xB6, 0x90, 0x70, 0x5C,
+  0x58, 0x66, 0x83, 0xA2, 0xBD, 0xC2, 0xB5, 0x9C, 0x69, 0x41, 0x39, 0x3E,
+  0x51, 0x7C, 0xA5, 0xB7, 0xBB, 0xB5, 0x9B, 0x77, 0x50, 0x36, 0x2D, 0x3A,
+  0x55, 0x7A, 0x98, 0xA8, 0xAA, 0x99, 0x7A, 0x55, 0x3D, 0x38, 0x45, 0x64,
+  0x8E, 0xAF, 0xC8, 0xCA, 0xBD, 0x9E, 0x77, 0x5C, 0x50, 0x5A, 0x73, 0x98,
+  0xB8, 0xCC, 0xCB, 0xBA, 0x9A, 0x6E, 0x51, 0x3B, 0x41, 0x53, 0x71, 0x94,
+  0xA4, 0xA9, 0x9B, 0x7F, 0x57, 0x3C, 0x2B, 0x34, 0x4E, 0x74, 0xA2, 0xBB,
+  0xC8, 0xC1, 0xA9, 0x86, 0x68, 0x57, 0x59, 0x6B, 0x87, 0xAC, 0xBF, 0xC7,
+  0xB9, 0x9C, 0x75, 0x4A, 0x2D, 0x33, 0x51, 0x73, 0xA4, 0xC4, 0xC8, 0xB5,
+  0x9E, 0x75, 0x51, 0x3A, 0x32, 0x43, 0x5E, 0x84, 0x9C, 0xAA, 0xA4, 0x93,
+  0x70, 0x4E, 0x38, 0x33, 0x48, 0x66, 0x90, 0xB2, 0xC4, 0xC6, 0xB5, 0x94,
+  0x72, 0x59, 0x51, 0x5F, 0x7A, 0xA2, 0xC2, 0xD0, 0xCE, 0xB9, 0x96, 0x6E,
+  0x4F, 0x43, 0x49, 0x5F, 0x83, 0x9C, 0xAD, 0xAA, 0x99, 0x7A, 0x51, 0x35,
+  0x29, 0x34, 0x4F, 0x7B, 0x9F, 0xBB, 0xC2, 0xB5, 0x9E, 0x77, 0x5E, 0x4F,
+  0x56, 0x6C, 0x8F, 0xAF, 0xC5, 0xC8, 0xB9, 0x9D, 0x70, 0x51, 0x38, 0x30,
+  0x47, 0x75, 0x9E, 0xBC, 0xCB, 0xBC, 0x9A, 0x72, 0x50, 0x38, 0x37, 0x47,
+  0x67, 0x8B, 0xA3, 0xAD, 0xA5, 0x8C, 0x67, 0x48, 0x33, 0x33, 0x46, 0x69,
+  0x93, 0xB0, 0xC3, 0xBC, 0xAB, 0x87, 0x64, 0x51, 0x4D, 0x5E, 0x7D, 0xA5,
+  0xC3, 0xD3, 0xCB, 0xB5, 0x91, 0x69, 0x50, 0x45, 0x51, 0x6B, 0x8F, 0xAC,
+  0xB7, 0xB1, 0x9C, 0x76, 0x4F, 0x33, 0x28, 0x37, 0x56, 0x7F, 0xA4, 0xB7,
+  0xBB, 0xAF, 0x8F, 0x70, 0x56, 0x4C, 0x59, 0x71, 0x97, 0xB9, 0xCB, 0xCC,
+  0xBB, 0x97, 0x70, 0x4D, 0x3C, 0x3F, 0x4A, 0x6E, 0x9D, 0xB9, 0xC1, 0xBC,
+  0xA1, 0x71, 0x4E, 0x3B, 0x3A, 0x50, 0x71, 0x94, 0xA9, 0xAF, 0xA3, 0x88,
+  0x5E, 0x3F, 0x30, 0x33, 0x4B, 0x6F, 0x98, 0xB3, 0xBE, 0xB9, 0xA2, 0x7D,
+  0x5F, 0x4A, 0x49, 0x5C, 0x7F, 0xA6, 0xC2, 0xCF, 0xC6, 0xAD, 0x84, 0x61,
+  0x48, 0x44, 0x53, 0x71, 0x9A, 0xB3, 0xBF, 0xB5, 0x9D, 0x75, 0x4E, 0x34,
+  0x2E, 0x3E, 0x5D, 0x88, 0xA6, 0xB9, 0xB6, 0xA3, 0x83, 0x5F, 0x49, 0x43,
+  0x52, 0x70, 0x98, 0xB9, 0xCC, 0xCA, 0xB5, 0x92, 0x66, 0x4B, 0x3B, 0x43,
+  0x5D, 0x7F, 0x9D, 0xB8, 0xBE, 0xAE, 0x95, 0x6F, 0x4E, 0x39, 0x41, 0x56,
+  0x7E, 0xA1, 0xB4, 0xB8, 0xA8, 0x88, 0x5D, 0x3F, 0x2E, 0x39, 0x51, 0x79,
+  0x9F, 0xB6, 0xBF, 0xB2, 0x98, 0x71, 0x53, 0x44, 0x4A, 0x62, 0x87, 0xAE,
+  0xC6, 0xCF, 0xC3, 0xA8, 0x7F, 0x5C, 0x49, 0x49, 0x5C, 0x7E, 0xA2, 0xBB,
+  0xC2, 0xB6, 0x9B, 0x6F, 0x4B, 0x33, 0x31, 0x43, 0x65, 0x8E, 0xAA, 0xB7,
+  0xB0, 0x9D, 0x77, 0x58, 0x42, 0x41, 0x56, 0x75, 0xA1, 0xBF, 0xD0, 0xCB,
+  0xB4, 0x8A, 0x64, 0x49, 0x42, 0x50, 0x69, 0x8F, 0xA6, 0xB0, 0xB2, 0xA6,
+  0x85, 0x65, 0x50, 0x47, 0x43, 0x42, 0x43, 0x43, 0x43, 0x42, 0x44, 0x45,
+  0x47, 0x47, 0x48, 0x49, 0x4B, 0x4D, 0x4F, 0x50, 0x52, 0x55, 0x57, 0x5A,
+  0x5E, 0x60, 0x64, 0x66, 0x68, 0x6B, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x70,
+  0x70, 0x71, 0x70, 0x71, 0x70, 0x6F, 0x70, 0x6E, 0x6E, 0x6D, 0x6A, 0x6B,
+  0x69, 0x69, 0x6A, 0x69, 0x6A, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0x78, 0x7B,
+  0x7D, 0x81, 0x82, 0x84, 0x85, 0x86, 0x88, 0x88, 0x87, 0x88, 0x86, 0x85,
+  0x84, 0x81, 0x81, 0x7C, 0x76, 0x78, 0x7F, 0x82, 0x86, 0x8C, 0x8A, 0x85,
+  0x83, 0x82, 0x7F, 0x7F, 0x7D, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7D,
+  0x7F, 0x7F, 0x81, 0x81, 0x83, 0x84, 0x85, 0x88, 0x89, 0x8C, 0x8D, 0x8E,
+  0x8F, 0x90, 0x91, 0x90, 0x91, 0x92, 0x91, 0x91, 0x90, 0x8F, 0x8E, 0x8E,
+  0x8B, 0x8B, 0x89, 0x87, 0x87, 0x83, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E,
+  0x80, 0x82, 0x82, 0x84, 0x84, 0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8C,
+  0x8C, 0x8D, 0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x8A, 0x88, 0x88, 0x86, 0x83,
+  0x82, 0x85, 0x87, 0x89, 0x8C, 0x8C, 0x89, 0x87, 0x86, 0x84, 0x84, 0x82,
+  0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x83, 0x84,
+  0x85, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8A, 0x8B, 0x8B, 0x8C, 0x8B, 0x8C,
+  0x8B, 0x8C, 0x8B, 0x8C, 0x8B, 0x8A, 0x8A, 0x8B, 0x8A, 0x89, 0x88, 0x87,
+  0x86, 0x84, 0x85, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x83, 0x84, 0x86,
+  0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8C, 0x8B, 0x8C, 0x8C, 0x8B, 0x8A,
+  0x8A, 0x89, 0x89, 0x87, 0x86, 0x85, 0x82, 0x80, 0x82, 0x84, 0x86, 0x89,
+  0x8A, 0x87, 0x85, 0x85, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x80,
+  0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83, 0x84, 0x85, 0x85, 0x86,
+  0x88, 0x88, 0x86, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84,
+  0x83, 0x84, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x83, 0x84, 0x83, 0x84,
+  0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
+  0x84, 0x83, 0x83, 0x84, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
+  0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82,
+  0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
+  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x7F, 0x80, 0x7E, 0x7F, 0x82, 0x9D, 0xB7, 0xDA, 0xF3, 0xFA, 0xF9, 0xE7,
+  0xD0, 0xB8, 0xA4, 0xA0, 0xA2, 0xB1, 0xC1, 0xC2, 0xC1, 0x9D, 0x90, 0x92,
+  0x85, 0x8B, 0x9C, 0x8D, 0x91, 0xA9, 0xB2, 0xBA, 0xA9, 0x95, 0x70, 0x4A,
+  0x30, 0x26, 0x3D, 0x5A, 0x7D, 0x9A, 0xA7, 0xB0, 0xA4, 0x96, 0x7D, 0x71,
+  0x72, 0x80, 0x9D, 0xBD, 0xDB, 0xE7, 0xE7, 0xD7, 0xB6, 0x96, 0x7C, 0x71,
+  0x72, 0x7A, 0x94, 0xA0, 0xAA, 0x9C, 0x85, 0x69, 0x40, 0x29, 0x16, 0x1F,
+  0x38, 0x5B, 0x84, 0x98, 0xAB, 0xA8, 0x9D, 0x8D, 0x78, 0x75, 0x78, 0x8B,
+  0xA5, 0xBB, 0xCA, 0xC7, 0xB8, 0x98, 0x6B, 0x4D, 0x1E, 0x1F, 0x4E, 0x73,
+  0xA5, 0xCB, 0xB9, 0x9D, 0x84, 0x5C, 0x42, 0x2A, 0x27, 0x33, 0x4A, 0x65,
+  0x72, 0x7E, 0x7C, 0x6E, 0x55, 0x3C, 0x36, 0x38, 0x54, 0x73, 0x9A, 0xB8,
+  0xC9, 0xCC, 0xBA, 0xA0, 0x82, 0x74, 0x72, 0x77, 0x8C, 0xA7, 0xBA, 0xC0,
+  0xB3, 0x9E, 0x75, 0x52, 0x2E, 0x1E, 0x24, 0x35, 0x56, 0x69, 0x7A, 0x7D,
+  0x73, 0x63, 0x47, 0x42, 0x44, 0x59, 0x7C, 0x9E, 0xC2, 0xD3, 0xD9, 0xCC,
+  0xA9, 0x84, 0x64, 0x53, 0x50, 0x54, 0x6D, 0x65, 0x75, 0x9A, 0x9A, 0x98,
+  0x8E, 0x60, 0x3D, 0x38, 0x3C, 0x5A, 0x6F, 0x7D, 0x80, 0x72, 0x59, 0x32,
+  0x1D, 0x17, 0x21, 0x39, 0x5A, 0x82, 0x97, 0xAB, 0xA8, 0x9B, 0x83, 0x6D,
+  0x68, 0x6A, 0x7D, 0x9A, 0xBD, 0xD5, 0xD6, 0xCB, 0xB1, 0x8C, 0x6C, 0x52,
+  0x4D, 0x52, 0x68, 0x79, 0x84, 0x87, 0x79, 0x68, 0x43, 0x29, 0x1B, 0x1A,
+  0x35, 0x52, 0x86, 0xA8, 0xBC, 0xC5, 0xB6, 0xA1, 0x84, 0x75, 0x71, 0x76,
+  0x8C, 0xA5, 0xB9, 0xBB, 0xA7, 0x8D, 0x4F, 0x2E, 0x3A, 0x42, 0x62, 0x90,
+  0x9A, 0x9D, 0xA2, 0x93, 0x82, 0x5E, 0x3B, 0x23, 0x1A, 0x24, 0x37, 0x5A,
+  0x77, 0x89, 0x8F, 0x84, 0x76, 0x58, 0x50, 0x4D, 0x5D, 0x79, 0x9A, 0xC1,
+  0xD4, 0xDA, 0xCE, 0xB4, 0x93, 0x77, 0x68, 0x6A, 0x78, 0x92, 0xA8, 0xB4,
+  0xAE, 0x9F, 0x79, 0x4E, 0x2F, 0x17, 0x1B, 0x28, 0x4B, 0x70, 0x86, 0x98,
+  0x91, 0x8B, 0x76, 0x66, 0x65, 0x68, 0x7F, 0x99, 0xB9, 0xCE, 0xD3, 0xCA,
+  0xAF, 0x8A, 0x65, 0x47, 0x3D, 0x2C, 0x42, 0x7F, 0xA2, 0xBE, 0xCC, 0xA8,
+  0x78, 0x55, 0x38, 0x31, 0x36, 0x4C, 0x69, 0x7E, 0x86, 0x7F, 0x73, 0x59,
+  0x3E, 0x31, 0x2D, 0x44, 0x5E, 0x8C, 0xAB, 0xC0, 0xC7, 0xBA, 0xA6, 0x87,
+  0x77, 0x70, 0x7C, 0x94, 0xB0, 0xC9, 0xD4, 0xCF, 0xBA, 0x96, 0x70, 0x4D,
+  0x40, 0x3A, 0x47, 0x64, 0x76, 0x86, 0x82, 0x78, 0x65, 0x46, 0x3A, 0x2F,
+  0x45, 0x65, 0x90, 0xC0, 0xD5, 0xE2, 0xD9, 0xC1, 0x9B, 0x79, 0x68, 0x65,
+  0x74, 0x8C, 0x9E, 0xA8, 0x87, 0x77, 0x80, 0x6D, 0x68, 0x71, 0x5B, 0x55,
+  0x6E, 0x84, 0x97, 0x94, 0x87, 0x6C, 0x44, 0x22, 0x0E, 0x18, 0x32, 0x54,
+  0x7B, 0x91, 0xA6, 0xA1, 0x9A, 0x80, 0x68, 0x60, 0x61, 0x78, 0x94, 0xBB,
+  0xD3, 0xE2, 0xDC, 0xC3, 0x9F, 0x7C, 0x67, 0x5E, 0x63, 0x79, 0x90, 0xA3,
+  0xA1, 0x94, 0x80, 0x59, 0x39, 0x1E, 0x18, 0x2A, 0x45, 0x74, 0x94, 0xAF,
+  0xB6, 0xAC, 0x9E, 0x81, 0x73, 0x6B, 0x78, 0x8C, 0xA7, 0xC0, 0xC7, 0xC4,
+  0xAD, 0x86, 0x5E, 0x2D, 0x1E, 0x41, 0x61, 0x92, 0xC3, 0xC0, 0xAF, 0x9C,
+  0x7A, 0x57, 0x38, 0x2A, 0x2F, 0x40, 0x5E, 0x76, 0x8B, 0x92, 0x8A, 0x78,
+  0x57, 0x48, 0x3D, 0x4D, 0x68, 0x8D, 0xB4, 0xCB, 0xDA, 0xD0, 0xBB, 0x99,
+  0x81, 0x73, 0x71, 0x7F, 0x96, 0xB5, 0xC5, 0xC4, 0xB9, 0x98, 0x72, 0x48,
+  0x2B, 0x28, 0x31, 0x4E, 0x6C, 0x83, 0x92, 0x8D, 0x84, 0x68, 0x58, 0x4F,
+  0x54, 0x71, 0x8F, 0xB8, 0xD1, 0xE1, 0xDF, 0xC6, 0xA2, 0x79, 0x60, 0x52,
+  0x50, 0x62, 0x66, 0x7B, 0xA7, 0xAF, 0xAF, 0xA9, 0x76, 0x4D, 0x3C, 0x3A,
+  0x4F, 0x6B, 0x86, 0x93, 0x91, 0x7F, 0x58, 0x37, 0x27, 0x29, 0x3E, 0x5C,
+  0x89, 0xA4, 0xB7, 0xB6, 0xA4, 0x88, 0x6D, 0x67, 0x6E, 0x86, 0xA9, 0xCB,
+  0xDC, 0xD6, 0xC4, 0xA2, 0x7D, 0x62, 0x54, 0x5F, 0x71, 0x90, 0x9D, 0x9C,
+  0x91, 0x72, 0x4E, 0x2C, 0x1E, 0x27, 0x3D, 0x6A, 0x8F, 0xAE, 0xB6, 0xAD,
+  0x9D, 0x7D, 0x6F, 0x6B, 0x79, 0x93, 0xAF, 0xC5, 0xC8, 0xBD, 0xA1, 0x73,
+  0x51, 0x27, 0x23, 0x51, 0x7E, 0xAC, 0xD2, 0xC2, 0xA2, 0x81, 0x55, 0x3D,
+  0x30, 0x3A, 0x51, 0x71, 0x89, 0x90, 0x8C, 0x7A, 0x59, 0x41, 0x33, 0x40,
+  0x57, 0x82, 0xA9, 0xC0, 0xCB, 0xC0, 0xAB, 0x88, 0x73, 0x6C, 0x7A, 0x98,
+  0xB7, 0xCE, 0xD4, 0xCA, 0xB0, 0x84, 0x64, 0x49, 0x47, 0x4F, 0x66, 0x83,
+  0x8E, 0x91, 0x7E, 0x62, 0x43, 0x2E, 0x2E, 0x3D, 0x66, 0x97, 0xB7, 0xD1,
+  0xCC, 0xBE, 0x9B, 0x7E, 0x6F, 0x6C, 0x7E, 0x98, 0xB3, 0xBF, 0xB4, 0x9F,
+  0x67, 0x3C, 0x40, 0x42, 0x5C, 0x8E, 0xA5, 0xAD, 0xB2, 0xA0, 0x88, 0x5D,
+  0x3A, 0x27, 0x29, 0x3C, 0x5A, 0x7E, 0x96, 0x9B, 0x93, 0x76, 0x5A, 0x45,
+  0x45, 0x58, 0x77, 0xA3, 0xC1, 0xD5, 0xD0, 0xBE, 0x9C, 0x7D, 0x6D, 0x69,
+  0x7B, 0x98, 0xB7, 0xC7, 0xC3, 0xB3, 0x8C, 0x64, 0x41, 0x2D, 0x34, 0x46,
+  0x6A, 0x82, 0x91, 0x91, 0x7E, 0x64, 0x48, 0x3E, 0x48, 0x63, 0x93, 0xB9,
+  0xD6, 0xE0, 0xD5, 0xB8, 0x89, 0x6A, 0x57, 0x5D, 0x73, 0x8D, 0xA7, 0x99,
+  0x8A, 0x90, 0x78, 0x66, 0x69, 0x59, 0x57, 0x75, 0x8F, 0xA4, 0xA3, 0x91,
+  0x6E, 0x43, 0x25, 0x18, 0x28, 0x49, 0x72, 0x94, 0xA4, 0xA9, 0x98, 0x7D,
+  0x63, 0x54, 0x5C, 0x70, 0x98, 0xBC, 0xD3, 0xDA, 0xCF, 0xB5, 0x8D, 0x71,
+  0x62, 0x66, 0x7C, 0x99, 0xB2, 0xB7, 0xB1, 0x94, 0x65, 0x41, 0x26, 0x24,
+  0x30, 0x52, 0x7B, 0x93, 0xA2, 0x9B, 0x8A, 0x6F, 0x5C, 0x5D, 0x66, 0x85,
+  0xAA, 0xC9, 0xDA, 0xD4, 0xC0, 0x96, 0x6D, 0x51, 0x42, 0x4C, 0x55, 0x74,
+  0xA3, 0xB6, 0xB8, 0xB1, 0x81, 0x54, 0x3F, 0x3B, 0x4E, 0x70, 0x8D, 0x9B,
+  0x98, 0x85, 0x5D, 0x3A, 0x2B, 0x2C, 0x40, 0x60, 0x8E, 0xA8, 0xB9, 0xB6,
+  0xA2, 0x82, 0x66, 0x5F, 0x68, 0x81, 0xA8, 0xC8, 0xD9, 0xD3, 0xC0, 0x9C,
+  0x74, 0x5C, 0x50, 0x5C, 0x71, 0x94, 0xA3, 0xA1, 0x95, 0x75, 0x4F, 0x2D,
+  0x20, 0x2A, 0x42, 0x6F, 0x95, 0xB0, 0xB8, 0xAD, 0x9A, 0x78, 0x68, 0x65,
+  0x74, 0x91, 0xB0, 0xC6, 0xC9, 0xBD, 0xA1, 0x73, 0x51, 0x2D, 0x28, 0x52,
+  0x82, 0xAF, 0xD2, 0xC6, 0xA5, 0x82, 0x56, 0x3E, 0x33, 0x3E, 0x57, 0x79,
+  0x90, 0x96, 0x91, 0x7E, 0x5B, 0x40, 0x33, 0x3F, 0x58, 0x82, 0xAA, 0xC2,
+  0xCA, 0xBE, 0xA4, 0x81, 0x6A, 0x65, 0x74, 0x93, 0xB5, 0xCC, 0xD3, 0xC7,
+  0xAE, 0x81, 0x5F, 0x45, 0x46, 0x51, 0x6B, 0x8A, 0x96, 0x97, 0x84, 0x65,
+  0x45, 0x2E, 0x2E, 0x3F, 0x63, 0x95, 0xB6, 0xCC, 0xC6, 0xB3, 0x8E, 0x6D,
+  0x5C, 0x5D, 0x71, 0x92, 0xB1, 0xC1, 0xB9, 0xA5, 0x73, 0x44, 0x3C, 0x3E,
+  0x56, 0x85, 0xA5, 0xB2, 0xB9, 0xA9, 0x8E, 0x62, 0x3F, 0x2B, 0x2D, 0x42,
+  0x64, 0x88, 0xA0, 0xA6, 0x9A, 0x7B, 0x5A, 0x43, 0x40, 0x53, 0x73, 0xA0,
+  0xBD, 0xD0, 0xCB, 0xB6, 0x91, 0x70, 0x5E, 0x5D, 0x70, 0x92, 0xB3, 0xC6,
+  0xC4, 0xB3, 0x8C, 0x62, 0x40, 0x2F, 0x39, 0x4F, 0x76, 0x90, 0x9D, 0x9C,
+  0x87, 0x68, 0x49, 0x3D, 0x45, 0x5E, 0x8E, 0xB7, 0xD4, 0xDC, 0xCF, 0xB0,
+  0x80, 0x61, 0x51, 0x59, 0x73, 0x93, 0xAD, 0xA8, 0x98, 0x94, 0x78, 0x60,
+  0x5C, 0x53, 0x56, 0x78, 0x99, 0xAD, 0xAE, 0x9B, 0x78, 0x4A, 0x2C, 0x1F,
+  0x2F, 0x51, 0x7A, 0x9D, 0xAC, 0xAE, 0x9A, 0x7A, 0x5D, 0x4D, 0x53, 0x69,
+  0x90, 0xB7, 0xCE, 0xD5, 0xC8, 0xAC, 0x83, 0x64, 0x56, 0x5D, 0x78, 0x98,
+  0xB4, 0xBC, 0xB5, 0x97, 0x6B, 0x44, 0x2C, 0x2D, 0x41, 0x69, 0x92, 0xA5,
+  0xA8, 0x94, 0x73, 0x56, 0x48, 0x54, 0x71, 0x9F, 0xC5, 0xD5, 0xD4, 0xB8,
+  0x8B, 0x5F, 0x49, 0x4B, 0x61, 0x89, 0x9B, 0xA0, 0xAA, 0x99, 0x78, 0x64,
+  0x4F, 0x47, 0x61, 0x87, 0xA7, 0xAF, 0xA4, 0x83, 0x53, 0x31, 0x24, 0x31,
+  0x54, 0x80, 0xA3, 0xAE, 0xAA, 0x8C, 0x67, 0x4D, 0x47, 0x59, 0x7C, 0xAA,
+  0xC6, 0xCF, 0xC5, 0xA6, 0x7F, 0x5F, 0x55, 0x61, 0x82, 0xAA, 0xBE, 0xC2,
+  0xAF, 0x89, 0x5A, 0x38, 0x32, 0x3C, 0x5F, 0x85, 0x9E, 0xA6, 0x98, 0x7A,
+  0x54, 0x42, 0x45, 0x5B, 0x8B, 0xB6, 0xD1, 0xD6, 0xC6, 0xA0, 0x72, 0x57,
+  0x51, 0x63, 0x89, 0xA9, 0xB7, 0xA7, 0x8B, 0x73, 0x56, 0x48, 0x59, 0x6A,
+  0x84, 0xAA, 0xB6, 0xB1, 0x94, 0x67, 0x3E, 0x2A, 0x2D, 0x43, 0x6E, 0x97,
+  0xA9, 0xAA, 0x93, 0x6E, 0x4C, 0x41, 0x4C, 0x69, 0x97, 0xBB, 0xCD, 0xCA,
+  0xB4, 0x8C, 0x68, 0x5A, 0x5A, 0x74, 0x9D, 0xBC, 0xC7, 0xBD, 0xA0, 0x70,
+  0x4B, 0x39, 0x3B, 0x57, 0x7D, 0x9E, 0xA8, 0x9F, 0x84, 0x5A, 0x3F, 0x35,
+  0x45, 0x6D, 0x9A, 0xC0, 0xCB, 0xC5, 0xA7, 0x7E, 0x5E, 0x53, 0x5E, 0x7D,
+  0xA4, 0xBC, 0xBB, 0xAC, 0x80, 0x4D, 0x3E, 0x3E, 0x53, 0x86, 0xAB, 0xB9,
+  0xBA, 0xA5, 0x7F, 0x52, 0x35, 0x30, 0x3E, 0x62, 0x89, 0xA2, 0xAA, 0x9B,
+  0x78, 0x50, 0x3C, 0x3B, 0x53, 0x7E, 0xA8, 0xC2, 0xC6, 0xBA, 0x95, 0x6D,
+  0x56, 0x55, 0x6C, 0x92, 0xB8, 0xC9, 0xC8, 0xB3, 0x87, 0x5E, 0x45, 0x43,
+  0x56, 0x76, 0x9B, 0xAA, 0xA8, 0x8F, 0x65, 0x43, 0x31, 0x38, 0x53, 0x82,
+  0xAE, 0xC0, 0xC5, 0xAF, 0x8A, 0x67, 0x57, 0x5E, 0x75, 0x9C, 0xB9, 0xC3,
+  0xBD, 0x9D, 0x71, 0x43, 0x2C, 0x3E, 0x63, 0x94, 0xC1, 0xC9, 0xB6, 0x96,
+  0x67, 0x45, 0x36, 0x3C, 0x58, 0x7F, 0x9D, 0xA7, 0xA0, 0x84, 0x5B, 0x3F,
+  0x35, 0x44, 0x67, 0x95, 0xB7, 0xC2, 0xBC, 0x9E, 0x75, 0x56, 0x4D, 0x5C,
+  0x80, 0xAC, 0xC5, 0xCB, 0xBE, 0x9B, 0x6F, 0x4E, 0x45, 0x50, 0x72, 0x99,
+  0xAE, 0xB2, 0xA0, 0x7A, 0x4E, 0x33, 0x31, 0x43, 0x6C, 0x99, 0xB5, 0xBE,
+  0xB0, 0x92, 0x6A, 0x54, 0x53, 0x66, 0x8D, 0xB3, 0xC6, 0xC5, 0xB2, 0x89,
+  0x5B, 0x41, 0x35, 0x42, 0x74, 0xA3, 0xBC, 0xC6, 0xAF, 0x7F, 0x56, 0x3C,
+  0x3B, 0x4E, 0x74, 0x99, 0xAB, 0xA9, 0x91, 0x68, 0x44, 0x34, 0x3A, 0x53,
+  0x80, 0xA7, 0xBB, 0xBC, 0xA6, 0x80, 0x5A, 0x4D, 0x54, 0x71, 0x9D, 0xC0,
+  0xCF, 0xC7, 0xAD, 0x81, 0x5B, 0x4B, 0x4F, 0x6B, 0x92, 0xB2, 0xBA, 0xAD,
+  0x8D, 0x5E, 0x3C, 0x2F, 0x37, 0x59, 0x85, 0xA9, 0xB6, 0xB1, 0x97, 0x6F,
+  0x55, 0x4C, 0x5B, 0x7E, 0xA9, 0xC8, 0xCE, 0xC3, 0x9F, 0x70, 0x4D, 0x3D,
+  0x49, 0x63, 0x86, 0xAD, 0xBB, 0xB4, 0x9D, 0x70, 0x48, 0x3D, 0x48, 0x6A,
+  0x93, 0xAC, 0xB0, 0x9F, 0x79, 0x4E, 0x33, 0x32, 0x45, 0x6D, 0x99, 0xB5,
+  0xBA, 0xAB, 0x88, 0x5E, 0x47, 0x45, 0x5D, 0x87, 0xB1, 0xC6, 0xC7, 0xB6,
+  0x8E, 0x63, 0x4A, 0x48, 0x5E, 0x86, 0xAC, 0xBE, 0xBC, 0xA4, 0x76, 0x4C,
+  0x35, 0x36, 0x4D, 0x77, 0xA0, 0xB3, 0xB4, 0x9D, 0x76, 0x53, 0x41, 0x49,
+  0x66, 0x94, 0xBA, 0xCB, 0xC8, 0xAC, 0x7F, 0x54, 0x41, 0x45, 0x5E, 0x8B,
+  0xA8, 0xB0, 0xB1, 0x9A, 0x73, 0x55, 0x44, 0x44, 0x61, 0x8B, 0xAE, 0xB9,
+  0xAF, 0x8E, 0x5F, 0x3C, 0x2E, 0x3A, 0x5D, 0x8A, 0xAD, 0xB8, 0xB1, 0x92,
+  0x68, 0x4B, 0x43, 0x52, 0x76, 0xA3, 0xC1, 0xCA, 0xC0, 0x9E, 0x73, 0x53,
+  0x49, 0x57, 0x7B, 0xA5, 0xBF, 0xC4, 0xB3, 0x8D, 0x5F, 0x3F, 0x37, 0x45,
+  0x69, 0x94, 0xAE, 0xB4, 0xA5, 0x81, 0x59, 0x40, 0x40, 0x54, 0x81, 0xAD,
+  0xC7, 0xCB, 0xB9, 0x93, 0x65, 0x4B, 0x48, 0x5B, 0x83, 0xA7, 0xBB, 0xB5,
+  0x9B, 0x78, 0x54, 0x42, 0x48, 0x4E, 0x4B, 0x4A, 0x49, 0x4A, 0x48, 0x48,
+  0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x50, 0x52, 0x55, 0x57, 0x5A, 0x5C, 0x5F,
+  0x63, 0x65, 0x69, 0x6A, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x74, 0x75,
+  0x74, 0x75, 0x75, 0x73, 0x72, 0x72, 0x71, 0x6F, 0x6C, 0x6C, 0x6B, 0x6B,
+  0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x71, 0x74, 0x78, 0x7A, 0x7D, 0x7F, 0x81,
+  0x82, 0x83, 0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 0x7D, 0x7C, 0x77, 0x72,
+  0x78, 0x7D, 0x81, 0x88, 0x87, 0x81, 0x7F, 0x7D, 0x7C, 0x7A, 0x79, 0x7A,
+  0x79, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 0x83, 0x84, 0x87,
+  0x88, 0x8B, 0x8C, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x90, 0x90, 0x8E,
+  0x8E, 0x8D, 0x8B, 0x8A, 0x88, 0x87, 0x85, 0x81, 0x80, 0x7F, 0x7E, 0x7D,
+  0x7C, 0x7E, 0x7E, 0x80, 0x82, 0x84, 0x87, 0x89, 0x8D, 0x8E, 0x8F, 0x90,
+  0x90, 0x91, 0x90, 0x90, 0x8D, 0x88, 0x86, 0x84, 0x83, 0x80, 0x7E, 0x80,
+  0x83, 0x85, 0x88, 0x89, 0x85, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x87, 0x88,
+  0x88, 0x89, 0x8A, 0x8B, 0x8A, 0x8B, 0x8B, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A,
+  0x8A, 0x89, 0x87, 0x87, 0x85, 0x84, 0x83, 0x81, 0x81, 0x80, 0x80, 0x7F,
+  0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x88, 0x89, 0x89,
+  0x8A, 0x89, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x82, 0x7F, 0x82, 0x84,
+  0x86, 0x89, 0x89, 0x86, 0x85, 0x85, 0x84, 0x83, 0x83, 0x82, 0x81, 0x82,
+  0x82, 0x81, 0x82, 0x83, 0x83, 0x82, 0x83, 0x85, 0x85, 0x87, 0x87, 0x89,
+  0x88, 0x89, 0x8A, 0x89, 0x89, 0x8A, 0x8B, 0x8A, 0x8A, 0x89, 0x88, 0x88,
+  0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7F,
+  0x7F, 0x80, 0x81, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82,
+  0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x80, 0x7F, 0x81, 0x7E, 0xA0, 0xD2, 0xEC, 0xFB, 0xF8, 0xE5, 0xBF,
+  0x8B, 0x6E, 0x5E, 0x64, 0x74, 0x91, 0xA7, 0xB1, 0xAF, 0xA1, 0x93, 0x88,
+  0x8F, 0x9C, 0xBB, 0xD9, 0xEF, 0xEE, 0xE0, 0xC1, 0x9C, 0x7D, 0x69, 0x63,
+  0x5D, 0x8F, 0xB8, 0xC9, 0xD9, 0xAA, 0x79, 0x5B, 0x4D, 0x52, 0x65, 0x83,
+  0x93, 0x93, 0x7F, 0x66, 0x48, 0x3C, 0x3E, 0x56, 0x7A, 0xA8, 0xC1, 0xCC,
+  0xC3, 0xAA, 0x8E, 0x7D, 0x7F, 0x93, 0xB5, 0xCC, 0xD6, 0xCF, 0xBB, 0x90,
+  0x6C, 0x50, 0x4B, 0x4C, 0x63, 0x77, 0x81, 0x7B, 0x67, 0x4D, 0x32, 0x2D,
+  0x37, 0x60, 0x8D, 0xC1, 0xD5, 0xDA, 0xC7, 0xA6, 0x83, 0x6E, 0x6F, 0x7E,
+  0x9A, 0xA3, 0x9F, 0x74, 0x64, 0x64, 0x57, 0x71, 0x69, 0x64, 0x7E, 0x8D,
+  0x90, 0x7D, 0x60, 0x35, 0x1B, 0x0E, 0x1E, 0x3D, 0x67, 0x84, 0x93, 0x94,
+  0x85, 0x6C, 0x5B, 0x5D, 0x6D, 0x91, 0xB3, 0xCB, 0xD0, 0xCB, 0xAD, 0x89,
+  0x6A, 0x61, 0x63, 0x7A, 0x91, 0x9E, 0x94, 0x7C, 0x59, 0x31, 0x1A, 0x12,
+  0x25, 0x44, 0x74, 0x8E, 0xA2, 0x9E, 0x90, 0x7A, 0x6B, 0x6D, 0x7D, 0x9B,
+  0xB3, 0xC0, 0xB9, 0xA9, 0x7C, 0x53, 0x20, 0x18, 0x4C, 0x76, 0xB4, 0xC5,
+  0xAA, 0x8F, 0x65, 0x43, 0x2B, 0x2A, 0x37, 0x54, 0x6D, 0x7D, 0x80, 0x74,
+  0x56, 0x3E, 0x37, 0x40, 0x61, 0x89, 0xB1, 0xC2, 0xC8, 0xB7, 0x9A, 0x7C,
+  0x71, 0x70, 0x83, 0xA0, 0xBA, 0xBE, 0xB4, 0x95, 0x68, 0x40, 0x26, 0x28,
+  0x35, 0x56, 0x6D, 0x80, 0x7C, 0x6F, 0x53, 0x45, 0x47, 0x5D, 0x83, 0xAC,
+  0xCD, 0xD5, 0xD3, 0xB5, 0x8E, 0x66, 0x56, 0x4F, 0x5F, 0x69, 0x70, 0x9A,
+  0xA1, 0xA3, 0x8F, 0x56, 0x41, 0x3C, 0x51, 0x6E, 0x82, 0x86, 0x79, 0x56,
+  0x31, 0x21, 0x22, 0x34, 0x57, 0x83, 0x9F, 0xB1, 0xAD, 0x9B, 0x7D, 0x6F,
+  0x6D, 0x80, 0x9F, 0xC3, 0xD3, 0xD1, 0xC2, 0xA0, 0x77, 0x59, 0x50, 0x56,
+  0x6C, 0x7C, 0x89, 0x81, 0x71, 0x4B, 0x31, 0x21, 0x27, 0x3E, 0x6D, 0x9F,
+  0xBA, 0xCB, 0xBD, 0xA4, 0x81, 0x72, 0x6E, 0x80, 0x9B, 0xB5, 0xB5, 0xA8,
+  0x82, 0x41, 0x3B, 0x41, 0x5A, 0x8A, 0x94, 0xA2, 0xA4, 0x97, 0x79, 0x4F,
+  0x2F, 0x20, 0x24, 0x37, 0x61, 0x81, 0x93, 0x90, 0x83, 0x66, 0x55, 0x50,
+  0x60, 0x80, 0xAA, 0xC8, 0xD3, 0xCF, 0xBB, 0x9B, 0x78, 0x6A, 0x6D, 0x84,
+  0x9D, 0xB2, 0xB0, 0xA1, 0x75, 0x4C, 0x2A, 0x1F, 0x23, 0x3E, 0x67, 0x87,
+  0x97, 0x95, 0x8B, 0x72, 0x6A, 0x67, 0x79, 0x95, 0xBA, 0xCB, 0xCD, 0xBE,
+  0x9F, 0x73, 0x4C, 0x3A, 0x25, 0x53, 0x90, 0xB2, 0xD3, 0xB8, 0x86, 0x5B,
+  0x3E, 0x35, 0x3B, 0x56, 0x74, 0x86, 0x85, 0x7C, 0x60, 0x43, 0x32, 0x3A,
+  0x50, 0x7A, 0xA5, 0xBE, 0xC7, 0xBF, 0xA6, 0x86, 0x75, 0x76, 0x8B, 0xA6,
+  0xC4, 0xCE, 0xCC, 0xB1, 0x8A, 0x5D, 0x47, 0x39, 0x44, 0x5E, 0x78, 0x84,
+  0x80, 0x74, 0x54, 0x3E, 0x35, 0x48, 0x66, 0x9D, 0xC7, 0xDC, 0xDC, 0xC8,
+  0xA0, 0x76, 0x62, 0x5F, 0x73, 0x8A, 0xA0, 0x8A, 0x86, 0x8E, 0x73, 0x74,
+  0x61, 0x4B, 0x5D, 0x79, 0x94, 0x98, 0x8E, 0x6D, 0x42, 0x1F, 0x1B, 0x2B,
+  0x4D, 0x76, 0x99, 0xA8, 0xA8, 0x98, 0x7A, 0x66, 0x62, 0x75, 0x93, 0xBA,
+  0xD1, 0xDA, 0xCD, 0xB1, 0x87, 0x6A, 0x5B, 0x62, 0x77, 0x93, 0xA0, 0x99,
+  0x88, 0x62, 0x3E, 0x23, 0x23, 0x30, 0x5A, 0x85, 0xAA, 0xB6, 0xB6, 0xA1,
+  0x83, 0x72, 0x6F, 0x80, 0x9A, 0xB8, 0xC1, 0xC0, 0xA4, 0x7D, 0x40, 0x20,
+  0x3E, 0x5A, 0x98, 0xC0, 0xB7, 0xAD, 0x90, 0x6A, 0x43, 0x2F, 0x2D, 0x3E,
+  0x5B, 0x7C, 0x91, 0x94, 0x85, 0x67, 0x4E, 0x45, 0x52, 0x6D, 0x9A, 0xBD,
+  0xD2, 0xD0, 0xC1, 0xA1, 0x83, 0x71, 0x71, 0x84, 0xA5, 0xBD, 0xC3, 0xB9,
+  0x99, 0x6A, 0x3E, 0x2E, 0x2A, 0x40, 0x5F, 0x83, 0x91, 0x94, 0x81, 0x69,
+  0x58, 0x57, 0x6B, 0x8A, 0xB6, 0xD0, 0xDD, 0xD0, 0xB3, 0x81, 0x5D, 0x49,
+  0x4F, 0x60, 0x72, 0xA1, 0xAE, 0xAF, 0x99, 0x5F, 0x45, 0x41, 0x58, 0x79,
+  0x91, 0x96, 0x83, 0x5D, 0x36, 0x26, 0x2B, 0x46, 0x70, 0x9B, 0xAD, 0xB3,
+  0x9D, 0x7E, 0x65, 0x64, 0x78, 0x9D, 0xC2, 0xD6, 0xD6, 0xC0, 0x99, 0x72,
+  0x5F, 0x5D, 0x72, 0x91, 0xA7, 0xA0, 0x8F, 0x65, 0x3F, 0x25, 0x26, 0x3C,
+  0x66, 0x91, 0xA8, 0xB1, 0x9F, 0x86, 0x6D, 0x6B, 0x77, 0x9A, 0xB8, 0xC9,
+  0xC5, 0xB2, 0x87, 0x58, 0x37, 0x20, 0x4D, 0x88, 0xB5, 0xD4, 0xB7, 0x8A,
+  0x5D, 0x3E, 0x35, 0x41, 0x61, 0x80, 0x90, 0x89, 0x78, 0x55, 0x3C, 0x33,
+  0x45, 0x67, 0x99, 0xB8, 0xC5, 0xBC, 0xA0, 0x7F, 0x6C, 0x71, 0x8C, 0xB4,
+  0xCC, 0xD4, 0xC8, 0xA9, 0x79, 0x5B, 0x4A, 0x55, 0x69, 0x87, 0x93, 0x8F,
+  0x75, 0x4F, 0x34, 0x29, 0x3B, 0x5F, 0x97, 0xB9, 0xCE, 0xC4, 0xA7, 0x83,
+  0x70, 0x6F, 0x81, 0xA2, 0xBA, 0xBF, 0xAB, 0x88, 0x45, 0x2F, 0x3F, 0x59,
+  0x97, 0xB4, 0xB5, 0xAC, 0x8E, 0x63, 0x3B, 0x2D, 0x30, 0x4A, 0x6C, 0x8C,
+  0x98, 0x91, 0x72, 0x52, 0x3F, 0x46, 0x63, 0x8F, 0xB9, 0xCC, 0xCD, 0xB6,
+  0x93, 0x73, 0x6B, 0x74, 0x95, 0xB7, 0xCB, 0xC6, 0xAF, 0x82, 0x57, 0x3B,
+  0x37, 0x4A, 0x6B, 0x89, 0x90, 0x8C, 0x6E, 0x4F, 0x39, 0x43, 0x5F, 0x94,
+  0xC3, 0xDB, 0xDB, 0xC3, 0x98, 0x6F, 0x5D, 0x61, 0x7F, 0x9C, 0xAB, 0x94,
+  0x80, 0x77, 0x59, 0x5F, 0x62, 0x63, 0x86, 0x9E, 0xA6, 0x95, 0x6F, 0x40,
+  0x24, 0x1C, 0x31, 0x5A, 0x86, 0x9E, 0xA3, 0x93, 0x71, 0x58, 0x51, 0x62,
+  0x84, 0xB3, 0xCB, 0xD4, 0xC8, 0xAC, 0x83, 0x69, 0x65, 0x7A, 0x9D, 0xB8,
+  0xBE, 0xB0, 0x8A, 0x57, 0x37, 0x29, 0x35, 0x52, 0x7E, 0x96, 0x9F, 0x90,
+  0x75, 0x5B, 0x55, 0x67, 0x87, 0xB5, 0xD3, 0xDC, 0xCC, 0xA9, 0x79, 0x59,
+  0x47, 0x55, 0x67, 0x7D, 0xA8, 0xB1, 0xAD, 0x8C, 0x56, 0x42, 0x43, 0x5F,
+  0x83, 0x9A, 0x9A, 0x84, 0x59, 0x34, 0x27, 0x2F, 0x4D, 0x7A, 0xA2, 0xB2,
+  0xB2, 0x97, 0x75, 0x5D, 0x5F, 0x76, 0x9F, 0xC3, 0xD5, 0xD1, 0xB8, 0x8E,
+  0x69, 0x57, 0x5C, 0x79, 0x99, 0xAD, 0xA5, 0x8F, 0x63, 0x3D, 0x25, 0x2B,
+  0x44, 0x72, 0x9A, 0xAE, 0xB1, 0x9B, 0x7F, 0x67, 0x67, 0x78, 0x9D, 0xBB,
+  0xCB, 0xC4, 0xAE, 0x7F, 0x53, 0x34, 0x27, 0x5A, 0x8F, 0xBA, 0xD1, 0xB2,
+  0x84, 0x56, 0x3C, 0x36, 0x46, 0x6A, 0x8A, 0x96, 0x8D, 0x76, 0x51, 0x38,
+  0x33, 0x48, 0x6E, 0x9F, 0xBA, 0xC3, 0xB5, 0x95, 0x73, 0x63, 0x6B, 0x8C,
+  0xB4, 0xCC, 0xD2, 0xC3, 0x9F, 0x70, 0x53, 0x4A, 0x58, 0x71, 0x92, 0x9B,
+  0x95, 0x76, 0x4E, 0x32, 0x2C, 0x40, 0x68, 0x9E, 0xBE, 0xCD, 0xBD, 0x9D,
+  0x79, 0x69, 0x6B, 0x84, 0xA7, 0xBE, 0xBF, 0xAB, 0x82, 0x41, 0x33, 0x42,
+  0x61, 0x9F, 0xB6, 0xB7, 0xAC, 0x8B, 0x5F, 0x3B, 0x2D, 0x35, 0x54, 0x7B,
+  0x98, 0xA0, 0x93, 0x6E, 0x4D, 0x3B, 0x43, 0x63, 0x93, 0xBA, 0xC9, 0xC6,
+  0xA9, 0x80, 0x62, 0x5C, 0x6B, 0x91, 0xB6, 0xC8, 0xC2, 0xA8, 0x77, 0x4F,
+  0x37, 0x3A, 0x53, 0x7A, 0x97, 0x9E, 0x94, 0x70, 0x4C, 0x38, 0x43, 0x61,
+  0x96, 0xC2, 0xD7, 0xD2, 0xB5, 0x87, 0x60, 0x53, 0x5F, 0x83, 0xA3, 0xB3,
+  0x9F, 0x8A, 0x74, 0x56, 0x58, 0x59, 0x67, 0x8F, 0xA9, 0xAF, 0x9B, 0x71,
+  0x43, 0x28, 0x23, 0x3C, 0x6A, 0x96, 0xA9, 0xA9, 0x92, 0x6C, 0x51, 0x4A,
+  0x5C, 0x84, 0xB1, 0xCA, 0xCF, 0xBE, 0x9B, 0x70, 0x5A, 0x5B, 0x76, 0x9C,
+  0xBA, 0xBF, 0xAF, 0x84, 0x53, 0x35, 0x2C, 0x3E, 0x61, 0x8F, 0xA3, 0xA8,
+  0x91, 0x71, 0x54, 0x4F, 0x61, 0x87, 0xB5, 0xD2, 0xD7, 0xC4, 0x9B, 0x6A,
+  0x4E, 0x46, 0x5C, 0x74, 0x91, 0xB3, 0xB4, 0xA8, 0x81, 0x50, 0x40, 0x48,
+  0x6B, 0x90, 0xA6, 0xA3, 0x88, 0x59, 0x36, 0x29, 0x36, 0x5E, 0x8F, 0xB1,
+  0xB7, 0xA5, 0x7C, 0x5A, 0x4E, 0x62, 0x8B, 0xB7, 0xCD, 0xCE, 0xB3, 0x85,
+  0x5F, 0x50, 0x5F, 0x85, 0xAB, 0xBB, 0xB1, 0x89, 0x58, 0x33, 0x2C, 0x3D,
+  0x6A, 0x95, 0xAD, 0xA9, 0x8E, 0x68, 0x4F, 0x53, 0x6F, 0x9F, 0xC6, 0xD7,
+  0xC9, 0xA4, 0x70, 0x4E, 0x45, 0x5C, 0x7D, 0x95, 0xB3, 0xAF, 0x95, 0x72,
+  0x49, 0x44, 0x5B, 0x87, 0xA7, 0xAD, 0x97, 0x6B, 0x3D, 0x25, 0x30, 0x55,
+  0x87, 0xA8, 0xB4, 0xA2, 0x7D, 0x58, 0x4A, 0x58, 0x82, 0xB0, 0xCB, 0xCE,
+  0xB9, 0x8E, 0x64, 0x52, 0x5F, 0x82, 0xAB, 0xC1, 0xB9, 0x99, 0x64, 0x3D,
+  0x2C, 0x3C, 0x60, 0x8D, 0xA5, 0xA6, 0x8C, 0x64, 0x4A, 0x48, 0x66, 0x95,
+  0xC4, 0xD8, 0xD4, 0xAE, 0x7C, 0x55, 0x4D, 0x5F, 0x87, 0xA5, 0xA2, 0xA4,
+  0x8D, 0x6A, 0x5B, 0x4E, 0x5E, 0x87, 0xA9, 0xB1, 0x9F, 0x73, 0x43, 0x27,
+  0x28, 0x4C, 0x7E, 0xA5, 0xB0, 0xA3, 0x7C, 0x57, 0x43, 0x4E, 0x73, 0xA4,
+  0xC6, 0xCC, 0xBA, 0x92, 0x68, 0x51, 0x59, 0x7C, 0xA9, 0xC1, 0xC2, 0xA4,
+  0x74, 0x45, 0x33, 0x3B, 0x60, 0x8A, 0xA5, 0xA8, 0x8F, 0x66, 0x42, 0x3F,
+  0x54, 0x86, 0xB6, 0xD3, 0xD0, 0xB3, 0x81, 0x59, 0x4C, 0x5F, 0x89, 0xAC,
+  0xB9, 0xA1, 0x85, 0x63, 0x48, 0x52, 0x65, 0x88, 0xAD, 0xB9, 0xAA, 0x80,
+  0x4F, 0x2E, 0x2C, 0x45, 0x77, 0xA1, 0xB1, 0xA4, 0x80, 0x55, 0x3F, 0x46,
+  0x69, 0x9B, 0xBF, 0xCC, 0xBD, 0x97, 0x6B, 0x54, 0x57, 0x78, 0xA5, 0xC4,
+  0xC6, 0xAF, 0x7F, 0x51, 0x38, 0x3C, 0x5B, 0x86, 0xA3, 0xA6, 0x92, 0x67,
+  0x43, 0x36, 0x4B, 0x76, 0xAB, 0xCA, 0xCE, 0xB5, 0x88, 0x62, 0x51, 0x60,
+  0x86, 0xAF, 0xBD, 0xB5, 0x89, 0x58, 0x43, 0x40, 0x64, 0x8F, 0xAE, 0xBE,
+  0xB1, 0x8B, 0x59, 0x37, 0x2F, 0x45, 0x6F, 0x9A, 0xAD, 0xA5, 0x83, 0x58,
+  0x3E, 0x40, 0x60, 0x91, 0xBB, 0xCA, 0xC2, 0x9B, 0x6D, 0x50, 0x54, 0x71,
+  0x9E, 0xC0, 0xC9, 0xB6, 0x8B, 0x5B, 0x3F, 0x40, 0x5A, 0x86, 0xA6, 0xAD,
+  0x97, 0x6E, 0x44, 0x33, 0x3E, 0x68, 0x9C, 0xC0, 0xC8, 0xB3, 0x8A, 0x61,
+  0x51, 0x5A, 0x7F, 0xA9, 0xC1, 0xBC, 0x9F, 0x68, 0x3A, 0x38, 0x4E, 0x82,
+  0xB3, 0xC1, 0xB9, 0x95, 0x65, 0x3F, 0x33, 0x45, 0x6E, 0x97, 0xAC, 0xA9,
+  0x8A, 0x5E, 0x3D, 0x3A, 0x54, 0x85, 0xB1, 0xC7, 0xC1, 0xA0, 0x72, 0x53,
+  0x4F, 0x6C, 0x99, 0xBE, 0xCA, 0xBD, 0x94, 0x64, 0x45, 0x41, 0x5B, 0x84,
+  0xA7, 0xAE, 0x9E, 0x72, 0x48, 0x2F, 0x37, 0x5B, 0x8E, 0xB6, 0xC3, 0xB5,
+  0x8C, 0x66, 0x50, 0x5A, 0x7A, 0xA6, 0xC0, 0xC3, 0xA9, 0x7A, 0x49, 0x2C,
+  0x42, 0x70, 0xA5, 0xCA, 0xC2, 0xA3, 0x71, 0x47, 0x37, 0x43, 0x69, 0x94,
+  0xAB, 0xA9, 0x8F, 0x63, 0x40, 0x37, 0x4D, 0x79, 0xA9, 0xC1, 0xC1, 0xA4,
+  0x77, 0x56, 0x4F, 0x66, 0x95, 0xBD, 0xCC, 0xC1, 0x9A, 0x69, 0x46, 0x41,
+  0x57, 0x82, 0xA8, 0xB6, 0xA7, 0x80, 0x50, 0x33, 0x34, 0x53, 0x84, 0xAD,
+  0xBF, 0xB2, 0x8D, 0x61, 0x4A, 0x4E, 0x6F, 0x9C, 0xBD, 0xC4, 0xB1, 0x85,
+  0x54, 0x39, 0x38, 0x60, 0x96, 0xBB, 0xC9, 0xAE, 0x7D, 0x50, 0x3A, 0x42,
+  0x65, 0x94, 0xB0, 0xB2, 0x97, 0x6B, 0x44, 0x35, 0x44, 0x6F, 0xA0, 0xBC,
+  0xBF, 0xA4, 0x77, 0x52, 0x46, 0x5A, 0x86, 0xB3, 0xCA, 0xC5, 0xA4, 0x73,
+  0x4D, 0x42, 0x56, 0x80, 0xAA, 0xB9, 0xAE, 0x88, 0x57, 0x36, 0x31, 0x4D,
+  0x7B, 0xA7, 0xB9, 0xB4, 0x91, 0x66, 0x4A, 0x4B, 0x68, 0x97, 0xBD, 0xC9,
+  0xB9, 0x8F, 0x5F, 0x3E, 0x3E, 0x56, 0x87, 0xB3, 0xC0, 0xB8, 0x8C, 0x5A,
+  0x3F, 0x41, 0x61, 0x90, 0xB0, 0xB6, 0xA0, 0x71, 0x47, 0x34, 0x40, 0x67,
+  0x98, 0xB8, 0xBF, 0xA8, 0x7B, 0x54, 0x47, 0x58, 0x7F, 0xAE, 0xC7, 0xC8,
+  0xAB, 0x7C, 0x55, 0x47, 0x57, 0x7F, 0xA8, 0xBD, 0xBE, 0xBA, 0xB7, 0xB4,
+  0xB2, 0xAF, 0xAF, 0xAE, 0xB0, 0xAF, 0xB1, 0xB2, 0xB4, 0xB4, 0xB3, 0xB4,
+  0xB3, 0xB4, 0xB2, 0xB0, 0xAD, 0xAA, 0xA5, 0xA1, 0x99, 0x96, 0x9C, 0x9D,
+  0xA3, 0xA3, 0x9C, 0x99, 0x94, 0x92, 0x90, 0x8E, 0x8C, 0x8B, 0x89, 0x89,
+  0x89, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91,
+  0x91, 0x90, 0x91, 0x8F, 0x8E, 0x8D, 0x8C, 0x89, 0x87, 0x85, 0x82, 0x7F,
+  0x7B, 0x79, 0x76, 0x75, 0x74, 0x75, 0x74, 0x77, 0x77, 0x7A, 0x7D, 0x7F,
+  0x82, 0x83, 0x84, 0x83, 0x84, 0x83, 0x82, 0x7F, 0x7E, 0x7B, 0x78, 0x72,
+  0x6D, 0x73, 0x77, 0x7D, 0x80, 0x7B, 0x77, 0x75, 0x73, 0x71, 0x70, 0x6F,
+  0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x71, 0x72, 0x74, 0x75, 0x78, 0x79, 0x7B,
+  0x7C, 0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7B, 0x7A,
+  0x78, 0x76, 0x74, 0x70, 0x6E, 0x6D, 0x6C, 0x6C, 0x70, 0x70, 0x71, 0x72,
+  0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x78, 0x79, 0x78, 0x79, 0x77, 0x77,
+  0x75, 0x75, 0x72, 0x6F, 0x71, 0x74, 0x76, 0x79, 0x77, 0x74, 0x73, 0x72,
+  0x72, 0x71, 0x71, 0x70, 0x71, 0x70, 0x71, 0x72, 0x73, 0x73, 0x74, 0x75,
+  0x76, 0x77, 0x78, 0x79, 0x7A, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A, 0x7B,
+  0x7A, 0x79, 0x79, 0x78, 0x76, 0x76, 0x74, 0x74, 0x73, 0x72, 0x71, 0x72,
+  0x72, 0x72, 0x73, 0x74, 0x75, 0x77, 0x78, 0x79, 0x7A, 0x79, 0x7A, 0x7A,
+  0x79, 0x79, 0x78, 0x78, 0x77, 0x75, 0x71, 0x73, 0x75, 0x77, 0x7A, 0x79,
+  0x77, 0x76, 0x75, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x74, 0x74, 0x75,
+  0x76, 0x77, 0x78, 0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7E, 0x7D, 0x7E, 0x7C, 0x7C, 0x7A, 0x7A, 0x78, 0x77, 0x76,
+  0x75, 0x76, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A,
+  0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A,
+  0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B,
+  0x7A, 0x7B, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 0x7D, 0x7C,
+  0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7D,
+  0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C,
+  0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B,
+  0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 0x7B, 0x7C,
+  0x7B, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C,
+  0x7D, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E,
+  0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E,
+  0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E,
+  0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x81, 0x62, 0x1A, 0x17,
+  0x2C, 0x5C, 0x99, 0x94, 0x81, 0x59, 0x2D, 0x17, 0x21, 0x45, 0x63, 0x68,
+  0x5A, 0x3B, 0x24, 0x28, 0x4A, 0x7A, 0x99, 0x9C, 0x84, 0x68, 0x63, 0x79,
+  0xA2, 0xC6, 0xCB, 0xB1, 0x82, 0x67, 0x63, 0x80, 0xA0, 0xA7, 0x8D, 0x57,
+  0x29, 0x19, 0x2C, 0x56, 0x78, 0x7E, 0x6A, 0x4A, 0x44, 0x5C, 0x93, 0xC1,
+  0xD3, 0xC7, 0xA1, 0x7D, 0x75, 0x88, 0xAC, 0xB4, 0xA4, 0x61, 0x2F, 0x43,
+  0x61, 0xAD, 0xC1, 0xB0, 0x90, 0x58, 0x30, 0x28, 0x48, 0x70, 0x82, 0x79,
+  0x5E, 0x3B, 0x31, 0x49, 0x7D, 0xA8, 0xB9, 0xA9, 0x88, 0x75, 0x80, 0xA4,
+  0xD1, 0xE4, 0xD7, 0xAA, 0x80, 0x73, 0x81, 0xA4, 0xB4, 0xAB, 0x7F, 0x4A,
+  0x2C, 0x30, 0x52, 0x7A, 0x8B, 0x84, 0x63, 0x50, 0x59, 0x86, 0xBB, 0xD9,
+  0xDB, 0xBD, 0x94, 0x7E, 0x85, 0xA5, 0xBE, 0xB7, 0x8C, 0x41, 0x41, 0x57,
+  0x92, 0xCA, 0xBE, 0xA8, 0x76, 0x44, 0x2C, 0x3C, 0x66, 0x86, 0x88, 0x74,
+  0x4E, 0x37, 0x3F, 0x6A, 0x9C, 0xBA, 0xB9, 0x99, 0x7B, 0x78, 0x92, 0xBF,
+  0xE2, 0xE2, 0xC1, 0x8F, 0x75, 0x76, 0x96, 0xB2, 0xB6, 0x98, 0x63, 0x36,
+  0x2B, 0x43, 0x6C, 0x89, 0x8C, 0x74, 0x54, 0x50, 0x6A, 0xA3, 0xCE, 0xDC,
+  0xCC, 0xA4, 0x81, 0x7C, 0x92, 0xB7, 0xBC, 0xA6, 0x5E, 0x39, 0x4D, 0x6C,
+  0xB8, 0xC5, 0xB4, 0x8F, 0x57, 0x32, 0x30, 0x53, 0x7B, 0x89, 0x7F, 0x5E,
+  0x3C, 0x36, 0x52, 0x88, 0xB0, 0xBE, 0xAA, 0x86, 0x73, 0x82, 0xA9, 0xD5,
+  0xE4, 0xD2, 0xA2, 0x7B, 0x70, 0x84, 0xA7, 0xB5, 0xA8, 0x78, 0x45, 0x2A,
+  0x32, 0x57, 0x7F, 0x8C, 0x81, 0x5C, 0x4A, 0x58, 0x87, 0xBD, 0xD8, 0xD5,
+  0xB5, 0x8A, 0x78, 0x83, 0xA7, 0xBB, 0xB3, 0x83, 0x3C, 0x41, 0x57, 0x98,
+  0xC7, 0xB9, 0xA4, 0x6E, 0x3D, 0x29, 0x3F, 0x6A, 0x86, 0x84, 0x6D, 0x47,
+  0x33, 0x40, 0x6E, 0xA0, 0xBB, 0xB5, 0x93, 0x77, 0x77, 0x93, 0xC1, 0xE0,
+  0xDD, 0xB7, 0x86, 0x6F, 0x73, 0x97, 0xB2, 0xB2, 0x92, 0x5A, 0x30, 0x29,
+  0x43, 0x6F, 0x8A, 0x8A, 0x6C, 0x4D, 0x4D, 0x6C, 0xA4, 0xCD, 0xD8, 0xC3,
+  0x98, 0x78, 0x76, 0x91, 0xB5, 0xB9, 0x9F, 0x53, 0x36, 0x49, 0x71, 0xB9,
+  0xC0, 0xAF, 0x87, 0x4F, 0x2C, 0x2F, 0x56, 0x7E, 0x89, 0x7B, 0x58, 0x38,
+  0x35, 0x55, 0x8B, 0xB1, 0xBB, 0xA1, 0x7D, 0x70, 0x81, 0xAB, 0xD6, 0xE1,
+  0xCB, 0x98, 0x75, 0x6D, 0x85, 0xA9, 0xB6, 0xA3, 0x71, 0x3D, 0x25, 0x33,
+  0x5B, 0x80, 0x8B, 0x7B, 0x55, 0x48, 0x57, 0x89, 0xBE, 0xD5, 0xCF, 0xAA,
+  0x80, 0x72, 0x81, 0xA7, 0xB9, 0xAD, 0x75, 0x35, 0x3F, 0x56, 0x9B, 0xC3,
+  0xB5, 0x9B, 0x63, 0x38, 0x27, 0x41, 0x6E, 0x86, 0x83, 0x6A, 0x43, 0x32,
+  0x42, 0x74, 0xA4, 0xBA, 0xB0, 0x8C, 0x71, 0x76, 0x97, 0xC6, 0xE1, 0xD9,
+  0xB0, 0x81, 0x6D, 0x75, 0x9A, 0xB3, 0xB1, 0x8A, 0x52, 0x2C, 0x2A, 0x49,
+  0x76, 0x8E, 0x89, 0x67, 0x48, 0x49, 0x6D, 0xA8, 0xCD, 0xD4, 0xBB, 0x8D,
+  0x70, 0x73, 0x92, 0xB5, 0xB6, 0x98, 0x4D, 0x36, 0x47, 0x75, 0xB9, 0xBB,
+  0xAB, 0x7E, 0x48, 0x29, 0x31, 0x5B, 0x82, 0x8A, 0x79, 0x53, 0x33, 0x35,
+  0x59, 0x90, 0xB3, 0xB8, 0x9A, 0x76, 0x6C, 0x80, 0xAD, 0xD6, 0xDE, 0xC3,
+  0x8E, 0x6E, 0x69, 0x86, 0xAB, 0xB6, 0xA0, 0x6B, 0x38, 0x25, 0x37, 0x62,
+  0x87, 0x90, 0x7A, 0x53, 0x47, 0x5A, 0x8F, 0xC1, 0xD7, 0xCB, 0xA2, 0x78,
+  0x6E, 0x80, 0xA9, 0xB9, 0xAC, 0x6D, 0x35, 0x40, 0x59, 0xA0, 0xC0, 0xB4,
+  0x96, 0x5D, 0x32, 0x27, 0x46, 0x74, 0x8A, 0x82, 0x64, 0x3E, 0x30, 0x44,
+  0x78, 0xA6, 0xBA, 0xA9, 0x83, 0x6C, 0x73, 0x96, 0xC7, 0xDF, 0xD3, 0xA7,
+  0x79, 0x68, 0x77, 0x9E, 0xB5, 0xAF, 0x85, 0x4C, 0x29, 0x2C, 0x4F, 0x7B,
+  0x8F, 0x88, 0x63, 0x49, 0x4D, 0x74, 0xB0, 0xD1, 0xD5, 0xB4, 0x86, 0x6D,
+  0x73, 0x96, 0xB7, 0xB6, 0x91, 0x47, 0x38, 0x49, 0x7C, 0xBA, 0xBA, 0xA9,
+  0x79, 0x44, 0x28, 0x36, 0x62, 0x87, 0x8B, 0x77, 0x4F, 0x31, 0x36, 0x60,
+  0x96, 0xB5, 0xB6, 0x94, 0x70, 0x68, 0x81, 0xB1, 0xD7, 0xDB, 0xBC, 0x86,
+  0x68, 0x68, 0x8A, 0xAC, 0xB6, 0x9D, 0x65, 0x34, 0x26, 0x3D, 0x6B, 0x8D,
+  0x90, 0x77, 0x4F, 0x45, 0x5D, 0x96, 0xC5, 0xD6, 0xC6, 0x9B, 0x74, 0x6D,
+  0x83, 0xAD, 0xB9, 0xA9, 0x67, 0x36, 0x43, 0x5F, 0xA8, 0xBF, 0xB3, 0x93,
+  0x58, 0x30, 0x2A, 0x4D, 0x79, 0x8C, 0x82, 0x60, 0x3A, 0x2F, 0x49, 0x7F,
+  0xAA, 0xB9, 0xA4, 0x7D, 0x67, 0x73, 0x9A, 0xC9, 0xDD, 0xCD, 0x9D, 0x71,
+  0x64, 0x76, 0x9F, 0xB5, 0xAC, 0x7E, 0x46, 0x28, 0x2E, 0x55, 0x81, 0x93,
+  0x88, 0x5F, 0x47, 0x50, 0x7B, 0xB4, 0xD3, 0xD2, 0xB0, 0x81, 0x6D, 0x76,
+  0x9C, 0xBA, 0xB6, 0x8A, 0x41, 0x3D, 0x4C, 0x86, 0xC0, 0xBA, 0xA6, 0x72,
+  0x3F, 0x28, 0x3B, 0x6A, 0x8C, 0x8E, 0x75, 0x4A, 0x31, 0x39, 0x67, 0x9C,
+  0xB8, 0xB2, 0x8D, 0x6A, 0x66, 0x82, 0xB3, 0xD7, 0xD7, 0xB2, 0x7D, 0x63,
+  0x67, 0x8C, 0xAF, 0xB4, 0x96, 0x5E, 0x30, 0x26, 0x42, 0x72, 0x90, 0x92,
+  0x73, 0x4B, 0x45, 0x5F, 0x99, 0xC7, 0xD5, 0xC0, 0x92, 0x6F, 0x6A, 0x87,
+  0xB0, 0xBA, 0xA5, 0x60, 0x37, 0x42, 0x64, 0xAD, 0xBF, 0xB3, 0x8D, 0x54,
+  0x2E, 0x2E, 0x56, 0x82, 0x92, 0x84, 0x5F, 0x39, 0x32, 0x50, 0x88, 0xB1,
+  0xBB, 0xA1, 0x77, 0x63, 0x72, 0x9D, 0xCC, 0xDB, 0xC7, 0x93, 0x6A, 0x60,
+  0x79, 0xA3, 0xB5, 0xA9, 0x78, 0x41, 0x25, 0x32, 0x5D, 0x87, 0x94, 0x83,
+  0x5A, 0x43, 0x4F, 0x7E, 0xB6, 0xD2, 0xCC, 0xA7, 0x7A, 0x68, 0x76, 0xA0,
+  0xBA, 0xB5, 0x85, 0x3F, 0x3D, 0x50, 0x8F, 0xBF, 0xBA, 0xA3, 0x6C, 0x3B,
+  0x29, 0x41, 0x71, 0x8F, 0x8E, 0x72, 0x46, 0x31, 0x3D, 0x70, 0xA2, 0xBB,
+  0xB0, 0x88, 0x67, 0x66, 0x86, 0xB8, 0xD9, 0xD4, 0xAB, 0x77, 0x60, 0x68,
+  0x91, 0xB2, 0xB5, 0x93, 0x59, 0x2E, 0x29, 0x49, 0x7A, 0x95, 0x93, 0x6F,
+  0x49, 0x45, 0x64, 0x9F, 0xC8, 0xD3, 0xB9, 0x89, 0x68, 0x69, 0x89, 0xB2,
+  0xBA, 0xA1, 0x59, 0x39, 0x43, 0x69, 0xB0, 0xBF, 0xB2, 0x87, 0x4F, 0x2D,
+  0x33, 0x5D, 0x89, 0x95, 0x84, 0x5B, 0x37, 0x34, 0x57, 0x8F, 0xB4, 0xBA,
+  0x9B, 0x72, 0x62, 0x74, 0xA2, 0xD0, 0xDA, 0xC2, 0x8C, 0x67, 0x60, 0x7E,
+  0xA8, 0xB8, 0xA7, 0x72, 0x3D, 0x27, 0x37, 0x64, 0x8D, 0x96, 0x81, 0x55,
+  0x41, 0x50, 0x83, 0xBA, 0xD1, 0xC8, 0x9F, 0x73, 0x64, 0x77, 0xA3, 0xBA,
+  0xB1, 0x7A, 0x3C, 0x3C, 0x51, 0x94, 0xBE, 0xB8, 0x9E, 0x66, 0x38, 0x2A,
+  0x48, 0x79, 0x94, 0x90, 0x70, 0x44, 0x32, 0x44, 0x78, 0xA8, 0xBC, 0xAD,
+  0x83, 0x65, 0x69, 0x8D, 0xC0, 0xDB, 0xD2, 0xA5, 0x74, 0x5A, 0x64, 0x92,
+  0xB2, 0xB4, 0x90, 0x55, 0x2E, 0x2E, 0x52, 0x85, 0x9E, 0x95, 0x6C, 0x45,
+  0x42, 0x64, 0xA0, 0xC8, 0xCD, 0xAE, 0x7B, 0x5D, 0x62, 0x89, 0xB2, 0xB9,
+  0x9F, 0x57, 0x3A, 0x42, 0x6D, 0xAF, 0xBD, 0xB1, 0x83, 0x4A, 0x2C, 0x38,
+  0x67, 0x92, 0x9B, 0x87, 0x59, 0x36, 0x36, 0x5D, 0x96, 0xB8, 0xB9, 0x94,
+  0x68, 0x5A, 0x71, 0xA1, 0xCD, 0xD6, 0xB8, 0x80, 0x5D, 0x5B, 0x7E, 0xAB,
+  0xBB, 0xA7, 0x70, 0x3B, 0x2A, 0x40, 0x72, 0x99, 0xA0, 0x83, 0x55, 0x42,
+  0x52, 0x88, 0xBC, 0xD0, 0xC1, 0x92, 0x67, 0x5D, 0x75, 0xA4, 0xBB, 0xB0,
+  0x76, 0x3F, 0x3E, 0x53, 0x95, 0xBC, 0xB9, 0x9C, 0x62, 0x35, 0x2E, 0x50,
+  0x83, 0x9B, 0x94, 0x6F, 0x42, 0x32, 0x47, 0x7F, 0xAD, 0xBD, 0xA6, 0x7A,
+  0x5D, 0x63, 0x8A, 0xBF, 0xD8, 0xCB, 0x9A, 0x69, 0x59, 0x6C, 0x9B, 0xBC,
+  0xBA, 0x8C, 0x4D, 0x26, 0x2C, 0x59, 0x8E, 0xA5, 0x98, 0x68, 0x4D, 0x53,
+  0x5D, 0x6A, 0x71, 0x77, 0x7B, 0x7E, 0x7C, 0x78, 0x72, 0x6A, 0x5E, 0x4E,
+  0x33, 0x41, 0x57, 0x70, 0x85, 0x74, 0x68, 0x5C, 0x54, 0x4D, 0x48, 0x45,
+  0x43, 0x3F, 0x42, 0x46, 0x49, 0x4E, 0x55, 0x5F, 0x6B, 0x75, 0x80, 0x8A,
+  0x91, 0x98, 0x9B, 0x9F, 0xA2, 0xA1, 0x9D, 0x9B, 0x95, 0x8F, 0x86, 0x7D,
+  0x72, 0x64, 0x5A, 0x53, 0x4D, 0x4A, 0x4C, 0x52, 0x5B, 0x65, 0x75, 0x83,
+  0x92, 0x9C, 0xA3, 0xA8, 0xAB, 0xAA, 0xA8, 0xA0, 0x9A, 0x8D, 0x7F, 0x64,
+  0x5A, 0x71, 0x81, 0x9E, 0x99, 0x84, 0x76, 0x6B, 0x63, 0x5D, 0x5B, 0x5A,
+  0x59, 0x59, 0x5F, 0x64, 0x69, 0x70, 0x79, 0x81, 0x8B, 0x92, 0x9B, 0xA1,
+  0xA6, 0xA8, 0xAA, 0xAC, 0xAC, 0xA8, 0xA4, 0xA0, 0x99, 0x93, 0x8A, 0x82,
+  0x77, 0x6C, 0x65, 0x61, 0x5F, 0x61, 0x64, 0x6A, 0x71, 0x7C, 0x87, 0x94,
+  0x9F, 0xA6, 0xAB, 0xAD, 0xAD, 0xA9, 0xA4, 0x9E, 0x94, 0x86, 0x74, 0x5E,
+  0x6E, 0x7D, 0x93, 0xA1, 0x91, 0x86, 0x7A, 0x73, 0x6B, 0x67, 0x64, 0x61,
+  0x5C, 0x5F, 0x61, 0x63, 0x67, 0x6E, 0x76, 0x80, 0x8A, 0x92, 0x9A, 0xA0,
+  0xA5, 0xA7, 0xAB, 0xAB, 0xAA, 0xA7, 0xA3, 0x9D, 0x97, 0x8E, 0x86, 0x7B,
+  0x70, 0x66, 0x5F, 0x5A, 0x59, 0x5B, 0x61, 0x68, 0x72, 0x7F, 0x8B, 0x98,
+  0xA1, 0xA7, 0xAB, 0xAD, 0xAB, 0xA8, 0xA2, 0x9A, 0x8E, 0x81, 0x68, 0x64,
+  0x77, 0x86, 0x9E, 0x95, 0x86, 0x7B, 0x71, 0x6B, 0x66, 0x65, 0x64, 0x63,
+  0x64, 0x69, 0x6C, 0x71, 0x77, 0x7C, 0x83, 0x8B, 0x91, 0x98, 0x9D, 0xA1,
+  0xA2, 0xA5, 0xA5, 0xA5, 0xA1, 0x9E, 0x9A, 0x96, 0x8F, 0x88, 0x81, 0x77,
+  0x6F, 0x69, 0x65, 0x62, 0x63, 0x66, 0x6A, 0x70, 0x7B, 0x84, 0x90, 0x98,
+  0x9E, 0xA1, 0xA4, 0xA4, 0xA2, 0x9D, 0x99, 0x90, 0x86, 0x74, 0x61, 0x73,
+  0x82, 0x99, 0xA2, 0x92, 0x86, 0x7A, 0x72, 0x6B, 0x66, 0x63, 0x60, 0x5D,
+  0x5E, 0x61, 0x64, 0x68, 0x6E, 0x75, 0x7E, 0x85, 0x8D, 0x92, 0x98, 0x9B,
+  0x9E, 0xA0, 0xA0, 0x9F, 0x9B, 0x99, 0x94, 0x8E, 0x87, 0x80, 0x76, 0x6D,
+  0x65, 0x61, 0x5D, 0x5C, 0x5F, 0x64, 0x6A, 0x73, 0x7D, 0x87, 0x91, 0x98,
+  0x9D, 0xA0, 0xA2, 0x9F, 0x9C, 0x97, 0x91, 0x86, 0x7C, 0x66, 0x67, 0x77,
+  0x84, 0x98, 0x8F, 0x82, 0x79, 0x71, 0x6D, 0x69, 0x67, 0x66, 0x65, 0x66,
+  0x6A, 0x6D, 0x70, 0x74, 0x7A, 0x80, 0x87, 0x8D, 0x93, 0x97, 0x9B, 0x9D,
+  0x9F, 0xA0, 0x9F, 0x9C, 0x9A, 0x96, 0x92, 0x8C, 0x85, 0x7E, 0x75, 0x6E,
+  0x68, 0x65, 0x63, 0x63, 0x66, 0x6B, 0x70, 0x79, 0x82, 0x8C, 0x93, 0x98,
+  0x9B, 0x9D, 0x9D, 0x9B, 0x97, 0x92, 0x8A, 0x82, 0x72, 0x63, 0x73, 0x7F,
+  0x95, 0x98, 0x89, 0x80, 0x76, 0x71, 0x6B, 0x68, 0x66, 0x63, 0x60, 0x63,
+  0x66, 0x68, 0x6D, 0x73, 0x7A, 0x83, 0x8A, 0x91, 0x97, 0x9C, 0x99, 0x98,
+  0x99, 0x99, 0x97, 0x93, 0x91, 0x8D, 0x89, 0x83, 0x7E, 0x77, 0x6F, 0x69,
+  0x66, 0x63, 0x64, 0x66, 0x6B, 0x70, 0x77, 0x7F, 0x87, 0x8E, 0x93, 0x96,
+  0x98, 0x99, 0x96, 0x93, 0x8F, 0x8A, 0x83, 0x7A, 0x6A, 0x6C, 0x77, 0x83,
+  0x8E, 0x87, 0x7F, 0x78, 0x74, 0x71, 0x6F, 0x6E, 0x6E, 0x6D, 0x6F, 0x72,
+  0x74, 0x76, 0x79, 0x7C, 0x80, 0x85, 0x89, 0x8D, 0x90, 0x92, 0x92, 0x94,
+  0x95, 0x94, 0x92, 0x91, 0x8F, 0x8C, 0x88, 0x85, 0x80, 0x7A, 0x76, 0x72,
+  0x6F, 0x6D, 0x6D, 0x6F, 0x71, 0x75, 0x7B, 0x81, 0x87, 0x8C, 0x90, 0x91,
+  0x93, 0x92, 0x91, 0x8F, 0x8C, 0x86, 0x7F, 0x73, 0x6E, 0x7A, 0x82, 0x91,
+  0x90, 0x86, 0x7F, 0x78, 0x73, 0x6E, 0x6C, 0x69, 0x66, 0x64, 0x66, 0x68,
+  0x6B, 0x6F, 0x75, 0x7B, 0x82, 0x87, 0x8D, 0x91, 0x96, 0x99, 0x9A, 0x9C,
+  0x9B, 0x99, 0x95, 0x92, 0x8E, 0x89, 0x84, 0x7E, 0x77, 0x70, 0x6B, 0x69,
+  0x67, 0x68, 0x6A, 0x6E, 0x71, 0x76, 0x7B, 0x81, 0x86, 0x89, 0x8C, 0x8D,
+  0x8D, 0x8B, 0x89, 0x87, 0x83, 0x7D, 0x77, 0x6C, 0x70, 0x77, 0x80, 0x87,
+  0x81, 0x7C, 0x78, 0x76, 0x73, 0x72, 0x71, 0x70, 0x70, 0x71, 0x73, 0x74,
+  0x76, 0x78, 0x7A, 0x7E, 0x81, 0x84, 0x87, 0x89, 0x8A, 0x8C, 0x8D, 0x8D,
+  0x8D, 0x8C, 0x8C, 0x8A, 0x88, 0x85, 0x83, 0x7F, 0x7B, 0x77, 0x75, 0x72,
+  0x71, 0x72, 0x73, 0x75, 0x78, 0x7C, 0x81, 0x86, 0x8A, 0x8C, 0x8D, 0x8F,
+  0x8E, 0x8D, 0x8B, 0x89, 0x85, 0x81, 0x77, 0x74, 0x7D, 0x82, 0x8C, 0x8A,
+  0x83, 0x7E, 0x79, 0x76, 0x72, 0x70, 0x6E, 0x6D, 0x6C, 0x6E, 0x70, 0x73,
+  0x75, 0x78, 0x7D, 0x81, 0x85, 0x8A, 0x8D, 0x8F, 0x90, 0x91, 0x91, 0x91,
+  0x8F, 0x8E, 0x8C, 0x89, 0x86, 0x82, 0x7E, 0x79, 0x75, 0x72, 0x70, 0x6F,
+  0x71, 0x73, 0x76, 0x79, 0x7E, 0x83, 0x88, 0x8D, 0x90, 0x92, 0x8D, 0x87,
+  0x85, 0x82, 0x81, 0x7F, 0x7C, 0x78, 0x72, 0x76, 0x79, 0x7E, 0x82, 0x7F,
+  0x7D, 0x7B, 0x7A, 0x79, 0x78, 0x79, 0x78, 0x79, 0x78, 0x79, 0x7A, 0x7A,
+  0x7B, 0x7C, 0x7D, 0x7F, 0x80, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x86,
+  0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x7F, 0x7D, 0x7C, 0x7A, 0x79, 0x78,
+  0x78, 0x79, 0x79, 0x7A, 0x7D, 0x80, 0x82, 0x84, 0x86, 0x86, 0x88, 0x87,
+  0x86, 0x86, 0x85, 0x83, 0x82, 0x7C, 0x7C, 0x80, 0x83, 0x87, 0x85, 0x81,
+  0x7F, 0x7D, 0x7B, 0x79, 0x78, 0x76, 0x75, 0x76, 0x77, 0x78, 0x7A, 0x7C,
+  0x7D, 0x7F, 0x81, 0x83, 0x85, 0x87, 0x88, 0x88, 0x89, 0x89, 0x88, 0x87,
+  0x86, 0x85, 0x83, 0x81, 0x80, 0x7E, 0x7B, 0x78, 0x78, 0x77, 0x77, 0x78,
+  0x7A, 0x7B, 0x7C, 0x80, 0x83, 0x85, 0x87, 0x88, 0x89, 0x8A, 0x89, 0x89,
+  0x88, 0x85, 0x83, 0x80, 0x7B, 0x77, 0x7A, 0x7E, 0x84, 0x86, 0x81, 0x7B,
+  0x79, 0x79, 0x78, 0x79, 0x78, 0x79, 0x79, 0x7A, 0x79, 0x7A, 0x7B, 0x7A,
+  0x7B, 0x7A, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B,
+  0x7C, 0x7D, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7D,
+  0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F,
+  0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x4C, 0x49,
+  0x53, 0x54, 0x18, 0x00, 0x00, 0x00, 0x49, 0x4E, 0x46, 0x4F, 0x49, 0x43,
+  0x52, 0x44, 0x0C, 0x00, 0x00, 0x00, 0x31, 0x39, 0x39, 0x34, 0x2D, 0x31,
+  0x32, 0x2D, 0x30, 0x38, 0x00, 0x00, 0x69, 0x64, 0x33, 0x20, 0x20, 0x00,
+  0x00, 0x00, 0x49, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x54, 0x44, 0x52, 0x43, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x31,
+  0x39, 0x39, 0x34, 0x2D, 0x31, 0x32, 0x2D, 0x30, 0x38, 0x00
+};
+
+uint8_t pacmanDeath[17092] = {
+  0x52, 0x49, 0x46, 0x46, 0xBC, 0x42, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
+  0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x11, 0x2B, 0x00, 0x00, 0x11, 0x2B, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
+  0x64, 0x61, 0x74, 0x61, 0x14, 0x42, 0x00, 0x00, 0x7F, 0x84, 0x7B, 0x85,
+  0xB2, 0xC1, 0xA5, 0xAE, 0xD8, 0xDC, 0xDB, 0xF8, 0xE9, 0x98, 0x65, 0x73,
+  0x80, 0x7F, 0x9C, 0xC2, 0xB7, 0x91, 0x96, 0xBE, 0xCB, 0xCB, 0xE5, 0xE6,
+  0xA0, 0x62, 0x6A, 0x7F, 0x7C, 0x90, 0xBA, 0xBB, 0x96, 0x90, 0xB6, 0xCB,
+  0xC7, 0xDA, 0xE7, 0xAC, 0x63, 0x5E, 0x74, 0x72, 0x7E, 0xA6, 0xB1, 0x8E,
+  0x7B, 0x9B, 0xB7, 0xB4, 0xC3, 0xD9, 0xAB, 0x5D, 0x4F, 0x68, 0x68, 0x6E,
+  0x94, 0xA7, 0x8A, 0x70, 0x89, 0xAA, 0xAA, 0xB1, 0xCA, 0xAD, 0x5B, 0x38,
+  0x4E, 0x54, 0x56, 0x7C, 0x9B, 0x86, 0x66, 0x78, 0x9E, 0xA5, 0xA7, 0xC2,
+  0xB7, 0x68, 0x36, 0x48, 0x56, 0x54, 0x74, 0x9C, 0x90, 0x6D, 0x76, 0x9E,
+  0xAB, 0xA9, 0xC3, 0xC5, 0x7F, 0x41, 0x4B, 0x5E, 0x59, 0x70, 0x9A, 0x99,
+  0x73, 0x6F, 0x94, 0xA7, 0xA4, 0xB8, 0xC4, 0x88, 0x40, 0x3D, 0x52, 0x4F,
+  0x5F, 0x89, 0x91, 0x6E, 0x60, 0x81, 0x9B, 0x98, 0xA7, 0xBC, 0x8D, 0x3B,
+  0x2A, 0x43, 0x46, 0x4F, 0x7A, 0x8F, 0x70, 0x58, 0x75, 0x98, 0x98, 0xA2,
+  0xBD, 0x9E, 0x4C, 0x2E, 0x48, 0x50, 0x53, 0x79, 0x98, 0x82, 0x63, 0x76,
+  0x9D, 0xA1, 0xA4, 0xC0, 0xAF, 0x60, 0x33, 0x46, 0x51, 0x50, 0x70, 0x93,
+  0x84, 0x60, 0x69, 0x90, 0x9B, 0x99, 0xB5, 0xB4, 0x6C, 0x32, 0x3F, 0x54,
+  0x52, 0x69, 0x91, 0x8D, 0x67, 0x60, 0x84, 0x9C, 0x98, 0xA7, 0xBE, 0x93,
+  0x41, 0x29, 0x42, 0x47, 0x49, 0x6E, 0x90, 0x7F, 0x5C, 0x64, 0x8C, 0x9B,
+  0x99, 0xB0, 0xB9, 0x7B, 0x32, 0x2E, 0x48, 0x48, 0x52, 0x7E, 0x94, 0x76,
+  0x5C, 0x76, 0x9B, 0x9D, 0xA1, 0xBE, 0xB2, 0x67, 0x34, 0x42, 0x52, 0x4F,
+  0x66, 0x8F, 0x93, 0x71, 0x64, 0x84, 0xA1, 0x9F, 0xA9, 0xC1, 0xA1, 0x51,
+  0x2F, 0x46, 0x50, 0x4E, 0x6E, 0x93, 0x87, 0x60, 0x63, 0x8C, 0x9D, 0x99,
+  0xAE, 0xBC, 0x82, 0x36, 0x2E, 0x47, 0x48, 0x50, 0x79, 0x92, 0x79, 0x5C,
+  0x70, 0x96, 0x9F, 0xA0, 0xBA, 0xB6, 0x70, 0x35, 0x3F, 0x54, 0x50, 0x62,
+  0x8D, 0x97, 0x73, 0x63, 0x83, 0xA1, 0x9F, 0xA9, 0xC3, 0xA6, 0x56, 0x2F,
+  0x44, 0x4F, 0x4B, 0x68, 0x8F, 0x86, 0x60, 0x5D, 0x84, 0x9D, 0x9C, 0xAD,
+  0xBF, 0x92, 0x48, 0x38, 0x50, 0x51, 0x52, 0x79, 0x97, 0x7F, 0x5E, 0x6D,
+  0x94, 0x9D, 0x9C, 0xB6, 0xB9, 0x75, 0x32, 0x34, 0x4A, 0x48, 0x58, 0x83,
+  0x93, 0x73, 0x5C, 0x77, 0x9B, 0x9D, 0xA2, 0xBF, 0xAD, 0x5D, 0x2E, 0x42,
+  0x53, 0x50, 0x69, 0x93, 0x92, 0x6D, 0x67, 0x8C, 0xA5, 0xA1, 0xB0, 0xC5,
+  0x9D, 0x50, 0x38, 0x4F, 0x55, 0x57, 0x79, 0x9A, 0x8A, 0x68, 0x70, 0x98,
+  0xA5, 0xA2, 0xB9, 0xC1, 0x85, 0x3E, 0x38, 0x51, 0x52, 0x56, 0x7A, 0x97,
+  0x85, 0x62, 0x68, 0x91, 0xA3, 0x9E, 0xB2, 0xC4, 0x93, 0x43, 0x2E, 0x47,
+  0x4F, 0x4E, 0x6F, 0x95, 0x8E, 0x6B, 0x67, 0x8B, 0xA4, 0xA1, 0xAD, 0xC6,
+  0xAA, 0x5D, 0x36, 0x49, 0x57, 0x54, 0x6B, 0x93, 0x97, 0x74, 0x63, 0x81,
+  0xA1, 0xA1, 0xA6, 0xC1, 0xB5, 0x6A, 0x32, 0x3A, 0x4D, 0x48, 0x56, 0x82,
+  0x98, 0x7C, 0x62, 0x78, 0xA0, 0xA8, 0xA7, 0xBF, 0xC1, 0x82, 0x3E, 0x39,
+  0x50, 0x51, 0x56, 0x7D, 0x9A, 0x85, 0x63, 0x6E, 0x96, 0xA5, 0xA0, 0xB4,
+  0xC5, 0x93, 0x44, 0x2F, 0x49, 0x50, 0x50, 0x72, 0x97, 0x8D, 0x69, 0x66,
+  0x8B, 0xA4, 0xA0, 0xAD, 0xC5, 0xA7, 0x5A, 0x35, 0x49, 0x57, 0x55, 0x6D,
+  0x95, 0x98, 0x75, 0x66, 0x85, 0xA4, 0xA5, 0xAA, 0xC4, 0xB8, 0x6E, 0x37,
+  0x42, 0x55, 0x52, 0x62, 0x8D, 0x9C, 0x7E, 0x65, 0x7A, 0x9E, 0xA3, 0xA2,
+  0xBC, 0xBE, 0x7D, 0x39, 0x37, 0x4F, 0x4F, 0x56, 0x7D, 0x99, 0x83, 0x63,
+  0x6F, 0x97, 0xA5, 0xA1, 0xB6, 0xC5, 0x91, 0x45, 0x36, 0x50, 0x55, 0x56,
+  0x79, 0x9D, 0x92, 0x6F, 0x6E, 0x92, 0xA9, 0xA5, 0xB2, 0xC9, 0xA8, 0x5A,
+  0x37, 0x4C, 0x58, 0x54, 0x6C, 0x94, 0x95, 0x70, 0x62, 0x83, 0xA1, 0x9F,
+  0xA5, 0xC0, 0xB0, 0x66, 0x34, 0x42, 0x58, 0x58, 0x66, 0x8F, 0xA0, 0x84,
+  0x67, 0x74, 0x9A, 0xA8, 0xA3, 0xB4, 0xC9, 0xA1, 0x51, 0x30, 0x47, 0x54,
+  0x50, 0x65, 0x8F, 0x9A, 0x7A, 0x61, 0x76, 0x9C, 0xA4, 0xA1, 0xB8, 0xC4,
+  0x90, 0x45, 0x31, 0x4A, 0x53, 0x52, 0x6D, 0x94, 0x97, 0x76, 0x65, 0x80,
+  0xA3, 0xA6, 0xA6, 0xC0, 0xC4, 0x87, 0x42, 0x39, 0x53, 0x58, 0x59, 0x78,
+  0x9C, 0x95, 0x70, 0x67, 0x89, 0xA7, 0xA5, 0xA9, 0xC3, 0xBC, 0x77, 0x3A,
+  0x3D, 0x55, 0x55, 0x59, 0x7D, 0x9D, 0x8E, 0x69, 0x69, 0x8F, 0xA7, 0xA2,
+  0xAC, 0xC7, 0xB4, 0x67, 0x31, 0x3D, 0x54, 0x52, 0x5C, 0x85, 0x9F, 0x89,
+  0x68, 0x71, 0x99, 0xAC, 0xA6, 0xB4, 0xCB, 0xAD, 0x61, 0x38, 0x4A, 0x5B,
+  0x56, 0x66, 0x8F, 0x9F, 0x81, 0x65, 0x75, 0x9A, 0xA6, 0xA0, 0xB2, 0xC3,
+  0x96, 0x46, 0x28, 0x41, 0x4F, 0x4E, 0x67, 0x91, 0x9A, 0x7D, 0x69, 0x81,
+  0xA4, 0xA8, 0xA4, 0xBC, 0xC6, 0x8E, 0x44, 0x34, 0x4D, 0x53, 0x52, 0x70,
+  0x97, 0x95, 0x71, 0x62, 0x80, 0xA3, 0xA4, 0xA5, 0xC0, 0xBF, 0x7C, 0x38,
+  0x35, 0x50, 0x52, 0x54, 0x77, 0x9A, 0x91, 0x6E, 0x69, 0x8C, 0xA8, 0xA6,
+  0xAC, 0xC6, 0xBB, 0x74, 0x3B, 0x41, 0x58, 0x58, 0x5F, 0x83, 0xA0, 0x8E,
+  0x6C, 0x6F, 0x95, 0xAA, 0xA4, 0xB1, 0xCA, 0xB0, 0x65, 0x38, 0x43, 0x57,
+  0x57, 0x5E, 0x81, 0x9E, 0x92, 0x6D, 0x68, 0x8A, 0xA7, 0xA6, 0xA7, 0xC1,
+  0xC4, 0x86, 0x3E, 0x32, 0x4D, 0x56, 0x53, 0x6B, 0x94, 0x9D, 0x7A, 0x62,
+  0x79, 0xA0, 0xAA, 0xA3, 0xB5, 0xCC, 0xAB, 0x5D, 0x36, 0x49, 0x5B, 0x57,
+  0x62, 0x89, 0xA1, 0x8D, 0x6A, 0x6C, 0x8F, 0xA6, 0xA3, 0xA7, 0xC2, 0xBC,
+  0x78, 0x38, 0x35, 0x4C, 0x4E, 0x4D, 0x6B, 0x93, 0x97, 0x76, 0x63, 0x7F,
+  0xA4, 0xAD, 0xA9, 0xBB, 0xCA, 0xA2, 0x55, 0x32, 0x46, 0x58, 0x53, 0x60,
+  0x88, 0xA0, 0x89, 0x66, 0x6B, 0x92, 0xA9, 0xA5, 0xAC, 0xC7, 0xBB, 0x71,
+  0x34, 0x39, 0x52, 0x54, 0x55, 0x74, 0x9A, 0x98, 0x72, 0x62, 0x81, 0xA3,
+  0xA6, 0xA5, 0xBD, 0xC9, 0x97, 0x4D, 0x36, 0x4E, 0x5A, 0x56, 0x68, 0x8F,
+  0xA0, 0x86, 0x68, 0x73, 0x98, 0xA9, 0xA5, 0xB0, 0xC8, 0xB4, 0x6C, 0x38,
+  0x3F, 0x55, 0x55, 0x5A, 0x7B, 0x9C, 0x94, 0x6F, 0x63, 0x83, 0xA3, 0xA6,
+  0xA5, 0xBC, 0xC5, 0x8F, 0x43, 0x2F, 0x49, 0x55, 0x52, 0x67, 0x91, 0x9E,
+  0x7F, 0x63, 0x74, 0x9B, 0xA9, 0xA4, 0xB2, 0xCB, 0xB3, 0x67, 0x38, 0x47,
+  0x5C, 0x58, 0x60, 0x85, 0xA2, 0x93, 0x6F, 0x6B, 0x8C, 0xA7, 0xA5, 0xA7,
+  0xC0, 0xC1, 0x83, 0x3E, 0x34, 0x4C, 0x51, 0x4D, 0x67, 0x8F, 0x99, 0x7A,
+  0x64, 0x7D, 0xA5, 0xAD, 0xAB, 0xC2, 0xC9, 0x92, 0x49, 0x37, 0x4F, 0x56,
+  0x55, 0x71, 0x99, 0x98, 0x73, 0x64, 0x83, 0xA5, 0xA5, 0xA6, 0xC1, 0xC0,
+  0x7F, 0x3B, 0x36, 0x50, 0x53, 0x55, 0x78, 0x9C, 0x92, 0x6D, 0x67, 0x8A,
+  0xA6, 0xA3, 0xA9, 0xC5, 0xBA, 0x72, 0x38, 0x3E, 0x56, 0x56, 0x5C, 0x81,
+  0x9E, 0x8D, 0x6A, 0x6E, 0x94, 0xAA, 0xA5, 0xB0, 0xC8, 0xB2, 0x68, 0x38,
+  0x46, 0x5A, 0x56, 0x62, 0x8B, 0xA1, 0x88, 0x68, 0x73, 0x9A, 0xA9, 0xA3,
+  0xB4, 0xCA, 0xA4, 0x54, 0x30, 0x45, 0x56, 0x52, 0x65, 0x90, 0x9E, 0x7F,
+  0x65, 0x79, 0xA0, 0xAA, 0xA5, 0xBB, 0xCB, 0x9C, 0x4E, 0x38, 0x52, 0x5C,
+  0x58, 0x71, 0x99, 0x9D, 0x7B, 0x68, 0x81, 0xA5, 0xA9, 0xA6, 0xBF, 0xC5,
+  0x89, 0x42, 0x37, 0x50, 0x54, 0x52, 0x70, 0x95, 0x90, 0x69, 0x5D, 0x7F,
+  0xA0, 0xA2, 0xA6, 0xC1, 0xBF, 0x7F, 0x41, 0x40, 0x56, 0x55, 0x58, 0x7C,
+  0x9C, 0x8F, 0x6A, 0x67, 0x8D, 0xA7, 0xA2, 0xAA, 0xC6, 0xB4, 0x69, 0x32,
+  0x3D, 0x53, 0x51, 0x5A, 0x83, 0x9F, 0x89, 0x66, 0x6D, 0x94, 0xA7, 0xA2,
+  0xB0, 0xC8, 0xAC, 0x5F, 0x35, 0x46, 0x58, 0x55, 0x63, 0x8C, 0x9F, 0x85,
+  0x68, 0x76, 0x9D, 0xAA, 0xA6, 0xB8, 0xCA, 0xA3, 0x57, 0x38, 0x4E, 0x5C,
+  0x57, 0x6C, 0x96, 0x9D, 0x7A, 0x68, 0x85, 0xA6, 0xA7, 0xAA, 0xC5, 0xBC,
+  0x72, 0x37, 0x40, 0x55, 0x53, 0x60, 0x8A, 0x9E, 0x81, 0x64, 0x78, 0x9F,
+  0xA8, 0xA5, 0xBE, 0xC4, 0x86, 0x40, 0x3A, 0x52, 0x54, 0x5B, 0x82, 0x9E,
+  0x8C, 0x6D, 0x74, 0x9A, 0xAB, 0xA6, 0xB8, 0xC9, 0x9A, 0x4F, 0x3A, 0x51,
+  0x57, 0x56, 0x76, 0x9A, 0x91, 0x6C, 0x68, 0x8B, 0xA2, 0x9F, 0xAA, 0xC3,
+  0xA6, 0x54, 0x2C, 0x44, 0x56, 0x51, 0x6A, 0x97, 0x9E, 0x7C, 0x6B, 0x87,
+  0xA7, 0xA7, 0xAA, 0xC5, 0xB9, 0x6E, 0x36, 0x40, 0x55, 0x53, 0x61, 0x8B,
+  0x9E, 0x80, 0x64, 0x79, 0xA0, 0xA7, 0xA6, 0xBF, 0xC3, 0x83, 0x3D, 0x38,
+  0x51, 0x52, 0x58, 0x80, 0x9C, 0x88, 0x69, 0x72, 0x98, 0xA7, 0xA4, 0xB8,
+  0xC8, 0x98, 0x4C, 0x3A, 0x52, 0x58, 0x58, 0x78, 0x9D, 0x93, 0x6E, 0x6C,
+  0x91, 0xA8, 0xA3, 0xB0, 0xC8, 0xA9, 0x5B, 0x36, 0x4B, 0x58, 0x54, 0x6C,
+  0x95, 0x98, 0x75, 0x66, 0x85, 0xA3, 0xA3, 0xA8, 0xC4, 0xB5, 0x69, 0x32,
+  0x3F, 0x55, 0x51, 0x60, 0x8C, 0x9C, 0x7C, 0x63, 0x7B, 0xA0, 0xA7, 0xA8,
+  0xC2, 0xC4, 0x84, 0x42, 0x41, 0x58, 0x59, 0x61, 0x88, 0xA1, 0x8B, 0x6C,
+  0x76, 0x9B, 0xA9, 0xA5, 0xBA, 0xC7, 0x94, 0x49, 0x38, 0x50, 0x55, 0x54,
+  0x76, 0x98, 0x8B, 0x66, 0x67, 0x90, 0xA6, 0xA3, 0xB7, 0xC8, 0x97, 0x4E,
+  0x41, 0x57, 0x57, 0x5C, 0x82, 0x9D, 0x86, 0x67, 0x77, 0x9E, 0xA6, 0xA5,
+  0xC0, 0xC1, 0x78, 0x37, 0x3E, 0x55, 0x51, 0x62, 0x8E, 0x9A, 0x77, 0x63,
+  0x81, 0xA2, 0xA4, 0xAB, 0xC5, 0xAD, 0x5E, 0x33, 0x47, 0x57, 0x54, 0x6E,
+  0x97, 0x94, 0x6F, 0x6A, 0x91, 0xA8, 0xA3, 0xB4, 0xC9, 0x9C, 0x4E, 0x3B,
+  0x54, 0x58, 0x5B, 0x80, 0x9E, 0x8B, 0x6B, 0x75, 0x9B, 0xA9, 0xA7, 0xBE,
+  0xC4, 0x86, 0x41, 0x3F, 0x56, 0x55, 0x60, 0x8A, 0x9D, 0x7D, 0x63, 0x7E,
+  0xA3, 0xA4, 0xA9, 0xC6, 0xB6, 0x68, 0x36, 0x46, 0x55, 0x53, 0x6C, 0x96,
+  0x97, 0x74, 0x6B, 0x8E, 0xA9, 0xA7, 0xB4, 0xCB, 0xA7, 0x58, 0x3B, 0x53,
+  0x5B, 0x5A, 0x7C, 0x9F, 0x90, 0x6B, 0x71, 0x99, 0xA7, 0xA2, 0xB8, 0xC3,
+  0x86, 0x3D, 0x38, 0x4F, 0x4C, 0x54, 0x7E, 0x95, 0x7D, 0x64, 0x78, 0x9F,
+  0xA8, 0xAA, 0xC5, 0xBE, 0x73, 0x38, 0x44, 0x58, 0x52, 0x65, 0x91, 0x98,
+  0x73, 0x64, 0x86, 0xA4, 0xA2, 0xAE, 0xC8, 0xA7, 0x55, 0x32, 0x48, 0x53,
+  0x53, 0x73, 0x99, 0x8F, 0x6A, 0x6A, 0x92, 0xA7, 0xA3, 0xB6, 0xC7, 0x94,
+  0x48, 0x3A, 0x55, 0x58, 0x5C, 0x83, 0xA0, 0x88, 0x6A, 0x7A, 0xA0, 0xA8,
+  0xA8, 0xC1, 0xC1, 0x7E, 0x40, 0x44, 0x58, 0x57, 0x6B, 0x95, 0x99, 0x75,
+  0x6D, 0x90, 0xA7, 0xA5, 0xB8, 0xC7, 0x90, 0x45, 0x3D, 0x53, 0x52, 0x5F,
+  0x8A, 0x9A, 0x78, 0x65, 0x86, 0xA6, 0xA3, 0xAF, 0xC8, 0x9F, 0x4C, 0x36,
+  0x50, 0x54, 0x5A, 0x83, 0x9D, 0x82, 0x67, 0x7F, 0xA5, 0xA7, 0xAD, 0xC8,
+  0xAE, 0x5F, 0x3B, 0x51, 0x59, 0x59, 0x7C, 0x9C, 0x89, 0x68, 0x76, 0x9D,
+  0xA4, 0xA5, 0xBF, 0xB5, 0x69, 0x36, 0x43, 0x4F, 0x4C, 0x6A, 0x93, 0x8D,
+  0x6B, 0x6F, 0x9A, 0xAB, 0xAA, 0xC1, 0xC6, 0x82, 0x40, 0x45, 0x58, 0x53,
+  0x69, 0x95, 0x97, 0x72, 0x6B, 0x91, 0xA8, 0xA4, 0xB8, 0xC9, 0x90, 0x43,
+  0x3D, 0x55, 0x53, 0x60, 0x8E, 0x9B, 0x78, 0x66, 0x87, 0xA5, 0xA3, 0xB1,
+  0xC8, 0x9E, 0x4E, 0x3A, 0x52, 0x56, 0x5E, 0x86, 0x9D, 0x82, 0x68, 0x7F,
+  0xA3, 0xA5, 0xAC, 0xC7, 0xAC, 0x5B, 0x38, 0x4E, 0x56, 0x59, 0x7D, 0x9C,
+  0x88, 0x67, 0x76, 0x9E, 0xA5, 0xA6, 0xC2, 0xB6, 0x67, 0x36, 0x48, 0x55,
+  0x52, 0x6F, 0x96, 0x8C, 0x67, 0x6C, 0x97, 0xA5, 0xA3, 0xBD, 0xBF, 0x76,
+  0x37, 0x40, 0x54, 0x52, 0x69, 0x94, 0x95, 0x72, 0x6C, 0x92, 0xA9, 0xA6,
+  0xBB, 0xC7, 0x8D, 0x46, 0x44, 0x5A, 0x57, 0x66, 0x91, 0x9C, 0x7A, 0x6A,
+  0x8B, 0xA7, 0xA4, 0xB1, 0xC6, 0x99, 0x49, 0x39, 0x50, 0x4F, 0x59, 0x84,
+  0x94, 0x74, 0x67, 0x8C, 0xA6, 0xA6, 0xBC, 0xCB, 0x8D, 0x44, 0x43, 0x58,
+  0x55, 0x6A, 0x96, 0x94, 0x6E, 0x6E, 0x98, 0xA7, 0xA6, 0xC1, 0xBC, 0x6E,
+  0x37, 0x47, 0x54, 0x53, 0x75, 0x9A, 0x88, 0x65, 0x77, 0x9F, 0xA3, 0xA9,
+  0xC5, 0xAA, 0x57, 0x37, 0x4F, 0x54, 0x5A, 0x83, 0x9B, 0x7D, 0x67, 0x86,
+  0xA5, 0xA4, 0xB2, 0xC7, 0x96, 0x49, 0x40, 0x57, 0x56, 0x66, 0x92, 0x98,
+  0x74, 0x6D, 0x93, 0xA8, 0xA5, 0xBC, 0xC2, 0x7E, 0x3E, 0x47, 0x58, 0x55,
+  0x71, 0x9A, 0x8E, 0x69, 0x72, 0x9C, 0xA6, 0xA7, 0xC3, 0xB6, 0x64, 0x36,
+  0x4A, 0x55, 0x56, 0x7D, 0x9C, 0x83, 0x67, 0x7F, 0xA4, 0xA5, 0xB0, 0xC9,
+  0xA4, 0x54, 0x40, 0x57, 0x59, 0x63, 0x8D, 0x9D, 0x7C, 0x6B, 0x8D, 0xA8,
+  0xA4, 0xB7, 0xC6, 0x8B, 0x41, 0x3F, 0x54, 0x52, 0x65, 0x8E, 0x8E, 0x69,
+  0x66, 0x8E, 0x9E, 0x9E, 0xBB, 0xBA, 0x6F, 0x3A, 0x4B, 0x5B, 0x5A, 0x78,
+  0x9A, 0x89, 0x68, 0x77, 0x9E, 0xA3, 0xA8, 0xC4, 0xAC, 0x58, 0x35, 0x4C,
+  0x52, 0x58, 0x81, 0x9B, 0x7D, 0x64, 0x82, 0xA4, 0xA2, 0xAF, 0xC6, 0x96,
+  0x46, 0x39, 0x52, 0x52, 0x60, 0x8E, 0x98, 0x74, 0x6B, 0x91, 0xA7, 0xA4,
+  0xBB, 0xC3, 0x82, 0x41, 0x46, 0x59, 0x58, 0x70, 0x9A, 0x93, 0x6D, 0x76,
+  0x9D, 0xA5, 0xAB, 0xC7, 0xAF, 0x5D, 0x3C, 0x54, 0x59, 0x60, 0x8D, 0x9C,
+  0x75, 0x6C, 0x93, 0xA5, 0xA5, 0xBF, 0xBD, 0x72, 0x3A, 0x48, 0x56, 0x56,
+  0x7D, 0x9E, 0x7F, 0x66, 0x87, 0xA4, 0xA4, 0xB8, 0xC5, 0x8A, 0x43, 0x42,
+  0x58, 0x57, 0x71, 0x9C, 0x8F, 0x6C, 0x7F, 0xA3, 0xA5, 0xB0, 0xC8, 0xA1,
+  0x53, 0x40, 0x56, 0x57, 0x65, 0x92, 0x95, 0x6C, 0x6F, 0x98, 0xA1, 0xA2,
+  0xBE, 0xAC, 0x5B, 0x31, 0x45, 0x4E, 0x54, 0x82, 0x9A, 0x76, 0x6B, 0x94,
+  0xA9, 0xA7, 0xBD, 0xBE, 0x79, 0x3D, 0x46, 0x56, 0x56, 0x76, 0x9B, 0x82,
+  0x64, 0x82, 0xA3, 0xA2, 0xB4, 0xC4, 0x8D, 0x42, 0x3B, 0x52, 0x53, 0x69,
+  0x95, 0x8D, 0x66, 0x74, 0x9D, 0xA2, 0xAB, 0xC5, 0xA3, 0x53, 0x3A, 0x52,
+  0x56, 0x62, 0x8F, 0x97, 0x71, 0x6F, 0x97, 0xA5, 0xA7, 0xC2, 0xB8, 0x6B,
+  0x3B, 0x4E, 0x5A, 0x5B, 0x82, 0x9D, 0x7B, 0x68, 0x8C, 0xA4, 0xA3, 0xBA,
+  0xC3, 0x83, 0x41, 0x45, 0x57, 0x57, 0x74, 0x9A, 0x86, 0x64, 0x7D, 0xA1,
+  0xA1, 0xB1, 0xC7, 0x98, 0x49, 0x3C, 0x52, 0x53, 0x66, 0x95, 0x93, 0x6B,
+  0x74, 0x9C, 0xA5, 0xAC, 0xC7, 0xAE, 0x60, 0x41, 0x55, 0x59, 0x62, 0x8F,
+  0x9E, 0x78, 0x6F, 0x97, 0xA7, 0xA7, 0xC0, 0xBB, 0x72, 0x3D, 0x4A, 0x57,
+  0x52, 0x6F, 0x94, 0x8C, 0x69, 0x63, 0x84, 0x9E, 0x9C, 0xA8, 0xC2, 0xA9,
+  0x5E, 0x39, 0x4D, 0x5B, 0x57, 0x6A, 0x91, 0x98, 0x76, 0x65, 0x83, 0xA3,
+  0xA2, 0xA6, 0xC1, 0xB6, 0x6E, 0x36, 0x40, 0x54, 0x51, 0x5F, 0x88, 0x99,
+  0x7D, 0x63, 0x76, 0x9C, 0xA4, 0xA2, 0xBA, 0xBF, 0x83, 0x40, 0x3A, 0x51,
+  0x54, 0x59, 0x7E, 0x9A, 0x88, 0x69, 0x71, 0x96, 0xA4, 0xA2, 0xB4, 0xC4,
+  0x97, 0x4D, 0x3A, 0x52, 0x58, 0x58, 0x77, 0x9A, 0x92, 0x6F, 0x6C, 0x8F,
+  0xA6, 0xA2, 0xAE, 0xC6, 0xAA, 0x5F, 0x38, 0x4B, 0x59, 0x54, 0x6A, 0x94,
+  0x99, 0x76, 0x67, 0x85, 0xA4, 0xA4, 0xA9, 0xC3, 0xB7, 0x6F, 0x39, 0x44,
+  0x57, 0x54, 0x63, 0x8C, 0x9C, 0x80, 0x68, 0x7C, 0xA1, 0xA8, 0xA8, 0xC1,
+  0xC2, 0x83, 0x43, 0x42, 0x58, 0x58, 0x5F, 0x84, 0x9D, 0x89, 0x6A, 0x73,
+  0x97, 0xA4, 0xA0, 0xB4, 0xC1, 0x91, 0x48, 0x34, 0x49, 0x4F, 0x50, 0x72,
+  0x98, 0x8F, 0x6D, 0x6D, 0x93, 0xAA, 0xA6, 0xB1, 0xC7, 0xA8, 0x5C, 0x36,
+  0x4A, 0x57, 0x53, 0x6B, 0x94, 0x97, 0x75, 0x67, 0x85, 0xA4, 0xA4, 0xA9,
+  0xC3, 0xB4, 0x6A, 0x37, 0x44, 0x56, 0x52, 0x62, 0x8B, 0x9A, 0x7C, 0x65,
+  0x7D, 0xA1, 0xA6, 0xA6, 0xBF, 0xC0, 0x80, 0x40, 0x40, 0x57, 0x57, 0x5F,
+  0x85, 0x9E, 0x8A, 0x6B, 0x73, 0x97, 0xA9, 0xA5, 0xB2, 0xC8, 0xA9, 0x5F,
+  0x3A, 0x4C, 0x5B, 0x58, 0x67, 0x8E, 0x9E, 0x84, 0x69, 0x78, 0x9D, 0xA8,
+  0xA4, 0xB7, 0xC8, 0x9D, 0x51, 0x35, 0x4C, 0x58, 0x54, 0x6B, 0x93, 0x9B,
+  0x7A, 0x65, 0x7D, 0xA1, 0xA6, 0xA4, 0xBC, 0xC5, 0x8F, 0x49, 0x3B, 0x53,
+  0x5B, 0x5A, 0x76, 0x9B, 0x9A, 0x77, 0x6A, 0x87, 0xA5, 0xA5, 0xA7, 0xC0,
+  0xBF, 0x80, 0x40, 0x3B, 0x53, 0x56, 0x57, 0x76, 0x97, 0x8D, 0x68, 0x62,
+  0x85, 0xA1, 0xA1, 0xA8, 0xC2, 0xB8, 0x77, 0x41, 0x46, 0x5C, 0x59, 0x5E,
+  0x83, 0x9F, 0x8C, 0x6B, 0x6E, 0x93, 0xA8, 0xA4, 0xAF, 0xC7, 0xAF, 0x64,
+  0x35, 0x43, 0x57, 0x53, 0x60, 0x89, 0x9E, 0x85, 0x67, 0x73, 0x99, 0xA8,
+  0xA2, 0xB2, 0xC7, 0xA4, 0x59, 0x38, 0x4B, 0x59, 0x56, 0x69, 0x90, 0x9C,
+  0x80, 0x68, 0x7A, 0x9E, 0xA7, 0xA3, 0xB8, 0xC5, 0x96, 0x4D, 0x39, 0x50,
+  0x59, 0x56, 0x6F, 0x95, 0x99, 0x79, 0x67, 0x80, 0xA2, 0xA6, 0xA5, 0xBD,
+  0xC2, 0x89, 0x44, 0x38, 0x4F, 0x55, 0x55, 0x73, 0x98, 0x94, 0x70, 0x65,
+  0x85, 0xA4, 0xA3, 0xA6, 0xC1, 0xBC, 0x7A, 0x3D, 0x3D, 0x55, 0x57, 0x5C,
+  0x7F, 0x9F, 0x93, 0x71, 0x6F, 0x92, 0xAA, 0xA6, 0xAE, 0xC8, 0xB7, 0x6F,
+  0x3C, 0x45, 0x59, 0x57, 0x5F, 0x82, 0x9D, 0x8E, 0x6B, 0x67, 0x89, 0xA3,
+  0xA1, 0xA3, 0xBC, 0xBC, 0x81, 0x41, 0x39, 0x51, 0x5A, 0x5B, 0x75, 0x9C,
+  0x9E, 0x7B, 0x67, 0x7D, 0x9F, 0xA7, 0xA4, 0xB5, 0xC8, 0xA5, 0x58, 0x34,
+  0x47, 0x57, 0x53, 0x60, 0x87, 0x9E, 0x89, 0x68, 0x6C, 0x8F, 0xA5, 0xA2,
+  0xA9, 0xC1, 0xB9, 0x77, 0x3B, 0x39, 0x51, 0x55, 0x58, 0x73, 0x97, 0x97,
+  0x77, 0x66, 0x7F, 0xA0, 0xA7, 0xA4, 0xB8, 0xC7, 0x9D, 0x54, 0x37, 0x4B,
+  0x5A, 0x57, 0x65, 0x8B, 0x9F, 0x88, 0x69, 0x72, 0x96, 0xA8, 0xA2, 0xAC,
+  0xC6, 0xB8, 0x71, 0x3A, 0x40, 0x56, 0x56, 0x58, 0x77, 0x9A, 0x94, 0x71,
+  0x66, 0x84, 0xA3, 0xA5, 0xA5, 0xBC, 0xC6, 0x93, 0x4B, 0x36, 0x4D, 0x58,
+  0x56, 0x6B, 0x91, 0x9E, 0x85, 0x6B, 0x77, 0x9B, 0xAA, 0xA7, 0xB2, 0xC8,
+  0xB2, 0x6C, 0x3B, 0x44, 0x59, 0x58, 0x5D, 0x7D, 0x9B, 0x90, 0x6D, 0x64,
+  0x82, 0xA0, 0xA1, 0xA0, 0xB7, 0xBC, 0x83, 0x40, 0x35, 0x4E, 0x58, 0x57,
+  0x6E, 0x95, 0x9F, 0x7E, 0x64, 0x77, 0x9B, 0xA5, 0xA1, 0xB2, 0xC6, 0xA8,
+  0x5C, 0x33, 0x42, 0x55, 0x52, 0x5C, 0x81, 0x9D, 0x8E, 0x6A, 0x68, 0x8B,
+  0xA4, 0xA3, 0xA9, 0xC0, 0xBD, 0x81, 0x40, 0x38, 0x50, 0x57, 0x57, 0x71,
+  0x95, 0x9B, 0x7B, 0x66, 0x7B, 0x9F, 0xA9, 0xA4, 0xB3, 0xC8, 0xAD, 0x66,
+  0x38, 0x43, 0x59, 0x5A, 0x5C, 0x79, 0x9C, 0x9C, 0x7B, 0x67, 0x7B, 0x9D,
+  0xA8, 0xA4, 0xB1, 0xC9, 0xB6, 0x70, 0x3B, 0x3F, 0x54, 0x56, 0x56, 0x70,
+  0x95, 0x9D, 0x7E, 0x64, 0x75, 0x9A, 0xA8, 0xA3, 0xAD, 0xC4, 0xB7, 0x74,
+  0x3A, 0x39, 0x52, 0x59, 0x57, 0x6E, 0x95, 0xA0, 0x84, 0x68, 0x74, 0x97,
+  0xA8, 0xA5, 0xAC, 0xC4, 0xBF, 0x82, 0x42, 0x39, 0x51, 0x58, 0x55, 0x68,
+  0x8D, 0x9E, 0x84, 0x65, 0x6C, 0x8E, 0xA2, 0x9E, 0xA2, 0xBC, 0xBE, 0x84,
+  0x41, 0x38, 0x52, 0x5D, 0x5A, 0x67, 0x8B, 0xA0, 0x8B, 0x68, 0x6A, 0x8D,
+  0xA6, 0xA6, 0xA8, 0xBF, 0xC5, 0x92, 0x4A, 0x32, 0x47, 0x56, 0x54, 0x60,
+  0x85, 0xA0, 0x8E, 0x6B, 0x69, 0x89, 0xA5, 0xA5, 0xA4, 0xBA, 0xC7, 0x99,
+  0x50, 0x34, 0x49, 0x58, 0x56, 0x5F, 0x81, 0x9D, 0x93, 0x70, 0x68, 0x85,
+  0xA3, 0xA7, 0xA5, 0xB8, 0xC7, 0xA2, 0x59, 0x35, 0x45, 0x58, 0x56, 0x5D,
+  0x7D, 0x9D, 0x96, 0x73, 0x65, 0x81, 0xA1, 0xA6, 0xA2, 0xB3, 0xC7, 0xAA,
+  0x61, 0x33, 0x3F, 0x55, 0x53, 0x56, 0x76, 0x98, 0x95, 0x73, 0x63, 0x7B,
+  0x9E, 0xA7, 0xA3, 0xB2, 0xC7, 0xB0, 0x69, 0x38, 0x40, 0x57, 0x5A, 0x5D,
+  0x78, 0x9C, 0x9F, 0x7F, 0x68, 0x7A, 0x9D, 0xAA, 0xA5, 0xAF, 0xC6, 0xBD,
+  0x7E, 0x3E, 0x35, 0x4E, 0x57, 0x53, 0x61, 0x83, 0x9C, 0x8D, 0x6A, 0x61,
+  0x80, 0xA0, 0xA6, 0xA3, 0xB4, 0xCB, 0xBA, 0x76, 0x3C, 0x3B, 0x54, 0x59,
+  0x55, 0x67, 0x8D, 0xA2, 0x8D, 0x6A, 0x68, 0x88, 0xA4, 0xA6, 0xA3, 0xB5,
+  0xC8, 0xAE, 0x66, 0x33, 0x3A, 0x53, 0x55, 0x53, 0x6A, 0x8F, 0x9E, 0x86,
+  0x66, 0x69, 0x8C, 0xA6, 0xA5, 0xA4, 0xB8, 0xC6, 0xA1, 0x5B, 0x35, 0x42,
+  0x57, 0x57, 0x58, 0x73, 0x96, 0x9E, 0x82, 0x68, 0x72, 0x94, 0xA8, 0xA5,
+  0xA6, 0xBD, 0xC5, 0x96, 0x51, 0x34, 0x46, 0x59, 0x58, 0x5B, 0x78, 0x9B,
+  0x9B, 0x78, 0x62, 0x73, 0x97, 0xA8, 0xA3, 0xA8, 0xC1, 0xC2, 0x8A, 0x45,
+  0x31, 0x48, 0x58, 0x55, 0x5D, 0x7E, 0x9E, 0x98, 0x76, 0x66, 0x7B, 0x9E,
+  0xAB, 0xA6, 0xAF, 0xC7, 0xC0, 0x83, 0x44, 0x3A, 0x50, 0x5B, 0x59, 0x65,
+  0x86, 0xA0, 0x93, 0x70, 0x64, 0x7E, 0x9D, 0xA3, 0x9F, 0xAC, 0xC2, 0xB2,
+  0x6E, 0x32, 0x32, 0x4E, 0x56, 0x54, 0x67, 0x8D, 0xA4, 0x91, 0x6E, 0x68,
+  0x87, 0xA3, 0xA6, 0xA3, 0xB3, 0xC8, 0xB0, 0x69, 0x34, 0x39, 0x53, 0x56,
+  0x53, 0x6A, 0x90, 0x9F, 0x87, 0x67, 0x69, 0x8C, 0xA5, 0xA4, 0xA3, 0xB7,
+  0xC6, 0xA6, 0x5F, 0x33, 0x3F, 0x57, 0x57, 0x57, 0x71, 0x95, 0xA0, 0x85,
+  0x67, 0x6D, 0x8F, 0xA7, 0xA8, 0xA5, 0xB4, 0xC9, 0xB5, 0x73, 0x3C, 0x39,
+  0x52, 0x5C, 0x58, 0x63, 0x84, 0xA0, 0x9A, 0x79, 0x65, 0x77, 0x9A, 0xA9,
+  0xA4, 0xA7, 0xBE, 0xC7, 0x9E, 0x56, 0x31, 0x3E, 0x54, 0x56, 0x55, 0x69,
+  0x8E, 0xA1, 0x8C, 0x6B, 0x65, 0x82, 0xA2, 0xA9, 0xA2, 0xAD, 0xC5, 0xBE,
+  0x85, 0x45, 0x34, 0x4D, 0x5C, 0x57, 0x5D, 0x7B, 0x9B, 0x9F, 0x81, 0x67,
+  0x70, 0x91, 0xA7, 0xA6, 0xA4, 0xB6, 0xC6, 0xAA, 0x66, 0x34, 0x36, 0x4D,
+  0x56, 0x50, 0x5C, 0x80, 0x9A, 0x91, 0x71, 0x62, 0x79, 0x9E, 0xAC, 0xA8,
+  0xAD, 0xC1, 0xC5, 0x97, 0x51, 0x31, 0x43, 0x56, 0x56, 0x57, 0x6E, 0x93,
+  0xA1, 0x88, 0x68, 0x68, 0x87, 0xA4, 0xA8, 0xA2, 0xB1, 0xC7, 0xB8, 0x7A,
+  0x3C, 0x32, 0x4B, 0x59, 0x54, 0x5D, 0x7C, 0x9B, 0x9B, 0x7B, 0x63, 0x73,
+  0x96, 0xA8, 0xA6, 0xA6, 0xBA, 0xC9, 0xA6, 0x60, 0x36, 0x3E, 0x55, 0x5A,
+  0x57, 0x68, 0x8C, 0xA0, 0x90, 0x70, 0x65, 0x7F, 0x9F, 0xA8, 0xA3, 0xAB,
+  0xC2, 0xC1, 0x8C, 0x48, 0x32, 0x46, 0x56, 0x53, 0x56, 0x71, 0x95, 0x9E,
+  0x82, 0x65, 0x6A, 0x8A, 0xA5, 0xA6, 0xA2, 0xB3, 0xC7, 0xB2, 0x71, 0x39,
+  0x35, 0x50, 0x5B, 0x56, 0x62, 0x85, 0xA1, 0x9B, 0x7A, 0x67, 0x7A, 0x9B,
+  0xAB, 0xA6, 0xAA, 0xC1, 0xC4, 0x8F, 0x4B, 0x35, 0x49, 0x58, 0x56, 0x5C,
+  0x7A, 0x9A, 0x96, 0x72, 0x5E, 0x72, 0x96, 0xA5, 0xA1, 0xA9, 0xC3, 0xC0,
+  0x86, 0x47, 0x3A, 0x50, 0x5B, 0x57, 0x62, 0x83, 0x9F, 0x95, 0x71, 0x63,
+  0x7D, 0x9F, 0xA9, 0xA4, 0xB0, 0xC7, 0xB9, 0x76, 0x39, 0x34, 0x4D, 0x57,
+  0x54, 0x63, 0x88, 0x9F, 0x8E, 0x6B, 0x66, 0x84, 0xA1, 0xA5, 0xA3, 0xB3,
+  0xC8, 0xB2, 0x6D, 0x39, 0x3C, 0x54, 0x59, 0x58, 0x6A, 0x90, 0xA2, 0x8B,
+  0x6B, 0x6C, 0x8C, 0xA6, 0xA7, 0xA5, 0xB8, 0xC9, 0xAB, 0x64, 0x37, 0x41,
+  0x58, 0x59, 0x58, 0x70, 0x95, 0xA0, 0x86, 0x68, 0x6E, 0x90, 0xA7, 0xA5,
+  0xA6, 0xBB, 0xC6, 0x9D, 0x55, 0x31, 0x41, 0x56, 0x55, 0x58, 0x74, 0x98,
+  0x9D, 0x7F, 0x65, 0x72, 0x97, 0xAA, 0xA5, 0xA9, 0xC1, 0xC6, 0x93, 0x4F,
+  0x37, 0x4B, 0x5C, 0x59, 0x5E, 0x7C, 0x9D, 0x9A, 0x78, 0x63, 0x76, 0x98,
+  0xA6, 0xA0, 0xA6, 0xBD, 0xBB, 0x81, 0x3C, 0x2B, 0x42, 0x51, 0x51, 0x5D,
+  0x7E, 0x9C, 0x97, 0x76, 0x67, 0x7F, 0x9E, 0xA7, 0xA3, 0xAD, 0xC4, 0xB9,
+  0x79, 0x3B, 0x34, 0x4C, 0x57, 0x54, 0x62, 0x86, 0x9F, 0x8F, 0x6C, 0x64,
+  0x81, 0xA0, 0xA7, 0xA3, 0xB2, 0xC8, 0xB4, 0x6E, 0x36, 0x39, 0x51, 0x57,
+  0x55, 0x6A, 0x8F, 0xA0, 0x89, 0x69, 0x6D, 0x90, 0xA7, 0xA7, 0xAA, 0xC1,
+  0xC5, 0x90, 0x4B, 0x38, 0x4E, 0x5B, 0x59, 0x67, 0x8B, 0xA2, 0x90, 0x6E,
+  0x6E, 0x8F, 0xA8, 0xA7, 0xA6, 0xBD, 0xC8, 0x98, 0x4E, 0x35, 0x4A, 0x58,
+  0x53, 0x5E, 0x82, 0x9E, 0x8F, 0x6C, 0x66, 0x86, 0xA3, 0xA7, 0xA6, 0xBA,
+  0xC8, 0x9E, 0x54, 0x32, 0x44, 0x56, 0x56, 0x5F, 0x80, 0x9F, 0x97, 0x74,
+  0x69, 0x85, 0xA5, 0xA9, 0xA6, 0xB7, 0xC9, 0xA9, 0x60, 0x36, 0x44, 0x58,
+  0x56, 0x59, 0x78, 0x98, 0x94, 0x71, 0x60, 0x7A, 0x9B, 0xA2, 0x9E, 0xAE,
+  0xC3, 0xAA, 0x63, 0x34, 0x40, 0x59, 0x5B, 0x5F, 0x7A, 0x9B, 0x9B, 0x7A,
+  0x64, 0x78, 0x9C, 0xA8, 0xA3, 0xB0, 0xC7, 0xB5, 0x6F, 0x38, 0x3C, 0x54,
+  0x56, 0x55, 0x70, 0x95, 0x9B, 0x7B, 0x63, 0x75, 0x99, 0xA7, 0xA3, 0xAC,
+  0xC4, 0xB7, 0x74, 0x3A, 0x3B, 0x52, 0x58, 0x58, 0x6F, 0x94, 0x9F, 0x82,
+  0x66, 0x73, 0x96, 0xA8, 0xA4, 0xAA, 0xC3, 0xBF, 0x82, 0x42, 0x3A, 0x52,
+  0x59, 0x56, 0x68, 0x8E, 0x9F, 0x86, 0x66, 0x6E, 0x93, 0xA7, 0xA3, 0xA7,
+  0xBF, 0xBE, 0x84, 0x40, 0x33, 0x4B, 0x55, 0x53, 0x64, 0x8A, 0x9F, 0x89,
+  0x67, 0x69, 0x8B, 0xA4, 0xA4, 0xA7, 0xBE, 0xC5, 0x92, 0x4C, 0x37, 0x4D,
+  0x5B, 0x58, 0x64, 0x8A, 0xA3, 0x91, 0x6F, 0x6F, 0x91, 0xA9, 0xA6, 0xAB,
+  0xC3, 0xBE, 0x7E, 0x40, 0x3C, 0x53, 0x57, 0x56, 0x6F, 0x94, 0x96, 0x74,
+  0x60, 0x78, 0x9A, 0xA5, 0xA4, 0xB6, 0xC6, 0xA2, 0x5B, 0x3B, 0x4C, 0x5A,
+  0x56, 0x63, 0x89, 0x9F, 0x89, 0x68, 0x6D, 0x91, 0xA7, 0xA4, 0xAB, 0xC4,
+  0xBB, 0x77, 0x3A, 0x3A, 0x53, 0x55, 0x56, 0x74, 0x99, 0x96, 0x72, 0x63,
+  0x7F, 0xA0, 0xA4, 0xA2, 0xB7, 0xC3, 0x95, 0x4D, 0x36, 0x4C, 0x59, 0x55,
+  0x66, 0x8E, 0x9F, 0x85, 0x67, 0x72, 0x96, 0xA7, 0xA4, 0xAF, 0xC6, 0xB3,
+  0x6E, 0x3B, 0x41, 0x57, 0x57, 0x5C, 0x7B, 0x9C, 0x94, 0x73, 0x69, 0x87,
+  0xA4, 0xA6, 0xA6, 0xBC, 0xC4, 0x90, 0x48, 0x34, 0x4C, 0x57, 0x54, 0x68,
+  0x90, 0x9D, 0x80, 0x65, 0x75, 0x9A, 0xA8, 0xA3, 0xB1, 0xC8, 0xB0, 0x66,
+  0x38, 0x45, 0x5A, 0x58, 0x60, 0x84, 0xA0, 0x93, 0x71, 0x6D, 0x8D, 0xA7,
+  0xA7, 0xA8, 0xC0, 0xC2, 0x87, 0x44, 0x39, 0x50, 0x56, 0x54, 0x6B, 0x8F,
+  0x96, 0x77, 0x5F, 0x71, 0x95, 0xA2, 0xA0, 0xB1, 0xC4, 0xA6, 0x5F, 0x39,
+  0x49, 0x5A, 0x56, 0x5F, 0x83, 0x9D, 0x8B, 0x69, 0x68, 0x8C, 0xA5, 0xA3,
+  0xA7, 0xC1, 0xBD, 0x7C, 0x3B, 0x37, 0x51, 0x55, 0x54, 0x6F, 0x96, 0x99,
+  0x76, 0x62, 0x7B, 0x9E, 0xA5, 0xA2, 0xB6, 0xC6, 0x9D, 0x53, 0x37, 0x4E,
+  0x5A, 0x56, 0x6C, 0x94, 0x9C, 0x7C, 0x67, 0x7F, 0xA1, 0xA7, 0xA6, 0xBD,
+  0xC5, 0x90, 0x4B, 0x3C, 0x54, 0x5A, 0x59, 0x75, 0x9A, 0x99, 0x77, 0x69,
+  0x86, 0xA5, 0xA6, 0xA7, 0xC0, 0xC1, 0x82, 0x40, 0x3C, 0x54, 0x55, 0x58,
+  0x7A, 0x9B, 0x91, 0x6E, 0x68, 0x8A, 0xA6, 0xA4, 0xA9, 0xC3, 0xB7, 0x70,
+  0x38, 0x40, 0x57, 0x57, 0x5D, 0x82, 0x9F, 0x8E, 0x6D, 0x70, 0x94, 0xA9,
+  0xA4, 0xAF, 0xC7, 0xB0, 0x67, 0x39, 0x46, 0x58, 0x55, 0x60, 0x86, 0x9C,
+  0x83, 0x63, 0x6F, 0x94, 0xA2, 0x9C, 0xAD, 0xC1, 0x9F, 0x56, 0x35, 0x49,
+  0x5A, 0x59, 0x6C, 0x94, 0x9F, 0x81, 0x68, 0x7B, 0x9E, 0xA6, 0xA3, 0xB8,
+  0xC6, 0x97, 0x4C, 0x35, 0x4C, 0x57, 0x54, 0x6C, 0x94, 0x99, 0x77, 0x64,
+  0x7E, 0xA1, 0xA6, 0xA5, 0xBD, 0xC2, 0x8A, 0x45, 0x39, 0x51, 0x56, 0x56,
+  0x75, 0x9A, 0x96, 0x74, 0x69, 0x87, 0xA5, 0xA5, 0xA9, 0xC2, 0xBC, 0x7B,
+  0x3E, 0x3E, 0x56, 0x57, 0x5B, 0x7D, 0x9C, 0x8F, 0x6E, 0x6C, 0x8F, 0xA7,
+  0xA4, 0xAB, 0xC4, 0xB5, 0x6E, 0x39, 0x42, 0x57, 0x54, 0x5D, 0x82, 0x9B,
+  0x87, 0x67, 0x6C, 0x92, 0xA6, 0xA0, 0xAE, 0xC6, 0xA9, 0x5D, 0x34, 0x45,
+  0x56, 0x53, 0x62, 0x8A, 0x9D, 0x84, 0x68, 0x77, 0x9D, 0xA9, 0xA6, 0xBA,
+  0xC8, 0x97, 0x4F, 0x3F, 0x56, 0x5B, 0x5C, 0x7B, 0x9B, 0x90, 0x6E, 0x6E,
+  0x91, 0xA6, 0xA2, 0xAF, 0xC4, 0xA1, 0x54, 0x32, 0x45, 0x51, 0x50, 0x6D,
+  0x95, 0x95, 0x75, 0x6C, 0x8C, 0xA8, 0xA7, 0xAC, 0xC5, 0xB5, 0x6B, 0x39,
+  0x46, 0x58, 0x54, 0x65, 0x8E, 0x9B, 0x7C, 0x66, 0x7D, 0xA1, 0xA6, 0xA6,
+  0xBF, 0xBF, 0x7D, 0x3C, 0x3C, 0x53, 0x52, 0x5C, 0x84, 0x9C, 0x85, 0x67,
+  0x73, 0x99, 0xA5, 0xA1, 0xB6, 0xC4, 0x91, 0x49, 0x3C, 0x54, 0x58, 0x5A,
+  0x7A, 0x9B, 0x8F, 0x6D, 0x6F, 0x94, 0xA8, 0xA4, 0xB3, 0xC7, 0xA3, 0x57,
+  0x39, 0x4F, 0x5A, 0x57, 0x70, 0x97, 0x97, 0x74, 0x69, 0x88, 0xA5, 0xA4,
+  0xAB, 0xC4, 0xB2, 0x67, 0x37, 0x45, 0x57, 0x54, 0x66, 0x8F, 0x9A, 0x7B,
+  0x66, 0x7F, 0xA2, 0xA6, 0xA8, 0xC1, 0xBC, 0x7A, 0x3F, 0x42, 0x58, 0x58,
+  0x63, 0x8A, 0xA0, 0x89, 0x6C, 0x79, 0x9E, 0xA8, 0xA5, 0xBA, 0xC5, 0x8F,
+  0x48, 0x3D, 0x53, 0x56, 0x58, 0x79, 0x97, 0x88, 0x66, 0x6A, 0x8E, 0xA0,
+  0x9B, 0xAE, 0xC4, 0x9D, 0x51, 0x38, 0x51, 0x5B, 0x59, 0x72, 0x97, 0x94,
+  0x71, 0x67, 0x89, 0xA5, 0xA2, 0xAA, 0xC3, 0xAF, 0x64, 0x36, 0x45, 0x56,
+  0x53, 0x65, 0x8E, 0x98, 0x78, 0x65, 0x7F, 0xA1, 0xA4, 0xA6, 0xC0, 0xBA,
+  0x75, 0x3B, 0x43, 0x56, 0x55, 0x67, 0x90, 0x99, 0x79, 0x69, 0x86, 0xA5,
+  0xA5, 0xAD, 0xC6, 0xAD, 0x60, 0x3B, 0x50, 0x5B, 0x58, 0x75, 0x9A, 0x92,
+  0x70, 0x70, 0x94, 0xA7, 0xA4, 0xB6, 0xC6, 0x97, 0x4E, 0x3E, 0x54, 0x57,
+  0x5C, 0x7F, 0x9B, 0x87, 0x68, 0x75, 0x9C, 0xA6, 0xA3, 0xBD, 0xC0, 0x7C,
+  0x3B, 0x40, 0x56, 0x53, 0x61, 0x8C, 0x9A, 0x7A, 0x67, 0x83, 0xA4, 0xA5,
+  0xAB, 0xC5, 0xB2, 0x68, 0x3D, 0x4D, 0x5A, 0x58, 0x70, 0x97, 0x95, 0x72,
+  0x6C, 0x8F, 0xA5, 0xA1, 0xB0, 0xC4, 0x9B, 0x4F, 0x38, 0x4E, 0x53, 0x55,
+  0x77, 0x95, 0x84, 0x64, 0x6F, 0x96, 0xA4, 0xA4, 0xBD, 0xC4, 0x89, 0x46,
+  0x42, 0x57, 0x57, 0x61, 0x88, 0x9C, 0x7F, 0x65, 0x7D, 0xA1, 0xA3, 0xA7,
+  0xC3, 0xB7, 0x6C, 0x39, 0x46, 0x56, 0x53, 0x6A, 0x93, 0x96, 0x74, 0x68,
+  0x89, 0xA4, 0xA3, 0xAF, 0xC5, 0xA5, 0x58, 0x39, 0x4F, 0x58, 0x57, 0x77,
+  0x9B, 0x8F, 0x6C, 0x71, 0x97, 0xA6, 0xA2, 0xB7, 0xC3, 0x8C, 0x47, 0x40,
+  0x56, 0x56, 0x5E, 0x84, 0x9B, 0x83, 0x68, 0x7A, 0x9E, 0xA5, 0xA5, 0xBF,
+  0xBB, 0x75, 0x3B, 0x44, 0x57, 0x52, 0x63, 0x8E, 0x97, 0x74, 0x64, 0x85,
+  0xA3, 0xA1, 0xAB, 0xC5, 0xA8, 0x5A, 0x36, 0x4B, 0x56, 0x54, 0x72, 0x98,
+  0x91, 0x70, 0x6B, 0x8A, 0xA3, 0xA3, 0xA7, 0xBE, 0xBF, 0x86, 0x48, 0x3F,
+  0x55, 0x5B, 0x59, 0x70, 0x93, 0x98, 0x7B, 0x67, 0x78, 0x99, 0xA4, 0x9F,
+  0xAE, 0xC0, 0xA0, 0x58, 0x31, 0x41, 0x54, 0x54, 0x5F, 0x83, 0x9D, 0x8F,
+  0x70, 0x70, 0x8F, 0xA5, 0xA3, 0xA7, 0xBF, 0xBA, 0x7B, 0x3F, 0x3C, 0x53,
+  0x57, 0x57, 0x71, 0x95, 0x97, 0x76, 0x63, 0x7B, 0x9D, 0xA3, 0xA1, 0xB4,
+  0xC3, 0x9A, 0x53, 0x35, 0x48, 0x57, 0x53, 0x61, 0x87, 0x9C, 0x87, 0x69,
+  0x6F, 0x92, 0xA5, 0xA2, 0xAA, 0xC2, 0xB6, 0x76, 0x40, 0x42, 0x57, 0x59,
+  0x5C, 0x79, 0x99, 0x96, 0x76, 0x68, 0x83, 0xA2, 0xA5, 0xA4, 0xB8, 0xC3,
+  0x98, 0x53, 0x3B, 0x4F, 0x5B, 0x58, 0x68, 0x8D, 0x9D, 0x83, 0x66, 0x72,
+  0x96, 0xA5, 0xA1, 0xAC, 0xC4, 0xB2, 0x6C, 0x39, 0x42, 0x57, 0x57, 0x5C,
+  0x7D, 0x9B, 0x93, 0x73, 0x6B, 0x88, 0xA4, 0xA6, 0xA7, 0xBD, 0xC4, 0x91,
+  0x4F, 0x3E, 0x53, 0x5C, 0x5A, 0x6E, 0x91, 0x9C, 0x80, 0x68, 0x75, 0x97,
+  0xA4, 0x9F, 0xAB, 0xBF, 0xA7, 0x5F, 0x31, 0x3D, 0x52, 0x53, 0x5C, 0x7D,
+  0x9A, 0x91, 0x72, 0x6D, 0x8B, 0xA4, 0xA2, 0xA5, 0xBD, 0xBD, 0x84, 0x43,
+  0x3A, 0x51, 0x57, 0x55, 0x6D, 0x92, 0x9A, 0x7B, 0x65, 0x79, 0x9B, 0xA3,
+  0xA0, 0xB2, 0xC3, 0xA2, 0x5B, 0x34, 0x43, 0x57, 0x56, 0x5C, 0x7B, 0x9B,
+  0x97, 0x76, 0x67, 0x7F, 0x9E, 0xA6, 0xA3, 0xB3, 0xC7, 0xAE, 0x6B, 0x3E,
+  0x46, 0x5A, 0x5B, 0x5E, 0x79, 0x9B, 0x9C, 0x7D, 0x6B, 0x7E, 0x9E, 0xA8,
+  0xA3, 0xB0, 0xC5, 0xB2, 0x6E, 0x3D, 0x42, 0x58, 0x5A, 0x59, 0x71, 0x94,
+  0x9B, 0x7C, 0x65, 0x75, 0x97, 0xA6, 0xA3, 0xAC, 0xC3, 0xB7, 0x77, 0x3D,
+  0x3B, 0x52, 0x57, 0x57, 0x6D, 0x93, 0x9F, 0x84, 0x6A, 0x77, 0x98, 0xA9,
+  0xA4, 0xAA, 0xC2, 0xBE, 0x82, 0x45, 0x3E, 0x55, 0x5B, 0x58, 0x69, 0x8D,
+  0x9C, 0x83, 0x67, 0x6E, 0x8E, 0xA1, 0xA0, 0xA4, 0xBA, 0xBA, 0x82, 0x42,
+  0x37, 0x4D, 0x58, 0x59, 0x6A, 0x8F, 0xA3, 0x8E, 0x6C, 0x6F, 0x90, 0xA5,
+  0xA4, 0xA6, 0xBC, 0xC3, 0x93, 0x4E, 0x37, 0x4C, 0x59, 0x55, 0x61, 0x84,
+  0x9C, 0x8C, 0x6C, 0x69, 0x89, 0xA3, 0xA4, 0xA4, 0xB8, 0xC2, 0x97, 0x52,
+  0x36, 0x49, 0x59, 0x58, 0x61, 0x82, 0x9E, 0x92, 0x71, 0x69, 0x86, 0xA2,
+  0xA6, 0xA3, 0xB5, 0xC5, 0xA2, 0x5E, 0x3B, 0x49, 0x5B, 0x58, 0x5D, 0x7D,
+  0x9B, 0x93, 0x72, 0x68, 0x81, 0x9E, 0xA4, 0xA2, 0xB2, 0xC3, 0xA5, 0x60,
+  0x37, 0x41, 0x55, 0x55, 0x5A, 0x77, 0x99, 0x96, 0x75, 0x63, 0x7A, 0x9B,
+  0xA5, 0xA1, 0xAF, 0xC4, 0xAF, 0x6B, 0x3A, 0x3F, 0x57, 0x5B, 0x59, 0x6F,
+  0x93, 0xA1, 0x8A, 0x6D, 0x71, 0x90, 0xA8, 0xA7, 0xA4, 0xB8, 0xC6, 0xA1,
+  0x5D, 0x38, 0x45, 0x58, 0x58, 0x59, 0x71, 0x92, 0x9A, 0x7E, 0x62, 0x6A,
+  0x8C, 0xA2, 0xA1, 0xA4, 0xBA, 0xC3, 0x99, 0x58, 0x3C, 0x4C, 0x5C, 0x59,
+  0x5E, 0x7B, 0x99, 0x9A, 0x7C, 0x65, 0x74, 0x96, 0xA7, 0xA3, 0xA8, 0xBF,
+  0xC1, 0x8C, 0x49, 0x35, 0x4A, 0x58, 0x55, 0x5E, 0x7E, 0x9B, 0x96, 0x74,
+  0x64, 0x7A, 0x9A, 0xA4, 0xA1, 0xAA, 0xC0, 0xBB, 0x83, 0x45, 0x3A, 0x51,
+  0x5C, 0x58, 0x63, 0x85, 0xA0, 0x94, 0x73, 0x68, 0x82, 0xA0, 0xA7, 0xA3,
+  0xAE, 0xC3, 0xB6, 0x79, 0x41, 0x3E, 0x55, 0x5B, 0x58, 0x68, 0x8B, 0x9E,
+  0x8D, 0x6E, 0x69, 0x86, 0xA2, 0xA6, 0xA2, 0xB2, 0xC4, 0xAC, 0x6A, 0x39,
+  0x3D, 0x54, 0x58, 0x56, 0x6A, 0x8F, 0x9E, 0x87, 0x69, 0x6B, 0x8C, 0xA6,
+  0xA6, 0xA3, 0xB7, 0xC7, 0xA5, 0x61, 0x3A, 0x46, 0x5A, 0x5C, 0x5C, 0x72,
+  0x95, 0x9E, 0x83, 0x67, 0x6F, 0x8E, 0xA3, 0xA1, 0xA1, 0xB5, 0xBE, 0x95,
+  0x4F, 0x2E, 0x3D, 0x50, 0x51, 0x57, 0x74, 0x95, 0x9A, 0x7E, 0x6A, 0x78,
+  0x97, 0xA5, 0xA2, 0xA7, 0xBD, 0xC0, 0x8F, 0x4C, 0x34, 0x47, 0x57, 0x55,
+  0x5D, 0x7C, 0x9B, 0x98, 0x76, 0x64, 0x79, 0x9A, 0xA5, 0xA1, 0xA7, 0xBC,
+  0xC1, 0x93, 0x4F, 0x33, 0x44, 0x57, 0x58, 0x5A, 0x70, 0x93, 0xA0, 0x89,
+  0x6B, 0x6B, 0x88, 0xA4, 0xA8, 0xA2, 0xB1, 0xC6, 0xB7, 0x7C, 0x44, 0x3C,
+  0x53, 0x5F, 0x5A, 0x62, 0x80, 0x9C, 0x9B, 0x7C, 0x68, 0x76, 0x96, 0xA7,
+  0xA6, 0xA6, 0xB8, 0xC6, 0xA4, 0x60, 0x36, 0x3E, 0x54, 0x59, 0x56, 0x67,
+  0x8B, 0x9F, 0x8F, 0x6F, 0x65, 0x7E, 0x9E, 0xA6, 0xA2, 0xAA, 0xC0, 0xBF,
+  0x8C, 0x4C, 0x37, 0x4A, 0x5B, 0x5B, 0x5E, 0x76, 0x98, 0xA0, 0x85, 0x6A,
+  0x6F, 0x8E, 0xA6, 0xA6, 0xA2, 0xB2, 0xC4, 0xAE, 0x70, 0x3C, 0x39, 0x50,
+  0x57, 0x52, 0x5E, 0x7D, 0x97, 0x90, 0x71, 0x61, 0x75, 0x96, 0xA6, 0xA5,
+  0xA9, 0xBF, 0xC7, 0x9D, 0x59, 0x38, 0x44, 0x57, 0x59, 0x58, 0x6C, 0x8E,
+  0x9F, 0x8C, 0x6C, 0x67, 0x83, 0xA0, 0xA6, 0xA2, 0xAC, 0xC2, 0xBB, 0x82,
+  0x43, 0x34, 0x4A, 0x58, 0x55, 0x5B, 0x77, 0x98, 0x9B, 0x7F, 0x67, 0x70,
+  0x8F, 0xA6, 0xA5, 0xA3, 0xB5, 0xC5, 0xAA, 0x6A, 0x3C, 0x3E, 0x56, 0x5B,
+  0x58, 0x67, 0x87, 0x9E, 0x93, 0x73, 0x65, 0x7C, 0x9B, 0xA6, 0xA2, 0xA7,
+  0xBD, 0xC1, 0x93, 0x51, 0x35, 0x45, 0x58, 0x58, 0x57, 0x6D, 0x91, 0x9D,
+  0x85, 0x68, 0x68, 0x86, 0xA2, 0xA5, 0xA0, 0xAE, 0xC3, 0xB6, 0x7B, 0x40,
+  0x35, 0x4B, 0x5A, 0x58, 0x5D, 0x74, 0x95, 0xA2, 0x8D, 0x70, 0x6C, 0x86,
+  0xA3, 0xAA, 0xA4, 0xAB, 0xC0, 0xC5, 0x9C, 0x5B, 0x36, 0x41, 0x57, 0x5A,
+  0x57, 0x65, 0x83, 0x9B, 0x94, 0x75, 0x5F, 0x6C, 0x8D, 0xA2, 0xA2, 0xA1,
+  0xB1, 0xC5, 0xB6, 0x7C, 0x45, 0x3A, 0x4E, 0x5C, 0x5A, 0x5B, 0x73, 0x94,
+  0x9F, 0x87, 0x69, 0x66, 0x81, 0x9F, 0xA8, 0xA1, 0xA7, 0xBE, 0xC2, 0x96,
+  0x53, 0x31, 0x3D, 0x54, 0x57, 0x54, 0x62, 0x83, 0x9D, 0x94, 0x75, 0x63,
+  0x72, 0x93, 0xA6, 0xA3, 0xA2, 0xB4, 0xC4, 0xB1, 0x77, 0x41, 0x38, 0x4F,
+  0x5C, 0x58, 0x5C, 0x76, 0x97, 0xA0, 0x88, 0x6C, 0x6A, 0x85, 0xA2, 0xA8,
+  0xA2, 0xAB, 0xC0, 0xC1, 0x96, 0x57, 0x36, 0x44, 0x59, 0x5C, 0x58, 0x65,
+  0x86, 0xA0, 0x96, 0x75, 0x64, 0x74, 0x95, 0xA7, 0xA4, 0xA4, 0xB6, 0xC6,
+  0xB1, 0x73, 0x3D, 0x37, 0x4D, 0x5A, 0x59, 0x5F, 0x79, 0x9A, 0xA3, 0x89,
+  0x6C, 0x6D, 0x89, 0xA4, 0xA9, 0xA3, 0xAC, 0xC1, 0xC1, 0x93, 0x52, 0x35,
+  0x44, 0x56, 0x57, 0x56, 0x65, 0x84, 0x9B, 0x90, 0x6E, 0x5C, 0x6E, 0x8F,
+  0xA2, 0xA0, 0xA0, 0xB3, 0xC5, 0xAF, 0x72, 0x3E, 0x39, 0x4F, 0x5B, 0x57,
+  0x5B, 0x75, 0x97, 0x9D, 0x82, 0x65, 0x67, 0x85, 0xA1, 0xA5, 0x9F, 0xA9,
+  0xBF, 0xBF, 0x93, 0x53, 0x31, 0x3B, 0x52, 0x59, 0x55, 0x5D, 0x79, 0x98,
+  0x9E, 0x85, 0x69, 0x68, 0x82, 0x9F, 0xA9, 0xA3, 0xA6, 0xBA, 0xC7, 0xAD,
+  0x6F, 0x3D, 0x39, 0x51, 0x5E, 0x5B, 0x5C, 0x71, 0x91, 0xA3, 0x94, 0x75,
+  0x66, 0x76, 0x95, 0xA9, 0xA7, 0xA4, 0xB1, 0xC5, 0xBE, 0x8C, 0x4D, 0x33,
+  0x43, 0x57, 0x59, 0x56, 0x62, 0x80, 0x9E, 0x9D, 0x7F, 0x65, 0x69, 0x85,
+  0xA2, 0xA9, 0xA1, 0xA7, 0xBD, 0xC5, 0xA4, 0x65, 0x38, 0x3A, 0x51, 0x5B,
+  0x59, 0x5E, 0x75, 0x96, 0xA4, 0x8F, 0x71, 0x67, 0x7B, 0x9A, 0xA9, 0xA4,
+  0xA2, 0xB3, 0xC4, 0xB5, 0x7E, 0x44, 0x33, 0x45, 0x55, 0x56, 0x54, 0x61,
+  0x80, 0x99, 0x93, 0x77, 0x64, 0x6E, 0x8D, 0xA7, 0xAA, 0xA5, 0xAD, 0xC1,
+  0xC2, 0x99, 0x59, 0x34, 0x3D, 0x54, 0x5A, 0x56, 0x5E, 0x79, 0x97, 0x9F,
+  0x87, 0x6A, 0x67, 0x80, 0x9E, 0xA9, 0xA3, 0xA4, 0xB8, 0xC5, 0xAD, 0x70,
+  0x3B, 0x33, 0x4B, 0x59, 0x56, 0x59, 0x6D, 0x8D, 0xA1, 0x95, 0x75, 0x65,
+  0x75, 0x94, 0xA8, 0xA7, 0xA2, 0xAF, 0xC3, 0xBC, 0x8B, 0x4E, 0x33, 0x42,
+  0x58, 0x5B, 0x58, 0x63, 0x80, 0x9D, 0x9E, 0x82, 0x67, 0x69, 0x85, 0xA1,
+  0xA8, 0xA1, 0xA5, 0xBB, 0xC4, 0xA4, 0x63, 0x34, 0x34, 0x4B, 0x57, 0x54,
+  0x58, 0x71, 0x92, 0x9F, 0x8B, 0x6C, 0x66, 0x7F, 0x9E, 0xA8, 0xA2, 0xA8,
+  0xBE, 0xC5, 0xA0, 0x61, 0x3A, 0x43, 0x5A, 0x5F, 0x5B, 0x67, 0x86, 0xA1,
+  0x9C, 0x7D, 0x68, 0x73, 0x92, 0xA7, 0xA5, 0xA1, 0xB1, 0xC3, 0xB3, 0x79,
+  0x3F, 0x31, 0x45, 0x53, 0x52, 0x57, 0x71, 0x93, 0xA0, 0x8C, 0x70, 0x6D,
+  0x86, 0xA1, 0xA9, 0xA3, 0xA9, 0xBE, 0xC3, 0x9B, 0x59, 0x33, 0x3E, 0x54,
+  0x59, 0x56, 0x63, 0x83, 0x9E, 0x98, 0x77, 0x63, 0x70, 0x91, 0xA6, 0xA4,
+  0xA1, 0xB2, 0xC3, 0xB2, 0x77, 0x3E, 0x33, 0x4A, 0x59, 0x57, 0x5A, 0x72,
+  0x94, 0x9F, 0x87, 0x6A, 0x68, 0x83, 0xA0, 0xA8, 0xA1, 0xA8, 0xBE, 0xC1,
+  0x98, 0x59, 0x38, 0x43, 0x58, 0x5C, 0x59, 0x67, 0x87, 0xA0, 0x98, 0x78,
+  0x67, 0x76, 0x95, 0xA8, 0xA5, 0xA3, 0xB4, 0xC4, 0xB1, 0x74, 0x3C, 0x34,
+  0x4C, 0x59, 0x56, 0x5A, 0x75, 0x96, 0xA0, 0x88, 0x6A, 0x68, 0x85, 0xA2,
+  0xA8, 0xA2, 0xAB, 0xC1, 0xC3, 0x99, 0x59, 0x38, 0x46, 0x5B, 0x5D, 0x5B,
+  0x6A, 0x8A, 0xA2, 0x98, 0x78, 0x67, 0x76, 0x95, 0xA6, 0xA2, 0xA0, 0xB1,
+  0xC1, 0xAB, 0x6E, 0x38, 0x31, 0x47, 0x52, 0x50, 0x59, 0x74, 0x94, 0x9D,
+  0x87, 0x6D, 0x6D, 0x87, 0xA1, 0xA6, 0xA1, 0xA9, 0xBF, 0xC0, 0x91, 0x4F,
+  0x30, 0x3F, 0x55, 0x57, 0x55, 0x67, 0x89, 0x9E, 0x8E, 0x6E, 0x64, 0x7E,
+  0x9D, 0xA6, 0xA1, 0xA9, 0xBF, 0xBE, 0x8A, 0x4A, 0x35, 0x48, 0x59, 0x58,
+  0x5B, 0x74, 0x97, 0x9F, 0x84, 0x69, 0x6F, 0x8E, 0xA5, 0xA6, 0xA3, 0xB3,
+  0xC6, 0xB1, 0x73, 0x40, 0x3E, 0x55, 0x5E, 0x5A, 0x65, 0x84, 0x9F, 0x98,
+  0x79, 0x67, 0x79, 0x9A, 0xA8, 0xA4, 0xA7, 0xBC, 0xC4, 0x9A, 0x57, 0x35,
+  0x41, 0x56, 0x58, 0x57, 0x6C, 0x8F, 0x9F, 0x8B, 0x6B, 0x67, 0x83, 0xA0,
+  0xA6, 0xA2, 0xAC, 0xC2, 0xBB, 0x83, 0x46, 0x38, 0x4F, 0x5D, 0x5A, 0x5F,
+  0x7B, 0x9B, 0x9E, 0x81, 0x68, 0x72, 0x91, 0xA6, 0xA3, 0xA1, 0xB4, 0xC3,
+  0xA7, 0x67, 0x38, 0x39, 0x51, 0x57, 0x52, 0x5F, 0x80, 0x98, 0x8E, 0x70,
+  0x64, 0x7B, 0x9C, 0xAA, 0xA7, 0xAC, 0xC0, 0xC3, 0x94, 0x52, 0x36, 0x45,
+  0x58, 0x58, 0x58, 0x70, 0x92, 0x9E, 0x87, 0x6A, 0x6A, 0x88, 0xA3, 0xA6,
+  0xA2, 0xAF, 0xC4, 0xB6, 0x78, 0x3D, 0x36, 0x4C, 0x57, 0x55, 0x5D, 0x7B,
+  0x9B, 0x99, 0x7A, 0x65, 0x74, 0x94, 0xA7, 0xA3, 0xA4, 0xB9, 0xC5, 0xA2,
+  0x61, 0x39, 0x41, 0x58, 0x5B, 0x58, 0x6A, 0x8B, 0x9E, 0x8F, 0x6F, 0x67,
+  0x81, 0x9E, 0xA7, 0xA2, 0xA9, 0xBF, 0xBE, 0x8A, 0x4A, 0x35, 0x48, 0x58,
+  0x55, 0x58, 0x72, 0x95, 0x9C, 0x81, 0x66, 0x6D, 0x8E, 0xA4, 0xA3, 0xA4,
+  0xB8, 0xC4, 0x9F, 0x59, 0x35, 0x44, 0x59, 0x59, 0x5C, 0x76, 0x9A, 0xA0,
+  0x82, 0x6A, 0x78, 0x98, 0xA8, 0xA5, 0xA8, 0xBE, 0xC5, 0x97, 0x54, 0x39,
+  0x4B, 0x5B, 0x57, 0x5C, 0x7A, 0x98, 0x96, 0x77, 0x63, 0x73, 0x94, 0xA2,
+  0x9E, 0xA6, 0xBE, 0xBC, 0x89, 0x4D, 0x3D, 0x53, 0x5E, 0x58, 0x61, 0x81,
+  0x9C, 0x95, 0x74, 0x65, 0x7B, 0x9C, 0xA6, 0xA1, 0xAB, 0xC2, 0xB7, 0x79,
+  0x3E, 0x36, 0x4E, 0x57, 0x54, 0x61, 0x83, 0x9C, 0x8D, 0x6C, 0x63, 0x7F,
+  0x9E, 0xA4, 0x9E, 0xAD, 0xC3, 0xB0, 0x6F, 0x3B, 0x3D, 0x53, 0x5A, 0x59,
+  0x69, 0x8B, 0x9E, 0x8C, 0x6C, 0x6A, 0x87, 0xA3, 0xA6, 0xA3, 0xB4, 0xC6,
+  0xAA, 0x67, 0x3B, 0x42, 0x57, 0x5B, 0x5A, 0x70, 0x93, 0xA0, 0x87, 0x6A,
+  0x6E, 0x8D, 0xA4, 0xA4, 0xA4, 0xB8, 0xC5, 0xA1, 0x5B, 0x35, 0x43, 0x57,
+  0x57, 0x59, 0x74, 0x96, 0x9E, 0x81, 0x67, 0x72, 0x94, 0xA7, 0xA5, 0xA7,
+  0xBD, 0xC6, 0x9C, 0x57, 0x3B, 0x4D, 0x5E, 0x5A, 0x5F, 0x7C, 0x9B, 0x9B,
+  0x7D, 0x67, 0x77, 0x97, 0xA5, 0xA0, 0xA5, 0xBB, 0xBB, 0x89, 0x47, 0x32,
+  0x45, 0x51, 0x4E, 0x58, 0x7B, 0x99, 0x93, 0x76, 0x68, 0x7E, 0x9E, 0xA8,
+  0xA1, 0xAA, 0xC1, 0xB7, 0x7C, 0x40, 0x37, 0x4D, 0x58, 0x55, 0x62, 0x86,
+  0x9D, 0x8B, 0x6B, 0x6B, 0x8B, 0xA3, 0xA3, 0xA3, 0xB9, 0xC1, 0x90, 0x4B,
+  0x34, 0x49, 0x58, 0x55, 0x60, 0x83, 0x9D, 0x8F, 0x6D, 0x69, 0x88, 0xA2,
+  0xA5, 0xA5, 0xB9, 0xC5, 0x9E, 0x59, 0x3A, 0x4B, 0x5A, 0x5A, 0x62, 0x82,
+  0x9E, 0x96, 0x74, 0x6B, 0x86, 0xA3, 0xA7, 0xA4, 0xB6, 0xC7, 0xA5, 0x5E,
+  0x39, 0x48, 0x5A, 0x58, 0x5B, 0x79, 0x99, 0x95, 0x73, 0x65, 0x7E, 0x9D,
+  0xA5, 0xA3, 0xB2, 0xC5, 0xAA, 0x64, 0x37, 0x40, 0x55, 0x56, 0x5A, 0x77,
+  0x9A, 0x9A, 0x7A, 0x68, 0x7E, 0x9E, 0xA8, 0xA4, 0xB0, 0xC5, 0xB4, 0x72,
+  0x3F, 0x43, 0x58, 0x59, 0x59, 0x72, 0x93, 0x97, 0x79, 0x64, 0x74, 0x95,
+  0xA2, 0x9E, 0xA7, 0xBD, 0xAF, 0x6F, 0x3A, 0x3C, 0x53, 0x59, 0x5C, 0x74,
+  0x98, 0xA1, 0x83, 0x67, 0x74, 0x96, 0xA6, 0xA2, 0xAA, 0xC1, 0xBC, 0x80,
+  0x42, 0x3B, 0x52, 0x59, 0x56, 0x69, 0x8E, 0x9C, 0x83, 0x66, 0x6F, 0x91,
+  0xA5, 0xA2, 0xA6, 0xBD, 0xBD, 0x85, 0x44, 0x38, 0x4F, 0x59, 0x58, 0x68,
+  0x8B, 0x9F, 0x8A, 0x6A, 0x6D, 0x8E, 0xA5, 0xA3, 0xA5, 0xBC, 0xC1, 0x90,
+  0x4E, 0x3C, 0x50, 0x5B, 0x58, 0x64, 0x86, 0x9E, 0x8D, 0x6C, 0x6B, 0x8A,
+  0xA2, 0xA3, 0xA3, 0xB7, 0xC0, 0x94, 0x4F, 0x35, 0x48, 0x57, 0x54, 0x5E,
+  0x82, 0x9C, 0x8A, 0x69, 0x6B, 0x8D, 0xA4, 0xA3, 0xA7, 0xBF, 0xBB, 0x7E,
+  0x41, 0x3D, 0x55, 0x5B, 0x5A, 0x74, 0x9A, 0x9C, 0x7B, 0x6A, 0x82, 0xA2,
+  0xA8, 0xA5, 0xB6, 0xC6, 0xA0, 0x59, 0x3B, 0x4E, 0x5B, 0x57, 0x65, 0x89,
+  0x9C, 0x86, 0x67, 0x6D, 0x8E, 0xA0, 0x9D, 0xA5, 0xBD, 0xB3, 0x74, 0x3E,
+  0x42, 0x5A, 0x5D, 0x60, 0x7B, 0x99, 0x96, 0x77, 0x68, 0x82, 0xA0, 0xA5,
+  0xA3, 0xB8, 0xC4, 0x96, 0x4F, 0x37, 0x4C, 0x58, 0x55, 0x65, 0x8B, 0x9C,
+  0x83, 0x66, 0x71, 0x95, 0xA5, 0x9F, 0xAA, 0xC2, 0xB0, 0x6B, 0x39, 0x42,
+  0x57, 0x56, 0x5B, 0x7B, 0x9A, 0x91, 0x71, 0x6A, 0x87, 0xA2, 0xA3, 0xA5,
+  0xBB, 0xC1, 0x8D, 0x4C, 0x3D, 0x53, 0x5A, 0x59, 0x6D, 0x91, 0x9B, 0x81,
+  0x69, 0x78, 0x99, 0xA6, 0xA4, 0xB1, 0xC4, 0xAB, 0x67, 0x3B, 0x45, 0x58,
+  0x56, 0x5D, 0x7F, 0x9B, 0x8F, 0x6E, 0x69, 0x89, 0xA4, 0xA4, 0xA6, 0xBE,
+  0xBF, 0x85, 0x45, 0x3C, 0x54, 0x5C, 0x5A, 0x70, 0x96, 0x9E, 0x7F, 0x69,
+  0x7D, 0x9F, 0xA7, 0xA4, 0xB4, 0xC6, 0xA5, 0x5E, 0x3B, 0x4A, 0x5A, 0x56,
+  0x60, 0x83, 0x9A, 0x88, 0x67, 0x68, 0x8A, 0x9F, 0x9C, 0xA2, 0xBA, 0xB5,
+  0x7A, 0x40, 0x3C, 0x55, 0x5B, 0x5C, 0x76, 0x96, 0x96, 0x78, 0x65, 0x7B,
+  0x9D, 0xA3, 0xA1, 0xB6, 0xC0, 0x8F, 0x4A, 0x39, 0x4F, 0x56, 0x55, 0x70,
+  0x95, 0x96, 0x75, 0x66, 0x81, 0xA0, 0xA2, 0xA3, 0xBC, 0xBD, 0x83, 0x43,
+  0x3D, 0x55, 0x59, 0x5A, 0x77, 0x98, 0x92, 0x71, 0x6B, 0x8B, 0xA5, 0xA4,
+  0xA9, 0xC1, 0xB9, 0x7A, 0x43, 0x45, 0x5B, 0x5B, 0x60, 0x82, 0x9E, 0x8F,
+  0x6F, 0x70, 0x92, 0xA7, 0xA3, 0xAC, 0xC4, 0xB0, 0x6A, 0x3C, 0x48, 0x5A,
+  0x56, 0x60, 0x86, 0x9C, 0x86, 0x69, 0x72, 0x96, 0xA5, 0xA1, 0xAF, 0xC4,
+  0xA6, 0x5C, 0x37, 0x4A, 0x59, 0x55, 0x66, 0x8E, 0x9C, 0x81, 0x69, 0x79,
+  0x9C, 0xA6, 0xA2, 0xB6, 0xC5, 0x9A, 0x53, 0x3D, 0x52, 0x5B, 0x58, 0x6D,
+  0x92, 0x98, 0x79, 0x66, 0x7D, 0x9D, 0xA0, 0x9F, 0xB6, 0xBC, 0x87, 0x43,
+  0x34, 0x4D, 0x56, 0x57, 0x72, 0x97, 0x98, 0x78, 0x6D, 0x89, 0xA4, 0xA3,
+  0xA6, 0xBE, 0xBB, 0x7E, 0x42, 0x3F, 0x55, 0x57, 0x5A, 0x7B, 0x9C, 0x91,
+  0x6F, 0x6B, 0x8C, 0xA4, 0xA1, 0xA9, 0xC2, 0xB4, 0x70, 0x3A, 0x40, 0x56,
+  0x56, 0x5D, 0x80, 0x9A, 0x89, 0x6B, 0x6F, 0x92, 0xA5, 0xA2, 0xAD, 0xC3,
+  0xAD, 0x67, 0x3D, 0x4A, 0x5B, 0x57, 0x64, 0x8A, 0x9D, 0x85, 0x6A, 0x75,
+  0x97, 0xA5, 0xA1, 0xB1, 0xC3, 0xA0, 0x59, 0x3A, 0x4D, 0x5A, 0x56, 0x68,
+  0x8E, 0x9A, 0x7C, 0x63, 0x70, 0x90, 0xA0, 0x9E, 0xA3, 0xB9, 0xBB, 0x88,
+  0x48, 0x34, 0x49, 0x57, 0x55, 0x5C, 0x7A, 0x98, 0x94, 0x75, 0x66, 0x7A,
+  0x98, 0xA4, 0xA2, 0xAA, 0xC0, 0xBA, 0x83, 0x48, 0x3D, 0x51, 0x5C, 0x59,
+  0x64, 0x84, 0x9C, 0x90, 0x71, 0x66, 0x7E, 0x9B, 0xA1, 0x9C, 0xA9, 0xBD,
+  0xAF, 0x72, 0x3B, 0x38, 0x51, 0x59, 0x56, 0x66, 0x8A, 0xA0, 0x91, 0x71,
+  0x6B, 0x86, 0xA0, 0xA4, 0xA1, 0xB0, 0xC3, 0xAD, 0x6D, 0x3D, 0x40, 0x56,
+  0x5A, 0x57, 0x6B, 0x8E, 0x9D, 0x88, 0x6B, 0x6B, 0x89, 0xA2, 0xA2, 0xA1,
+  0xB3, 0xC0, 0xA1, 0x61, 0x3A, 0x42, 0x56, 0x58, 0x58, 0x6F, 0x91, 0x9A,
+  0x81, 0x67, 0x6F, 0x8F, 0xA3, 0xA1, 0xA3, 0xB7, 0xBF, 0x97, 0x58, 0x3B,
+  0x49, 0x5A, 0x5A, 0x5D, 0x76, 0x96, 0x99, 0x7C, 0x67, 0x74, 0x95, 0xA5,
+  0xA2, 0xA5, 0xBB, 0xBF, 0x8F, 0x4F, 0x39, 0x4B, 0x5A, 0x58, 0x5E, 0x7B,
+  0x9A, 0x98, 0x79, 0x66, 0x79, 0x99, 0xA6, 0xA2, 0xAB, 0xC1, 0xBC, 0x86,
+  0x4A, 0x3D, 0x52, 0x5D, 0x5B, 0x67, 0x85, 0x9E, 0x95, 0x76, 0x6B, 0x82,
+  0x9E, 0xA6, 0xA3, 0xAD, 0xC1, 0xB5, 0x7A, 0x43, 0x3D, 0x52, 0x59, 0x55,
+  0x63, 0x84, 0x9A, 0x8A, 0x69, 0x64, 0x80, 0x9C, 0xA1, 0x9F, 0xAF, 0xC3,
+  0xB1, 0x73, 0x41, 0x41, 0x56, 0x5B, 0x57, 0x67, 0x89, 0x9D, 0x8F, 0x6F,
+  0x66, 0x7D, 0x9B, 0xA4, 0xA1, 0xA8, 0xBD, 0xBD, 0x8D, 0x4D, 0x37, 0x48,
+  0x58, 0x57, 0x5A, 0x72, 0x93, 0x9C, 0x84, 0x6A, 0x6D, 0x8A, 0xA3, 0xA5,
+  0xA1, 0xB0, 0xC3, 0xB0, 0x75, 0x43, 0x3E, 0x55, 0x5E, 0x5A, 0x64, 0x82,
+  0x9C, 0x98, 0x79, 0x68, 0x79, 0x97, 0xA6, 0xA3, 0xA5, 0xB9, 0xC3, 0x9E,
+  0x5D, 0x3C, 0x46, 0x59, 0x5C, 0x5A, 0x6D, 0x8E, 0x9E, 0x8C, 0x6E, 0x68,
+  0x82, 0x9F, 0xA6, 0xA1, 0xAB, 0xBF, 0xBA, 0x85, 0x48, 0x38, 0x4C, 0x5A,
+  0x59, 0x5D, 0x77, 0x98, 0x9C, 0x81, 0x6A, 0x72, 0x90, 0xA5, 0xA5, 0xA3,
+  0xB4, 0xC3, 0xAA, 0x6E, 0x3F, 0x40, 0x57, 0x5C, 0x58, 0x65, 0x84, 0x9A,
+  0x92, 0x72, 0x64, 0x78, 0x96, 0xA2, 0x9D, 0xA1, 0xB7, 0xBD, 0x93, 0x54,
+  0x39, 0x48, 0x5C, 0x5E, 0x5E, 0x72, 0x91, 0x9E, 0x89, 0x6C, 0x6A, 0x87,
+  0xA1, 0xA5, 0xA1, 0xAE, 0xC2, 0xB7, 0x7D, 0x44, 0x39, 0x4F, 0x5A, 0x57,
+  0x5E, 0x7B, 0x9A, 0x99, 0x7C, 0x66, 0x72, 0x91, 0xA5, 0xA2, 0xA2, 0xB5,
+  0xC2, 0xA3, 0x65, 0x3C, 0x42, 0x58, 0x5C, 0x59, 0x6A, 0x8A, 0x9D, 0x90,
+  0x71, 0x67, 0x7E, 0x9B, 0xA5, 0xA1, 0xA8, 0xBD, 0xBC, 0x8C, 0x4F, 0x39,
+  0x4A, 0x5B, 0x5A, 0x5B, 0x73, 0x94, 0x9B, 0x83, 0x69, 0x6A, 0x85, 0x9F,
+  0xA4, 0x9F, 0xA9, 0xBD, 0xBC, 0x8F, 0x50, 0x34, 0x44, 0x57, 0x59, 0x58,
+  0x68, 0x88, 0x9E, 0x93, 0x74, 0x66, 0x79, 0x98, 0xA7, 0xA5, 0xA6, 0xB7,
+  0xC5, 0xAD, 0x71, 0x40, 0x3E, 0x54, 0x5E, 0x5B, 0x61, 0x7B, 0x98, 0x9D,
+  0x83, 0x68, 0x6B, 0x88, 0xA0, 0xA3, 0x9E, 0xA8, 0xBC, 0xB8, 0x88, 0x4B,
+  0x35, 0x46, 0x59, 0x5B, 0x5D, 0x6E, 0x8E, 0xA1, 0x92, 0x74, 0x68, 0x7A,
+  0x98, 0xA7, 0xA2, 0xA3, 0xB7, 0xC3, 0xA7, 0x6A, 0x3B, 0x3B, 0x51, 0x5A,
+  0x57, 0x5E, 0x7A, 0x98, 0x9B, 0x80, 0x68, 0x6C, 0x88, 0xA1, 0xA4, 0x9F,
+  0xAA, 0xBE, 0xBA, 0x8B, 0x4E, 0x37, 0x48, 0x5A, 0x59, 0x5A, 0x6C, 0x8C,
+  0x9F, 0x90, 0x72, 0x68, 0x7B, 0x99, 0xA6, 0xA2, 0xA4, 0xB7, 0xC3, 0xA7,
+  0x6A, 0x3D, 0x3F, 0x56, 0x5D, 0x59, 0x62, 0x7E, 0x9A, 0x9B, 0x81, 0x69,
+  0x6F, 0x8B, 0xA2, 0xA4, 0xA0, 0xAC, 0xC1, 0xBA, 0x87, 0x4A, 0x35, 0x47,
+  0x59, 0x59, 0x59, 0x6D, 0x8E, 0x9F, 0x8F, 0x71, 0x68, 0x7D, 0x9A, 0xA8,
+  0xA4, 0xA6, 0xB9, 0xC4, 0xA6, 0x68, 0x3D, 0x40, 0x56, 0x5D, 0x5A, 0x62,
+  0x7D, 0x99, 0x9A, 0x7D, 0x65, 0x6C, 0x89, 0x9F, 0xA0, 0x9B, 0xA7, 0xBB,
+  0xB2, 0x7D, 0x44, 0x34, 0x48, 0x59, 0x5A, 0x5C, 0x70, 0x90, 0xA0, 0x90,
+  0x72, 0x65, 0x75, 0x93, 0xA5, 0xA2, 0x9F, 0xAE, 0xC1, 0xB8, 0x85, 0x49,
+  0x32, 0x43, 0x56, 0x58, 0x56, 0x64, 0x83, 0x9D, 0x9A, 0x7E, 0x66, 0x6B,
+  0x87, 0xA1, 0xA6, 0xA0, 0xA7, 0xBB, 0xC2, 0xA0, 0x63, 0x3A, 0x3E, 0x54,
+  0x5D, 0x5A, 0x5F, 0x77, 0x96, 0xA0, 0x8C, 0x71, 0x6A, 0x7E, 0x9B, 0xA8,
+  0xA3, 0xA3, 0xB4, 0xC3, 0xB3, 0x7D, 0x47, 0x39, 0x4C, 0x5D, 0x5C, 0x5B,
+  0x6A, 0x89, 0x9F, 0x96, 0x78, 0x66, 0x71, 0x8D, 0xA4, 0xA5, 0x9F, 0xAA,
+  0xBE, 0xBD, 0x93, 0x56, 0x35, 0x3F, 0x55, 0x5B, 0x57, 0x60, 0x7B, 0x99,
+  0x9D, 0x85, 0x6C, 0x6B, 0x84, 0xA0, 0xA9, 0xA3, 0xA5, 0xB8, 0xC4, 0xAA,
+  0x6F, 0x3F, 0x3A, 0x4F, 0x5C, 0x59, 0x5A, 0x6D, 0x8D, 0x9D, 0x8E, 0x70,
+  0x61, 0x70, 0x8E, 0xA1, 0xA0, 0x9F, 0xAD, 0xC1, 0xBA, 0x8C, 0x52, 0x3A,
+  0x48, 0x5A, 0x5B, 0x59, 0x64, 0x82, 0x9D, 0x9B, 0x7F, 0x67, 0x6A, 0x86,
+  0xA1, 0xA7, 0xA0, 0xA7, 0xBB, 0xC2, 0xA3, 0x65, 0x38, 0x39, 0x50, 0x5A,
+  0x57, 0x5B, 0x72, 0x92, 0xA0, 0x8C, 0x6E, 0x66, 0x7A, 0x98, 0xA6, 0xA2,
+  0xA2, 0xB2, 0xC2, 0xB4, 0x80, 0x48, 0x37, 0x4A, 0x5A, 0x5A, 0x59, 0x68,
+  0x86, 0x9D, 0x97, 0x7A, 0x67, 0x70, 0x8C, 0xA3, 0xA5, 0x9F, 0xA8, 0xBC,
+  0xBF, 0x9C, 0x60, 0x38, 0x3B, 0x50, 0x5A, 0x57, 0x58, 0x6A, 0x89, 0x9E,
+  0x95, 0x78, 0x63, 0x69, 0x86, 0xA0, 0xA7, 0xA1, 0xA4, 0xB7, 0xC4, 0xB1,
+  0x7B, 0x45, 0x37, 0x49, 0x5B, 0x5E, 0x5C, 0x65, 0x80, 0x9C, 0xA1, 0x89,
+  0x6E, 0x68, 0x7C, 0x99, 0xA8, 0xA5, 0xA1, 0xAE, 0xC0, 0xBD, 0x94, 0x58,
+  0x35, 0x3C, 0x52, 0x59, 0x55, 0x57, 0x6C, 0x8D, 0x9F, 0x92, 0x76, 0x68,
+  0x72, 0x8F, 0xA6, 0xA8, 0xA1, 0xA8, 0xBB, 0xC3, 0xAA, 0x71, 0x3F, 0x35,
+  0x4B, 0x5B, 0x5A, 0x58, 0x64, 0x81, 0x9C, 0x9B, 0x81, 0x68, 0x66, 0x7D,
+  0x9A, 0xA7, 0xA1, 0xA0, 0xAF, 0xC0, 0xB8, 0x8A, 0x4E, 0x33, 0x40, 0x56,
+  0x5C, 0x58, 0x5D, 0x75, 0x93, 0xA0, 0x90, 0x74, 0x66, 0x73, 0x90, 0xA5,
+  0xA6, 0xA0, 0xA8, 0xBC, 0xC2, 0xA3, 0x68, 0x3C, 0x3A, 0x4F, 0x5C, 0x5C,
+  0x5B, 0x6A, 0x89, 0xA0, 0x9A, 0x7F, 0x69, 0x6A, 0x83, 0x9E, 0xA7, 0xA1,
+  0xA2, 0xB3, 0xC3, 0xB5, 0x81, 0x48, 0x33, 0x43, 0x57, 0x5B, 0x58, 0x60,
+  0x7A, 0x97, 0xA0, 0x8E, 0x72, 0x67, 0x78, 0x96, 0xA8, 0xA6, 0xA1, 0xAC,
+  0xC0, 0xC1, 0x9C, 0x61, 0x3B, 0x3D, 0x51, 0x5D, 0x5B, 0x5B, 0x6D, 0x8A,
+  0x9D, 0x95, 0x79, 0x63, 0x69, 0x83, 0x9C, 0xA2, 0x9B, 0x9E, 0xB2, 0xC1,
+  0xAC, 0x77, 0x45, 0x36, 0x47, 0x59, 0x5D, 0x58, 0x5E, 0x73, 0x90, 0xA1,
+  0x96, 0x78, 0x64, 0x69, 0x83, 0x9D, 0xA8, 0xA2, 0xA0, 0xAE, 0xC0, 0xBC,
+  0x95, 0x5B, 0x34, 0x36, 0x4C, 0x5A, 0x59, 0x57, 0x64, 0x80, 0x9B, 0x9F,
+  0x8B, 0x70, 0x66, 0x75, 0x92, 0xA5, 0xA7, 0xA1, 0xA6, 0xB9, 0xC4, 0xB2,
+  0x7F, 0x4A, 0x35, 0x44, 0x58, 0x5F, 0x5B, 0x5E, 0x72, 0x90, 0xA2, 0x9A,
+  0x7F, 0x69, 0x6B, 0x82, 0x9D, 0xA9, 0xA5, 0xA1, 0xAD, 0xC1, 0xC1, 0x9C,
+  0x61, 0x37, 0x35, 0x4B, 0x5B, 0x5A, 0x57, 0x62, 0x7D, 0x98, 0xA0, 0x8D,
+  0x6F, 0x63, 0x73, 0x8F, 0xA4, 0xA7, 0xA1, 0xA4, 0xB6, 0xC4, 0xB5, 0x84,
+  0x4D, 0x35, 0x42, 0x57, 0x5E, 0x5B, 0x5D, 0x6F, 0x8C, 0xA0, 0x9B, 0x80,
+  0x68, 0x68, 0x7E, 0x99, 0xA6, 0xA1, 0x9C, 0xA8, 0xBA, 0xBD, 0x9E, 0x64,
+  0x36, 0x33, 0x48, 0x59, 0x5D, 0x5C, 0x65, 0x7F, 0x9A, 0xA2, 0x91, 0x74,
+  0x64, 0x70, 0x8B, 0xA2, 0xA8, 0xA1, 0xA3, 0xB4, 0xC3, 0xB6, 0x88, 0x4E,
+  0x32, 0x3C, 0x52, 0x5B, 0x59, 0x59, 0x6A, 0x88, 0x9E, 0x9B, 0x82, 0x69,
+  0x66, 0x7B, 0x97, 0xA7, 0xA4, 0x9F, 0xA9, 0xBD, 0xC2, 0xA6, 0x70, 0x40,
+  0x36, 0x48, 0x5A, 0x5D, 0x59, 0x60, 0x78, 0x94, 0xA1, 0x93, 0x76, 0x64,
+  0x6D, 0x88, 0xA0, 0xA7, 0xA1, 0xA2, 0xB3, 0xC2, 0xB3, 0x7F, 0x47, 0x34,
+  0x45, 0x58, 0x5A, 0x56, 0x5E, 0x79, 0x96, 0x9E, 0x89, 0x6D, 0x63, 0x75,
+  0x94, 0xA5, 0xA3, 0x9F, 0xAB, 0xBE, 0xBF, 0x98, 0x5D, 0x38, 0x3C, 0x52,
+  0x5E, 0x5D, 0x5E, 0x70, 0x8F, 0xA2, 0x98, 0x7C, 0x69, 0x70, 0x8A, 0xA3,
+  0xA8, 0xA0, 0xA4, 0xB6, 0xC2, 0xAD, 0x76, 0x41, 0x34, 0x47, 0x58, 0x58,
+  0x54, 0x5F, 0x7B, 0x98, 0x9E, 0x87, 0x6D, 0x69, 0x7F, 0x9D, 0xAA, 0xA4,
+  0xA0, 0xAE, 0xC1, 0xBC, 0x90, 0x55, 0x35, 0x3C, 0x52, 0x5B, 0x58, 0x5B,
+  0x72, 0x91, 0xA0, 0x92, 0x75, 0x64, 0x6F, 0x8C, 0xA3, 0xA5, 0x9F, 0xA4,
+  0xB8, 0xC1, 0xA5, 0x6B, 0x3C, 0x35, 0x4A, 0x5A, 0x5A, 0x59, 0x67, 0x84,
+  0x9E, 0x9D, 0x84, 0x6A, 0x69, 0x81, 0x9C, 0xA7, 0xA3, 0xA1, 0xB1, 0xC2,
+  0xB8, 0x88, 0x4F, 0x36, 0x42, 0x57, 0x5E, 0x5A, 0x60, 0x78, 0x97, 0xA3,
+  0x91, 0x73, 0x66, 0x75, 0x92, 0xA5, 0xA6, 0xA0, 0xA8, 0xBD, 0xC2, 0x9F,
+  0x63, 0x38, 0x36, 0x4C, 0x5B, 0x5A, 0x59, 0x6A, 0x89, 0xA0, 0x9B, 0x80,
+  0x69, 0x6C, 0x86, 0xA1, 0xAA, 0xA4, 0xA4, 0xB6, 0xC5, 0xB4, 0x7F, 0x49,
+  0x36, 0x46, 0x5A, 0x5D, 0x59, 0x61, 0x7A, 0x96, 0x9E, 0x8A, 0x6C, 0x62,
+  0x74, 0x91, 0xA2, 0x9F, 0x9A, 0xA7, 0xBC, 0xBA, 0x8F, 0x55, 0x37, 0x43,
+  0x59, 0x5D, 0x57, 0x60, 0x7C, 0x98, 0x9C, 0x84, 0x68, 0x66, 0x7F, 0x9C,
+  0xA6, 0xA1, 0xA3, 0xB6, 0xC3, 0xA9, 0x6C, 0x3A, 0x35, 0x4B, 0x59, 0x56,
+  0x59, 0x6E, 0x8E, 0xA0, 0x92, 0x74, 0x65, 0x74, 0x93, 0xA7, 0xA4, 0xA0,
+  0xAF, 0xC2, 0xBA, 0x8A, 0x4F, 0x37, 0x47, 0x5A, 0x5D, 0x5B, 0x66, 0x83,
+  0x9E, 0x9D, 0x81, 0x6B, 0x6F, 0x89, 0xA2, 0xA7, 0xA1, 0xA8, 0xBC, 0xC1,
+  0xA1, 0x66, 0x3B, 0x3C, 0x53, 0x5D, 0x59, 0x5C, 0x73, 0x93, 0x9F, 0x8B,
+  0x6E, 0x66, 0x7B, 0x98, 0xA6, 0xA1, 0xA1, 0xB2, 0xC2, 0xB2, 0x7C, 0x45,
+  0x36, 0x49, 0x5B, 0x5C, 0x5A, 0x6A, 0x89, 0x9E, 0x97, 0x7B, 0x68, 0x71,
+  0x8F, 0xA5, 0xA6, 0xA1, 0xAB, 0xBF, 0xBE, 0x94, 0x58, 0x36, 0x3F, 0x55,
+  0x5A, 0x56, 0x5D, 0x78, 0x95, 0x99, 0x80, 0x65, 0x64, 0x7E, 0x9B, 0xA6,
+  0xA4, 0xA8, 0xBA, 0xC7, 0xAE, 0x72, 0x3F, 0x38, 0x4D, 0x5A, 0x59, 0x59,
+  0x6D, 0x8E, 0xA1, 0x93, 0x74, 0x64, 0x73, 0x92, 0xA6, 0xA4, 0xA0, 0xAE,
+  0xC1, 0xBB, 0x8D, 0x50, 0x34, 0x41, 0x55, 0x59, 0x57, 0x62, 0x7F, 0x9C,
+  0x9C, 0x80, 0x69, 0x6C, 0x86, 0xA0, 0xA7, 0xA0, 0xA5, 0xBA, 0xC2, 0xA3,
+  0x68, 0x3C, 0x3C, 0x52, 0x5C, 0x59, 0x5C, 0x72, 0x91, 0x9E, 0x8A, 0x6D,
+  0x68, 0x80, 0x9C, 0xA5, 0xA0, 0xA6, 0xBA, 0xC0, 0x9A, 0x5A, 0x35, 0x3F,
+  0x54, 0x58, 0x56, 0x62, 0x81, 0x9C, 0x96, 0x77, 0x64, 0x71, 0x90, 0xA5,
+  0xA3, 0xA0, 0xB0, 0xC2, 0xB2, 0x7B, 0x46, 0x3B, 0x51, 0x5F, 0x5D, 0x5F,
+  0x76, 0x96, 0xA1, 0x8B, 0x6F, 0x6C, 0x84, 0xA0, 0xA8, 0xA1, 0xA7, 0xBC,
+  0xBF, 0x97, 0x59, 0x37, 0x41, 0x55, 0x58, 0x55, 0x62, 0x81, 0x9B, 0x96,
+  0x78, 0x67, 0x76, 0x96, 0xA9, 0xA7, 0xA4, 0xB2, 0xC4, 0xB3, 0x79, 0x43,
+  0x3A, 0x4F, 0x5B, 0x58, 0x5C, 0x74, 0x95, 0x9E, 0x87, 0x6A, 0x69, 0x83,
+  0x9E, 0xA4, 0x9F, 0xA6, 0xBC, 0xBF, 0x95, 0x55, 0x35, 0x42, 0x56, 0x59,
+  0x57, 0x66, 0x85, 0x9C, 0x94, 0x77, 0x66, 0x74, 0x92, 0xA5, 0xA3, 0xA1,
+  0xB2, 0xC3, 0xAF, 0x74, 0x41, 0x3B, 0x51, 0x5D, 0x5A, 0x5E, 0x76, 0x95,
+  0x9D, 0x86, 0x6C, 0x6B, 0x84, 0xA0, 0xA7, 0xA1, 0xA8, 0xBD, 0xBE, 0x93,
+  0x54, 0x36, 0x44, 0x57, 0x5A, 0x58, 0x67, 0x86, 0x9D, 0x93, 0x75, 0x66,
+  0x76, 0x94, 0xA6, 0xA4, 0xA3, 0xB4, 0xC4, 0xAD, 0x72, 0x40, 0x3D, 0x54,
+  0x5F, 0x5B, 0x60, 0x7A, 0x98, 0x9F, 0x87, 0x6C, 0x6D, 0x87, 0xA1, 0xA6,
+  0xA0, 0xA8, 0xBC, 0xBB, 0x8F, 0x52, 0x34, 0x42, 0x56, 0x56, 0x53, 0x64,
+  0x85, 0x9A, 0x8C, 0x6D, 0x66, 0x81, 0x9F, 0xA8, 0xA3, 0xA9, 0xBE, 0xBB,
+  0x88, 0x4A, 0x37, 0x4A, 0x59, 0x57, 0x5A, 0x74, 0x94, 0x9B, 0x82, 0x67,
+  0x6C, 0x8B, 0xA2, 0xA3, 0xA1, 0xB0, 0xC1, 0xAD, 0x6F, 0x3C, 0x3B, 0x52,
+  0x5A, 0x57, 0x62, 0x82, 0x9D, 0x96, 0x76, 0x67, 0x79, 0x98, 0xA6, 0xA2,
+  0xA6, 0xBB, 0xC1, 0x9B, 0x5C, 0x3B, 0x48, 0x5D, 0x5D, 0x5C, 0x71, 0x90,
+  0x9F, 0x8C, 0x6E, 0x6C, 0x87, 0xA1, 0xA7, 0xA3, 0xAC, 0xC1, 0xB9, 0x81,
+  0x48, 0x3B, 0x4D, 0x5A, 0x58, 0x5D, 0x79, 0x98, 0x9A, 0x7E, 0x66, 0x70,
+  0x8F, 0xA3, 0xA2, 0xA3, 0xB4, 0xC2, 0xA8, 0x68, 0x3B, 0x40, 0x57, 0x5B,
+  0x59, 0x68, 0x88, 0x9F, 0x93, 0x75, 0x69, 0x7D, 0x9B, 0xA7, 0xA1, 0xA6,
+  0xBC, 0xBD, 0x91, 0x53, 0x38, 0x48, 0x5A, 0x58, 0x58, 0x6F, 0x8F, 0x99,
+  0x82, 0x65, 0x66, 0x84, 0x9F, 0xA3, 0xA0, 0xAF, 0xC4, 0xB6, 0x7C, 0x46,
+  0x3D, 0x52, 0x5D, 0x59, 0x60, 0x7E, 0x9A, 0x98, 0x7A, 0x66, 0x74, 0x94,
+  0xA4, 0xA2, 0xA4, 0xB7, 0xC2, 0xA1, 0x5F, 0x38, 0x41, 0x55, 0x59, 0x58,
+  0x68, 0x8A, 0x9E, 0x8E, 0x6F, 0x67, 0x80, 0x9D, 0xA5, 0xA0, 0xA9, 0xBF,
+  0xBB, 0x89, 0x4E, 0x3A, 0x4D, 0x5C, 0x59, 0x5C, 0x76, 0x94, 0x9B, 0x83,
+  0x68, 0x6F, 0x8D, 0xA3, 0xA2, 0xA2, 0xB6, 0xC1, 0x9A, 0x59, 0x39, 0x48,
+  0x59, 0x59, 0x5C, 0x74, 0x94, 0x98, 0x7C, 0x65, 0x71, 0x91, 0xA3, 0xA1,
+  0xA5, 0xBB, 0xBF, 0x90, 0x50, 0x38, 0x49, 0x59, 0x58, 0x5E, 0x7B, 0x99,
+  0x98, 0x7B, 0x68, 0x7B, 0x9B, 0xA7, 0xA3, 0xAB, 0xC1, 0xBE, 0x8A, 0x4E,
+  0x3E, 0x52, 0x5D, 0x5A, 0x63, 0x82, 0x9D, 0x95, 0x74, 0x67, 0x7D, 0x9A,
+  0xA3, 0x9F, 0xA8, 0xBD, 0xB4, 0x7B, 0x43, 0x3D, 0x53, 0x5B, 0x5A, 0x69,
+  0x8B, 0xA0, 0x91, 0x72, 0x6A, 0x84, 0xA0, 0xA5, 0xA1, 0xAF, 0xC1, 0xAE,
+  0x70, 0x3E, 0x3D, 0x53, 0x59, 0x56, 0x67, 0x8A, 0x9C, 0x89, 0x6B, 0x69,
+  0x86, 0xA0, 0xA2, 0x9F, 0xB0, 0xC1, 0xA3, 0x63, 0x3A, 0x42, 0x56, 0x59,
+  0x58, 0x6D, 0x8F, 0x9B, 0x84, 0x69, 0x6E, 0x8D, 0xA3, 0xA2, 0xA1, 0xB5,
+  0xC1, 0x9E, 0x5C, 0x3B, 0x47, 0x5A, 0x5B, 0x5D, 0x74, 0x94, 0x9B, 0x80,
+  0x68, 0x73, 0x92, 0xA5, 0xA2, 0xA5, 0xBA, 0xC0, 0x94, 0x53, 0x39, 0x49,
+  0x59, 0x58, 0x5D, 0x7A, 0x98, 0x98, 0x7B, 0x66, 0x76, 0x96, 0xA5, 0xA2,
+  0xA8, 0xBE, 0xBE, 0x8C, 0x4E, 0x3D, 0x52, 0x5E, 0x5B, 0x64, 0x82, 0x9E,
+  0x97, 0x78, 0x69, 0x7F, 0x9D, 0xA5, 0xA1, 0xAA, 0xBF, 0xB8, 0x7F, 0x44,
+  0x3B, 0x50, 0x58, 0x54, 0x63, 0x84, 0x97, 0x84, 0x67, 0x68, 0x87, 0x9F,
+  0xA1, 0xA4, 0xBA, 0xC2, 0x95, 0x52, 0x3B, 0x4E, 0x5A, 0x56, 0x61, 0x82,
+  0x9A, 0x8D, 0x6D, 0x69, 0x86, 0xA0, 0xA2, 0xA1, 0xB4, 0xBE, 0x97, 0x54,
+  0x37, 0x49, 0x58, 0x55, 0x5F, 0x80, 0x9A, 0x90, 0x71, 0x68, 0x82, 0x9E,
+  0xA3, 0xA1, 0xB3, 0xC3, 0xA3, 0x61, 0x3D, 0x49, 0x5B, 0x5A, 0x5F, 0x7D,
+  0x9B, 0x97, 0x79, 0x6C, 0x82, 0x9F, 0xA6, 0xA1, 0xB1, 0xC3, 0xA8, 0x65,
+  0x3E, 0x48, 0x5B, 0x5A, 0x5D, 0x78, 0x98, 0x97, 0x79, 0x67, 0x7B, 0x9A,
+  0xA4, 0xA1, 0xAE, 0xC2, 0xAE, 0x6D, 0x3C, 0x40, 0x55, 0x58, 0x5A, 0x72,
+  0x94, 0x9A, 0x7D, 0x67, 0x79, 0x99, 0xA5, 0xA0, 0xAA, 0xC2, 0xB5, 0x76,
+  0x42, 0x44, 0x58, 0x5B, 0x5B, 0x70, 0x91, 0x9A, 0x80, 0x68, 0x74, 0x93,
+  0xA2, 0xA0, 0xA8, 0xBD, 0xB5, 0x7B, 0x41, 0x3A, 0x4E, 0x54, 0x53, 0x69,
+  0x8D, 0x9B, 0x84, 0x6B, 0x75, 0x96, 0xA8, 0xA3, 0xA7, 0xBE, 0xBE, 0x88,
+  0x4A, 0x3D, 0x52, 0x5A, 0x57, 0x67, 0x89, 0x9A, 0x87, 0x6A, 0x6D, 0x8D,
+  0xA3, 0xA2, 0xA5, 0xBB, 0xBE, 0x8D, 0x4C, 0x39, 0x4E, 0x5A, 0x57, 0x65,
+  0x86, 0x9C, 0x8C, 0x6D, 0x6B, 0x8A, 0xA2, 0xA3, 0xA3, 0xB7, 0xC1, 0x98,
+  0x56, 0x3D, 0x4F, 0x5B, 0x58, 0x60, 0x7B, 0x96, 0x97, 0x7E, 0x67, 0x6D,
+  0x88, 0x9E, 0xA0, 0x9C, 0xA7, 0xBA, 0xB3, 0x85, 0x4E, 0x3A, 0x4A, 0x5A,
+  0x59, 0x57, 0x69, 0x89, 0x9A, 0x8A, 0x6E, 0x65, 0x78, 0x95, 0xA2, 0x9D,
+  0x9F, 0xB2, 0xBB, 0x9D, 0x65, 0x3D, 0x40, 0x55, 0x5D, 0x5B, 0x64, 0x80,
+  0x9B, 0x9B, 0x82, 0x6D, 0x73, 0x8E, 0xA3, 0xA4, 0xA0, 0xAB, 0xBD, 0xB5,
+  0x86, 0x50, 0x3E, 0x4E, 0x5D, 0x5B, 0x5C, 0x6D, 0x8B, 0x9A, 0x88, 0x6B,
+  0x63, 0x79, 0x96, 0xA2, 0x9E, 0xA3, 0xB7, 0xC1, 0xA4, 0x69, 0x41, 0x45,
+  0x5A, 0x5E, 0x5A, 0x64, 0x7F, 0x98, 0x96, 0x7C, 0x67, 0x6E, 0x8A, 0x9F,
+  0xA0, 0x9E, 0xAA, 0xBC, 0xB2, 0x80, 0x48, 0x38, 0x4A, 0x59, 0x59, 0x5A,
+  0x6D, 0x8C, 0x9A, 0x89, 0x6F, 0x69, 0x7D, 0x98, 0xA3, 0x9F, 0xA2, 0xB5,
+  0xBD, 0x9D, 0x63, 0x40, 0x46, 0x5A, 0x5F, 0x5D, 0x67, 0x82, 0x9B, 0x97,
+  0x7D, 0x6A, 0x73, 0x8E, 0xA2, 0xA3, 0xA0, 0xAD, 0xBE, 0xB2, 0x7F, 0x4B,
+  0x3E, 0x51, 0x5E, 0x5B, 0x5C, 0x71, 0x8F, 0x9C, 0x8A, 0x6E, 0x68, 0x7F,
+  0x9B, 0xA3, 0x9F, 0xA5, 0xB7, 0xBD, 0x9C, 0x62, 0x3E, 0x46, 0x5B, 0x60,
+  0x5D, 0x68, 0x85, 0x9D, 0x98, 0x7E, 0x6D, 0x77, 0x92, 0xA5, 0xA4, 0xA1,
+  0xAF, 0xBF, 0xB1, 0x7E, 0x4A, 0x3D, 0x50, 0x5D, 0x59, 0x5A, 0x6B, 0x88,
+  0x98, 0x8B, 0x6E, 0x5F, 0x6F, 0x8E, 0xA0, 0xA0, 0x9F, 0xAC, 0xBF, 0xBA,
+  0x8B, 0x52, 0x3B, 0x48, 0x59, 0x5B, 0x59, 0x64, 0x80, 0x99, 0x98, 0x7F,
+  0x68, 0x6A, 0x84, 0x9D, 0xA3, 0x9D, 0xA1, 0xB5, 0xBD, 0xA0, 0x66, 0x3C,
+  0x3C, 0x51, 0x5C, 0x5A, 0x5E, 0x73, 0x91, 0x9E, 0x8D, 0x72, 0x6A, 0x7C,
+  0x97, 0xA4, 0xA1, 0xA0, 0xAF, 0xBF, 0xB3, 0x83, 0x4F, 0x3F, 0x50, 0x60,
+  0x61, 0x5F, 0x6C, 0x88, 0x9E, 0x98, 0x7D, 0x6B, 0x73, 0x8D, 0xA2, 0xA4,
+  0x9F, 0xA7, 0xBA, 0xBB, 0x96, 0x5E, 0x3C, 0x43, 0x57, 0x5D, 0x59, 0x60,
+  0x78, 0x94, 0x9A, 0x85, 0x6C, 0x68, 0x7E, 0x99, 0xA4, 0xA0, 0xA1, 0xB2,
+  0xBF, 0xAB, 0x75, 0x46, 0x40, 0x54, 0x61, 0x5F, 0x60, 0x71, 0x8E, 0x9F,
+  0x93, 0x78, 0x69, 0x75, 0x90, 0xA2, 0xA2, 0x9E, 0xA8, 0xBA, 0xB6, 0x8B,
+  0x52, 0x38, 0x44, 0x55, 0x57, 0x54, 0x5E, 0x7B, 0x97, 0x99, 0x82, 0x6E,
+  0x71, 0x89, 0xA1, 0xA6, 0xA0, 0xA4, 0xB7, 0xBE, 0xA4, 0x6C, 0x40, 0x3D,
+  0x51, 0x5C, 0x5A, 0x5D, 0x71, 0x8F, 0x9E, 0x8D, 0x71, 0x67, 0x77, 0x93,
+  0xA3, 0xA0, 0x9E, 0xAD, 0xBD, 0xB2, 0x83, 0x4D, 0x3A, 0x4B, 0x5C, 0x5D,
+  0x5C, 0x69, 0x84, 0x9B, 0x98, 0x7F, 0x6B, 0x71, 0x8A, 0xA0, 0xA4, 0x9E,
+  0xA4, 0xB6, 0xBF, 0xA9, 0x75, 0x46, 0x3C, 0x4F, 0x5E, 0x5E, 0x5C, 0x67,
+  0x81, 0x99, 0x9B, 0x83, 0x6B, 0x68, 0x7D, 0x98, 0xA3, 0x9F, 0x9E, 0xAC,
+  0xBD, 0xB5, 0x8A, 0x53, 0x37, 0x41, 0x55, 0x5B, 0x59, 0x5E, 0x73, 0x90,
+  0x9E, 0x8E, 0x73, 0x68, 0x75, 0x8F, 0xA4, 0xA6, 0xA1, 0xA9, 0xBB, 0xC1,
+  0xA5, 0x6F, 0x44, 0x41, 0x55, 0x61, 0x5E, 0x5E, 0x6B, 0x86, 0x9B, 0x97,
+  0x7E, 0x68, 0x68, 0x7F, 0x99, 0xA1, 0x9B, 0x9C, 0xAC, 0xBB, 0xB0, 0x83,
+  0x4F, 0x3D, 0x4D, 0x60, 0x63, 0x5E, 0x63, 0x7A, 0x96, 0x9D, 0x8A, 0x70,
+  0x66, 0x75, 0x91, 0xA3, 0xA2, 0x9E, 0xA8, 0xBA, 0xBC, 0x99, 0x60, 0x3A,
+  0x3C, 0x51, 0x5C, 0x59, 0x5B, 0x6B, 0x88, 0x9B, 0x94, 0x79, 0x66, 0x6B,
+  0x85, 0x9D, 0xA3, 0x9E, 0xA2, 0xB2, 0xBE, 0xAD, 0x7C, 0x4A, 0x3C, 0x4D,
+  0x5E, 0x60, 0x5C, 0x65, 0x7F, 0x99, 0x9C, 0x87, 0x6F, 0x6A, 0x7C, 0x96,
+  0xA4, 0xA3, 0xA0, 0xAB, 0xBD, 0xBA, 0x94, 0x5C, 0x3D, 0x44, 0x57, 0x5D,
+  0x5A, 0x5D, 0x70, 0x8D, 0x9D, 0x92, 0x77, 0x67, 0x6F, 0x8A, 0xA1, 0xA4,
+  0x9F, 0xA4, 0xB6, 0xBF, 0xA8, 0x73, 0x46, 0x3E, 0x50, 0x5F, 0x61, 0x5F,
+  0x6A, 0x85, 0x9D, 0x9C, 0x86, 0x6F, 0x6D, 0x81, 0x9A, 0xA5, 0x9F, 0x9E,
+  0xAB, 0xBA, 0xB6, 0x93, 0x5C, 0x37, 0x39, 0x4D, 0x57, 0x55, 0x53, 0x60,
+  0x7D, 0x97, 0x9B, 0x88, 0x71, 0x6A, 0x7A, 0x92, 0xA3, 0xA4, 0x9E, 0xA3,
+  0xB4, 0xBE, 0xAB, 0x7A, 0x48, 0x35, 0x43, 0x56, 0x5C, 0x59, 0x5C, 0x6F,
+  0x8B, 0x9C, 0x94, 0x7B, 0x67, 0x69, 0x80, 0x99, 0xA4, 0x9F, 0x9D, 0xAA,
+  0xBC, 0xBA, 0x9A, 0x65, 0x3E, 0x3D, 0x50, 0x5E, 0x5E, 0x5D, 0x68, 0x80,
+  0x99, 0x9F, 0x8E, 0x74, 0x69, 0x76, 0x8F, 0xA4, 0xA7, 0xA0, 0xA3, 0xB4,
+  0xC1, 0xB1, 0x84, 0x51, 0x3C, 0x47, 0x5A, 0x61, 0x5E, 0x5F, 0x70, 0x8B,
+  0x9E, 0x98, 0x7F, 0x68, 0x69, 0x7E, 0x98, 0xA5, 0xA2, 0x9D, 0xA8, 0xBA,
+  0xBC, 0x9E, 0x68, 0x3D, 0x39, 0x4D, 0x5C, 0x5D, 0x5C, 0x65, 0x7C, 0x96,
+  0xA1, 0x91, 0x76, 0x6A, 0x74, 0x8D, 0xA2, 0xA6, 0xA0, 0xA2, 0xB1, 0xBF,
+  0xB3, 0x88, 0x53, 0x38, 0x41, 0x55, 0x5D, 0x59, 0x59, 0x69, 0x84, 0x98,
+  0x94, 0x7C, 0x66, 0x66, 0x7A, 0x94, 0xA5, 0xA6, 0xA2, 0xAB, 0xBB, 0xBE,
+  0xA3, 0x70, 0x43, 0x39, 0x4B, 0x5B, 0x5D, 0x5A, 0x61, 0x77, 0x93, 0x9E,
+  0x90, 0x75, 0x66, 0x6F, 0x87, 0x9E, 0xA4, 0x9F, 0x9F, 0xAE, 0xBE, 0xB5,
+  0x8C, 0x57, 0x39, 0x3E, 0x52, 0x5D, 0x5C, 0x5C, 0x6A, 0x86, 0x9C, 0x9B,
+  0x85, 0x6D, 0x67, 0x77, 0x90, 0xA3, 0xA4, 0x9D, 0xA0, 0xB0, 0xBE, 0xB8,
+  0x92, 0x5D, 0x3C, 0x3C, 0x50, 0x5F, 0x60, 0x5C, 0x62, 0x77, 0x91, 0x9F,
+  0x96, 0x7D, 0x68, 0x68, 0x7B, 0x94, 0xA3, 0xA1, 0x9B, 0xA1, 0xB3, 0xBE,
+  0xB0, 0x84, 0x51, 0x36, 0x3C, 0x50, 0x5C, 0x5C, 0x5A, 0x63, 0x7B, 0x96,
+  0xA0, 0x94, 0x7B, 0x6B, 0x70, 0x85, 0x9E, 0xA9, 0xA5, 0xA0, 0xA8, 0xBA,
+  0xC1, 0xAD, 0x7F, 0x4D, 0x39, 0x44, 0x58, 0x5F, 0x5D, 0x5B, 0x66, 0x7E,
+  0x96, 0x9B, 0x88, 0x6D, 0x60, 0x6C, 0x86, 0x9C, 0xA5, 0xA3, 0xA2, 0xAE,
+  0xBF, 0xBF, 0xA3, 0x71, 0x45, 0x37, 0x46, 0x59, 0x5F, 0x5B, 0x5C, 0x6C,
+  0x87, 0x9B, 0x9B, 0x87, 0x6E, 0x65, 0x72, 0x8C, 0xA0, 0xA5, 0x9F, 0x9E,
+  0xAC, 0xBC, 0xB9, 0x98, 0x64, 0x3C, 0x36, 0x4A, 0x5B, 0x5E, 0x5B, 0x5F,
+  0x71, 0x8B, 0x9E, 0x9A, 0x82, 0x6B, 0x68, 0x7A, 0x93, 0xA4, 0xA5, 0x9F,
+  0xA2, 0xB1, 0xBF, 0xB7, 0x91, 0x5D, 0x3C, 0x3E, 0x52, 0x60, 0x60, 0x5D,
+  0x64, 0x7A, 0x93, 0xA0, 0x97, 0x7D, 0x68, 0x68, 0x7D, 0x97, 0xA5, 0xA3,
+  0x9E, 0xA4, 0xB5, 0xBF, 0xAF, 0x84, 0x51, 0x36, 0x3D, 0x51, 0x5D, 0x5D,
+  0x5C, 0x67, 0x7F, 0x97, 0xA0, 0x95, 0x7B, 0x6A, 0x70, 0x86, 0x9E, 0xA9,
+  0xA4, 0x9F, 0xA9, 0xB9, 0xC0, 0xAD, 0x80, 0x51, 0x37, 0x3B, 0x50, 0x5D,
+  0x5A, 0x57, 0x5C, 0x6C, 0x86, 0x98, 0x94, 0x82, 0x6D, 0x62, 0x6E, 0x88,
+  0x9F, 0xAA, 0xA4, 0x9E, 0xA5, 0xB5, 0xBE, 0xB0, 0x84, 0x53, 0x37, 0x37,
+  0x4A, 0x5B, 0x5D, 0x59, 0x5D, 0x6C, 0x86, 0x9C, 0x9D, 0x8A, 0x71, 0x63,
+  0x6C, 0x82, 0x98, 0xA5, 0xA2, 0x9B, 0xA3, 0xB4, 0xBE, 0xB6, 0x92, 0x5E,
+  0x3C, 0x3A, 0x4C, 0x5E, 0x61, 0x5D, 0x60, 0x6D, 0x86, 0x9D, 0xA1, 0x92,
+  0x7A, 0x68, 0x6D, 0x83, 0x99, 0xA7, 0xA7, 0x9F, 0xA3, 0xB2, 0xBE, 0xBA,
+  0x98, 0x65, 0x41, 0x3A, 0x48, 0x5B, 0x61, 0x5D, 0x5D, 0x67, 0x7D, 0x97,
+  0x9F, 0x92, 0x7A, 0x66, 0x66, 0x7A, 0x92, 0xA3, 0xA6, 0x9E, 0x9F, 0xAF,
+  0xBC, 0xBC, 0xA1, 0x6D, 0x44, 0x39, 0x44, 0x59, 0x63, 0x5F, 0x5E, 0x68,
+  0x7D, 0x97, 0xA3, 0x98, 0x81, 0x6C, 0x68, 0x7A, 0x91, 0xA1, 0xA6, 0x9E,
+  0x9B, 0xA9, 0xB8, 0xB8, 0xA1, 0x73, 0x44, 0x2F, 0x37, 0x4D, 0x5C, 0x5B,
+  0x5A, 0x62, 0x78, 0x95, 0xA5, 0x9D, 0x85, 0x6D, 0x66, 0x75, 0x8D, 0xA0,
+  0xA7, 0xA1, 0x9D, 0xA9, 0xB9, 0xBE, 0xAD, 0x7E, 0x4D, 0x35, 0x3A, 0x4E,
+  0x5D, 0x5D, 0x59, 0x5F, 0x72, 0x8C, 0x9F, 0x9B, 0x86, 0x6F, 0x63, 0x6F,
+  0x89, 0x9D, 0xA6, 0xA2, 0x9C, 0xA5, 0xB7, 0xBE, 0xAC, 0x80, 0x4F, 0x39,
+  0x43, 0x55, 0x5F, 0x5E, 0x5D, 0x69, 0x81, 0x98, 0x9F, 0x8F, 0x75, 0x67,
+  0x6E, 0x85, 0x9D, 0xA6, 0xA1, 0x9E, 0xA8, 0xB9, 0xBE, 0xA4, 0x72, 0x43,
+  0x34, 0x43, 0x57, 0x5D, 0x59, 0x5B, 0x69, 0x83, 0x9B, 0x9C, 0x88, 0x6E,
+  0x65, 0x71, 0x8A, 0x9F, 0xA5, 0x9F, 0x9F, 0xAD, 0xBE, 0xBC, 0x9E, 0x6C,
+  0x44, 0x3D, 0x4E, 0x5F, 0x62, 0x5F, 0x62, 0x74, 0x8D, 0x9F, 0x9B, 0x85,
+  0x6E, 0x68, 0x77, 0x8F, 0xA2, 0xA3, 0x9B, 0x9D, 0xAC, 0xBA, 0xB3, 0x8E,
+  0x5A, 0x39, 0x3A, 0x4E, 0x5F, 0x63, 0x61, 0x67, 0x7A, 0x92, 0xA1, 0x99,
+  0x7F, 0x68, 0x68, 0x7C, 0x96, 0xA5, 0xA3, 0x9D, 0xA2, 0xB4, 0xBF, 0xB1,
+  0x85, 0x51, 0x35, 0x3B, 0x50, 0x5C, 0x5B, 0x58, 0x62, 0x79, 0x93, 0x9D,
+  0x90, 0x76, 0x65, 0x6A, 0x80, 0x98, 0xA5, 0xA2, 0x9D, 0xA5, 0xB6, 0xBE,
+  0xAB, 0x7D, 0x4D, 0x38, 0x44, 0x58, 0x61, 0x5F, 0x5E, 0x6A, 0x82, 0x99,
+  0xA0, 0x8F, 0x75, 0x68, 0x72, 0x89, 0x9F, 0xA7, 0xA2, 0x9F, 0xAA, 0xBB,
+  0xBF, 0xA4, 0x70, 0x42, 0x36, 0x46, 0x58, 0x5E, 0x5A, 0x5B, 0x6C, 0x87,
+  0x9D, 0x9D, 0x88, 0x6E, 0x66, 0x74, 0x8D, 0xA1, 0xA6, 0xA1, 0xA1, 0xAF,
+  0xBF, 0xBC, 0x9C, 0x69, 0x43, 0x3D, 0x4E, 0x5E, 0x61, 0x5E, 0x64, 0x78,
+  0x92, 0x9F, 0x93, 0x77, 0x66, 0x6C, 0x83, 0x9A, 0xA0, 0x9B, 0x9A, 0xA8,
+  0xB7, 0xB1, 0x8A, 0x56, 0x38, 0x3D, 0x52, 0x5F, 0x60, 0x60, 0x6C, 0x83,
+  0x99, 0x9C, 0x86, 0x6D, 0x66, 0x76, 0x90, 0xA1, 0xA2, 0x9C, 0xA3, 0xB4,
+  0xBD, 0xA9, 0x77, 0x45, 0x35, 0x44, 0x57, 0x5C, 0x58, 0x5D, 0x71, 0x8E,
+  0x9E, 0x94, 0x7B, 0x67, 0x6B, 0x82, 0x9C, 0xA6, 0xA0, 0x9F, 0xAC, 0xBD,
+  0xBA, 0x96, 0x62, 0x3E, 0x3F, 0x53, 0x60, 0x5F, 0x5D, 0x69, 0x82, 0x9A,
+  0x9F, 0x8C, 0x72, 0x69, 0x78, 0x92, 0xA4, 0xA6, 0x9F, 0xA3, 0xB4, 0xC0,
+  0xAE, 0x7F, 0x4E, 0x3A, 0x45, 0x57, 0x5E, 0x5B, 0x5D, 0x6F, 0x8B, 0x9E,
+  0x97, 0x7D, 0x68, 0x6A, 0x80, 0x99, 0xA5, 0xA1, 0x9D, 0xAA, 0xBB, 0xBC,
+  0x9D, 0x67, 0x3F, 0x3E, 0x52, 0x5F, 0x60, 0x5E, 0x67, 0x7F, 0x99, 0xA0,
+  0x8E, 0x74, 0x67, 0x73, 0x8D, 0xA0, 0xA3, 0x9D, 0x9F, 0xB0, 0xBB, 0xAC,
+  0x7F, 0x4C, 0x32, 0x3B, 0x4F, 0x59, 0x59, 0x5C, 0x6D, 0x8A, 0x9F, 0x9D,
+  0x85, 0x6F, 0x6C, 0x7F, 0x99, 0xA5, 0xA2, 0x9E, 0xA8, 0xBA, 0xBD, 0xA0,
+  0x6B, 0x40, 0x38, 0x4B, 0x5B, 0x5C, 0x59, 0x61, 0x7A, 0x94, 0x9E, 0x8F,
+  0x74, 0x65, 0x6E, 0x88, 0x9F, 0xA4, 0x9E, 0xA0, 0xB0, 0xBE, 0xB3, 0x88,
+  0x53, 0x3B, 0x47, 0x5A, 0x5E, 0x5B, 0x61, 0x76, 0x93, 0x9D, 0x8C, 0x72,
+  0x68, 0x76, 0x90, 0xA2, 0xA2, 0x9E, 0xA7, 0xB9, 0xBC, 0x9F, 0x69, 0x40,
+  0x3E, 0x53, 0x5E, 0x5B, 0x5C, 0x6B, 0x87, 0x9B, 0x95, 0x7B, 0x66, 0x69,
+  0x81, 0x9B, 0xA3, 0x9E, 0xA0, 0xB1, 0xBF, 0xB0, 0x7E, 0x4A, 0x38, 0x48,
+  0x59, 0x5D, 0x5C, 0x64, 0x7C, 0x98, 0xA0, 0x8C, 0x72, 0x6B, 0x7C, 0x96,
+  0xA6, 0xA4, 0xA1, 0xAC, 0xBD, 0xBB, 0x98, 0x61, 0x3E, 0x42, 0x55, 0x5E,
+  0x5A, 0x5B, 0x6C, 0x89, 0x99, 0x8E, 0x72, 0x61, 0x6A, 0x87, 0x9E, 0xA4,
+  0xA1, 0xA7, 0xB9, 0xC3, 0xAD, 0x79, 0x48, 0x3C, 0x4D, 0x5C, 0x5D, 0x5B,
+  0x65, 0x7F, 0x99, 0x9A, 0x83, 0x6A, 0x67, 0x7B, 0x96, 0xA3, 0xA0, 0x9E,
+  0xAB, 0xBC, 0xB7, 0x8D, 0x55, 0x37, 0x40, 0x55, 0x5C, 0x59, 0x5D, 0x72,
+  0x8F, 0x9D, 0x8F, 0x75, 0x68, 0x72, 0x8D, 0xA1, 0xA3, 0x9E, 0xA6, 0xB7,
+  0xBE, 0xA4, 0x70, 0x44, 0x3F, 0x52, 0x5F, 0x5F, 0x5E, 0x6A, 0x85, 0x9C,
+  0x9A, 0x82, 0x6C, 0x6C, 0x82, 0x9B, 0xA5, 0xA1, 0xA0, 0xAE, 0xBD, 0xB3,
+  0x86, 0x4F, 0x37, 0x45, 0x59, 0x5D, 0x5A, 0x60, 0x77, 0x93, 0x9E, 0x8D,
+  0x73, 0x67, 0x75, 0x91, 0xA4, 0xA4, 0x9F, 0xA8, 0xBB, 0xBF, 0x9F, 0x69,
+  0x43, 0x43, 0x56, 0x60, 0x5E, 0x62, 0x76, 0x93, 0x9E, 0x8D, 0x71, 0x67,
+  0x77, 0x93, 0xA1, 0x9C, 0x99, 0xA8, 0xB8, 0xAB, 0x7A, 0x44, 0x33, 0x47,
+  0x59, 0x5A, 0x5B, 0x6B, 0x88, 0x9F, 0x99, 0x7C, 0x69, 0x70, 0x89, 0x9F,
+  0xA2, 0x9C, 0xA4, 0xB7, 0xBA, 0x96, 0x5D, 0x3A, 0x40, 0x55, 0x5C, 0x59,
+  0x5E, 0x76, 0x93, 0x9B, 0x86, 0x6C, 0x68, 0x7D, 0x98, 0xA3, 0x9F, 0xA0,
+  0xB1, 0xBE, 0xAA, 0x76, 0x47, 0x3F, 0x52, 0x5F, 0x5E, 0x5E, 0x6F, 0x8B,
+  0x9D, 0x93, 0x78, 0x6A, 0x76, 0x91, 0xA4, 0xA4, 0xA0, 0xAB, 0xBD, 0xB9,
+  0x8F, 0x57, 0x3E, 0x4B, 0x5C, 0x5F, 0x5D, 0x66, 0x7F, 0x99, 0x9B, 0x82,
+  0x69, 0x69, 0x82, 0x9D, 0xA4, 0x9F, 0xA3, 0xB6, 0xBE, 0xA3, 0x6A, 0x3E,
+  0x3C, 0x51, 0x5C, 0x5A, 0x5D, 0x71, 0x90, 0x9F, 0x8F, 0x73, 0x69, 0x7A,
+  0x96, 0xA5, 0xA3, 0xA1, 0xAF, 0xBF, 0xB6, 0x87, 0x51, 0x3D, 0x4C, 0x5B,
+  0x5D, 0x5B, 0x66, 0x81, 0x99, 0x95, 0x79, 0x65, 0x6B, 0x84, 0x99, 0x9D,
+  0x98, 0xA1, 0xB6, 0xBA, 0x9A, 0x65, 0x43, 0x48, 0x5C, 0x61, 0x5C, 0x61,
+  0x78, 0x93, 0x9C, 0x89, 0x6F, 0x69, 0x7D, 0x98, 0xA3, 0x9F, 0xA0, 0xB0,
+  0xBE, 0xAC, 0x78, 0x45, 0x3A, 0x4D, 0x5B, 0x5B, 0x5B, 0x6A, 0x87, 0x9A,
+  0x91, 0x77, 0x66, 0x72, 0x8F, 0xA2, 0xA0, 0x9F, 0xAE, 0xBE, 0xAF, 0x7B,
+  0x4A, 0x40, 0x52, 0x5E, 0x5C, 0x5F, 0x74, 0x92, 0x9B, 0x88, 0x6E, 0x6B,
+  0x82, 0x9C, 0xA3, 0x9E, 0xA5, 0xB7, 0xBA, 0x96, 0x5D, 0x3E, 0x48, 0x5A,
+  0x5D, 0x5A, 0x66, 0x83, 0x9A, 0x93, 0x77, 0x65, 0x73, 0x90, 0xA1, 0x9F,
+  0x9E, 0xAE, 0xBE, 0xAD, 0x76, 0x44, 0x3D, 0x51, 0x5C, 0x5B, 0x61, 0x77,
+  0x96, 0x9F, 0x8A, 0x71, 0x70, 0x88, 0xA0, 0xA6, 0xA1, 0xA8, 0xBB, 0xBC,
+  0x95, 0x5C, 0x3F, 0x4A, 0x5B, 0x5D, 0x5B, 0x69, 0x84, 0x98, 0x90, 0x73,
+  0x62, 0x6F, 0x8D, 0x9E, 0x9D, 0x9E, 0xAF, 0xBE, 0xAD, 0x78, 0x49, 0x43,
+  0x55, 0x5E, 0x5C, 0x60, 0x76, 0x94, 0x9B, 0x84, 0x69, 0x6A, 0x84, 0x9D,
+  0xA2, 0x9D, 0xA5, 0xB9, 0xB8, 0x8E, 0x55, 0x3A, 0x46, 0x58, 0x5A, 0x58,
+  0x67, 0x85, 0x9A, 0x91, 0x74, 0x66, 0x76, 0x93, 0xA2, 0x9F, 0x9F, 0xB0,
+  0xBD, 0xA7, 0x71, 0x45, 0x42, 0x55, 0x5F, 0x5D, 0x62, 0x7A, 0x96, 0x9C,
+  0x86, 0x6D, 0x6E, 0x88, 0xA0, 0xA4, 0x9F, 0xA7, 0xBB, 0xBA, 0x90, 0x57,
+  0x3E, 0x4C, 0x5C, 0x5E, 0x5C, 0x6A, 0x88, 0x9C, 0x90, 0x73, 0x67, 0x78,
+  0x95, 0xA3, 0xA0, 0xA0, 0xB2, 0xBF, 0xA7, 0x6E, 0x41, 0x40, 0x55, 0x5E,
+  0x5C, 0x64, 0x7C, 0x97, 0x9D, 0x85, 0x6D, 0x74, 0x90, 0xA4, 0xA4, 0xA2,
+  0xB0, 0xBF, 0xAA, 0x71, 0x45, 0x43, 0x56, 0x5C, 0x59, 0x64, 0x80, 0x95,
+  0x8E, 0x73, 0x62, 0x72, 0x8F, 0x9B, 0x99, 0x9F, 0xB3, 0xB9, 0x96, 0x5D,
+  0x42, 0x4E, 0x5D, 0x5C, 0x5C, 0x6E, 0x8C, 0x9A, 0x88, 0x6C, 0x69, 0x82,
+  0x9C, 0xA1, 0x9C, 0xA8, 0xBC, 0xB2, 0x7E, 0x48, 0x3B, 0x4F, 0x5B, 0x58,
+  0x5F, 0x79, 0x94, 0x97, 0x7D, 0x67, 0x73, 0x8F, 0xA1, 0xA1, 0xA1, 0xB0,
+  0xBE, 0xA4, 0x6A, 0x42, 0x47, 0x5A, 0x5F, 0x5D, 0x6B, 0x89, 0x9C, 0x91,
+  0x76, 0x6B, 0x7F, 0x9B, 0xA4, 0xA0, 0xA7, 0xBA, 0xBB, 0x91, 0x58, 0x40,
+  0x4E, 0x5D, 0x5E, 0x5F, 0x73, 0x92, 0x9C, 0x85, 0x6B, 0x6C, 0x87, 0x9F,
+  0xA1, 0x9D, 0xAB, 0xBD, 0xAE, 0x77, 0x44, 0x3E, 0x53, 0x5D, 0x59, 0x62,
+  0x7E, 0x97, 0x96, 0x7B, 0x6A, 0x77, 0x95, 0xA4, 0xA2, 0xA3, 0xB5, 0xBF,
+  0x9E, 0x64, 0x42, 0x4A, 0x5B, 0x5F, 0x5D, 0x6C, 0x8A, 0x9A, 0x8B, 0x6F,
+  0x68, 0x7E, 0x97, 0x9E, 0x9A, 0xA2, 0xB5, 0xB1, 0x82, 0x4C, 0x3C, 0x4E,
+  0x5D, 0x5E, 0x63, 0x7B, 0x98, 0x9B, 0x82, 0x6B, 0x71, 0x8B, 0xA1, 0xA1,
+  0x9F, 0xAE, 0xBE, 0xA9, 0x70, 0x42, 0x40, 0x56, 0x5C, 0x59, 0x65, 0x82,
+  0x99, 0x92, 0x76, 0x67, 0x78, 0x95, 0xA1, 0x9C, 0x9B, 0xAA, 0xB7, 0xAC,
+  0x83, 0x50, 0x3A, 0x47, 0x59, 0x5C, 0x5A, 0x61, 0x75, 0x8F, 0x99, 0x88,
+  0x6F, 0x66, 0x74, 0x8D, 0x9E, 0x9E, 0x9A, 0xA3, 0xB4, 0xB6, 0x98, 0x65,
+  0x40, 0x40, 0x53, 0x5D, 0x5B, 0x5C, 0x6B, 0x85, 0x99, 0x92, 0x78, 0x66,
+  0x6B, 0x82, 0x99, 0xA0, 0x9B, 0x9E, 0xAE, 0xBA, 0xAB, 0x7C, 0x4B, 0x3B,
+  0x4A, 0x5A, 0x5C, 0x5A, 0x63, 0x7B, 0x96, 0x9B, 0x88, 0x72, 0x6C, 0x7C,
+  0x96, 0xA4, 0xA2, 0x9F, 0xAB, 0xBB, 0xB8, 0x96, 0x62, 0x41, 0x45, 0x58,
+  0x5F, 0x5C, 0x5F, 0x6F, 0x89, 0x99, 0x8F, 0x74, 0x63, 0x6B, 0x84, 0x9B,
+  0xA0, 0x9C, 0xA1, 0xB4, 0xBE, 0xAB, 0x7A, 0x4C, 0x40, 0x51, 0x5F, 0x5F,
+  0x5D, 0x67, 0x80, 0x98, 0x99, 0x83, 0x6B, 0x68, 0x7C, 0x97, 0xA2, 0x9F,
+  0x9E, 0xAC, 0xBB, 0xB5, 0x8C, 0x58, 0x3C, 0x45, 0x58, 0x5E, 0x5B, 0x5F,
+  0x72, 0x8E, 0x9B, 0x8E, 0x74, 0x67, 0x73, 0x8C, 0x9F, 0xA1, 0x9D, 0xA5,
+  0xB5, 0xBB, 0xA2, 0x6F, 0x46, 0x42, 0x55, 0x61, 0x5F, 0x5F, 0x6C, 0x86,
+  0x9B, 0x98, 0x81, 0x6D, 0x6D, 0x83, 0x9B, 0xA4, 0x9F, 0xA0, 0xAF, 0xBC,
+  0xB1, 0x85, 0x52, 0x3D, 0x4A, 0x5B, 0x5F, 0x5C, 0x62, 0x78, 0x94, 0x9C,
+  0x8B, 0x73, 0x69, 0x77, 0x92, 0xA2, 0xA1, 0x9E, 0xA7, 0xB8, 0xBC, 0xA2,
+  0x70, 0x48, 0x42, 0x53, 0x62, 0x63, 0x60, 0x67, 0x7D, 0x95, 0x9E, 0x8F,
+  0x76, 0x69, 0x71, 0x88, 0x9C, 0xA1, 0x9A, 0x9B, 0xAA, 0xB7, 0xAD, 0x85,
+  0x52, 0x37, 0x40, 0x55, 0x5E, 0x5D, 0x5F, 0x6E, 0x88, 0x9C, 0x9A, 0x84,
+  0x6E, 0x6A, 0x7A, 0x93, 0xA2, 0xA0, 0x9B, 0xA4, 0xB5, 0xBB, 0xA4, 0x72,
+  0x45, 0x3A, 0x4A, 0x5A, 0x5E, 0x5B, 0x61, 0x76, 0x91, 0x9D, 0x91, 0x78,
+  0x68, 0x70, 0x87, 0x9C, 0xA4, 0xA0, 0x9F, 0xAD, 0xBC, 0xB5, 0x90, 0x5E,
+  0x40, 0x45, 0x58, 0x61, 0x61, 0x61, 0x6D, 0x85, 0x9B, 0x9C, 0x89, 0x72,
+  0x6C, 0x7B, 0x93, 0xA3, 0xA3, 0x9E, 0xA5, 0xB5, 0xBC, 0xA8, 0x7A, 0x4C,
+  0x3E, 0x4C, 0x5C, 0x5F, 0x5C, 0x60, 0x74, 0x8E, 0x9D, 0x93, 0x7A, 0x68,
+  0x6C, 0x83, 0x9A, 0xA4, 0x9F, 0x9E, 0xAB, 0xBB, 0xB7, 0x94, 0x61, 0x41,
+  0x42, 0x55, 0x61, 0x61, 0x5F, 0x6A, 0x83, 0x99, 0x9D, 0x8A, 0x72, 0x6A,
+  0x78, 0x90, 0xA1, 0xA2, 0x9C, 0xA0, 0xB1, 0xBA, 0xA9, 0x7B, 0x4C, 0x3A,
+  0x45, 0x56, 0x5B, 0x57, 0x5B, 0x6F, 0x8A, 0x9C, 0x97, 0x81, 0x6F, 0x71,
+  0x84, 0x9A, 0xA4, 0xA0, 0x9D, 0xA9, 0xB9, 0xB9, 0x9A, 0x66, 0x40, 0x3E,
+  0x50, 0x5D, 0x5E, 0x5C, 0x66, 0x7E, 0x96, 0x9C, 0x8B, 0x71, 0x67, 0x73,
+  0x8B, 0x9E, 0xA3, 0x9D, 0x9D, 0xAA, 0xB9, 0xB9, 0x9B, 0x69, 0x43, 0x3E,
+  0x4E, 0x5D, 0x61, 0x5D, 0x61, 0x72, 0x8C, 0x9C, 0x99, 0x83, 0x6D, 0x69,
+  0x78, 0x90, 0xA1, 0xA3, 0x9D, 0x9F, 0xAE, 0xBB, 0xB3, 0x90, 0x5F, 0x3F,
+  0x3F, 0x50, 0x5D, 0x5F, 0x5C, 0x62, 0x75, 0x8E, 0x9C, 0x94, 0x7C, 0x68,
+  0x67, 0x7A, 0x93, 0xA2, 0xA1, 0x9B, 0xA1, 0xB2, 0xBC, 0xAF, 0x85, 0x54,
+  0x3B, 0x43, 0x56, 0x61, 0x62, 0x61, 0x69, 0x7E, 0x96, 0xA1, 0x93, 0x7A,
+  0x6B, 0x70, 0x85, 0x9B, 0xA5, 0xA1, 0x9D, 0xA5, 0xB5, 0xBC, 0xA8, 0x7A,
+  0x4C, 0x39, 0x43, 0x54, 0x5B, 0x58, 0x59, 0x67, 0x81, 0x96, 0x9C, 0x8F,
+  0x78, 0x6D, 0x74, 0x89, 0x9E, 0xA6, 0xA0, 0x9D, 0xA8, 0xB8, 0xBA, 0xA1,
+  0x71, 0x46, 0x39, 0x47, 0x59, 0x5F, 0x5C, 0x5D, 0x6C, 0x86, 0x9A, 0x9B,
+  0x86, 0x6E, 0x66, 0x73, 0x8B, 0x9E, 0xA2, 0x9C, 0x9C, 0xAB, 0xBA, 0xB6,
+  0x96, 0x65, 0x42, 0x3D, 0x4E, 0x5E, 0x61, 0x5E, 0x62, 0x73, 0x8C, 0x9D,
+  0x98, 0x83, 0x6E, 0x6B, 0x7A, 0x92, 0xA2, 0xA4, 0x9E, 0xA1, 0xB1, 0xBD,
+  0xB4, 0x8F, 0x5E, 0x3F, 0x40, 0x53, 0x60, 0x60, 0x5C, 0x62, 0x77, 0x90,
+  0x9E, 0x95, 0x7C, 0x69, 0x6B, 0x7E, 0x96, 0xA4, 0xA1, 0x9C, 0xA2, 0xB2,
+  0xBD, 0xB0, 0x86, 0x58, 0x3F, 0x3F, 0x52, 0x61, 0x63, 0x60, 0x64, 0x73,
+  0x8C, 0x9F, 0x9F, 0x8E, 0x76, 0x68, 0x71, 0x86, 0x99, 0xA4, 0xA0, 0x99,
+  0xA0, 0xAF, 0xB7, 0xAE, 0x8C, 0x5B, 0x39, 0x34, 0x45, 0x58, 0x5D, 0x5A,
+  0x5D, 0x6B, 0x85, 0x9C, 0x9F, 0x8E, 0x77, 0x67, 0x6C, 0x80, 0x95, 0xA2,
+  0xA1, 0x99, 0x9E, 0xAD, 0xBA, 0xB5, 0x94, 0x62, 0x3F, 0x38, 0x46, 0x59,
+  0x5F, 0x5B, 0x5D, 0x69, 0x7F, 0x97, 0x9E, 0x91, 0x7B, 0x68, 0x6A, 0x7E,
+  0x93, 0xA2, 0xA5, 0x9D, 0x9F, 0xAE, 0xBA, 0xBA, 0xA0, 0x70, 0x48, 0x3D,
+  0x49, 0x5C, 0x63, 0x60, 0x60, 0x69, 0x7D, 0x96, 0xA0, 0x95, 0x81, 0x6D,
+  0x6A, 0x7C, 0x92, 0xA1, 0xA6, 0x9F, 0x9D, 0xAA, 0xB9, 0xBB, 0xA3, 0x73,
+  0x49, 0x39, 0x42, 0x55, 0x60, 0x5D, 0x5C, 0x64, 0x76, 0x8F, 0x9E, 0x97,
+  0x82, 0x6D, 0x67, 0x76, 0x8C, 0x9E, 0xA6, 0x9F, 0x9C, 0xA9, 0xB8, 0xBD,
+  0xAC, 0x81, 0x53, 0x3E, 0x43, 0x56, 0x63, 0x61, 0x5E, 0x63, 0x74, 0x8D,
+  0x9D, 0x98, 0x85, 0x6F, 0x65, 0x70, 0x86, 0x99, 0xA1, 0x9C, 0x96, 0xA0,
+  0xB1, 0xBA, 0xAC, 0x84, 0x58, 0x41, 0x42, 0x53, 0x62, 0x61, 0x5E, 0x62,
+  0x6F, 0x87, 0x9D, 0x9C, 0x89, 0x73, 0x65, 0x6E, 0x84, 0x99, 0xA4, 0xA2,
+  0x9B, 0xA3, 0xB3, 0xBB, 0xB4, 0x93, 0x61, 0x3F, 0x38, 0x43, 0x57, 0x62,
+  0x5D, 0x5C, 0x64, 0x72, 0x8B, 0x9E, 0x9C, 0x8C, 0x77, 0x66, 0x6B, 0x80,
+  0x93, 0xA1, 0xA5, 0x9D, 0x9C, 0xA8, 0xB5, 0xBA, 0xAD, 0x85, 0x57, 0x3E,
+  0x3C, 0x4B, 0x5D, 0x62, 0x5E, 0x5F, 0x67, 0x79, 0x92, 0x9F, 0x98, 0x85,
+  0x70, 0x63, 0x6E, 0x85, 0x97, 0xA3, 0xA3, 0x9B, 0x9E, 0xAD, 0xB8, 0xB9,
+  0xA5, 0x76, 0x4A, 0x38, 0x3D, 0x4F, 0x5F, 0x5F, 0x5D, 0x62, 0x6D, 0x82,
+  0x9B, 0xA3, 0x97, 0x83, 0x6F, 0x69, 0x79, 0x8E, 0x9F, 0xA8, 0xA3, 0x9C,
+  0xA3, 0xB1, 0xBA, 0xB6, 0x99, 0x69, 0x45, 0x39, 0x41, 0x54, 0x5F, 0x5A,
+  0x57, 0x5F, 0x6D, 0x86, 0x9C, 0x9D, 0x8F, 0x7C, 0x6C, 0x6D, 0x80, 0x93,
+  0xA1, 0xA7, 0x9F, 0x9B, 0xA7, 0xB6, 0xBB, 0xB2, 0x8C, 0x5B, 0x3D, 0x39,
+  0x46, 0x59, 0x60, 0x5B, 0x5C, 0x64, 0x76, 0x8F, 0x9F, 0x99, 0x88, 0x72,
+  0x63, 0x6C, 0x82, 0x95, 0xA2, 0xA4, 0x9B, 0x9B, 0xAA, 0xB7, 0xBA, 0xA9,
+  0x7E, 0x51, 0x3C, 0x3E, 0x4E, 0x5F, 0x62, 0x5D, 0x60, 0x6B, 0x7F, 0x97,
+  0x9F, 0x95, 0x84, 0x6F, 0x66, 0x74, 0x8A, 0x9B, 0xA6, 0xA4, 0x9B, 0xA1,
+  0xB0, 0xBB, 0xB9, 0x9D, 0x6E, 0x47, 0x39, 0x40, 0x53, 0x60, 0x5F, 0x5C,
+  0x61, 0x6E, 0x85, 0x9C, 0x9F, 0x91, 0x7D, 0x6A, 0x65, 0x75, 0x8B, 0x9C,
+  0xA7, 0xA6, 0x9E, 0x9F, 0xAC, 0xB9, 0xBC, 0xB2, 0x8D, 0x60, 0x43, 0x3B,
+  0x45, 0x58, 0x63, 0x60, 0x5C, 0x60, 0x6A, 0x7E, 0x95, 0x9E, 0x94, 0x82,
+  0x6E, 0x60, 0x66, 0x7A, 0x8E, 0x9D, 0xA3, 0x9D, 0x98, 0xA3, 0xB4, 0xBB,
+  0xB8, 0x9F, 0x70, 0x49, 0x39, 0x3B, 0x4C, 0x5E, 0x60, 0x5B, 0x5C, 0x64,
+  0x74, 0x8C, 0x9E, 0x9E, 0x8E, 0x79, 0x67, 0x65, 0x75, 0x8B, 0x9B, 0xA5,
+  0xA3, 0x9A, 0x9C, 0xAC, 0xB8, 0xBA, 0xAD, 0x86, 0x58, 0x3F, 0x3A, 0x45,
+  0x5A, 0x63, 0x60, 0x5E, 0x63, 0x6F, 0x84, 0x9A, 0xA2, 0x97, 0x85, 0x71,
+  0x67, 0x71, 0x86, 0x97, 0xA4, 0xA8, 0xA0, 0x9B, 0xA7, 0xB5, 0xBC, 0xB7,
+  0x9B, 0x6C, 0x48, 0x3A, 0x3F, 0x51, 0x61, 0x60, 0x5C, 0x5E, 0x66, 0x78,
+  0x90, 0x9F, 0x9C, 0x8B, 0x77, 0x66, 0x66, 0x79, 0x8E, 0x9D, 0xA6, 0xA3,
+  0x9A, 0x9F, 0xAF, 0xB9, 0xBA, 0xAA, 0x81, 0x55, 0x3E, 0x3C, 0x49, 0x5D,
+  0x64, 0x60, 0x5F, 0x64, 0x70, 0x86, 0x9B, 0xA0, 0x93, 0x7F, 0x6C, 0x64,
+  0x6E, 0x83, 0x95, 0xA0, 0xA2, 0x99, 0x96, 0xA4, 0xB3, 0xB9, 0xB3, 0x95,
+  0x68, 0x47, 0x3D, 0x43, 0x54, 0x62, 0x62, 0x5D, 0x5F, 0x68, 0x7B, 0x93,
+  0xA0, 0x9B, 0x89, 0x75, 0x65, 0x68, 0x7C, 0x91, 0xA0, 0xA6, 0x9F, 0x9A,
+  0xA5, 0xB4, 0xBA, 0xB2, 0x8E, 0x5E, 0x3F, 0x39, 0x45, 0x59, 0x61, 0x5D,
+  0x5D, 0x65, 0x74, 0x8D, 0x9F, 0x9A, 0x89, 0x75, 0x66, 0x6D, 0x83, 0x95,
+  0xA2, 0xA4, 0x9C, 0x9B, 0xAA, 0xB6, 0xBA, 0xAA, 0x81, 0x54, 0x3C, 0x3C,
+  0x4D, 0x5F, 0x61, 0x5D, 0x5F, 0x68, 0x7A, 0x94, 0x9F, 0x95, 0x82, 0x6D,
+  0x63, 0x70, 0x87, 0x99, 0xA4, 0xA2, 0x9A, 0x9F, 0xAE, 0xB9, 0xB8, 0xA1,
+  0x72, 0x49, 0x39, 0x3F, 0x53, 0x62, 0x61, 0x5F, 0x65, 0x71, 0x87, 0x9D,
+  0xA1, 0x94, 0x80, 0x6C, 0x69, 0x7B, 0x90, 0x9F, 0xA6, 0xA0, 0x9A, 0xA4,
+  0xB2, 0xBA, 0xB4, 0x93, 0x63, 0x41, 0x37, 0x40, 0x53, 0x5E, 0x5B, 0x5B,
+  0x63, 0x73, 0x8D, 0xA2, 0xA1, 0x90, 0x7A, 0x68, 0x6B, 0x80, 0x94, 0xA2,
+  0xA6, 0x9E, 0x9B, 0xA9, 0xB6, 0xBB, 0xAE, 0x86, 0x57, 0x3B, 0x38, 0x47,
+  0x5B, 0x60, 0x5B, 0x5C, 0x65, 0x78, 0x91, 0x9E, 0x96, 0x84, 0x6F, 0x63,
+  0x6E, 0x84, 0x97, 0xA3, 0xA3, 0x9B, 0x9D, 0xAC, 0xB8, 0xB9, 0xA4, 0x77,
+  0x4D, 0x3C, 0x3F, 0x50, 0x61, 0x62, 0x5E, 0x62, 0x6D, 0x81, 0x99, 0xA0,
+  0x93, 0x81, 0x6D, 0x67, 0x77, 0x8D, 0x9D, 0xA7, 0xA2, 0x9A, 0xA3, 0xB1,
+  0xB9, 0xB7, 0x99, 0x67, 0x43, 0x38, 0x3F, 0x55, 0x61, 0x5E, 0x5C, 0x62,
+  0x72, 0x8D, 0x9E, 0x9A, 0x87, 0x6F, 0x66, 0x74, 0x8A, 0x9D, 0xA7, 0xA3,
+  0x9E, 0xA7, 0xB6, 0xBD, 0xB0, 0x87, 0x58, 0x40, 0x40, 0x51, 0x60, 0x61,
+  0x5D, 0x61, 0x70, 0x88, 0x9A, 0x99, 0x87, 0x6F, 0x62, 0x6B, 0x81, 0x94,
+  0xA0, 0x9E, 0x98, 0xA0, 0xB1, 0xBB, 0xB3, 0x91, 0x61, 0x40, 0x3C, 0x4D,
+  0x5D, 0x5E, 0x5B, 0x5E, 0x6B, 0x83, 0x99, 0x9C, 0x8C, 0x75, 0x66, 0x6B,
+  0x80, 0x96, 0xA3, 0xA2, 0x9A, 0x9E, 0xAE, 0xBA, 0xB5, 0x94, 0x62, 0x40,
+  0x3A, 0x48, 0x5B, 0x61, 0x5E, 0x5F, 0x6B, 0x81, 0x99, 0x9F, 0x92, 0x7C,
+  0x6A, 0x6C, 0x80, 0x95, 0xA3, 0xA5, 0x9E, 0xA0, 0xAF, 0xBB, 0xBA, 0x9F,
+  0x70, 0x48, 0x3D, 0x49, 0x5C, 0x63, 0x5F, 0x5F, 0x69, 0x7D, 0x95, 0x9E,
+  0x94, 0x7F, 0x6A, 0x67, 0x79, 0x90, 0xA0, 0xA4, 0x9D, 0x9C, 0xAA, 0xB8,
+  0xBA, 0xA2, 0x72, 0x47, 0x38, 0x41, 0x55, 0x60, 0x5D, 0x5E, 0x67, 0x78,
+  0x90, 0xA0, 0x99, 0x84, 0x6F, 0x69, 0x78, 0x8E, 0x9F, 0xA6, 0x9F, 0x9C,
+  0xA8, 0xB7, 0xBB, 0xA9, 0x7D, 0x4F, 0x3A, 0x40, 0x51, 0x5E, 0x5D, 0x59,
+  0x5E, 0x6F, 0x88, 0x9A, 0x97, 0x85, 0x70, 0x67, 0x76, 0x8D, 0x9F, 0xA7,
+  0xA2, 0x9C, 0xA5, 0xB5, 0xBB, 0xAE, 0x84, 0x54, 0x3C, 0x3D, 0x4E, 0x60,
+  0x5A, 0x47, 0x3F, 0x40, 0x42, 0x48, 0x4D, 0x4E, 0x52, 0x59, 0x5F, 0x66,
+  0x6B, 0x6F, 0x75, 0x7C, 0x84, 0x8E, 0x95, 0x9A, 0x9E, 0xA1, 0xA6, 0xAA,
+  0xAB, 0xAE, 0xB0, 0xAD, 0xAD, 0xB0, 0xB0, 0xAE, 0xAD, 0xAB, 0xA7, 0xA3,
+  0xA1, 0x9F, 0x9A, 0x95, 0x92, 0x8C, 0x87, 0x84, 0x7F, 0x78, 0x6F, 0x67,
+  0x61, 0x5D, 0x5B, 0x58, 0x55, 0x51, 0x4D, 0x4D, 0x4E, 0x4D, 0x4B, 0x4A,
+  0x4C, 0x4D, 0x4F, 0x55, 0x5A, 0x5C, 0x5E, 0x63, 0x68, 0x6D, 0x73, 0x78,
+  0x7B, 0x7F, 0x86, 0x8F, 0x96, 0x9B, 0x9E, 0xA0, 0xA4, 0xA7, 0xA7, 0xAA,
+  0xAC, 0xAA, 0xA9, 0xA9, 0xAA, 0xA8, 0xA7, 0xA5, 0xA2, 0x9E, 0x9A, 0x99,
+  0x97, 0x92, 0x8F, 0x8A, 0x85, 0x82, 0x80, 0x7D, 0x78, 0x71, 0x6B, 0x67,
+  0x66, 0x64, 0x60, 0x5E, 0x5B, 0x58, 0x58, 0x5A, 0x5A, 0x57, 0x56, 0x59,
+  0x59, 0x5B, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x71, 0x76, 0x7B, 0x7D, 0x7F,
+  0x83, 0x89, 0x90, 0x96, 0x9A, 0x9C, 0x9D, 0xA0, 0xA2, 0xA2, 0xA4, 0xA5,
+  0xA3, 0xA2, 0xA2, 0xA3, 0xA1, 0xA0, 0x9F, 0x9B, 0x97, 0x94, 0x94, 0x91,
+  0x8D, 0x8B, 0x87, 0x82, 0x80, 0x7D, 0x7A, 0x75, 0x6E, 0x68, 0x65, 0x64,
+  0x63, 0x62, 0x60, 0x5D, 0x5C, 0x5E, 0x5F, 0x5F, 0x5D, 0x5E, 0x60, 0x61,
+  0x64, 0x6A, 0x6D, 0x72, 0x7B, 0x84, 0x8D, 0x9A, 0xA8, 0xB1, 0xB8, 0xBF,
+  0xC1, 0xC2, 0xC1, 0xBE, 0xB7, 0xAE, 0xA6, 0x99, 0x8C, 0x7E, 0x6E, 0x5B,
+  0x4F, 0x43, 0x39, 0x32, 0x2E, 0x29, 0x2C, 0x32, 0x37, 0x40, 0x4C, 0x57,
+  0x65, 0x77, 0x87, 0x93, 0x9F, 0xA8, 0xAE, 0xB4, 0xB8, 0xB9, 0xB5, 0xB3,
+  0xAE, 0xA7, 0x9E, 0x93, 0x84, 0x77, 0x70, 0x67, 0x5F, 0x5D, 0x59, 0x58,
+  0x5E, 0x63, 0x6A, 0x74, 0x7E, 0x89, 0x97, 0xA6, 0xAF, 0xB8, 0xC0, 0xC2,
+  0xC3, 0xC4, 0xC0, 0xBA, 0xB2, 0xA9, 0x9D, 0x91, 0x82, 0x70, 0x60, 0x53,
+  0x48, 0x3D, 0x38, 0x34, 0x2F, 0x32, 0x38, 0x3E, 0x48, 0x53, 0x5E, 0x6C,
+  0x7E, 0x8C, 0x97, 0xA3, 0xAB, 0xAF, 0xB4, 0xB6, 0xB5, 0xB1, 0xAE, 0xA6,
+  0x9D, 0x95, 0x88, 0x7A, 0x6F, 0x66, 0x5D, 0x58, 0x55, 0x51, 0x52, 0x58,
+  0x5D, 0x65, 0x70, 0x7B, 0x85, 0x96, 0xA4, 0xAF, 0xB8, 0xC0, 0xC3, 0xC5,
+  0xC5, 0xC2, 0xBB, 0xB5, 0xAB, 0x9F, 0x94, 0x86, 0x75, 0x64, 0x59, 0x4D,
+  0x44, 0x3E, 0x39, 0x35, 0x39, 0x3E, 0x43, 0x4D, 0x57, 0x61, 0x6F, 0x80,
+  0x8C, 0x98, 0xA1, 0xA8, 0xAB, 0xAF, 0xB1, 0xAD, 0xA9, 0xA5, 0x9D, 0x95,
+  0x8C, 0x7F, 0x71, 0x67, 0x60, 0x58, 0x52, 0x4F, 0x4B, 0x4C, 0x53, 0x59,
+  0x62, 0x6D, 0x78, 0x84, 0x96, 0xAA, 0xB8, 0xC2, 0xC8, 0xC8, 0xC2, 0xB8,
+  0xAA, 0x97, 0x80, 0x6B, 0x5A, 0x4E, 0x46, 0x44, 0x4A, 0x53, 0x60, 0x73,
+  0x88, 0x99, 0xA6, 0xAE, 0xB2, 0xB0, 0xA8, 0x9E, 0x8E, 0x7A, 0x66, 0x54,
+  0x47, 0x3D, 0x39, 0x3C, 0x45, 0x52, 0x63, 0x79, 0x8F, 0xA0, 0xAC, 0xB5,
+  0xB8, 0xB6, 0xAF, 0xA4, 0x95, 0x81, 0x6E, 0x5F, 0x53, 0x4C, 0x4B, 0x51,
+  0x5B, 0x68, 0x7B, 0x91, 0xA5, 0xB3, 0xBD, 0xC3, 0xC4, 0xBD, 0xB3, 0xA6,
+  0x93, 0x7C, 0x68, 0x59, 0x4D, 0x46, 0x47, 0x4E, 0x59, 0x67, 0x7B, 0x90,
+  0xA0, 0xAC, 0xB4, 0xB7, 0xB4, 0xAC, 0xA0, 0x91, 0x7D, 0x67, 0x55, 0x49,
+  0x3F, 0x3B, 0x3F, 0x48, 0x55, 0x65, 0x7A, 0x8F, 0xA0, 0xAB, 0xB2, 0xB4,
+  0xB1, 0xAA, 0x9F, 0x8F, 0x7B, 0x69, 0x5C, 0x51, 0x4A, 0x49, 0x50, 0x5A,
+  0x68, 0x7B, 0x91, 0xA4, 0xB2, 0xBC, 0xC1, 0xC1, 0xBA, 0xB0, 0xA2, 0x8E,
+  0x78, 0x65, 0x56, 0x4B, 0x45, 0x46, 0x4E, 0x59, 0x68, 0x7C, 0x91, 0xA1,
+  0xAD, 0xB4, 0xB6, 0xB3, 0xAB, 0x9F, 0x8F, 0x7A, 0x65, 0x54, 0x48, 0x3F,
+  0x3D, 0x41, 0x4B, 0x58, 0x69, 0x7F, 0x93, 0xA2, 0xAE, 0xB4, 0xB5, 0xB2,
+  0xA9, 0x9C, 0x8B, 0x77, 0x63, 0x56, 0x4C, 0x46, 0x46, 0x4E, 0x59, 0x68,
+  0x7B, 0x91, 0xA4, 0xB1, 0xBA, 0xBF, 0xBD, 0xB5, 0xA5, 0x8C, 0x72, 0x5D,
+  0x4D, 0x48, 0x4E, 0x5C, 0x73, 0x8E, 0xA5, 0xB3, 0xBA, 0xB7, 0xAD, 0x9A,
+  0x81, 0x68, 0x54, 0x48, 0x45, 0x4E, 0x5D, 0x76, 0x8F, 0xA3, 0xB0, 0xB4,
+  0xAF, 0xA2, 0x8D, 0x73, 0x5B, 0x49, 0x40, 0x41, 0x4B, 0x5E, 0x78, 0x92,
+  0xA4, 0xAF, 0xB2, 0xAB, 0x9F, 0x89, 0x6E, 0x5A, 0x4C, 0x47, 0x4C, 0x59,
+  0x6D, 0x88, 0xA0, 0xB0, 0xB9, 0xB9, 0xAF, 0x9F, 0x87, 0x6C, 0x58, 0x4A,
+  0x47, 0x4D, 0x5D, 0x74, 0x8F, 0xA5, 0xB3, 0xBA, 0xB6, 0xAB, 0x96, 0x7C,
+  0x63, 0x51, 0x45, 0x45, 0x4E, 0x5F, 0x79, 0x93, 0xA5, 0xB2, 0xB5, 0xB0,
+  0xA2, 0x8D, 0x72, 0x5C, 0x4B, 0x43, 0x46, 0x52, 0x66, 0x80, 0x99, 0xAA,
+  0xB5, 0xB6, 0xAF, 0x9F, 0x87, 0x6E, 0x59, 0x4C, 0x46, 0x4D, 0x5A, 0x70,
+  0x8C, 0xA2, 0xB2, 0xBA, 0xB8, 0xAE, 0x9C, 0x83, 0x69, 0x56, 0x48, 0x47,
+  0x4F, 0x60, 0x78, 0x92, 0xA8, 0xB5, 0xBA, 0xB6, 0xA9, 0x95, 0x79, 0x62,
+  0x51, 0x46, 0x47, 0x52, 0x65, 0x7E, 0x97, 0xAA, 0xB4, 0xB6, 0xB0, 0xA1,
+  0x8A, 0x70, 0x59, 0x4A, 0x42, 0x47, 0x53, 0x68, 0x82, 0x9A, 0xAA, 0xB3,
+  0xB2, 0xAA, 0x99, 0x80, 0x65, 0x51, 0x45, 0x42, 0x4B, 0x5A, 0x73, 0x8F,
+  0xA6, 0xB4, 0xBA, 0xB7, 0xAC, 0x99, 0x7F, 0x66, 0x54, 0x49, 0x4B, 0x5D,
+  0x79, 0x97, 0xAE, 0xB8, 0xB4, 0xA3, 0x87, 0x68, 0x51, 0x47, 0x4D, 0x61,
+  0x7F, 0x9C, 0xAF, 0xB5, 0xAF, 0x9B, 0x7D, 0x60, 0x4D, 0x46, 0x4F, 0x66,
+  0x84, 0xA0, 0xB0, 0xB3, 0xAA, 0x94, 0x75, 0x5A, 0x49, 0x46, 0x52, 0x6B,
+  0x8A, 0xA3, 0xB1, 0xB2, 0xA6, 0x8D, 0x6F, 0x56, 0x48, 0x49, 0x59, 0x74,
+  0x92, 0xA9, 0xB4, 0xB3, 0xA3, 0x88, 0x6A, 0x52, 0x47, 0x4B, 0x5E, 0x7B,
+  0x99, 0xAE, 0xB6, 0xB1, 0x9F, 0x82, 0x63, 0x4E, 0x47, 0x4E, 0x64, 0x83,
+  0x9F, 0xB1, 0xB7, 0xAF, 0x99, 0x7C, 0x60, 0x4E, 0x4A, 0x54, 0x6C, 0x8A,
+  0xA5, 0xB3, 0xB5, 0xAB, 0x93, 0x74, 0x59, 0x4A, 0x49, 0x56, 0x70, 0x8E,
+  0xA6, 0xB2, 0xB1, 0xA3, 0x89, 0x6A, 0x50, 0x44, 0x47, 0x5A, 0x77, 0x96,
+  0xAC, 0xB6, 0xB4, 0xA3, 0x87, 0x68, 0x51, 0x49, 0x4F, 0x62, 0x7F, 0x9D,
+  0xB1, 0xB7, 0xB0, 0x9C, 0x7E, 0x61, 0x4D, 0x47, 0x50, 0x67, 0x86, 0xA1,
+  0xB2, 0xB6, 0xAC, 0x94, 0x76, 0x5A, 0x49, 0x46, 0x53, 0x6C, 0x8B, 0xA5,
+  0xB2, 0xB3, 0xA6, 0x8D, 0x6F, 0x55, 0x48, 0x49, 0x59, 0x74, 0x92, 0xA9,
+  0xB4, 0xB1, 0xA2, 0x87, 0x69, 0x52, 0x48, 0x4C, 0x5F, 0x7C, 0x9A, 0xAD,
+  0xB5, 0xB1, 0x9E, 0x82, 0x64, 0x4F, 0x49, 0x50, 0x65, 0x83, 0xA1, 0xB2,
+  0xB3, 0xA4, 0x83, 0x61, 0x4D, 0x4C, 0x60, 0x82, 0xA2, 0xB3, 0xB2, 0x9E,
+  0x7D, 0x5D, 0x4D, 0x4E, 0x65, 0x89, 0xA6, 0xB4, 0xAF, 0x99, 0x76, 0x59,
+  0x4D, 0x53, 0x6D, 0x8F, 0xAA, 0xB4, 0xAC, 0x92, 0x6E, 0x53, 0x49, 0x54,
+  0x71, 0x92, 0xAA, 0xB0, 0xA5, 0x88, 0x66, 0x4C, 0x45, 0x53, 0x74, 0x96,
+  0xAD, 0xB1, 0xA1, 0x84, 0x64, 0x50, 0x4D, 0x5F, 0x7F, 0x9E, 0xB1, 0xB1,
+  0x9F, 0x7D, 0x5D, 0x4B, 0x4C, 0x63, 0x85, 0xA4, 0xB2, 0xB0, 0x99, 0x77,
+  0x58, 0x49, 0x4E, 0x68, 0x8B, 0xA7, 0xB3, 0xAC, 0x94, 0x71, 0x54, 0x4A,
+  0x53, 0x6F, 0x92, 0xAC, 0xB4, 0xA9, 0x8E, 0x6B, 0x51, 0x4B, 0x58, 0x77,
+  0x98, 0xAF, 0xB3, 0xA6, 0x87, 0x66, 0x51, 0x4D, 0x5D, 0x7E, 0x9E, 0xB1,
+  0xB2, 0xA1, 0x81, 0x61, 0x4E, 0x4E, 0x63, 0x84, 0xA3, 0xB2, 0xB1, 0x9C,
+  0x79, 0x5A, 0x4B, 0x4F, 0x68, 0x8A, 0xA7, 0xB3, 0xAE, 0x95, 0x73, 0x55,
+  0x48, 0x51, 0x6C, 0x90, 0xAA, 0xB4, 0xAA, 0x90, 0x6D, 0x53, 0x4A, 0x57,
+  0x74, 0x97, 0xAD, 0xB4, 0xA7, 0x8A, 0x67, 0x50, 0x4B, 0x5B, 0x7A, 0x9B,
+  0xAF, 0xB1, 0xA1, 0x81, 0x60, 0x4C, 0x4A, 0x5D, 0x7E, 0x9E, 0xAF, 0xAD,
+  0x9A, 0x79, 0x5A, 0x4A, 0x4D, 0x66, 0x8A, 0xA7, 0xB6, 0xB1, 0x98, 0x76,
+  0x58, 0x4B, 0x58, 0x7A, 0x9E, 0xB1, 0xAB, 0x8D, 0x67, 0x4E, 0x50, 0x6B,
+  0x91, 0xAD, 0xB1, 0x9C, 0x77, 0x55, 0x4B, 0x5D, 0x81, 0xA3, 0xB2, 0xA7,
+  0x86, 0x61, 0x4C, 0x53, 0x71, 0x97, 0xAE, 0xAD, 0x95, 0x70, 0x53, 0x4D,
+  0x63, 0x88, 0xA7, 0xB1, 0xA1, 0x7F, 0x5C, 0x4B, 0x57, 0x78, 0x9C, 0xB0,
+  0xAA, 0x8E, 0x69, 0x4F, 0x4F, 0x69, 0x8E, 0xAA, 0xB0, 0x9C, 0x78, 0x57,
+  0x4B, 0x5B, 0x7E, 0xA0, 0xB0, 0xA7, 0x87, 0x62, 0x4B, 0x50, 0x6E, 0x94,
+  0xAD, 0xAE, 0x97, 0x71, 0x52, 0x4B, 0x60, 0x86, 0xA7, 0xB2, 0xA4, 0x83,
+  0x60, 0x4E, 0x59, 0x79, 0x9D, 0xB2, 0xAE, 0x93, 0x6E, 0x53, 0x51, 0x6A,
+  0x8E, 0xAB, 0xB2, 0x9F, 0x7B, 0x59, 0x4C, 0x5B, 0x7D, 0x9F, 0xB0, 0xA7,
+  0x88, 0x62, 0x4A, 0x4E, 0x6C, 0x92, 0xAD, 0xAF, 0x99, 0x76, 0x58, 0x4F,
+  0x61, 0x85, 0xA5, 0xB2, 0xA5, 0x84, 0x60, 0x4C, 0x54, 0x74, 0x99, 0xAF,
+  0xAD, 0x93, 0x6D, 0x4F, 0x4C, 0x64, 0x8A, 0xA9, 0xB1, 0x9F, 0x7C, 0x59,
+  0x4A, 0x58, 0x7A, 0x9D, 0xB0, 0xA9, 0x8B, 0x66, 0x4E, 0x50, 0x6B, 0x91,
+  0xAC, 0xB0, 0x9A, 0x76, 0x56, 0x4C, 0x5E, 0x82, 0xA3, 0xB1, 0xA6, 0x86,
+  0x62, 0x4D, 0x54, 0x73, 0x98, 0xAF, 0xAE, 0x95, 0x70, 0x53, 0x4E, 0x64,
+  0x8A, 0xA9, 0xB2, 0xA0, 0x79, 0x56, 0x50, 0x6C, 0x94, 0xAD, 0xA8, 0x87,
+  0x5F, 0x4E, 0x5F, 0x86, 0xA8, 0xAE, 0x95, 0x6D, 0x51, 0x56, 0x77, 0x9E,
+  0xB0, 0xA2, 0x7C, 0x58, 0x51, 0x6B, 0x93, 0xAD, 0xAB, 0x8C, 0x64, 0x50,
+  0x5E, 0x84, 0xA6, 0xAE, 0x97, 0x6F, 0x52, 0x53, 0x72, 0x99, 0xAC, 0xA0,
+  0x7B, 0x57, 0x4C, 0x62, 0x8A, 0xA7, 0xA7, 0x8A, 0x63, 0x4D, 0x59, 0x7F,
+  0xA4, 0xB0, 0x9B, 0x73, 0x53, 0x52, 0x70, 0x97, 0xAD, 0xA4, 0x81, 0x5B,
+  0x4D, 0x62, 0x8A, 0xA9, 0xAB, 0x8F, 0x67, 0x4E, 0x57, 0x7B, 0xA1, 0xAF,
+  0x9C, 0x75, 0x54, 0x50, 0x6D, 0x96, 0xAE, 0xA7, 0x85, 0x5F, 0x4F, 0x61,
+  0x88, 0xA9, 0xAD, 0x93, 0x6C, 0x51, 0x58, 0x7A, 0xA0, 0xB0, 0xA0, 0x7A,
+  0x58, 0x52, 0x6C, 0x94, 0xAE, 0xA9, 0x8A, 0x63, 0x50, 0x60, 0x86, 0xA7,
+  0xAF, 0x97, 0x6F, 0x52, 0x56, 0x76, 0x9D, 0xB0, 0xA2, 0x7D, 0x58, 0x4E,
+  0x67, 0x90, 0xAC, 0xAA, 0x8B, 0x62, 0x4D, 0x5B, 0x81, 0xA5, 0xAE, 0x98,
+  0x71, 0x52, 0x53, 0x72, 0x9A, 0xAF, 0xA4, 0x81, 0x5C, 0x50, 0x66, 0x8E,
+  0xAB, 0xAB, 0x8E, 0x67, 0x50, 0x5A, 0x7E, 0xA2, 0xAE, 0x9B, 0x73, 0x53,
+  0x51, 0x6E, 0x95, 0xAC, 0xA3, 0x81, 0x5A, 0x4A, 0x5E, 0x87, 0xA8, 0xAC,
+  0x91, 0x6A, 0x52, 0x5A, 0x7E, 0xA3, 0xAD, 0x93, 0x69, 0x51, 0x64, 0x8E,
+  0xAB, 0xA4, 0x7F, 0x58, 0x54, 0x76, 0x9E, 0xAD, 0x96, 0x6B, 0x50, 0x60,
+  0x89, 0xA9, 0xA6, 0x82, 0x5A, 0x53, 0x72, 0x9B, 0xAC, 0x98, 0x6D, 0x51,
+  0x5D, 0x86, 0xA8, 0xA7, 0x85, 0x5E, 0x52, 0x6E, 0x99, 0xAD, 0x9A, 0x71,
+  0x53, 0x5B, 0x81, 0xA5, 0xA8, 0x89, 0x60, 0x52, 0x6B, 0x95, 0xAC, 0x9D,
+  0x75, 0x55, 0x59, 0x7E, 0xA3, 0xAA, 0x8C, 0x62, 0x50, 0x68, 0x91, 0xAB,
+  0x9F, 0x77, 0x53, 0x55, 0x79, 0xA1, 0xAA, 0x90, 0x65, 0x4F, 0x63, 0x8E,
+  0xAA, 0xA2, 0x7C, 0x57, 0x55, 0x77, 0xA0, 0xAD, 0x94, 0x6B, 0x54, 0x64,
+  0x8D, 0xAC, 0xA6, 0x82, 0x5C, 0x56, 0x75, 0x9E, 0xAE, 0x97, 0x6D, 0x53,
+  0x60, 0x88, 0xA9, 0xA7, 0x83, 0x5B, 0x52, 0x6F, 0x98, 0xAB, 0x98, 0x6D,
+  0x51, 0x5C, 0x84, 0xA7, 0xA9, 0x8A, 0x62, 0x54, 0x6F, 0x98, 0xAE, 0x9D,
+  0x74, 0x53, 0x5A, 0x81, 0xA5, 0xA9, 0x8B, 0x61, 0x4F, 0x69, 0x94, 0xAB,
+  0x9E, 0x76, 0x53, 0x56, 0x7C, 0xA2, 0xAA, 0x8D, 0x63, 0x4F, 0x65, 0x8F,
+  0xAB, 0xA0, 0x79, 0x56, 0x55, 0x78, 0xA0, 0xAB, 0x91, 0x67, 0x51, 0x63,
+  0x8D, 0xAA, 0xA4, 0x7E, 0x59, 0x55, 0x76, 0x9F, 0xAD, 0x95, 0x6B, 0x52,
+  0x61, 0x8A, 0xAA, 0xA6, 0x83, 0x5C, 0x54, 0x75, 0x9F, 0xAA, 0x89, 0x5F,
+  0x57, 0x79, 0xA2, 0xA8, 0x84, 0x5B, 0x58, 0x7E, 0xA5, 0xA5, 0x7F, 0x58,
+  0x5A, 0x84, 0xA8, 0xA2, 0x7A, 0x57, 0x5E, 0x89, 0xA9, 0xA0, 0x75, 0x56,
+  0x64, 0x8F, 0xAC, 0x9D, 0x71, 0x56, 0x68, 0x94, 0xAC, 0x98, 0x6C, 0x54,
+  0x6A, 0x96, 0xA9, 0x92, 0x65, 0x52, 0x6E, 0x98, 0xA7, 0x8B, 0x5E, 0x50,
+  0x70, 0x9A, 0xA5, 0x86, 0x5D, 0x55, 0x79, 0xA2, 0xA8, 0x84, 0x5C, 0x59,
+  0x7E, 0xA4, 0xA4, 0x7D, 0x57, 0x59, 0x82, 0xA6, 0xA0, 0x78, 0x55, 0x5D,
+  0x88, 0xA7, 0x9D, 0x73, 0x53, 0x61, 0x8D, 0xAA, 0x9A, 0x6D, 0x52, 0x66,
+  0x92, 0xAB, 0x97, 0x69, 0x53, 0x6B, 0x98, 0xAB, 0x92, 0x66, 0x55, 0x70,
+  0x9C, 0xAB, 0x8E, 0x63, 0x56, 0x76, 0xA0, 0xA9, 0x8A, 0x60, 0x58, 0x7C,
+  0xA3, 0xA8, 0x84, 0x5D, 0x5A, 0x81, 0xA6, 0xA6, 0x7E, 0x58, 0x5D, 0x85,
+  0xA7, 0xA2, 0x79, 0x56, 0x5E, 0x89, 0xA9, 0x9D, 0x73, 0x53, 0x62, 0x8E,
+  0xA9, 0x9A, 0x6D, 0x52, 0x66, 0x92, 0xAA, 0x96, 0x69, 0x53, 0x6B, 0x98,
+  0xAB, 0x91, 0x65, 0x55, 0x71, 0x9C, 0xAA, 0x8D, 0x62, 0x56, 0x76, 0xA0,
+  0xA8, 0x87, 0x5E, 0x57, 0x7A, 0xA2, 0xA5, 0x81, 0x5A, 0x58, 0x7E, 0xA2,
+  0xA2, 0x7A, 0x54, 0x57, 0x82, 0xA5, 0xA0, 0x77, 0x56, 0x62, 0x91, 0xAB,
+  0x91, 0x64, 0x5A, 0x7F, 0xA6, 0x9E, 0x72, 0x57, 0x6E, 0x9C, 0xA7, 0x82,
+  0x59, 0x60, 0x8D, 0xA9, 0x92, 0x64, 0x57, 0x7C, 0xA4, 0x9F, 0x73, 0x55,
+  0x6B, 0x99, 0xA7, 0x84, 0x5C, 0x5F, 0x8A, 0xA8, 0x94, 0x66, 0x57, 0x79,
+  0xA3, 0xA1, 0x76, 0x57, 0x69, 0x96, 0xA7, 0x86, 0x5D, 0x5D, 0x86, 0xA7,
+  0x96, 0x68, 0x57, 0x76, 0xA1, 0xA2, 0x79, 0x57, 0x67, 0x95, 0xA8, 0x89,
+  0x5E, 0x5B, 0x84, 0xA6, 0x98, 0x6B, 0x56, 0x72, 0x9E, 0xA3, 0x7A, 0x55,
+  0x63, 0x91, 0xA8, 0x8B, 0x5F, 0x59, 0x81, 0xA6, 0x9A, 0x6D, 0x55, 0x71,
+  0x9D, 0xA5, 0x7F, 0x5B, 0x65, 0x92, 0xAB, 0x91, 0x64, 0x5B, 0x81, 0xA7,
+  0x9F, 0x72, 0x58, 0x70, 0x9D, 0xA7, 0x82, 0x5C, 0x62, 0x8D, 0xA8, 0x91,
+  0x64, 0x58, 0x7B, 0xA3, 0x9D, 0x70, 0x53, 0x69, 0x98, 0xA6, 0x83, 0x5C,
+  0x61, 0x8D, 0xAB, 0x96, 0x68, 0x59, 0x7B, 0xA3, 0xA0, 0x76, 0x56, 0x69,
+  0x97, 0xA8, 0x86, 0x5C, 0x5D, 0x87, 0xA7, 0x95, 0x67, 0x55, 0x75, 0xA0,
+  0xA1, 0x77, 0x56, 0x66, 0x94, 0xA7, 0x88, 0x5D, 0x5A, 0x83, 0xA6, 0x98,
+  0x6A, 0x56, 0x74, 0x9F, 0xA3, 0x7B, 0x58, 0x66, 0x92, 0xA7, 0x8B, 0x61,
+  0x5B, 0x83, 0xA7, 0x9B, 0x6F, 0x57, 0x72, 0x9E, 0xA4, 0x7D, 0x5B, 0x55,
+  0x56, 0x54, 0x55, 0x57, 0x57, 0x59, 0x5B, 0x5B, 0x5D, 0x5E, 0x5E, 0x60,
+  0x61, 0x61, 0x62, 0x63, 0x63, 0x65, 0x64, 0x64, 0x65, 0x66, 0x66, 0x67,
+  0x66, 0x67, 0x68, 0x68, 0x67, 0x68, 0x67, 0x68, 0x68, 0x69, 0x68, 0x69,
+  0x68, 0x69, 0x69, 0x6A, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C,
+  0x6D, 0x6D, 0x6E, 0x6E, 0x70, 0x70, 0x71, 0x71, 0x73, 0x74, 0x74, 0x75,
+  0x75, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D,
+  0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F,
+  0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x7F,
+  0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83,
+  0x83, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x87, 0x86,
+  0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87,
+  0x86, 0x86, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x83,
+  0x84, 0x84, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x83,
+  0x82, 0x82, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84,
+  0x84, 0x88, 0x91, 0x98, 0x9C, 0xA3, 0xAB, 0xB4, 0xBB, 0xC0, 0xC2, 0xC6,
+  0xCA, 0xCD, 0xCF, 0xD3, 0xD4, 0xD3, 0xD2, 0xD3, 0xD4, 0xD3, 0xD1, 0xD0,
+  0xCB, 0xC6, 0xC4, 0xC1, 0xBD, 0xB7, 0xB3, 0xAD, 0xA7, 0xA2, 0x9D, 0x97,
+  0x8F, 0x86, 0x7D, 0x78, 0x75, 0x71, 0x6D, 0x6A, 0x66, 0x62, 0x61, 0x62,
+  0x60, 0x5C, 0x5C, 0x5D, 0x5C, 0x5F, 0x64, 0x68, 0x68, 0x6A, 0x6F, 0x73,
+  0x78, 0x7D, 0x7F, 0x82, 0x87, 0x8E, 0x95, 0x9B, 0x9F, 0xA2, 0xA4, 0xA8,
+  0xAA, 0xAB, 0xAE, 0xAF, 0xAD, 0xAD, 0xAE, 0xAF, 0xAD, 0xAD, 0xAC, 0xA7,
+  0xA3, 0xA2, 0xA1, 0x9C, 0x98, 0x96, 0x91, 0x8D, 0x8A, 0x86, 0x82, 0x7C,
+  0x74, 0x6E, 0x6B, 0x69, 0x67, 0x64, 0x61, 0x5E, 0x5C, 0x5D, 0x5E, 0x5C,
+  0x59, 0x5A, 0x5B, 0x5B, 0x5E, 0x63, 0x66, 0x66, 0x67, 0x6B, 0x6F, 0x73,
+  0x76, 0x78, 0x7B, 0x80, 0x87, 0x8E, 0x94, 0x99, 0x9B, 0x9D, 0xA0, 0xA0,
+  0xA1, 0xA3, 0xA2, 0xA0, 0x9F, 0xA1, 0xA0, 0x9F, 0x9D, 0x9C, 0x97, 0x94,
+  0x93, 0x91, 0x8E, 0x8A, 0x88, 0x84, 0x7F, 0x7D, 0x7A, 0x76, 0x70, 0x68,
+  0x63, 0x60, 0x60, 0x5E, 0x5C, 0x5B, 0x59, 0x59, 0x5A, 0x5D, 0x5C, 0x5A,
+  0x5C, 0x5D, 0x5E, 0x63, 0x68, 0x6B, 0x6C, 0x6E, 0x72, 0x76, 0x7B, 0x7D,
+  0x80, 0x81, 0x85, 0x8C, 0x96, 0x9D, 0xA3, 0xAA, 0xAC, 0xAC, 0xAD, 0xAA,
+  0xA4, 0x9C, 0x95, 0x89, 0x7E, 0x72, 0x61, 0x51, 0x44, 0x3A, 0x32, 0x2D,
+  0x2A, 0x27, 0x2B, 0x32, 0x3A, 0x46, 0x53, 0x60, 0x70, 0x83, 0x95, 0xA2,
+  0xAE, 0xB9, 0xBF, 0xC5, 0xCA, 0xC9, 0xC6, 0xC2, 0xBC, 0xB3, 0xA9, 0x9E,
+  0x8D, 0x80, 0x75, 0x6A, 0x61, 0x5D, 0x57, 0x54, 0x58, 0x5B, 0x60, 0x68,
+  0x70, 0x79, 0x85, 0x93, 0x9C, 0xA4, 0xAC, 0xAF, 0xB1, 0xB2, 0xAF, 0xA9,
+  0xA3, 0x9A, 0x8E, 0x81, 0x75, 0x65, 0x53, 0x48, 0x3D, 0x34, 0x2E, 0x2B,
+  0x28, 0x2B, 0x32, 0x39, 0x44, 0x50, 0x5C, 0x6B, 0x7F, 0x8E, 0x9B, 0xA6,
+  0xB0, 0xB6, 0xBB, 0xBF, 0xBD, 0xBA, 0xB5, 0xAF, 0xA5, 0x9D, 0x90, 0x81,
+  0x74, 0x6C, 0x62, 0x5A, 0x58, 0x54, 0x52, 0x57, 0x5C, 0x62, 0x6C, 0x75,
+  0x7F, 0x8D, 0x9B, 0xA5, 0xAD, 0xB4, 0xB7, 0xB9, 0xBA, 0xB6, 0xAF, 0xA9,
+  0xA0, 0x95, 0x88, 0x7C, 0x6A, 0x5A, 0x4E, 0x44, 0x3A, 0x34, 0x30, 0x2C,
+  0x30, 0x36, 0x3D, 0x47, 0x52, 0x5E, 0x6D, 0x80, 0x8E, 0x99, 0xA5, 0xAC,
+  0xB1, 0xB7, 0xB9, 0xB7, 0xB3, 0xAF, 0xA7, 0x9E, 0x95, 0x88, 0x79, 0x6C,
+  0x64, 0x5B, 0x54, 0x51, 0x4D, 0x4D, 0x53, 0x58, 0x5F, 0x69, 0x73, 0x7D,
+  0x8D, 0x9A, 0xA4, 0xAC, 0xB3, 0xB7, 0xB9, 0xB9, 0xB3, 0xA9, 0x9C, 0x89,
+  0x74, 0x60, 0x51, 0x44, 0x3C, 0x39, 0x3F, 0x49, 0x56, 0x69, 0x7F, 0x90,
+  0x9E, 0xA7, 0xAC, 0xAC, 0xA6, 0x9C, 0x8D, 0x7B, 0x66, 0x54, 0x48, 0x3F,
+  0x3B, 0x3F, 0x49, 0x56, 0x68, 0x7E, 0x94, 0xA6, 0xB3, 0xBB, 0xBF, 0xBD,
+  0xB6, 0xAA, 0x9B, 0x87, 0x72, 0x62, 0x57, 0x4E, 0x4C, 0x50, 0x5A, 0x67,
+  0x78, 0x8E, 0xA0, 0xAE, 0xB8, 0xBC, 0xBB, 0xB6, 0xAB, 0x9D, 0x8A, 0x74,
+  0x60, 0x50, 0x44, 0x3D, 0x3D, 0x44, 0x4D, 0x5B, 0x6F, 0x84, 0x95, 0xA2,
+  0xAA, 0xAE, 0xAC, 0xA6, 0x9B, 0x8C, 0x79, 0x64, 0x52, 0x46, 0x3D, 0x3A,
+  0x3E, 0x49, 0x56, 0x68, 0x7F, 0x95, 0xA5, 0xB2, 0xBB, 0xBD, 0xBA, 0xB2,
+  0xA7, 0x97, 0x82, 0x6E, 0x5F, 0x54, 0x4D, 0x4B, 0x51, 0x5B, 0x69, 0x7B,
+  0x90, 0xA2, 0xB0, 0xB8, 0xBD, 0xBC, 0xB5, 0xAB, 0x9C, 0x87, 0x71, 0x5F,
+  0x51, 0x47, 0x41, 0x43, 0x4B, 0x56, 0x65, 0x78, 0x8B, 0x9C, 0xA8, 0xB0,
+  0xB3, 0xB0, 0xA8, 0x9C, 0x8D, 0x78, 0x63, 0x53, 0x46, 0x3C, 0x3B, 0x3F,
+  0x49, 0x57, 0x69, 0x7F, 0x94, 0xA4, 0xAF, 0xB7, 0xB9, 0xB5, 0xAC, 0xA0,
+  0x8F, 0x7A, 0x67, 0x58, 0x4D, 0x47, 0x47, 0x4F, 0x5A, 0x68, 0x7C, 0x91,
+  0xA3, 0xB0, 0xB9, 0xBE, 0xBD, 0xB5, 0xAB, 0x9C, 0x86, 0x6D, 0x58, 0x4A,
+  0x45, 0x4A, 0x59, 0x6F, 0x88, 0x9E, 0xAE, 0xB4, 0xB1, 0xA7, 0x94, 0x7B,
+  0x61, 0x4D, 0x40, 0x3F, 0x47, 0x58, 0x70, 0x8B, 0xA1, 0xAF, 0xB3, 0xAF,
+  0xA3, 0x8E, 0x74, 0x5C, 0x4C, 0x42, 0x45, 0x51, 0x65, 0x7E, 0x98, 0xAC,
+  0xB7, 0xB9, 0xB3, 0xA5, 0x8F, 0x74, 0x5F, 0x4F, 0x49, 0x4D, 0x5B, 0x6F,
+  0x88, 0xA0, 0xAF, 0xB7, 0xB7, 0xAD, 0x9C, 0x82, 0x69, 0x53, 0x45, 0x40,
+  0x48, 0x57, 0x70, 0x8B, 0xA0, 0xB0, 0xB6, 0xB3, 0xA7, 0x94, 0x78, 0x60,
+  0x4D, 0x41, 0x41, 0x4A, 0x5B, 0x75, 0x8F, 0xA3, 0xAF, 0xB3, 0xAE, 0xA0,
+  0x8A, 0x70, 0x59, 0x49, 0x40, 0x44, 0x50, 0x65, 0x80, 0x9A, 0xAC, 0xB6,
+  0xB8, 0xB0, 0xA0, 0x89, 0x6F, 0x5B, 0x4B, 0x46, 0x4E, 0x5C, 0x72, 0x8D,
+  0xA4, 0xB3, 0xBB, 0xB9, 0xAF, 0x9D, 0x84, 0x6B, 0x57, 0x4B, 0x48, 0x51,
+  0x61, 0x79, 0x92, 0xA6, 0xB4, 0xB8, 0xB4, 0xA7, 0x92, 0x78, 0x60, 0x4E,
+  0x43, 0x45, 0x4F, 0x61, 0x7B, 0x94, 0xA7, 0xB2, 0xB5, 0xAE, 0x9F, 0x88,
+  0x6E, 0x57, 0x48, 0x41, 0x45, 0x53, 0x68, 0x84, 0x9B, 0xAD, 0xB7, 0xB6,
+  0xAE, 0x9D, 0x85, 0x6C, 0x58, 0x4B, 0x47, 0x4E, 0x5E, 0x75, 0x8F, 0xA5,
+  0xB3, 0xBA, 0xB6, 0xAC, 0x98, 0x7E, 0x64, 0x52, 0x47, 0x45, 0x51, 0x68,
+  0x86, 0xA0, 0xB0, 0xB4, 0xAB, 0x93, 0x75, 0x5B, 0x4C, 0x4A, 0x58, 0x70,
+  0x8E, 0xA7, 0xB3, 0xB3, 0xA6, 0x8C, 0x6D, 0x54, 0x46, 0x47, 0x58, 0x74,
+  0x92, 0xA9, 0xB4, 0xB1, 0xA1, 0x85, 0x66, 0x4F, 0x45, 0x4A, 0x5E, 0x7C,
+  0x9A, 0xAE, 0xB5, 0xB0, 0x9D, 0x80, 0x63, 0x4F, 0x49, 0x51, 0x67, 0x85,
+  0xA1, 0xB2, 0xB6, 0xAE, 0x98, 0x7A, 0x5E, 0x4D, 0x49, 0x54, 0x6D, 0x8C,
+  0xA5, 0xB4, 0xB5, 0xA9, 0x90, 0x72, 0x58, 0x4A, 0x49, 0x57, 0x72, 0x90,
+  0xA8, 0xB3, 0xB2, 0xA3, 0x88, 0x69, 0x50, 0x45, 0x48, 0x5A, 0x77, 0x95,
+  0xAA, 0xB3, 0xAF, 0x9E, 0x81, 0x63, 0x4D, 0x45, 0x4C, 0x61, 0x80, 0x9D,
+  0xAF, 0xB6, 0xB0, 0x9B, 0x7E, 0x62, 0x50, 0x4B, 0x55, 0x6C, 0x8A, 0xA5,
+  0xB4, 0xB7, 0xAD, 0x96, 0x77, 0x5D, 0x4C, 0x4A, 0x57, 0x71, 0x8F, 0xA7,
+  0xB4, 0xB4, 0xA6, 0x8B, 0x6C, 0x53, 0x47, 0x49, 0x5B, 0x77, 0x95, 0xAD,
+  0xB7, 0xB4, 0xA3, 0x87, 0x68, 0x51, 0x47, 0x4C, 0x5F, 0x7C, 0x9A, 0xAD,
+  0xB5, 0xAF, 0x9B, 0x7D, 0x60, 0x4B, 0x44, 0x4D, 0x64, 0x83, 0x9F, 0xB0,
+  0xB4, 0xAC, 0x95, 0x77, 0x5A, 0x49, 0x47, 0x52, 0x6B, 0x8B, 0xA5, 0xB2,
+  0xB4, 0xA9, 0x90, 0x72, 0x58, 0x4A, 0x4B, 0x5A, 0x75, 0x93, 0xAA, 0xB5,
+  0xB4, 0xA0, 0x7F, 0x5F, 0x4D, 0x4E, 0x64, 0x86, 0xA4, 0xB3, 0xB0, 0x9B,
+  0x78, 0x5A, 0x4B, 0x51, 0x6A, 0x8C, 0xA8, 0xB2, 0xAB, 0x93, 0x70, 0x54,
+  0x48, 0x51, 0x6E, 0x91, 0xAB, 0xB3, 0xA8, 0x8D, 0x69, 0x4F, 0x49, 0x57,
+  0x75, 0x98, 0xAE, 0xB3, 0xA6, 0x87, 0x66, 0x50, 0x4E, 0x5E, 0x7F, 0x9F,
+  0xB2, 0xB3, 0xA2, 0x82, 0x61, 0x4E, 0x4D, 0x61, 0x83, 0xA1, 0xB1, 0xAE,
+  0x99, 0x78, 0x58, 0x49, 0x4D, 0x63, 0x86, 0xA2, 0xAF, 0xAB, 0x93, 0x71,
+  0x55, 0x4A, 0x54, 0x6F, 0x91, 0xAA, 0xB2, 0xAA, 0x8F, 0x6B, 0x51, 0x48,
+  0x53, 0x72, 0x94, 0xAB, 0xB2, 0xA5, 0x87, 0x64, 0x4D, 0x48, 0x58, 0x79,
+  0x9A, 0xAF, 0xB1, 0xA1, 0x82, 0x60, 0x4C, 0x4B, 0x60, 0x81, 0xA1, 0xB1,
+  0xB1, 0x9D, 0x7D, 0x5D, 0x4D, 0x4F, 0x66, 0x89, 0xA6, 0xB4, 0xAF, 0x99,
+  0x77, 0x59, 0x4D, 0x54, 0x6D, 0x90, 0xAA, 0xB5, 0xAC, 0x93, 0x70, 0x55,
+  0x4B, 0x57, 0x74, 0x95, 0xAD, 0xB4, 0xA8, 0x8C, 0x69, 0x51, 0x49, 0x58,
+  0x77, 0x99, 0xAF, 0xB2, 0xA3, 0x83, 0x61, 0x4C, 0x49, 0x5C, 0x7D, 0x9E,
+  0xB1, 0xB1, 0x9E, 0x7E, 0x5D, 0x4B, 0x4E, 0x63, 0x86, 0xA4, 0xB3, 0xAF,
+  0x9A, 0x79, 0x5A, 0x4C, 0x51, 0x6A, 0x8D, 0xA8, 0xB3, 0xAD, 0x93, 0x71,
+  0x55, 0x49, 0x54, 0x74, 0x98, 0xAD, 0xAB, 0x90, 0x69, 0x4D, 0x4B, 0x63,
+  0x8A, 0xA9, 0xB1, 0xA0, 0x7F, 0x5D, 0x4F, 0x5C, 0x7D, 0xA0, 0xB2, 0xAA,
+  0x8C, 0x67, 0x4E, 0x50, 0x6C, 0x92, 0xAD, 0xB0, 0x9A, 0x75, 0x54, 0x4B,
+  0x5E, 0x82, 0xA3, 0xB2, 0xA6, 0x85, 0x60, 0x4B, 0x53, 0x73, 0x98, 0xAF,
+  0xAD, 0x94, 0x6F, 0x52, 0x4D, 0x65, 0x8A, 0xA8, 0xB1, 0xA1, 0x7E, 0x5C,
+  0x4C, 0x58, 0x79, 0x9D, 0xB0, 0xAA, 0x8E, 0x69, 0x4F, 0x4F, 0x6A, 0x90,
+  0xAB, 0xAF, 0x9B, 0x78, 0x57, 0x4C, 0x5D, 0x80, 0xA2, 0xB1, 0xA6, 0x86,
+  0x61, 0x4B, 0x51, 0x70, 0x95, 0xAD, 0xAD, 0x95, 0x6F, 0x51, 0x4B, 0x61,
+  0x86, 0xA6, 0xB1, 0xA2, 0x80, 0x5C, 0x4B, 0x57, 0x78, 0x9D, 0xB2, 0xAD,
+  0x91, 0x6C, 0x52, 0x52, 0x6B, 0x90, 0xAD, 0xB3, 0x9F, 0x7B, 0x59, 0x4D,
+  0x5D, 0x7F, 0xA1, 0xB1, 0xA8, 0x89, 0x64, 0x4D, 0x51, 0x6E, 0x93, 0xAC,
+  0xAD, 0x96, 0x72, 0x53, 0x4C, 0x61, 0x87, 0xA8, 0xB4, 0xA6, 0x84, 0x60,
+  0x4D, 0x57, 0x76, 0x9A, 0xB0, 0xAC, 0x91, 0x6B, 0x50, 0x4E, 0x66, 0x8C,
+  0xA9, 0xB0, 0x9E, 0x7B, 0x58, 0x49, 0x58, 0x7B, 0x9E, 0xB0, 0xA8, 0x89,
+  0x64, 0x4C, 0x4F, 0x6B, 0x91, 0xAC, 0xAF, 0x98, 0x74, 0x55, 0x4C, 0x5F,
+  0x83, 0xA4, 0xB1, 0xA5, 0x85, 0x60, 0x4E, 0x5F, 0x86, 0xA7, 0xAE, 0x96,
+  0x6E, 0x52, 0x56, 0x77, 0x9E, 0xB0, 0xA2, 0x7D, 0x59, 0x51, 0x6A, 0x91,
+  0xAC, 0xAA, 0x8B, 0x63, 0x4E, 0x5C, 0x82, 0xA5, 0xAE, 0x98, 0x70, 0x51,
+  0x53, 0x73, 0x9A, 0xAF, 0xA3, 0x7F, 0x59, 0x4E, 0x66, 0x8E, 0xAB, 0xAB,
+  0x8F, 0x67, 0x50, 0x5C, 0x80, 0xA4, 0xB0, 0x9C, 0x75, 0x55, 0x54, 0x72,
+  0x98, 0xAE, 0xA5, 0x82, 0x5B, 0x4D, 0x62, 0x89, 0xA8, 0xA9, 0x8D, 0x66,
+  0x4D, 0x54, 0x77, 0x9D, 0xAC, 0x9B, 0x75, 0x53, 0x50, 0x6E, 0x96, 0xAE,
+  0xA7, 0x85, 0x5E, 0x4E, 0x5F, 0x86, 0xA7, 0xAC, 0x92, 0x6A, 0x4E, 0x54,
+  0x77, 0x9D, 0xAE, 0x9F, 0x79, 0x55, 0x4E, 0x69, 0x91, 0xAC, 0xA8, 0x88,
+  0x61, 0x4E, 0x5D, 0x84, 0xA7, 0xAE, 0x96, 0x6F, 0x52, 0x55, 0x75, 0x9C,
+  0xB0, 0xA3, 0x7E, 0x5A, 0x51, 0x69, 0x91, 0xAD, 0xAB, 0x8D, 0x66, 0x51,
+  0x5D, 0x83, 0xA6, 0xB0, 0x9A, 0x73, 0x54, 0x55, 0x74, 0x9B, 0xAF, 0xA5,
+  0x82, 0x5C, 0x4F, 0x65, 0x8D, 0xAB, 0xAB, 0x8E, 0x66, 0x4E, 0x58, 0x7D,
+  0xA2, 0xAE, 0x9B, 0x74, 0x53, 0x51, 0x6E, 0x96, 0xAD, 0xA6, 0x83, 0x5D,
+  0x4E, 0x62, 0x89, 0xA9, 0xAD, 0x93, 0x6B, 0x51, 0x59, 0x7B, 0xA0, 0xB0,
+  0x9F, 0x79, 0x57, 0x51, 0x6C, 0x94, 0xAC, 0xA3, 0x7C, 0x57, 0x55, 0x76,
+  0x9D, 0xAA, 0x91, 0x66, 0x4D, 0x5F, 0x88, 0xA8, 0xA4, 0x80, 0x59, 0x55,
+  0x76, 0x9F, 0xAF, 0x98, 0x6E, 0x52, 0x60, 0x88, 0xA9, 0xA7, 0x84, 0x5B,
+  0x52, 0x70, 0x9A, 0xAD, 0x9A, 0x6F, 0x52, 0x5B, 0x84, 0xA7, 0xA8, 0x87,
+  0x5E, 0x50, 0x6C, 0x96, 0xAD, 0x9C, 0x73, 0x53, 0x59, 0x80, 0xA5, 0xAA,
+  0x8B, 0x61, 0x52, 0x6A, 0x93, 0xAB, 0x9F, 0x77, 0x55, 0x58, 0x7D, 0xA2,
+  0xAA, 0x8E, 0x64, 0x51, 0x67, 0x90, 0xAB, 0xA1, 0x7A, 0x56, 0x56, 0x79,
+  0xA0, 0xAB, 0x91, 0x67, 0x50, 0x62, 0x8C, 0xA9, 0xA3, 0x7D, 0x57, 0x53,
+  0x74, 0x9C, 0xAB, 0x94, 0x69, 0x4F, 0x5E, 0x88, 0xA9, 0xA5, 0x81, 0x5A,
+  0x53, 0x71, 0x9C, 0xAE, 0x99, 0x6F, 0x54, 0x60, 0x88, 0xAA, 0xA9, 0x88,
+  0x5F, 0x54, 0x71, 0x9A, 0xAE, 0x9D, 0x73, 0x55, 0x5D, 0x83, 0xA6, 0xA9,
+  0x8A, 0x5F, 0x51, 0x6A, 0x94, 0xAB, 0x9C, 0x73, 0x51, 0x56, 0x7D, 0xA4,
+  0xAA, 0x8E, 0x65, 0x54, 0x6A, 0x94, 0xAD, 0xA1, 0x79, 0x56, 0x57, 0x7B,
+  0xA2, 0xAB, 0x8F, 0x65, 0x50, 0x63, 0x8E, 0xAB, 0xA2, 0x7B, 0x56, 0x53,
+  0x75, 0x9F, 0xAC, 0x92, 0x67, 0x4F, 0x60, 0x8A, 0xA9, 0xA4, 0x7F, 0x58,
+  0x53, 0x73, 0x9C, 0xAC, 0x96, 0x6C, 0x52, 0x5F, 0x87, 0xA8, 0xA1, 0x78,
+  0x56, 0x61, 0x8A, 0xA9, 0x9F, 0x73, 0x55, 0x65, 0x8F, 0xAB, 0x9A, 0x6F,
+  0x55, 0x6A, 0x95, 0xAC, 0x97, 0x6A, 0x55, 0x6D, 0x98, 0xAB, 0x91, 0x65,
+  0x54, 0x71, 0x9C, 0xAA, 0x8C, 0x60, 0x54, 0x75, 0xA0, 0xA9, 0x87, 0x5D,
+  0x56, 0x7B, 0xA4, 0xA6, 0x82, 0x5A, 0x5B, 0x82, 0xA6, 0xA5, 0x7E, 0x5A,
+  0x5E, 0x88, 0xA9, 0xA2, 0x78, 0x58, 0x62, 0x8B, 0xAA, 0x9D, 0x72, 0x54,
+  0x63, 0x8E, 0xA8, 0x98, 0x6B, 0x51, 0x65, 0x92, 0xA7, 0x91, 0x64, 0x4F,
+  0x69, 0x96, 0xA8, 0x8F, 0x64, 0x56, 0x73, 0x9D, 0xAA, 0x8B, 0x5F, 0x55,
+  0x75, 0x9E, 0xA7, 0x85, 0x5B, 0x55, 0x7A, 0xA3, 0xA6, 0x80, 0x58, 0x58,
+  0x80, 0xA5, 0xA2, 0x7B, 0x56, 0x5C, 0x85, 0xA8, 0xA0, 0x77, 0x54, 0x60,
+  0x8B, 0xA9, 0x9D, 0x72, 0x55, 0x64, 0x90, 0xAB, 0x99, 0x6E, 0x55, 0x69,
+  0x96, 0xAB, 0x95, 0x6A, 0x55, 0x6F, 0x9B, 0xAB, 0x91, 0x65, 0x56, 0x74,
+  0x9E, 0xAB, 0x8C, 0x62, 0x57, 0x79, 0xA1, 0xA9, 0x87, 0x5D, 0x58, 0x7D,
+  0xA4, 0xA6, 0x80, 0x59, 0x59, 0x81, 0xA5, 0xA3, 0x7A, 0x56, 0x5B, 0x86,
+  0xA7, 0xA0, 0x76, 0x54, 0x60, 0x8B, 0xA9, 0x9C, 0x71, 0x55, 0x64, 0x90,
+  0xAB, 0x99, 0x6D, 0x55, 0x6A, 0x96, 0xAB, 0x94, 0x69, 0x55, 0x6E, 0x9A,
+  0xA6, 0x83, 0x5B, 0x5F, 0x8A, 0xA7, 0x92, 0x65, 0x56, 0x79, 0xA2, 0x9E,
+  0x72, 0x53, 0x66, 0x95, 0xA6, 0x85, 0x5D, 0x60, 0x8B, 0xAB, 0x98, 0x69,
+  0x58, 0x78, 0xA2, 0xA1, 0x78, 0x57, 0x67, 0x96, 0xA8, 0x89, 0x5D, 0x5C,
+  0x85, 0xA7, 0x98, 0x6A, 0x55, 0x74, 0xA0, 0xA3, 0x7A, 0x57, 0x65, 0x92,
+  0xA8, 0x8B, 0x5F, 0x5A, 0x82, 0xA6, 0x9A, 0x6D, 0x56, 0x73, 0x9F, 0xA4,
+  0x7D, 0x58, 0x63, 0x90, 0xA8, 0x8D, 0x61, 0x5A, 0x80, 0xA5, 0x9C, 0x6F,
+  0x56, 0x6F, 0x9B, 0xA5, 0x7F, 0x59, 0x62, 0x8E, 0xA8, 0x90, 0x63, 0x58,
+  0x7C, 0xA3, 0x9C, 0x70, 0x55, 0x6C, 0x99, 0xA6, 0x81, 0x59, 0x5E, 0x8A,
+  0xA7, 0x91, 0x64, 0x56, 0x79, 0xA3, 0xA0, 0x74, 0x56, 0x6A, 0x98, 0xA8,
+  0x87, 0x5D, 0x5F, 0x8B, 0xAA, 0x97, 0x6A, 0x5A, 0x7A, 0xA4, 0xA3, 0x79,
+  0x58, 0x6A, 0x97, 0xA9, 0x89, 0x5E, 0x5D, 0x87, 0xA8, 0x97, 0x69, 0x55,
+  0x73, 0x9E, 0xA1, 0x77, 0x55, 0x64, 0x93, 0xA8, 0x8A, 0x60, 0x5E, 0x86,
+  0xA8, 0x9B, 0x6D, 0x57, 0x74, 0x9F, 0xA5, 0x7D, 0x57, 0x63, 0x91, 0xA7,
+  0x8C, 0x60, 0x58, 0x80, 0xA6, 0x9B, 0x6E, 0x55, 0x6F, 0x9C, 0xA5, 0x7E,
+  0x58, 0x60, 0x8D, 0xA8, 0x8E, 0x62, 0x58, 0x7C, 0xA4, 0x9E, 0x6E, 0x58,
+  0x6A, 0x71, 0x5F, 0x57, 0x58, 0x55, 0x55, 0x58, 0x57, 0x59, 0x5B, 0x5A,
+  0x5C, 0x5E, 0x5D, 0x5E, 0x60, 0x60, 0x62, 0x63, 0x62, 0x63, 0x65, 0x65,
+  0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x68, 0x68, 0x69, 0x6A, 0x69, 0x69,
+  0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E,
+  0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x75,
+  0x75, 0x76, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A,
+  0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7C, 0x7D, 0x7D, 0x7E, 0x7D, 0x7E,
+  0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F,
+  0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x7F,
+  0x7F, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x83,
+  0x82, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85,
+  0x86, 0x85, 0x85, 0x86, 0x85, 0x86, 0x86, 0x87, 0x86, 0x86, 0x87, 0x86,
+  0x87, 0x87, 0x86, 0x87, 0x86, 0x86, 0x85, 0x86, 0x85, 0x85, 0x86, 0x85,
+  0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84,
+  0x83, 0x83, 0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84,
+  0x85, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x86, 0x85, 0x85, 0x86,
+  0x85, 0x86, 0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87,
+  0x87, 0x88, 0x87, 0x87, 0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x86,
+  0x86, 0x85, 0x86, 0x86, 0x85, 0x86, 0x85, 0x85, 0x86, 0x85, 0x85, 0x84,
+  0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84,
+  0x85, 0x85, 0x84, 0x85, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85,
+  0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85,
+  0x84, 0x85, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84,
+  0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x83, 0x84,
+  0x83, 0x83, 0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83,
+  0x84, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84,
+  0x84, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84,
+  0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84, 0x84, 0x83, 0x84, 0x83,
+  0x84, 0x84, 0x83, 0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82,
+  0x83, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
+  0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82,
+  0x82, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x83,
+  0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x82,
+  0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81,
+  0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
+  0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
+  0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
+  0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82,
+  0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82,
+  0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82,
+  0x82, 0x81, 0x81, 0x80, 0x4C, 0x49, 0x53, 0x54, 0x3C, 0x00, 0x00, 0x00,
+  0x49, 0x4E, 0x46, 0x4F, 0x49, 0x53, 0x46, 0x54, 0x30, 0x00, 0x00, 0x00,
+  0x57, 0x48, 0x41, 0x4D, 0x20, 0x31, 0x2E, 0x33, 0x31, 0x20, 0x62, 0x79,
+  0x20, 0x41, 0x6E, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75, 0x6C, 0x68,
+  0x61, 0x6B, 0x20, 0x28, 0x6C, 0x69, 0x62, 0x73, 0x6E, 0x64, 0x66, 0x69,
+  0x6C, 0x65, 0x2D, 0x31, 0x2E, 0x30, 0x2E, 0x32, 0x34, 0x29, 0x00, 0x00,
+  0x69, 0x64, 0x33, 0x20, 0x38, 0x00, 0x00, 0x00, 0x49, 0x44, 0x33, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x54, 0x58, 0x58, 0x58, 0x00, 0x00,
+  0x00, 0x24, 0x00, 0x00, 0x00, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x00, 0x57, 0x48, 0x41, 0x4D, 0x20, 0x31, 0x2E, 0x33, 0x31, 0x20,
+  0x62, 0x79, 0x20, 0x41, 0x6E, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75,
+  0x6C, 0x68, 0x61, 0x6B
+};
+
+
+uint8_t chomp[5920] = {
+  0x52, 0x49, 0x46, 0x46, 0x18, 0x17, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
+  0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x40, 0x1f, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
+  0x64, 0x61, 0x74, 0x61, 0x64, 0x16, 0x00, 0x00, 0x81, 0x81, 0x7e, 0x7e,
+  0x81, 0x82, 0x82, 0x81, 0x7f, 0x7c, 0x7c, 0x7b, 0x7d, 0x7d, 0x7d, 0x7c,
+  0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82,
+  0x81, 0x80, 0x7f, 0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x82, 0x82, 0x82, 0x80,
+  0x7d, 0x7c, 0x7a, 0x76, 0x75, 0x7a, 0x82, 0x8b, 0x8f, 0x90, 0x91, 0x8c,
+  0x84, 0x7d, 0x79, 0x75, 0x72, 0x70, 0x72, 0x75, 0x74, 0x77, 0x7d, 0x85,
+  0x89, 0x8b, 0x8d, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x83, 0x7d, 0x78, 0x74,
+  0x71, 0x71, 0x73, 0x74, 0x74, 0x78, 0x82, 0x88, 0x8b, 0x8c, 0x8c, 0x8d,
+  0x8c, 0x8a, 0x87, 0x82, 0x7c, 0x75, 0x70, 0x6f, 0x6f, 0x72, 0x73, 0x73,
+  0x78, 0x83, 0x8a, 0x8b, 0x89, 0x89, 0x8a, 0x8c, 0x8c, 0x8a, 0x85, 0x7b,
+  0x72, 0x6e, 0x6c, 0x6c, 0x6f, 0x71, 0x74, 0x7c, 0x86, 0x8b, 0x8d, 0x8d,
+  0x8d, 0x8e, 0x8e, 0x8d, 0x88, 0x82, 0x7a, 0x73, 0x6f, 0x6d, 0x6e, 0x6f,
+  0x6f, 0x74, 0x7e, 0x89, 0x8c, 0x8b, 0x8b, 0x8c, 0x8e, 0x90, 0x8e, 0x89,
+  0x82, 0x7a, 0x74, 0x71, 0x6e, 0x6c, 0x6c, 0x6d, 0x71, 0x7d, 0x8a, 0x8f,
+  0x8f, 0x8e, 0x8d, 0x8d, 0x8e, 0x8c, 0x88, 0x7f, 0x76, 0x71, 0x6f, 0x6e,
+  0x6f, 0x71, 0x70, 0x72, 0x7b, 0x88, 0x8e, 0x90, 0x8f, 0x8e, 0x8e, 0x8f,
+  0x8d, 0x87, 0x7c, 0x70, 0x6a, 0x6c, 0x6f, 0x72, 0x74, 0x76, 0x7d, 0x88,
+  0x91, 0x94, 0x94, 0x90, 0x8a, 0x86, 0x85, 0x82, 0x77, 0x6d, 0x68, 0x6a,
+  0x70, 0x74, 0x7a, 0x7f, 0x85, 0x8a, 0x8f, 0x93, 0x93, 0x90, 0x8a, 0x85,
+  0x81, 0x7b, 0x74, 0x6c, 0x68, 0x6a, 0x70, 0x77, 0x80, 0x86, 0x89, 0x8a,
+  0x8c, 0x90, 0x90, 0x8b, 0x86, 0x80, 0x76, 0x71, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x74, 0x7c, 0x84, 0x88, 0x8a, 0x8a, 0x8b, 0x8a, 0x8a, 0x89, 0x83, 0x7a,
+  0x71, 0x6f, 0x70, 0x73, 0x74, 0x75, 0x79, 0x80, 0x88, 0x8d, 0x8f, 0x8e,
+  0x8c, 0x8a, 0x8a, 0x87, 0x7e, 0x73, 0x6e, 0x6e, 0x70, 0x72, 0x75, 0x7a,
+  0x81, 0x86, 0x8a, 0x8d, 0x8f, 0x8d, 0x89, 0x88, 0x86, 0x80, 0x77, 0x70,
+  0x6d, 0x6f, 0x71, 0x75, 0x7a, 0x81, 0x86, 0x89, 0x8c, 0x8d, 0x8e, 0x8a,
+  0x88, 0x85, 0x7e, 0x77, 0x72, 0x70, 0x70, 0x72, 0x75, 0x7a, 0x83, 0x89,
+  0x8c, 0x8c, 0x8c, 0x8a, 0x86, 0x82, 0x7c, 0x78, 0x74, 0x73, 0x75, 0x77,
+  0x7c, 0x84, 0x89, 0x8a, 0x88, 0x88, 0x88, 0x87, 0x82, 0x7a, 0x75, 0x72,
+  0x73, 0x76, 0x79, 0x7c, 0x82, 0x8a, 0x8c, 0x8a, 0x88, 0x86, 0x83, 0x81,
+  0x7d, 0x76, 0x71, 0x6e, 0x71, 0x77, 0x7d, 0x83, 0x89, 0x8d, 0x8d, 0x8c,
+  0x8b, 0x88, 0x83, 0x7d, 0x76, 0x71, 0x6d, 0x6a, 0x6e, 0x75, 0x7e, 0x86,
+  0x8d, 0x8f, 0x8d, 0x8d, 0x8c, 0x88, 0x82, 0x78, 0x6f, 0x6c, 0x6c, 0x6e,
+  0x72, 0x77, 0x7d, 0x87, 0x8f, 0x90, 0x8f, 0x8c, 0x8a, 0x87, 0x82, 0x78,
+  0x6f, 0x6c, 0x6c, 0x71, 0x76, 0x7b, 0x81, 0x8a, 0x8f, 0x90, 0x8f, 0x8c,
+  0x88, 0x85, 0x7f, 0x78, 0x71, 0x6c, 0x6d, 0x73, 0x79, 0x7e, 0x84, 0x8a,
+  0x8d, 0x8d, 0x8d, 0x8a, 0x85, 0x81, 0x79, 0x74, 0x71, 0x6f, 0x71, 0x75,
+  0x7b, 0x82, 0x8a, 0x8e, 0x8d, 0x8a, 0x88, 0x88, 0x84, 0x7b, 0x73, 0x6d,
+  0x6d, 0x73, 0x78, 0x7f, 0x87, 0x8f, 0x92, 0x8e, 0x89, 0x86, 0x82, 0x79,
+  0x70, 0x6d, 0x6c, 0x70, 0x75, 0x7d, 0x89, 0x93, 0x95, 0x91, 0x8c, 0x88,
+  0x85, 0x7d, 0x72, 0x6a, 0x69, 0x6e, 0x73, 0x78, 0x81, 0x8e, 0x97, 0x97,
+  0x8f, 0x8a, 0x87, 0x81, 0x76, 0x6d, 0x6a, 0x6d, 0x71, 0x74, 0x7c, 0x89,
+  0x94, 0x95, 0x8f, 0x8a, 0x89, 0x88, 0x7c, 0x6e, 0x68, 0x6a, 0x6f, 0x74,
+  0x79, 0x83, 0x8f, 0x94, 0x91, 0x8c, 0x88, 0x86, 0x7e, 0x74, 0x6d, 0x6a,
+  0x6d, 0x70, 0x74, 0x7e, 0x8b, 0x94, 0x95, 0x8f, 0x87, 0x85, 0x80, 0x77,
+  0x70, 0x6b, 0x6b, 0x6f, 0x74, 0x7b, 0x87, 0x92, 0x96, 0x92, 0x8c, 0x87,
+  0x83, 0x79, 0x71, 0x6c, 0x6c, 0x6f, 0x72, 0x79, 0x84, 0x91, 0x96, 0x93,
+  0x8c, 0x88, 0x87, 0x7d, 0x71, 0x6a, 0x6b, 0x70, 0x75, 0x78, 0x7f, 0x8c,
+  0x97, 0x97, 0x91, 0x89, 0x85, 0x80, 0x75, 0x6d, 0x6a, 0x6f, 0x73, 0x78,
+  0x80, 0x8c, 0x95, 0x96, 0x91, 0x8a, 0x83, 0x77, 0x6e, 0x68, 0x6a, 0x6e,
+  0x75, 0x7f, 0x8b, 0x93, 0x95, 0x92, 0x8e, 0x86, 0x79, 0x6f, 0x6a, 0x6b,
+  0x6e, 0x72, 0x7c, 0x88, 0x91, 0x94, 0x92, 0x8f, 0x89, 0x7e, 0x71, 0x6a,
+  0x6c, 0x6e, 0x70, 0x78, 0x85, 0x91, 0x96, 0x92, 0x8d, 0x87, 0x81, 0x76,
+  0x6d, 0x6b, 0x6f, 0x74, 0x7c, 0x85, 0x8f, 0x95, 0x92, 0x8c, 0x85, 0x7d,
+  0x74, 0x6f, 0x6d, 0x6d, 0x70, 0x78, 0x85, 0x90, 0x94, 0x91, 0x8e, 0x89,
+  0x80, 0x76, 0x6e, 0x6c, 0x6e, 0x70, 0x74, 0x7e, 0x8b, 0x92, 0x94, 0x90,
+  0x8a, 0x82, 0x79, 0x70, 0x6b, 0x6d, 0x70, 0x74, 0x7d, 0x88, 0x8f, 0x90,
+  0x8f, 0x8c, 0x86, 0x7d, 0x71, 0x6d, 0x6e, 0x71, 0x73, 0x7b, 0x86, 0x8f,
+  0x91, 0x8f, 0x8b, 0x85, 0x7d, 0x74, 0x6f, 0x70, 0x73, 0x75, 0x7a, 0x85,
+  0x8e, 0x90, 0x8e, 0x8b, 0x86, 0x7e, 0x76, 0x71, 0x71, 0x74, 0x78, 0x7e,
+  0x88, 0x91, 0x91, 0x8d, 0x88, 0x7f, 0x74, 0x6c, 0x6a, 0x71, 0x78, 0x7f,
+  0x8a, 0x94, 0x99, 0x92, 0x8a, 0x81, 0x76, 0x6a, 0x64, 0x67, 0x72, 0x7b,
+  0x86, 0x93, 0x9b, 0x97, 0x8d, 0x83, 0x78, 0x6c, 0x64, 0x65, 0x6e, 0x78,
+  0x83, 0x8f, 0x9a, 0x9b, 0x93, 0x8b, 0x7c, 0x6d, 0x63, 0x62, 0x6a, 0x74,
+  0x7e, 0x8c, 0x9a, 0x9f, 0x98, 0x90, 0x85, 0x75, 0x67, 0x60, 0x65, 0x6f,
+  0x79, 0x86, 0x94, 0x9e, 0x9c, 0x95, 0x8a, 0x7a, 0x69, 0x5f, 0x63, 0x6c,
+  0x75, 0x7f, 0x8d, 0x9b, 0x9c, 0x94, 0x8c, 0x7e, 0x6e, 0x62, 0x60, 0x68,
+  0x72, 0x7d, 0x8a, 0x96, 0x9b, 0x98, 0x91, 0x84, 0x73, 0x64, 0x5f, 0x63,
+  0x6d, 0x79, 0x86, 0x95, 0x9c, 0x9a, 0x94, 0x89, 0x78, 0x68, 0x5e, 0x5f,
+  0x69, 0x76, 0x83, 0x91, 0x9c, 0x9e, 0x98, 0x8d, 0x7d, 0x6d, 0x61, 0x61,
+  0x69, 0x73, 0x7f, 0x8e, 0x9a, 0x9f, 0x9b, 0x90, 0x81, 0x70, 0x64, 0x60,
+  0x66, 0x72, 0x82, 0x90, 0x9b, 0x9d, 0x98, 0x8e, 0x7b, 0x6b, 0x60, 0x5f,
+  0x69, 0x78, 0x89, 0x97, 0x9e, 0x9c, 0x93, 0x85, 0x73, 0x64, 0x5f, 0x65,
+  0x71, 0x7f, 0x8e, 0x9b, 0x9c, 0x94, 0x8b, 0x7e, 0x6e, 0x61, 0x62, 0x6b,
+  0x75, 0x83, 0x94, 0x9d, 0x99, 0x8e, 0x82, 0x77, 0x6a, 0x63, 0x68, 0x72,
+  0x7d, 0x8a, 0x97, 0x9c, 0x94, 0x88, 0x7c, 0x71, 0x69, 0x67, 0x6b, 0x75,
+  0x82, 0x91, 0x99, 0x98, 0x90, 0x84, 0x77, 0x6b, 0x67, 0x6c, 0x73, 0x7c,
+  0x89, 0x93, 0x96, 0x93, 0x89, 0x7d, 0x71, 0x69, 0x6b, 0x70, 0x79, 0x84,
+  0x91, 0x95, 0x91, 0x8b, 0x80, 0x73, 0x69, 0x6b, 0x72, 0x78, 0x80, 0x8b,
+  0x92, 0x90, 0x88, 0x7f, 0x75, 0x6c, 0x6a, 0x73, 0x7a, 0x81, 0x8a, 0x93,
+  0x94, 0x8c, 0x82, 0x77, 0x6d, 0x66, 0x6c, 0x77, 0x81, 0x8a, 0x92, 0x95,
+  0x90, 0x87, 0x7d, 0x71, 0x68, 0x69, 0x72, 0x7c, 0x86, 0x92, 0x99, 0x95,
+  0x8a, 0x7d, 0x72, 0x69, 0x66, 0x6e, 0x7c, 0x89, 0x94, 0x9c, 0x98, 0x8a,
+  0x7a, 0x6d, 0x65, 0x64, 0x6e, 0x7e, 0x8d, 0x97, 0x9d, 0x96, 0x85, 0x75,
+  0x6a, 0x62, 0x63, 0x6e, 0x80, 0x8f, 0x99, 0x9d, 0x96, 0x84, 0x73, 0x68,
+  0x63, 0x65, 0x71, 0x83, 0x92, 0x9c, 0x9d, 0x95, 0x84, 0x71, 0x65, 0x62,
+  0x68, 0x75, 0x85, 0x92, 0x9a, 0x99, 0x8f, 0x80, 0x71, 0x68, 0x67, 0x6e,
+  0x78, 0x85, 0x91, 0x98, 0x95, 0x8b, 0x7d, 0x71, 0x69, 0x69, 0x70, 0x7d,
+  0x89, 0x92, 0x95, 0x91, 0x86, 0x7b, 0x70, 0x6a, 0x6b, 0x74, 0x82, 0x8b,
+  0x91, 0x91, 0x8e, 0x83, 0x79, 0x72, 0x6e, 0x6e, 0x76, 0x83, 0x8b, 0x90,
+  0x90, 0x89, 0x7f, 0x76, 0x70, 0x6e, 0x71, 0x79, 0x85, 0x8e, 0x90, 0x8c,
+  0x83, 0x77, 0x70, 0x6d, 0x6f, 0x75, 0x7f, 0x89, 0x8f, 0x90, 0x8a, 0x7e,
+  0x73, 0x6c, 0x6c, 0x71, 0x7a, 0x84, 0x88, 0x86, 0x83, 0x87, 0x8b, 0x8b,
+  0x89, 0x87, 0x89, 0x86, 0x7a, 0x6e, 0x70, 0x74, 0x70, 0x6a, 0x67, 0x6d,
+  0x75, 0x80, 0x90, 0x9f, 0xa3, 0x9b, 0x90, 0x84, 0x7d, 0x82, 0x8e, 0x93,
+  0x91, 0x8b, 0x82, 0x72, 0x60, 0x51, 0x4d, 0x53, 0x5d, 0x6f, 0x82, 0x93,
+  0x9e, 0x9f, 0x96, 0x8c, 0x8c, 0x8f, 0x8c, 0x7f, 0x75, 0x74, 0x80, 0x86,
+  0x82, 0x80, 0x84, 0x86, 0x77, 0x6a, 0x6c, 0x76, 0x7c, 0x78, 0x71, 0x6f,
+  0x6e, 0x70, 0x7c, 0x92, 0xa6, 0xaf, 0xaa, 0x92, 0x79, 0x72, 0x7d, 0x87,
+  0x8b, 0x8d, 0x8d, 0x8a, 0x7d, 0x69, 0x52, 0x46, 0x45, 0x4d, 0x62, 0x80,
+  0x9d, 0xaa, 0xaa, 0x9d, 0x8e, 0x87, 0x81, 0x71, 0x62, 0x68, 0x81, 0x9b,
+  0xa3, 0x9c, 0x8a, 0x7d, 0x6a, 0x56, 0x51, 0x61, 0x78, 0x85, 0x8c, 0x89,
+  0x7f, 0x73, 0x6c, 0x70, 0x83, 0x9d, 0xb4, 0xb6, 0xa5, 0x93, 0x86, 0x81,
+  0x7c, 0x75, 0x71, 0x78, 0x81, 0x80, 0x79, 0x66, 0x52, 0x46, 0x49, 0x5b,
+  0x7b, 0xa0, 0xb8, 0xb9, 0x9f, 0x82, 0x71, 0x67, 0x67, 0x6a, 0x7b, 0x98,
+  0xa8, 0x94, 0x6d, 0x57, 0x54, 0x5e, 0x70, 0x86, 0x99, 0xa1, 0xa1, 0xa4,
+  0xa5, 0x9b, 0x86, 0x6f, 0x5a, 0x4f, 0x5e, 0x7c, 0x8b, 0x8b, 0x87, 0x87,
+  0x8d, 0x91, 0x85, 0x77, 0x7e, 0x8c, 0x91, 0x83, 0x72, 0x6e, 0x6c, 0x5d,
+  0x4e, 0x5d, 0x7d, 0x8f, 0x8c, 0x89, 0x8b, 0x85, 0x82, 0x8c, 0x9c, 0xa9,
+  0xae, 0xa4, 0x8a, 0x64, 0x47, 0x3f, 0x4d, 0x64, 0x82, 0xa0, 0xb3, 0xb1,
+  0x92, 0x6b, 0x5b, 0x61, 0x6f, 0x79, 0x87, 0xa1, 0xae, 0x94, 0x66, 0x4c,
+  0x4e, 0x5e, 0x6e, 0x83, 0x9e, 0xa9, 0xa2, 0x99, 0x90, 0x83, 0x7d, 0x7b,
+  0x72, 0x6b, 0x70, 0x78, 0x77, 0x70, 0x6f, 0x7a, 0x90, 0xa4, 0xa2, 0x91,
+  0x85, 0x7e, 0x7b, 0x73, 0x6a, 0x76, 0x89, 0x80, 0x68, 0x63, 0x6e, 0x73,
+  0x6e, 0x6b, 0x79, 0x88, 0x92, 0xa4, 0xb4, 0xb5, 0xa4, 0x86, 0x62, 0x45,
+  0x47, 0x63, 0x84, 0xa2, 0xb3, 0xa4, 0x87, 0x71, 0x5f, 0x5b, 0x60, 0x6e,
+  0x83, 0x8c, 0x78, 0x60, 0x65, 0x75, 0x89, 0xa3, 0xb7, 0xb9, 0x9e, 0x77,
+  0x5e, 0x52, 0x52, 0x5e, 0x74, 0x90, 0xa8, 0xaf, 0xa3, 0x92, 0x7e, 0x70,
+  0x65, 0x66, 0x75, 0x80, 0x7c, 0x68, 0x61, 0x69, 0x78, 0x90, 0xa8, 0xb9,
+  0xb1, 0x92, 0x74, 0x5e, 0x4d, 0x4a, 0x62, 0x81, 0x9c, 0xb0, 0xaf, 0x9a,
+  0x80, 0x6d, 0x5b, 0x59, 0x6f, 0x81, 0x85, 0x79, 0x6e, 0x75, 0x86, 0x94,
+  0x9e, 0xa8, 0xa3, 0x8d, 0x7d, 0x70, 0x58, 0x43, 0x49, 0x6b, 0x95, 0xb4,
+  0xbb, 0xaa, 0x8d, 0x74, 0x63, 0x56, 0x5b, 0x73, 0x83, 0x7e, 0x74, 0x75,
+  0x7b, 0x81, 0x84, 0x95, 0xa6, 0x9d, 0x85, 0x78, 0x6d, 0x5f, 0x5b, 0x6f,
+  0x87, 0x98, 0xa7, 0xa8, 0x9a, 0x82, 0x6a, 0x53, 0x53, 0x6e, 0x85, 0x85,
+  0x7c, 0x7d, 0x84, 0x89, 0x88, 0x8d, 0x9c, 0x99, 0x83, 0x76, 0x72, 0x67,
+  0x61, 0x75, 0x88, 0x87, 0x90, 0x9b, 0x95, 0x83, 0x69, 0x59, 0x59, 0x5f,
+  0x65, 0x7e, 0xa1, 0xb8, 0xb8, 0x9f, 0x7b, 0x59, 0x46, 0x47, 0x64, 0x8b,
+  0xa7, 0xb7, 0xb1, 0x97, 0x7d, 0x5f, 0x4d, 0x50, 0x5b, 0x63, 0x71, 0x8f,
+  0xab, 0xb9, 0xb2, 0x96, 0x6e, 0x50, 0x49, 0x61, 0x89, 0xa4, 0xac, 0xae,
+  0x99, 0x78, 0x58, 0x4b, 0x56, 0x6f, 0x89, 0x91, 0x90, 0x8f, 0x91, 0x8f,
+  0x85, 0x73, 0x61, 0x57, 0x6b, 0x94, 0xae, 0xad, 0x9f, 0x84, 0x64, 0x4f,
+  0x53, 0x78, 0x95, 0x93, 0x78, 0x68, 0x6f, 0x83, 0x9c, 0xa5, 0x9b, 0x86,
+  0x69, 0x55, 0x63, 0x7c, 0x87, 0x92, 0x99, 0x91, 0x8a, 0x80, 0x76, 0x6e,
+  0x66, 0x58, 0x58, 0x76, 0x93, 0xae, 0xba, 0xa8, 0x85, 0x62, 0x43, 0x3f,
+  0x66, 0x8c, 0xa7, 0xc0, 0xb9, 0x95, 0x6a, 0x4c, 0x4a, 0x5a, 0x6b, 0x74,
+  0x8d, 0xa7, 0xb1, 0xab, 0x96, 0x78, 0x5e, 0x4e, 0x4e, 0x6d, 0x91, 0xa8,
+  0xb7, 0xae, 0x8a, 0x54, 0x32, 0x40, 0x66, 0x90, 0xac, 0xbd, 0xb7, 0x91,
+  0x5b, 0x3e, 0x50, 0x70, 0x86, 0x9e, 0xb5, 0xba, 0xa3, 0x6e, 0x3e, 0x32,
+  0x4a, 0x69, 0x84, 0xb0, 0xc9, 0xbd, 0x95, 0x67, 0x47, 0x49, 0x56, 0x6d,
+  0x97, 0xbc, 0xc8, 0xa2, 0x70, 0x47, 0x3a, 0x55, 0x70, 0x93, 0xa6, 0xa5,
+  0x98, 0x83, 0x79, 0x75, 0x6d, 0x6d, 0x7f, 0x89, 0x92, 0x91, 0x82, 0x74,
+  0x6e, 0x73, 0x74, 0x7f, 0x8c, 0x8c, 0x83, 0x74, 0x75, 0x88, 0x92, 0x8d,
+  0x8b, 0x84, 0x7e, 0x6e, 0x5a, 0x54, 0x66, 0x89, 0xa4, 0xb7, 0xab, 0x88,
+  0x5f, 0x40, 0x43, 0x72, 0x9f, 0xaa, 0xb0, 0xa7, 0x94, 0x77, 0x52, 0x3a,
+  0x3b, 0x64, 0x8e, 0xb5, 0xcc, 0xbc, 0x89, 0x54, 0x3b, 0x4c, 0x72, 0x91,
+  0xae, 0xb1, 0xa6, 0x8c, 0x66, 0x49, 0x40, 0x53, 0x6d, 0x98, 0xbf, 0xc1,
+  0xa2, 0x71, 0x4d, 0x4f, 0x69, 0x81, 0x99, 0x9d, 0x9a, 0x93, 0x86, 0x7a,
+  0x6c, 0x6d, 0x6b, 0x6b, 0x6e, 0x73, 0x80, 0x86, 0x8e, 0x98, 0x99, 0x8f,
+  0x7c, 0x5f, 0x58, 0x6e, 0x90, 0x9a, 0x8e, 0x8d, 0x8d, 0x8a, 0x84, 0x7b,
+  0x71, 0x60, 0x5d, 0x74, 0x99, 0xad, 0xa2, 0x85, 0x70, 0x68, 0x6c, 0x72,
+  0x70, 0x75, 0x7e, 0x8b, 0x92, 0x90, 0x87, 0x70, 0x61, 0x6c, 0x7f, 0x87,
+  0x82, 0x77, 0x75, 0x7e, 0x8c, 0x93, 0x8d, 0x7e, 0x71, 0x6f, 0x75, 0x7e,
+  0x82, 0x7e, 0x7f, 0x8d, 0x99, 0x95, 0x84, 0x6c, 0x5c, 0x62, 0x7a, 0x8f,
+  0x9a, 0x9c, 0x94, 0x85, 0x77, 0x6a, 0x63, 0x68, 0x73, 0x86, 0x99, 0xa0,
+  0x97, 0x85, 0x74, 0x69, 0x68, 0x6e, 0x77, 0x84, 0x8d, 0x8c, 0x8a, 0x88,
+  0x80, 0x74, 0x70, 0x73, 0x78, 0x7e, 0x84, 0x88, 0x88, 0x85, 0x81, 0x7e,
+  0x79, 0x78, 0x78, 0x76, 0x76, 0x7d, 0x80, 0x82, 0x8c, 0x91, 0x8a, 0x7c,
+  0x6d, 0x69, 0x6f, 0x79, 0x84, 0x8e, 0x93, 0x90, 0x87, 0x7a, 0x70, 0x6d,
+  0x6c, 0x6e, 0x7c, 0x8c, 0x92, 0x93, 0x8d, 0x87, 0x80, 0x75, 0x6f, 0x72,
+  0x77, 0x7b, 0x7f, 0x86, 0x8e, 0x91, 0x8e, 0x86, 0x81, 0x7a, 0x70, 0x6d,
+  0x70, 0x74, 0x7e, 0x8c, 0x95, 0x95, 0x90, 0x87, 0x7b, 0x6d, 0x64, 0x67,
+  0x6c, 0x76, 0x8a, 0x9c, 0xa1, 0x9c, 0x8d, 0x77, 0x64, 0x5a, 0x5c, 0x6b,
+  0x7e, 0x8e, 0x9b, 0x9c, 0x96, 0x8d, 0x7c, 0x67, 0x5c, 0x60, 0x6d, 0x7c,
+  0x8b, 0x9a, 0xa0, 0x98, 0x8a, 0x80, 0x75, 0x67, 0x60, 0x66, 0x73, 0x83,
+  0x90, 0x9a, 0x9d, 0x97, 0x88, 0x79, 0x6a, 0x62, 0x67, 0x6d, 0x76, 0x87,
+  0x9b, 0xa1, 0x99, 0x8a, 0x78, 0x6b, 0x5e, 0x5d, 0x6a, 0x79, 0x88, 0x99,
+  0xa0, 0x99, 0x8d, 0x7c, 0x6c, 0x63, 0x63, 0x6a, 0x76, 0x84, 0x92, 0x9d,
+  0x9a, 0x8e, 0x83, 0x78, 0x6b, 0x63, 0x68, 0x75, 0x81, 0x8b, 0x95, 0x98,
+  0x92, 0x88, 0x7d, 0x70, 0x65, 0x66, 0x6d, 0x76, 0x84, 0x91, 0x9a, 0x96,
+  0x8e, 0x85, 0x7a, 0x6b, 0x62, 0x69, 0x73, 0x79, 0x84, 0x91, 0x96, 0x95,
+  0x90, 0x88, 0x7d, 0x6f, 0x67, 0x6a, 0x70, 0x79, 0x86, 0x8f, 0x93, 0x93,
+  0x90, 0x8b, 0x80, 0x72, 0x66, 0x66, 0x6d, 0x76, 0x82, 0x8d, 0x95, 0x97,
+  0x91, 0x8a, 0x81, 0x73, 0x67, 0x65, 0x6d, 0x74, 0x7a, 0x83, 0x91, 0x98,
+  0x94, 0x8f, 0x86, 0x78, 0x68, 0x64, 0x6b, 0x72, 0x78, 0x80, 0x8d, 0x97,
+  0x95, 0x90, 0x8a, 0x7d, 0x6d, 0x64, 0x65, 0x6b, 0x74, 0x82, 0x90, 0x99,
+  0x99, 0x94, 0x8f, 0x81, 0x70, 0x64, 0x62, 0x68, 0x72, 0x81, 0x90, 0x9c,
+  0x9e, 0x98, 0x8f, 0x7e, 0x6d, 0x62, 0x60, 0x67, 0x71, 0x7e, 0x8d, 0x99,
+  0x9c, 0x97, 0x8e, 0x80, 0x72, 0x66, 0x62, 0x6a, 0x72, 0x7c, 0x86, 0x90,
+  0x96, 0x94, 0x91, 0x89, 0x7b, 0x6d, 0x66, 0x67, 0x6d, 0x74, 0x7f, 0x8d,
+  0x97, 0x9b, 0x98, 0x8e, 0x7f, 0x6f, 0x63, 0x61, 0x67, 0x6e, 0x79, 0x88,
+  0x97, 0x9f, 0x9e, 0x96, 0x86, 0x74, 0x65, 0x5f, 0x61, 0x68, 0x70, 0x7e,
+  0x91, 0xa0, 0xa3, 0x9d, 0x91, 0x81, 0x70, 0x62, 0x5d, 0x63, 0x6c, 0x76,
+  0x87, 0x9a, 0xa4, 0xa0, 0x95, 0x88, 0x7b, 0x6e, 0x63, 0x62, 0x6a, 0x73,
+  0x7c, 0x8a, 0x98, 0x9e, 0x98, 0x8e, 0x83, 0x78, 0x6c, 0x65, 0x69, 0x71,
+  0x77, 0x7d, 0x87, 0x91, 0x96, 0x93, 0x8b, 0x81, 0x79, 0x73, 0x6e, 0x6d,
+  0x71, 0x76, 0x7a, 0x82, 0x8a, 0x8e, 0x8d, 0x8a, 0x84, 0x7f, 0x7a, 0x73,
+  0x6f, 0x6f, 0x74, 0x78, 0x7e, 0x86, 0x8c, 0x8d, 0x8a, 0x88, 0x85, 0x7f,
+  0x75, 0x6e, 0x6f, 0x74, 0x76, 0x7b, 0x86, 0x8e, 0x90, 0x8f, 0x8c, 0x86,
+  0x7d, 0x73, 0x6f, 0x71, 0x75, 0x75, 0x7a, 0x83, 0x8c, 0x90, 0x8e, 0x8b,
+  0x86, 0x80, 0x78, 0x71, 0x6f, 0x71, 0x72, 0x75, 0x7e, 0x89, 0x90, 0x91,
+  0x90, 0x8b, 0x83, 0x77, 0x6d, 0x6a, 0x6d, 0x74, 0x7e, 0x84, 0x82, 0x7b,
+  0x78, 0x80, 0x8f, 0x9f, 0xa1, 0x93, 0x7c, 0x66, 0x5e, 0x63, 0x6f, 0x8a,
+  0xa8, 0xb1, 0x99, 0x67, 0x4b, 0x56, 0x72, 0x86, 0x97, 0x9a, 0x81, 0x5f,
+  0x53, 0x68, 0x84, 0x9c, 0xac, 0xad, 0x91, 0x60, 0x4b, 0x58, 0x72, 0x84,
+  0x99, 0xa4, 0x8f, 0x70, 0x66, 0x79, 0x8b, 0x91, 0x9c, 0xab, 0x9d, 0x67,
+  0x43, 0x50, 0x70, 0x89, 0x98, 0x9d, 0x91, 0x79, 0x69, 0x71, 0x85, 0x91,
+  0x98, 0xa1, 0x95, 0x69, 0x42, 0x44, 0x5b, 0x78, 0x96, 0xad, 0xaa, 0x8d,
+  0x6f, 0x68, 0x79, 0x84, 0x87, 0x90, 0x8c, 0x6d, 0x49, 0x4a, 0x68, 0x87,
+  0xa1, 0xb4, 0xae, 0x91, 0x70, 0x5b, 0x5d, 0x6c, 0x79, 0x90, 0x9e, 0x89,
+  0x62, 0x53, 0x69, 0x88, 0xa1, 0xb0, 0xab, 0x8c, 0x61, 0x4b, 0x56, 0x74,
+  0x89, 0x95, 0x9f, 0x97, 0x7c, 0x60, 0x62, 0x79, 0x90, 0xa6, 0xa7, 0x8f,
+  0x6a, 0x4f, 0x51, 0x6a, 0x85, 0x98, 0xac, 0xac, 0x8d, 0x65, 0x55, 0x67,
+  0x77, 0x87, 0x98, 0x9f, 0x8f, 0x6c, 0x4d, 0x51, 0x77, 0x93, 0x9a, 0x9f,
+  0xa4, 0xa6, 0x90, 0x6b, 0x4b, 0x4a, 0x5c, 0x67, 0x7e, 0x9c, 0xab, 0x9f,
+  0x8a, 0x75, 0x66, 0x66, 0x72, 0x8b, 0xa1, 0xac, 0xa2, 0x86, 0x55, 0x31,
+  0x40, 0x68, 0x81, 0x91, 0xa7, 0xb7, 0xae, 0x8a, 0x63, 0x63, 0x70, 0x73,
+  0x79, 0x8a, 0xa3, 0xaa, 0x94, 0x5e, 0x3b, 0x45, 0x68, 0x85, 0x9d, 0xb5,
+  0xb5, 0xa6, 0x88, 0x5e, 0x4f, 0x56, 0x63, 0x74, 0x8d, 0xae, 0xb8, 0xa6,
+  0x69, 0x41, 0x4f, 0x71, 0x84, 0x8f, 0xa6, 0xa2, 0x8d, 0x73, 0x5f, 0x5e,
+  0x64, 0x6e, 0x7b, 0x98, 0xb6, 0xbd, 0xa9, 0x6c, 0x3a, 0x40, 0x6a, 0x7e,
+  0x7e, 0x8a, 0x91, 0x95, 0x8e, 0x7c, 0x72, 0x6d, 0x6c, 0x73, 0x91, 0xb4,
+  0xba, 0xa1, 0x63, 0x33, 0x3b, 0x61, 0x73, 0x78, 0x8c, 0xa1, 0xb5, 0xb1,
+  0x90, 0x6d, 0x5b, 0x5f, 0x6d, 0x8a, 0xaa, 0xb2, 0x9f, 0x69, 0x36, 0x3a,
+  0x62, 0x76, 0x7f, 0x93, 0xa8, 0xbc, 0xbd, 0xa4, 0x7b, 0x52, 0x35, 0x3b,
+  0x63, 0x91, 0xac, 0xb3, 0x9f, 0x7a, 0x6f, 0x70, 0x6d, 0x6e, 0x6f, 0x68,
+  0x6f, 0x8e, 0xa7, 0xad, 0xa2, 0x91, 0x7b, 0x5f, 0x45, 0x49, 0x6b, 0x89,
+  0x9d, 0xa7, 0xab, 0x9e, 0x89, 0x78, 0x64, 0x68, 0x7b, 0x7e, 0x67, 0x4e,
+  0x56, 0x7a, 0xa4, 0xb6, 0xaf, 0x98, 0x70, 0x4f, 0x54, 0x6d, 0x8a, 0xa4,
+  0xa8, 0x97, 0x86, 0x88, 0x89, 0x6f, 0x58, 0x59, 0x5f, 0x5e, 0x60, 0x75,
+  0x9c, 0xc2, 0xcc, 0xbb, 0x9d, 0x69, 0x41, 0x3f, 0x50, 0x74, 0x97, 0xa2,
+  0x99, 0x84, 0x82, 0x84, 0x78, 0x73, 0x71, 0x6a, 0x5f, 0x62, 0x7d, 0xa7,
+  0xbe, 0xb2, 0x96, 0x6e, 0x45, 0x37, 0x4c, 0x6a, 0x92, 0xad, 0xae, 0xa3,
+  0x92, 0x8e, 0x84, 0x6f, 0x67, 0x62, 0x5b, 0x55, 0x63, 0x81, 0x9d, 0xae,
+  0xac, 0x9c, 0x7b, 0x58, 0x51, 0x65, 0x80, 0x9a, 0xa5, 0x9e, 0x8d, 0x7f,
+  0x85, 0x7f, 0x6b, 0x66, 0x69, 0x60, 0x52, 0x5a, 0x73, 0x8f, 0xa3, 0xac,
+  0xb5, 0xb5, 0x9d, 0x86, 0x74, 0x62, 0x57, 0x54, 0x59, 0x61, 0x7b, 0xa3,
+  0xb2, 0x9e, 0x87, 0x75, 0x70, 0x7a, 0x83, 0x8c, 0x96, 0x88, 0x5f, 0x45,
+  0x4f, 0x70, 0x91, 0x9c, 0x9e, 0xa0, 0x91, 0x7f, 0x76, 0x72, 0x6e, 0x67,
+  0x68, 0x70, 0x84, 0xa6, 0xc2, 0xbb, 0x95, 0x72, 0x5f, 0x5d, 0x5a, 0x60,
+  0x79, 0x84, 0x73, 0x5c, 0x5d, 0x6f, 0x8a, 0xa5, 0xae, 0xb4, 0xae, 0x97,
+  0x83, 0x73, 0x65, 0x5d, 0x5f, 0x60, 0x61, 0x71, 0x91, 0xa5, 0x9c, 0x8e,
+  0x80, 0x7b, 0x83, 0x83, 0x8b, 0x94, 0x85, 0x5f, 0x4c, 0x54, 0x65, 0x7e,
+  0x8e, 0x9a, 0xa7, 0xa3, 0x8e, 0x7a, 0x6c, 0x5f, 0x5f, 0x69, 0x71, 0x7c,
+  0x99, 0xb5, 0xb2, 0x9e, 0x85, 0x6b, 0x5e, 0x57, 0x5c, 0x6c, 0x78, 0x6e,
+  0x61, 0x68, 0x79, 0x95, 0xaa, 0xac, 0xaf, 0xb0, 0x9e, 0x82, 0x6b, 0x59,
+  0x4c, 0x4b, 0x4f, 0x5b, 0x76, 0x97, 0xac, 0xb6, 0xb1, 0x94, 0x72, 0x62,
+  0x6d, 0x88, 0x9b, 0x9c, 0x96, 0x90, 0x75, 0x54, 0x47, 0x49, 0x57, 0x6b,
+  0x7e, 0x87, 0x88, 0x88, 0x91, 0xa2, 0xa4, 0x9b, 0x94, 0x8f, 0x88, 0x88,
+  0x90, 0x86, 0x66, 0x4b, 0x49, 0x5d, 0x75, 0x8a, 0x99, 0xa2, 0x99, 0x7e,
+  0x68, 0x66, 0x77, 0x8c, 0x94, 0x8d, 0x8c, 0x94, 0x87, 0x67, 0x52, 0x56,
+  0x60, 0x6b, 0x7c, 0x8f, 0x9b, 0x91, 0x85, 0x8b, 0x96, 0x98, 0x97, 0x8f,
+  0x7f, 0x78, 0x7c, 0x77, 0x68, 0x5b, 0x5a, 0x6e, 0x8f, 0xa3, 0xa2, 0x9d,
+  0x93, 0x7f, 0x6a, 0x60, 0x66, 0x73, 0x7a, 0x80, 0x92, 0xa0, 0x88, 0x5d,
+  0x49, 0x52, 0x64, 0x79, 0x88, 0x92, 0x98, 0x9a, 0xa3, 0xad, 0xa5, 0x91,
+  0x81, 0x74, 0x65, 0x60, 0x6a, 0x6d, 0x64, 0x5d, 0x5e, 0x70, 0x8c, 0xa1,
+  0xa9, 0xaa, 0xa3, 0x8c, 0x72, 0x67, 0x6f, 0x7e, 0x7d, 0x71, 0x75, 0x88,
+  0x7f, 0x62, 0x56, 0x62, 0x74, 0x82, 0x8c, 0x8e, 0x8d, 0x8a, 0x8f, 0x9b,
+  0xa1, 0x96, 0x84, 0x74, 0x69, 0x71, 0x89, 0x8d, 0x7d, 0x6c, 0x60, 0x66,
+  0x77, 0x83, 0x85, 0x8a, 0x8f, 0x8c, 0x85, 0x81, 0x83, 0x88, 0x8a, 0x87,
+  0x86, 0x88, 0x83, 0x7b, 0x78, 0x78, 0x78, 0x7a, 0x76, 0x6f, 0x6d, 0x71,
+  0x78, 0x7c, 0x7c, 0x79, 0x77, 0x73, 0x71, 0x7c, 0x8e, 0x97, 0x96, 0x91,
+  0x8b, 0x89, 0x8b, 0x8a, 0x7f, 0x73, 0x72, 0x7c, 0x80, 0x7b, 0x73, 0x70,
+  0x71, 0x71, 0x76, 0x7c, 0x81, 0x85, 0x86, 0x84, 0x86, 0x8b, 0x8d, 0x8e,
+  0x8f, 0x91, 0x8f, 0x89, 0x7d, 0x75, 0x76, 0x7b, 0x7d, 0x78, 0x71, 0x69,
+  0x68, 0x6f, 0x77, 0x7f, 0x87, 0x89, 0x82, 0x7b, 0x7c, 0x85, 0x8d, 0x8d,
+  0x8a, 0x8a, 0x88, 0x81, 0x7c, 0x7b, 0x7f, 0x84, 0x84, 0x7b, 0x71, 0x6a,
+  0x66, 0x68, 0x6d, 0x73, 0x79, 0x7d, 0x81, 0x82, 0x87, 0x8c, 0x94, 0x96,
+  0x90, 0x8b, 0x8b, 0x89, 0x83, 0x7d, 0x7b, 0x77, 0x71, 0x69, 0x65, 0x69,
+  0x71, 0x78, 0x7c, 0x82, 0x84, 0x85, 0x87, 0x89, 0x8c, 0x91, 0x94, 0x90,
+  0x88, 0x7e, 0x76, 0x73, 0x70, 0x6d, 0x6f, 0x73, 0x78, 0x7c, 0x83, 0x89,
+  0x8c, 0x8f, 0x90, 0x8d, 0x88, 0x87, 0x85, 0x80, 0x7a, 0x75, 0x71, 0x6e,
+  0x6c, 0x70, 0x75, 0x79, 0x7d, 0x87, 0x90, 0x91, 0x90, 0x8c, 0x88, 0x88,
+  0x89, 0x88, 0x82, 0x7a, 0x70, 0x67, 0x65, 0x68, 0x6d, 0x72, 0x75, 0x79,
+  0x84, 0x8c, 0x90, 0x92, 0x94, 0x94, 0x92, 0x8f, 0x8b, 0x85, 0x7c, 0x71,
+  0x6a, 0x66, 0x60, 0x61, 0x67, 0x6e, 0x77, 0x84, 0x8f, 0x95, 0x96, 0x93,
+  0x90, 0x91, 0x92, 0x8e, 0x87, 0x7e, 0x75, 0x6e, 0x6b, 0x6b, 0x6d, 0x6d,
+  0x6d, 0x73, 0x81, 0x8b, 0x8d, 0x8c, 0x8d, 0x8e, 0x91, 0x90, 0x8b, 0x84,
+  0x7c, 0x75, 0x73, 0x71, 0x6d, 0x6b, 0x6c, 0x70, 0x7a, 0x86, 0x8d, 0x8c,
+  0x89, 0x87, 0x8a, 0x8c, 0x8f, 0x8b, 0x80, 0x73, 0x6b, 0x6a, 0x6c, 0x6d,
+  0x6f, 0x72, 0x77, 0x83, 0x8f, 0x96, 0x97, 0x92, 0x8d, 0x89, 0x87, 0x83,
+  0x7b, 0x6f, 0x66, 0x65, 0x6a, 0x70, 0x77, 0x7d, 0x83, 0x89, 0x8d, 0x92,
+  0x95, 0x94, 0x8f, 0x88, 0x84, 0x81, 0x7a, 0x70, 0x68, 0x67, 0x6b, 0x72,
+  0x79, 0x7f, 0x83, 0x86, 0x8a, 0x8f, 0x92, 0x90, 0x8a, 0x83, 0x7d, 0x7a,
+  0x78, 0x74, 0x70, 0x6b, 0x6d, 0x76, 0x81, 0x87, 0x89, 0x88, 0x8a, 0x8c,
+  0x8b, 0x8c, 0x8b, 0x82, 0x77, 0x70, 0x6e, 0x70, 0x71, 0x71, 0x75, 0x7e,
+  0x87, 0x8b, 0x8c, 0x8d, 0x8c, 0x8b, 0x89, 0x86, 0x80, 0x77, 0x70, 0x6c,
+  0x6e, 0x71, 0x76, 0x78, 0x7b, 0x82, 0x88, 0x8c, 0x8f, 0x8f, 0x8b, 0x87,
+  0x85, 0x81, 0x7a, 0x75, 0x71, 0x6f, 0x6e, 0x70, 0x76, 0x7f, 0x85, 0x88,
+  0x8a, 0x8d, 0x8e, 0x8a, 0x88, 0x86, 0x81, 0x78, 0x70, 0x6e, 0x6f, 0x72,
+  0x74, 0x78, 0x7e, 0x84, 0x89, 0x8a, 0x8c, 0x8c, 0x89, 0x86, 0x81, 0x7a,
+  0x74, 0x72, 0x72, 0x72, 0x75, 0x7b, 0x82, 0x86, 0x87, 0x87, 0x89, 0x89,
+  0x86, 0x80, 0x79, 0x74, 0x73, 0x75, 0x77, 0x79, 0x7c, 0x82, 0x89, 0x8b,
+  0x8a, 0x88, 0x86, 0x85, 0x81, 0x7b, 0x74, 0x6f, 0x6d, 0x71, 0x78, 0x7d,
+  0x82, 0x8a, 0x8e, 0x8e, 0x8d, 0x8c, 0x88, 0x82, 0x7d, 0x76, 0x70, 0x6c,
+  0x6a, 0x6f, 0x76, 0x7f, 0x89, 0x90, 0x90, 0x8f, 0x8f, 0x8d, 0x89, 0x81,
+  0x77, 0x6e, 0x6b, 0x68, 0x6a, 0x71, 0x77, 0x7e, 0x88, 0x92, 0x93, 0x92,
+  0x90, 0x8d, 0x8a, 0x82, 0x78, 0x6e, 0x69, 0x6a, 0x71, 0x76, 0x7a, 0x7e,
+  0x88, 0x8f, 0x8f, 0x8e, 0x8a, 0x87, 0x85, 0x81, 0x79, 0x72, 0x6c, 0x6c,
+  0x71, 0x77, 0x7c, 0x80, 0x88, 0x8c, 0x8d, 0x8d, 0x8b, 0x86, 0x81, 0x7b,
+  0x76, 0x72, 0x6f, 0x71, 0x74, 0x7a, 0x80, 0x88, 0x8d, 0x8c, 0x8e, 0x8e,
+  0x8a, 0x82, 0x77, 0x6b, 0x62, 0x60, 0x68, 0x74, 0x7f, 0x89, 0x90, 0x95,
+  0x96, 0x95, 0x92, 0x90, 0x8b, 0x82, 0x7e, 0x7c, 0x7b, 0x78, 0x78, 0x77,
+  0x74, 0x6e, 0x67, 0x64, 0x66, 0x6b, 0x70, 0x73, 0x79, 0x82, 0x8b, 0x93,
+  0x96, 0x9c, 0xa0, 0x98, 0x87, 0x74, 0x71, 0x7e, 0x86, 0x88, 0x88, 0x8b,
+  0x81, 0x6a, 0x54, 0x54, 0x6a, 0x7f, 0x89, 0x8a, 0x87, 0x83, 0x83, 0x84,
+  0x87, 0x88, 0x8b, 0x8b, 0x85, 0x83, 0x8e, 0x9f, 0xa4, 0x9b, 0x8a, 0x7e,
+  0x75, 0x69, 0x5b, 0x51, 0x4c, 0x4e, 0x54, 0x61, 0x77, 0x8e, 0x9f, 0xa5,
+  0xa3, 0xa1, 0xa4, 0x9a, 0x80, 0x64, 0x55, 0x5c, 0x71, 0x7f, 0x8b, 0x98,
+  0xa4, 0x9a, 0x7d, 0x63, 0x59, 0x5f, 0x63, 0x69, 0x70, 0x78, 0x7a, 0x7c,
+  0x85, 0x96, 0xa8, 0xb2, 0xaa, 0x98, 0x8e, 0x91, 0x96, 0x8f, 0x81, 0x72,
+  0x6a, 0x63, 0x5f, 0x62, 0x68, 0x6d, 0x6c, 0x68, 0x6b, 0x7a, 0x8a, 0x8d,
+  0x8d, 0x8f, 0x97, 0x90, 0x7b, 0x70, 0x78, 0x8a, 0x92, 0x97, 0x9c, 0x94,
+  0x72, 0x49, 0x3c, 0x4e, 0x66, 0x77, 0x82, 0x93, 0xa0, 0xa6, 0xaf, 0xb4,
+  0xa7, 0x8d, 0x75, 0x61, 0x52, 0x4d, 0x55, 0x65, 0x7b, 0x92, 0xa3, 0xaf,
+  0xaf, 0x99, 0x78, 0x65, 0x61, 0x64, 0x69, 0x6f, 0x81, 0x92, 0x89, 0x6b,
+  0x5b, 0x63, 0x72, 0x7b, 0x7f, 0x87, 0x8d, 0x8f, 0x94, 0x9f, 0xa8, 0xa8,
+  0x9b, 0x82, 0x68, 0x59, 0x58, 0x59, 0x5e, 0x69, 0x7b, 0x91, 0xa4, 0xa2,
+  0x8c, 0x7f, 0x82, 0x88, 0x86, 0x7f, 0x82, 0x8c, 0x82, 0x5e, 0x48, 0x55,
+  0x70, 0x82, 0x8b, 0x97, 0x9c, 0x97, 0x91, 0x8d, 0x8b, 0x8a, 0x83, 0x74,
+  0x64, 0x60, 0x6d, 0x79, 0x7d, 0x7e, 0x89, 0x99, 0xa2, 0x98, 0x7a, 0x62,
+  0x61, 0x70, 0x7f, 0x87, 0x90, 0x9c, 0x92, 0x6b, 0x4d, 0x4f, 0x5f, 0x6b,
+  0x72, 0x81, 0x92, 0x9a, 0xa1, 0xa8, 0xa7, 0xa2, 0x99, 0x87, 0x6b, 0x54,
+  0x53, 0x64, 0x71, 0x7c, 0x8d, 0x9b, 0x97, 0x8e, 0x85, 0x7c, 0x74, 0x68,
+  0x63, 0x6a, 0x73, 0x6d, 0x69, 0x76, 0x91, 0xad, 0xb5, 0xb0, 0xa1, 0x82,
+  0x5c, 0x48, 0x4d, 0x5a, 0x65, 0x7d, 0x9b, 0xaf, 0xb1, 0xa6, 0x98, 0x84,
+  0x6e, 0x57, 0x53, 0x62, 0x6d, 0x71, 0x71, 0x76, 0x83, 0x9b, 0xa9, 0xaa,
+  0xa5, 0x8b, 0x67, 0x55, 0x54, 0x5b, 0x68, 0x7f, 0x96, 0xa4, 0xad, 0xa1,
+  0x8b, 0x75, 0x63, 0x59, 0x5d, 0x73, 0x84, 0x88, 0x7f, 0x7b, 0x89, 0x99,
+  0x9a, 0x8e, 0x87, 0x81, 0x73, 0x69, 0x66, 0x65, 0x67, 0x7a, 0x97, 0xa6,
+  0xa5, 0x93, 0x7c, 0x71, 0x6e, 0x6b, 0x6a, 0x7a, 0x8d, 0x8d, 0x79, 0x6a,
+  0x6a, 0x70, 0x79, 0x85, 0x9c, 0xa7, 0x96, 0x7f, 0x79, 0x75, 0x6c, 0x6d,
+  0x7e, 0x89, 0x89, 0x88, 0x81, 0x7a, 0x75, 0x75, 0x7a, 0x85, 0x90, 0x8e,
+  0x7a, 0x61, 0x5a, 0x61, 0x73, 0x88, 0x9e, 0xb2, 0xad, 0x93, 0x7d, 0x6c,
+  0x59, 0x51, 0x68, 0x83, 0x84, 0x87, 0x9a, 0x9f, 0x99, 0x80, 0x67, 0x66,
+  0x70, 0x70, 0x69, 0x78, 0x8f, 0x9e, 0xa1, 0x98, 0x8a, 0x76, 0x5e, 0x5d,
+  0x77, 0x8f, 0x90, 0x8e, 0x90, 0x88, 0x7c, 0x72, 0x71, 0x6e, 0x6c, 0x63,
+  0x67, 0x7b, 0x90, 0xa5, 0xa8, 0x97, 0x7f, 0x66, 0x5b, 0x6b, 0x8a, 0x9b,
+  0x9c, 0x96, 0x7e, 0x67, 0x55, 0x5c, 0x78, 0x8e, 0x8c, 0x7e, 0x80, 0x88,
+  0x8c, 0x8a, 0x81, 0x71, 0x5c, 0x5e, 0x7b, 0xa1, 0xb0, 0xa6, 0x98, 0x7a,
+  0x59, 0x48, 0x57, 0x75, 0x86, 0x87, 0x7e, 0x87, 0x96, 0xa4, 0xa2, 0x8b,
+  0x70, 0x54, 0x48, 0x5e, 0x8a, 0xa6, 0xaa, 0xac, 0x9d, 0x82, 0x65, 0x54,
+  0x5c, 0x67, 0x71, 0x76, 0x88, 0x98, 0xa1, 0xa1, 0x92, 0x7a, 0x61, 0x51,
+  0x51, 0x71, 0x98, 0xaa, 0xb0, 0xa8, 0x8c, 0x6b, 0x4e, 0x4d, 0x5f, 0x74,
+  0x7b, 0x84, 0x96, 0xa3, 0xa5, 0x9d, 0x8d, 0x72, 0x54, 0x45, 0x54, 0x78,
+  0x92, 0xae, 0xc0, 0xac, 0x80, 0x50, 0x43, 0x51, 0x6c, 0x83, 0x97, 0xac,
+  0xa8, 0x92, 0x75, 0x66, 0x6a, 0x76, 0x76, 0x7f, 0x96, 0x9e, 0x8f, 0x73,
+  0x5d, 0x5a, 0x69, 0x79, 0x8f, 0xa3, 0xa3, 0x8f, 0x73, 0x60, 0x68, 0x7d,
+  0x82, 0x8e, 0xa1, 0xa7, 0x8f, 0x65, 0x47, 0x41, 0x65, 0x8e, 0xac, 0xb9,
+  0xa5, 0x86, 0x65, 0x51, 0x56, 0x71, 0x83, 0x97, 0xa8, 0xac, 0x9f, 0x78,
+  0x57, 0x41, 0x4a, 0x63, 0x7f, 0xa7, 0xbb, 0xb0, 0x8b, 0x67, 0x5c, 0x65,
+  0x6a, 0x77, 0x8d, 0x9c, 0x9e, 0x86, 0x6a, 0x5b, 0x62, 0x78, 0x8a, 0x98,
+  0x97, 0x85, 0x6c, 0x5f, 0x6d, 0x8c, 0x96, 0x96, 0x99, 0x92, 0x89, 0x6f,
+  0x56, 0x4b, 0x5b, 0x7b, 0x98, 0xb5, 0xb7, 0xa0, 0x76, 0x4e, 0x45, 0x66,
+  0x89, 0x9e, 0xac, 0xa5, 0x92, 0x76, 0x5d, 0x49, 0x46, 0x61, 0x80, 0xa7,
+  0xc0, 0xb7, 0x91, 0x5c, 0x41, 0x53, 0x79, 0x94, 0xa6, 0xa5, 0x9b, 0x89,
+  0x75, 0x69, 0x60, 0x68, 0x68, 0x6e, 0x79, 0x82, 0x88, 0x84, 0x83, 0x8b,
+  0x92, 0x8d, 0x7d, 0x66, 0x62, 0x76, 0x97, 0xa5, 0x96, 0x89, 0x7f, 0x77,
+  0x72, 0x74, 0x78, 0x72, 0x6f, 0x7f, 0x9e, 0xae, 0x9c, 0x75, 0x5a, 0x58,
+  0x65, 0x7d, 0x8c, 0x93, 0x96, 0x94, 0x87, 0x73, 0x67, 0x5d, 0x5b, 0x71,
+  0x91, 0xa7, 0xa7, 0x96, 0x78, 0x61, 0x5f, 0x69, 0x74, 0x7e, 0x8d, 0x9b,
+  0xa0, 0x9a, 0x87, 0x69, 0x53, 0x54, 0x6d, 0x89, 0x9e, 0xa1, 0x96, 0x8a,
+  0x81, 0x76, 0x69, 0x62, 0x66, 0x73, 0x86, 0x96, 0x9d, 0x99, 0x87, 0x71,
+  0x66, 0x69, 0x6e, 0x74, 0x7e, 0x8c, 0x96, 0x9c, 0x94, 0x82, 0x71, 0x62,
+  0x5b, 0x64, 0x7c, 0x92, 0x9c, 0xa0, 0x9c, 0x89, 0x71, 0x5f, 0x5a, 0x5f,
+  0x70, 0x8a, 0x9d, 0xa5, 0xa1, 0x8c, 0x73, 0x61, 0x56, 0x56, 0x6b, 0x8f,
+  0xa8, 0xae, 0xa1, 0x85, 0x6c, 0x5f, 0x5a, 0x61, 0x75, 0x8f, 0xa0, 0xa4,
+  0x9b, 0x87, 0x6f, 0x5c, 0x57, 0x64, 0x7e, 0x96, 0xa2, 0xa1, 0x96, 0x7e,
+  0x66, 0x5d, 0x62, 0x6e, 0x82, 0x97, 0x9f, 0x9a, 0x8b, 0x73, 0x61, 0x61,
+  0x6a, 0x77, 0x8c, 0x9e, 0xa2, 0x96, 0x80, 0x69, 0x5b, 0x5e, 0x6f, 0x84,
+  0x99, 0xa6, 0xa2, 0x89, 0x71, 0x61, 0x5c, 0x68, 0x7a, 0x8a, 0x9a, 0xa4,
+  0x99, 0x82, 0x70, 0x60, 0x5b, 0x67, 0x7a, 0x91, 0xa5, 0xa6, 0x92, 0x7c,
+  0x68, 0x5c, 0x62, 0x71, 0x82, 0x96, 0xa1, 0x9c, 0x8e, 0x79, 0x63, 0x59,
+  0x5f, 0x72, 0x8d, 0x9f, 0xa2, 0x98, 0x85, 0x6d, 0x60, 0x62, 0x6c, 0x7d,
+  0x8e, 0x9a, 0x9b, 0x92, 0x7c, 0x66, 0x5d, 0x62, 0x72, 0x85, 0x98, 0xa0,
+  0x97, 0x86, 0x72, 0x62, 0x63, 0x6d, 0x7a, 0x8c, 0x9b, 0x9c, 0x8e, 0x7c,
+  0x6a, 0x63, 0x69, 0x74, 0x86, 0x9a, 0xa1, 0x94, 0x80, 0x6a, 0x60, 0x65,
+  0x6f, 0x7e, 0x93, 0xa0, 0x9c, 0x8c, 0x78, 0x65, 0x60, 0x66, 0x74, 0x89,
+  0x9b, 0xa0, 0x95, 0x83, 0x6f, 0x61, 0x61, 0x6d, 0x80, 0x96, 0xa1, 0x99,
+  0x87, 0x74, 0x65, 0x63, 0x6f, 0x80, 0x8f, 0x9a, 0x98, 0x88, 0x77, 0x68,
+  0x61, 0x6a, 0x7c, 0x8e, 0x99, 0x97, 0x86, 0x74, 0x6a, 0x69, 0x74, 0x83,
+  0x8f, 0x93, 0x8d, 0x82, 0x75, 0x6e, 0x6d, 0x74, 0x84, 0x91, 0x96, 0x8e,
+  0x7f, 0x6f, 0x68, 0x6c, 0x77, 0x88, 0x94, 0x97, 0x8f, 0x80, 0x70, 0x67,
+  0x6b, 0x78, 0x89, 0x97, 0x9b, 0x91, 0x7e, 0x6c, 0x60, 0x66, 0x77, 0x89,
+  0x99, 0x9d, 0x91, 0x7d, 0x6c, 0x62, 0x66, 0x76, 0x87, 0x96, 0x9d, 0x93,
+  0x7e, 0x6b, 0x60, 0x64, 0x75, 0x87, 0x95, 0x9b, 0x92, 0x7e, 0x69, 0x5e,
+  0x64, 0x76, 0x8c, 0x9a, 0x9d, 0x91, 0x7b, 0x67, 0x5f, 0x67, 0x77, 0x8a,
+  0x99, 0x9d, 0x91, 0x7c, 0x6a, 0x60, 0x64, 0x76, 0x8b, 0x9b, 0xa0, 0x93,
+  0x7d, 0x69, 0x5f, 0x66, 0x78, 0x8b, 0x99, 0x9d, 0x92, 0x7e, 0x6b, 0x5f,
+  0x64, 0x76, 0x89, 0x99, 0x9e, 0x91, 0x7a, 0x68, 0x61, 0x6a, 0x7d, 0x8f,
+  0x9a, 0x97, 0x87, 0x75, 0x66, 0x65, 0x71, 0x84, 0x95, 0x9b, 0x93, 0x7f,
+  0x6b, 0x62, 0x68, 0x79, 0x8d, 0x9c, 0x99, 0x89, 0x75, 0x66, 0x63, 0x6f,
+  0x83, 0x97, 0x9e, 0x95, 0x80, 0x6a, 0x60, 0x65, 0x76, 0x8c, 0x9d, 0x9f,
+  0x8f, 0x79, 0x65, 0x5e, 0x68, 0x7a, 0x92, 0xa3, 0x9f, 0x8a, 0x74, 0x61,
+  0x5c, 0x69, 0x7e, 0x96, 0xa2, 0x9b, 0x86, 0x6f, 0x5f, 0x62, 0x70, 0x86,
+  0x9b, 0xa2, 0x95, 0x80, 0x6b, 0x62, 0x68, 0x76, 0x8b, 0x9a, 0x99, 0x8c,
+  0x7a, 0x6b, 0x67, 0x6f, 0x7e, 0x90, 0x97, 0x90, 0x82, 0x72, 0x6a, 0x6c,
+  0x76, 0x85, 0x91, 0x91, 0x87, 0x79, 0x6f, 0x6c, 0x71, 0x7d, 0x8b, 0x93,
+  0x8e, 0x81, 0x72, 0x69, 0x6b, 0x75, 0x84, 0x93, 0x94, 0x89, 0x7b, 0x6c,
+  0x69, 0x70, 0x7c, 0x8b, 0x96, 0x91, 0x86, 0x78, 0x6e, 0x6e, 0x75, 0x82,
+  0x8e, 0x90, 0x82, 0x71, 0x68, 0x6f, 0x84, 0x9a, 0xa5, 0x9e, 0x88, 0x72,
+  0x69, 0x66, 0x6c, 0x83, 0x9b, 0xa5, 0x8d, 0x60, 0x4b, 0x56, 0x70, 0x87,
+  0x9c, 0xa2, 0x8f, 0x72, 0x65, 0x70, 0x7b, 0x85, 0x91, 0x99, 0x87, 0x66,
+  0x5c, 0x70, 0x84, 0x8c, 0x95, 0x96, 0x85, 0x6f, 0x6a, 0x7f, 0x92, 0x92,
+  0x94, 0x95, 0x81, 0x5c, 0x4b, 0x62, 0x87, 0xa1, 0xa9, 0x9e, 0x80, 0x5d,
+  0x51, 0x63, 0x85, 0x9b, 0xa3, 0xa6, 0x96, 0x66, 0x3c, 0x45, 0x67, 0x8c,
+  0xab, 0xb6, 0xa3, 0x79, 0x50, 0x48, 0x65, 0x85, 0x9f, 0xb8, 0xb3, 0x84,
+  0x50, 0x40, 0x54, 0x72, 0x93, 0xb0, 0xb7, 0x9a, 0x6e, 0x54, 0x56, 0x69,
+  0x80, 0xa0, 0xb6, 0xa6, 0x76, 0x4f, 0x4f, 0x60, 0x7b, 0x9b, 0xab, 0x9f,
+  0x84, 0x6b, 0x65, 0x70, 0x76, 0x82, 0x97, 0x98, 0x82, 0x69, 0x64, 0x6f,
+  0x79, 0x86, 0x90, 0x8f, 0x80, 0x71, 0x75, 0x83, 0x88, 0x85, 0x87, 0x85,
+  0x76, 0x62, 0x61, 0x7a, 0x8a, 0x92, 0x9b, 0x97, 0x84, 0x69, 0x57, 0x62,
+  0x8b, 0x9e, 0x94, 0x91, 0x89, 0x85, 0x74, 0x60, 0x5a, 0x6b, 0x86, 0x86,
+  0x8d, 0x9a, 0x99, 0x83, 0x6e, 0x68, 0x6b, 0x76, 0x81, 0x8e, 0x9d, 0xa0,
+  0x92, 0x78, 0x56, 0x46, 0x5f, 0x86, 0x94, 0x94, 0x96, 0x9b, 0x8d, 0x6d,
+  0x57, 0x68, 0x84, 0x8b, 0x8a, 0x93, 0xa1, 0x9f, 0x81, 0x50, 0x40, 0x5b,
+  0x7e, 0x8f, 0x9c, 0xa8, 0x9a, 0x82, 0x6d, 0x5a, 0x62, 0x78, 0x87, 0x90,
+  0xa0, 0xab, 0xa0, 0x7c, 0x41, 0x33, 0x5c, 0x8a, 0x95, 0x9d, 0xaa, 0x9a,
+  0x7f, 0x66, 0x5c, 0x69, 0x7a, 0x87, 0x8e, 0xa0, 0xa9, 0x9e, 0x7c, 0x46,
+  0x34, 0x57, 0x8d, 0x9e, 0x9b, 0x99, 0x8e, 0x83, 0x74, 0x69, 0x6b, 0x75,
+  0x7f, 0x86, 0x9d, 0xa8, 0x98, 0x73, 0x43, 0x3c, 0x67, 0x90, 0x91, 0x8f,
+  0x90, 0x8e, 0x8f, 0x82, 0x6d, 0x62, 0x6b, 0x7b, 0x8a, 0xa2, 0xaa, 0x9d,
+  0x78, 0x42, 0x39, 0x66, 0x8d, 0x8e, 0x91, 0x97, 0x9b, 0x9d, 0x8c, 0x6f,
+  0x59, 0x54, 0x62, 0x85, 0xa5, 0xa9, 0xa3, 0x8e, 0x69, 0x59, 0x67, 0x7c,
+  0x84, 0x81, 0x67, 0x5b, 0x77, 0x95, 0xa5, 0xa3, 0xa0, 0x8f, 0x70, 0x59,
+  0x56, 0x6b, 0x84, 0x8c, 0x89, 0x95, 0x99, 0x94, 0x8a, 0x6f, 0x62, 0x6d,
+  0x71, 0x5e, 0x51, 0x6a, 0x98, 0xc1, 0xcb, 0xb6, 0x8b, 0x52, 0x31, 0x3b,
+  0x60, 0x8a, 0xac, 0xb8, 0xa6, 0x91, 0x91, 0x83, 0x62, 0x4a, 0x4c, 0x5b,
+  0x6b, 0x7d, 0x94, 0xb4, 0xc0, 0xab, 0x8c, 0x6a, 0x41, 0x38, 0x5c, 0x81,
+  0xa8, 0xbd, 0xb3, 0x92, 0x6f, 0x68, 0x5f, 0x5f, 0x77, 0x82, 0x7a, 0x6d,
+  0x6d, 0x7c, 0x9e, 0xad, 0xa0, 0x8e, 0x72, 0x5a, 0x61, 0x78, 0x86, 0x92,
+  0x91, 0x85, 0x7c, 0x81, 0x93, 0x8c, 0x7e, 0x78, 0x6b, 0x54, 0x4a, 0x62,
+  0x86, 0xa8, 0xbc, 0xb9, 0xa1, 0x74, 0x49, 0x44, 0x53, 0x70, 0x8d, 0x99,
+  0xa0, 0x9d, 0x9c, 0x9b, 0x7d, 0x61, 0x56, 0x4f, 0x47, 0x51, 0x74, 0x9c,
+  0xb5, 0xbb, 0xb5, 0xa4, 0x87, 0x68, 0x54, 0x49, 0x54, 0x6d, 0x81, 0x91,
+  0x9c, 0xae, 0xad, 0x8c, 0x6d, 0x5f, 0x62, 0x6e, 0x80, 0x92, 0x9c, 0x8c,
+  0x60, 0x40, 0x48, 0x68, 0x8c, 0xa8, 0xb5, 0xb6, 0xa6, 0x8e, 0x7d, 0x68,
+  0x59, 0x54, 0x55, 0x62, 0x7c, 0xa2, 0xbf, 0xba, 0x9b, 0x7d, 0x6b, 0x66,
+  0x61, 0x65, 0x79, 0x85, 0x72, 0x5e, 0x66, 0x7c, 0x91, 0x97, 0x9a, 0xa1,
+  0x9a, 0x84, 0x76, 0x73, 0x70, 0x70, 0x77, 0x7a, 0x71, 0x7a, 0x93, 0x9c,
+  0x8d, 0x80, 0x7d, 0x7f, 0x82, 0x82, 0x89, 0x8c, 0x7a, 0x52, 0x3c, 0x4e,
+  0x71, 0x94, 0xa9, 0xb2, 0xb7, 0xaf, 0x9a, 0x7b, 0x5a, 0x48, 0x46, 0x59,
+  0x73, 0x85, 0x9c, 0xb3, 0xad, 0x91, 0x80, 0x73, 0x6d, 0x67, 0x67, 0x7b,
+  0x90, 0x8c, 0x6c, 0x57, 0x59, 0x6e, 0x8b, 0x99, 0xa1, 0xa9, 0xa4, 0x96,
+  0x85, 0x6d, 0x57, 0x4d, 0x4f, 0x59, 0x6c, 0x91, 0xb7, 0xca, 0xc1, 0x95,
+  0x63, 0x4c, 0x53, 0x68, 0x7e, 0x8f, 0x99, 0x98, 0x7f, 0x5d, 0x57, 0x69,
+  0x6e, 0x6c, 0x75, 0x86, 0x8c, 0x88, 0x89, 0x97, 0xa8, 0xac, 0xa4, 0x8d,
+  0x75, 0x65, 0x65, 0x6c, 0x67, 0x5e, 0x5e, 0x6e, 0x86, 0x9b, 0xad, 0xb6,
+  0xa9, 0x7a, 0x4a, 0x45, 0x62, 0x84, 0x98, 0xa2, 0xa8, 0xa3, 0x88, 0x5c,
+  0x40, 0x3e, 0x4d, 0x61, 0x75, 0x8c, 0xa5, 0xb5, 0xb5, 0xac, 0x9d, 0x8f,
+  0x83, 0x73, 0x68, 0x66, 0x73, 0x81, 0x80, 0x71, 0x65, 0x65, 0x72, 0x82,
+  0x8e, 0x99, 0x98, 0x85, 0x70, 0x71, 0x82, 0x92, 0x93, 0x82, 0x7c, 0x80,
+  0x72, 0x58, 0x48, 0x53, 0x6e, 0x85, 0x8f, 0x96, 0x97, 0x90, 0x8e, 0x97,
+  0xa2, 0x9f, 0x94, 0x87, 0x7c, 0x78, 0x7b, 0x74, 0x5d, 0x4a, 0x48, 0x5e,
+  0x80, 0x95, 0x9f, 0xae, 0xb4, 0x9e, 0x7a, 0x64, 0x65, 0x6e, 0x75, 0x7c,
+  0x87, 0x92, 0x8a, 0x72, 0x61, 0x62, 0x6c, 0x74, 0x77, 0x7b, 0x80, 0x80,
+  0x7e, 0x88, 0x99, 0xa0, 0x9d, 0x94, 0x83, 0x76, 0x76, 0x76, 0x71, 0x6b,
+  0x69, 0x76, 0x8e, 0x9c, 0x98, 0x8e, 0x89, 0x85, 0x7d, 0x6f, 0x63, 0x63,
+  0x69, 0x71, 0x7e, 0x90, 0x96, 0x8c, 0x82, 0x78, 0x70, 0x6c, 0x6b, 0x6c,
+  0x73, 0x82, 0x91, 0x9b, 0x9d, 0x92, 0x87, 0x7b, 0x6e, 0x65, 0x65, 0x6e,
+  0x76, 0x7d, 0x85, 0x93, 0xa0, 0x9f, 0x93, 0x84, 0x75, 0x6f, 0x6d, 0x6c,
+  0x6d, 0x74, 0x84, 0x91, 0x98, 0x98, 0x94, 0x8a, 0x7a, 0x69, 0x60, 0x66,
+  0x6e, 0x74, 0x80, 0x92, 0xa3, 0xa4, 0x99, 0x87, 0x73, 0x66, 0x60, 0x65,
+  0x70, 0x76, 0x7d, 0x8b, 0x98, 0x9d, 0x9a, 0x8f, 0x7c, 0x69, 0x5f, 0x61,
+  0x6b, 0x76, 0x7e, 0x89, 0x94, 0x93, 0x8d, 0x8a, 0x83, 0x79, 0x6d, 0x69,
+  0x6e, 0x73, 0x79, 0x83, 0x91, 0x99, 0x97, 0x8e, 0x82, 0x76, 0x6b, 0x66,
+  0x69, 0x70, 0x7a, 0x84, 0x8f, 0x98, 0x99, 0x98, 0x90, 0x7e, 0x68, 0x5a,
+  0x5b, 0x67, 0x73, 0x7f, 0x8f, 0x9d, 0xa0, 0x9a, 0x90, 0x82, 0x74, 0x68,
+  0x61, 0x66, 0x70, 0x76, 0x7e, 0x8c, 0x9b, 0x9f, 0x97, 0x8b, 0x7f, 0x72,
+  0x65, 0x60, 0x68, 0x71, 0x79, 0x84, 0x91, 0x9c, 0x9b, 0x90, 0x83, 0x78,
+  0x6e, 0x65, 0x64, 0x6c, 0x74, 0x7b, 0x85, 0x92, 0x9a, 0x97, 0x90, 0x87,
+  0x7e, 0x76, 0x70, 0x6d, 0x70, 0x75, 0x78, 0x80, 0x8a, 0x90, 0x90, 0x8d,
+  0x89, 0x82, 0x7b, 0x72, 0x6b, 0x6e, 0x75, 0x7a, 0x80, 0x89, 0x91, 0x90,
+  0x8b, 0x86, 0x83, 0x7e, 0x72, 0x6a, 0x6b, 0x72, 0x77, 0x7e, 0x88, 0x8f,
+  0x90, 0x8d, 0x8a, 0x86, 0x80, 0x76, 0x6f, 0x70, 0x72, 0x73, 0x77, 0x82,
+  0x8d, 0x91, 0x8f, 0x8e, 0x8a, 0x81, 0x75, 0x6f, 0x71, 0x72, 0x71, 0x74,
+  0x7d, 0x87, 0x8c, 0x90, 0x91, 0x8c, 0x84, 0x7a, 0x71, 0x6d, 0x6e, 0x70,
+  0x74, 0x7c, 0x86, 0x8e, 0x91, 0x92, 0x8e, 0x86, 0x7e, 0x75, 0x6f, 0x6e,
+  0x6e, 0x6d, 0x72, 0x7d, 0x89, 0x93, 0x97, 0x93, 0x8d, 0x87, 0x80, 0x76,
+  0x6e, 0x68, 0x69, 0x6f, 0x78, 0x81, 0x8a, 0x91, 0x90, 0x8c, 0x89, 0x88,
+  0x84, 0x79, 0x6e, 0x6a, 0x6c, 0x73, 0x78, 0x7d, 0x84, 0x8c, 0x8f, 0x8c,
+  0x88, 0x87, 0x86, 0x7d, 0x72, 0x6c, 0x6f, 0x74, 0x76, 0x77, 0x7d, 0x87,
+  0x90, 0x91, 0x8d, 0x8c, 0x8b, 0x83, 0x75, 0x6f, 0x6d, 0x6e, 0x6c, 0x70,
+  0x7c, 0x8b, 0x94, 0x95, 0x93, 0x8f, 0x8c, 0x85, 0x78, 0x6e, 0x69, 0x68,
+  0x6c, 0x72, 0x7c, 0x88, 0x91, 0x95, 0x93, 0x8e, 0x8b, 0x87, 0x7b, 0x6d,
+  0x65, 0x65, 0x6e, 0x74, 0x7c, 0x86, 0x91, 0x96, 0x94, 0x8e, 0x89, 0x85,
+  0x7b, 0x70, 0x69, 0x69, 0x6e, 0x74, 0x7a, 0x82, 0x8d, 0x93, 0x90, 0x8d,
+  0x8a, 0x88, 0x80, 0x75, 0x6d, 0x68, 0x6a, 0x6e, 0x73, 0x7c, 0x88, 0x92,
+  0x96, 0x94, 0x8d, 0x89, 0x4c, 0x49, 0x53, 0x54, 0x3c, 0x00, 0x00, 0x00,
+  0x49, 0x4e, 0x46, 0x4f, 0x49, 0x53, 0x46, 0x54, 0x30, 0x00, 0x00, 0x00,
+  0x57, 0x48, 0x41, 0x4d, 0x20, 0x31, 0x2e, 0x33, 0x31, 0x20, 0x62, 0x79,
+  0x20, 0x41, 0x6e, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75, 0x6c, 0x68,
+  0x61, 0x6b, 0x20, 0x28, 0x6c, 0x69, 0x62, 0x73, 0x6e, 0x64, 0x66, 0x69,
+  0x6c, 0x65, 0x2d, 0x31, 0x2e, 0x30, 0x2e, 0x32, 0x35, 0x29, 0x00, 0x00,
+  0x69, 0x64, 0x33, 0x20, 0x44, 0x00, 0x00, 0x00, 0x49, 0x44, 0x33, 0x04,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x20,
+  0x05, 0x09, 0x05, 0x1d, 0x22, 0x26, 0x54, 0x58, 0x58, 0x58, 0x00, 0x00,
+  0x00, 0x24, 0x00, 0x00, 0x00, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x00, 0x57, 0x48, 0x41, 0x4d, 0x20, 0x31, 0x2e, 0x33, 0x31, 0x20,
+  0x62, 0x79, 0x20, 0x41, 0x6e, 0x64, 0x72, 0x65, 0x77, 0x20, 0x42, 0x75,
+  0x6c, 0x68, 0x61, 0x6b
+};
+
+uint8_t pacman_eatghost[4717] = {
+  0x52, 0x49, 0x46, 0x46, 0x65, 0x12, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
+  0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x40, 0x1f, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
+  0x64, 0x61, 0x74, 0x61, 0xed, 0x11, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x80, 0x7f, 0xb7, 0xdd, 0xda, 0xdb, 0xd6, 0xd4, 0xcf, 0xce, 0xca,
+  0xc8, 0xc5, 0xc3, 0xc0, 0xbe, 0xbc, 0xba, 0xb9, 0xb8, 0xb7, 0xb6, 0xb5,
+  0xb4, 0xb4, 0xb3, 0xb1, 0xb0, 0xae, 0xac, 0xab, 0xa8, 0xa7, 0xa6, 0xa4,
+  0xa3, 0xa1, 0xa0, 0x9e, 0x9d, 0x9c, 0x9b, 0x99, 0x98, 0x96, 0x95, 0x94,
+  0x93, 0x92, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x89, 0x89, 0x88, 0x87, 0x86,
+  0x85, 0x85, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e,
+  0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7b, 0x7c, 0x7b, 0x7b, 0x7a, 0x7b, 0x7a,
+  0x7b, 0x76, 0x67, 0x64, 0x63, 0x64, 0x63, 0x64, 0x64, 0x64, 0x65, 0x65,
+  0x66, 0x65, 0x66, 0x65, 0x66, 0x67, 0x66, 0x67, 0x68, 0x67, 0x68, 0x67,
+  0x68, 0x69, 0x68, 0x69, 0x6a, 0x6a, 0x69, 0x6a, 0x69, 0x69, 0x6a, 0x6a,
+  0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6c, 0x6b, 0x6c, 0x6b,
+  0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6e, 0x6d, 0x6e, 0x6d, 0x6e, 0x6e,
+  0x6f, 0x6e, 0x6f, 0x6f, 0x70, 0x6f, 0x70, 0x70, 0x72, 0x8a, 0x99, 0x98,
+  0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x91, 0x8f, 0x8f, 0x8e,
+  0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x87, 0x86,
+  0x86, 0x85, 0x84, 0x83, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7d,
+  0x7e, 0x7c, 0x7e, 0x75, 0x50, 0x46, 0x46, 0x45, 0x48, 0x48, 0x4a, 0x4b,
+  0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x54, 0x54, 0x56, 0x57, 0x59, 0x59,
+  0x5a, 0x5c, 0x5d, 0x60, 0x60, 0x61, 0x61, 0x62, 0x63, 0x63, 0x64, 0x65,
+  0x65, 0x66, 0x67, 0x67, 0x69, 0x68, 0x6a, 0x69, 0x6c, 0x67, 0x82, 0xad,
+  0xb2, 0xb4, 0xb2, 0xb1, 0xaf, 0xae, 0xac, 0xaa, 0xa9, 0xa8, 0xa6, 0xa4,
+  0xa3, 0xa1, 0xa1, 0x9f, 0x9f, 0x9c, 0x9c, 0x9a, 0x9a, 0x99, 0x97, 0x97,
+  0x95, 0x95, 0x94, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8e, 0x90, 0x8b, 0x91,
+  0x74, 0x3c, 0x34, 0x33, 0x35, 0x36, 0x38, 0x3a, 0x3c, 0x3e, 0x41, 0x42,
+  0x44, 0x46, 0x47, 0x48, 0x4b, 0x4c, 0x4e, 0x4f, 0x51, 0x51, 0x52, 0x53,
+  0x55, 0x56, 0x58, 0x58, 0x5d, 0xa0, 0xc3, 0xc3, 0xc5, 0xc1, 0xc0, 0xbd,
+  0xbd, 0xba, 0xb9, 0xb6, 0xb5, 0xb2, 0xb0, 0xae, 0xad, 0xaa, 0xa9, 0xa6,
+  0xa6, 0xa3, 0xa2, 0x9f, 0xa0, 0x9c, 0x9e, 0x99, 0x9e, 0x79, 0x33, 0x2a,
+  0x27, 0x2c, 0x2d, 0x30, 0x32, 0x35, 0x37, 0x39, 0x3b, 0x3d, 0x3f, 0x42,
+  0x45, 0x49, 0x4b, 0x4d, 0x4f, 0x51, 0x52, 0x54, 0x54, 0x56, 0x57, 0x59,
+  0x5a, 0x60, 0xac, 0xd4, 0xd4, 0xd6, 0xd2, 0xd1, 0xcd, 0xcc, 0xc9, 0xc7,
+  0xc5, 0xc3, 0xc1, 0xbe, 0xbb, 0xb8, 0xb5, 0xb3, 0xb0, 0xb0, 0xad, 0xac,
+  0xaa, 0xa9, 0xa6, 0xa7, 0xa0, 0xa8, 0x75, 0x2b, 0x25, 0x21, 0x26, 0x26,
+  0x2a, 0x2c, 0x2e, 0x31, 0x34, 0x38, 0x39, 0x3e, 0x3f, 0x43, 0x44, 0x48,
+  0x48, 0x4a, 0x4a, 0x4d, 0x4e, 0x52, 0xa1, 0xd2, 0xd1, 0xd6, 0xd1, 0xd3,
+  0xce, 0xcd, 0xc8, 0xc6, 0xc2, 0xc0, 0xbd, 0xbb, 0xb9, 0xb6, 0xb5, 0xb1,
+  0xb3, 0xad, 0xb4, 0x7c, 0x2e, 0x27, 0x23, 0x27, 0x28, 0x2a, 0x2d, 0x30,
+  0x34, 0x36, 0x3a, 0x3b, 0x40, 0x3f, 0x44, 0x43, 0x48, 0x46, 0x4b, 0x46,
+  0x60, 0xbb, 0xd8, 0xd9, 0xda, 0xd5, 0xd7, 0xd1, 0xd0, 0xcb, 0xca, 0xc4,
+  0xc3, 0xbf, 0xbe, 0xbb, 0xb9, 0xb7, 0xb5, 0xb4, 0xb1, 0xb1, 0x5f, 0x21,
+  0x21, 0x1c, 0x22, 0x21, 0x27, 0x28, 0x2e, 0x31, 0x34, 0x37, 0x39, 0x3d,
+  0x3f, 0x42, 0x42, 0x48, 0x44, 0x4c, 0x44, 0x78, 0xd1, 0xde, 0xe1, 0xde,
+  0xdd, 0xda, 0xd7, 0xd3, 0xce, 0xcc, 0xc6, 0xc5, 0xc0, 0xbf, 0xba, 0xba,
+  0xb5, 0xb7, 0xb1, 0xb5, 0xa1, 0x3c, 0x12, 0x12, 0x0f, 0x15, 0x15, 0x1b,
+  0x1c, 0x21, 0x21, 0x26, 0x27, 0x2b, 0x2c, 0x31, 0x32, 0x35, 0x37, 0x3d,
+  0x9f, 0xda, 0xd9, 0xde, 0xd8, 0xd8, 0xd2, 0xd3, 0xcf, 0xce, 0xcb, 0xca,
+  0xc7, 0xc5, 0xc4, 0xc0, 0xc0, 0x68, 0x23, 0x20, 0x1b, 0x21, 0x20, 0x26,
+  0x26, 0x2b, 0x2c, 0x2f, 0x32, 0x33, 0x37, 0x37, 0x3d, 0x3a, 0x87, 0xd4,
+  0xd8, 0xde, 0xd9, 0xda, 0xd6, 0xd6, 0xd4, 0xd1, 0xcf, 0xcc, 0xcc, 0xc8,
+  0xc9, 0xc2, 0xc9, 0x8b, 0x3e, 0x37, 0x32, 0x36, 0x36, 0x39, 0x3a, 0x3b,
+  0x3d, 0x3f, 0x42, 0x42, 0x47, 0x44, 0x4b, 0x44, 0x79, 0xcc, 0xd6, 0xdb,
+  0xd7, 0xd7, 0xd3, 0xd1, 0xd0, 0xcd, 0xcd, 0xc9, 0xc9, 0xc4, 0xc6, 0xbf,
+  0xc6, 0x96, 0x45, 0x39, 0x36, 0x38, 0x39, 0x3b, 0x3d, 0x3e, 0x40, 0x41,
+  0x45, 0x44, 0x48, 0x46, 0x4c, 0x46, 0x6d, 0xc0, 0xd0, 0xd4, 0xd2, 0xd0,
+  0xce, 0xcb, 0xca, 0xc6, 0xc7, 0xc2, 0xc3, 0xbd, 0xbf, 0xb8, 0xbd, 0xa1,
+  0x50, 0x3a, 0x38, 0x37, 0x3a, 0x39, 0x3d, 0x3c, 0x40, 0x3e, 0x43, 0x41,
+  0x48, 0x41, 0x61, 0xb0, 0xc0, 0xc3, 0xc2, 0xc2, 0xbf, 0xbf, 0xbe, 0xbd,
+  0xbb, 0xbc, 0xb8, 0xbb, 0xab, 0x5e, 0x45, 0x43, 0x43, 0x44, 0x45, 0x47,
+  0x47, 0x48, 0x49, 0x4b, 0x4c, 0x4f, 0x50, 0x90, 0xb9, 0xba, 0xbc, 0xb9,
+  0xb9, 0xb6, 0xb6, 0xb2, 0xb3, 0xaf, 0xb0, 0xab, 0xaf, 0x85, 0x53, 0x4f,
+  0x4c, 0x4f, 0x4e, 0x51, 0x51, 0x53, 0x53, 0x56, 0x56, 0x59, 0x56, 0x6e,
+  0x9c, 0xa3, 0xa5, 0xa3, 0xa3, 0xa1, 0xa1, 0x9f, 0x9f, 0x9d, 0x9e, 0x9b,
+  0x9c, 0x94, 0x6f, 0x63, 0x63, 0x63, 0x64, 0x65, 0x67, 0x67, 0x68, 0x69,
+  0x6a, 0x6a, 0x6b, 0x6c, 0x84, 0x93, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92,
+  0x91, 0x91, 0x8f, 0x90, 0x8e, 0x8f, 0x83, 0x77, 0x76, 0x75, 0x76, 0x76,
+  0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x78, 0x76, 0x7e, 0x8c, 0x8e, 0x8f,
+  0x8e, 0x8d, 0x8e, 0x8d, 0x8c, 0x8b, 0x8c, 0x8b, 0x8b, 0x87, 0x77, 0x72,
+  0x73, 0x72, 0x72, 0x73, 0x74, 0x73, 0x74, 0x74, 0x75, 0x76, 0x8f, 0x9c,
+  0x9c, 0x9d, 0x9c, 0x9c, 0x9a, 0x9b, 0x99, 0x99, 0x97, 0x98, 0x7b, 0x60,
+  0x5f, 0x5e, 0x5f, 0x5f, 0x61, 0x61, 0x64, 0x62, 0x66, 0x62, 0x7f, 0xaa,
+  0xad, 0xaf, 0xad, 0xad, 0xaa, 0xaa, 0xa7, 0xa7, 0xa3, 0xa7, 0x8d, 0x52,
+  0x48, 0x45, 0x47, 0x47, 0x49, 0x4a, 0x4d, 0x4d, 0x50, 0x4e, 0x5f, 0xa6,
+  0xbb, 0xbd, 0xbc, 0xb9, 0xb8, 0xb5, 0xb4, 0xb2, 0xb2, 0xae, 0xab, 0x64,
+  0x3b, 0x3b, 0x3a, 0x3f, 0x3f, 0x43, 0x43, 0x48, 0x47, 0x4e, 0x4b, 0x8c,
+  0xc6, 0xc7, 0xca, 0xc4, 0xc5, 0xbf, 0xc0, 0xbb, 0xbd, 0xb6, 0xbb, 0x86,
+  0x3a, 0x36, 0x31, 0x37, 0x36, 0x3b, 0x3a, 0x3f, 0x3d, 0x44, 0x40, 0x5e,
+  0xb7, 0xc9, 0xcc, 0xc9, 0xc8, 0xc3, 0xc3, 0xc0, 0xc0, 0xbb, 0xbb, 0xab,
+  0x52, 0x2f, 0x2f, 0x2e, 0x32, 0x32, 0x36, 0x37, 0x3c, 0x3c, 0x43, 0x97,
+  0xcd, 0xcb, 0xd0, 0xc8, 0xcb, 0xc3, 0xc6, 0xbe, 0xc3, 0xa5, 0x46, 0x2a,
+  0x2a, 0x2a, 0x2f, 0x2f, 0x36, 0x35, 0x3e, 0x38, 0x74, 0xc6, 0xcb, 0xd0,
+  0xca, 0xca, 0xc7, 0xc5, 0xc2, 0xbf, 0xbc, 0x5d, 0x1a, 0x1a, 0x14, 0x1c,
+  0x1a, 0x22, 0x21, 0x29, 0x25, 0x43, 0xad, 0xce, 0xcf, 0xd0, 0xcc, 0xcc,
+  0xc6, 0xc8, 0xbf, 0xc8, 0x8b, 0x2d, 0x20, 0x1a, 0x1e, 0x1e, 0x22, 0x24,
+  0x26, 0x2b, 0x2b, 0x88, 0xcd, 0xce, 0xd4, 0xcd, 0xd0, 0xca, 0xcd, 0xc7,
+  0xcb, 0xb6, 0x5c, 0x3a, 0x3a, 0x37, 0x3b, 0x3a, 0x3f, 0x3c, 0x45, 0x3c,
+  0x70, 0xc6, 0xd1, 0xd6, 0xd4, 0xd3, 0xd0, 0xce, 0xcd, 0xc9, 0xc9, 0x7e,
+  0x40, 0x40, 0x3a, 0x3f, 0x3d, 0x42, 0x41, 0x46, 0x42, 0x54, 0xaa, 0xcc,
+  0xcd, 0xd0, 0xcc, 0xcd, 0xc8, 0xca, 0xc3, 0xc9, 0x9e, 0x4c, 0x40, 0x3c,
+  0x3f, 0x3e, 0x42, 0x42, 0x44, 0x43, 0x50, 0xa0, 0xc0, 0xc3, 0xc3, 0xc4,
+  0xc1, 0xc2, 0xbb, 0xc2, 0x91, 0x51, 0x4a, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+  0x4b, 0x55, 0x9b, 0xb9, 0xba, 0xbb, 0xb9, 0xb8, 0xb7, 0xb3, 0xb6, 0x8c,
+  0x5b, 0x58, 0x54, 0x57, 0x58, 0x59, 0x5a, 0x5a, 0x63, 0x94, 0xa6, 0xa6,
+  0xa6, 0xa5, 0xa4, 0xa3, 0xa1, 0xa3, 0x8a, 0x6b, 0x69, 0x66, 0x69, 0x68,
+  0x69, 0x68, 0x68, 0x6c, 0x87, 0x90, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8e,
+  0x8e, 0x84, 0x77, 0x75, 0x75, 0x76, 0x75, 0x77, 0x77, 0x76, 0x79, 0x89,
+  0x8e, 0x8f, 0x8e, 0x8f, 0x8d, 0x8e, 0x8c, 0x8e, 0x82, 0x77, 0x76, 0x76,
+  0x77, 0x78, 0x77, 0x78, 0x77, 0x7c, 0x96, 0x9f, 0xa0, 0x9e, 0x9f, 0x9d,
+  0x9d, 0x9a, 0x9c, 0x82, 0x65, 0x62, 0x61, 0x61, 0x63, 0x63, 0x65, 0x64,
+  0x70, 0xa0, 0xae, 0xae, 0xae, 0xad, 0xab, 0xaa, 0xa7, 0xaa, 0x7d, 0x4e,
+  0x4c, 0x49, 0x4c, 0x4c, 0x4e, 0x51, 0x4e, 0x74, 0xb5, 0xbb, 0xbf, 0xbb,
+  0xba, 0xb6, 0xb4, 0xac, 0x64, 0x3f, 0x40, 0x3e, 0x44, 0x42, 0x4a, 0x45,
+  0x6b, 0xb9, 0xc5, 0xc8, 0xc5, 0xc2, 0xbf, 0xbd, 0xb9, 0x6a, 0x36, 0x37,
+  0x33, 0x3a, 0x39, 0x42, 0x3b, 0x64, 0xb9, 0xc8, 0xca, 0xc8, 0xc5, 0xc4,
+  0xbe, 0xbf, 0x73, 0x33, 0x33, 0x2e, 0x36, 0x33, 0x3c, 0x37, 0x58, 0xb4,
+  0xcc, 0xcd, 0xcc, 0xc7, 0xc7, 0xc0, 0xc4, 0x7b, 0x2f, 0x2c, 0x28, 0x30,
+  0x30, 0x38, 0x34, 0x4d, 0xaa, 0xca, 0xca, 0xcb, 0xc6, 0xc7, 0xbf, 0xc5,
+  0x78, 0x1f, 0x19, 0x13, 0x1a, 0x1a, 0x22, 0x21, 0x33, 0x9c, 0xcb, 0xcb,
+  0xcf, 0xc9, 0xcc, 0xc4, 0xcb, 0x8b, 0x2f, 0x23, 0x1c, 0x20, 0x1f, 0x23,
+  0x23, 0x2c, 0x93, 0xcd, 0xce, 0xd4, 0xcd, 0xd0, 0xc8, 0xcf, 0xa0, 0x4c,
+  0x3e, 0x39, 0x3b, 0x3a, 0x3d, 0x3d, 0x43, 0x99, 0xcd, 0xce, 0xd3, 0xcd,
+  0xd0, 0xc9, 0xcf, 0xaa, 0x50, 0x3e, 0x39, 0x3b, 0x3a, 0x40, 0x3a, 0x6c,
+  0xbd, 0xc5, 0xcd, 0xc7, 0xcb, 0xc4, 0xc9, 0x83, 0x44, 0x40, 0x3c, 0x40,
+  0x3d, 0x42, 0x45, 0x96, 0xbc, 0xc0, 0xc2, 0xc1, 0xc0, 0xc2, 0xaf, 0x61,
+  0x4d, 0x48, 0x4a, 0x48, 0x4d, 0x48, 0x6c, 0xaf, 0xb7, 0xbb, 0xb7, 0xb9,
+  0xb3, 0xb7, 0x88, 0x5b, 0x58, 0x55, 0x59, 0x57, 0x5b, 0x5b, 0x86, 0xa3,
+  0xa5, 0xa6, 0xa3, 0xa3, 0xa1, 0x9b, 0x76, 0x67, 0x66, 0x66, 0x66, 0x68,
+  0x67, 0x70, 0x8b, 0x8f, 0x91, 0x90, 0x90, 0x8e, 0x90, 0x85, 0x78, 0x77,
+  0x76, 0x77, 0x76, 0x77, 0x77, 0x85, 0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x8f,
+  0x8d, 0x7e, 0x78, 0x78, 0x78, 0x78, 0x79, 0x77, 0x80, 0x9a, 0x9f, 0xa0,
+  0x9f, 0x9f, 0x9d, 0x9e, 0x89, 0x67, 0x65, 0x62, 0x65, 0x63, 0x67, 0x64,
+  0x8d, 0xad, 0xae, 0xb0, 0xad, 0xad, 0xaa, 0xa6, 0x6a, 0x50, 0x4d, 0x4f,
+  0x4e, 0x52, 0x4e, 0x65, 0xa9, 0xbd, 0xbc, 0xbd, 0xb7, 0xb8, 0xae, 0x67,
+  0x40, 0x44, 0x40, 0x47, 0x45, 0x4d, 0x95, 0xc7, 0xc2, 0xc7, 0xc0, 0xbf,
+  0xbd, 0x74, 0x37, 0x39, 0x36, 0x3a, 0x3d, 0x3a, 0x7a, 0xc3, 0xc7, 0xc9,
+  0xc7, 0xc1, 0xc8, 0x8d, 0x3d, 0x34, 0x34, 0x34, 0x3c, 0x33, 0x68, 0xbe,
+  0xcd, 0xcb, 0xcd, 0xc4, 0xcc, 0xa6, 0x4a, 0x2e, 0x34, 0x2f, 0x3a, 0x32,
+  0x50, 0xaa, 0xce, 0xc8, 0xcf, 0xc3, 0xcb, 0xb2, 0x49, 0x15, 0x1a, 0x15,
+  0x1e, 0x1b, 0x26, 0x88, 0xca, 0xc7, 0xce, 0xc7, 0xc8, 0xc4, 0x6d, 0x21,
+  0x20, 0x1a, 0x1e, 0x20, 0x1d, 0x73, 0xc7, 0xcb, 0xcf, 0xcd, 0xc9, 0xcf,
+  0x95, 0x46, 0x3b, 0x3b, 0x39, 0x3f, 0x35, 0x69, 0xbe, 0xce, 0xcd, 0xd1,
+  0xc8, 0xd3, 0xa7, 0x52, 0x3c, 0x3e, 0x39, 0x42, 0x39, 0x54, 0xaa, 0xcb,
+  0xc8, 0xce, 0xc6, 0xcd, 0xba, 0x66, 0x3e, 0x42, 0x3b, 0x42, 0x3d, 0x4a,
+  0x96, 0xc0, 0xbe, 0xc3, 0xbe, 0xc2, 0xb8, 0x72, 0x49, 0x4b, 0x45, 0x4b,
+  0x44, 0x6e, 0xad, 0xb5, 0xb7, 0xb6, 0xb5, 0xb1, 0x7b, 0x58, 0x59, 0x54,
+  0x5a, 0x56, 0x69, 0x97, 0xa4, 0xa3, 0xa4, 0xa1, 0xa3, 0x86, 0x6b, 0x6b,
+  0x68, 0x6b, 0x69, 0x6f, 0x89, 0x93, 0x93, 0x94, 0x92, 0x93, 0x88, 0x7b,
+  0x7a, 0x79, 0x7a, 0x79, 0x7b, 0x8a, 0x91, 0x91, 0x91, 0x90, 0x91, 0x89,
+  0x7a, 0x77, 0x77, 0x78, 0x77, 0x77, 0x8d, 0x9d, 0x9c, 0x9e, 0x9a, 0x9c,
+  0x8d, 0x6a, 0x61, 0x61, 0x61, 0x63, 0x62, 0x87, 0xab, 0xaa, 0xae, 0xa9,
+  0xac, 0x9e, 0x63, 0x4d, 0x4f, 0x4c, 0x52, 0x4c, 0x78, 0xb5, 0xba, 0xbe,
+  0xb9, 0xba, 0xae, 0x64, 0x43, 0x46, 0x43, 0x4b, 0x43, 0x71, 0xbd, 0xc6,
+  0xc8, 0xc4, 0xc3, 0xbe, 0x70, 0x39, 0x3b, 0x36, 0x3f, 0x38, 0x5a, 0xb2,
+  0xc9, 0xc8, 0xc9, 0xc3, 0xc6, 0x80, 0x38, 0x37, 0x31, 0x39, 0x34, 0x4f,
+  0xad, 0xcc, 0xcb, 0xcd, 0xc4, 0xc8, 0x81, 0x36, 0x35, 0x2e, 0x37, 0x30,
+  0x6f, 0xc4, 0xc8, 0xd0, 0xc6, 0xce, 0x90, 0x27, 0x1c, 0x13, 0x1c, 0x16,
+  0x49, 0xb7, 0xc8, 0xcf, 0xc9, 0xce, 0xa8, 0x39, 0x1f, 0x19, 0x1d, 0x1b,
+  0x31, 0xa0, 0xc9, 0xce, 0xcf, 0xcd, 0xc3, 0x66, 0x3d, 0x3a, 0x37, 0x3b,
+  0x3f, 0x96, 0xc8, 0xca, 0xd0, 0xcb, 0xcb, 0x79, 0x3f, 0x3d, 0x37, 0x3e,
+  0x3a, 0x84, 0xc5, 0xc7, 0xce, 0xc6, 0xcd, 0x8b, 0x45, 0x40, 0x38, 0x3f,
+  0x38, 0x6d, 0xb4, 0xba, 0xc2, 0xbb, 0xc1, 0x9e, 0x56, 0x4a, 0x44, 0x48,
+  0x44, 0x5e, 0xa5, 0xb3, 0xb6, 0xb3, 0xb6, 0xa5, 0x68, 0x58, 0x56, 0x57,
+  0x57, 0x61, 0x91, 0xa2, 0xa4, 0xa4, 0xa4, 0xa0, 0x7c, 0x6c, 0x6a, 0x6a,
+  0x6b, 0x6c, 0x85, 0x93, 0x93, 0x94, 0x93, 0x93, 0x85, 0x7b, 0x7a, 0x79,
+  0x7b, 0x79, 0x85, 0x91, 0x91, 0x92, 0x90, 0x92, 0x87, 0x79, 0x78, 0x77,
+  0x78, 0x76, 0x85, 0x9d, 0x9e, 0xa0, 0x9d, 0x9f, 0x84, 0x66, 0x66, 0x62,
+  0x65, 0x65, 0x93, 0xac, 0xae, 0xad, 0xad, 0x9e, 0x60, 0x53, 0x4d, 0x52,
+  0x4e, 0x79, 0xb7, 0xba, 0xbf, 0xb8, 0xb7, 0x70, 0x45, 0x43, 0x43, 0x46,
+  0x55, 0xab, 0xc5, 0xc9, 0xc3, 0xc8, 0x99, 0x44, 0x3b, 0x36, 0x3e, 0x3b,
+  0x89, 0xc6, 0xc7, 0xcb, 0xc5, 0xbd, 0x5e, 0x37, 0x33, 0x36, 0x33, 0x5a,
+  0xbb, 0xc9, 0xcf, 0xc6, 0xca, 0x81, 0x38, 0x34, 0x2f, 0x34, 0x3a, 0x9d,
+  0xc9, 0xcc, 0xc9, 0xca, 0xab, 0x37, 0x1b, 0x12, 0x1a, 0x13, 0x5c, 0xc0,
+  0xc7, 0xd0, 0xc8, 0xc9, 0x60, 0x20, 0x19, 0x19, 0x18, 0x35, 0xa8, 0xc6,
+  0xce, 0xca, 0xd2, 0xa0, 0x46, 0x3b, 0x34, 0x3c, 0x38, 0x86, 0xc4, 0xca,
+  0xce, 0xce, 0xc0, 0x60, 0x40, 0x39, 0x3c, 0x36, 0x62, 0xbb, 0xc5, 0xce,
+  0xc7, 0xce, 0x8b, 0x46, 0x41, 0x3b, 0x3e, 0x43, 0x97, 0xbc, 0xc2, 0xc0,
+  0xc3, 0xa8, 0x5b, 0x4d, 0x45, 0x4b, 0x46, 0x81, 0xb0, 0xb6, 0xb5, 0xb7,
+  0x9c, 0x62, 0x59, 0x56, 0x58, 0x5d, 0x8e, 0xa1, 0xa4, 0xa3, 0xa3, 0x86,
+  0x6b, 0x6a, 0x68, 0x69, 0x72, 0x8d, 0x90, 0x93, 0x91, 0x91, 0x80, 0x7a,
+  0x78, 0x7a, 0x79, 0x85, 0x91, 0x91, 0x92, 0x91, 0x8c, 0x7b, 0x79, 0x77,
+  0x79, 0x79, 0x95, 0x9e, 0xa1, 0x9d, 0xa0, 0x84, 0x69, 0x65, 0x66, 0x64,
+  0x76, 0xa6, 0xad, 0xb0, 0xad, 0xaa, 0x6d, 0x54, 0x50, 0x53, 0x4d, 0x81,
+  0xb6, 0xbb, 0xba, 0xba, 0x9e, 0x50, 0x44, 0x40, 0x46, 0x4a, 0x9f, 0xc2,
+  0xc7, 0xc0, 0xc5, 0x84, 0x3d, 0x38, 0x38, 0x38, 0x56, 0xb5, 0xc4, 0xca,
+  0xc3, 0xc0, 0x61, 0x38, 0x31, 0x38, 0x32, 0x77, 0xc5, 0xcb, 0xcc, 0xca,
+  0xac, 0x48, 0x36, 0x2f, 0x36, 0x38, 0x9b, 0xc9, 0xd0, 0xc9, 0xd1, 0x83,
+  0x25, 0x18, 0x17, 0x15, 0x38, 0xaf, 0xca, 0xd1, 0xcd, 0xca, 0x5f, 0x1f,
+  0x19, 0x1b, 0x15, 0x5d, 0xbf, 0xc8, 0xcd, 0xd1, 0xa7, 0x4a, 0x39, 0x38,
+  0x31, 0x5e, 0xb4, 0xc8, 0xc6, 0xd2, 0xa5, 0x50, 0x39, 0x3e, 0x31, 0x58,
+  0xae, 0xcb, 0xc4, 0xd2, 0xac, 0x5a, 0x3c, 0x42, 0x35, 0x59, 0xa5, 0xc1,
+  0xbc, 0xc8, 0xa8, 0x62, 0x49, 0x4e, 0x45, 0x5c, 0x9d, 0xb8, 0xb3, 0xbb,
+  0xa7, 0x70, 0x58, 0x5c, 0x56, 0x66, 0x92, 0xa5, 0xa2, 0xa7, 0x9b, 0x78,
+  0x69, 0x6c, 0x68, 0x71, 0x89, 0x94, 0x92, 0x94, 0x8f, 0x81, 0x79, 0x7a,
+  0x77, 0x7a, 0x88, 0x8f, 0x8e, 0x90, 0x8b, 0x7d, 0x75, 0x77, 0x74, 0x79,
+  0x91, 0x9e, 0x9b, 0x9e, 0x98, 0x78, 0x63, 0x66, 0x61, 0x68, 0x92, 0xae,
+  0xab, 0xb0, 0xa7, 0x73, 0x50, 0x54, 0x4e, 0x58, 0x96, 0xbf, 0xbb, 0xc0,
+  0xb8, 0x78, 0x45, 0x4a, 0x45, 0x4d, 0x92, 0xc9, 0xc5, 0xc8, 0xc1, 0x75,
+  0x3a, 0x3d, 0x39, 0x3f, 0x8e, 0xc9, 0xc7, 0xc9, 0xc7, 0x7d, 0x38, 0x37,
+  0x35, 0x36, 0x82, 0xc9, 0xc7, 0xcb, 0xc4, 0x76, 0x31, 0x36, 0x2c, 0x42,
+  0x9f, 0xce, 0xc6, 0xd3, 0xa4, 0x34, 0x14, 0x18, 0x0d, 0x59, 0xc0, 0xcb,
+  0xcf, 0xce, 0x70, 0x1a, 0x1c, 0x10, 0x2c, 0x9a, 0xca, 0xc5, 0xd2, 0xa6,
+  0x4c, 0x36, 0x38, 0x30, 0x71, 0xbf, 0xc6, 0xcb, 0xc8, 0x7b, 0x3b, 0x3e,
+  0x34, 0x48, 0x9f, 0xca, 0xc5, 0xd1, 0xaa, 0x54, 0x3d, 0x40, 0x37, 0x6f,
+  0xb6, 0xbe, 0xc1, 0xbf, 0x80, 0x4b, 0x4c, 0x45, 0x54, 0x96, 0xb6, 0xb2,
+  0xb9, 0x99, 0x63, 0x57, 0x56, 0x54, 0x76, 0x9c, 0x9f, 0xa1, 0x9e, 0x7e,
+  0x67, 0x69, 0x65, 0x6d, 0x85, 0x90, 0x8f, 0x91, 0x8a, 0x7b, 0x78, 0x77,
+  0x76, 0x82, 0x8f, 0x8f, 0x90, 0x8f, 0x82, 0x77, 0x78, 0x76, 0x7c, 0x95,
+  0xa2, 0x9f, 0xa3, 0x92, 0x6f, 0x67, 0x68, 0x65, 0x88, 0xae, 0xae, 0xb2,
+  0xab, 0x77, 0x53, 0x56, 0x4f, 0x63, 0xa5, 0xc0, 0xbb, 0xc3, 0x9a, 0x53,
+  0x46, 0x48, 0x44, 0x82, 0xc4, 0xc5, 0xc9, 0xbc, 0x67, 0x39, 0x3d, 0x33,
+  0x71, 0xc1, 0xc6, 0xcb, 0xba, 0x5e, 0x33, 0x38, 0x2f, 0x6f, 0xc1, 0xc6,
+  0xcc, 0xbc, 0x5d, 0x2f, 0x34, 0x2a, 0x6b, 0xc3, 0xc9, 0xd0, 0xbe, 0x4e,
+  0x14, 0x18, 0x0b, 0x56, 0xc1, 0xcb, 0xd4, 0xc3, 0x55, 0x17, 0x1b, 0x0e,
+  0x54, 0xbb, 0xc8, 0xcf, 0xc3, 0x69, 0x38, 0x3a, 0x2f, 0x6e, 0xbf, 0xc5,
+  0xcd, 0xbd, 0x65, 0x3a, 0x3c, 0x32, 0x6e, 0xbf, 0xc6, 0xce, 0xbe, 0x68,
+  0x3e, 0x40, 0x35, 0x6b, 0xb3, 0xbb, 0xc1, 0xb4, 0x6c, 0x47, 0x49, 0x41,
+  0x6e, 0xaa, 0xb0, 0xb4, 0xaa, 0x72, 0x57, 0x58, 0x52, 0x72, 0x9b, 0x9f,
+  0xa3, 0x9b, 0x77, 0x68, 0x69, 0x67, 0x79, 0x8f, 0x90, 0x92, 0x8f, 0x80,
+  0x7a, 0x7b, 0x7a, 0x85, 0x91, 0x92, 0x93, 0x90, 0x81, 0x79, 0x7a, 0x78,
+  0x89, 0x9f, 0xa0, 0xa2, 0x9a, 0x77, 0x66, 0x68, 0x64, 0x83, 0xab, 0xae,
+  0xb1, 0xa7, 0x6d, 0x53, 0x55, 0x4f, 0x82, 0xba, 0xbb, 0xc2, 0xa2, 0x56,
+  0x47, 0x44, 0x51, 0xa4, 0xc7, 0xc5, 0xc6, 0x77, 0x3a, 0x3d, 0x34, 0x6f,
+  0xc1, 0xc5, 0xcf, 0xaa, 0x4b, 0x36, 0x34, 0x3e, 0x98, 0xc9, 0xc6, 0xcd,
+  0x81, 0x34, 0x35, 0x2a, 0x60, 0xbf, 0xc9, 0xd3, 0xb5, 0x3e, 0x16, 0x12,
+  0x18, 0x8a, 0xce, 0xcc, 0xd8, 0x89, 0x22, 0x1a, 0x0c, 0x3d, 0xb0, 0xc8,
+  0xd0, 0xc0, 0x62, 0x38, 0x36, 0x34, 0x86, 0xc5, 0xc5, 0xd0, 0x95, 0x45,
+  0x3e, 0x32, 0x4e, 0xab, 0xc6, 0xca, 0xc3, 0x6d, 0x3d, 0x3d, 0x35, 0x77,
+  0xb7, 0xba, 0xc4, 0x9b, 0x54, 0x4a, 0x43, 0x57, 0x9c, 0xb1, 0xb3, 0xb2,
+  0x7d, 0x58, 0x59, 0x53, 0x75, 0x9d, 0x9f, 0xa4, 0x94, 0x70, 0x6a, 0x68,
+  0x6d, 0x88, 0x92, 0x93, 0x93, 0x86, 0x7b, 0x7b, 0x79, 0x83, 0x90, 0x92,
+  0x93, 0x8e, 0x7e, 0x7a, 0x79, 0x7b, 0x94, 0xa0, 0x9f, 0xa1, 0x84, 0x68,
+  0x69, 0x63, 0x7e, 0xaa, 0xad, 0xb2, 0xa1, 0x64, 0x55, 0x51, 0x5f, 0xa6,
+  0xbc, 0xbe, 0xb3, 0x65, 0x46, 0x46, 0x4b, 0x9e, 0xc6, 0xc6, 0xc1, 0x67,
+  0x3a, 0x3b, 0x3c, 0x91, 0xc8, 0xc7, 0xca, 0x78, 0x37, 0x39, 0x33, 0x7e,
+  0xc6, 0xc6, 0xcf, 0x81, 0x34, 0x35, 0x2b, 0x72, 0xc7, 0xca, 0xd7, 0x92,
+  0x22, 0x19, 0x0a, 0x47, 0xbd, 0xcb, 0xd9, 0xa0, 0x2b, 0x1b, 0x0c, 0x3b,
+  0xb1, 0xc8, 0xd2, 0xb5, 0x53, 0x3b, 0x31, 0x44, 0xa7, 0xc5, 0xcd, 0xbc,
+  0x5e, 0x3f, 0x38, 0x41, 0x9e, 0xc5, 0xc9, 0xc6, 0x6d, 0x3f, 0x3b, 0x39,
+  0x86, 0xba, 0xbb, 0xc2, 0x7f, 0x4b, 0x49, 0x45, 0x81, 0xaf, 0xb0, 0xb6,
+  0x87, 0x5b, 0x59, 0x53, 0x75, 0x9d, 0x9f, 0xa4, 0x8e, 0x6d, 0x6b, 0x67,
+  0x76, 0x8e, 0x91, 0x94, 0x8d, 0x7e, 0x7c, 0x7a, 0x80, 0x90, 0x91, 0x93,
+  0x8e, 0x7e, 0x7b, 0x79, 0x80, 0x9a, 0xa0, 0xa1, 0x99, 0x74, 0x69, 0x66,
+  0x6d, 0x9c, 0xaf, 0xb0, 0xac, 0x72, 0x56, 0x53, 0x5a, 0xa1, 0xbb, 0xbf,
+  0xb0, 0x5f, 0x49, 0x43, 0x60, 0xb7, 0xc3, 0xcb, 0xa2, 0x47, 0x3e, 0x35,
+  0x6e, 0xc3, 0xc4, 0xce, 0x89, 0x3b, 0x3a, 0x35, 0x87, 0xc7, 0xc7, 0xca,
+  0x6c, 0x33, 0x32, 0x39, 0xa0, 0xcb, 0xd0, 0xbf, 0x42, 0x16, 0x0c, 0x31,
+  0xb1, 0xcb, 0xd8, 0xaa, 0x2f, 0x1a, 0x0a, 0x43, 0xb8, 0xc6, 0xd3, 0x95,
+  0x40, 0x3b, 0x2d, 0x75, 0xc1, 0xc5, 0xcd, 0x7c, 0x40, 0x3d, 0x37, 0x90,
+  0xc4, 0xc9, 0xc3, 0x65, 0x41, 0x3a, 0x45, 0x9e, 0xb9, 0xc1, 0xaa, 0x59,
+  0x4a, 0x42, 0x60, 0xa5, 0xae, 0xb6, 0x91, 0x5c, 0x59, 0x53, 0x75, 0x9c,
+  0x9e, 0xa3, 0x86, 0x6a, 0x6a, 0x67, 0x7f, 0x8f, 0x90, 0x91, 0x81, 0x7a,
+  0x78, 0x7b, 0x8b, 0x90, 0x92, 0x8f, 0x7f, 0x7b, 0x79, 0x82, 0x9c, 0x9f,
+  0xa2, 0x92, 0x6d, 0x6a, 0x65, 0x83, 0xad, 0xad, 0xb3, 0x87, 0x59, 0x57,
+  0x53, 0x90, 0xbc, 0xbc, 0xbd, 0x72, 0x49, 0x47, 0x54, 0xae, 0xc4, 0xcc,
+  0xa3, 0x47, 0x3f, 0x36, 0x82, 0xc6, 0xc7, 0xc6, 0x64, 0x3a, 0x35, 0x52,
+  0xb7, 0xc5, 0xd1, 0x93, 0x39, 0x35, 0x30, 0x90, 0xca, 0xcf, 0xc1, 0x3f,
+  0x16, 0x09, 0x39, 0xb9, 0xca, 0xd8, 0x7c, 0x1c, 0x16, 0x12, 0x89, 0xc6,
+  0xcf, 0xb8, 0x4f, 0x3d, 0x2f, 0x63, 0xbd, 0xc5, 0xcd, 0x7a, 0x40, 0x3c,
+  0x40, 0xa2, 0xc4, 0xce, 0xa9, 0x4d, 0x43, 0x36, 0x74, 0xb8, 0xbd, 0xbf,
+  0x71, 0x4d, 0x48, 0x58, 0xa1, 0xb1, 0xb8, 0x93, 0x5e, 0x5a, 0x55, 0x7f,
+  0x9d, 0xa0, 0x9b, 0x74, 0x6a, 0x66, 0x71, 0x8b, 0x8e, 0x90, 0x85, 0x79,
+  0x78, 0x78, 0x87, 0x8f, 0x90, 0x8c, 0x7b, 0x79, 0x76, 0x85, 0x9c, 0x9d,
+  0x9f, 0x7e, 0x68, 0x67, 0x6c, 0x9e, 0xae, 0xb4, 0x98, 0x5e, 0x5a, 0x51,
+  0x85, 0xbb, 0xbd, 0xbe, 0x72, 0x4b, 0x46, 0x5c, 0xb6, 0xc4, 0xce, 0x9a,
+  0x45, 0x3f, 0x38, 0x8e, 0xc7, 0xca, 0xc2, 0x5c, 0x3d, 0x32, 0x6e, 0xc4,
+  0xc8, 0xca, 0x61, 0x37, 0x2c, 0x56, 0xc0, 0xcb, 0xd3, 0x5d, 0x16, 0x0b,
+  0x2e, 0xb6, 0xca, 0xdb, 0x78, 0x1c, 0x10, 0x25, 0xa8, 0xc5, 0xd4, 0x91,
+  0x3d, 0x37, 0x37, 0x9c, 0xc3, 0xcf, 0x9b, 0x44, 0x3e, 0x38, 0x93, 0xc2,
+  0xcd, 0xae, 0x50, 0x40, 0x38, 0x85, 0xba, 0xc1, 0xb1, 0x5d, 0x4e, 0x43,
+  0x79, 0xae, 0xb3, 0xac, 0x6c, 0x5d, 0x56, 0x74, 0x9d, 0xa1, 0xa2, 0x7c,
+  0x6c, 0x68, 0x76, 0x8e, 0x90, 0x91, 0x82, 0x7b, 0x78, 0x7c, 0x8c, 0x8e,
+  0x8e, 0x81, 0x77, 0x75, 0x7b, 0x96, 0x9b, 0x9f, 0x85, 0x67, 0x65, 0x6a,
+  0x9c, 0xa9, 0xb0, 0x8e, 0x58, 0x55, 0x52, 0x98, 0xb8, 0xc0, 0x9b, 0x4e,
+  0x4a, 0x43, 0x95, 0xc4, 0xc9, 0xb1, 0x4f, 0x40, 0x37, 0x88, 0xc7, 0xcc,
+  0xbc, 0x53, 0x3f, 0x31, 0x73, 0xc4, 0xcb, 0xc4, 0x58, 0x36, 0x2c, 0x63,
+  0xc7, 0xcc, 0xd4, 0x59, 0x18, 0x08, 0x3d, 0xbe, 0xce, 0xd2, 0x52, 0x19,
+  0x08, 0x52, 0xc1, 0xcc, 0xc4, 0x56, 0x3b, 0x2d, 0x7a, 0xc0, 0xcc, 0xb3,
+  0x50, 0x3e, 0x36, 0x8d, 0xc0, 0xcf, 0xa4, 0x4a, 0x3e, 0x3d, 0x97, 0xb8,
+  0xc4, 0x91, 0x50, 0x49, 0x52, 0x9e, 0xae, 0xb6, 0x83, 0x5d, 0x57, 0x66,
+  0x98, 0xa0, 0xa2, 0x7e, 0x6d, 0x69, 0x77, 0x8e, 0x92, 0x91, 0x7f, 0x7b,
+  0x79, 0x84, 0x90, 0x91, 0x8e, 0x7d, 0x7a, 0x78, 0x8f, 0x9e, 0xa0, 0x93,
+  0x6d, 0x69, 0x68, 0x99, 0xac, 0xb3, 0x8f, 0x5a, 0x55, 0x5c, 0xa6, 0xb8,
+  0xbf, 0x79, 0x48, 0x42, 0x63, 0xbb, 0xc3, 0xc5, 0x65, 0x3e, 0x32, 0x6b,
+  0xc0, 0xc8, 0xbd, 0x55, 0x3c, 0x30, 0x7d, 0xc5, 0xcd, 0xb3, 0x46, 0x36,
+  0x2b, 0x90, 0xca, 0xd7, 0xa0, 0x23, 0x12, 0x11, 0x99, 0xcc, 0xdd, 0x8c,
+  0x1f, 0x12, 0x21, 0xa7, 0xc7, 0xd5, 0x82, 0x3c, 0x32, 0x4e, 0xb6, 0xc5,
+  0xce, 0x70, 0x42, 0x34, 0x64, 0xba, 0xca, 0xc1, 0x5c, 0x42, 0x36, 0x84,
+  0xb8, 0xc5, 0x98, 0x53, 0x4a, 0x56, 0xa1, 0xb1, 0xb3, 0x77, 0x5c, 0x56,
+  0x7a, 0x9e, 0xa1, 0x96, 0x6f, 0x6b, 0x6a, 0x88, 0x8f, 0x92, 0x84, 0x7a,
+  0x78, 0x81, 0x8f, 0x90, 0x8d, 0x7a, 0x7a, 0x76, 0x92, 0x9d, 0xa1, 0x85,
+  0x6a, 0x65, 0x79, 0xa9, 0xaf, 0xab, 0x6b, 0x59, 0x52, 0x92, 0xb9, 0xc2,
+  0x98, 0x4f, 0x47, 0x59, 0xb7, 0xc6, 0xc6, 0x64, 0x3f, 0x34, 0x7b, 0xc5,
+  0xcc, 0xa8, 0x44, 0x3b, 0x3c, 0xa9, 0xc7, 0xd2, 0x74, 0x38, 0x2a, 0x69,
+  0xc7, 0xd2, 0xbc, 0x31, 0x12, 0x0b, 0x90, 0xc9, 0xda, 0x78, 0x18, 0x09,
+  0x33, 0xb6, 0xc8, 0xc6, 0x56, 0x3b, 0x2b, 0x81, 0xbe, 0xce, 0x9c, 0x45,
+  0x38, 0x4a, 0xaf, 0xc1, 0xcc, 0x6e, 0x42, 0x34, 0x74, 0xb6, 0xc3, 0xad,
+  0x5a, 0x4d, 0x4f, 0x9a, 0xb0, 0xb7, 0x81, 0x5d, 0x58, 0x6f, 0x9d, 0xa1,
+  0x9d, 0x73, 0x6e, 0x69, 0x87, 0x8f, 0x96, 0x86, 0x7e, 0x77, 0x83, 0x8e,
+  0x92, 0x8c, 0x7d, 0x79, 0x7c, 0x98, 0x9e, 0xa0, 0x78, 0x6b, 0x64, 0x95,
+  0xa8, 0xb5, 0x80, 0x5d, 0x4d, 0x7b, 0xb1, 0xc2, 0xa0, 0x55, 0x44, 0x58,
+  0xb1, 0xc7, 0xc2, 0x61, 0x3e, 0x37, 0x92, 0xc4, 0xcf, 0x83, 0x40, 0x30,
+  0x6a, 0xc0, 0xd1, 0xab, 0x46, 0x2e, 0x41, 0xb1, 0xd2, 0xce, 0x4e, 0x12,
+  0x09, 0x7c, 0xcd, 0xd9, 0x77, 0x18, 0x08, 0x52, 0xc1, 0xd1, 0xac, 0x46,
+  0x33, 0x45, 0xac, 0xc7, 0xc5, 0x64, 0x3c, 0x38, 0x8c, 0xc2, 0xcc, 0x8a,
+  0x42, 0x38, 0x62, 0xb3, 0xbd, 0xa7, 0x54, 0x48, 0x51, 0x9c, 0xae, 0xad,
+  0x71, 0x58, 0x57, 0x80, 0x9e, 0x9f, 0x87, 0x69, 0x68, 0x73, 0x8d, 0x8e,
+  0x8b, 0x7a, 0x78, 0x7b, 0x8d, 0x8f, 0x8f, 0x7d, 0x7a, 0x77, 0x93, 0x9d,
+  0xa4, 0x82, 0x6e, 0x64, 0x86, 0xa9, 0xb5, 0x97, 0x63, 0x52, 0x68, 0xa9,
+  0xc1, 0xb4, 0x6a, 0x47, 0x4d, 0x97, 0xca, 0xc6, 0x7d, 0x3c, 0x3c, 0x80,
+  0xc8, 0xca, 0x8d, 0x3e, 0x34, 0x76, 0xc6, 0xd2, 0x94, 0x3d, 0x27, 0x6b,
+  0xc2, 0xde, 0x97, 0x28, 0x00, 0x49, 0xb8, 0xdf, 0xa3, 0x31, 0x01, 0x33,
+  0xa3, 0xd8, 0xad, 0x57, 0x27, 0x4a, 0x9d, 0xd2, 0xb1, 0x62, 0x30, 0x49,
+  0x96, 0xcc, 0xb7, 0x6a, 0x36, 0x45, 0x8c, 0xc2, 0xba, 0x7e, 0x47, 0x4f,
+  0x86, 0xb4, 0xb0, 0x85, 0x59, 0x5c, 0x7d, 0xa2, 0xa0, 0x89, 0x6b, 0x6b,
+  0x7b, 0x91, 0x91, 0x88, 0x7b, 0x78, 0x82, 0x8e, 0x92, 0x87, 0x7d, 0x76,
+  0x86, 0x99, 0xa2, 0x8b, 0x6f, 0x60, 0x7a, 0x9f, 0xb3, 0x93, 0x63, 0x4c,
+  0x69, 0xa4, 0xc2, 0xa6, 0x63, 0x3d, 0x5e, 0xa7, 0xcf, 0xb3, 0x63, 0x30,
+  0x4d, 0x9e, 0xcf, 0xb8, 0x6a, 0x2e, 0x44, 0x97, 0xd1, 0xc3, 0x6f, 0x2c,
+  0x33, 0x88, 0xd6, 0xd1, 0x6b, 0x10, 0x0b, 0x6b, 0xd1, 0xd7, 0x7a, 0x16,
+  0x0a, 0x5c, 0xc6, 0xd2, 0x91, 0x3c, 0x2f, 0x67, 0xbe, 0xcd, 0x91, 0x43,
+  0x36, 0x72, 0xbe, 0xcb, 0x8a, 0x43, 0x3b, 0x7f, 0xbc, 0xc0, 0x85, 0x4c,
+  0x4c, 0x84, 0xb3, 0xae, 0x7c, 0x58, 0x5d, 0x84, 0xa2, 0x9c, 0x7d, 0x68,
+  0x6e, 0x85, 0x92, 0x8d, 0x80, 0x78, 0x7d, 0x8a, 0x92, 0x8b, 0x7e, 0x76,
+  0x82, 0x97, 0xa2, 0x91, 0x72, 0x64, 0x7c, 0xa5, 0xb4, 0x92, 0x61, 0x51,
+  0x78, 0xb3, 0xc3, 0x91, 0x51, 0x46, 0x81, 0xc4, 0xcc, 0x8d, 0x40, 0x3b,
+  0x7f, 0xc9, 0xc6, 0x7d, 0x36, 0x3d, 0x8e, 0xd1, 0xc6, 0x75, 0x2a, 0x3b,
+  0x93, 0xdc, 0xc2, 0x51, 0x02, 0x1c, 0x8e, 0xdd, 0xbb, 0x4a, 0x00, 0x2b,
+  0x9b, 0xd7, 0xb3, 0x5b, 0x26, 0x4f, 0xa4, 0xd1, 0xa4, 0x53, 0x2d, 0x59,
+  0xa9, 0xcd, 0x9e, 0x50, 0x32, 0x64, 0xad, 0xc4, 0x98, 0x56, 0x44, 0x70,
+  0xa9, 0xb5, 0x8c, 0x5f, 0x5a, 0x7d, 0xa0, 0xa2, 0x89, 0x6c, 0x6c, 0x7f,
+  0x91, 0x91, 0x84, 0x7a, 0x7b, 0x87, 0x92, 0x8f, 0x83, 0x78, 0x7f, 0x95,
+  0xa2, 0x94, 0x73, 0x65, 0x7e, 0xa7, 0xb2, 0x8b, 0x5b, 0x55, 0x84, 0xbc,
+  0xb9, 0x7b, 0x44, 0x54, 0x9e, 0xd0, 0xb0, 0x5c, 0x32, 0x60, 0xb3, 0xd0,
+  0x96, 0x42, 0x32, 0x7b, 0xc8, 0xcd, 0x7f, 0x2d, 0x36, 0x90, 0xdc, 0xbe,
+  0x4b, 0x00, 0x30, 0xa8, 0xe1, 0x9f, 0x29, 0x02, 0x54, 0xc2, 0xd2, 0x85,
+  0x34, 0x36, 0x89, 0xcb, 0xc0, 0x71, 0x32, 0x4a, 0x9d, 0xce, 0xaa, 0x59,
+  0x33, 0x62, 0xae, 0xc2, 0x90, 0x50, 0x4a, 0x7f, 0xb1, 0xad, 0x7b, 0x58,
+  0x60, 0x88, 0xa3, 0x97, 0x77, 0x66, 0x72, 0x88, 0x90, 0x86, 0x78, 0x76,
+  0x81, 0x8d, 0x8c, 0x81, 0x75, 0x79, 0x8f, 0x9f, 0x94, 0x74, 0x62, 0x73,
+  0x9d, 0xb1, 0x93, 0x5f, 0x50, 0x7b, 0xb5, 0xbc, 0x82, 0x46, 0x4d, 0x95,
+  0xce, 0xb8, 0x66, 0x33, 0x59, 0xad, 0xd3, 0xa8, 0x50, 0x2f, 0x69, 0xc0,
+  0xd4, 0x8b, 0x35, 0x30, 0x86, 0xd8, 0xca, 0x59, 0x01, 0x2c, 0xa7, 0xe2,
+  0x9a, 0x24, 0x05, 0x66, 0xca, 0xcd, 0x79, 0x2c, 0x43, 0x9b, 0xd1, 0xa6,
+  0x51, 0x31, 0x6e, 0xbe, 0xc3, 0x7c, 0x39, 0x47, 0x94, 0xc4, 0xa2, 0x5c,
+  0x44, 0x71, 0xaa, 0xae, 0x80, 0x57, 0x60, 0x89, 0xa2, 0x92, 0x72, 0x67,
+  0x77, 0x8d, 0x8f, 0x84, 0x78, 0x7a, 0x88, 0x91, 0x8b, 0x7d, 0x78, 0x88,
+  0x9e, 0x9f, 0x83, 0x67, 0x6f, 0x98, 0xb3, 0x9c, 0x66, 0x52, 0x7c, 0xb7,
+  0xbc, 0x80, 0x45, 0x55, 0xa1, 0xd1, 0xaa, 0x53, 0x35, 0x71, 0xc1, 0xca,
+  0x7e, 0x34, 0x45, 0x9c, 0xd6, 0xad, 0x4c, 0x25, 0x66, 0xc8, 0xd5, 0x70,
+  0x07, 0x19, 0x8d, 0xdf, 0xae, 0x36, 0x00, 0x40, 0xb6, 0xd3, 0x8a, 0x34,
+  0x34, 0x89, 0xcc, 0xb4, 0x5f, 0x2f, 0x5d, 0xb2, 0xc9, 0x8d, 0x41, 0x3e,
+  0x84, 0xc1, 0xaf, 0x6a, 0x45, 0x67, 0xa5, 0xb6, 0x8e, 0x5f, 0x5d, 0x84,
+  0xa3, 0x9b, 0x7b, 0x6a, 0x74, 0x8c, 0x92, 0x8a, 0x66, 0x3f, 0x34, 0x30,
+  0x31, 0x32, 0x35, 0x36, 0x39, 0x3b, 0x3d, 0x3f, 0x41, 0x43, 0x45, 0x47,
+  0x49, 0x4a, 0x4c, 0x4e, 0x4f, 0x51, 0x52, 0x54, 0x55, 0x57, 0x59, 0x5a,
+  0x5b, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69,
+  0x6a, 0x6a, 0x6c, 0x6c, 0x6e, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
+  0x76, 0x76, 0x77, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c,
+  0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82,
+  0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84, 0x83, 0x84, 0x83, 0x84,
+  0x85, 0x84, 0x84, 0x85, 0x85, 0x86, 0x85, 0x86, 0x87, 0x87, 0x86, 0x87,
+  0x87, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x89, 0x89, 0x8a, 0x89, 0x8a,
+  0x89, 0x8a, 0x8a, 0x8b, 0x8a, 0x8b, 0x8c, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c,
+  0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d,
+  0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c,
+  0x8d, 0x8c, 0x8d, 0x8c, 0x8b, 0x8c, 0x8b, 0x8c, 0x8b, 0x8c, 0x8b, 0x8c,
+  0x8b, 0x8c, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a,
+  0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b,
+  0x8a, 0x8b, 0x8c, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a,
+  0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x89,
+  0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x89, 0x88, 0x89, 0x88, 0x87, 0x88, 0x87,
+  0x87, 0x86, 0x87, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87,
+  0x86, 0x85, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x87, 0x86, 0x87, 0x86,
+  0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x87, 0x88, 0x88, 0x87, 0x88,
+  0x87, 0x88, 0x87, 0x88, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x86, 0x87,
+  0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x85, 0x85, 0x86, 0x85, 0x86,
+  0x85, 0x86, 0x85, 0x86, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x85,
+  0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84,
+  0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83,
+  0x84, 0x83, 0x84, 0x85, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84,
+  0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x84,
+  0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x82, 0x83, 0x83, 0x82,
+  0x83, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
+  0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81,
+  0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81,
+  0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
+  0x80, 0x4c, 0x49, 0x53, 0x54, 0x18, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x46,
+  0x4f, 0x49, 0x43, 0x52, 0x44, 0x0c, 0x00, 0x00, 0x00, 0x31, 0x39, 0x39,
+  0x34, 0x2d, 0x31, 0x31, 0x2d, 0x33, 0x30, 0x00, 0x00, 0x69, 0x64, 0x33,
+  0x20, 0x2c, 0x00, 0x00, 0x00, 0x49, 0x44, 0x33, 0x04, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x20, 0x05, 0x0e, 0x67,
+  0x39, 0x39, 0x73, 0x54, 0x44, 0x52, 0x43, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x31, 0x39, 0x39, 0x34, 0x2d, 0x31, 0x31, 0x2d, 0x33, 0x30,
+  0x00
+};
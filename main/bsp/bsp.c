@@ -1,189 +1,467 @@
-#include <stdio.h>
-#include <string.h>
-#include "sdkconfig.h"
-
-#include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
-
-#include "esp_heap_caps.h"
-#include "esp_log.h"
-
-#include "driver/gpio.h"
-#include "driver/i2c.h"
-#include "board.h"
-#include "lcd.h"
-#if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
-#include "esp_lcd_touch_gt911.h"
-#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
-#include "esp_lcd_touch_tt21100.h"
-#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
-#include "esp_lcd_touch_ft5x06.h"
-#endif
-
-#include "bsp.h"
-
-lcd_disp_t *lcd_parallel8080 = NULL;
-esp_lcd_touch_handle_t tp = NULL;
-
-static void app_i2c_init(void)
-{
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = BOARD_I2C_SDA,
-        .scl_io_num = BOARD_I2C_SCL,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-    };
-    conf.master.clk_speed = 100000;
-
-  esp_err_t retCode = i2c_param_config(CONFIG_I2C_NUM, &conf);
-  if (retCode != ESP_OK) {
-      printf("i2c_param_config failed\n");
-  } else {
-      retCode = i2c_driver_install(CONFIG_I2C_NUM, conf.mode, 0, 0, 0);
-      if (retCode != ESP_OK) {
-          printf("i2c_driver_install failed\n");
-      }
-  }
-}
-
-#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
-volatile bool _disp_flush_ready = false;
-
-static void lcd_8080_flush_ready_cb(lcd_disp_t * disp)
-{
-   _disp_flush_ready = true;
-}
-#endif
-
-void lcd_driver_install(void)
-{
-    /* Initialize I2C */
-    app_i2c_init();
-
-#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
-    /* Initialize Parallel Display */
-    lcd_cfg_t lcd_parallel8080_cfg = {};
-    lcd_parallel8080_cfg.driver = (lcd_driver_t) BOARD_DISP_PARALLEL_CONTROLLER;
-    lcd_parallel8080_cfg.flush_ready_cb = lcd_8080_flush_ready_cb;
-    lcd_parallel8080 = lcd_parallel8080_init(&lcd_parallel8080_cfg);
-    if (lcd_parallel8080 == NULL) {
-      printf("lcd_parallel8080_init failed/n");
-    }
-  #endif
-
-#if (BOARD_DISP_TOUCH_CONTROLLER > 0)
-    esp_lcd_panel_io_handle_t io_handle = NULL;
-#if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
-    esp_lcd_panel_io_i2c_config_t io_config = ESP_LCD_TOUCH_IO_I2C_GT911_CONFIG();
-#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
-    esp_lcd_panel_io_i2c_config_t io_config = ESP_LCD_TOUCH_IO_I2C_TT21100_CONFIG();
-#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
-    esp_lcd_panel_io_i2c_config_t io_config = ESP_LCD_TOUCH_IO_I2C_FT5x06_CONFIG();
-#endif
-ESP_ERROR_CHECK(esp_lcd_new_panel_io_i2c((esp_lcd_i2c_bus_handle_t)CONFIG_I2C_NUM, &io_config, &io_handle));
-
-    /* Initialize touch */
-    esp_lcd_touch_config_t tp_cfg = {
-        .x_max = BOARD_DISP_TOUCH_HRES,
-        .y_max = BOARD_DISP_TOUCH_VRES,
-        .rst_gpio_num = (gpio_num_t) -1,
-        .int_gpio_num = (gpio_num_t) -1,
-        .levels = {
-            .reset = 0,
-            .interrupt = 0,
-        },
-    };
- 
-    #if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
-        tp_cfg.flags.swap_xy = 1;
-        tp_cfg.flags.mirror_x = 0;
-        tp_cfg.flags.mirror_y = 1;
-        esp_lcd_touch_new_i2c_gt911(io_handle, &tp_cfg, &tp);
-    #elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
-        tp_cfg.flags.swap_xy = 1;
-        tp_cfg.flags.mirror_x = 1;
-        tp_cfg.flags.mirror_y = 1;
-        esp_lcd_touch_new_i2c_tt21100(io_handle, &tp_cfg, &tp);
-    #elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
-        tp_cfg.flags.swap_xy = 0;
-        tp_cfg.flags.mirror_x = 0;
-        tp_cfg.flags.mirror_y = 0;
-        esp_lcd_touch_new_i2c_ft5x06(io_handle, &tp_cfg, &tp);
-    #endif
-#endif
-
-  if (tp == NULL) {
-    printf("\nTouchpad setup ERROR!\n");
-  }
-
-#if 1
-  //printf("\napp_main:: STARTING!\n");
-
-  uint16_t tile[64];
-  int xs = BOARD_DISP_PARALLEL_HRES / 8;
-  int ys = BOARD_DISP_PARALLEL_VRES / 8;
-  for (int y = 0; y < ys; y++)
-    for (int x = 0; x < xs; x++) {
-       uint16_t color = (y<<6) + x; // testing...
-       color = 0; // clear screen
-       memset(tile, color, sizeof(tile));
-       //printf("drawing (%d, %d) color %x in screen\n===============\n", x*8, y*8, color);
-       bsp_lcd_flush(x * 8, y * 8, x * 8 + 8, y * 8 + 8, (void *)tile);
-       //lcd_parallel8080_draw(lcd_parallel8080, x * 8, y * 8, x * 8 + 8, y * 8 + 8, (void *)tile);
-
-    }
-
-  //printf("\napp_main:: DONE!\n");
-  //delay(5000);
-#endif
-}
-
-void  bsp_lcd_flush(int x0, int y0, int x1, int y1, void *pixels) {
-  if (lcd_parallel8080 == NULL || pixels == NULL) {
-    printf("bsp_lcd_flush:: NULL pointer!\n");
-    return;
-  }
-  lcd_parallel8080_draw(lcd_parallel8080, x0, y0, x1, y1, (void *)pixels);
-
-  // FIX-ME :: delay shall be replaced by a flag set when the display is flushed
-  //vTaskDelay(1);
-  while (!_disp_flush_ready) {}
-  _disp_flush_ready = false;
-}
-
-esp_err_t touchPadRead(uint8_t *numTouchedPoints, uint16_t *scrTouchX, uint16_t *scrTouchY) {
-    
-    if (tp == NULL) {
-      printf("\nTouchpad not initialized. NULL pointer.\n");
-      return ESP_FAIL;
-    }
-#if 0 // code for the Esp32-Box
-    uint8_t state = 0;
-    esp_lcd_touch_get_button_state(tp, 0, &state);
-
-    if (state == 0) {
-      numTouchedPoints = 0;
-      return ESP_OK;
-    }
-#endif
-    
-    esp_lcd_touch_read_data(tp);
-
-    /* Read data from touch controller */
-    uint16_t touchpad_x[1] = {0};
-    uint16_t touchpad_y[1] = {0};
-    uint8_t touchpad_cnt = 0;
-
-    bool touchpad_pressed = esp_lcd_touch_get_coordinates(tp, touchpad_x, touchpad_y, NULL, &touchpad_cnt, 1);
-
-    if (touchpad_pressed && touchpad_cnt > 0) {
-        *scrTouchX = BOARD_DISP_TOUCH_VRES - touchpad_x[0];
-        *scrTouchY = touchpad_y[0];
-        *numTouchedPoints = touchpad_cnt;
-        //printf("Touch Detected: #%d - (%d, %d)\n", *numTouchedPoints, *scrTouchX, *scrTouchY);
-    } else {
-        *numTouchedPoints = 0;
-    }
-  return ESP_OK;
-}
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "board.h"
+#include "lcd.h"
+#include "bsp_i2c.h"
+#include "input.h"
+#if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
+#include "esp_lcd_touch_gt911.h"
+#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
+#include "esp_lcd_touch_tt21100.h"
+#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
+#include "esp_lcd_touch_ft5x06.h"
+#endif
+
+#include "bsp.h"
+
+lcd_disp_t *lcd_parallel8080 = NULL;
+lcd_disp_t *lcd_rgb = NULL;
+lcd_disp_t *lcd_spi = NULL;
+esp_lcd_touch_handle_t tp = NULL;
+
+#if (BOARD_DISP_TOUCH_CONTROLLER > 0)
+/* Set from the touch INT line, the controller is read only when it has new data.
+   Starts set: the first read picks up anything reported before the ISR was installed. */
+static volatile bool touch_data_ready = true;
+static bool touch_int_used = false;
+/* Task sleeping in touchPadWait(), NULL when none */
+static volatile TaskHandle_t touch_wait_task = NULL;
+/* Time of the last INT edge */
+static volatile uint32_t touch_int_us = 0;
+
+static void IRAM_ATTR touch_int_cb(esp_lcd_touch_handle_t tp)
+{
+    TaskHandle_t task = touch_wait_task;
+    BaseType_t need_yield = pdFALSE;
+
+    touch_int_us = (uint32_t)esp_timer_get_time();
+    touch_data_ready = true;
+    if (task != NULL) {
+        vTaskNotifyGiveFromISR(task, &need_yield);
+    }
+    if (need_yield) {
+        portYIELD_FROM_ISR();
+    }
+}
+#endif
+static uint32_t touch_sample_us = 0;
+
+/* A display transfer that takes longer has gone wrong, the game goes on */
+#define BSP_LCD_FLUSH_TIMEOUT_MS    500
+/* Bands of a fill queued before waiting */
+#define BSP_LCD_FILL_BATCH          16
+
+/* Sample time of the press whose turn is in the flush in progress, 0 when none */
+static volatile uint32_t lcd_latency_probe = 0;
+
+static void lcd_latency_done(void)
+{
+    uint32_t t_us = lcd_latency_probe;
+
+    if (t_us != 0) {
+        lcd_latency_probe = 0;
+        input_latency_add((uint32_t)esp_timer_get_time() - t_us);
+    }
+}
+
+/* Resolution of the display the game is drawn on */
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
+#define BSP_LCD_HRES BOARD_DISP_PARALLEL_HRES
+#define BSP_LCD_VRES BOARD_DISP_PARALLEL_VRES
+#elif (BOARD_DISP_RGB_WIDTH > 0)
+#define BSP_LCD_HRES BOARD_DISP_RGB_HRES
+#define BSP_LCD_VRES BOARD_DISP_RGB_VRES
+#elif (BOARD_DISP_SPI_CONTROLLER > 0)
+/* SPI panels are turned to landscape by lcd_spi_init() */
+#define BSP_LCD_HRES ((BOARD_DISP_SPI_HRES > BOARD_DISP_SPI_VRES) ? BOARD_DISP_SPI_HRES : BOARD_DISP_SPI_VRES)
+#define BSP_LCD_VRES ((BOARD_DISP_SPI_HRES > BOARD_DISP_SPI_VRES) ? BOARD_DISP_SPI_VRES : BOARD_DISP_SPI_HRES)
+#endif
+
+static void app_i2c_init(void)
+{
+    i2c_config_t conf = {
+        .mode = I2C_MODE_MASTER,
+        .sda_io_num = BOARD_I2C_SDA,
+        .scl_io_num = BOARD_I2C_SCL,
+        .sda_pullup_en = GPIO_PULLUP_ENABLE,
+        .scl_pullup_en = GPIO_PULLUP_ENABLE,
+    };
+    conf.master.clk_speed = 100000;
+
+  esp_err_t retCode = i2c_param_config(CONFIG_I2C_NUM, &conf);
+  if (retCode != ESP_OK) {
+      printf("i2c_param_config failed\n");
+  } else {
+      retCode = i2c_driver_install(CONFIG_I2C_NUM, conf.mode, 0, 0, 0);
+      if (retCode != ESP_OK) {
+          printf("i2c_driver_install failed\n");
+      } else if (bsp_i2c_start(CONFIG_I2C_NUM, NULL, NULL) != ESP_OK) {
+          printf("bsp_i2c_start failed\n");
+      }
+  }
+}
+
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0) || (BOARD_DISP_SPI_CONTROLLER > 0)
+/* Given once per draw, batch or fill when its last transfer is done */
+static SemaphoreHandle_t lcd_flush_done = NULL;
+
+/* From the transfer done ISR, or from the task when nothing was queued */
+static void lcd_flush_ready_cb(lcd_disp_t * disp)
+{
+   lcd_latency_done();
+   if (xPortInIsrContext()) {
+     BaseType_t woken = pdFALSE;
+     xSemaphoreGiveFromISR(lcd_flush_done, &woken);
+     if (woken) {
+       portYIELD_FROM_ISR();
+     }
+   } else {
+     xSemaphoreGive(lcd_flush_done);
+   }
+}
+
+/* The task sleeps until the display has it all, the bus keeps going without the CPU */
+static void bsp_lcd_wait_flush(void)
+{
+  if (xSemaphoreTake(lcd_flush_done, pdMS_TO_TICKS(BSP_LCD_FLUSH_TIMEOUT_MS)) != pdTRUE) {
+    ESP_LOGW("BSP", "display transfer not done after %d ms", BSP_LCD_FLUSH_TIMEOUT_MS);
+  }
+}
+#endif
+
+static void bsp_lcd_buf_init(void)
+{
+    const lcd_buf_class_cfg_t classes[LCD_BUF_CLASS_MAX] = {
+        [LCD_BUF_TILE] = { 16 * 16 * sizeof(uint16_t), BSP_LCD_TILE_BUFS },
+        [LCD_BUF_BAND] = { BSP_LCD_HRES * BSP_LCD_BAND_LINES * sizeof(uint16_t), 1 },
+        [LCD_BUF_CANVAS] = { BSP_LCD_CANVAS_SIZE, 1 },
+    };
+
+    if (lcd_buf_pool_init(classes) != ESP_OK) {
+      printf("lcd_buf_pool_init: not all classes allocated, using heap fallback\n");
+    }
+}
+
+void lcd_driver_install(void)
+{
+    int64_t t_start = esp_timer_get_time();
+
+    /* Initialize I2C */
+    app_i2c_init();
+
+    /* Flush buffers, before the drivers take their share of DMA memory */
+    bsp_lcd_buf_init();
+
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0) || (BOARD_DISP_SPI_CONTROLLER > 0)
+    lcd_flush_done = xSemaphoreCreateBinary();
+    assert(lcd_flush_done != NULL);
+#endif
+
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
+    /* Initialize Parallel Display */
+    lcd_cfg_t lcd_parallel8080_cfg = {};
+    lcd_parallel8080_cfg.driver = (lcd_driver_t) BOARD_DISP_PARALLEL_CONTROLLER;
+    lcd_parallel8080_cfg.flush_ready_cb = lcd_flush_ready_cb;
+    lcd_parallel8080 = lcd_parallel8080_init(&lcd_parallel8080_cfg);
+    if (lcd_parallel8080 == NULL) {
+      printf("lcd_parallel8080_init failed\n");
+    }
+#elif (BOARD_DISP_RGB_WIDTH > 0) && SOC_LCD_RGB_SUPPORTED
+    /* Initialize RGB Display */
+    lcd_cfg_t lcd_rgb_cfg = {};
+    lcd_rgb = lcd_rgb_init(&lcd_rgb_cfg);
+    if (lcd_rgb == NULL) {
+      printf("lcd_rgb_init failed\n");
+    }
+#elif (BOARD_DISP_SPI_CONTROLLER > 0)
+    /* Initialize SPI Display */
+    lcd_cfg_t lcd_spi_cfg = {};
+    lcd_spi_cfg.driver = (lcd_driver_t) BOARD_DISP_SPI_CONTROLLER;
+    lcd_spi_cfg.flush_ready_cb = lcd_flush_ready_cb;
+    lcd_spi = lcd_spi_init(&lcd_spi_cfg);
+    if (lcd_spi == NULL) {
+      printf("lcd_spi_init failed\n");
+    }
+  #endif
+
+    int64_t t_disp = esp_timer_get_time();
+
+#if (BOARD_DISP_TOUCH_CONTROLLER > 0)
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+#if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
+    esp_lcd_panel_io_i2c_config_t io_config = ESP_LCD_TOUCH_IO_I2C_GT911_CONFIG();
+#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
+    esp_lcd_panel_io_i2c_config_t io_config = ESP_LCD_TOUCH_IO_I2C_TT21100_CONFIG();
+#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
+    esp_lcd_panel_io_i2c_config_t io_config = ESP_LCD_TOUCH_IO_I2C_FT5x06_CONFIG();
+#endif
+ESP_ERROR_CHECK(bsp_i2c_new_panel_io(&io_config, BSP_I2C_PRIO_HIGH, &io_handle));
+
+    /* Initialize touch */
+    esp_lcd_touch_config_t tp_cfg = {
+        .x_max = BOARD_DISP_TOUCH_HRES,
+        .y_max = BOARD_DISP_TOUCH_VRES,
+        .rst_gpio_num = (gpio_num_t) -1,
+        .int_gpio_num = (gpio_num_t) BOARD_DISP_TOUCH_INT,
+        .levels = {
+            .reset = 0,
+            .interrupt = 0,
+        },
+    };
+#if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911) || (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
+    // these drivers install the INT ISR themselves
+    if (BOARD_DISP_TOUCH_INT != GPIO_NUM_NC) {
+        tp_cfg.interrupt_callback = touch_int_cb;
+    }
+#endif
+ 
+    #if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
+        tp_cfg.flags.swap_xy = 1;
+        tp_cfg.flags.mirror_x = 0;
+        tp_cfg.flags.mirror_y = 1;
+        esp_lcd_touch_new_i2c_gt911(io_handle, &tp_cfg, &tp);
+    #elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
+        tp_cfg.flags.swap_xy = 1;
+        tp_cfg.flags.mirror_x = 1;
+        tp_cfg.flags.mirror_y = 1;
+        esp_lcd_touch_new_i2c_tt21100(io_handle, &tp_cfg, &tp);
+    #elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
+        tp_cfg.flags.swap_xy = 0;
+        tp_cfg.flags.mirror_x = 0;
+        tp_cfg.flags.mirror_y = 0;
+        esp_lcd_touch_new_i2c_ft5x06(io_handle, &tp_cfg, &tp);
+    #endif
+#endif
+
+  if (tp == NULL) {
+    printf("\nTouchpad setup ERROR!\n");
+  }
+#if (BOARD_DISP_TOUCH_CONTROLLER > 0)
+  else {
+    touch_int_used = (tp->config.interrupt_callback != NULL);
+  }
+#endif
+
+  int64_t t_touch = esp_timer_get_time();
+
+  // clear screen
+  bsp_lcd_fill(0, 0, BSP_LCD_HRES, BSP_LCD_VRES, 0);
+
+  int64_t t_clear = esp_timer_get_time();
+  ESP_LOGI("BSP", "boot: display %d ms, touch %d ms, clear %d ms, total %d ms",
+           (int)((t_disp - t_start) / 1000), (int)((t_touch - t_disp) / 1000),
+           (int)((t_clear - t_touch) / 1000), (int)((t_clear - t_start) / 1000));
+}
+
+void  bsp_lcd_flush(int x0, int y0, int x1, int y1, void *pixels) {
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
+  if (lcd_parallel8080 == NULL || pixels == NULL) {
+    printf("bsp_lcd_flush:: NULL pointer!\n");
+    return;
+  }
+  lcd_parallel8080_draw(lcd_parallel8080, x0, y0, x1, y1, (void *)pixels);
+  bsp_lcd_wait_flush();
+#elif (BOARD_DISP_RGB_WIDTH > 0) && SOC_LCD_RGB_SUPPORTED
+  if (lcd_rgb == NULL || pixels == NULL) {
+    printf("bsp_lcd_flush:: NULL pointer!\n");
+    return;
+  }
+  // only a copy into the PSRAM frame buffer, the panel refresh runs on its own
+  lcd_rgb_draw(lcd_rgb, x0, y0, x1, y1, (void *)pixels);
+  lcd_latency_done();
+#elif (BOARD_DISP_SPI_CONTROLLER > 0)
+  if (lcd_spi == NULL || pixels == NULL) {
+    printf("bsp_lcd_flush:: NULL pointer!\n");
+    return;
+  }
+  // queued as a DMA transaction, the semaphore is given from the transfer done callback
+  lcd_spi_draw(lcd_spi, x0, y0, x1, y1, (void *)pixels);
+  bsp_lcd_wait_flush();
+#endif
+}
+
+void  bsp_lcd_flush_batch(const lcd_rect_t *rects, void * const *pixels, int n) {
+  if (n <= 0) {
+    return;
+  }
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
+  if (lcd_parallel8080 == NULL || rects == NULL || pixels == NULL) {
+    printf("bsp_lcd_flush_batch:: NULL pointer!\n");
+    return;
+  }
+  // one wait for the whole batch, the i80 queue is kept busy meanwhile
+  lcd_parallel8080_draw_batch(lcd_parallel8080, rects, pixels, n);
+  bsp_lcd_wait_flush();
+#elif (BOARD_DISP_RGB_WIDTH > 0) && SOC_LCD_RGB_SUPPORTED
+  // the latency probe is for the whole batch, it goes with the last rectangle
+  uint32_t probe = lcd_latency_probe;
+  lcd_latency_probe = 0;
+  for (int i = 0; i < n; i++) {
+    if (i == n - 1) {
+      lcd_latency_probe = probe;
+    }
+    bsp_lcd_flush(rects[i].x1, rects[i].y1, rects[i].x2, rects[i].y2, pixels[i]);
+  }
+#elif (BOARD_DISP_SPI_CONTROLLER > 0)
+  if (lcd_spi == NULL || rects == NULL || pixels == NULL) {
+    printf("bsp_lcd_flush_batch:: NULL pointer!\n");
+    return;
+  }
+  // same for SPI: all rectangles queued as DMA transactions, one wait
+  lcd_spi_draw_batch(lcd_spi, rects, pixels, n);
+  bsp_lcd_wait_flush();
+#endif
+}
+
+void  bsp_lcd_fill(int x0, int y0, int x1, int y1, uint16_t color) {
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
+  if (lcd_parallel8080 == NULL) {
+    printf("bsp_lcd_fill:: NULL pointer!\n");
+    return;
+  }
+  const lcd_rect_t rect = { x0, y0, x1, y1 };
+  lcd_parallel8080_fill(lcd_parallel8080, &rect, color);
+  bsp_lcd_wait_flush();
+#else
+  // one band of full lines, flushed again and again: a few bands per batch
+  const int lines = BSP_LCD_BAND_LINES;
+  uint16_t *band = (uint16_t *)lcd_buf_alloc((x1 - x0) * lines * sizeof(uint16_t));
+  if (band == NULL) {
+    printf("bsp_lcd_fill:: no memory!\n");
+    return;
+  }
+  for (int i = 0; i < (x1 - x0) * lines; i++) {
+    band[i] = color;
+  }
+  lcd_rect_t rects[BSP_LCD_FILL_BATCH];
+  void *bands[BSP_LCD_FILL_BATCH];
+  int n = 0;
+  for (int y = y0; y < y1; y += lines) {
+    rects[n] = (lcd_rect_t){ x0, y, x1, (y + lines < y1) ? y + lines : y1 };
+    bands[n] = band;
+    if (++n == BSP_LCD_FILL_BATCH || y + lines >= y1) {
+      bsp_lcd_flush_batch(rects, bands, n);
+      n = 0;
+    }
+  }
+  lcd_buf_free(band);
+#endif
+}
+
+void  bsp_lcd_flush_owned(int x0, int y0, int x1, int y1, void *pixels) {
+  // bsp_lcd_flush() returns once the transfer is done, the buffer is free again
+  bsp_lcd_flush(x0, y0, x1, y1, pixels);
+  lcd_buf_free(pixels);
+}
+
+void  bsp_lcd_frame_done(void) {
+#if (BOARD_DISP_PARALLEL_CONTROLLER > 0)
+  if (lcd_parallel8080 != NULL) {
+    lcd_parallel8080_trace_frame(lcd_parallel8080);
+  }
+#endif
+}
+
+void  bsp_lcd_latency_probe(uint32_t t_us) {
+  lcd_latency_probe = t_us;
+}
+
+void  bsp_lcd_buf_report(void) {
+  static const char *names[LCD_BUF_CLASS_MAX] = { "tile", "band", "canvas" };
+  lcd_buf_stats_t stats;
+
+  for (int i = 0; i < LCD_BUF_CLASS_MAX; i++) {
+    lcd_buf_get_stats((lcd_buf_class_t)i, &stats);
+    ESP_LOGI("BSP", "lcd_buf %-6s allocs %u in use %u high water %u fallbacks %u failures %u", names[i],
+             (unsigned)stats.allocs, (unsigned)stats.in_use, (unsigned)stats.high_water,
+             (unsigned)stats.fallbacks, (unsigned)stats.failures);
+  }
+}
+
+bool touchPadWait(uint32_t timeout_ms) {
+#if (BOARD_DISP_TOUCH_CONTROLLER > 0)
+  if (touch_int_used) {
+    // the flag is checked again after publishing the task, an edge in between is not lost
+    touch_wait_task = xTaskGetCurrentTaskHandle();
+    if (!touch_data_ready) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    }
+    touch_wait_task = NULL;
+    return touch_data_ready;
+  }
+#endif
+  // no INT line: poll at the given period
+  vTaskDelay(pdMS_TO_TICKS(timeout_ms));
+  return true;
+}
+
+uint32_t touchPadSampleTime(void) {
+  return touch_sample_us;
+}
+
+esp_err_t touchPadRead(uint8_t *numTouchedPoints, uint16_t *scrTouchX, uint16_t *scrTouchY) {
+    
+    if (tp == NULL) {
+      printf("\nTouchpad not initialized. NULL pointer.\n");
+      return ESP_FAIL;
+    }
+#if (BOARD_DISP_TOUCH_CONTROLLER > 0)
+    // no INT edge since the last read: no touch, and no I2C traffic
+    if (touch_int_used) {
+      if (!touch_data_ready) {
+        *numTouchedPoints = 0;
+        return ESP_OK;
+      }
+      // cleared before the read, an edge during the read is not lost
+      touch_data_ready = false;
+      // no edge yet when the read was forced at start
+      touch_sample_us = touch_int_us ? touch_int_us : (uint32_t)esp_timer_get_time();
+    } else {
+      touch_sample_us = (uint32_t)esp_timer_get_time();
+    }
+#else
+    touch_sample_us = (uint32_t)esp_timer_get_time();
+#endif
+#if 0 // code for the Esp32-Box
+    uint8_t state = 0;
+    esp_lcd_touch_get_button_state(tp, 0, &state);
+
+    if (state == 0) {
+      numTouchedPoints = 0;
+      return ESP_OK;
+    }
+#endif
+    
+    esp_lcd_touch_read_data(tp);
+
+    /* Read data from touch controller */
+    uint16_t touchpad_x[1] = {0};
+    uint16_t touchpad_y[1] = {0};
+    uint8_t touchpad_cnt = 0;
+
+    bool touchpad_pressed = esp_lcd_touch_get_coordinates(tp, touchpad_x, touchpad_y, NULL, &touchpad_cnt, 1);
+
+    if (touchpad_pressed && touchpad_cnt > 0) {
+        *scrTouchX = BOARD_DISP_TOUCH_VRES - touchpad_x[0];
+        *scrTouchY = touchpad_y[0];
+        *numTouchedPoints = touchpad_cnt;
+        //printf("Touch Detected: #%d - (%d, %d)\n", *numTouchedPoints, *scrTouchX, *scrTouchY);
+    } else {
+        *numTouchedPoints = 0;
+    }
+  return ESP_OK;
+}
@@ -1,13 +1,71 @@
-#pragma once
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-void lcd_driver_install(void);
-void  bsp_lcd_flush(int x0, int y0, int x1, int y1, void *pixels);
-esp_err_t touchPadRead(uint8_t *numTouchedPoints, uint16_t *scrTouchX, uint16_t *scrTouchY);
-
-#ifdef __cplusplus
-}
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lcd.h"
+#include "lcd_buf.h"
+
+/* Flush buffer pool size classes (see lcd_buf.h) */
+#define BSP_LCD_TILE_BUFS       20      /* the game batches 16 tiles */
+#define BSP_LCD_BAND_LINES      8
+#define BSP_LCD_CANVAS_SIZE     (100 * 55 * 2)  /* largest touch button */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void lcd_driver_install(void);
+void  bsp_lcd_flush(int x0, int y0, int x1, int y1, void *pixels);
+/* Flushes n rectangles, returns when all of them are on the display */
+void  bsp_lcd_flush_batch(const lcd_rect_t *rects, void * const *pixels, int n);
+/* Fills x0..x1-1, y0..y1-1 with one color in the pixel format of the flushes (C16), returns when it is on the display */
+void  bsp_lcd_fill(int x0, int y0, int x1, int y1, uint16_t color);
+/* Like bsp_lcd_flush(), pixels come from lcd_buf_alloc() and are given back once on the display */
+void  bsp_lcd_flush_owned(int x0, int y0, int x1, int y1, void *pixels);
+/* Called once per game frame, display bus statistics (LCD_TRACE_ENABLE) */
+void  bsp_lcd_frame_done(void);
+/* Logs usage of the flush buffer pool */
+void  bsp_lcd_buf_report(void);
+/* The next flush (or batch) adds the time from t_us until it is on the display to the input latency
+   histogram. t_us is an esp_timer time, 0 disarms. */
+void  bsp_lcd_latency_probe(uint32_t t_us);
+esp_err_t touchPadRead(uint8_t *numTouchedPoints, uint16_t *scrTouchX, uint16_t *scrTouchY);
+/* Blocks until the touch controller has new data (INT line) or timeout, polls when there is no INT line.
+   Returns true when touchPadRead() should be called. */
+bool touchPadWait(uint32_t timeout_ms);
+/* esp_timer time (us) of the data returned by the last touchPadRead(): the INT edge, or the read itself without INT line */
+uint32_t touchPadSampleTime(void);
+
+/* Score and status shown on the secondary I2C display */
+typedef struct {
+    long score;
+    long hiscore;
+    uint8_t lifes;
+    uint8_t level;
+    uint8_t bonus;
+    uint8_t demo;
+    uint8_t paused;
+} bsp_hud_state_t;
+
+/* Starts the HUD display and its task, font is 8 bytes per character indexed by ASCII code.
+   Returns false when the board has no I2C display or it does not answer. */
+bool bsp_hud_start(const uint8_t *font);
+/* Cheap when nothing changed, the HUD task redraws at its own pace */
+void bsp_hud_update(const bsp_hud_state_t *state);
+
+/* Largest game snapshot */
+#define BSP_SNAPSHOT_MAX        512
+
+/* Keeps a game snapshot in RTC memory (survives a reset, not a power loss) and, with persist, in NVS too.
+   The data is not looked at, the game checks its version and checksum. False when it could not be stored. */
+bool bsp_snapshot_save(const void *data, size_t len, bool persist);
+/* Copies the snapshot from RTC memory, or from NVS with persisted. Returns its length, 0 when there is none. */
+size_t bsp_snapshot_load(void *data, size_t max, bool persisted);
+/* Forgets the snapshot in both places, the game is over */
+void bsp_snapshot_clear(void);
+
+#ifdef __cplusplus
+}
 #endif
\ No newline at end of file
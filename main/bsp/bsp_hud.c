@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+
+#include "board.h"
+#include "lcd.h"
+
+#include "bsp.h"
+
+#if (BOARD_DISP_I2C_CONTROLLER > 0)
+
+/* HUD task: lowest priority above idle, redraws at most every HUD_PERIOD_MS */
+#define HUD_TASK_PRIORITY   1
+#define HUD_TASK_STACK      3072
+#define HUD_PERIOD_MS       100
+
+#define HUD_COLS    (BOARD_DISP_I2C_HRES / 8)
+#define HUD_LINES   (BOARD_DISP_I2C_VRES / 8)
+
+static const char *TAG = "HUD";
+
+static lcd_disp_t *lcd_i2c = NULL;
+static TaskHandle_t hud_task_handle = NULL;
+static const uint8_t *hud_font = NULL;
+
+/* Latest state from the game, copied under the lock */
+static portMUX_TYPE hud_lock = portMUX_INITIALIZER_UNLOCKED;
+static bsp_hud_state_t hud_state;
+
+/* Text currently on the display, one entry per page */
+static char hud_shown[HUD_LINES][HUD_COLS + 1];
+
+/* One 8x8 glyph of the game font (row per byte, MSB left) into 8 page columns (LSB on top) */
+static void hud_glyph(uint8_t *dst, char c)
+{
+    memset(dst, 0, 8);
+    if (c == ' ' || c == 0) {
+        return;
+    }
+    const uint8_t *g = hud_font + ((uint8_t)c << 3);
+    for (int row = 0; row < 8; row++) {
+        uint8_t bits = g[row];
+        for (int col = 0; col < 8; col++) {
+            if (bits & (0x80 >> col)) {
+                dst[col] |= (1 << row);
+            }
+        }
+    }
+}
+
+static void hud_format(const bsp_hud_state_t *s, char text[HUD_LINES][HUD_COLS + 1])
+{
+    memset(text, 0, HUD_LINES * (HUD_COLS + 1));
+    snprintf(text[0], HUD_COLS + 1, "SCORE");
+    snprintf(text[1], HUD_COLS + 1, "%*ld", HUD_COLS, s->score);
+    snprintf(text[3], HUD_COLS + 1, "HIGH SCORE");
+    snprintf(text[4], HUD_COLS + 1, "%*ld", HUD_COLS, s->hiscore);
+    snprintf(text[6], HUD_COLS + 1, "LIVES %u LEVEL %u", s->lifes, s->level);
+    if (s->demo) {
+        snprintf(text[7], HUD_COLS + 1, "DEMO     BONUS %u", s->bonus);
+    } else if (s->paused) {
+        snprintf(text[7], HUD_COLS + 1, "PAUSED   BONUS %u", s->bonus);
+    } else {
+        snprintf(text[7], HUD_COLS + 1, "         BONUS %u", s->bonus);
+    }
+}
+
+static void hud_task(void *arg)
+{
+    static uint8_t page[BOARD_DISP_I2C_HRES];
+    char text[HUD_LINES][HUD_COLS + 1];
+    bsp_hud_state_t s;
+
+    memset(hud_shown, 0, sizeof(hud_shown));
+
+    while (1) {
+        /* Woken by bsp_hud_update() */
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        portENTER_CRITICAL(&hud_lock);
+        s = hud_state;
+        portEXIT_CRITICAL(&hud_lock);
+
+        hud_format(&s, text);
+
+        /* Only the lines that changed go over the I2C bus */
+        for (int line = 0; line < HUD_LINES; line++) {
+            if (memcmp(text[line], hud_shown[line], sizeof(text[line])) == 0) {
+                continue;
+            }
+            for (int col = 0; col < HUD_COLS; col++) {
+                hud_glyph(page + col * 8, text[line][col]);
+            }
+            lcd_i2c_draw(lcd_i2c, 0, line * 8, BOARD_DISP_I2C_HRES, line * 8 + 8, page);
+            memcpy(hud_shown[line], text[line], sizeof(text[line]));
+        }
+
+        /* Own cadence, updates in between are merged */
+        vTaskDelay(pdMS_TO_TICKS(HUD_PERIOD_MS));
+    }
+}
+
+bool bsp_hud_start(const uint8_t *font)
+{
+    if (hud_task_handle != NULL) {
+        return true;
+    }
+
+    lcd_cfg_t lcd_i2c_cfg = {};
+    lcd_i2c_cfg.driver = (lcd_driver_t) BOARD_DISP_I2C_CONTROLLER;
+    lcd_i2c_cfg.i2c.port = CONFIG_I2C_NUM;
+    lcd_i2c = lcd_i2c_init(&lcd_i2c_cfg);
+    if (lcd_i2c == NULL) {
+        ESP_LOGE(TAG, "lcd_i2c_init failed, HUD stays on the main display");
+        return false;
+    }
+
+    hud_font = font;
+    if (xTaskCreate(hud_task, "hud", HUD_TASK_STACK, NULL, HUD_TASK_PRIORITY, &hud_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "HUD task creation failed");
+        return false;
+    }
+
+    return true;
+}
+
+void bsp_hud_update(const bsp_hud_state_t *state)
+{
+    if (hud_task_handle == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&hud_lock);
+    bool changed = (memcmp(&hud_state, state, sizeof(hud_state)) != 0);
+    if (changed) {
+        hud_state = *state;
+    }
+    portEXIT_CRITICAL(&hud_lock);
+
+    if (changed) {
+        xTaskNotifyGive(hud_task_handle);
+    }
+}
+
+#else
+
+bool bsp_hud_start(const uint8_t *font)
+{
+    return false;
+}
+
+void bsp_hud_update(const bsp_hud_state_t *state)
+{
+}
+
+#endif
@@ -0,0 +1,441 @@
+/* Shared I2C bus
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/cdefs.h>
+#include "esp_err.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/i2c.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "bsp_i2c.h"
+
+/* Above the touch task, the bus task only waits for the bus */
+#define BSP_I2C_TASK_PRIORITY   3
+#define BSP_I2C_TASK_STACK      3072
+/* Jobs waiting per priority */
+#define BSP_I2C_QUEUE_DEPTH     8
+
+/*******************************************************************************
+* Types definitions
+*******************************************************************************/
+typedef struct
+{
+    const bsp_i2c_xfer_t * xfers;
+    size_t n;
+    bsp_i2c_done_cb_t done;
+    void * ctx;
+    uint32_t t_submit;      /* esp_timer time */
+} bsp_i2c_job_t;
+
+typedef struct
+{
+    bsp_i2c_dev_stats_t stats;
+    uint32_t fails;         /* consecutive errors */
+    uint32_t backoff_end;   /* esp_timer time */
+} bsp_i2c_dev_t;
+
+/* bsp_i2c_run() waiting for its job */
+typedef struct
+{
+    SemaphoreHandle_t sem;
+    esp_err_t err;
+} bsp_i2c_wait_t;
+
+typedef struct
+{
+    esp_lcd_panel_io_t base;
+    uint8_t addr;
+    bsp_i2c_prio_t prio;
+    size_t cmd_bytes;
+    bool control_phase;
+    uint8_t control_cmd;
+    uint8_t control_data;
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void * user_ctx;
+} bsp_i2c_io_t;
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "I2CBUS";
+
+static int bus_port = 0;
+static bsp_i2c_bus_fn_t bus_fn = NULL;
+static void * bus_ctx = NULL;
+
+static TaskHandle_t bus_task_handle = NULL;
+static QueueHandle_t bus_queue[BSP_I2C_PRIO_MAX];
+/* One count per queued job, whatever its priority */
+static SemaphoreHandle_t bus_jobs = NULL;
+
+static portMUX_TYPE bus_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static bsp_i2c_dev_t bus_devs[BSP_I2C_MAX_DEVICES];
+static size_t bus_dev_count = 0;
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static esp_err_t _bsp_i2c_driver_xfer(int port, const bsp_i2c_xfer_t * xfer, uint32_t timeout_ms, void * ctx)
+{
+    esp_err_t ret = ESP_OK;
+    uint8_t link_buf[I2C_LINK_RECOMMENDED_SIZE(4)] = {0};
+    bool write = (xfer->head_len > 0) || (xfer->data_len > 0) || (xfer->rx_len == 0);
+
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link_buf, sizeof(link_buf));
+    ESP_RETURN_ON_FALSE(cmd != NULL, ESP_ERR_NO_MEM, TAG, "no command link");
+
+    if (write) {
+        ESP_GOTO_ON_ERROR(i2c_master_start(cmd), err, TAG, "start");
+        ESP_GOTO_ON_ERROR(i2c_master_write_byte(cmd, (xfer->addr << 1) | I2C_MASTER_WRITE, true), err, TAG, "address");
+        if (xfer->head_len > 0) {
+            ESP_GOTO_ON_ERROR(i2c_master_write(cmd, xfer->head, xfer->head_len, true), err, TAG, "head");
+        }
+        if (xfer->data_len > 0) {
+            ESP_GOTO_ON_ERROR(i2c_master_write(cmd, xfer->data, xfer->data_len, true), err, TAG, "data");
+        }
+    }
+    if (xfer->rx_len > 0) {
+        /* repeated start after the write */
+        ESP_GOTO_ON_ERROR(i2c_master_start(cmd), err, TAG, "start");
+        ESP_GOTO_ON_ERROR(i2c_master_write_byte(cmd, (xfer->addr << 1) | I2C_MASTER_READ, true), err, TAG, "address");
+        ESP_GOTO_ON_ERROR(i2c_master_read(cmd, xfer->rx, xfer->rx_len, I2C_MASTER_LAST_NACK), err, TAG, "read");
+    }
+    ESP_GOTO_ON_ERROR(i2c_master_stop(cmd), err, TAG, "stop");
+
+    ret = i2c_master_cmd_begin(port, cmd, pdMS_TO_TICKS(timeout_ms));
+err:
+    i2c_cmd_link_delete_static(cmd);
+    return ret;
+}
+
+/* Statistics entry of a device, NULL when the table is full. Bus task only. */
+static bsp_i2c_dev_t * _bsp_i2c_dev(uint8_t addr)
+{
+    for (size_t i = 0; i < bus_dev_count; i++) {
+        if (bus_devs[i].stats.addr == addr) {
+            return &bus_devs[i];
+        }
+    }
+    if (bus_dev_count >= BSP_I2C_MAX_DEVICES) {
+        return NULL;
+    }
+
+    bsp_i2c_dev_t * dev = &bus_devs[bus_dev_count];
+    memset(dev, 0, sizeof(bsp_i2c_dev_t));
+    dev->stats.addr = addr;
+    portENTER_CRITICAL(&bus_stats_lock);
+    bus_dev_count++;
+    portEXIT_CRITICAL(&bus_stats_lock);
+    return dev;
+}
+
+static esp_err_t _bsp_i2c_xfer(const bsp_i2c_xfer_t * xfer, uint32_t wait_us)
+{
+    bsp_i2c_dev_t * dev = _bsp_i2c_dev(xfer->addr);
+    uint32_t t_start = (uint32_t)esp_timer_get_time();
+
+    if (dev != NULL && dev->fails >= BSP_I2C_BACKOFF_ERRORS && (int32_t)(t_start - dev->backoff_end) < 0) {
+        portENTER_CRITICAL(&bus_stats_lock);
+        dev->stats.skipped++;
+        portEXIT_CRITICAL(&bus_stats_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t err = bus_fn(bus_port, xfer, BSP_I2C_TIMEOUT_MS, bus_ctx);
+    uint32_t bus_us = (uint32_t)esp_timer_get_time() - t_start;
+
+    if (dev == NULL) {
+        return err;
+    }
+
+    portENTER_CRITICAL(&bus_stats_lock);
+    bsp_i2c_dev_stats_t * s = &dev->stats;
+    s->xfers++;
+    s->bytes += xfer->head_len + xfer->data_len + xfer->rx_len;
+    s->wait_us += wait_us;
+    if (wait_us > s->wait_us_max) {
+        s->wait_us_max = wait_us;
+    }
+    s->bus_us += bus_us;
+    if (bus_us > s->bus_us_max) {
+        s->bus_us_max = bus_us;
+    }
+    if (err == ESP_ERR_TIMEOUT) {
+        s->timeouts++;
+    } else if (err != ESP_OK) {
+        s->errors++;
+    }
+    portEXIT_CRITICAL(&bus_stats_lock);
+
+    if (err == ESP_OK) {
+        dev->fails = 0;
+    } else if (++dev->fails >= BSP_I2C_BACKOFF_ERRORS) {
+        if (dev->fails == BSP_I2C_BACKOFF_ERRORS) {
+            ESP_LOGW(TAG, "0x%02x: %s, skipped for %d ms", xfer->addr, esp_err_to_name(err), BSP_I2C_BACKOFF_MS);
+        }
+        dev->backoff_end = t_start + bus_us + BSP_I2C_BACKOFF_MS * 1000;
+    }
+    return err;
+}
+
+static void _bsp_i2c_task(void *arg)
+{
+    bsp_i2c_job_t job;
+
+    while (1) {
+        xSemaphoreTake(bus_jobs, portMAX_DELAY);
+
+        /* highest priority first, the count guarantees one of them has a job */
+        for (int prio = 0; prio < BSP_I2C_PRIO_MAX; prio++) {
+            if (xQueueReceive(bus_queue[prio], &job, 0) != pdTRUE) {
+                continue;
+            }
+
+            /* the batch keeps the bus, the wait is charged to its first transfer */
+            uint32_t wait_us = (uint32_t)esp_timer_get_time() - job.t_submit;
+            esp_err_t err = ESP_OK;
+            for (size_t i = 0; i < job.n && err == ESP_OK; i++) {
+                err = _bsp_i2c_xfer(&job.xfers[i], (i == 0) ? wait_us : 0);
+            }
+            if (job.done) {
+                job.done(err, job.ctx);
+            }
+            break;
+        }
+    }
+}
+
+static void _bsp_i2c_run_done(esp_err_t err, void * ctx)
+{
+    bsp_i2c_wait_t * wait = (bsp_i2c_wait_t *)ctx;
+
+    wait->err = err;
+    xSemaphoreGive(wait->sem);
+}
+
+/* Control byte and command bytes (MSB first), as the esp_lcd I2C panel IO sends them */
+static size_t _bsp_i2c_io_head(const bsp_i2c_io_t * i2c_io, int lcd_cmd, bool is_data, uint8_t * head)
+{
+    size_t len = 0;
+
+    if (i2c_io->control_phase) {
+        head[len++] = is_data ? i2c_io->control_data : i2c_io->control_cmd;
+    }
+    if (lcd_cmd >= 0) {
+        for (int i = i2c_io->cmd_bytes - 1; i >= 0; i--) {
+            head[len++] = (lcd_cmd >> (8 * i)) & 0xFF;
+        }
+    }
+    return len;
+}
+
+static esp_err_t _bsp_i2c_io_rx_param(esp_lcd_panel_io_t * io, int lcd_cmd, void * param, size_t param_size)
+{
+    bsp_i2c_io_t * i2c_io = __containerof(io, bsp_i2c_io_t, base);
+    uint8_t head[5];
+    bsp_i2c_xfer_t xfer = {
+        .addr = i2c_io->addr,
+        .head = head,
+        .head_len = _bsp_i2c_io_head(i2c_io, lcd_cmd, false, head),
+        .rx = param,
+        .rx_len = param_size,
+    };
+
+    return bsp_i2c_run(i2c_io->prio, &xfer, 1);
+}
+
+static esp_err_t _bsp_i2c_io_tx_param(esp_lcd_panel_io_t * io, int lcd_cmd, const void * param, size_t param_size)
+{
+    bsp_i2c_io_t * i2c_io = __containerof(io, bsp_i2c_io_t, base);
+    uint8_t head[5];
+    bsp_i2c_xfer_t xfer = {
+        .addr = i2c_io->addr,
+        .head = head,
+        .head_len = _bsp_i2c_io_head(i2c_io, lcd_cmd, false, head),
+        .data = param,
+        .data_len = param ? param_size : 0,
+    };
+
+    return bsp_i2c_run(i2c_io->prio, &xfer, 1);
+}
+
+static esp_err_t _bsp_i2c_io_tx_color(esp_lcd_panel_io_t * io, int lcd_cmd, const void * color, size_t color_size)
+{
+    bsp_i2c_io_t * i2c_io = __containerof(io, bsp_i2c_io_t, base);
+    uint8_t head[5];
+    bsp_i2c_xfer_t xfer = {
+        .addr = i2c_io->addr,
+        .head = head,
+        .head_len = _bsp_i2c_io_head(i2c_io, lcd_cmd, true, head),
+        .data = color,
+        .data_len = color_size,
+    };
+
+    esp_err_t err = bsp_i2c_run(i2c_io->prio, &xfer, 1);
+    if (err == ESP_OK && i2c_io->on_color_trans_done) {
+        i2c_io->on_color_trans_done(io, NULL, i2c_io->user_ctx);
+    }
+    return err;
+}
+
+static esp_err_t _bsp_i2c_io_del(esp_lcd_panel_io_t * io)
+{
+    bsp_i2c_io_t * i2c_io = __containerof(io, bsp_i2c_io_t, base);
+
+    free(i2c_io);
+    return ESP_OK;
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+esp_err_t bsp_i2c_start(int port, bsp_i2c_bus_fn_t bus, void * ctx)
+{
+    if (bus_task_handle != NULL) {
+        return ESP_OK;
+    }
+
+    bus_port = port;
+    bus_fn = bus ? bus : _bsp_i2c_driver_xfer;
+    bus_ctx = ctx;
+
+    for (int prio = 0; prio < BSP_I2C_PRIO_MAX; prio++) {
+        bus_queue[prio] = xQueueCreate(BSP_I2C_QUEUE_DEPTH, sizeof(bsp_i2c_job_t));
+        ESP_RETURN_ON_FALSE(bus_queue[prio] != NULL, ESP_ERR_NO_MEM, TAG, "queue creation failed");
+    }
+    bus_jobs = xSemaphoreCreateCounting(BSP_I2C_QUEUE_DEPTH * BSP_I2C_PRIO_MAX, 0);
+    ESP_RETURN_ON_FALSE(bus_jobs != NULL, ESP_ERR_NO_MEM, TAG, "semaphore creation failed");
+
+    if (xTaskCreate(_bsp_i2c_task, "i2c", BSP_I2C_TASK_STACK, NULL, BSP_I2C_TASK_PRIORITY, &bus_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "I2C bus task creation failed");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "I2C%d bus task started%s", port, bus ? " (custom bus)" : "");
+    return ESP_OK;
+}
+
+esp_err_t bsp_i2c_submit(bsp_i2c_prio_t prio, const bsp_i2c_xfer_t * xfers, size_t n, bsp_i2c_done_cb_t done, void * ctx)
+{
+    assert(bus_task_handle != NULL && prio < BSP_I2C_PRIO_MAX);
+
+    bsp_i2c_job_t job = {
+        .xfers = xfers,
+        .n = n,
+        .done = done,
+        .ctx = ctx,
+        .t_submit = (uint32_t)esp_timer_get_time(),
+    };
+
+    /* never blocks: a full queue means the device is not keeping up */
+    if (xQueueSend(bus_queue[prio], &job, 0) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    xSemaphoreGive(bus_jobs);
+    return ESP_OK;
+}
+
+esp_err_t bsp_i2c_run(bsp_i2c_prio_t prio, const bsp_i2c_xfer_t * xfers, size_t n)
+{
+    /* the bus task would wait for itself */
+    assert(xTaskGetCurrentTaskHandle() != bus_task_handle);
+
+    StaticSemaphore_t sem_buf;
+    bsp_i2c_wait_t wait = {
+        .sem = xSemaphoreCreateBinaryStatic(&sem_buf),
+        .err = ESP_OK,
+    };
+
+    esp_err_t err = bsp_i2c_submit(prio, xfers, n, _bsp_i2c_run_done, &wait);
+    if (err == ESP_OK) {
+        /* every transfer has its own timeout, the job always completes */
+        xSemaphoreTake(wait.sem, portMAX_DELAY);
+        err = wait.err;
+    }
+    vSemaphoreDelete(wait.sem);
+    return err;
+}
+
+esp_err_t bsp_i2c_write(bsp_i2c_prio_t prio, uint8_t addr, const uint8_t * data, size_t len)
+{
+    bsp_i2c_xfer_t xfer = {
+        .addr = addr,
+        .data = data,
+        .data_len = len,
+    };
+
+    return bsp_i2c_run(prio, &xfer, 1);
+}
+
+esp_err_t bsp_i2c_new_panel_io(const esp_lcd_panel_io_i2c_config_t * io_config, bsp_i2c_prio_t prio, esp_lcd_panel_io_handle_t * ret_io)
+{
+    ESP_RETURN_ON_FALSE(io_config && ret_io && prio < BSP_I2C_PRIO_MAX, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(io_config->lcd_cmd_bits <= 32, ESP_ERR_INVALID_ARG, TAG, "invalid command bits");
+
+    bsp_i2c_io_t * i2c_io = calloc(1, sizeof(bsp_i2c_io_t));
+    ESP_RETURN_ON_FALSE(i2c_io != NULL, ESP_ERR_NO_MEM, TAG, "no mem for panel IO");
+
+    uint8_t dc_bit = 1 << io_config->dc_bit_offset;
+    i2c_io->addr = io_config->dev_addr;
+    i2c_io->prio = prio;
+    i2c_io->cmd_bytes = io_config->lcd_cmd_bits / 8;
+    i2c_io->control_phase = (io_config->control_phase_bytes > 0) && !io_config->flags.disable_control_phase;
+    i2c_io->control_cmd = io_config->flags.dc_low_on_data ? dc_bit : 0;
+    i2c_io->control_data = io_config->flags.dc_low_on_data ? 0 : dc_bit;
+    i2c_io->on_color_trans_done = io_config->on_color_trans_done;
+    i2c_io->user_ctx = io_config->user_ctx;
+    i2c_io->base.rx_param = _bsp_i2c_io_rx_param;
+    i2c_io->base.tx_param = _bsp_i2c_io_tx_param;
+    i2c_io->base.tx_color = _bsp_i2c_io_tx_color;
+    i2c_io->base.del = _bsp_i2c_io_del;
+
+    *ret_io = &i2c_io->base;
+    return ESP_OK;
+}
+
+size_t bsp_i2c_get_stats(bsp_i2c_dev_stats_t * stats, size_t max)
+{
+    portENTER_CRITICAL(&bus_stats_lock);
+    size_t n = (bus_dev_count < max) ? bus_dev_count : max;
+    for (size_t i = 0; i < n; i++) {
+        stats[i] = bus_devs[i].stats;
+    }
+    portEXIT_CRITICAL(&bus_stats_lock);
+    return n;
+}
+
+void bsp_i2c_report(void)
+{
+    bsp_i2c_dev_stats_t stats[BSP_I2C_MAX_DEVICES];
+    size_t n = bsp_i2c_get_stats(stats, BSP_I2C_MAX_DEVICES);
+
+    for (size_t i = 0; i < n; i++) {
+        const bsp_i2c_dev_stats_t * s = &stats[i];
+        uint32_t xfers = s->xfers ? s->xfers : 1;
+        ESP_LOGI(TAG, "0x%02x: %u xfers, %u errors, %u timeouts, %u skipped, wait avg %u max %u us, bus avg %u max %u us",
+                 s->addr, (unsigned)s->xfers, (unsigned)s->errors, (unsigned)s->timeouts, (unsigned)s->skipped,
+                 (unsigned)(s->wait_us / xfers), (unsigned)s->wait_us_max,
+                 (unsigned)(s->bus_us / xfers), (unsigned)s->bus_us_max);
+    }
+}
@@ -0,0 +1,149 @@
+/* Shared I2C bus
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+
+/*
+ * One task owns the I2C port, every device (touch, IO expander, HUD display) queues its transfers
+ * to it. High priority jobs go before lower ones, a job of several transfers (batch) keeps the bus
+ * until it is done. Transfers use a short timeout and a device that keeps failing is skipped for a
+ * while, so a NAKing or stretching device only costs its own clients.
+ */
+
+/* Timeout of one transfer on the bus */
+#define BSP_I2C_TIMEOUT_MS          20
+/* Consecutive errors after which a device is skipped for BSP_I2C_BACKOFF_MS */
+#define BSP_I2C_BACKOFF_ERRORS      3
+#define BSP_I2C_BACKOFF_MS          500
+/* Devices with statistics */
+#define BSP_I2C_MAX_DEVICES         8
+
+typedef enum
+{
+    BSP_I2C_PRIO_HIGH,      /* touch */
+    BSP_I2C_PRIO_NORMAL,    /* IO expander */
+    BSP_I2C_PRIO_LOW,       /* HUD display */
+    BSP_I2C_PRIO_MAX,
+} bsp_i2c_prio_t;
+
+/* Write head then data, then with a repeated start read rx (any part can be empty) */
+typedef struct bsp_i2c_xfer_s
+{
+    uint8_t addr;           /* 7 bit address */
+    const uint8_t * head;   /* control and register bytes */
+    size_t head_len;
+    const uint8_t * data;   /* payload */
+    size_t data_len;
+    uint8_t * rx;
+    size_t rx_len;
+} bsp_i2c_xfer_t;
+
+/* Job completion, called from the bus task */
+typedef void (*bsp_i2c_done_cb_t)(esp_err_t err, void * ctx);
+
+/* Runs one transfer, the I2C driver by default. A simulated device can be used instead (host). */
+typedef esp_err_t (*bsp_i2c_bus_fn_t)(int port, const bsp_i2c_xfer_t * xfer, uint32_t timeout_ms, void * bus_ctx);
+
+typedef struct bsp_i2c_dev_stats_s
+{
+    uint8_t addr;
+    uint32_t xfers;
+    uint32_t errors;        /* NAK and other bus errors */
+    uint32_t timeouts;
+    uint32_t skipped;       /* not sent, device in backoff */
+    uint32_t bytes;
+    uint64_t wait_us;       /* queued until the job started, total */
+    uint32_t wait_us_max;
+    uint64_t bus_us;        /* on the bus, total */
+    uint32_t bus_us_max;
+} bsp_i2c_dev_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the bus task, the I2C driver of the port must be installed already
+ *
+ * @param port      -I2C port
+ * @param bus       -transfer function, NULL for the I2C driver
+ * @param bus_ctx   -given to bus
+ * @return
+ *          - ESP_OK on success, ESP_ERR_NO_MEM when the task or queues cannot be created
+ */
+esp_err_t bsp_i2c_start(int port, bsp_i2c_bus_fn_t bus, void * bus_ctx);
+
+/**
+ * @brief Queue a job, returns at once
+ *
+ * @param prio      -job priority
+ * @param xfers     -transfers run back to back, kept valid by the caller until done is called
+ * @param n         -number of transfers
+ * @param done      -completion, can be NULL
+ * @param ctx       -given to done
+ * @return
+ *          - ESP_OK when queued, ESP_ERR_TIMEOUT when the queue is full
+ */
+esp_err_t bsp_i2c_submit(bsp_i2c_prio_t prio, const bsp_i2c_xfer_t * xfers, size_t n, bsp_i2c_done_cb_t done, void * ctx);
+
+/**
+ * @brief Queue a job and wait for it, not from the done callback
+ *
+ * @param prio      -job priority
+ * @param xfers     -transfers run back to back
+ * @param n         -number of transfers
+ * @return
+ *          - result of the first failing transfer, ESP_OK when all succeeded
+ */
+esp_err_t bsp_i2c_run(bsp_i2c_prio_t prio, const bsp_i2c_xfer_t * xfers, size_t n);
+
+/**
+ * @brief Write bytes to a device and wait
+ *
+ * @param prio      -job priority
+ * @param addr      -7 bit address
+ * @param data      -bytes, register first
+ * @param len       -number of bytes
+ */
+esp_err_t bsp_i2c_write(bsp_i2c_prio_t prio, uint8_t addr, const uint8_t * data, size_t len);
+
+/**
+ * @brief Panel IO over the bus task, same protocol as esp_lcd_new_panel_io_i2c()
+ *
+ * @param io_config -as for esp_lcd_new_panel_io_i2c()
+ * @param prio      -priority of all transfers of the IO
+ * @param ret_io    -returned panel IO
+ * @return
+ *          - ESP_OK on success, ESP_ERR_NO_MEM when out of memory
+ */
+esp_err_t bsp_i2c_new_panel_io(const esp_lcd_panel_io_i2c_config_t * io_config, bsp_i2c_prio_t prio, esp_lcd_panel_io_handle_t * ret_io);
+
+/**
+ * @brief Copy the statistics of the devices seen so far
+ *
+ * @param stats     -returned statistics
+ * @param max       -entries in stats
+ * @return
+ *          - number of entries written
+ */
+size_t bsp_i2c_get_stats(bsp_i2c_dev_stats_t * stats, size_t max);
+
+/**
+ * @brief Log the statistics of every device
+ */
+void bsp_i2c_report(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+
+#include "bsp.h"
+
+#define SNAPSHOT_RTC_MAGIC      0x50534e50  /* "PNSP" */
+#define SNAPSHOT_NVS_NAMESPACE  "pacman"
+#define SNAPSHOT_NVS_KEY        "snapshot"
+
+static const char *TAG = "SNAPSHOT";
+
+/* Not initialized at boot: after a reset it still holds the last snapshot, after power on it is
+   garbage (the magic and the game's own checksum tell) */
+RTC_NOINIT_ATTR static uint32_t rtc_magic;
+RTC_NOINIT_ATTR static uint32_t rtc_len;
+RTC_NOINIT_ATTR static uint8_t rtc_data[BSP_SNAPSHOT_MAX];
+
+static bool nvs_opened = false;
+static nvs_handle_t snapshot_nvs;
+
+static bool snapshot_nvs_open(void)
+{
+    if (nvs_opened) {
+        return true;
+    }
+
+    /* Arduino has usually done this already, then it returns ESP_OK */
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        nvs_flash_erase();
+        err = nvs_flash_init();
+    }
+    if (err == ESP_OK) {
+        err = nvs_open(SNAPSHOT_NVS_NAMESPACE, NVS_READWRITE, &snapshot_nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "NVS not available: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    nvs_opened = true;
+    return true;
+}
+
+bool bsp_snapshot_save(const void *data, size_t len, bool persist)
+{
+    if (len > BSP_SNAPSHOT_MAX) {
+        return false;
+    }
+
+    rtc_magic = 0;      /* a reset in between leaves no half written snapshot */
+    memcpy(rtc_data, data, len);
+    rtc_len = len;
+    rtc_magic = SNAPSHOT_RTC_MAGIC;
+
+    if (!persist) {
+        return true;
+    }
+    if (!snapshot_nvs_open()) {
+        return false;
+    }
+    esp_err_t err = nvs_set_blob(snapshot_nvs, SNAPSHOT_NVS_KEY, data, len);
+    if (err == ESP_OK) {
+        err = nvs_commit(snapshot_nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "NVS write failed: %s", esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
+
+size_t bsp_snapshot_load(void *data, size_t max, bool persisted)
+{
+    if (!persisted) {
+        if (rtc_magic != SNAPSHOT_RTC_MAGIC || rtc_len > BSP_SNAPSHOT_MAX || rtc_len > max) {
+            return 0;
+        }
+        memcpy(data, rtc_data, rtc_len);
+        return rtc_len;
+    }
+
+    size_t len = max;
+    if (!snapshot_nvs_open() || nvs_get_blob(snapshot_nvs, SNAPSHOT_NVS_KEY, data, &len) != ESP_OK) {
+        return 0;
+    }
+    return len;
+}
+
+void bsp_snapshot_clear(void)
+{
+    rtc_magic = 0;
+    /* no flash write when there is nothing to erase */
+    if (snapshot_nvs_open() && nvs_erase_key(snapshot_nvs, SNAPSHOT_NVS_KEY) == ESP_OK) {
+        nvs_commit(snapshot_nvs);
+    }
+}
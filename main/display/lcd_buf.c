@@ -0,0 +1,200 @@
+/* Flush buffer pool
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "esp_system.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+
+#include "lcd_buf.h"
+
+#define LCD_BUF_MAX_PER_CLASS   32
+
+/*******************************************************************************
+* Types definitions
+*******************************************************************************/
+typedef struct
+{
+    size_t size;
+    int count;
+    uint8_t * mem;          /* count * size bytes, one block */
+    uint32_t free_mask;     /* bit set = slot free */
+    lcd_buf_stats_t stats;
+} lcd_buf_pool_class_t;
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "LCDBUF";
+
+static lcd_buf_pool_class_t lcd_buf_classes[LCD_BUF_CLASS_MAX];
+static portMUX_TYPE lcd_buf_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static size_t _lcd_buf_round(size_t size)
+{
+    return (size + LCD_BUF_ALIGN - 1) & ~((size_t)LCD_BUF_ALIGN - 1);
+}
+
+static void * _lcd_buf_heap_alloc(size_t size)
+{
+    void * buf = heap_caps_aligned_alloc(LCD_BUF_ALIGN, size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (buf == NULL) {
+        buf = heap_caps_aligned_alloc(LCD_BUF_ALIGN, size, MALLOC_CAP_SPIRAM);
+    }
+    return buf;
+}
+
+static void _lcd_buf_used(lcd_buf_pool_class_t * c)
+{
+    c->stats.allocs++;
+    c->stats.in_use++;
+    if (c->stats.in_use > c->stats.high_water) {
+        c->stats.high_water = c->stats.in_use;
+    }
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+esp_err_t lcd_buf_pool_init(const lcd_buf_class_cfg_t * cfg)
+{
+    esp_err_t ret = ESP_OK;
+
+    assert(cfg != NULL);
+
+    for (int i = 0; i < LCD_BUF_CLASS_MAX; i++) {
+        lcd_buf_pool_class_t * c = &lcd_buf_classes[i];
+        if (c->mem != NULL) {
+            continue;
+        }
+
+        c->size = _lcd_buf_round(cfg[i].size);
+        c->count = (cfg[i].count > LCD_BUF_MAX_PER_CLASS) ? LCD_BUF_MAX_PER_CLASS : cfg[i].count;
+        if (c->size == 0 || c->count <= 0) {
+            c->count = 0;
+            continue;
+        }
+
+        c->mem = heap_caps_aligned_alloc(LCD_BUF_ALIGN, c->size * c->count, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (c->mem == NULL) {
+            /* Still usable by the bus, slower and may need bounce copies */
+            c->mem = heap_caps_aligned_alloc(LCD_BUF_ALIGN, c->size * c->count, MALLOC_CAP_SPIRAM);
+            c->stats.fallbacks += c->count;
+            ESP_LOGW(TAG, "Class %d (%d x %d bytes) in PSRAM", i, c->count, (int)c->size);
+        }
+        if (c->mem == NULL) {
+            ESP_LOGE(TAG, "Class %d (%d x %d bytes) not allocated", i, c->count, (int)c->size);
+            c->stats.failures++;
+            c->count = 0;
+            ret = ESP_ERR_NO_MEM;
+            continue;
+        }
+        c->free_mask = (c->count == 32) ? 0xFFFFFFFF : ((1UL << c->count) - 1);
+    }
+
+    return ret;
+}
+
+void * lcd_buf_alloc(size_t size)
+{
+    lcd_buf_pool_class_t * fit = NULL;
+
+    for (int i = 0; i < LCD_BUF_CLASS_MAX; i++) {
+        lcd_buf_pool_class_t * c = &lcd_buf_classes[i];
+        if (c->size < size) {
+            continue;
+        }
+        if (fit == NULL || c->size < fit->size) {
+            fit = c;
+        }
+    }
+
+    if (fit != NULL) {
+        portENTER_CRITICAL(&lcd_buf_lock);
+        if (fit->free_mask != 0) {
+            int slot = __builtin_ctz(fit->free_mask);
+            fit->free_mask &= ~(1UL << slot);
+            _lcd_buf_used(fit);
+            portEXIT_CRITICAL(&lcd_buf_lock);
+            return fit->mem + slot * fit->size;
+        }
+        portEXIT_CRITICAL(&lcd_buf_lock);
+    }
+
+    /* Class exhausted (or no class that large), the class is kept in front of the buffer */
+    if (fit == NULL) {
+        fit = &lcd_buf_classes[LCD_BUF_CLASS_MAX - 1];
+    }
+    uint8_t * buf = _lcd_buf_heap_alloc(LCD_BUF_ALIGN + _lcd_buf_round(size));
+    portENTER_CRITICAL(&lcd_buf_lock);
+    if (buf != NULL) {
+        fit->stats.fallbacks++;
+        _lcd_buf_used(fit);
+    } else {
+        fit->stats.failures++;
+    }
+    portEXIT_CRITICAL(&lcd_buf_lock);
+
+    if (buf == NULL) {
+        return NULL;
+    }
+    *(lcd_buf_pool_class_t **)buf = fit;
+    buf += LCD_BUF_ALIGN;
+
+    return buf;
+}
+
+void lcd_buf_free(void * buf)
+{
+    if (buf == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&lcd_buf_lock);
+    for (int i = 0; i < LCD_BUF_CLASS_MAX; i++) {
+        lcd_buf_pool_class_t * c = &lcd_buf_classes[i];
+        uint8_t * p = (uint8_t *)buf;
+        if (c->mem != NULL && p >= c->mem && p < c->mem + c->size * c->count) {
+            c->free_mask |= (1UL << ((p - c->mem) / c->size));
+            c->stats.in_use--;
+            portEXIT_CRITICAL(&lcd_buf_lock);
+            return;
+        }
+    }
+    portEXIT_CRITICAL(&lcd_buf_lock);
+
+    /* Heap fallback */
+    uint8_t * p = (uint8_t *)buf - LCD_BUF_ALIGN;
+    lcd_buf_pool_class_t * fit = *(lcd_buf_pool_class_t **)p;
+    heap_caps_free(p);
+
+    portENTER_CRITICAL(&lcd_buf_lock);
+    fit->stats.in_use--;
+    portEXIT_CRITICAL(&lcd_buf_lock);
+}
+
+void lcd_buf_get_stats(lcd_buf_class_t cls, lcd_buf_stats_t * stats)
+{
+    assert(cls < LCD_BUF_CLASS_MAX && stats != NULL);
+
+    portENTER_CRITICAL(&lcd_buf_lock);
+    *stats = lcd_buf_classes[cls].stats;
+    portEXIT_CRITICAL(&lcd_buf_lock);
+}
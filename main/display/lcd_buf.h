@@ -0,0 +1,88 @@
+/* Flush buffer pool
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/*
+ * Buffers handed to the display drivers come from fixed size classes, allocated once in
+ * DMA capable internal RAM and aligned for the LCD bus (64 bytes covers the PSRAM alignment too).
+ */
+
+#define LCD_BUF_ALIGN   64
+
+typedef enum
+{
+    LCD_BUF_TILE,       /* one game tile */
+    LCD_BUF_BAND,       /* some full display lines */
+    LCD_BUF_CANVAS,     /* touch button face */
+    LCD_BUF_CLASS_MAX,
+} lcd_buf_class_t;
+
+typedef struct lcd_buf_class_cfg_s
+{
+    size_t size;        /* bytes per buffer */
+    int count;          /* buffers in the pool */
+} lcd_buf_class_cfg_t;
+
+typedef struct lcd_buf_stats_s
+{
+    uint32_t allocs;        /* successful allocations */
+    uint32_t in_use;        /* buffers currently handed out */
+    uint32_t high_water;    /* maximum of in_use */
+    uint32_t fallbacks;     /* served from the heap (pool empty or pool in PSRAM) */
+    uint32_t failures;      /* no memory at all */
+} lcd_buf_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Allocate the pool
+ *
+ * Classes that don't fit in DMA capable internal RAM are put in PSRAM (counted as fallbacks).
+ *
+ * @param cfg   -size and number of buffers of each class, LCD_BUF_CLASS_MAX entries
+ * @return
+ *          - ESP_OK on success, ESP_ERR_NO_MEM when a class could not be allocated at all
+ */
+esp_err_t lcd_buf_pool_init(const lcd_buf_class_cfg_t * cfg);
+
+/**
+ * @brief Take a buffer of the smallest class that fits
+ *
+ * Falls back to a heap allocation with the same alignment when the class is exhausted.
+ *
+ * @param size  -bytes needed
+ * @return
+ *          - buffer or NULL when out of memory
+ */
+void * lcd_buf_alloc(size_t size);
+
+/**
+ * @brief Give a buffer back (pool or heap fallback)
+ *
+ * @param buf   -buffer from lcd_buf_alloc(), NULL is ignored
+ */
+void lcd_buf_free(void * buf);
+
+/**
+ * @brief Get statistics of one class
+ *
+ * @param cls   -buffer class
+ * @param stats -returned statistics
+ */
+void lcd_buf_get_stats(lcd_buf_class_t cls, lcd_buf_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,67 @@
+/* Frame buffer helpers
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+
+#include "lcd_fb.h"
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+int lcd_fb_copy_rect(uint16_t * fb, int fb_width, int fb_height, int x1, int y1, int x2, int y2, const uint16_t * src)
+{
+    if (fb == NULL || src == NULL || x1 >= x2 || y1 >= y2) {
+        return 0;
+    }
+
+    /* Source line stride is the unclipped rectangle width */
+    int src_stride = x2 - x1;
+
+    /* Clip to the frame buffer */
+    if (x1 < 0) {
+        src -= x1;
+        x1 = 0;
+    }
+    if (y1 < 0) {
+        src -= y1 * src_stride;
+        y1 = 0;
+    }
+    if (x2 > fb_width) {
+        x2 = fb_width;
+    }
+    if (y2 > fb_height) {
+        y2 = fb_height;
+    }
+    if (x1 >= x2 || y1 >= y2) {
+        return 0;
+    }
+
+    int w = x2 - x1;
+    int h = y2 - y1;
+    uint16_t * dst = fb + (size_t)y1 * fb_width + x1;
+
+    /* Full lines are contiguous on both sides */
+    if (w == fb_width && w == src_stride) {
+        memcpy(dst, src, (size_t)w * h * sizeof(uint16_t));
+        return w * h;
+    }
+
+    for (int y = 0; y < h; y++) {
+        memcpy(dst, src, (size_t)w * sizeof(uint16_t));
+        dst += fb_width;
+        src += src_stride;
+    }
+
+    return w * h;
+}
@@ -0,0 +1,43 @@
+/* Frame buffer helpers
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Plain C, no ESP-IDF dependency: these helpers can be compiled and checked on the host.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Copy a dirty rectangle of 16-bit pixels into a frame buffer
+ *
+ * The rectangle is clipped to the frame buffer. Rows are copied with one memcpy each
+ * (a single memcpy when the rectangle spans full frame buffer lines), so the frame
+ * buffer is written sequentially and cache lines are filled only once.
+ *
+ * @param fb        -frame buffer
+ * @param fb_width  -frame buffer width in pixels (line stride)
+ * @param fb_height -frame buffer height in pixels
+ * @param x1        -X1 offset
+ * @param y1        -Y1 offset
+ * @param x2        -X2 offset (exclusive)
+ * @param y2        -Y2 offset (exclusive)
+ * @param src       -source pixels, (x2 - x1) * (y2 - y1) packed
+ * @return
+ *          - number of copied pixels
+ */
+int lcd_fb_copy_rect(uint16_t * fb, int fb_width, int fb_height, int x1, int y1, int x2, int y2, const uint16_t * src);
+
+#ifdef __cplusplus
+}
+#endif
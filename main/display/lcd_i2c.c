@@ -0,0 +1,147 @@
+/* I2C LCD display
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include "esp_system.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "esp_lcd_panel_io.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "board.h"
+
+#include "lcd.h"
+#include "bsp_i2c.h"
+
+#define EXAMPLE_LCD_RST_ON  0
+#define EXAMPLE_LCD_RST_OFF 1
+
+#define EXAMPLE_SH1107_ADDR 0x3C
+
+/* SH1107 commands */
+#define SH1107_CMD_SET_LOWER_COL    0x00
+#define SH1107_CMD_SET_HIGHER_COL   0x10
+#define SH1107_CMD_SET_PAGE_ADDR    0xB0
+#define SH1107_CMD_DISP_ON          0xAF
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "LCDI2C";
+
+static lcd_disp_t lcd_display = {0};
+
+/* SH1107 128x64, page addressing */
+static const lcd_cmdset_t lcd_sh1107_init[] = {
+    {0xAE, {0}, 0},         /* Display off */
+    {0xDC, {0x00}, 1},      /* Display start line */
+    {0x81, {0x2F}, 1},      /* Contrast */
+    {0x20, {0}, 0},         /* Page addressing mode */
+    {0xA0, {0}, 0},         /* Segment remap */
+    {0xC0, {0}, 0},         /* COM scan direction */
+    {0xA8, {0x7F}, 1},      /* Multiplex ratio */
+    {0xD3, {0x60}, 1},      /* Display offset */
+    {0xD5, {0x51}, 1},      /* Clock divider */
+    {0xD9, {0x22}, 1},      /* Pre-charge period */
+    {0xDB, {0x35}, 1},      /* VCOMH deselect level */
+    {0xA4, {0}, 0},         /* Output follows RAM */
+    {0xA6, {0}, 0},         /* Normal display */
+};
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+lcd_disp_t * lcd_i2c_init(lcd_cfg_t * config)
+{
+    lcd_disp_t * disp = &lcd_display;
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+
+    assert(config != NULL);
+
+    disp->driver = config->driver;
+    disp->conn_type = LCD_CONN_TYPE_I2C;
+    disp->user_data = NULL;
+    disp->i2c.port = config->i2c.port;
+    disp->i2c.address = EXAMPLE_SH1107_ADDR;
+
+    if (config->driver != LCD_DRIVER_SH1107) {
+        ESP_LOGE(TAG, "Not supported LCD driver!");
+        return NULL;
+    }
+
+    /* I2C bus task is already started by the BSP, the HUD goes after the touch controller */
+    esp_lcd_panel_io_i2c_config_t io_config = {
+        .dev_addr = EXAMPLE_SH1107_ADDR,
+        .control_phase_bytes = 1,
+        .dc_bit_offset = 6,
+        .lcd_cmd_bits = 8,
+        .lcd_param_bits = 8,
+    };
+    ESP_ERROR_CHECK(bsp_i2c_new_panel_io(&io_config, BSP_I2C_PRIO_LOW, &io_handle));
+    disp->handle = io_handle;
+
+    if (BOARD_DISP_I2C_RST != GPIO_NUM_NC) {
+        gpio_config_t rst_conf = {
+            .mode = GPIO_MODE_OUTPUT,
+            .pin_bit_mask = BIT64(BOARD_DISP_I2C_RST),
+        };
+        ESP_ERROR_CHECK(gpio_config(&rst_conf));
+        gpio_set_level(BOARD_DISP_I2C_RST, EXAMPLE_LCD_RST_ON);
+        vTaskDelay(pdMS_TO_TICKS(10));
+        gpio_set_level(BOARD_DISP_I2C_RST, EXAMPLE_LCD_RST_OFF);
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    for (int i = 0; i < sizeof(lcd_sh1107_init) / sizeof(lcd_sh1107_init[0]); i++) {
+        const lcd_cmdset_t * cmd = &lcd_sh1107_init[i];
+        if (esp_lcd_panel_io_tx_param(io_handle, cmd->cmd, cmd->length ? cmd->data : NULL, cmd->length) != ESP_OK) {
+            ESP_LOGE(TAG, "SH1107 not responding!");
+            esp_lcd_panel_io_del(io_handle);
+            disp->handle = NULL;
+            return NULL;
+        }
+    }
+
+    /* Clear RAM before switching on */
+    uint8_t zero[BOARD_DISP_I2C_HRES] = {0};
+    for (int page = 0; page < BOARD_DISP_I2C_VRES / 8; page++) {
+        lcd_i2c_draw(disp, 0, page * 8, BOARD_DISP_I2C_HRES, page * 8 + 8, zero);
+    }
+    esp_lcd_panel_io_tx_param(io_handle, SH1107_CMD_DISP_ON, NULL, 0);
+
+    ESP_LOGI(TAG, "Initialized SH1107 %dx%d", BOARD_DISP_I2C_HRES, BOARD_DISP_I2C_VRES);
+
+    return disp;
+}
+
+void lcd_i2c_draw(lcd_disp_t * disp, int x1, int y1, int x2, int y2, void * color)
+{
+    assert(disp != NULL);
+    esp_lcd_panel_io_handle_t io_handle = (esp_lcd_panel_io_handle_t)(disp->handle);
+    const uint8_t * data = (const uint8_t *)color;
+
+    assert(io_handle != NULL);
+
+    /* 1 bpp, one byte is 8 vertical pixels of one page (LSB on top): y1 and y2 are page aligned */
+    assert(((y1 & 7) == 0) && ((y2 & 7) == 0));
+
+    for (int page = y1 / 8; page < y2 / 8; page++) {
+        esp_lcd_panel_io_tx_param(io_handle, SH1107_CMD_SET_PAGE_ADDR | page, NULL, 0);
+        esp_lcd_panel_io_tx_param(io_handle, SH1107_CMD_SET_LOWER_COL | (x1 & 0x0F), NULL, 0);
+        esp_lcd_panel_io_tx_param(io_handle, SH1107_CMD_SET_HIGHER_COL | ((x1 >> 4) & 0x07), NULL, 0);
+        esp_lcd_panel_io_tx_color(io_handle, -1, data, x2 - x1);
+        data += x2 - x1;
+    }
+}
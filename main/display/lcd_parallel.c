@@ -1,216 +1,422 @@
-/* LVGL SPI LCD display example
-
-   This example code is in the Public Domain (or CC0 licensed, at your option.)
-
-   Unless required by applicable law or agreed to in writing, this
-   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
-   CONDITIONS OF ANY KIND, either express or implied.
-*/
-
-/*******************************************************************************
-* Includes
-*******************************************************************************/
-#include <stdio.h>
-#include "esp_system.h"
-#include "esp_err.h"
-#include "esp_log.h"
-#include "driver/gpio.h"
-#include "driver/i2c.h"
-#include "esp_lcd_panel_io.h"
-#include "esp_lcd_panel_vendor.h"
-#include "esp_lcd_panel_ops.h"
-#include "esp_lcd_ra8875.h"
-#include "esp_lcd_rm68120.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "board.h"
-
-#include "lcd.h"
-
-#define EXAMPLE_LCD_RST_ON  0
-#define EXAMPLE_LCD_RST_OFF 1
-
-#define EXAMPLE_TCA9554_ADDR 0x20
-
-#define EXAMPLE_I2C_MASTER_TIMEOUT_MS 1000
-
-/*******************************************************************************
-* Types definitions
-*******************************************************************************/
-
-/*******************************************************************************
-* Local variables
-*******************************************************************************/
-static const char *TAG = "LCD8080";
-
-static lcd_disp_t lcd_display = {0};
-static flush_ready_cb_t lcd_flush_ready_cb = NULL;
-
-/*******************************************************************************
-* Private functions
-*******************************************************************************/
-
-static bool _lcd_parallel8080_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
-{
-    if (lcd_flush_ready_cb)
-        lcd_flush_ready_cb(user_ctx);
-
-    return false;
-}
-
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-static void _lcd_rm68120_reset()
-{
-    uint8_t write_buf[2] = {0x01, 0xCD};
-    i2c_master_write_to_device(CONFIG_I2C_NUM, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf), EXAMPLE_I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS);
-    vTaskDelay(pdMS_TO_TICKS(20));
-    write_buf[1] = 0xCF;
-    i2c_master_write_to_device(CONFIG_I2C_NUM, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf), EXAMPLE_I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS);
-}
-#endif
-
-/*******************************************************************************
-* Public API functions
-*******************************************************************************/
-
-lcd_disp_t * lcd_parallel8080_init(lcd_cfg_t * config)
-{
-    lcd_disp_t * disp = &lcd_display;
-    esp_lcd_panel_handle_t lcd_panel_handle = NULL;
-
-    assert(config != NULL);
-
-    disp->driver = config->driver;
-    disp->conn_type = LCD_CONN_TYPE_PARALLEL8080;
-    disp->user_data = NULL;
-
-    /* Save flush ready callback */
-    lcd_flush_ready_cb = config->flush_ready_cb;
-
-    if (config->driver == LCD_DRIVER_RM68120) {
-        uint8_t write_buf[2] = {0x03, 0x05};
-        i2c_master_write_to_device(CONFIG_I2C_NUM, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf), EXAMPLE_I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS);
-        write_buf[0] = 0x01;
-        write_buf[1] = 0xCF;
-        i2c_master_write_to_device(CONFIG_I2C_NUM, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf), EXAMPLE_I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS);
-    }
-
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-    _lcd_rm68120_reset();
-#endif
-
-    /* Init Intel 8080 bus */
-    esp_lcd_i80_bus_handle_t i80_bus = NULL;
-    esp_lcd_i80_bus_config_t bus_config = {
-        .clk_src = LCD_CLK_SRC_PLL160M,
-        .dc_gpio_num = BOARD_DISP_PARALLEL_DC,
-        .wr_gpio_num = BOARD_DISP_PARALLEL_WR,
-        .data_gpio_nums = {
-            BOARD_DISP_PARALLEL_DB0,
-            BOARD_DISP_PARALLEL_DB1,
-            BOARD_DISP_PARALLEL_DB2,
-            BOARD_DISP_PARALLEL_DB3,
-            BOARD_DISP_PARALLEL_DB4,
-            BOARD_DISP_PARALLEL_DB5,
-            BOARD_DISP_PARALLEL_DB6,
-            BOARD_DISP_PARALLEL_DB7,
-            BOARD_DISP_PARALLEL_DB8,
-            BOARD_DISP_PARALLEL_DB9,
-            BOARD_DISP_PARALLEL_DB10,
-            BOARD_DISP_PARALLEL_DB11,
-            BOARD_DISP_PARALLEL_DB12,
-            BOARD_DISP_PARALLEL_DB13,
-            BOARD_DISP_PARALLEL_DB14,
-            BOARD_DISP_PARALLEL_DB15,
-        },
-        .bus_width = BOARD_DISP_PARALLEL_WIDTH,
-        .max_transfer_bytes = (BOARD_DISP_PARALLEL_HRES) * 80 * sizeof(uint16_t),
-        .psram_trans_align = 64,
-        .sram_trans_align = 4,
-    };
-    ESP_ERROR_CHECK(esp_lcd_new_i80_bus(&bus_config, &i80_bus));
-    esp_lcd_panel_io_handle_t io_handle = NULL;
-    esp_lcd_panel_io_i80_config_t io_config = {
-        .cs_gpio_num = BOARD_DISP_PARALLEL_CS,
-        .pclk_hz = 10 * 1000 * 1000,
-        .trans_queue_depth = 10,
-        .dc_levels = {
-            .dc_idle_level = 0,
-            .dc_cmd_level = 1,
-            .dc_dummy_level = 0,
-            .dc_data_level = 0,
-        },
-        .on_color_trans_done = _lcd_parallel8080_flush_ready,
-        .user_ctx = disp,
-        .lcd_cmd_bits = 16,
-        .lcd_param_bits = 8,
-    };
-
-    /* Intialize selected controller */
-    if (config->driver == LCD_DRIVER_RM68120) {
-        io_config.dc_levels.dc_cmd_level = 0;
-        io_config.dc_levels.dc_data_level = 1;
-        io_config.lcd_cmd_bits = 16;
-        io_config.pclk_hz = 40 * 1000 * 1000;
-
-        #ifdef CONFIG_LV_COLOR_16_SWAP
-        ESP_LOGW(TAG, "CONFIG_LV_COLOR_16_SWAP should be disabled!");
-        #endif
-
-    } else if (config->driver == LCD_DRIVER_RA8875) {
-        io_config.dc_levels.dc_cmd_level = 1;
-        io_config.dc_levels.dc_data_level = 0;
-        io_config.flags.swap_color_bytes = 1;
-        io_config.flags.pclk_idle_low = 0;
-        io_config.pclk_hz = 20 * 1000 * 1000; //TODO: can be 40 MHz, when connected on board (not via wires)
-    } else {
-        ESP_LOGE(TAG, "Not supported LCD driver!");
-        return NULL;
-    }
-    ESP_ERROR_CHECK(esp_lcd_new_panel_io_i80(i80_bus, &io_config, &io_handle));
-
-    const esp_lcd_panel_ra8875_config_t vendor_config = {
-        .wait_gpio_num = BOARD_DISP_PARALLEL_WAIT,
-        .lcd_width = BOARD_DISP_PARALLEL_HRES,
-        .lcd_height = BOARD_DISP_PARALLEL_VRES,
-        .mcu_bit_interface = BOARD_DISP_PARALLEL_WIDTH,
-    };
-
-    esp_lcd_panel_dev_config_t panel_config = {
-        .reset_gpio_num = BOARD_DISP_PARALLEL_RST,
-        .color_space = ESP_LCD_COLOR_SPACE_RGB,
-        .bits_per_pixel = 16,
-        .vendor_config = (void*)&vendor_config,
-    };
-    if (config->driver == LCD_DRIVER_RM68120) {
-        ESP_ERROR_CHECK(esp_lcd_new_panel_rm68120(io_handle, &panel_config, &lcd_panel_handle));
-    }else{
-        ESP_ERROR_CHECK(esp_lcd_new_panel_ra8875(io_handle, &panel_config, &lcd_panel_handle));
-    }
-
-	ESP_ERROR_CHECK(esp_lcd_panel_reset(lcd_panel_handle));
-    ESP_ERROR_CHECK(esp_lcd_panel_init(lcd_panel_handle));
-	ESP_ERROR_CHECK(esp_lcd_panel_disp_off(lcd_panel_handle, false));
-
-    disp->handle = lcd_panel_handle;
-
-    ESP_LOGI(TAG, "Initialized Intel 8080 bus");
-
-	vTaskDelay(pdMS_TO_TICKS(10));
-
-    return disp;
-}
-
-void lcd_parallel8080_draw(lcd_disp_t * disp, int x1, int y1, int x2, int y2, void * color)
-{
-    assert(disp != NULL);
-    esp_lcd_panel_handle_t lcd_panel_handle = (esp_lcd_panel_handle_t)(disp->handle);
-
-    assert(lcd_panel_handle != NULL);
-
-    esp_lcd_panel_draw_bitmap(lcd_panel_handle, x1, y1, x2, y2, color);
-}
-
-void lcd_parallel8080_set_brightness(lcd_disp_t * disp, uint8_t percent)
-{
-}
+/* LVGL SPI LCD display example
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "esp_system.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "driver/gpio.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_vendor.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_ra8875.h"
+#include "esp_lcd_rm68120.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "board.h"
+
+#include "lcd.h"
+#include "lcd_buf.h"
+#include "lcd_trace.h"
+#include "bsp_i2c.h"
+
+#define EXAMPLE_LCD_RST_ON  0
+#define EXAMPLE_LCD_RST_OFF 1
+
+#define EXAMPLE_TCA9554_ADDR 0x20
+
+/* Frames averaged in one trace log line */
+#define LCD_TRACE_REPORT_FRAMES 30
+
+/* Lines of the fill buffer, streamed again and again (same size as the pool band class) */
+#define LCD_FILL_LINES  8
+
+/* RM68120 rectangles given to the driver at once */
+#define LCD_RM68120_BATCH   16
+
+/*******************************************************************************
+* Types definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "LCD8080";
+
+static lcd_disp_t lcd_display = {0};
+static flush_ready_cb_t lcd_flush_ready_cb = NULL;
+
+/* Color transfers of the current draw/batch not finished yet, plus one while it is being queued */
+static volatile int lcd_pending = 0;
+static portMUX_TYPE lcd_pending_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* One color buffer for fills, kept once allocated */
+static uint16_t * lcd_fill_buf = NULL;
+static int lcd_fill_color = -1;
+
+#if LCD_TRACE_ENABLE
+static esp_lcd_panel_io_handle_t lcd_trace_io = NULL;
+#endif
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static bool _lcd_parallel8080_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    portENTER_CRITICAL_ISR(&lcd_pending_lock);
+    bool last = (lcd_pending > 0) && (--lcd_pending == 0);
+    portEXIT_CRITICAL_ISR(&lcd_pending_lock);
+
+    if (last && lcd_flush_ready_cb)
+        lcd_flush_ready_cb(user_ctx);
+
+    return false;
+}
+
+/* Transfers about to be queued, counted before they can complete */
+static void _lcd_parallel8080_hold(int count)
+{
+    portENTER_CRITICAL(&lcd_pending_lock);
+    lcd_pending += count;
+    portEXIT_CRITICAL(&lcd_pending_lock);
+}
+
+/* Pending transfers less from the task: ones that were not queued (e.g. controller busy timeout),
+   or the end of queueing */
+static void _lcd_parallel8080_release(lcd_disp_t * disp, int count)
+{
+    portENTER_CRITICAL(&lcd_pending_lock);
+    bool last = (count > 0) && (lcd_pending >= count) && ((lcd_pending -= count) == 0);
+    portEXIT_CRITICAL(&lcd_pending_lock);
+
+    if (last && lcd_flush_ready_cb)
+        lcd_flush_ready_cb(disp);
+}
+
+/* RA8875 pixels are B5 R5 G6 (C16 of the board), the drawing engine takes red, green and blue */
+static uint16_t _lcd_ra8875_engine_color(uint16_t pixel)
+{
+    uint16_t b = pixel >> 11;
+    uint16_t r = (pixel >> 6) & 0x1F;
+    uint16_t g = pixel & 0x3F;
+
+    return (r << 11) | (g << 5) | b;
+}
+
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+static void _lcd_rm68120_reset()
+{
+    uint8_t write_buf[2] = {0x01, 0xCD};
+    bsp_i2c_write(BSP_I2C_PRIO_NORMAL, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf));
+    vTaskDelay(pdMS_TO_TICKS(20));
+    write_buf[1] = 0xCF;
+    bsp_i2c_write(BSP_I2C_PRIO_NORMAL, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf));
+}
+#endif
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+lcd_disp_t * lcd_parallel8080_init(lcd_cfg_t * config)
+{
+    lcd_disp_t * disp = &lcd_display;
+    esp_lcd_panel_handle_t lcd_panel_handle = NULL;
+
+    assert(config != NULL);
+
+    disp->driver = config->driver;
+    disp->conn_type = LCD_CONN_TYPE_PARALLEL8080;
+    disp->user_data = NULL;
+
+    /* Save flush ready callback */
+    lcd_flush_ready_cb = config->flush_ready_cb;
+
+    if (config->driver == LCD_DRIVER_RM68120) {
+        uint8_t write_buf[2] = {0x03, 0x05};
+        bsp_i2c_write(BSP_I2C_PRIO_NORMAL, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf));
+        write_buf[0] = 0x01;
+        write_buf[1] = 0xCF;
+        bsp_i2c_write(BSP_I2C_PRIO_NORMAL, EXAMPLE_TCA9554_ADDR, write_buf, sizeof(write_buf));
+    }
+
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+    _lcd_rm68120_reset();
+#endif
+
+    /* Init Intel 8080 bus */
+    esp_lcd_i80_bus_handle_t i80_bus = NULL;
+    esp_lcd_i80_bus_config_t bus_config = {
+        .clk_src = LCD_CLK_SRC_PLL160M,
+        .dc_gpio_num = BOARD_DISP_PARALLEL_DC,
+        .wr_gpio_num = BOARD_DISP_PARALLEL_WR,
+        .data_gpio_nums = {
+            BOARD_DISP_PARALLEL_DB0,
+            BOARD_DISP_PARALLEL_DB1,
+            BOARD_DISP_PARALLEL_DB2,
+            BOARD_DISP_PARALLEL_DB3,
+            BOARD_DISP_PARALLEL_DB4,
+            BOARD_DISP_PARALLEL_DB5,
+            BOARD_DISP_PARALLEL_DB6,
+            BOARD_DISP_PARALLEL_DB7,
+            BOARD_DISP_PARALLEL_DB8,
+            BOARD_DISP_PARALLEL_DB9,
+            BOARD_DISP_PARALLEL_DB10,
+            BOARD_DISP_PARALLEL_DB11,
+            BOARD_DISP_PARALLEL_DB12,
+            BOARD_DISP_PARALLEL_DB13,
+            BOARD_DISP_PARALLEL_DB14,
+            BOARD_DISP_PARALLEL_DB15,
+        },
+        .bus_width = BOARD_DISP_PARALLEL_WIDTH,
+        .max_transfer_bytes = (BOARD_DISP_PARALLEL_HRES) * 80 * sizeof(uint16_t),
+        .psram_trans_align = 64,
+        .sram_trans_align = 4,
+    };
+    ESP_ERROR_CHECK(esp_lcd_new_i80_bus(&bus_config, &i80_bus));
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+    esp_lcd_panel_io_i80_config_t io_config = {
+        .cs_gpio_num = BOARD_DISP_PARALLEL_CS,
+        .pclk_hz = 10 * 1000 * 1000,
+        .trans_queue_depth = 10,
+        .dc_levels = {
+            .dc_idle_level = 0,
+            .dc_cmd_level = 1,
+            .dc_dummy_level = 0,
+            .dc_data_level = 0,
+        },
+        .on_color_trans_done = _lcd_parallel8080_flush_ready,
+        .user_ctx = disp,
+        .lcd_cmd_bits = 16,
+        .lcd_param_bits = 8,
+    };
+
+    /* Intialize selected controller */
+    if (config->driver == LCD_DRIVER_RM68120) {
+        io_config.dc_levels.dc_cmd_level = 0;
+        io_config.dc_levels.dc_data_level = 1;
+        io_config.lcd_cmd_bits = 16;
+        io_config.pclk_hz = 40 * 1000 * 1000;
+
+        #ifdef CONFIG_LV_COLOR_16_SWAP
+        ESP_LOGW(TAG, "CONFIG_LV_COLOR_16_SWAP should be disabled!");
+        #endif
+
+    } else if (config->driver == LCD_DRIVER_RA8875) {
+        io_config.dc_levels.dc_cmd_level = 1;
+        io_config.dc_levels.dc_data_level = 0;
+        io_config.flags.swap_color_bytes = 1;
+        io_config.flags.pclk_idle_low = 0;
+        io_config.pclk_hz = 20 * 1000 * 1000; //TODO: can be 40 MHz, when connected on board (not via wires)
+    } else {
+        ESP_LOGE(TAG, "Not supported LCD driver!");
+        return NULL;
+    }
+    ESP_ERROR_CHECK(esp_lcd_new_panel_io_i80(i80_bus, &io_config, &io_handle));
+
+#if LCD_TRACE_ENABLE
+    /* Panel drivers talk to the tracer, it forwards everything to the i80 IO */
+    const lcd_trace_cfg_t trace_cfg = {
+        .pclk_hz = io_config.pclk_hz,
+        .bus_width = BOARD_DISP_PARALLEL_WIDTH,
+        .cmd_bits = io_config.lcd_cmd_bits,
+        .param_bits = io_config.lcd_param_bits,
+        .trans_overhead_ns = 1000,
+        .log_depth = 64,
+    };
+    if (lcd_trace_new_io(io_handle, &trace_cfg, &lcd_trace_io) == ESP_OK) {
+        io_handle = lcd_trace_io;
+    }
+#endif
+
+    const esp_lcd_panel_ra8875_config_t vendor_config = {
+        .wait_gpio_num = BOARD_DISP_PARALLEL_WAIT,
+        .lcd_width = BOARD_DISP_PARALLEL_HRES,
+        .lcd_height = BOARD_DISP_PARALLEL_VRES,
+        .mcu_bit_interface = BOARD_DISP_PARALLEL_WIDTH,
+    };
+
+    esp_lcd_panel_dev_config_t panel_config = {
+        .reset_gpio_num = BOARD_DISP_PARALLEL_RST,
+        .color_space = ESP_LCD_COLOR_SPACE_RGB,
+        .bits_per_pixel = 16,
+        .vendor_config = (void*)&vendor_config,
+    };
+    if (config->driver == LCD_DRIVER_RM68120) {
+        ESP_ERROR_CHECK(esp_lcd_new_panel_rm68120(io_handle, &panel_config, &lcd_panel_handle));
+    }else{
+        ESP_ERROR_CHECK(esp_lcd_new_panel_ra8875(io_handle, &panel_config, &lcd_panel_handle));
+    }
+
+	ESP_ERROR_CHECK(esp_lcd_panel_reset(lcd_panel_handle));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(lcd_panel_handle));
+	ESP_ERROR_CHECK(esp_lcd_panel_disp_off(lcd_panel_handle, false));
+
+    disp->handle = lcd_panel_handle;
+
+    ESP_LOGI(TAG, "Initialized Intel 8080 bus");
+
+	vTaskDelay(pdMS_TO_TICKS(10));
+
+    return disp;
+}
+
+void lcd_parallel8080_draw(lcd_disp_t * disp, int x1, int y1, int x2, int y2, void * color)
+{
+    const lcd_rect_t rect = { x1, y1, x2, y2 };
+
+    lcd_parallel8080_draw_batch(disp, &rect, &color, 1);
+}
+
+void lcd_parallel8080_draw_batch(lcd_disp_t * disp, const lcd_rect_t * rects, void * const * buffers, int n)
+{
+    assert(disp != NULL);
+    esp_lcd_panel_handle_t lcd_panel_handle = (esp_lcd_panel_handle_t)(disp->handle);
+
+    assert(lcd_panel_handle != NULL);
+    assert(n > 0);
+
+    // held while queueing: a transfer done before the next one is queued does not end the batch
+    _lcd_parallel8080_hold(1);
+
+    // panel drivers only send the window bytes that changed, color transfers stay queued on the i80 bus
+    if (disp->driver == LCD_DRIVER_RM68120) {
+        esp_lcd_rm68120_rect_t rm_rects[LCD_RM68120_BATCH];
+        for (int i = 0; i < n; i += LCD_RM68120_BATCH) {
+            int count = (n - i < LCD_RM68120_BATCH) ? (n - i) : LCD_RM68120_BATCH;
+            for (int j = 0; j < count; j++) {
+                const lcd_rect_t * r = &rects[i + j];
+                rm_rects[j] = (esp_lcd_rm68120_rect_t) { r->x1, r->y1, r->x2, r->y2, buffers[i + j] };
+            }
+            size_t queued = 0;
+            _lcd_parallel8080_hold(count);
+            if (esp_lcd_rm68120_draw_bitmaps(lcd_panel_handle, rm_rects, count, &queued) != ESP_OK) {
+                // the rectangles from the failing one on were not queued, don't leave the caller waiting for them
+                _lcd_parallel8080_release(disp, count - (int)queued);
+            }
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            const lcd_rect_t * r = &rects[i];
+            _lcd_parallel8080_hold(1);
+            if (esp_lcd_panel_draw_bitmap(lcd_panel_handle, r->x1, r->y1, r->x2, r->y2, buffers[i]) != ESP_OK) {
+                _lcd_parallel8080_release(disp, 1);
+            }
+        }
+    }
+
+    _lcd_parallel8080_release(disp, 1);
+}
+
+void lcd_parallel8080_fill(lcd_disp_t * disp, const lcd_rect_t * rect, uint16_t color)
+{
+    assert(disp != NULL && rect != NULL);
+    esp_lcd_panel_handle_t lcd_panel_handle = (esp_lcd_panel_handle_t)(disp->handle);
+
+    assert(lcd_panel_handle != NULL);
+
+    if (disp->driver == LCD_DRIVER_RA8875) {
+        // drawing engine, nothing is transferred: done as far as the bus is concerned
+        _lcd_parallel8080_hold(1);
+        if (esp_lcd_ra8875_fill_rect(lcd_panel_handle, rect->x1, rect->y1, rect->x2, rect->y2, _lcd_ra8875_engine_color(color)) != ESP_OK) {
+            ESP_LOGW(TAG, "RA8875 fill failed");
+        }
+        _lcd_parallel8080_release(disp, 1);
+        return;
+    }
+
+    const size_t fill_size = BOARD_DISP_PARALLEL_HRES * LCD_FILL_LINES * sizeof(uint16_t);
+    if (lcd_fill_buf == NULL) {
+        lcd_fill_buf = lcd_buf_alloc(fill_size);
+        lcd_fill_color = -1;
+    }
+    if (lcd_fill_buf == NULL) {
+        ESP_LOGE(TAG, "No memory for the fill buffer");
+        _lcd_parallel8080_hold(1);
+        _lcd_parallel8080_release(disp, 1);
+        return;
+    }
+    // the previous fill is done (the caller waited for it), the buffer can be changed
+    if (lcd_fill_color != color) {
+        for (int i = 0; i < BOARD_DISP_PARALLEL_HRES * LCD_FILL_LINES; i++) {
+            lcd_fill_buf[i] = color;
+        }
+        lcd_fill_color = color;
+    }
+
+    size_t len = (rect->x2 - rect->x1) * (rect->y2 - rect->y1) * sizeof(uint16_t);
+    int chunks = (len + fill_size - 1) / fill_size;
+    size_t queued = 0;
+    _lcd_parallel8080_hold(1 + chunks);
+    if (esp_lcd_rm68120_fill_rect(lcd_panel_handle, rect->x1, rect->y1, rect->x2, rect->y2, lcd_fill_buf, fill_size, &queued) != ESP_OK) {
+        _lcd_parallel8080_release(disp, chunks - (int)queued);
+    }
+    _lcd_parallel8080_release(disp, 1);
+}
+
+void lcd_parallel8080_trace_frame(lcd_disp_t * disp)
+{
+#if LCD_TRACE_ENABLE
+    static lcd_trace_stats_t sum;
+    static esp_lcd_ra8875_stats_t ra8875_sum;
+    static esp_lcd_rm68120_stats_t rm68120_sum;
+    static int frames = 0;
+    lcd_trace_stats_t frame;
+
+    if (lcd_trace_io == NULL) {
+        return;
+    }
+
+    lcd_trace_frame(lcd_trace_io, &frame, NULL);
+    sum.cmds += frame.cmds;
+    sum.colors += frame.colors;
+    sum.param_bytes += frame.param_bytes;
+    sum.color_bytes += frame.color_bytes;
+    sum.bus_ns += frame.bus_ns;
+
+    if (disp->driver == LCD_DRIVER_RA8875) {
+        esp_lcd_ra8875_stats_t ra8875;
+        esp_lcd_ra8875_get_stats((esp_lcd_panel_handle_t)(disp->handle), &ra8875, true);
+        ra8875_sum.reg_writes += ra8875.reg_writes;
+        ra8875_sum.reg_skipped += ra8875.reg_skipped;
+    } else if (disp->driver == LCD_DRIVER_RM68120) {
+        esp_lcd_rm68120_stats_t rm68120;
+        esp_lcd_rm68120_get_stats((esp_lcd_panel_handle_t)(disp->handle), &rm68120, true);
+        rm68120_sum.cmd_bytes += rm68120.cmd_bytes;
+        rm68120_sum.cmd_skipped += rm68120.cmd_skipped;
+    }
+
+    if (++frames == LCD_TRACE_REPORT_FRAMES) {
+        ESP_LOGI(TAG, "per frame: %u cmds (%u bytes), %u color transfers (%u bytes), bus %u us",
+                 (unsigned)(sum.cmds / frames), (unsigned)(sum.param_bytes / frames),
+                 (unsigned)(sum.colors / frames), (unsigned)(sum.color_bytes / frames),
+                 (unsigned)(sum.bus_ns / frames / 1000));
+        if (disp->driver == LCD_DRIVER_RA8875) {
+            ESP_LOGI(TAG, "per frame: %u RA8875 register writes, %u skipped by the shadow",
+                     (unsigned)(ra8875_sum.reg_writes / frames), (unsigned)(ra8875_sum.reg_skipped / frames));
+        } else if (disp->driver == LCD_DRIVER_RM68120) {
+            ESP_LOGI(TAG, "per frame: %u RM68120 command bytes, %u address commands skipped by the cache",
+                     (unsigned)(rm68120_sum.cmd_bytes / frames), (unsigned)(rm68120_sum.cmd_skipped / frames));
+        }
+        memset(&sum, 0, sizeof(sum));
+        memset(&ra8875_sum, 0, sizeof(ra8875_sum));
+        memset(&rm68120_sum, 0, sizeof(rm68120_sum));
+        frames = 0;
+    }
+#endif
+}
+
+void lcd_parallel8080_set_brightness(lcd_disp_t * disp, uint8_t percent)
+{
+}
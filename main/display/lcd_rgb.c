@@ -0,0 +1,154 @@
+/* RGB LCD display
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include "esp_system.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_idf_version.h"
+#include "soc/soc_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "board.h"
+
+#include "lcd.h"
+#include "lcd_fb.h"
+
+#if SOC_LCD_RGB_SUPPORTED
+
+#include "esp_lcd_panel_rgb.h"
+#include "esp_lcd_panel_ops.h"
+
+/* Lines per bounce buffer, frame height must be a multiple of it (two of them are allocated in internal RAM) */
+#define EXAMPLE_LCD_RGB_BOUNCE_LINES    10
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "LCDRGB";
+
+static lcd_disp_t lcd_display = {0};
+static flush_ready_cb_t lcd_flush_ready_cb = NULL;
+
+/* Frame buffer in PSRAM, refreshed to the panel through the bounce buffers (NULL when not accessible) */
+static uint16_t * lcd_rgb_fb = NULL;
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+lcd_disp_t * lcd_rgb_init(lcd_cfg_t * config)
+{
+    lcd_disp_t * disp = &lcd_display;
+    esp_lcd_panel_handle_t lcd_panel_handle = NULL;
+
+    assert(config != NULL);
+
+    disp->driver = config->driver;
+    disp->conn_type = LCD_CONN_TYPE_PARALLEL_RGB;
+    disp->user_data = NULL;
+
+    /* Save flush ready callback */
+    lcd_flush_ready_cb = config->flush_ready_cb;
+
+    esp_lcd_rgb_panel_config_t panel_config = {
+        .timings = {
+            .pclk_hz = BOARD_DISP_RGB_PIX_CLK_HZ,
+            .h_res = BOARD_DISP_RGB_HRES,
+            .v_res = BOARD_DISP_RGB_VRES,
+            .hsync_pulse_width = BOARD_DISP_RGB_HSYNC_PULSE,
+            .hsync_back_porch = BOARD_DISP_RGB_HSYNC_BACK,
+            .hsync_front_porch = BOARD_DISP_RGB_HSYNC_FRONT,
+            .vsync_pulse_width = BOARD_DISP_RGB_VSYNC_PULSE,
+            .vsync_back_porch = BOARD_DISP_RGB_VSYNC_BACK,
+            .vsync_front_porch = BOARD_DISP_RGB_VSYNC_FRONT,
+            .flags.pclk_active_neg = BOARD_DISP_RGB_PCLK_ACTIVE_NEG,
+        },
+        .data_width = BOARD_DISP_RGB_WIDTH,
+        .hsync_gpio_num = BOARD_DISP_RGB_HSYNC,
+        .vsync_gpio_num = BOARD_DISP_RGB_VSYNC,
+        .de_gpio_num = BOARD_DISP_RGB_DE,
+        .pclk_gpio_num = BOARD_DISP_RGB_PCLK,
+        .disp_gpio_num = BOARD_DISP_RGB_EN,
+        .data_gpio_nums = {
+            BOARD_DISP_RGB_DATA0,
+            BOARD_DISP_RGB_DATA1,
+            BOARD_DISP_RGB_DATA2,
+            BOARD_DISP_RGB_DATA3,
+            BOARD_DISP_RGB_DATA4,
+            BOARD_DISP_RGB_DATA5,
+            BOARD_DISP_RGB_DATA6,
+            BOARD_DISP_RGB_DATA7,
+            BOARD_DISP_RGB_DATA8,
+            BOARD_DISP_RGB_DATA9,
+            BOARD_DISP_RGB_DATA10,
+            BOARD_DISP_RGB_DATA11,
+            BOARD_DISP_RGB_DATA12,
+            BOARD_DISP_RGB_DATA13,
+            BOARD_DISP_RGB_DATA14,
+            BOARD_DISP_RGB_DATA15,
+        },
+        .flags.fb_in_psram = 1,
+    };
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    panel_config.clk_src = LCD_CLK_SRC_PLL160M;
+    /* The GDMA feeds the panel from internal RAM bounce buffers, the CPU refills them from PSRAM.
+       Screen refresh keeps running while the PSRAM bus is busy with the game. */
+    panel_config.bounce_buffer_size_px = BOARD_DISP_RGB_HRES * EXAMPLE_LCD_RGB_BOUNCE_LINES;
+    panel_config.psram_trans_align = 64;
+    panel_config.sram_trans_align = 4;
+#else
+    ESP_LOGW(TAG, "Bounce buffers need IDF v5.0, refreshing directly from PSRAM");
+#endif
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+    panel_config.num_fbs = 1;
+#endif
+
+    ESP_ERROR_CHECK(esp_lcd_new_rgb_panel(&panel_config, &lcd_panel_handle));
+    ESP_ERROR_CHECK(esp_lcd_panel_reset(lcd_panel_handle));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(lcd_panel_handle));
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+    /* v5.1 on: tiles go straight into the frame buffer, before that through the driver */
+    ESP_ERROR_CHECK(esp_lcd_rgb_panel_get_frame_buffer(lcd_panel_handle, 1, (void **)&lcd_rgb_fb));
+#endif
+
+    disp->handle = lcd_panel_handle;
+
+    ESP_LOGI(TAG, "Initialized RGB panel %dx%d", BOARD_DISP_RGB_HRES, BOARD_DISP_RGB_VRES);
+
+    return disp;
+}
+
+void lcd_rgb_draw(lcd_disp_t * disp, int x1, int y1, int x2, int y2, void * color)
+{
+    assert(disp != NULL);
+    esp_lcd_panel_handle_t lcd_panel_handle = (esp_lcd_panel_handle_t)(disp->handle);
+
+    assert(lcd_panel_handle != NULL);
+
+    if (lcd_rgb_fb != NULL) {
+        /* Only a copy to the frame buffer, the refresh picks it up on the next frame */
+        lcd_fb_copy_rect(lcd_rgb_fb, BOARD_DISP_RGB_HRES, BOARD_DISP_RGB_VRES, x1, y1, x2, y2, (const uint16_t *)color);
+    } else {
+        /* Driver copies into its frame buffer and writes the cache back */
+        esp_lcd_panel_draw_bitmap(lcd_panel_handle, x1, y1, x2, y2, color);
+    }
+
+    /* Buffer can be reused right away */
+    if (lcd_flush_ready_cb) {
+        lcd_flush_ready_cb(disp);
+    }
+}
+
+#endif //SOC_LCD_RGB_SUPPORTED
@@ -0,0 +1,231 @@
+/* SPI LCD display
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include "esp_system.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_vendor.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_commands.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "board.h"
+
+#include "lcd.h"
+
+#define EXAMPLE_LCD_SPI_HOST        SPI2_HOST
+#define EXAMPLE_LCD_SPI_PCLK_HZ     (40 * 1000 * 1000)
+#define EXAMPLE_LCD_SPI_TRANS_LINES 80
+
+#define EXAMPLE_LCD_BL_ON   1
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "LCDSPI";
+
+static lcd_disp_t lcd_display = {0};
+static flush_ready_cb_t lcd_flush_ready_cb = NULL;
+static esp_lcd_panel_io_handle_t lcd_io_handle = NULL;
+
+/* Last window sent to the controller (x1, x2, y1, y2), -1 = unknown */
+static int lcd_spi_window[4] = {-1, -1, -1, -1};
+
+/* Color transfers of the current draw/batch not finished yet, plus one while it is being queued */
+static volatile int lcd_pending = 0;
+static portMUX_TYPE lcd_pending_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static bool _lcd_spi_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    portENTER_CRITICAL_ISR(&lcd_pending_lock);
+    bool last = (lcd_pending > 0) && (--lcd_pending == 0);
+    portEXIT_CRITICAL_ISR(&lcd_pending_lock);
+
+    if (last && lcd_flush_ready_cb)
+        lcd_flush_ready_cb(user_ctx);
+
+    return false;
+}
+
+/* One pending transfer less from the task: a rectangle that was not queued, or the end of queueing */
+static void _lcd_spi_release(lcd_disp_t * disp)
+{
+    portENTER_CRITICAL(&lcd_pending_lock);
+    bool last = (lcd_pending > 0) && (--lcd_pending == 0);
+    portEXIT_CRITICAL(&lcd_pending_lock);
+
+    if (last && lcd_flush_ready_cb)
+        lcd_flush_ready_cb(disp);
+}
+
+static void _lcd_spi_set_window(int x1, int y1, int x2, int y2)
+{
+    /* Tiles of one row share the rows, tiles of one column share the columns: send only what changed */
+    if (x1 != lcd_spi_window[0] || x2 != lcd_spi_window[1]) {
+        esp_lcd_panel_io_tx_param(lcd_io_handle, LCD_CMD_CASET, (uint8_t[]) {
+            (x1 >> 8) & 0xFF, x1 & 0xFF, ((x2 - 1) >> 8) & 0xFF, (x2 - 1) & 0xFF,
+        }, 4);
+        lcd_spi_window[0] = x1;
+        lcd_spi_window[1] = x2;
+    }
+    if (y1 != lcd_spi_window[2] || y2 != lcd_spi_window[3]) {
+        esp_lcd_panel_io_tx_param(lcd_io_handle, LCD_CMD_RASET, (uint8_t[]) {
+            (y1 >> 8) & 0xFF, y1 & 0xFF, ((y2 - 1) >> 8) & 0xFF, (y2 - 1) & 0xFF,
+        }, 4);
+        lcd_spi_window[2] = y1;
+        lcd_spi_window[3] = y2;
+    }
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+lcd_disp_t * lcd_spi_init(lcd_cfg_t * config)
+{
+    lcd_disp_t * disp = &lcd_display;
+    esp_lcd_panel_handle_t lcd_panel_handle = NULL;
+
+    assert(config != NULL);
+
+    disp->driver = config->driver;
+    disp->conn_type = LCD_CONN_TYPE_SPI;
+    disp->user_data = NULL;
+
+    /* Save flush ready callback */
+    lcd_flush_ready_cb = config->flush_ready_cb;
+
+    if (config->driver != LCD_DRIVER_ST7789) {
+        ESP_LOGE(TAG, "Not supported LCD driver!");
+        return NULL;
+    }
+
+    /* Backlight off until the panel is initialized */
+    if (BOARD_DISP_SPI_BL != GPIO_NUM_NC) {
+        gpio_config_t bl_conf = {
+            .mode = GPIO_MODE_OUTPUT,
+            .pin_bit_mask = BIT64(BOARD_DISP_SPI_BL),
+        };
+        ESP_ERROR_CHECK(gpio_config(&bl_conf));
+        gpio_set_level(BOARD_DISP_SPI_BL, !EXAMPLE_LCD_BL_ON);
+    }
+
+    /* Init SPI bus, DMA capable */
+    spi_bus_config_t bus_config = {
+        .sclk_io_num = BOARD_DISP_SPI_SCLK,
+        .mosi_io_num = BOARD_DISP_SPI_MOSI,
+        .miso_io_num = GPIO_NUM_NC,
+        .quadwp_io_num = GPIO_NUM_NC,
+        .quadhd_io_num = GPIO_NUM_NC,
+        .max_transfer_sz = BOARD_DISP_SPI_HRES * EXAMPLE_LCD_SPI_TRANS_LINES * sizeof(uint16_t),
+    };
+    ESP_ERROR_CHECK(spi_bus_initialize(EXAMPLE_LCD_SPI_HOST, &bus_config, SPI_DMA_CH_AUTO));
+
+    /* Color transactions are queued, the game continues while the last one's DMA is running */
+    esp_lcd_panel_io_spi_config_t io_config = {
+        .cs_gpio_num = BOARD_DISP_SPI_CS,
+        .dc_gpio_num = BOARD_DISP_SPI_DC,
+        .spi_mode = 0,
+        .pclk_hz = EXAMPLE_LCD_SPI_PCLK_HZ,
+        .trans_queue_depth = 10,
+        .on_color_trans_done = _lcd_spi_flush_ready,
+        .user_ctx = disp,
+        .lcd_cmd_bits = 8,
+        .lcd_param_bits = 8,
+    };
+    ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)EXAMPLE_LCD_SPI_HOST, &io_config, &lcd_io_handle));
+
+    esp_lcd_panel_dev_config_t panel_config = {
+        .reset_gpio_num = BOARD_DISP_SPI_RST,
+        .color_space = ESP_LCD_COLOR_SPACE_RGB,
+        .bits_per_pixel = 16,
+    };
+    ESP_ERROR_CHECK(esp_lcd_new_panel_st7789(lcd_io_handle, &panel_config, &lcd_panel_handle));
+
+    ESP_ERROR_CHECK(esp_lcd_panel_reset(lcd_panel_handle));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(lcd_panel_handle));
+    ESP_ERROR_CHECK(esp_lcd_panel_invert_color(lcd_panel_handle, true));
+#if (BOARD_DISP_SPI_HRES < BOARD_DISP_SPI_VRES)
+    /* The game screen is landscape */
+    ESP_ERROR_CHECK(esp_lcd_panel_swap_xy(lcd_panel_handle, true));
+#endif
+    ESP_ERROR_CHECK(esp_lcd_panel_mirror(lcd_panel_handle, true, true));
+    ESP_ERROR_CHECK(esp_lcd_panel_disp_off(lcd_panel_handle, false));
+
+    if (BOARD_DISP_SPI_BL != GPIO_NUM_NC) {
+        gpio_set_level(BOARD_DISP_SPI_BL, EXAMPLE_LCD_BL_ON);
+    }
+
+    disp->handle = lcd_panel_handle;
+
+    ESP_LOGI(TAG, "Initialized SPI bus");
+
+    return disp;
+}
+
+void lcd_spi_draw(lcd_disp_t * disp, int x1, int y1, int x2, int y2, void * color)
+{
+    const lcd_rect_t rect = { x1, y1, x2, y2 };
+
+    lcd_spi_draw_batch(disp, &rect, &color, 1);
+}
+
+void lcd_spi_draw_batch(lcd_disp_t * disp, const lcd_rect_t * rects, void * const * buffers, int n)
+{
+    assert(disp != NULL);
+    assert(lcd_io_handle != NULL);
+    assert(n > 0);
+
+    /* Held while queueing: a transfer done before the next one is queued does not end the batch */
+    portENTER_CRITICAL(&lcd_pending_lock);
+    lcd_pending = 1;
+    portEXIT_CRITICAL(&lcd_pending_lock);
+
+    /* The SPI IO waits for the queued transfers before each command (the window, and the RAMWR in
+       front of the pixels), so the rectangles go out one after another: on the host model a batch
+       of 16 tiles spends 1.6 ms of its 1.7 ms bus time here, only the last tile overlaps the caller.
+       What the batch saves is the window commands the panel would send for every rectangle. */
+    for (int i = 0; i < n; i++) {
+        const lcd_rect_t * r = &rects[i];
+        assert((r->x1 < r->x2) && (r->y1 < r->y2));
+
+        /* Panel draw_bitmap would send both window commands every time, talk to the IO directly */
+        _lcd_spi_set_window(r->x1, r->y1, r->x2, r->y2);
+
+        portENTER_CRITICAL(&lcd_pending_lock);
+        lcd_pending++;
+        portEXIT_CRITICAL(&lcd_pending_lock);
+
+        size_t len = (r->x2 - r->x1) * (r->y2 - r->y1) * sizeof(uint16_t);
+        if (esp_lcd_panel_io_tx_color(lcd_io_handle, LCD_CMD_RAMWR, buffers[i], len) != ESP_OK) {
+            /* nothing was queued, don't leave the caller waiting for the transfer */
+            _lcd_spi_release(disp);
+        }
+    }
+
+    _lcd_spi_release(disp);
+}
+
+void lcd_spi_set_brightness(lcd_disp_t * disp, uint8_t percent)
+{
+    if (BOARD_DISP_SPI_BL != GPIO_NUM_NC) {
+        gpio_set_level(BOARD_DISP_SPI_BL, (percent > 0) ? EXAMPLE_LCD_BL_ON : !EXAMPLE_LCD_BL_ON);
+    }
+}
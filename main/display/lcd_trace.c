@@ -0,0 +1,225 @@
+/* LCD panel IO tracing
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/cdefs.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "freertos/FreeRTOS.h"
+
+#include "lcd_trace.h"
+
+/*******************************************************************************
+* Types definitions
+*******************************************************************************/
+typedef struct
+{
+    esp_lcd_panel_io_t base;
+    esp_lcd_panel_io_handle_t inner;
+    lcd_trace_cfg_t cfg;
+    lcd_trace_stats_t frame;
+    lcd_trace_stats_t total;
+    lcd_trace_entry_t * log;
+    size_t log_next;
+    size_t log_count;
+    portMUX_TYPE lock;
+} lcd_trace_io_t;
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "LCDTRACE";
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+/* Bus cycles of one transaction: command word, then each parameter unit or color word */
+static uint32_t _lcd_trace_bus_ns(const lcd_trace_io_t * trace, size_t bytes, int unit_bits)
+{
+    const lcd_trace_cfg_t * cfg = &trace->cfg;
+    int width = (cfg->bus_width > 0) ? cfg->bus_width : 8;
+    uint64_t cycles = (cfg->cmd_bits + width - 1) / width;
+
+    if (unit_bits <= 0 || unit_bits > width) {
+        unit_bits = width;
+    }
+    /* parameters narrower than the bus still take a full cycle each */
+    cycles += ((uint64_t)bytes * 8 + unit_bits - 1) / unit_bits;
+
+    uint64_t ns = cfg->pclk_hz ? (cycles * 1000000000ULL / cfg->pclk_hz) : 0;
+    return (uint32_t)(ns + cfg->trans_overhead_ns);
+}
+
+static void _lcd_trace_add(lcd_trace_io_t * trace, lcd_trace_type_t type, int cmd, const void * data, size_t size)
+{
+    int unit_bits = (type == LCD_TRACE_COLOR) ? trace->cfg.bus_width : trace->cfg.param_bits;
+    uint32_t ns = _lcd_trace_bus_ns(trace, size, unit_bits);
+
+    portENTER_CRITICAL(&trace->lock);
+    lcd_trace_stats_t * s[2] = { &trace->frame, &trace->total };
+    for (int i = 0; i < 2; i++) {
+        if (type == LCD_TRACE_COLOR) {
+            s[i]->colors++;
+            s[i]->color_bytes += size;
+        } else {
+            s[i]->cmds++;
+            s[i]->param_bytes += size;
+        }
+        s[i]->bus_ns += ns;
+    }
+
+    if (trace->log != NULL) {
+        lcd_trace_entry_t * e = &trace->log[trace->log_next];
+        e->type = type;
+        e->cmd = cmd;
+        e->size = size;
+        e->bus_ns = ns;
+        memset(e->data, 0, sizeof(e->data));
+        if (type == LCD_TRACE_CMD && data != NULL) {
+            memcpy(e->data, data, (size < sizeof(e->data)) ? size : sizeof(e->data));
+        }
+        trace->log_next = (trace->log_next + 1) % trace->cfg.log_depth;
+        if (trace->log_count < trace->cfg.log_depth) {
+            trace->log_count++;
+        }
+    }
+    portEXIT_CRITICAL(&trace->lock);
+
+    if (trace->cfg.hook) {
+        trace->cfg.hook(type, cmd, data, size, trace->cfg.hook_ctx);
+    }
+}
+
+static esp_err_t _lcd_trace_rx_param(esp_lcd_panel_io_t * io, int lcd_cmd, void * param, size_t param_size)
+{
+    lcd_trace_io_t * trace = __containerof(io, lcd_trace_io_t, base);
+
+    _lcd_trace_add(trace, LCD_TRACE_RX, lcd_cmd, NULL, param_size);
+    if (trace->inner == NULL) {
+        memset(param, 0, param_size);
+        return ESP_OK;
+    }
+    return esp_lcd_panel_io_rx_param(trace->inner, lcd_cmd, param, param_size);
+}
+
+static esp_err_t _lcd_trace_tx_param(esp_lcd_panel_io_t * io, int lcd_cmd, const void * param, size_t param_size)
+{
+    lcd_trace_io_t * trace = __containerof(io, lcd_trace_io_t, base);
+
+    _lcd_trace_add(trace, LCD_TRACE_CMD, lcd_cmd, param, param_size);
+    if (trace->inner == NULL) {
+        return ESP_OK;
+    }
+    return esp_lcd_panel_io_tx_param(trace->inner, lcd_cmd, param, param_size);
+}
+
+static esp_err_t _lcd_trace_tx_color(esp_lcd_panel_io_t * io, int lcd_cmd, const void * color, size_t color_size)
+{
+    lcd_trace_io_t * trace = __containerof(io, lcd_trace_io_t, base);
+
+    _lcd_trace_add(trace, LCD_TRACE_COLOR, lcd_cmd, color, color_size);
+    if (trace->inner == NULL) {
+        /* no bus: the transfer is done already */
+        if (trace->cfg.on_color_trans_done) {
+            trace->cfg.on_color_trans_done(io, NULL, trace->cfg.user_ctx);
+        }
+        return ESP_OK;
+    }
+    return esp_lcd_panel_io_tx_color(trace->inner, lcd_cmd, color, color_size);
+}
+
+static esp_err_t _lcd_trace_del(esp_lcd_panel_io_t * io)
+{
+    lcd_trace_io_t * trace = __containerof(io, lcd_trace_io_t, base);
+    esp_lcd_panel_io_handle_t inner = trace->inner;
+
+    free(trace->log);
+    free(trace);
+    return inner ? esp_lcd_panel_io_del(inner) : ESP_OK;
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+esp_err_t lcd_trace_new_io(esp_lcd_panel_io_handle_t inner, const lcd_trace_cfg_t * cfg, esp_lcd_panel_io_handle_t * ret_io)
+{
+    assert(cfg != NULL && ret_io != NULL);
+
+    lcd_trace_io_t * trace = calloc(1, sizeof(lcd_trace_io_t));
+    if (trace == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (cfg->log_depth > 0) {
+        trace->log = calloc(cfg->log_depth, sizeof(lcd_trace_entry_t));
+        if (trace->log == NULL) {
+            free(trace);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    trace->inner = inner;
+    trace->cfg = *cfg;
+    portMUX_INITIALIZE(&trace->lock);
+    trace->base.rx_param = _lcd_trace_rx_param;
+    trace->base.tx_param = _lcd_trace_tx_param;
+    trace->base.tx_color = _lcd_trace_tx_color;
+    trace->base.del = _lcd_trace_del;
+
+    ESP_LOGI(TAG, "Tracing panel IO, %u Hz x %d bit%s", (unsigned)cfg->pclk_hz, cfg->bus_width, inner ? "" : " (no bus)");
+
+    *ret_io = &trace->base;
+    return ESP_OK;
+}
+
+void lcd_trace_frame(esp_lcd_panel_io_handle_t io, lcd_trace_stats_t * frame, lcd_trace_stats_t * total)
+{
+    lcd_trace_io_t * trace = __containerof(io, lcd_trace_io_t, base);
+
+    portENTER_CRITICAL(&trace->lock);
+    if (frame) {
+        *frame = trace->frame;
+    }
+    if (total) {
+        *total = trace->total;
+    }
+    memset(&trace->frame, 0, sizeof(trace->frame));
+    portEXIT_CRITICAL(&trace->lock);
+}
+
+void lcd_trace_dump(esp_lcd_panel_io_handle_t io)
+{
+    static const char *types[] = { "cmd", "color", "rx" };
+    lcd_trace_io_t * trace = __containerof(io, lcd_trace_io_t, base);
+
+    if (trace->log == NULL) {
+        return;
+    }
+
+    /* copied first, logging is too slow for the lock */
+    size_t count = trace->log_count;
+    size_t depth = trace->cfg.log_depth;
+    size_t first = (trace->log_next + depth - count) % depth;
+    for (size_t i = 0; i < count; i++) {
+        lcd_trace_entry_t e;
+        portENTER_CRITICAL(&trace->lock);
+        e = trace->log[(first + i) % depth];
+        portEXIT_CRITICAL(&trace->lock);
+        ESP_LOGI(TAG, "%-5s 0x%04x %6u bytes [%02x %02x %02x] %u ns", types[e.type], e.cmd, (unsigned)e.size,
+                 e.data[0], e.data[1], e.data[2], (unsigned)e.bus_ns);
+    }
+}
@@ -0,0 +1,106 @@
+/* LCD panel IO tracing
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+
+/*
+ * Panel IO that sits between a panel driver (esp_lcd_ra8875, esp_lcd_rm68120, ...) and the real bus.
+ * Every command, parameter and color transfer is counted, the bus time is modeled from the pixel
+ * clock and bus width. Without a real bus (inner IO NULL) nothing is sent and transfers complete
+ * at once, so the panel drivers can run on the host.
+ */
+
+/* Wrap the parallel display IO with the tracer */
+#ifndef LCD_TRACE_ENABLE
+#define LCD_TRACE_ENABLE 0
+#endif
+
+typedef enum
+{
+    LCD_TRACE_CMD,      /* command, with or without parameters */
+    LCD_TRACE_COLOR,    /* command followed by color data */
+    LCD_TRACE_RX,       /* read */
+} lcd_trace_type_t;
+
+/* One logged transaction */
+typedef struct lcd_trace_entry_s
+{
+    uint8_t type;           /* lcd_trace_type_t */
+    uint8_t data[3];        /* first parameter bytes */
+    int cmd;
+    uint32_t size;          /* parameter or color bytes */
+    uint32_t bus_ns;        /* modeled bus time */
+} lcd_trace_entry_t;
+
+/* Called for each transaction, e.g. to keep a virtual panel RAM */
+typedef void (*lcd_trace_hook_t)(lcd_trace_type_t type, int cmd, const void * data, size_t size, void * user_ctx);
+
+typedef struct lcd_trace_cfg_s
+{
+    uint32_t pclk_hz;           /* bus clock */
+    int bus_width;              /* data lines (8 or 16), 1 for SPI */
+    int cmd_bits;               /* as in the panel IO config */
+    int param_bits;
+    uint32_t trans_overhead_ns; /* per transaction (CS, DC, DMA setup) */
+    size_t log_depth;           /* last transactions kept for lcd_trace_dump(), 0 = none */
+    lcd_trace_hook_t hook;      /* optional */
+    void * hook_ctx;
+    /* Used when there is no inner IO */
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void * user_ctx;
+} lcd_trace_cfg_t;
+
+typedef struct lcd_trace_stats_s
+{
+    uint32_t cmds;          /* command transactions */
+    uint32_t colors;        /* color transactions */
+    uint32_t param_bytes;
+    uint32_t color_bytes;
+    uint64_t bus_ns;        /* modeled bus time */
+} lcd_trace_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create a tracing panel IO
+ *
+ * @param inner     -real panel IO, NULL to only trace and model (host)
+ * @param cfg       -bus model and log configuration
+ * @param ret_io    -returned panel IO, give it to the panel driver instead of inner
+ * @return
+ *          - ESP_OK on success, ESP_ERR_NO_MEM when out of memory
+ */
+esp_err_t lcd_trace_new_io(esp_lcd_panel_io_handle_t inner, const lcd_trace_cfg_t * cfg, esp_lcd_panel_io_handle_t * ret_io);
+
+/**
+ * @brief Get counters since the previous call (one frame) and start a new frame
+ *
+ * @param io    -panel IO from lcd_trace_new_io()
+ * @param frame -returned counters of the frame
+ * @param total -returned counters since creation, can be NULL
+ */
+void lcd_trace_frame(esp_lcd_panel_io_handle_t io, lcd_trace_stats_t * frame, lcd_trace_stats_t * total);
+
+/**
+ * @brief Log the last transactions, oldest first
+ *
+ * @param io    -panel IO from lcd_trace_new_io()
+ */
+void lcd_trace_dump(esp_lcd_panel_io_handle_t io);
+
+#ifdef __cplusplus
+}
+#endif
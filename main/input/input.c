@@ -0,0 +1,226 @@
+/* Game input events
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "esp_system.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "bsp.h"
+#include "input.h"
+
+/* Above the Arduino loop task, the touch task is short and mostly sleeping */
+#define INPUT_TASK_PRIORITY     2
+#define INPUT_TASK_STACK        3072
+/* Longest sleep without INT edge, also the sampling period without INT line */
+#define INPUT_PERIOD_MS         10
+/* A and B act once per press */
+#define INPUT_DEBOUNCE_US       250000
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "INPUT";
+
+static input_event_t input_ring[INPUT_RING_SIZE];
+static uint32_t input_head = 0;     /* written by the producer only */
+static uint32_t input_tail = 0;     /* written by the consumer only */
+static uint32_t input_drops = 0;
+
+static TaskHandle_t input_task_handle = NULL;
+static input_map_cb_t input_map = NULL;
+
+/* Latency samples come from the flush done callback (ISR) */
+static portMUX_TYPE input_lat_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t input_lat_hist[INPUT_LATENCY_BUCKETS];
+static uint32_t input_lat_count = 0;
+static uint32_t input_lat_max = 0;
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static void input_task(void *arg)
+{
+    uint32_t debounce_end = 0;
+
+    while (1) {
+        if (!touchPadWait(INPUT_PERIOD_MS)) {
+            continue;
+        }
+
+        uint8_t points = 0;
+        uint16_t x = 0, y = 0;
+        if (touchPadRead(&points, &x, &y) != ESP_OK || points == 0) {
+            continue;
+        }
+
+        int8_t button = input_map(x, y);
+        if (button < 0 || button >= INPUT_BUTTON_MAX) {
+            continue;
+        }
+
+        input_event_t ev = {
+            .t_us = touchPadSampleTime(),
+            .button = (uint8_t)button,
+        };
+        if (button == INPUT_BUTTON_A || button == INPUT_BUTTON_B) {
+            if ((int32_t)(ev.t_us - debounce_end) < 0) {
+                continue;
+            }
+            debounce_end = ev.t_us + INPUT_DEBOUNCE_US;
+        }
+        input_push(&ev);
+    }
+}
+
+#if INPUT_SYNTHETIC_MS > 0
+static void input_synthetic_task(void *arg)
+{
+    static const uint8_t dirs[] = { INPUT_BUTTON_UP, INPUT_BUTTON_LEFT, INPUT_BUTTON_DOWN, INPUT_BUTTON_RIGHT };
+    input_event_t ev = { .t_us = (uint32_t)esp_timer_get_time(), .button = INPUT_BUTTON_A };
+    uint32_t n = 0;
+
+    /* leave the demo, then turn around the maze */
+    vTaskDelay(pdMS_TO_TICKS(1000));
+    input_push(&ev);
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(INPUT_SYNTHETIC_MS));
+        ev.t_us = (uint32_t)esp_timer_get_time();
+        ev.button = dirs[n++ % 4];
+        input_push(&ev);
+    }
+}
+#endif
+
+/* Upper bound of the bucket holding the given percentile, in microseconds */
+static uint32_t input_latency_percentile(const uint32_t * hist, uint32_t count, uint32_t percent)
+{
+    uint32_t rank = (count * percent + 99) / 100;
+    uint32_t sum = 0;
+
+    for (int i = 0; i < INPUT_LATENCY_BUCKETS; i++) {
+        sum += hist[i];
+        if (sum >= rank) {
+            return (i + 1) * INPUT_LATENCY_BUCKET_US;
+        }
+    }
+    return INPUT_LATENCY_BUCKETS * INPUT_LATENCY_BUCKET_US;
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+bool input_start(input_map_cb_t map)
+{
+    if (input_task_handle != NULL) {
+        return true;
+    }
+
+    input_map = map;
+#if INPUT_SYNTHETIC_MS > 0
+    ESP_LOGW(TAG, "Synthetic input every %d ms, touch is not read", INPUT_SYNTHETIC_MS);
+    if (xTaskCreate(input_synthetic_task, "input", INPUT_TASK_STACK, NULL, INPUT_TASK_PRIORITY, &input_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Input task creation failed");
+        return false;
+    }
+    return true;
+#endif
+    if (xTaskCreate(input_task, "input", INPUT_TASK_STACK, NULL, INPUT_TASK_PRIORITY, &input_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Input task creation failed");
+        return false;
+    }
+    return true;
+}
+
+bool input_push(const input_event_t * ev)
+{
+    uint32_t head = input_head;
+
+    if (head - __atomic_load_n(&input_tail, __ATOMIC_ACQUIRE) >= INPUT_RING_SIZE) {
+        input_drops++;
+        return false;
+    }
+    input_ring[head % INPUT_RING_SIZE] = *ev;
+    /* the event is written before it is published */
+    __atomic_store_n(&input_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool input_pop(input_event_t * ev)
+{
+    uint32_t tail = input_tail;
+
+    if (tail == __atomic_load_n(&input_head, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *ev = input_ring[tail % INPUT_RING_SIZE];
+    /* the slot is read before it is given back */
+    __atomic_store_n(&input_tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint32_t input_event_age_us(const input_event_t * ev)
+{
+    return (uint32_t)esp_timer_get_time() - ev->t_us;
+}
+
+uint32_t input_dropped(void)
+{
+    return input_drops;
+}
+
+void input_latency_add(uint32_t us)
+{
+    uint32_t bucket = us / INPUT_LATENCY_BUCKET_US;
+
+    if (bucket >= INPUT_LATENCY_BUCKETS) {
+        bucket = INPUT_LATENCY_BUCKETS - 1;
+    }
+    portENTER_CRITICAL_SAFE(&input_lat_lock);
+    input_lat_hist[bucket]++;
+    input_lat_count++;
+    if (us > input_lat_max) {
+        input_lat_max = us;
+    }
+    portEXIT_CRITICAL_SAFE(&input_lat_lock);
+}
+
+uint32_t input_latency_count(void)
+{
+    return input_lat_count;
+}
+
+void input_latency_report(void)
+{
+    uint32_t hist[INPUT_LATENCY_BUCKETS];
+    uint32_t count, max;
+
+    portENTER_CRITICAL(&input_lat_lock);
+    memcpy(hist, input_lat_hist, sizeof(hist));
+    count = input_lat_count;
+    max = input_lat_max;
+    portEXIT_CRITICAL(&input_lat_lock);
+
+    if (count == 0) {
+        return;
+    }
+    ESP_LOGI(TAG, "Touch to photon: %u turns, p50 <%u ms, p95 <%u ms, max %u.%03u ms", (unsigned)count,
+             (unsigned)(input_latency_percentile(hist, count, 50) / 1000),
+             (unsigned)(input_latency_percentile(hist, count, 95) / 1000),
+             (unsigned)(max / 1000), (unsigned)(max % 1000));
+}
@@ -0,0 +1,118 @@
+/* Game input events
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * A touch task samples the controller and pushes button events into a single producer /
+ * single consumer ring, the game drains it at the start of each tick. No locks: the producer
+ * only writes the head, the consumer only writes the tail.
+ */
+
+/* Events kept in the ring (power of 2) */
+#define INPUT_RING_SIZE     32
+
+/* Touch to photon latency histogram */
+#define INPUT_LATENCY_BUCKET_US     1000
+#define INPUT_LATENCY_BUCKETS       128     /* the last one also takes anything longer */
+
+/* Synthetic direction presses every INPUT_SYNTHETIC_MS instead of touch, 0 = touch.
+   Measures the latency without a player, or without a touch controller at all. */
+#ifndef INPUT_SYNTHETIC_MS
+#define INPUT_SYNTHETIC_MS  0
+#endif
+
+/* Same numbering as the on-screen buttons */
+typedef enum
+{
+    INPUT_BUTTON_UP,
+    INPUT_BUTTON_LEFT,
+    INPUT_BUTTON_RIGHT,
+    INPUT_BUTTON_DOWN,
+    INPUT_BUTTON_A,         /* START | PAUSE */
+    INPUT_BUTTON_B,         /* reset */
+    INPUT_BUTTON_MAX,
+} input_button_t;
+
+typedef struct input_event_s
+{
+    uint32_t t_us;          /* esp_timer time of the sample */
+    uint8_t button;         /* input_button_t */
+} input_event_t;
+
+/* Touch point (screen coordinates) to button index, -1 when none */
+typedef int8_t (*input_map_cb_t)(uint16_t x, uint16_t y);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the touch task
+ *
+ * @param map   -touch point to button
+ * @return
+ *          - true when the task runs
+ */
+bool input_start(input_map_cb_t map);
+
+/**
+ * @brief Add an event (producer side)
+ *
+ * @param ev    -event
+ * @return
+ *          - false when the ring is full, the event is dropped
+ */
+bool input_push(const input_event_t * ev);
+
+/**
+ * @brief Take the oldest event (consumer side)
+ *
+ * @param ev    -returned event
+ * @return
+ *          - false when there is none
+ */
+bool input_pop(input_event_t * ev);
+
+/**
+ * @brief Time since the event was sampled
+ *
+ * @param ev    -event
+ * @return
+ *          - age in microseconds
+ */
+uint32_t input_event_age_us(const input_event_t * ev);
+
+/**
+ * @brief Events dropped because the ring was full
+ */
+uint32_t input_dropped(void);
+
+/**
+ * @brief Add a touch to photon latency sample, also from ISR
+ *
+ * @param us    -time from the touch sample until the resulting frame is on the display
+ */
+void input_latency_add(uint32_t us);
+
+/**
+ * @brief Latency samples so far
+ */
+uint32_t input_latency_count(void);
+
+/**
+ * @brief Log p50, p95 and max of the latency samples
+ */
+void input_latency_report(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,292 @@
+/* Remote control input
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/uart.h"
+#if INPUT_REMOTE_UDP_PORT > 0
+#include "lwip/sockets.h"
+#endif
+
+#include "input_remote.h"
+
+#ifdef CONFIG_ESP_CONSOLE_UART_NUM
+#define INPUT_REMOTE_UART_NUM   CONFIG_ESP_CONSOLE_UART_NUM
+#else
+#define INPUT_REMOTE_UART_NUM   0
+#endif
+
+/* Bytes read at once, and the longest UDP datagram: every byte gives at most one event */
+#define INPUT_REMOTE_CHUNK      64
+
+/* Most the clock offset rises per packet, in 1/4096 of the time since the previous one (244 ppm) */
+#define INPUT_REMOTE_RELAX_SHIFT    12
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static const char *TAG = "REMOTE";
+
+static input_remote_stats_t remote_stats;
+
+#if INPUT_REMOTE_UART
+static bool remote_uart_open = false;
+static input_remote_parser_t remote_uart_parser;
+#endif
+#if INPUT_REMOTE_UDP_PORT > 0
+static int remote_udp_fd = -1;
+static input_remote_parser_t remote_udp_parser;
+#endif
+
+/* Events of the last chunk not handed out yet */
+static input_event_t remote_pending[INPUT_REMOTE_CHUNK];
+static int remote_pending_head = 0;
+static int remote_pending_count = 0;
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static int _input_remote_key(char c)
+{
+    switch (c) {
+    case '8': return INPUT_BUTTON_UP;
+    case '4': return INPUT_BUTTON_LEFT;
+    case '6': return INPUT_BUTTON_RIGHT;
+    case '2': return INPUT_BUTTON_DOWN;
+    case 'z': return INPUT_BUTTON_A;
+    case 'x': return INPUT_BUTTON_B;
+    default:  return -1;
+    }
+}
+
+static int _input_remote_add(input_remote_parser_t * parser, int button, uint32_t t_us, input_event_t * evs, int n, int max)
+{
+    parser->stats->keys++;
+    if (n >= max) {
+        return n;
+    }
+    evs[n].t_us = t_us;
+    evs[n].button = (uint8_t)button;
+    return n + 1;
+}
+
+/* "<seq> <sender time us> <keys>" */
+static int _input_remote_packet(input_remote_parser_t * parser, uint32_t rx_us, input_event_t * evs, int n, int max)
+{
+    char * end;
+    char * field = parser->line;
+
+    parser->line[parser->len] = '\0';
+    uint16_t seq = (uint16_t)strtoul(field, &end, 10);
+    if (end == field || *end != ' ') {
+        parser->stats->malformed++;
+        return n;
+    }
+    field = end + 1;
+    uint32_t sender_us = (uint32_t)strtoul(field, &end, 10);
+    if (end == field || *end != ' ') {
+        parser->stats->malformed++;
+        return n;
+    }
+    const char * keys = end + 1;
+
+    if (parser->synced) {
+        uint16_t gap = seq - parser->seq_next;
+        if (gap >= 0x8000 && seq != 0) {
+            parser->stats->late++;
+            return n;
+        }
+        /* seq 0 after a gap: the sender restarted */
+        parser->stats->dropped += (gap < 0x8000) ? gap : 0;
+    }
+    parser->stats->packets++;
+    parser->seq_next = seq + 1;
+
+    /* the fastest packet has the smallest offset, the others waited somewhere. A sender clock slower
+       than ours raises the offset for good: follow it, slower than any crystal drifts */
+    uint32_t offset_us = rx_us - sender_us;
+    int32_t rise_us = (int32_t)(offset_us - parser->offset_us);
+    if (!parser->synced || rise_us < 0) {
+        parser->offset_us = offset_us;
+    } else {
+        uint32_t relax_us = (rx_us - parser->rx_us) >> INPUT_REMOTE_RELAX_SHIFT;
+        parser->offset_us += ((uint32_t)rise_us < relax_us) ? (uint32_t)rise_us : relax_us;
+    }
+    parser->rx_us = rx_us;
+    parser->synced = true;
+
+    for (; *keys; keys++) {
+        int button = _input_remote_key(*keys);
+        if (button >= 0) {
+            n = _input_remote_add(parser, button, sender_us + parser->offset_us, evs, n, max);
+        }
+    }
+    return n;
+}
+
+/* Refill the pending events from the sources, false when nothing arrived */
+static bool _input_remote_read(void)
+{
+    /* one byte more than a datagram may have: a full buffer is a datagram that did not fit */
+    uint8_t buf[INPUT_REMOTE_CHUNK + 1];
+    int len;
+
+    remote_pending_head = 0;
+    remote_pending_count = 0;
+
+#if INPUT_REMOTE_UART
+    if (remote_uart_open) {
+        len = uart_read_bytes(INPUT_REMOTE_UART_NUM, buf, INPUT_REMOTE_CHUNK, 0);
+        if (len > 0) {
+            remote_pending_count = input_remote_parse(&remote_uart_parser, buf, len, (uint32_t)esp_timer_get_time(),
+                                                      remote_pending, INPUT_REMOTE_CHUNK);
+            return true;
+        }
+    }
+#endif
+#if INPUT_REMOTE_UDP_PORT > 0
+    if (remote_udp_fd >= 0) {
+        len = recvfrom(remote_udp_fd, buf, sizeof(buf), 0, NULL, NULL);
+        if (len > INPUT_REMOTE_CHUNK) {
+            /* cut by the buffer: its last packet would parse as complete, drop it all */
+            remote_stats.malformed++;
+            return true;
+        }
+        if (len > 0) {
+            uint32_t rx_us = (uint32_t)esp_timer_get_time();
+            remote_pending_count = input_remote_parse(&remote_udp_parser, buf, len, rx_us, remote_pending, INPUT_REMOTE_CHUNK);
+            /* the datagram ends the packet */
+            remote_pending_count += input_remote_parse(&remote_udp_parser, (const uint8_t *)"\n", 1, rx_us,
+                                                       remote_pending + remote_pending_count,
+                                                       INPUT_REMOTE_CHUNK - remote_pending_count);
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+void input_remote_parser_init(input_remote_parser_t * parser, input_remote_stats_t * stats)
+{
+    memset(parser, 0, sizeof(input_remote_parser_t));
+    parser->stats = stats;
+}
+
+int input_remote_parse(input_remote_parser_t * parser, const uint8_t * data, size_t len, uint32_t rx_us, input_event_t * evs, int max)
+{
+    int n = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        char c = (char)data[i];
+
+        if (!parser->in_packet) {
+            if (c == '#') {
+                parser->in_packet = true;
+                parser->overflow = false;
+                parser->len = 0;
+            } else {
+                /* single key, typed: the time of arrival is all there is */
+                int button = _input_remote_key(c);
+                if (button >= 0) {
+                    n = _input_remote_add(parser, button, rx_us, evs, n, max);
+                }
+            }
+            continue;
+        }
+
+        if (c == '\n' || c == '\r') {
+            parser->in_packet = false;
+            if (parser->overflow) {
+                parser->stats->malformed++;
+            } else {
+                n = _input_remote_packet(parser, rx_us, evs, n, max);
+            }
+        } else if (parser->len < INPUT_REMOTE_LINE_MAX - 1) {
+            parser->line[parser->len++] = c;
+        } else {
+            parser->overflow = true;
+        }
+    }
+    return n;
+}
+
+bool input_remote_start(void)
+{
+    bool open = false;
+
+#if INPUT_REMOTE_UART
+    input_remote_parser_init(&remote_uart_parser, &remote_stats);
+    /* the console may be in use by the driver already */
+    if (uart_is_driver_installed(INPUT_REMOTE_UART_NUM) ||
+        uart_driver_install(INPUT_REMOTE_UART_NUM, 256, 0, 0, NULL, 0) == ESP_OK) {
+        remote_uart_open = true;
+        open = true;
+    } else {
+        ESP_LOGE(TAG, "UART%d driver install failed", INPUT_REMOTE_UART_NUM);
+    }
+#endif
+
+#if INPUT_REMOTE_UDP_PORT > 0
+    input_remote_parser_init(&remote_udp_parser, &remote_stats);
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(INPUT_REMOTE_UDP_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    remote_udp_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (remote_udp_fd >= 0 && bind(remote_udp_fd, (struct sockaddr *)&addr, sizeof(addr)) == 0 &&
+        fcntl(remote_udp_fd, F_SETFL, fcntl(remote_udp_fd, F_GETFL, 0) | O_NONBLOCK) == 0) {
+        open = true;
+    } else {
+        ESP_LOGE(TAG, "UDP port %d not open", INPUT_REMOTE_UDP_PORT);
+        if (remote_udp_fd >= 0) {
+            close(remote_udp_fd);
+            remote_udp_fd = -1;
+        }
+    }
+#endif
+
+    if (open) {
+        ESP_LOGI(TAG, "Remote input:%s%s", INPUT_REMOTE_UART ? " console" : "", (INPUT_REMOTE_UDP_PORT > 0) ? " UDP" : "");
+    }
+    return open;
+}
+
+int input_remote_poll(input_event_t * evs, int max)
+{
+    int n = 0;
+
+    while (n < max) {
+        if (remote_pending_head >= remote_pending_count && !_input_remote_read()) {
+            break;
+        }
+        while (n < max && remote_pending_head < remote_pending_count) {
+            evs[n++] = remote_pending[remote_pending_head++];
+        }
+    }
+    return n;
+}
+
+void input_remote_get_stats(input_remote_stats_t * stats)
+{
+    *stats = remote_stats;
+}
@@ -0,0 +1,121 @@
+/* Remote control input
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "input.h"
+
+/*
+ * The keys of the original sketch, '8' up, '4' left, '6' right, '2' down, 'z' A and 'x' B, from the
+ * console UART or UDP. Either single key bytes (typed in a terminal), or packets of one line:
+ *
+ *     #<seq> <sender time us> <keys>\n
+ *
+ * seq counts the packets of a sender (modulo 65536), gaps are counted as dropped packets. The sender
+ * time is moved to the local clock with the offset of the fastest packet seen, so events carry the
+ * time of the press rather than the time of arrival. The offset follows a faster packet at once and
+ * rises by at most 1/4096 of the time between packets, enough for a sender clock that runs slow.
+ * A UDP datagram ends its packet without '\n', datagrams over 64 bytes are dropped as malformed.
+ *
+ * Nothing blocks: the game polls once per tick and gets everything that arrived meanwhile.
+ */
+
+/* Console UART as remote input */
+#ifndef INPUT_REMOTE_UART
+#define INPUT_REMOTE_UART       1
+#endif
+
+/* UDP port, 0 = off. The network has to be up, the game does not start WiFi itself. */
+#ifndef INPUT_REMOTE_UDP_PORT
+#define INPUT_REMOTE_UDP_PORT   0
+#endif
+
+/* Longest packet line */
+#define INPUT_REMOTE_LINE_MAX   48
+
+typedef struct input_remote_stats_s
+{
+    uint32_t packets;       /* packets with a valid header */
+    uint32_t dropped;       /* sequence gaps */
+    uint32_t late;          /* sequence older than expected (duplicate or reordered), ignored */
+    uint32_t malformed;
+    uint32_t keys;          /* events produced */
+} input_remote_stats_t;
+
+/* Byte stream to events, one per source */
+typedef struct input_remote_parser_s
+{
+    char line[INPUT_REMOTE_LINE_MAX];
+    uint8_t len;
+    bool in_packet;
+    bool overflow;
+    bool synced;            /* seq_next and offset are valid */
+    uint16_t seq_next;
+    uint32_t offset_us;     /* local minus sender time, smallest seen, relaxed upwards */
+    uint32_t rx_us;         /* local time of the last packet */
+    input_remote_stats_t * stats;
+} input_remote_parser_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Reset a parser
+ *
+ * @param parser    -parser
+ * @param stats     -counters updated by the parser, shared by several parsers if wanted
+ */
+void input_remote_parser_init(input_remote_parser_t * parser, input_remote_stats_t * stats);
+
+/**
+ * @brief Feed received bytes
+ *
+ * @param parser    -parser of the source
+ * @param data      -bytes
+ * @param len       -number of bytes
+ * @param rx_us     -esp_timer time of reception
+ * @param evs       -returned events
+ * @param max       -entries in evs, keys beyond are counted but lost
+ * @return
+ *          - number of events written
+ */
+int input_remote_parse(input_remote_parser_t * parser, const uint8_t * data, size_t len, uint32_t rx_us, input_event_t * evs, int max);
+
+/**
+ * @brief Open the console UART and the UDP socket, as configured
+ *
+ * @return
+ *          - true when at least one source is open
+ */
+bool input_remote_start(void);
+
+/**
+ * @brief Read whatever arrived from all sources, never blocks
+ *
+ * @param evs   -returned events, oldest first
+ * @param max   -entries in evs, call again while it returns max
+ * @return
+ *          - number of events written
+ */
+int input_remote_poll(input_event_t * evs, int max);
+
+/**
+ * @brief Counters of all sources
+ *
+ * @param stats -returned counters
+ */
+void input_remote_get_stats(input_remote_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,1888 +1,3371 @@
-/******************************************************************************/
-/*                                                                            */
-/*  PACMAN GAME FOR ARDUINO DUE                                               */
-/*                                                                            */
-/******************************************************************************/
-/*  Copyright (c) 2014  Dr. NCX (mirracle.mxx@gmail.com)                      */
-/*                                                                            */
-/* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL              */
-/* WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED              */
-/* WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR    */
-/* BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES      */
-/* OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,     */
-/* WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,     */
-/* ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS        */
-/* SOFTWARE.                                                                  */
-/*                                                                            */
-/*  MIT license, all text above must be included in any redistribution.       */
-
-
-/*
-    Controller configuration:
-    Buttons UP, RIGHT, DOWN, LEFT, PAUSE and RESTART are each assigned on characters '8', '6', '2', '4', 'x', 'z' in the both case of SerialPort and WiFi UDP.
-*/
-
-/******************************************************************************/
-/*   MAIN GAME VARIABLES                                                      */
-/******************************************************************************/
-
-#include "Arduino.h"
-
-//#include <stdio.h>
-//#include <string.h>
-//#include "sdkconfig.h"
-
-//#include "freertos/FreeRTOS.h"
-//#include "freertos/semphr.h"
-
-//#include "esp_heap_caps.h"
-//#include "esp_log.h"
-
-//#include "driver/gpio.h"
-//#include "driver/i2c.h"
-#include "board.h"
-#if 0
-#include "lcd.h"
-#if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
-#include "esp_lcd_touch_gt911.h"
-#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
-#include "esp_lcd_touch_tt21100.h"
-#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
-#include "esp_lcd_touch_ft5x06.h"
-#endif
-#endif
-
-#include "bsp.h"
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-#include "Game_Audio.h"
-#include "SoundData.h"
-#endif
-#include "TFT_16bits.h"
-
-#if 0
-#if !CONFIG_IDF_TARGET_ESP32S2
-#error This Sketch is inteded to run on ESP32-S2 HMI Devkit - Select "ESP32S2 Dev Module" board.
-#endif
-
-#if !CONFIG_SPIRAM
-#error This sketch MUST use PSRAM, please enable it in the IDE Menu
-#endif
-#endif
-
-#define SCR_WIDTH     BOARD_DISP_TOUCH_HRES
-#define SCR_HEIGHT    BOARD_DISP_TOUCH_VRES
-
-#define GPIO_DAC_OUT (GPIO_NUM_18)   // ESP32S2 DAC is 17/18 | ESP32 is 25/26 | ESP32S3 has NO DAC... DeltaSigma needed to generate a PDM waveform
-
-void drawIndexedmap(uint8_t* indexmap, uint16_t x, uint16_t y);
-void ClearKeys();
-void drawButtonFace(uint8_t btId);
-void  bsp_lcd_flush(int x0, int y0, int x1, int y1, void *pixels);
-
-// creates a GFX object for drawing and allocating PSRAM for Screen Buffer
-TFT_16bits tft16bits(SCR_WIDTH, SCR_HEIGHT);
-
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-Game_Audio_Class GameAudio(GPIO_DAC_OUT, 0); // GPIO25/26 ESP32 || GPIO17/18 ESP32-S2 -- TIMER number 1
-Game_Audio_Wav_Class pmDeath(pacmanDeath); // pacman dyingsound
-Game_Audio_Wav_Class pmWav(pacman); // pacman theme
-Game_Audio_Wav_Class pmChomp(chomp); // pacman chomp
-Game_Audio_Wav_Class pmEatGhost(pacman_eatghost); // pacman theme
-#endif
-
-#define BLACK   0x0000
-#define BLUE    0x001F
-#define RED     0xF800
-#define GREEN   0x07E0
-#define CYAN    0x07FF
-#define MAGENTA 0xF81F
-#define YELLOW  0xFFE0
-#define WHITE   0xFFFF
-
-#if (BOARD_DISP_PARALLEL_CONTROLLER == BOARD_DISP_LCD_RM68120)
-// R5 G6 B5 for RM68120
-#define C16(_rr,_gg,_bb) ((uint16_t)(((_rr & 0xF8) << 8) | ((_gg & 0xFC) << 3) | ((_bb & 0xF8) >> 3)))
-#elif (BOARD_DISP_PARALLEL_CONTROLLER == BOARD_DISP_LCD_RA8875)
-// B5 R5 G6 for RA8875
-#define C16(_rr,_gg,_bb) ((uint16_t)(((_bb & 0xF8) << 8) | ((_rr & 0xF8) << 3) | ((_gg & 0xFC) >> 2)))
-#endif
-
-const uint16_t _paletteW[16] =
-{
-  C16(0, 0, 0),
-  C16(255, 0, 0),      // 1 red
-  C16(222, 151, 81),   // 2 brown
-  C16(255, 0, 255),    // 3 pink
-
-  C16(0, 0, 0),
-  C16(0, 255, 255),    // 5 cyan
-  C16(71, 84, 255),    // 6 mid blue
-  C16(255, 184, 81),   // 7 lt brown
-
-  C16(0, 0, 0),
-  C16(255, 255, 0),    // 9 yellow
-  C16(0, 0, 0),
-  C16(33, 33, 255),    // 11 blue
-
-  C16(0, 255, 0),      // 12 green
-  C16(71, 84, 174),    // 13 aqua
-  C16(255, 184, 174),  // 14 lt pink
-  C16(222, 222, 255),  // 15 whiteish
-};
-
-/*
-uint8_t colors[] = {
-  0,   0,   0,
-  255, 0,   0,
-  222, 151, 81,
-  255, 0,   255,
-  0,   0,   0,
-  0,   255, 255,
-  71,  84,  255,
-  255, 184, 81,
-  0,   0,   0,
-  255, 255, 0,
-  0,   0,   0,
-  33,  33,  255,
-  0,   255, 0,
-  71,  84,  174,
-  255, 184, 174,
-  222, 222, 255,
-};
-*/
-
-uint8_t SPEED = 2; // 1=SLOW 2=NORMAL 4=FAST //do not try  other values!!!
-
-
-#define BONUS_INACTIVE_TIME 600
-#define BONUS_ACTIVE_TIME 300
-
-#define START_LIFES 2
-#define START_LEVEL 1
-
-uint8_t MAXLIFES = 5;
-uint8_t LIFES = START_LIFES;
-uint8_t GAMEWIN = 0;
-uint8_t GAMEOVER = 0;
-uint8_t DEMO = 1;
-uint8_t LEVEL = START_LEVEL;
-uint8_t ACTUALBONUS = 0;  //actual bonus icon
-uint8_t ACTIVEBONUS = 0;  //status of bonus
-uint8_t GAMEPAUSED = 0;
-
-uint8_t PACMANFALLBACK = 0;
-
-/******************************************************************************/
-/*   Controll KEYPAD LOOP                                                     */
-/******************************************************************************/
-
-boolean but_A = false;        // START | PAUSE
-boolean but_B = false;        // NOT USED HERE... would be for reseting the game
-boolean but_UP = false;       // Indicates to go UP
-boolean but_DOWN = false;     // Indicates to go DOWN
-boolean but_LEFT = false;     // Indicates to go LEFT
-boolean but_RIGHT = false;    // Indicates to go RIGHT
-
-/******************************************************************************/
-/*   GAME VARIABLES AND DEFINITIONS                                           */
-/******************************************************************************/
-
-#include "pacmanTiles.h"
-
-enum GameState {
-  ReadyState,
-  PlayState,
-  DeadGhostState, // Player got a ghost, show score sprite and only move eyes
-  DeadPlayerState,
-  EndLevelState
-};
-
-enum SpriteState
-{
-  PenState,
-  RunState,
-  FrightenedState,
-  DeadNumberState,
-  DeadEyesState,
-  AteDotState,    // pacman
-  DeadPacmanState
-};
-
-enum {
-  MStopped = 0,
-  MRight = 1,
-  MDown = 2,
-  MLeft = 3,
-  MUp = 4,
-};
-
-#define ushort uint16_t
-
-#define BINKY 0
-#define PINKY 1
-#define INKY  2
-#define CLYDE 3
-#define PACMAN 4
-#define BONUS 5
-
-const uint8_t _initSprites[] =
-{
-  BINKY,  14,     17 - 3,  31, MLeft,
-  PINKY,  14 - 2, 17,      79, MLeft,
-  INKY,   14,     17,     137, MLeft,
-  CLYDE,  14 + 2, 17,     203, MRight,
-  PACMAN, 14,     17 + 9,   0, MLeft,
-  BONUS,  14,     17 + 3,   0, MLeft,
-};
-
-//  Ghost colors
-const uint8_t _palette2[] =
-{
-  0, 11, 1, 15,  // BINKY red
-  0, 11, 3, 15,  // PINKY pink
-  0, 11, 5, 15,  // INKY cyan
-  0, 11, 7, 15,  // CLYDE brown
-  0, 11, 9, 9,   // PACMAN yellow
-  0, 11, 15, 15, // FRIGHTENED
-  0, 11, 0, 15,  // DEADEYES
-
-  0, 1, 15, 2,   // cherry
-  0, 1, 15, 12,  // strawberry
-  0, 7, 2, 12,   // peach
-  0, 9, 15, 0,   // bell
-
-  0, 15, 1, 2,   // apple
-  0, 12, 15, 5,  // grape
-  0, 11, 9, 1,   // galaxian
-  0, 5, 15, 15,  // key
-
-};
-
-const uint8_t _paletteIcon2[] =
-{
-  0, 9, 9, 9, // PACMAN
-
-  0, 2,  15, 1,  // cherry
-  0, 12, 15, 1,  // strawberry
-  0, 12, 2,  7,  // peach
-  0, 0,  15, 9,  // bell
-
-  0, 2,  15, 1,  // apple
-  0, 12, 15, 5,  // grape
-  0, 1,  9,  11, // galaxian
-  0, 5,  15, 15, // key
-};
-
-#define PACMANICON 1
-#define BONUSICON 2
-
-#define FRIGHTENEDPALETTE 5
-#define DEADEYESPALETTE 6
-
-#define BONUSPALETTE 7
-
-#define FPS 60
-#define CHASE 0
-#define SCATTER 1
-
-#define DOT 7
-#define PILL 14
-#define PENGATE 0x1B
-
-const uint8_t _opposite[] = { MStopped, MLeft, MUp, MRight, MDown };
-#define OppositeDirection(_x) *(_opposite + _x)
-
-const uint8_t _scatterChase[] = { 7, 20, 7, 20, 5, 20, 5, 0 };
-const uint8_t _scatterTargets[] = { 2, 0, 25, 0, 0, 35, 27, 35 }; // inky/clyde scatter targets are backwards
-const uint8_t _pinkyTargetOffset[] = { 4, 0, 0, 4, (uint8_t) - 4, 0, (uint8_t) - 4, 4 }; // Includes pinky target bug
-
-#define FRIGHTENEDGHOSTSPRITE 0
-#define GHOSTSPRITE 2
-#define NUMBERSPRITE 10
-#define PACMANSPRITE 14
-
-const uint8_t _pacLeftAnim[] = { 5, 6, 5, 4 };
-const uint8_t _pacRightAnim[] = { 2, 0, 2, 4 };
-const uint8_t _pacVAnim[] = { 4, 3, 1, 3 };
-
-uint16_t _BonusInactiveTimmer = BONUS_INACTIVE_TIME;
-uint16_t _BonusActiveTimmer = 0;
-
-/******************************************************************************/
-/*   GAME - Sprite Class                                                      */
-/******************************************************************************/
-
-class Sprite
-{
-  public:
-    int16_t _x, _y;
-    int16_t lastx, lasty;
-    uint8_t cx, cy;        // cell x and y
-    uint8_t tx, ty;        // target x and y
-
-    SpriteState state;
-    uint8_t  pentimer;     // could be the same
-
-    uint8_t who;
-    uint8_t _speed;
-    uint8_t dir;
-    uint8_t phase;
-
-    // Sprite bits
-    uint8_t palette2;  // 4->16 color map index
-    uint8_t bits;      // index of sprite bits
-    int8_t sy;
-
-    void Init(const uint8_t* s)
-    {
-      ClearKeys();
-      who = *s++;
-      cx =  *s++;
-      cy =  *s++;
-      pentimer = *s++;
-      dir = *s;
-      _x = lastx = (int16_t)cx * 8 - 4;
-      _y = lasty = (int16_t)cy * 8;
-      state = PenState;
-      _speed = 0;
-      Target(rand() % 20, rand() % 20);
-    }
-
-
-    void Target(uint8_t x, uint8_t y)
-    {
-      tx = x;
-      ty = y;
-    }
-
-    int16_t Distance(uint8_t x, uint8_t y)
-    {
-      int16_t dx = cx - x;
-      int16_t dy = cy - y;
-      return dx * dx + dy * dy; // Distance to target
-    }
-
-    //  once per sprite, not 9 times
-    void SetupDraw(GameState gameState, uint8_t deadGhostIndex)
-    {
-      sy = 1;
-      palette2 = who;
-      uint8_t p = phase >> 3;
-
-      if (who == BONUS) {
-        //BONUS ICONS
-        bits = 21 + ACTUALBONUS;
-        palette2 = BONUSPALETTE + ACTUALBONUS;
-        return;
-      }
-
-      if (who != PACMAN)
-      {
-        bits = GHOSTSPRITE + ((dir - 1) << 1) + (p & 1); // Ghosts
-        switch (state)
-        {
-          case FrightenedState:
-            bits = FRIGHTENEDGHOSTSPRITE + (p & 1); // frightened
-            palette2 = FRIGHTENEDPALETTE;
-            break;
-          case DeadNumberState:
-            palette2 = FRIGHTENEDPALETTE;
-            bits = NUMBERSPRITE + deadGhostIndex;
-            break;
-          case DeadEyesState:
-            palette2 = DEADEYESPALETTE;
-            break;
-          default:
-            ;
-        }
-        return;
-      }
-
-      //  PACMAN animation
-      uint8_t f = (phase >> 1) & 3;
-      if (dir == MLeft)
-        f = _pacLeftAnim[f];
-      else if (dir == MRight)
-        f = _pacRightAnim[f];
-      else
-        f = _pacVAnim[f];
-      if (dir == MUp)
-        sy = -1;
-      bits = f + PACMANSPRITE;
-    }
-
-    //  Draw this sprite into the tile at x,y
-    void Draw8(int16_t x, int16_t y, uint8_t* tile)
-    {
-
-      int16_t px = x - (_x - 4);
-      if (px <= -8 || px >= 16) return;
-      int16_t py = y - (_y - 4);
-      if (py <= -8 || py >= 16) return;
-
-      // Clip y
-      int16_t lines = py + 8;
-      if (lines > 16)
-        lines = 16;
-      if (py < 0)
-      {
-        tile -= py * 8;
-        py = 0;
-      }
-      lines -= py;
-
-      //  Clip in X
-      uint8_t right = 16 - px;
-      if (right > 8)
-        right = 8;
-      uint8_t left = 0;
-      if (px < 0)
-      {
-        left = -px;
-        px = 0;
-      }
-
-      //  Get bitmap
-      int8_t dy = sy;
-      if (dy < 0)
-        py = 15 - py;  // VFlip
-      uint8_t* data = (uint8_t*)(pacman16x16 + bits * 64);
-      data += py << 2;
-      dy <<= 2;
-      data += px >> 2;
-      px &= 3;
-
-      const uint8_t* palette = _palette2 + (palette2 << 2);
-      while (lines)
-      {
-        const uint8_t *src = data;
-        uint8_t d = *src++;
-        d >>= px << 1;
-        uint8_t sx = 4 - px;
-        uint8_t x = left;
-        do
-        {
-          uint8_t p = d & 3;
-          if (p)
-          {
-            p = palette[p];
-            if (p)
-              tile[x] = p;
-          }
-          d >>= 2;    // Next pixel
-          if (!--sx)
-          {
-            d = *src++;
-            sx = 4;
-          }
-        } while (++x < right);
-
-        tile += 8;
-        data += dy;
-        lines--;
-      }
-    }
-};
-
-/******************************************************************************/
-/*   GAME - Playfield Class                                                   */
-/******************************************************************************/
-
-class Playfield
-{
-
-    Sprite _sprites[5];
-
-    Sprite _BonusSprite; //Bonus
-
-    uint8_t _dotMap[(32 / 4) * (36 - 6)];
-
-    GameState _state;
-    long    _score;             // 7 digits of score
-    long    _hiscore;             // 7 digits of score
-    long    _lifescore;
-    int8_t    _scoreStr[8];
-    int8_t    _hiscoreStr[8];
-    uint8_t    _icons[14];         // Along bottom of screen
-
-    ushort  _stateTimer;
-    ushort  _frightenedTimer;
-    uint8_t    _frightenedCount;
-    uint8_t    _scIndex;           //
-    ushort  _scTimer;           // next change of sc status
-
-    bool _inited;
-    uint8_t* _dirty;
-  public:
-    Playfield() : _inited(false)
-    {
-      //  Swizzle palette TODO just fix in place
-      //      uint8_t * p = (uint8_t*)_paletteW;
-      //      for (int16_t i = 0; i < 16; i++)
-      //      {
-      //        ushort w = _paletteW[i];    // Swizzle
-      //        *p++ = w >> 8;
-      //        *p++ = w;
-      //      }
-    }
-
-    // Draw 2 bit BG into 8 bit icon tiles at bottom
-    void DrawBG2(uint8_t cx, uint8_t cy, uint8_t* tile)
-    {
-
-      uint8_t index = 0;
-      int8_t b = 0;
-
-      index = _icons[cx >> 1];   // 13 icons across bottom
-      if (index == 0)
-      {
-        memset(tile, 0, 64);
-        return;
-      }
-      index--;
-      index <<= 2;                        // 4 tiles per icon
-
-      b = (1 - (cx & 1)) + ((cy & 1) << 1); // Index of tile
-
-      const uint8_t* bg = pacman8x8x2 + ((b + index) << 4);
-      const uint8_t* palette = _paletteIcon2 + index;
-
-
-      uint8_t x = 16;
-      while (x--)
-      {
-        uint8_t bits = (int8_t) * bg++;
-        uint8_t i = 4;
-        while (i--)
-        {
-          tile[i] = palette[bits & 3];
-          bits >>= 2;
-        }
-        tile += 4;
-      }
-    }
-
-    uint8_t GetTile(int16_t cx, int16_t ty)
-    {
-
-      if (_state != ReadyState && ty == 20 && cx > 10 && cx < 17) return (0); //READY TEXT ZONE
-
-      if (LEVEL % 5 == 1) return playMap1[ty * 28 + cx];
-      if (LEVEL % 5 == 2) return playMap2[ty * 28 + cx];
-      if (LEVEL % 5 == 3) return playMap3[ty * 28 + cx];
-      if (LEVEL % 5 == 4) return playMap4[ty * 28 + cx];
-      if (LEVEL % 5 == 0) return playMap5[ty * 28 + cx];
-      return 0;
-    }
-
-    // Draw 1 bit BG into 8 bit tile
-    void DrawBG(uint8_t cx, uint8_t cy, uint8_t* tile)
-    {
-
-      memset(tile, 0, 64);
-      if (cy >= 34) //DRAW ICONS BELLOW MAZE
-      {
-        DrawBG2(cx, cy, tile);
-        return;
-      }
-
-
-      uint8_t c = 11;
-      if (LEVEL % 8 == 1) c = 11; // Blue
-      if (LEVEL % 8 == 2) c = 12; // Green
-      if (LEVEL % 8 == 3) c = 1; // Red
-      if (LEVEL % 8 == 4) c = 9; // Yellow
-      if (LEVEL % 8 == 5) c = 2; // Brown
-      if (LEVEL % 8 == 6) c = 5; // Cyan
-      if (LEVEL % 8 == 7) c = 3; // Pink
-      if (LEVEL % 8 == 0) c = 15; // White
-
-      uint8_t b = GetTile(cx, cy);
-      const uint8_t* bg;
-
-      //  This is a little messy
-      memset(tile, 0, 64);
-      if (cy == 20 && cx >= 11 && cx < 17)
-      {
-        if (DEMO == 1 && ACTIVEBONUS == 1) return;
-
-        if ((_state != ReadyState && GAMEPAUSED != 1 && DEMO != 1) || ACTIVEBONUS == 1) b = 0; // hide 'READY!'
-        else if (DEMO == 1 && cx == 11) b = 0;
-        else if (DEMO == 1 && cx == 12) b = 'D';
-        else if (DEMO == 1 && cx == 13) b = 'E';
-        else if (DEMO == 1 && cx == 14) b = 'M';
-        else if (DEMO == 1 && cx == 15) b = 'O';
-        else if (DEMO == 1 && cx == 16) b = 0;
-        else if (GAMEPAUSED == 1 && cx == 11) b = 'P';
-        else if (GAMEPAUSED == 1 && cx == 12) b = 'A';
-        else if (GAMEPAUSED == 1 && cx == 13) b = 'U';
-        else if (GAMEPAUSED == 1 && cx == 14) b = 'S';
-        else if (GAMEPAUSED == 1 && cx == 15) b = 'E';
-        else if (GAMEPAUSED == 1 && cx == 16) b = 'D';
-      }
-      else if (cy == 1)
-      {
-        if (cx < 7)
-          b = _scoreStr[cx];
-        else if (cx >= 10 && cx < 17)
-          b = _hiscoreStr[cx - 10]; // HiScore
-      } else {
-        if (b == DOT || b == PILL)  // DOT==7 or PILL==16
-        {
-          if (!GetDot(cx, cy))
-            return;
-          c = 14;
-        }
-        if (b == PENGATE)
-          c = 14;
-      }
-
-      bg = playTiles + (b << 3);
-      if (b >= '0')
-        c = 15; // text is white
-
-      for (uint8_t y = 0; y < 8; y++)
-      {
-        int8_t bits = (int8_t) * bg++; ///WARNING CHAR MUST BE signed !!!
-        uint8_t x = 0;
-        while (bits)
-        {
-          if (bits < 0)
-            tile[x] = c;
-          bits <<= 1;
-          x++;
-        }
-        tile += 8;
-      }
-    }
-
-    // Draw BG then all sprites in this cell
-    void Draw(uint16_t x, uint16_t y, bool sprites)
-    {
-      static uint8_t tile[8 * 8];
-      memset(tile, 0, sizeof(tile));
-
-      //      Fill with BG
-      if (y == 20 && x >= 11 && x < 17 && DEMO == 1 && ACTIVEBONUS == 1)  return;
-      DrawBG(x, y, tile);
-
-      //      Overlay sprites
-      x <<= 3;
-      y <<= 3;
-      if (sprites)
-      {
-        for (uint8_t i = 0; i < 5; i++)
-          _sprites[i].Draw8(x, y, tile);
-
-        //AND BONUS
-        if (ACTIVEBONUS) _BonusSprite.Draw8(x, y, tile);
-
-      }
-
-      //      Show sprite block
-#if 0
-      for (uint8_t i = 0; i < 5; i++)
-      {
-        Sprite* s = _sprites + i;
-        if (s->cx == (x >> 3) && s->cy == (y >> 3))
-        {
-          memset(tile, 0, 8);
-          for (uint8_t j = 1; j < 7; j++)
-            tile[j * 8] = tile[j * 8 + 7] = 0;
-          memset(tile + 56, 0, 8);
-        }
-      }
-#endif
-
-      x += (240 - 224) / 2;
-      y += (320 - 288) / 2;
-
-
-      //      Should be a direct Graphics call
-
-      //uint8_t n = tile[0];
-      //uint8_t i = 0;
-      //uint16_t color = (uint16_t)_paletteW[n];
-
-      drawIndexedmap(tile, x, y);
-    }
-
-    boolean updateMap [36][28];
-
-    //  Mark tile as dirty (should not need range checking here)
-    void Mark(int16_t x, int16_t y, uint8_t* m)
-    {
-      x -= 4;
-      y -= 4;
-
-      updateMap[(y >> 3)][(x >> 3)] = true;
-      updateMap[(y >> 3)][(x >> 3) + 1] = true;
-      updateMap[(y >> 3)][(x >> 3) + 2] = true;
-      updateMap[(y >> 3) + 1][(x >> 3)] = true;
-      updateMap[(y >> 3) + 1][(x >> 3) + 1] = true;
-      updateMap[(y >> 3) + 1][(x >> 3) + 2] = true;
-      updateMap[(y >> 3) + 2][(x >> 3)] = true;
-      updateMap[(y >> 3) + 2][(x >> 3) + 1] = true;
-      updateMap[(y >> 3) + 2][(x >> 3) + 2] = true;
-
-    }
-
-    void DrawAllBG()
-    {
-      for (uint8_t y = 0; y < 36; y++)
-        for (uint8_t x = 0; x < 28; x++) {
-          Draw(x, y, false);
-        }
-    }
-
-    //  Draw sprites overlayed on cells
-    void DrawAll()
-    {
-      uint8_t* m = _dirty;
-
-      //  Mark sprite old/new positions as dirty
-      for (uint8_t i = 0; i < 5; i++)
-      {
-        Sprite* s = _sprites + i;
-        Mark(s->lastx, s->lasty, m);
-        Mark(s->_x, s->_y, m);
-
-      }
-
-      // Mark BONUS sprite old/new positions as dirty
-      Sprite* _s = &_BonusSprite;
-      Mark(_s->lastx, _s->lasty, m);
-      Mark(_s->_x, _s->_y, m);
-
-
-      //  Animation
-      for (uint8_t i = 0; i < 5; i++)
-        _sprites[i].SetupDraw(_state, _frightenedCount - 1);
-
-      _BonusSprite.SetupDraw(_state, _frightenedCount - 1);
-
-
-      for (uint8_t tmpY = 0; tmpY < 36; tmpY++) {
-        for (uint8_t tmpX = 0; tmpX < 28; tmpX++) {
-          if (updateMap[tmpY][tmpX] == true) Draw(tmpX, tmpY, true);
-          updateMap[tmpY][tmpX] = false;
-        }
-
-      }
-    }
-
-
-    int16_t Chase(Sprite* s, int16_t cx, int16_t cy)
-    {
-      while (cx < 0)      //  Tunneling
-        cx += 28;
-      while (cx >= 28)
-        cx -= 28;
-
-      uint8_t t = GetTile(cx, cy);
-      if (!(t == 0 || t == DOT || t == PILL || t == PENGATE))
-        return 0x7FFF;
-
-      if (t == PENGATE)
-      {
-        if (s->who == PACMAN)
-          return 0x7FFF;  // Pacman can't cross this to enter pen
-        if (!(InPen(s->cx, s->cy) || s->state == DeadEyesState))
-          return 0x7FFF;  // Can cross if dead or in pen trying to get out
-      }
-
-      int16_t dx = s->tx - cx;
-      int16_t dy = s->ty - cy;
-      return (dx * dx + dy * dy); // Distance to target
-
-    }
-
-    void UpdateTimers()
-    {
-      // Update scatter/chase selector, low bit of index indicates scatter
-      if (_scIndex < 8)
-      {
-        if (_scTimer-- == 0)
-        {
-          uint8_t duration = _scatterChase[_scIndex++];
-          _scTimer = duration * FPS;
-        }
-      }
-
-      // BONUS timmer
-      if (ACTIVEBONUS == 0 && _BonusInactiveTimmer-- == 0) {
-        _BonusActiveTimmer = BONUS_ACTIVE_TIME; //5*FPS;
-        ACTIVEBONUS = 1;
-      }
-      if (ACTIVEBONUS == 1 && _BonusActiveTimmer-- == 0) {
-        _BonusInactiveTimmer = BONUS_INACTIVE_TIME; //10*FPS;
-        ACTIVEBONUS = 0;
-      }
-
-
-      //  Release frightened ghosts
-      if (_frightenedTimer && !--_frightenedTimer)
-      {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-          Sprite* s = _sprites + i;
-          if (s->state == FrightenedState)
-          {
-            s->state = RunState;
-            s->dir = OppositeDirection(s->dir);
-          }
-        }
-      }
-    }
-
-    //  Target closes pill, run from ghosts?
-    void PacmanAI()
-    {
-      Sprite* pacman;
-      pacman = _sprites + PACMAN;
-
-      //  Chase frightened ghosts
-      //Sprite* closestGhost = NULL;
-      Sprite* frightenedGhost = NULL;
-      Sprite* closestAttackingGhost = NULL;
-      Sprite* DeadEyesStateGhost = NULL;
-      int16_t dist = 0x7FFF;
-      int16_t closestfrightenedDist = 0x7FFF;
-      int16_t closestAttackingDist = 0x7FFF;
-      for (uint8_t i = 0; i < 4; i++)
-      {
-        Sprite* s = _sprites + i;
-        int16_t d = s->Distance(pacman->cx, pacman->cy);
-        if (d < dist)
-        {
-
-          dist = d;
-          if (s->state == FrightenedState ) {
-            frightenedGhost = s;
-            closestfrightenedDist = d;
-          }
-          else {
-            closestAttackingGhost = s;
-            closestAttackingDist = d;
-          }
-          //closestGhost = s;
-
-          if ( s->state == DeadEyesState ) DeadEyesStateGhost = s;
-
-        }
-      }
-
-      PACMANFALLBACK = 0;
-
-      if (DEMO == 1 && !DeadEyesStateGhost && frightenedGhost )
-      {
-        pacman->Target(frightenedGhost->cx, frightenedGhost->cy);
-        return;
-      }
-
-
-
-      // Under threat; just avoid closest ghost
-      if (DEMO == 1 && !DeadEyesStateGhost && dist <= 32  && closestAttackingDist < closestfrightenedDist )
-      {
-        if (dist <= 16) {
-          pacman->Target( pacman->cx * 2 - closestAttackingGhost->cx, pacman->cy * 2 - closestAttackingGhost->cy);
-          PACMANFALLBACK = 1;
-        } else {
-          pacman->Target( pacman->cx * 2 - closestAttackingGhost->cx, pacman->cy * 2 - closestAttackingGhost->cy);
-        }
-        return;
-      }
-
-      if (ACTIVEBONUS == 1) {
-        pacman->Target(13, 20);
-        return;
-      }
-
-
-      //  Go for the pill
-      if (GetDot(1, 6))
-        pacman->Target(1, 6);
-      else if (GetDot(26, 6))
-        pacman->Target(26, 6);
-      else if (GetDot(1, 26))
-        pacman->Target(1, 26);
-      else if (GetDot(26, 26))
-        pacman->Target(26, 26);
-      else
-      {
-        // closest dot
-        int16_t dist = 0x7FFF;
-        for (uint8_t y = 4; y < 32; y++)
-        {
-          for (uint8_t x = 1; x < 26; x++)
-          {
-            if (GetDot(x, y))
-            {
-              int16_t d = pacman->Distance(x, y);
-              if (d < dist)
-              {
-                dist = d;
-                pacman->Target(x, y);
-              }
-            }
-          }
-        }
-
-        if (dist == 0x7FFF) {
-          GAMEWIN = 1; // No dots, GAME WIN!
-        }
-
-      }
-    }
-
-    void Scatter(Sprite* s)
-    {
-      const uint8_t* st = _scatterTargets + (s->who << 1);
-      s->Target(*st, *(st + 1));
-    }
-
-    void UpdateTargets()
-    {
-      if (_state == ReadyState)
-        return;
-      PacmanAI();
-      Sprite* pacman = _sprites + PACMAN;
-
-      //  Ghost AI
-      bool scatter = _scIndex & 1;
-      for (uint8_t i = 0; i < 4; i++)
-      {
-        Sprite* s = _sprites + i;
-
-        //  Deal with returning ghost to pen
-        if (s->state == DeadEyesState)
-        {
-          if (s->cx == 14 && s->cy == 17) // returned to pen
-          {
-            s->state = PenState;        // Revived in pen
-            s->pentimer = 80;
-          }
-          else
-            s->Target(14, 17);          // target pen
-          continue;           //
-        }
-
-        //  Release ghost from pen when timer expires
-        if (s->pentimer)
-        {
-          if (--s->pentimer)  // stay in pen for awhile
-            continue;
-          s->state = RunState;
-        }
-
-        if (InPen(s->cx, s->cy))
-        {
-          s->Target(14, 14 - 2); // Get out of pen first
-        } else {
-          if (scatter || s->state == FrightenedState)
-            Scatter(s);
-          else
-          {
-            // Chase mode targeting
-            int8_t tx = pacman->cx;
-            int8_t ty = pacman->cy;
-            switch (s->who)
-            {
-              case PINKY:
-                {
-                  const uint8_t* pto = _pinkyTargetOffset + ((pacman->dir - 1) << 1);
-                  tx += *pto;
-                  ty += *(pto + 1);
-                }
-                break;
-              case INKY:
-                {
-                  const uint8_t* pto = _pinkyTargetOffset + ((pacman->dir - 1) << 1);
-                  Sprite* binky = _sprites + BINKY;
-                  tx += *pto >> 1;
-                  ty += *(pto + 1) >> 1;
-                  tx += tx - binky->cx;
-                  ty += ty - binky->cy;
-                }
-                break;
-              case CLYDE:
-                {
-                  if (s->Distance(pacman->cx, pacman->cy) < 64)
-                  {
-                    const uint8_t* st = _scatterTargets + CLYDE * 2;
-                    tx = *st;
-                    ty = *(st + 1);
-                  }
-                }
-                break;
-            }
-            s->Target(tx, ty);
-          }
-        }
-      }
-    }
-
-    //  Default to current direction
-    uint8_t ChooseDir(int16_t dir, Sprite* s)
-    {
-      int16_t choice[4];
-      choice[0] = Chase(s, s->cx, s->cy - 1); // Up
-      choice[1] = Chase(s, s->cx - 1, s->cy); // Left
-      choice[2] = Chase(s, s->cx, s->cy + 1); // Down
-      choice[3] = Chase(s, s->cx + 1, s->cy); // Right
-
-
-      if (DEMO == 0 && s->who == PACMAN && choice[0] < 0x7FFF && but_UP) dir = MUp;
-      else if (DEMO == 0 && s->who == PACMAN && choice[1] < 0x7FFF && but_LEFT) dir = MLeft;
-      else if (DEMO == 0 && s->who == PACMAN && choice[2] < 0x7FFF && but_DOWN) dir = MDown;
-      else if (DEMO == 0 && s->who == PACMAN && choice[3] < 0x7FFF && but_RIGHT) dir = MRight;
-
-      else if (DEMO == 0 && choice[0] < 0x7FFF && s->who == PACMAN && dir == MUp) dir = MUp;
-      else if (DEMO == 0 && choice[1] < 0x7FFF && s->who == PACMAN && dir == MLeft) dir = MLeft;
-      else if (DEMO == 0 && choice[2] < 0x7FFF && s->who == PACMAN && dir == MDown) dir = MDown;
-      else if (DEMO == 0 && choice[3] < 0x7FFF && s->who == PACMAN && dir == MRight) dir = MRight;
-      else if ((DEMO == 0 && s->who != PACMAN) || DEMO == 1 ) {
-
-        // Don't choose opposite of current direction?
-
-        int16_t dist = choice[4 - dir]; // favor current direction
-        uint8_t opposite = OppositeDirection(dir);
-        for (uint8_t i = 0; i < 4; i++)
-        {
-          uint8_t d = 4 - i;
-          if ((d != opposite && choice[i] < dist) || (s->who == PACMAN && PACMANFALLBACK &&  choice[i] < dist))
-          {
-            if (s->who == PACMAN && PACMANFALLBACK) PACMANFALLBACK = 0;
-            dist = choice[i];
-            dir = d;
-          }
-
-        }
-
-      } else  {
-        dir = MStopped;
-      }
-
-      return dir;
-    }
-
-    bool InPen(uint8_t cx, uint8_t cy)
-    {
-      if (cx <= 10 || cx >= 18) return false;
-      if (cy <= 14 || cy >= 18) return false;
-      return true;
-    }
-
-    uint8_t GetSpeed(Sprite* s)
-    {
-      if (s->who == PACMAN)
-        return _frightenedTimer ? 90 : 80;
-      if (s->state == FrightenedState)
-        return 40;
-      if (s->state == DeadEyesState)
-        return 100;
-      if (s->cy == 17 && (s->cx <= 5 || s->cx > 20))
-        return 40;  // tunnel
-      return 75;
-    }
-
-    void PackmanDied() {  // Noooo... PACMAN DIED :(
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-      if (DEMO == 0) {
-        GameAudio.PlayWav(&pmDeath, true, 1.0);
-        // wait until done
-        while (GameAudio.IsPlaying());
-      }
-#endif
-      if (LIFES <= 0) {
-        GAMEOVER = 1;
-        LEVEL = START_LEVEL;
-        LIFES = START_LIFES;
-        DEMO = 1;
-        Init();
-      } else {
-        LIFES--;
-
-        _inited = true;
-        _state = ReadyState;
-        _stateTimer = FPS / 2;
-        _frightenedCount = 0;
-        _frightenedTimer = 0;
-
-        const uint8_t* s = _initSprites;
-        for (int16_t i = 0; i < 5; i++)
-          _sprites[i].Init(s + i * 5);
-
-        _scIndex = 0;
-        _scTimer = 1;
-
-        memset(_icons, 0, sizeof(_icons));
-
-        //AND BONUS
-        _BonusSprite.Init(s + 5 * 5);
-        _BonusInactiveTimmer = BONUS_INACTIVE_TIME;
-        _BonusActiveTimmer = 0;
-
-        for (uint8_t i = 0; i < ACTUALBONUS; i++) {
-          _icons[13 - i] = BONUSICON + i;
-        }
-
-        for (uint8_t i = 0; i < LIFES; i++) {
-          _icons[0 + i] = PACMANICON;
-        }
-
-        //Draw LIFE and BONUS Icons
-        for (uint8_t y = 34; y < 36; y++)
-          for (uint8_t x = 0; x < 28; x++) {
-            Draw(x, y, false);
-          }
-
-        DrawAllBG();
-      }
-    }
-
-
-    void MoveAll()
-    {
-      UpdateTimers();
-      UpdateTargets();
-
-
-      //  Update game state
-      if (_stateTimer)
-      {
-        if (--_stateTimer <= 0)
-        {
-          switch (_state)
-          {
-            case ReadyState:
-              _state = PlayState;
-              _dirty[20 * 4 + 1] |= 0x1F; // Clear 'READY!'
-              _dirty[20 * 4 + 2] |= 0x80;
-
-              for (uint8_t tmpX = 11; tmpX < 17; tmpX++) Draw(tmpX, 20, false); // ReDraw (clear) 'READY' position
-
-              break;
-            case DeadGhostState:
-              _state = PlayState;
-              for (uint8_t i = 0; i < 4; i++)
-              {
-                Sprite* s = _sprites + i;
-                if (s->state == DeadNumberState)
-                  s->state = DeadEyesState;
-              }
-              break;
-            default:
-              ;
-          }
-        } else {
-          if (_state == ReadyState)
-            return;
-        }
-      }
-
-      for (uint8_t i = 0; i < 5; i++)
-      {
-        Sprite* s = _sprites + i;
-
-        //  In DeadGhostState, only eyes move
-        if (_state == DeadGhostState && s->state != DeadEyesState)
-          continue;
-
-        //  Calculate speed
-        s->_speed += GetSpeed(s);
-        if (s->_speed < 100)
-          continue;
-        s->_speed -= 100;
-
-        s->lastx = s->_x;
-        s->lasty = s->_y;
-        s->phase++;
-
-        int16_t x = s->_x;
-        int16_t y = s->_y;
-
-
-        if ((x & 0x7) == 0 && (y & 0x7) == 0)   // cell aligned
-          s->dir = ChooseDir(s->dir, s);      // time to choose another direction
-
-
-        switch (s->dir)
-        {
-          case MLeft:     x -= SPEED; break;
-          case MRight:    x += SPEED; break;
-          case MUp:       y -= SPEED; break;
-          case MDown:     y += SPEED; break;
-          case MStopped:  break;
-        }
-
-        //  Wrap x because of tunnels
-        while (x < 0)
-          x += 224;
-        while (x >= 224)
-          x -= 224;
-
-        s->_x = x;
-        s->_y = y;
-        s->cx = (x + 4) >> 3;
-        s->cy = (y + 4) >> 3;
-
-        if (s->who == PACMAN)
-          EatDot(s->cx, s->cy);
-      }
-
-      //  Collide
-      Sprite* pacman = _sprites + PACMAN;
-
-      //  Collide with BONUS
-      Sprite* _s = &_BonusSprite;
-      if (ACTIVEBONUS == 1 && _s->cx == pacman->cx && _s->cy == pacman->cy)
-      {
-        Score(ACTUALBONUS * 50);
-        ACTUALBONUS++;
-        if (ACTUALBONUS > 7) {
-          ACTUALBONUS = 0;
-          if (LIFES < MAXLIFES) LIFES++;
-
-          //reset all icons
-          memset(_icons, 0, sizeof(_icons));
-
-          for (uint8_t i = 0; i < LIFES; i++) {
-            _icons[0 + i] = PACMANICON;
-          }
-
-        }
-
-        for (uint8_t i = 0; i < ACTUALBONUS; i++) {
-          _icons[13 - i] = BONUSICON + i;
-        }
-
-        //REDRAW LIFE and BONUS icons
-        for (uint8_t y = 34; y < 36; y++)
-          for (uint8_t x = 0; x < 28; x++) {
-            Draw(x, y, false);
-          }
-
-        ACTIVEBONUS = 0;
-        _BonusInactiveTimmer = BONUS_INACTIVE_TIME;
-      }
-
-      for (uint8_t i = 0; i < 4; i++)
-      {
-        Sprite* s = _sprites + i;
-        //if (s->cx == pacman->cx && s->cy == pacman->cy)
-        if (s->_x + SPEED >= pacman->_x && s->_x - SPEED <= pacman->_x && s->_y + SPEED >= pacman->_y && s->_y - SPEED <= pacman->_y)
-
-
-
-        {
-          if (s->state == FrightenedState)
-          {
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-            if (DEMO == 0) {
-              GameAudio.PlayWav(&pmEatGhost, true, 1.0);
-            }
-#endif
-            s->state = DeadNumberState;     // Killed a ghost
-            _frightenedCount++;
-            _state = DeadGhostState;
-            _stateTimer = 10;
-            Score((1 << _frightenedCount) * 100);
-          }
-          else {               // pacman died
-            if (s->state == DeadNumberState || s->state == FrightenedState || s->state == DeadEyesState) {
-            } else {
-              PackmanDied();
-            }
-          }
-        }
-      }
-    }
-
-    //  Mark a position dirty
-    void Mark(int16_t pos)
-    {
-      for (uint8_t tmp = 0; tmp < 28; tmp++)
-        updateMap[1][tmp] = true;
-
-    }
-
-    void SetScoreChar(uint8_t i, int8_t c)
-    {
-      if (_scoreStr[i] == c)
-        return;
-      _scoreStr[i] = c;
-      Mark(i + 32);  //Score
-      //Mark(i+32+10); //HiScore
-
-    }
-
-    void SetHiScoreChar(uint8_t i, int8_t c)
-    {
-      if (_hiscoreStr[i] == c)
-        return;
-      _hiscoreStr[i] = c;
-      //Mark(i+32);    //Score
-      Mark(i + 32 + 10); //HiScore
-    }
-
-    void Score(int16_t delta)
-    {
-      char str[8];
-      _score += delta;
-      if (DEMO == 0 && _score > _hiscore) _hiscore = _score;
-
-      if (_score > _lifescore && _score % 10000 > 0) {
-        _lifescore = (_score / 10000 + 1) * 10000;
-
-        LIFES++; // EVERY 10000 points = 1UP
-
-        for (uint8_t i = 0; i < LIFES; i++) {
-          _icons[0 + i] = PACMANICON;
-        }
-
-        //REDRAW LIFE and BONUS icons
-        for (uint8_t y = 34; y < 36; y++)
-          for (uint8_t x = 0; x < 28; x++) {
-            Draw(x, y, false);
-          }
-        _score = _score + 100;
-      }
-
-      sprintf(str, "%ld", _score);
-      uint8_t i = 7 - strlen(str);
-      uint8_t j = 0;
-      while (i < 7)
-        SetScoreChar(i++, str[j++]);
-      sprintf(str, "%ld", _hiscore);
-      i = 7 - strlen(str);
-      j = 0;
-      while (i < 7)
-        SetHiScoreChar(i++, str[j++]);
-    }
-
-    bool GetDot(uint8_t cx, uint8_t cy)
-    {
-      return _dotMap[(cy - 3) * 4 + (cx >> 3)] & (0x80 >> (cx & 7));
-    }
-
-    void EatDot(uint8_t cx, uint8_t cy)
-    {
-      if (!GetDot(cx, cy))
-        return;
-      uint8_t mask = 0x80 >> (cx & 7);
-      _dotMap[(cy - 3) * 4 + (cx >> 3)] &= ~mask;
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-      if (DEMO == 0) {
-        GameAudio.PlayWav(&pmChomp, false, 1.0);
-      }
-#endif
-      uint8_t t = GetTile(cx, cy);
-      if (t == PILL)
-      {
-        _frightenedTimer = 10 * FPS;
-        _frightenedCount = 0;
-        for (uint8_t i = 0; i < 4; i++)
-        {
-          Sprite* s = _sprites + i;
-          if (s->state == RunState)
-          {
-            s->state = FrightenedState;
-            s->dir = OppositeDirection(s->dir);
-          }
-        }
-        Score(50);
-      }
-      else
-        Score(10);
-    }
-
-    void Init()
-    {
-      drawButtonFace(4);  // START / PAUSE
-
-      if (GAMEWIN == 1) {
-        GAMEWIN = 0;
-      } else {
-        LEVEL = START_LEVEL;
-        LIFES = START_LIFES;
-        ACTUALBONUS = 0; //actual bonus icon
-        ACTIVEBONUS = 0; //status of bonus
-
-        _score = 0;
-        _lifescore = 10000;
-
-        memset(_scoreStr, 0, sizeof(_scoreStr));
-        _scoreStr[5] = _scoreStr[6] = '0';
-      }
-
-
-      _inited = true;
-      _state = ReadyState;
-      _stateTimer = FPS / 2;
-      _frightenedCount = 0;
-      _frightenedTimer = 0;
-
-      const uint8_t* s = _initSprites;
-      for (int16_t i = 0; i < 5; i++)
-        _sprites[i].Init(s + i * 5);
-
-      //AND BONUS
-      _BonusSprite.Init(s + 5 * 5);
-      _BonusInactiveTimmer = BONUS_INACTIVE_TIME;
-      _BonusActiveTimmer = 0;
-
-      _scIndex = 0;
-      _scTimer = 1;
-
-      memset(_icons, 0, sizeof(_icons));
-
-      // SET BONUS icons
-      for (uint8_t i = 0; i < ACTUALBONUS; i++) {
-        _icons[13 - i] = BONUSICON + i;
-      }
-
-      // SET Lifes icons
-      for (uint8_t i = 0; i < LIFES; i++) {
-        _icons[0 + i] = PACMANICON;
-      }
-
-      //Draw LIFE and BONUS Icons
-      for (uint8_t y = 34; y < 36; y++)
-        for (uint8_t x = 0; x < 28; x++) {
-          Draw(x, y, false);
-        }
-
-      //  Init dots from rom
-      memset(_dotMap, 0, sizeof(_dotMap));
-      uint8_t* map = _dotMap;
-      for (uint8_t y = 3; y < 36 - 3; y++) // 30 interior lines
-      {
-        for (uint8_t x = 0; x < 28; x++)
-        {
-          uint8_t t = GetTile(x, y);
-          if (t == 7 || t == 14)
-          {
-            uint8_t s = x & 7;
-            map[x >> 3] |= (0x80 >> s);
-          }
-        }
-        map += 4;
-      }
-      DrawAllBG();
-    }
-
-    void Step()
-    {
-      //int16_t keys = 0;
-
-      if (GAMEWIN == 1) {
-        LEVEL++;
-        Init();
-      }
-
-      // Start GAME
-      if (but_A && DEMO == 1 && GAMEPAUSED == 0) {
-        but_A = false;
-        DEMO = 0;
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-        GameAudio.PlayWav(&pmWav, false, 1.0);
-        // wait until done
-        //while(GameAudio.IsPlaying()){ }
-#endif
-        Init();
-      } else if (but_A && DEMO == 0 && GAMEPAUSED == 0) { // Or PAUSE GAME
-        but_A = false;
-        GAMEPAUSED = 1;
-        drawButtonFace(4);  // START / PAUSE
-      }
-
-      if (GAMEPAUSED && but_A && DEMO == 0) {
-        but_A = false;
-        GAMEPAUSED = 0;
-        drawButtonFace(4);  // START / PAUSE
-        for (uint8_t tmpX = 11; tmpX < 17; tmpX++) Draw(tmpX, 20, false);
-      }
-
-      // Reset / Start GAME
-      if (but_B) {
-        but_B = false;
-        DEMO = 0;
-        Init();
-      } else if (!_inited) {
-        but_B = false;
-        DEMO = 1;
-        Init();
-      }
-
-      // Create a bitmap of dirty tiles
-      uint8_t m[(32 / 8) * 36]; // 144 bytes
-      memset(m, 0, sizeof(m));
-      _dirty = m;
-
-
-      if (!GAMEPAUSED) MoveAll(); // IF GAME is PAUSED STOP ALL
-
-      if ((ACTIVEBONUS == 0 && DEMO == 1) || GAMEPAUSED == 1 ) for (uint8_t tmpX = 11; tmpX < 17; tmpX++) Draw(tmpX, 20, false); // Draw 'PAUSED' or 'DEMO' text
-
-      DrawAll();
-    }
-};
-
-/******************************************************************************/
-/*   SETUP                                                                    */
-/******************************************************************************/
-
-#define BLACK 0x0000 // 16bit BLACK Color
-
-/******************************************************************************/
-/*   LOOP                                                                     */
-/******************************************************************************/
-
-void ClearKeys() {
-  but_A = false;
-  but_B = false;
-  but_UP = false;
-  but_DOWN = false;
-  but_LEFT = false;
-  but_RIGHT = false;
-}
-
-/*
-  static IRAM_ATTR bool lvgl_read_cb(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
-  {
-    static uint8_t tp_num = 0;
-    static uint16_t x = 0, y = 0;
-
-    touchPadRead(&tp_num, &x, &y);
-
-    if (0 == tp_num) {
-        data->state = LV_INDEV_STATE_REL;
-    } else {
-        // Swap xy order and invert y direction
-        data->point.x = y;
-        data->point.y = LV_VER_RES_MAX - x - 1;
-        data->state = LV_INDEV_STATE_PR;
-    }
-
-    return false;
-  }
-*/
-
-/*
-  void KeyPadLoop(){
-  if (Serial.available()) {
-    uint8_t r = Serial.read();
-    if (r == 'z') { ClearKeys();  but_A=true; delay(300); } //else but_A=false;
-    if (r == 'x') { ClearKeys();  but_B=true; delay(300); }  else but_B=false;
-    if (r == '8') { ClearKeys();  but_UP=true; }  //else but_UP=false;
-    if (r == '2') { ClearKeys();  but_DOWN=true; }  //else but_DOWN=false;
-    if (r == '4') { ClearKeys();  but_LEFT=true; }  // else but_LEFT=false;
-    if (r == '6') { ClearKeys();  but_RIGHT=true; }  //else but_RIGHT=false;
-  }
-  if (udp.parsePacket()) {
-    uint8_t r = udp.read();
-    if (r == 'z') { ClearKeys();  but_A=true; delay(300); } //else but_A=false;
-    if (r == 'x') { ClearKeys();  but_B=true; delay(300); }  else but_B=false;
-    if (r == '8') { ClearKeys();  but_UP=true; }  //else but_UP=false;
-    if (r == '2') { ClearKeys();  but_DOWN=true; }  //else but_DOWN=false;
-    if (r == '4') { ClearKeys();  but_LEFT=true; }  // else but_LEFT=false;
-    if (r == '6') { ClearKeys();  but_RIGHT=true; }  //else but_RIGHT=false;
-  }
-  }
-*/
-
-Playfield _game;
-
-void drawIndexedmap(uint8_t* indexmap, uint16_t x, uint16_t y) {
-  //x += (240 - 224) / 2;
-  //y += (320 - 288) / 2;
-
-  uint8_t i = 0;
-  static uint16_t screenBuffer[16*16];
-  //memset(screenBuffer, 0, 16*16*2);
-
-  for (uint8_t tmpY = 0; tmpY < 8; tmpY++) {
-    for (uint8_t tmpX = 0; tmpX < 8; tmpX++) {
-      // rotate the screen 90 counterclockwise considering image duplication
-      uint16_t xt = 2 * tmpY;
-      uint16_t yt = 14 - 2 * tmpX;
-
-      // duplicate width and height of the game screen (240x320 ==> 480x640)
-      screenBuffer[xt + yt * 16] =  screenBuffer[xt + 1 + yt * 16] = 
-      screenBuffer[xt + (yt + 1) * 16] = screenBuffer[xt + 1 + (yt + 1) * 16] = _paletteW[indexmap[i]];
-      i++;
-    }
-  }
-  // rotate the screen 90 counterclockwise considering image duplication
-  uint16_t xt = 2 * y;
-  uint16_t yt = SCR_HEIGHT - 2 * (x + 8);
-   
-  bsp_lcd_flush(xt, yt, xt + 16, yt + 16, (void *) screenBuffer);
-  
-}
-
-// Rotated dimensions based on a SCR_w = 480 and SCR_H = 800
-//#define BUT_W       100
-//#define BUT_H       55
-#define BUT_NUM     5      // removed BUT B = reset
-#define BUT_X       0
-#define BUT_Y       1
-#define BUT_COLOR   2
-#define BUT_W       3
-#define BUT_H       4
-
-uint32_t debounceTimeStart = 0;
-
-const uint16_t buttons[BUT_NUM][5] = {
-  // Using rotated coordintes the same way that the touch sensor does
-  // X0 is 0 .. SCR_HEIGHT -1
-  // Y0 is 0 .. SCR_WIDTH - 1
-  //X0   Y0    color          W    H
-  { 255, 610, _paletteW[15], 100, 55},  // UP
-  { 370, 675, _paletteW[15], 100, 55},  // LEFT
-  { 140, 675, _paletteW[15], 100, 55},  // RIGHT
-  { 255, 740, _paletteW[15], 100, 55},  // DOWN
-  { 0,   620, _paletteW[6],  60,  60},   // A
-  /*
-    { 610, 255, _paletteW[15], 100, 55},  // UP
-    { 675, 370, _paletteW[15], 100, 55},  // LEFT
-    { 675, 140, _paletteW[15], 100, 55},  // RIGHT
-    { 740, 255, _paletteW[15], 100, 55},  // DOWN
-    { 620,   0, _paletteW[6],  60,  60},   // A
-  */
-  //  { 10,  640, _paletteW[6]},   // A
-  //  { 10,  740, _paletteW[1]},   // B
-};
-
-int8_t getTouchedButton(uint16_t x, uint16_t y) {
-  // ft5x06 driver inverts X coordinate and also rotates it
-  uint8_t delta = 15;
-  //x = SCR_HEIGHT - 1 - x;
-  int8_t pressedButton = -1;
-  for (uint8_t b = 0; b < BUT_NUM; b++) {
-    if (b > BUT_NUM - 1) delta = 0; // Buttons A and B are not "expanded" in the touch area
-    if (x >= buttons[b][BUT_X] - delta && x < buttons[b][BUT_X] + buttons[b][BUT_W] + delta
-        && y >= buttons[b][BUT_Y] - delta && y < buttons[b][BUT_Y] + buttons[b][BUT_H] + delta) {
-      pressedButton = b;
-      break;
-    }
-  }
-  return pressedButton;
-}
-
-void drawButtonFace(uint8_t btId) {
-  // rotate the coordinates by sawpping X & Y
-  uint16_t x0 = buttons[btId][BUT_Y];
-  uint16_t y0 = buttons[btId][BUT_X];
-
-  uint16_t _w = buttons[btId][BUT_H], _h = buttons[btId][BUT_W];
-  uint8_t r = min(_w, _h) / 4; // Corner radius
-  int16_t _x1 = 0, _y1 = 0;
-
-  size_t canvasSize = _w * _h * sizeof(uint16_t);
-  uint16_t *canvas = (uint16_t *)heap_caps_malloc(canvasSize, MALLOC_CAP_8BIT);
-  if (canvas == NULL) {
-    printf("Memeory Allocation error in drawButtonFace()\n");
-    return;
-  } 
-  memset(canvas, 0, canvasSize);
-  tft16bits.setBuffer(canvas);
-  tft16bits.setWidthHeight(_w, _h);
-
-  tft16bits.fillRoundRect(_x1, _y1, _w, _h, r, buttons[btId][BUT_COLOR]);
-
-  switch (btId) {
-    case 0:   // UP
-      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
-      tft16bits.fillTriangle(_x1 + 10, _y1 + _h / 2, _x1 + _w - 15, _y1 + _h / 2 + 20, _x1 + _w - 15, _y1 + _h / 2 - 20, BLACK);
-      //tft16bits.fillRect(_x1 + 10, _y1 + _h / 2, 4, 4, RED);
-      //tft16bits.fillRect(_x1 + _w - 15, _y1 + _h / 2 + 20, 4, 4, BLUE);
-      //tft16bits.fillRect(_x1 + _w - 15, _y1 + _h / 2 - 20, 4, 4, BLACK);
-      break;
-    case 1:   // LEFT
-      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
-      tft16bits.fillTriangle(_x1 + _w - 15, _y1 + _h / 2 - 15, _x1 + 10, _y1 + _h / 2 - 15, _x1 + _w / 2, _y1 + _h / 2 + 20, BLACK);
-      //tft16bits.fillRect(_x1 + _w - 15, _y1 + _h / 2 - 15, 4, 4, RED);
-      //tft16bits.fillRect(_x1 + 10, _y1 + _h / 2 - 15, 4, 4, BLUE);
-      //tft16bits.fillRect(_x1 + _w / 2, _y1 + _h / 2 + 20, 4, 4, BLACK);
-      break;
-    case 2:   // RIGHT
-      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
-      tft16bits.fillTriangle(_x1 + _w - 15, _y1 + _h / 2 + 15, _x1 + 10, _y1 + _h / 2 + 15, _x1 + _w / 2, _y1 + _h / 2 - 20, BLACK);
-      break;
-    case 3:   // DOWN
-      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
-      tft16bits.fillTriangle(_x1 + _w - 10, _y1 + _h / 2, _x1 + 15, _y1 + _h / 2 + 20, _x1 + 15, _y1 + _h / 2 - 20, BLACK);
-      break;
-    case 4:   // START/PAUSE
-      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, CYAN);
-      if (DEMO == 1 || GAMEPAUSED == 1) {
-        // Button Action is PLAY
-        tft16bits.fillTriangle(_x1 + _w - 10, _y1 + _h / 2 + 15, _x1 + 10, _y1 + _h / 2 + 15, _x1 + _w / 2, _y1 + _h / 2 - 20, RED);
-      } else if (GAMEPAUSED == 0) {
-        // Button Action is PAUSE
-        tft16bits.fillRect(_x1 + 10, _y1 + _h / 2 + 4, 40, 15, RED);
-        tft16bits.fillRect(_x1 + 10, _y1 + 10, 40, 15, RED);
-      }
-      break;
-  }
-  _x1 = x0 + _w;
-  _y1 = y0 + _h;
-  bsp_lcd_flush(x0, y0, _x1, _y1, (void *)canvas);
-  //delay(1);  // we don't check when it finishes drawing... so just wait few ms
-  free(canvas);
-}
-
-void drawAllButtons() {
-  for (uint8_t b = 0; b < BUT_NUM; b++) {
-#if 1
-    drawButtonFace(b);
-#else
-    // just rectagles as button - testing
-    for (uint16_t y1 = 0; y1 < buttons[b][BUT_W]; y1++)
-      for (uint16_t x1 = 0; x1 < buttons[b][BUT_H]; x1++) {
-        screenBuffer[x0 + x1 + (y0 + y1) * SCR_WIDTH] = buttons[b][BUT_COLOR];
-      }
-#endif
-  }
-}
-
-void setup() {
-  lcd_driver_install();
-  
-/*
-// ===> POR ALGUM MOTIVO alocar o PSRAM buffer aqui gera um ERRO no APP todo...
-  if (!tft16bits.createPSRAMFrameBuffer()) {
-    log_e("Can't allocate the screen buffer - check PSRAM.");
-    while (1);
-  }
-  screenBuffer = tft16bits.getBuffer();
-  //tft16bits.setRotation(3);
-*/
-
-#if 0
-  // clear screen with black
-  for (uint32_t i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++)
-    screenBuffer[i] = 0;
-  printf("\n\nCLEAR SCREEN...");
-  bsp_lcd_flush(0, 0, SCR_WIDTH - 1, SCR_HEIGHT - 1, (void *)screenBuffer);
-  printf("\n\nCLEAR SCREEN... DONE!");
-  delay(2000);
-  printf("\nNExT...");
-#endif
-#if 0
-{
-  printf("\n Drawing again...START!\n");
-  uint16_t tile[64];
-  int xs = BOARD_DISP_PARALLEL_HRES / 8;
-  int ys = BOARD_DISP_PARALLEL_VRES / 8;
-  for (int y = 0; y < ys; y++)
-    for (int x = 0; x < xs; x++) {
-       uint16_t color = (y<<5) + (x<<1);
-       memset(tile, color, sizeof(tile));
-       //printf("drawing (%d, %d) color %x in screen\n===============\n", x*8, y*8, color);
-       //bsp_lcd_flush(x * 8, y * 8, 8, 8, (void *)tile);
-       bsp_lcd_flush( x * 8, y * 8, x * 8 + 8, y * 8 + 8, (void *)tile);
-
-    }
-  printf("\n Drawing again...DONE!\n");
-  //delay(3000);
-}
-#endif
-#if 0
-  printf("\n NOVO REDESENHO DA TELA...\n");
-  uint16_t tile[64];
-  memset(tile, 0, sizeof(tile));
-  int xs = SCR_WIDTH / 8;
-  int ys = SCR_HEIGHT / 8;
-  for (int y = 0; y < ys; y++)
-    for (int x = 0; x < xs; x++) {
-       //uint16_t color = (y<<6) + x;
-       //memset(tile, color, sizeof(tile));
-       //printf("\ndrawing (%d, %d) color %x in screen\n===============", x*8, y*8, 0);
-       //lcd_parallel8080_draw(lcd_parallel8080, x * 8, y * 8, x * 8 + 7, y * 8 + 7, (void *)tile);
-       bsp_lcd_flush(x * 8, y * 8, x * 8 + 8, y * 8 + 8, (void *)tile);
-    }
-  printf("\n\nCLEAR SCREEN... DONE ==> using rectangles... !");
-  //delay(5000);
-#endif
-  // Draw touch screen buttons
-  drawAllButtons();
-  //  drawButton(_paletteW[15], 620, 255);  // UP
-  //  drawButton(_paletteW[15], 680, 370);  // LEFT
-  //  drawButton(_paletteW[15], 680, 140);  // RIGHT
-  //  drawButton(_paletteW[15], 740, 255);  // DOWN
-
-  //  drawButton(_paletteW[6], 640, 10);  // A
-  //  drawButton(_paletteW[1], 720, 10);  // B
-
-  //printf("\n====================\nPacman DEMO -- Starting.\n\n");
-
-#if 0
-#if(BOARD_TYPE == BOARD_TYPE_HMI)
-  // Testing Audio System and Game Snd Fx
-  // Game_Audio_Wav_Class pointer, Shall Interrupt Current sound, float sampleRateMultiplier
-  delay(500); GameAudio.PlayWav(&pmChomp, false, 1.0);
-  while (GameAudio.IsPlaying());  // wait until done
-  delay(500); GameAudio.PlayWav(&pmWav, false, 1.0);
-  while (GameAudio.IsPlaying());  // wait until done
-  delay(500); GameAudio.PlayWav(&pmDeath, true, 1.0);
-  while (GameAudio.IsPlaying());  // wait until done
-  delay(500); GameAudio.PlayWav(&pmEatGhost, true, 1.0);
-  while (GameAudio.IsPlaying());  // wait until done
-#endif
-#endif
-}
-
-void loop() {
-  static uint32_t lastTime = 0;
-  // calculate next game screen, considering Player interaction and game speed
-  if (millis() > lastTime) {
-    lastTime = millis() + 34; //34;
-    _game.Step();
-  }
-  // copies ScrBuf to LCD
-  //bsp_lcd_flush(0, 0, SCR_WIDTH - 1, SCR_HEIGHT - 1, (void *)screenBuffer);
-  // checks Player interaction with TouchScreen
-  uint8_t numTouchedPoints = 0;
-  uint16_t scrTouchX = 0, scrTouchY = 0;
-  if (touchPadRead(&numTouchedPoints, &scrTouchX, &scrTouchY) == ESP_OK) {
-    //    Serial.printf("-- We got %d touched points...", numTouchedPoints);
-    if (numTouchedPoints > 0) {
-      int8_t pressedButton = getTouchedButton(scrTouchX, scrTouchY);
-      //printf("X = %d | Y = %d -- BUTTON = %d\n", scrTouchX, scrTouchY, pressedButton);
-      switch (pressedButton) {
-        case 0:
-          ClearKeys();
-          but_UP = true;
-          break;
-        case 1:
-          ClearKeys();
-          but_LEFT = true;
-          break;
-        case 2:
-          ClearKeys();
-          but_RIGHT = true;
-          break;
-        case 3:
-          ClearKeys();
-          but_DOWN = true;
-          break;
-        case 4:
-          if (debounceTimeStart < millis()) {
-            debounceTimeStart = millis() + 250;
-            but_A = true;
-          }
-          break;
-        case 5:
-          if (debounceTimeStart < millis()) {
-            debounceTimeStart = millis() + 250;
-            but_B = true;
-          }
-          break;
-      }
-    }
-  }
-}
+/******************************************************************************/
+/*                                                                            */
+/*  PACMAN GAME FOR ARDUINO DUE                                               */
+/*                                                                            */
+/******************************************************************************/
+/*  Copyright (c) 2014  Dr. NCX (mirracle.mxx@gmail.com)                      */
+/*                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL              */
+/* WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED              */
+/* WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR    */
+/* BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES      */
+/* OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,     */
+/* WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,     */
+/* ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS        */
+/* SOFTWARE.                                                                  */
+/*                                                                            */
+/*  MIT license, all text above must be included in any redistribution.       */
+
+
+/*
+    Controller configuration:
+    Buttons UP, RIGHT, DOWN, LEFT, START/PAUSE and RESTART are each assigned on characters '8', '6', '2', '4', 'z', 'x' in the both case of SerialPort and WiFi UDP.
+    See input_remote.h for the packet format and how to enable UDP.
+*/
+
+/******************************************************************************/
+/*   MAIN GAME VARIABLES                                                      */
+/******************************************************************************/
+
+// Headless: the game logic alone, built for the host with no display, touch or audio, e.g.
+//   g++ -O2 -pthread -DPACMAN_HEADLESS=1 -Imain/input main/pacman.ino.cpp -o pacman_headless
+// It runs demo games as fast as it can, one or a batch on all cores, and reports frames per second
+// and a state hash, see main().
+#ifndef PACMAN_HEADLESS
+#define PACMAN_HEADLESS 0
+#endif
+
+#if PACMAN_HEADLESS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "input.h"
+
+typedef bool boolean;
+#define BOARD_TYPE_HMI 1
+#define BOARD_TYPE 0
+
+void flushTiles();
+void probeTiles(uint32_t t_us);
+void drawIndexedmap(uint8_t* indexmap, uint16_t x, uint16_t y);
+void drawButtonFace(uint8_t btId, bool play = true);
+class InputReplay;
+void replayDump(InputReplay& replay);
+bool headlessInputPop(input_event_t* ev);
+void headlessTurn(uint32_t ticks);
+uint64_t headlessNs();
+#else
+#include "Arduino.h"
+
+//#include <stdio.h>
+//#include <string.h>
+//#include "sdkconfig.h"
+
+//#include "freertos/FreeRTOS.h"
+//#include "freertos/semphr.h"
+
+//#include "esp_heap_caps.h"
+//#include "esp_log.h"
+
+//#include "driver/gpio.h"
+//#include "driver/i2c.h"
+#include "board.h"
+#if 0
+#include "lcd.h"
+#if (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_GT911)
+#include "esp_lcd_touch_gt911.h"
+#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_TT21100)
+#include "esp_lcd_touch_tt21100.h"
+#elif (BOARD_DISP_TOUCH_CONTROLLER == BOARD_DISP_TOUCH_FT5X06)
+#include "esp_lcd_touch_ft5x06.h"
+#endif
+#endif
+
+#include "bsp.h"
+#include "input.h"
+#include "input_remote.h"
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+#include "Game_Audio.h"
+#include "SoundData.h"
+#endif
+#include "TFT_16bits.h"
+
+#if 0
+#if !CONFIG_IDF_TARGET_ESP32S2
+#error This Sketch is inteded to run on ESP32-S2 HMI Devkit - Select "ESP32S2 Dev Module" board.
+#endif
+
+#if !CONFIG_SPIRAM
+#error This sketch MUST use PSRAM, please enable it in the IDE Menu
+#endif
+#endif
+
+#define SCR_WIDTH     BOARD_DISP_TOUCH_HRES
+#define SCR_HEIGHT    BOARD_DISP_TOUCH_VRES
+
+#define GPIO_DAC_OUT (GPIO_NUM_18)   // ESP32S2 DAC is 17/18 | ESP32 is 25/26 | ESP32S3 has NO DAC... DeltaSigma needed to generate a PDM waveform
+
+void drawIndexedmap(uint8_t* indexmap, uint16_t x, uint16_t y);
+void flushTiles();
+void probeTiles(uint32_t t_us);
+void drawButtonFace(uint8_t btId, bool play = true);
+class InputReplay;
+void replayDump(InputReplay& replay);
+void  bsp_lcd_flush(int x0, int y0, int x1, int y1, void *pixels);
+
+// creates a GFX object for drawing and allocating PSRAM for Screen Buffer
+TFT_16bits tft16bits(SCR_WIDTH, SCR_HEIGHT);
+
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+Game_Audio_Class GameAudio(GPIO_DAC_OUT, 0); // GPIO25/26 ESP32 || GPIO17/18 ESP32-S2 -- TIMER number 1
+Game_Audio_Wav_Class pmDeath(pacmanDeath); // pacman dyingsound
+Game_Audio_Wav_Class pmWav(pacman); // pacman theme
+Game_Audio_Wav_Class pmChomp(chomp); // pacman chomp
+Game_Audio_Wav_Class pmEatGhost(pacman_eatghost); // pacman theme
+#endif
+#endif // PACMAN_HEADLESS
+
+#define BLACK   0x0000
+#define BLUE    0x001F
+#define RED     0xF800
+#define GREEN   0x07E0
+#define CYAN    0x07FF
+#define MAGENTA 0xF81F
+#define YELLOW  0xFFE0
+#define WHITE   0xFFFF
+
+#if PACMAN_HEADLESS
+// R5 G6 B5, nothing is displayed
+#define C16(_rr,_gg,_bb) ((uint16_t)(((_rr & 0xF8) << 8) | ((_gg & 0xFC) << 3) | ((_bb & 0xF8) >> 3)))
+#elif (BOARD_DISP_PARALLEL_CONTROLLER == BOARD_DISP_LCD_RM68120)
+// R5 G6 B5 for RM68120
+#define C16(_rr,_gg,_bb) ((uint16_t)(((_rr & 0xF8) << 8) | ((_gg & 0xFC) << 3) | ((_bb & 0xF8) >> 3)))
+#elif (BOARD_DISP_PARALLEL_CONTROLLER == BOARD_DISP_LCD_RA8875)
+// B5 R5 G6 for RA8875
+#define C16(_rr,_gg,_bb) ((uint16_t)(((_bb & 0xF8) << 8) | ((_rr & 0xF8) << 3) | ((_gg & 0xFC) >> 2)))
+#elif (BOARD_DISP_RGB_WIDTH > 0)
+// R5 G6 B5 for RGB panels
+#define C16(_rr,_gg,_bb) ((uint16_t)(((_rr & 0xF8) << 8) | ((_gg & 0xFC) << 3) | ((_bb & 0xF8) >> 3)))
+#elif (BOARD_DISP_SPI_CONTROLLER > 0)
+// R5 G6 B5 byte swapped for SPI panels (high byte is sent first)
+#define C16(_rr,_gg,_bb) ((uint16_t)((((_gg & 0x1C) << 11) | ((_bb & 0xF8) << 5)) | ((_rr & 0xF8) | ((_gg & 0xE0) >> 5))))
+#endif
+
+const uint16_t _paletteW[16] =
+{
+  C16(0, 0, 0),
+  C16(255, 0, 0),      // 1 red
+  C16(222, 151, 81),   // 2 brown
+  C16(255, 0, 255),    // 3 pink
+
+  C16(0, 0, 0),
+  C16(0, 255, 255),    // 5 cyan
+  C16(71, 84, 255),    // 6 mid blue
+  C16(255, 184, 81),   // 7 lt brown
+
+  C16(0, 0, 0),
+  C16(255, 255, 0),    // 9 yellow
+  C16(0, 0, 0),
+  C16(33, 33, 255),    // 11 blue
+
+  C16(0, 255, 0),      // 12 green
+  C16(71, 84, 174),    // 13 aqua
+  C16(255, 184, 174),  // 14 lt pink
+  C16(222, 222, 255),  // 15 whiteish
+};
+
+/*
+uint8_t colors[] = {
+  0,   0,   0,
+  255, 0,   0,
+  222, 151, 81,
+  255, 0,   255,
+  0,   0,   0,
+  0,   255, 255,
+  71,  84,  255,
+  255, 184, 81,
+  0,   0,   0,
+  255, 255, 0,
+  0,   0,   0,
+  33,  33,  255,
+  0,   255, 0,
+  71,  84,  174,
+  255, 184, 174,
+  222, 222, 255,
+};
+*/
+
+uint8_t SPEED = 2; // 1=SLOW 2=NORMAL 4=FAST //do not try  other values!!!
+
+
+#define BONUS_INACTIVE_TIME 600
+#define BONUS_ACTIVE_TIME 300
+
+#define START_LIFES 2
+#define START_LEVEL 1
+
+uint8_t MAXLIFES = 5;
+
+uint8_t HUDONI2C = 0;     // score, lifes and DEMO/PAUSED go to the I2C display instead of rows 1, 20 and 34-35
+
+// LIFES, LEVEL, DEMO, the buttons and everything else a game changes are members of Playfield,
+// one set per game
+
+/******************************************************************************/
+/*   Controll KEYPAD LOOP                                                     */
+/******************************************************************************/
+
+// Direction presses are buffered per direction: a turn asked for before the junction is taken there,
+// unless the press is older than TURN_BUFFER_TICKS game ticks
+#define TURN_BUFFER_TICKS 16      // ~270 ms
+#define CORNER_PIXELS     3       // a turn can start this far before the cell center (arcade cornering)
+
+#define LAT_REPORT_TURNS  16      // touch to photon histogram printed every LAT_REPORT_TURNS turns
+
+/******************************************************************************/
+/*   GAME VARIABLES AND DEFINITIONS                                           */
+/******************************************************************************/
+
+#include "pacmanTiles.h"
+
+enum GameState {
+  ReadyState,
+  PlayState,
+  DeadGhostState, // Player got a ghost, show score sprite and only move eyes
+  DeadPlayerState,
+  EndLevelState
+};
+
+enum SpriteState
+{
+  PenState,
+  RunState,
+  FrightenedState,
+  DeadNumberState,
+  DeadEyesState,
+  AteDotState,    // pacman
+  DeadPacmanState
+};
+
+enum {
+  MStopped = 0,
+  MRight = 1,
+  MDown = 2,
+  MLeft = 3,
+  MUp = 4,
+};
+
+#define ushort uint16_t
+
+#define BINKY 0
+#define PINKY 1
+#define INKY  2
+#define CLYDE 3
+#define PACMAN 4
+#define BONUS 5
+#define NOSPRITE 0xFF
+
+//  who, cx, cy, time in the pen (1/10 s), dir
+const uint8_t _initSprites[] =
+{
+  BINKY,  14,     17 - 3,  10, MLeft,
+  PINKY,  14 - 2, 17,      26, MLeft,
+  INKY,   14,     17,      46, MLeft,
+  CLYDE,  14 + 2, 17,      68, MRight,
+  PACMAN, 14,     17 + 9,   0, MLeft,
+  BONUS,  14,     17 + 3,   0, MLeft,
+};
+
+//  Ghost colors
+const uint8_t _palette2[] =
+{
+  0, 11, 1, 15,  // BINKY red
+  0, 11, 3, 15,  // PINKY pink
+  0, 11, 5, 15,  // INKY cyan
+  0, 11, 7, 15,  // CLYDE brown
+  0, 11, 9, 9,   // PACMAN yellow
+  0, 11, 15, 15, // FRIGHTENED
+  0, 11, 0, 15,  // DEADEYES
+
+  0, 1, 15, 2,   // cherry
+  0, 1, 15, 12,  // strawberry
+  0, 7, 2, 12,   // peach
+  0, 9, 15, 0,   // bell
+
+  0, 15, 1, 2,   // apple
+  0, 12, 15, 5,  // grape
+  0, 11, 9, 1,   // galaxian
+  0, 5, 15, 15,  // key
+
+};
+
+const uint8_t _paletteIcon2[] =
+{
+  0, 9, 9, 9, // PACMAN
+
+  0, 2,  15, 1,  // cherry
+  0, 12, 15, 1,  // strawberry
+  0, 12, 2,  7,  // peach
+  0, 0,  15, 9,  // bell
+
+  0, 2,  15, 1,  // apple
+  0, 12, 15, 5,  // grape
+  0, 1,  9,  11, // galaxian
+  0, 5,  15, 15, // key
+};
+
+#define PACMANICON 1
+#define BONUSICON 2
+
+#define FRIGHTENEDPALETTE 5
+#define DEADEYESPALETTE 6
+
+#define BONUSPALETTE 7
+
+#define FPS 60           // simulation ticks per second, see loop()
+#define MOVE_COST 200    // GetSpeed() is per tick in % of a move: 100% moves every other tick, the pace the game was tuned for
+#define CHASE 0
+#define SCATTER 1
+
+#define DOT 7
+#define PILL 14
+#define PENGATE 0x1B
+
+//  Navigation table bits of a cell, per direction MRight..MUp
+#define NAV_OPEN(_d) (1 << ((_d) - 1))      // neighbor cell is walkable
+#define NAV_GATE(_d) (0x10 << ((_d) - 1))   // neighbor cell is the pen gate
+#define NAV_TUNNEL 0x100                    // tunnel, ghosts slow down
+
+//  Distance fields: steps along the maze to the nearest source, built per level
+#define FIELD_PEN 0         // pen, for DeadEyes ghosts (crosses the gate)
+#define FIELD_SCATTER 1     // + ghost, its scatter corner
+#define FIELD_DOTS 5        // remaining dots, for the demo Pacman
+#define FIELDS 6
+#define FIELD_NONE 0xFF     // sprite heads for its target
+#define FIELD_INF 0xFF      // not reachable
+
+const uint8_t _opposite[] = { MStopped, MLeft, MUp, MRight, MDown };
+#define OppositeDirection(_x) *(_opposite + _x)
+const uint8_t _buttonDir[] = { MUp, MLeft, MRight, MDown };   // by INPUT_BUTTON_UP .. INPUT_BUTTON_DOWN
+const int8_t _dirX[] = { 0, 1, 0, -1, 0 };
+const int8_t _dirY[] = { 0, 0, 1, 0, -1 };
+
+const uint8_t _scatterChase[] = { 7, 20, 7, 20, 5, 20, 5, 0 };
+const uint8_t _scatterTargets[] = { 2, 0, 25, 0, 0, 35, 27, 35 }; // inky/clyde scatter targets are backwards
+const uint8_t _pinkyTargetOffset[] = { 4, 0, 0, 4, (uint8_t) - 4, 0, (uint8_t) - 4, 4 }; // Includes pinky target bug
+
+#define FRIGHTENEDGHOSTSPRITE 0
+#define GHOSTSPRITE 2
+#define NUMBERSPRITE 10
+#define PACMANSPRITE 14
+
+const uint8_t _pacLeftAnim[] = { 5, 6, 5, 4 };
+const uint8_t _pacRightAnim[] = { 2, 0, 2, 4 };
+const uint8_t _pacVAnim[] = { 4, 3, 1, 3 };
+
+/******************************************************************************/
+/*   GAME - Sprite Table                                                      */
+/******************************************************************************/
+
+// All sprites, one array per field, indexed by who (BINKY .. PACMAN, BONUS). The fields are grouped
+// by the loops that walk them: Advance() (speed, direction and step in one pass, where the sprites
+// that stay cost a compare) and Touching() (no branches) in MoveAll().
+template <uint16_t N> struct SpriteTable
+{
+    // Movement, every tick
+    int16_t x[N], y[N];
+    uint8_t cx[N], cy[N];       // cell x and y
+    uint16_t speed[N];          // move credit, see MOVE_COST
+    uint8_t dir[N];
+    uint8_t moves[N];           // 1 when it moves in this tick
+    uint8_t hit[N];             // set by Touching()
+    uint8_t phase[N];           // counts moves, for the animation
+
+    // AI
+    uint8_t tx[N], ty[N];       // target x and y
+    uint8_t field[N];           // distance field followed instead of the target, FIELD_NONE
+    uint8_t state[N];           // SpriteState
+    uint16_t pentimer[N];       // ticks left in the pen
+
+    // Drawing
+    int16_t lastx[N], lasty[N]; // last drawn
+    uint8_t palette2[N];        // 4->16 color map index
+    uint8_t bits[N];            // index of sprite bits
+    int8_t sy[N];
+
+    // who, cx, cy, time in the pen (1/10 s), dir
+    void Init(uint8_t i, const uint8_t* s)
+    {
+      s++;
+      cx[i] = *s++;
+      cy[i] = *s++;
+      pentimer[i] = *s++ * FPS / 10;
+      dir[i] = *s;
+      x[i] = lastx[i] = (int16_t)cx[i] * 8 - 4;
+      y[i] = lasty[i] = (int16_t)cy[i] * 8;
+      state[i] = PenState;
+      speed[i] = 0;
+    }
+
+    void Target(uint8_t i, uint8_t x, uint8_t y)
+    {
+      tx[i] = x;
+      ty[i] = y;
+      field[i] = FIELD_NONE;
+    }
+
+    void Follow(uint8_t i, uint8_t f)
+    {
+      field[i] = f;
+    }
+
+    int16_t Distance(uint8_t i, uint8_t x, uint8_t y)
+    {
+      int16_t dx = cx[i] - x;
+      int16_t dy = cy[i] - y;
+      return dx * dx + dy * dy; // Distance to target
+    }
+
+    //  Sprites 0 .. n-1: the credit grows by gain(i), a sprite that reaches MOVE_COST takes turn(i)
+    //  as its direction and goes step pixels along it, x wraps because of tunnels
+    template <class Gain, class Turn> void Advance(uint16_t n, int16_t step, Gain gain, Turn turn)
+    {
+      for (uint16_t i = 0; i < n; i++)
+      {
+        uint16_t s = speed[i] + gain(i);
+        moves[i] = s >= MOVE_COST;
+        if (!moves[i])
+        {
+          speed[i] = s;
+          continue;
+        }
+        speed[i] = s - MOVE_COST;
+        phase[i]++;
+        uint8_t d = dir[i] = turn(i);
+        int16_t nx = x[i] + _dirX[d] * step;
+        int16_t ny = y[i] + _dirY[d] * step;
+        nx += (nx < 0) ? 224 : 0;
+        nx -= (nx >= 224) ? 224 : 0;
+        x[i] = nx;
+        y[i] = ny;
+        cx[i] = (nx + 4) >> 3;
+        cy[i] = (ny + 4) >> 3;
+      }
+    }
+
+    //  Sprites 0 .. n-1 within step pixels of (px, py) on both axes
+    void Touching(uint16_t n, int16_t px, int16_t py, int16_t step)
+    {
+      for (uint16_t i = 0; i < n; i++)
+        hit[i] = ((uint16_t)(x[i] - px + step) <= (uint16_t)(2 * step)) & ((uint16_t)(y[i] - py + step) <= (uint16_t)(2 * step));
+    }
+
+    //  once per sprite, not 9 times
+    void SetupDraw(uint8_t i, GameState gameState, uint8_t deadGhostIndex, uint8_t bonus)
+    {
+      sy[i] = 1;
+      palette2[i] = i;
+      uint8_t p = phase[i] >> 3;
+
+      if (i == BONUS) {
+        //BONUS ICONS
+        bits[i] = 21 + bonus;
+        palette2[i] = BONUSPALETTE + bonus;
+        return;
+      }
+
+      if (i != PACMAN)
+      {
+        bits[i] = GHOSTSPRITE + ((dir[i] - 1) << 1) + (p & 1); // Ghosts
+        switch (state[i])
+        {
+          case FrightenedState:
+            bits[i] = FRIGHTENEDGHOSTSPRITE + (p & 1); // frightened
+            palette2[i] = FRIGHTENEDPALETTE;
+            break;
+          case DeadNumberState:
+            palette2[i] = FRIGHTENEDPALETTE;
+            bits[i] = NUMBERSPRITE + deadGhostIndex;
+            break;
+          case DeadEyesState:
+            palette2[i] = DEADEYESPALETTE;
+            break;
+          default:
+            ;
+        }
+        return;
+      }
+
+      //  PACMAN animation
+      uint8_t f = (phase[i] >> 1) & 3;
+      if (dir[i] == MLeft)
+        f = _pacLeftAnim[f];
+      else if (dir[i] == MRight)
+        f = _pacRightAnim[f];
+      else
+        f = _pacVAnim[f];
+      if (dir[i] == MUp)
+        sy[i] = -1;
+      bits[i] = f + PACMANSPRITE;
+    }
+
+    //  Draw sprite i into the tile at x,y
+    void Draw8(uint8_t i, int16_t x, int16_t y, uint8_t* tile)
+    {
+
+      int16_t px = x - (this->x[i] - 4);
+      if (px <= -8 || px >= 16) return;
+      int16_t py = y - (this->y[i] - 4);
+      if (py <= -8 || py >= 16) return;
+      // Clip y
+      int16_t lines = py + 8;
+      if (lines > 16)
+        lines = 16;
+      if (py < 0)
+      {
+        tile -= py * 8;
+        py = 0;
+      }
+      lines -= py;
+
+      //  Clip in X
+      uint8_t right = 16 - px;
+      if (right > 8)
+        right = 8;
+      uint8_t left = 0;
+      if (px < 0)
+      {
+        left = -px;
+        px = 0;
+      }
+
+      //  Get bitmap
+      int8_t dy = sy[i];
+      if (dy < 0)
+        py = 15 - py;  // VFlip
+      uint8_t* data = (uint8_t*)(pacman16x16 + bits[i] * 64);
+      data += py << 2;
+      dy <<= 2;
+      data += px >> 2;
+      px &= 3;
+
+      const uint8_t* palette = _palette2 + (palette2[i] << 2);
+      while (lines)
+      {
+        const uint8_t *src = data;
+        uint8_t d = *src++;
+        d >>= px << 1;
+        uint8_t sx = 4 - px;
+        uint8_t x = left;
+        do
+        {
+          uint8_t p = d & 3;
+          if (p)
+          {
+            p = palette[p];
+            if (p)
+              tile[x] = p;
+          }
+          d >>= 2;    // Next pixel
+          if (!--sx)
+          {
+            d = *src++;
+            sx = 4;
+          }
+        } while (++x < right);
+
+        tile += 8;
+        data += dy;
+        lines--;
+      }
+    }
+};
+
+/******************************************************************************/
+/*   GAME - Input Replay                                                      */
+/******************************************************************************/
+
+// Replay of the buttons pressed in each tick, enough to play a game again exactly: the game only
+// depends on its seed and on these presses.
+//
+//   header  'P' 'M' 'R' REPLAY_VERSION, seed (4 bytes, little endian)
+//   record  idle ticks before this one (LEB128), buttons pressed (bit INPUT_BUTTON_x), one per tick
+//           with a press; buttons 0 ends the replay after the idle ticks
+//
+// Presses come a few per second, a record is 2 bytes most of the time.
+#define REPLAY_VERSION 1
+#define REPLAY_HEADER 8
+#ifndef REPLAY_BYTES
+#define REPLAY_BYTES 4096     // recording buffer, about 10 minutes of play
+#endif
+
+class InputReplay
+{
+    uint8_t _out[REPLAY_BYTES];
+    size_t _outLen;
+    uint32_t _outIdle;
+    bool _full;               // recording stopped, the buffer is full
+
+    const uint8_t* _in;       // replay being played, NULL when none
+    size_t _inLen, _inPos;
+    uint32_t _inIdle;
+    uint8_t _inButtons;
+
+    static size_t PutRun(uint8_t* p, uint32_t v)
+    {
+      size_t n = 0;
+      do {
+        p[n++] = (v & 0x7F) | (v > 0x7F ? 0x80 : 0);
+        v >>= 7;
+      } while (v);
+      return n;
+    }
+
+    // Next record of the replay, false at the end
+    bool GetRecord(uint32_t* idle, uint8_t* buttons)
+    {
+      uint32_t v = 0;
+      for (uint8_t shift = 0; _inPos < _inLen && shift < 32; shift += 7) {
+        uint8_t b = _in[_inPos++];
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+          if (_inPos >= _inLen) return false;
+          *idle = v;
+          *buttons = _in[_inPos++];
+          return true;
+        }
+      }
+      return false;
+    }
+
+  public:
+    void Start(uint32_t seed)
+    {
+      const uint8_t header[REPLAY_HEADER] = { 'P', 'M', 'R', REPLAY_VERSION,
+                                              (uint8_t)seed, (uint8_t)(seed >> 8), (uint8_t)(seed >> 16), (uint8_t)(seed >> 24)
+                                            };
+      memcpy(_out, header, REPLAY_HEADER);
+      _outLen = REPLAY_HEADER;
+      _outIdle = 0;
+      _full = false;
+      _in = NULL;
+    }
+
+    // Seed of a replay, false when it is not one
+    static bool Seed(const uint8_t* data, size_t len, uint32_t* seed)
+    {
+      if (len < REPLAY_HEADER || data[0] != 'P' || data[1] != 'M' || data[2] != 'R' || data[3] != REPLAY_VERSION)
+        return false;
+      *seed = data[4] | (data[5] << 8) | (data[6] << 16) | ((uint32_t)data[7] << 24);
+      return true;
+    }
+
+    // Play from the next tick on, the game must have been created with the replay's seed
+    bool Play(const uint8_t* data, size_t len)
+    {
+      uint32_t seed;
+      if (!Seed(data, len, &seed))
+        return false;
+      _in = data;
+      _inLen = len;
+      _inPos = REPLAY_HEADER;
+      if (!GetRecord(&_inIdle, &_inButtons) || (!_inIdle && !_inButtons))
+        _in = NULL;
+      return true;
+    }
+
+    bool Playing()
+    {
+      return _in != NULL;
+    }
+
+    // Buttons of the next tick of the replay
+    uint8_t Next()
+    {
+      if (!_in) return 0;
+      uint8_t buttons = 0;
+      if (_inIdle) {
+        _inIdle--;
+      } else {
+        buttons = _inButtons;
+        if (!GetRecord(&_inIdle, &_inButtons))
+          _in = NULL;   // cut short
+      }
+      if (!_inIdle && !_inButtons)
+        _in = NULL;     // the end record, its idle ticks are played
+      return buttons;
+    }
+
+    // Nothing is recorded from now on: the game no longer follows from its seed (resumed)
+    void Stop()
+    {
+      _outLen = 0;
+      _in = NULL;
+    }
+
+    bool Recording()
+    {
+      return _outLen != 0;
+    }
+
+    // Buttons of this tick
+    void Record(uint8_t buttons)
+    {
+      if (!_outLen)
+        return;
+      if (!buttons) {
+        _outIdle++;
+        return;
+      }
+      if (_full || _outLen + 6 > sizeof(_out)) {
+        _full = true;
+        return;
+      }
+      _outLen += PutRun(_out + _outLen, _outIdle);
+      _out[_outLen++] = buttons;
+      _outIdle = 0;
+    }
+
+    // The recording so far, its end record goes to tail (6 bytes): data then tail is a replay
+    const uint8_t* Recorded(size_t* len, uint8_t* tail, size_t* tailLen)
+    {
+      *len = _outLen;
+      *tailLen = PutRun(tail, _outIdle);
+      tail[(*tailLen)++] = 0;
+      return _out;
+    }
+
+    bool Full()
+    {
+      return _full;
+    }
+};
+
+/******************************************************************************/
+/*   GAME - Playfield Class                                                   */
+/******************************************************************************/
+
+// Snapshot of a game in progress, see Playfield::Snapshot(). The fields are stored as they are in
+// memory: a snapshot is for the build that wrote it, the version changes with the fields.
+//
+//   'P' 'M' 'S' SNAPSHOT_VERSION, fields (SnapshotFields() order), FNV-1a of all before (4 bytes)
+#define SNAPSHOT_VERSION 4
+#define SNAPSHOT_HEADER 4
+
+class Playfield
+{
+  public:
+    //  Game context: lives, level, modes and buttons of this game, nothing is shared between games
+    uint8_t LIFES;
+    uint8_t GAMEWIN;
+    uint8_t GAMEOVER;
+    uint8_t DEMO;
+    uint8_t LEVEL;
+    uint8_t ACTUALBONUS;  //actual bonus icon
+    uint8_t ACTIVEBONUS;  //status of bonus
+    uint8_t GAMEPAUSED;
+    uint8_t PACMANFALLBACK;
+
+    uint16_t _BonusInactiveTimmer;
+    uint16_t _BonusActiveTimmer;
+
+    boolean but_A;        // START | PAUSE
+    boolean but_B;        // NOT USED HERE... would be for reseting the game
+
+    uint32_t gameTick;
+    uint32_t turnTick[5];             // game tick of the last press, by direction (0 = none)
+    uint32_t turnUs[5];               // sample time of that press
+
+    // Touch to photon latency: sample time of the press whose turn is in this frame (0 = none)
+    uint32_t latTurnUs;
+
+    uint32_t gameSeed;    // xorshift32 state, see Random()
+
+    uint32_t deaths;      // since the start, for the batch runner
+    uint32_t levelsWon;
+
+    InputReplay replay;   // records every game, or plays one back
+
+#if PACMAN_HEADLESS
+    bool tileChase = false;   // Chase() through GetTile() as before the _nav table, see headlessMoveAll()
+    uint64_t moveNs = 0;      // time in MoveAll() since the start
+    uint32_t moves = 0;
+    bool checkDots = false;   // search the dots field again after every dot, see CheckDotField()
+    uint32_t dotsEaten = 0;
+    uint32_t dotMismatches = 0;
+    uint64_t dotNs = 0;       // in RemoveDotSource()
+    uint64_t fullNs = 0;      // in the searches of CheckDotField()
+#endif
+
+  private:
+    SpriteTable<6> _sprites;  // BINKY .. PACMAN, the BONUS
+
+    uint32_t _dotRows[36 - 6];  // bit cx of row cy - 3, the 30 interior lines
+
+    GameState _state;
+    long    _score;             // 7 digits of score
+    long    _hiscore;             // 7 digits of score
+    long    _lifescore;
+    int8_t    _scoreStr[8];
+    int8_t    _hiscoreStr[8];
+    uint8_t    _icons[14];         // Along bottom of screen
+
+    ushort  _stateTimer;
+    ushort  _frightenedTimer;
+    uint8_t    _frightenedCount;
+    uint8_t    _scIndex;           //
+    ushort  _scTimer;           // next change of sc status
+
+    uint16_t _nav[36][28];      // NAV_ bits of the level, built by BuildNav()
+    uint8_t _field[FIELDS][36 * 28];
+    uint16_t _dotsLeft;         // bits set in _dotRows
+    uint16_t _queue[36 * 28];   // cells, for the field searches
+    uint8_t _flags[36 * 28];
+
+    bool _inited;
+    uint8_t _tickInput;         // buttons pressed in this tick, bit INPUT_BUTTON_x
+    uint8_t* _dirty;
+    uint8_t _dirtyBits[(32 / 8) * 36];  // tiles changed by the ticks since the last Render()
+  public:
+    Playfield(uint32_t seed = 1) :
+      LIFES(START_LIFES), GAMEWIN(0), GAMEOVER(0), DEMO(1), LEVEL(START_LEVEL), ACTUALBONUS(0), ACTIVEBONUS(0),
+      GAMEPAUSED(0), PACMANFALLBACK(0), _BonusInactiveTimmer(BONUS_INACTIVE_TIME), _BonusActiveTimmer(0),
+      but_A(false), but_B(false), gameTick(1), turnTick(), turnUs(), latTurnUs(0), gameSeed(seed ? seed : 1),
+      deaths(0), levelsWon(0), _sprites(), _hiscore(0), _hiscoreStr(), _inited(false), _tickInput(0), _dirtyBits()
+    {
+      replay.Start(gameSeed);
+      //  Swizzle palette TODO just fix in place
+      //      uint8_t * p = (uint8_t*)_paletteW;
+      //      for (int16_t i = 0; i < 16; i++)
+      //      {
+      //        ushort w = _paletteW[i];    // Swizzle
+      //        *p++ = w >> 8;
+      //        *p++ = w;
+      //      }
+    }
+
+    // Draw 2 bit BG into 8 bit icon tiles at bottom
+    void DrawBG2(uint8_t cx, uint8_t cy, uint8_t* tile)
+    {
+
+      uint8_t index = 0;
+      int8_t b = 0;
+
+      index = _icons[cx >> 1];   // 13 icons across bottom
+      if (index == 0)
+      {
+        memset(tile, 0, 64);
+        return;
+      }
+      index--;
+      index <<= 2;                        // 4 tiles per icon
+
+      b = (1 - (cx & 1)) + ((cy & 1) << 1); // Index of tile
+
+      const uint8_t* bg = pacman8x8x2 + ((b + index) << 4);
+      const uint8_t* palette = _paletteIcon2 + index;
+
+
+      uint8_t x = 16;
+      while (x--)
+      {
+        uint8_t bits = (int8_t) * bg++;
+        uint8_t i = 4;
+        while (i--)
+        {
+          tile[i] = palette[bits & 3];
+          bits >>= 2;
+        }
+        tile += 4;
+      }
+    }
+
+    uint8_t GetTile(int16_t cx, int16_t ty)
+    {
+
+      if (_state != ReadyState && ty == 20 && cx > 10 && cx < 17) return (0); //READY TEXT ZONE
+
+      return LevelMap()[ty * 28 + cx];
+    }
+
+    const uint8_t* LevelMap()
+    {
+      if (LEVEL % 5 == 1) return playMap1;
+      if (LEVEL % 5 == 2) return playMap2;
+      if (LEVEL % 5 == 3) return playMap3;
+      if (LEVEL % 5 == 4) return playMap4;
+      return playMap5;
+    }
+
+    //  Walkable directions of every cell, once per level. Sprites only move outside ReadyState,
+    //  so the READY text zone is open.
+    void BuildNav()
+    {
+      const uint8_t* map = LevelMap();
+      for (int16_t cy = 0; cy < 36; cy++)
+        for (int16_t cx = 0; cx < 28; cx++)
+        {
+          uint16_t nav = 0;
+          for (uint8_t d = MRight; d <= MUp; d++)
+          {
+            int16_t x = (cx + _dirX[d] + 28) % 28;  // tunneling
+            int16_t y = cy + _dirY[d];
+            if (y < 0 || y >= 36)
+              continue;
+            uint8_t t = (y == 20 && x > 10 && x < 17) ? 0 : map[y * 28 + x];
+            if (t == 0 || t == DOT || t == PILL || t == PENGATE)
+              nav |= NAV_OPEN(d);
+            if (t == PENGATE)
+              nav |= NAV_GATE(d);
+          }
+          if (cy == 17 && (cx <= 5 || cx > 20))
+            nav |= NAV_TUNNEL;
+          _nav[cy][cx] = nav;
+        }
+    }
+
+    //  Neighbor cell in dir, -1 when closed. Only DeadEyes ghosts go through the gate.
+    int16_t NavStep(uint16_t i, uint8_t d, bool gate)
+    {
+      uint16_t nav = _nav[i / 28][i % 28];
+      if (!(nav & NAV_OPEN(d)) || (!gate && (nav & NAV_GATE(d))))
+        return -1;
+      int16_t x = (i % 28 + _dirX[d] + 28) % 28;
+      return (i / 28 + _dirY[d]) * 28 + x;
+    }
+
+    //  Breadth first from the cells set to 0, the others have to be FIELD_INF
+    void SearchField(uint8_t* field, bool gate)
+    {
+      uint16_t head = 0, tail = 0;
+      for (uint16_t i = 0; i < 36 * 28; i++)
+        if (field[i] == 0)
+          _queue[tail++] = i;
+
+      while (head < tail)
+      {
+        uint16_t i = _queue[head++];
+        if (field[i] >= FIELD_INF - 1)
+          continue;
+        for (uint8_t d = MRight; d <= MUp; d++)
+        {
+          int16_t j = NavStep(i, d, gate);
+          if (j >= 0 && field[j] == FIELD_INF)
+          {
+            field[j] = field[i] + 1;
+            _queue[tail++] = j;
+          }
+        }
+      }
+    }
+
+    void BuildFields()
+    {
+      memset(_field, FIELD_INF, sizeof(_field));
+
+      uint8_t* pen = _field[FIELD_PEN];
+      pen[17 * 28 + 14] = 0;
+      SearchField(pen, true);
+
+      //  Corners: the maze cell closest to the scatter target, it is outside the maze
+      for (uint8_t who = 0; who < 4; who++)
+      {
+        uint8_t tx = _scatterTargets[who * 2];
+        uint8_t ty = _scatterTargets[who * 2 + 1];
+        int16_t best = -1, bestDist = 0x7FFF;
+        for (uint16_t i = 0; i < 36 * 28; i++)
+        {
+          uint8_t cx = i % 28, cy = i / 28;
+          if (pen[i] == FIELD_INF || InPen(cx, cy))
+            continue;
+          int16_t dist = (cx - tx) * (cx - tx) + (cy - ty) * (cy - ty);
+          if (dist < bestDist)
+          {
+            bestDist = dist;
+            best = i;
+          }
+        }
+        if (best >= 0)
+        {
+          _field[FIELD_SCATTER + who][best] = 0;
+          SearchField(_field[FIELD_SCATTER + who], false);
+        }
+      }
+
+      SearchDots(_field[FIELD_DOTS]);
+    }
+
+    //  Distance to the closest dot left, field has to be all FIELD_INF
+    void SearchDots(uint8_t* field)
+    {
+      for (uint8_t cy = 3; cy < 36 - 3; cy++)
+        for (uint32_t row = _dotRows[cy - 3]; row; row &= row - 1)
+          field[cy * 28 + __builtin_ctz(row)] = 0;
+      SearchField(field, false);
+    }
+
+    //  A dot is gone: only the cells whose shortest path ended there change. They are found outward
+    //  from the dot (no neighbor one step closer left), then filled in again from their border.
+    void RemoveDotSource(uint16_t src)
+    {
+      uint8_t* field = _field[FIELD_DOTS];
+      if (field[src] != 0)
+        return;
+
+      uint16_t n = 0;
+      memset(_flags, 0, sizeof(_flags));
+      _flags[src] = 1;
+      _queue[n++] = src;
+      for (uint16_t k = 0; k < n; k++)
+      {
+        uint16_t i = _queue[k];
+        for (uint8_t d = MRight; d <= MUp; d++)
+        {
+          int16_t j = NavStep(i, d, false);
+          if (j < 0 || _flags[j] || field[j] != field[i] + 1)
+            continue;
+          bool held = false;
+          for (uint8_t e = MRight; e <= MUp && !held; e++)
+          {
+            int16_t h = NavStep(j, e, false);
+            held = h >= 0 && !_flags[h] && field[h] + 1 == field[j];
+          }
+          if (!held)
+          {
+            _flags[j] = 1;
+            _queue[n++] = j;
+          }
+        }
+      }
+
+      //  Orphans start from their settled neighbors...
+      for (uint16_t k = 0; k < n; k++)
+      {
+        uint16_t i = _queue[k];
+        uint8_t best = FIELD_INF;
+        for (uint8_t d = MRight; d <= MUp; d++)
+        {
+          int16_t j = NavStep(i, d, false);
+          if (j >= 0 && !_flags[j] && field[j] < best - 1)
+            best = field[j] + 1;
+        }
+        field[i] = best;
+        _flags[i] = 2;  // queued
+      }
+
+      //  ...and relax among themselves, every orphan is queued at most once at a time
+      uint16_t head = 0, count = n;
+      while (count)
+      {
+        uint16_t i = _queue[head];
+        head = (head + 1) % (36 * 28);
+        count--;
+        _flags[i] = 1;
+        if (field[i] >= FIELD_INF - 1)
+          continue;
+        for (uint8_t d = MRight; d <= MUp; d++)
+        {
+          int16_t j = NavStep(i, d, false);
+          if (j < 0 || !_flags[j] || field[j] <= field[i] + 1)
+            continue;
+          field[j] = field[i] + 1;
+          if (_flags[j] != 2)
+          {
+            _flags[j] = 2;
+            _queue[(head + count++) % (36 * 28)] = j;
+          }
+        }
+      }
+    }
+
+#if PACMAN_HEADLESS
+    //  The dots field as a full search from the dots left finds it, timed, against the incremental one
+    void CheckDotField()
+    {
+      uint8_t full[36 * 28];
+      uint64_t t0 = headlessNs();
+      memset(full, FIELD_INF, sizeof(full));
+      SearchDots(full);
+      fullNs += headlessNs() - t0;
+      if (memcmp(full, _field[FIELD_DOTS], sizeof(full)) != 0)
+        dotMismatches++;
+    }
+#endif
+
+    // Draw 1 bit BG into 8 bit tile
+    void DrawBG(uint8_t cx, uint8_t cy, uint8_t* tile)
+    {
+
+      memset(tile, 0, 64);
+      if (cy >= 34) //DRAW ICONS BELLOW MAZE
+      {
+        DrawBG2(cx, cy, tile);
+        return;
+      }
+
+
+      uint8_t c = 11;
+      if (LEVEL % 8 == 1) c = 11; // Blue
+      if (LEVEL % 8 == 2) c = 12; // Green
+      if (LEVEL % 8 == 3) c = 1; // Red
+      if (LEVEL % 8 == 4) c = 9; // Yellow
+      if (LEVEL % 8 == 5) c = 2; // Brown
+      if (LEVEL % 8 == 6) c = 5; // Cyan
+      if (LEVEL % 8 == 7) c = 3; // Pink
+      if (LEVEL % 8 == 0) c = 15; // White
+
+      uint8_t b = GetTile(cx, cy);
+      const uint8_t* bg;
+
+      //  This is a little messy
+      memset(tile, 0, 64);
+      if (cy == 20 && cx >= 11 && cx < 17)
+      {
+        if (DEMO == 1 && ACTIVEBONUS == 1) return;
+
+        if (HUDONI2C) { // only 'READY!' stays on the playfield
+          if (_state != ReadyState || GAMEPAUSED == 1 || DEMO == 1 || ACTIVEBONUS == 1) b = 0;
+        }
+        else if ((_state != ReadyState && GAMEPAUSED != 1 && DEMO != 1) || ACTIVEBONUS == 1) b = 0; // hide 'READY!'
+        else if (DEMO == 1 && cx == 11) b = 0;
+        else if (DEMO == 1 && cx == 12) b = 'D';
+        else if (DEMO == 1 && cx == 13) b = 'E';
+        else if (DEMO == 1 && cx == 14) b = 'M';
+        else if (DEMO == 1 && cx == 15) b = 'O';
+        else if (DEMO == 1 && cx == 16) b = 0;
+        else if (GAMEPAUSED == 1 && cx == 11) b = 'P';
+        else if (GAMEPAUSED == 1 && cx == 12) b = 'A';
+        else if (GAMEPAUSED == 1 && cx == 13) b = 'U';
+        else if (GAMEPAUSED == 1 && cx == 14) b = 'S';
+        else if (GAMEPAUSED == 1 && cx == 15) b = 'E';
+        else if (GAMEPAUSED == 1 && cx == 16) b = 'D';
+      }
+      else if (cy == 1)
+      {
+        if (cx < 7)
+          b = _scoreStr[cx];
+        else if (cx >= 10 && cx < 17)
+          b = _hiscoreStr[cx - 10]; // HiScore
+      } else {
+        if (b == DOT || b == PILL)  // DOT==7 or PILL==16
+        {
+          if (!GetDot(cx, cy))
+            return;
+          c = 14;
+        }
+        if (b == PENGATE)
+          c = 14;
+      }
+
+      bg = playTiles + (b << 3);
+      if (b >= '0')
+        c = 15; // text is white
+
+      for (uint8_t y = 0; y < 8; y++)
+      {
+        int8_t bits = (int8_t) * bg++; ///WARNING CHAR MUST BE signed !!!
+        uint8_t x = 0;
+        while (bits)
+        {
+          if (bits < 0)
+            tile[x] = c;
+          bits <<= 1;
+          x++;
+        }
+        tile += 8;
+      }
+    }
+
+    // Draw BG then all sprites in this cell
+    void Draw(uint16_t x, uint16_t y, bool sprites)
+    {
+      uint8_t tile[8 * 8];
+      bool pacmanCell = sprites && x == _sprites.cx[PACMAN] && y == _sprites.cy[PACMAN];
+      memset(tile, 0, sizeof(tile));
+
+      //      Fill with BG
+      if (y == 20 && x >= 11 && x < 17 && DEMO == 1 && ACTIVEBONUS == 1)  return;
+      if (HUDONI2C && (y == 1 || y >= 34)) return; // score and icons are on the HUD display
+      DrawBG(x, y, tile);
+
+      //      Overlay sprites
+      x <<= 3;
+      y <<= 3;
+      if (sprites)
+      {
+        for (uint8_t i = 0; i < 5; i++)
+          _sprites.Draw8(i, x, y, tile);
+
+        //AND BONUS
+        if (ACTIVEBONUS) _sprites.Draw8(BONUS, x, y, tile);
+
+      }
+
+      //      Show sprite block
+#if 0
+      for (uint8_t i = 0; i < 5; i++)
+      {
+        if (_sprites.cx[i] == (x >> 3) && _sprites.cy[i] == (y >> 3))
+        {
+          memset(tile, 0, 8);
+          for (uint8_t j = 1; j < 7; j++)
+            tile[j * 8] = tile[j * 8 + 7] = 0;
+          memset(tile + 56, 0, 8);
+        }
+      }
+#endif
+
+      x += (240 - 224) / 2;
+      y += (320 - 288) / 2;
+
+
+      //      Should be a direct Graphics call
+
+      //uint8_t n = tile[0];
+      //uint8_t i = 0;
+      //uint16_t color = (uint16_t)_paletteW[n];
+
+      drawIndexedmap(tile, x, y);
+
+      // the batch holding Pacman's cell reports when the turn is on the display
+      if (pacmanCell && latTurnUs) {
+        probeTiles(latTurnUs);
+        latTurnUs = 0;
+      }
+    }
+
+    boolean updateMap [36][28];
+
+    //  Mark tile as dirty (should not need range checking here)
+    void Mark(int16_t x, int16_t y, uint8_t* m)
+    {
+      x -= 4;
+      y -= 4;
+
+      updateMap[(y >> 3)][(x >> 3)] = true;
+      updateMap[(y >> 3)][(x >> 3) + 1] = true;
+      updateMap[(y >> 3)][(x >> 3) + 2] = true;
+      updateMap[(y >> 3) + 1][(x >> 3)] = true;
+      updateMap[(y >> 3) + 1][(x >> 3) + 1] = true;
+      updateMap[(y >> 3) + 1][(x >> 3) + 2] = true;
+      updateMap[(y >> 3) + 2][(x >> 3)] = true;
+      updateMap[(y >> 3) + 2][(x >> 3) + 1] = true;
+      updateMap[(y >> 3) + 2][(x >> 3) + 2] = true;
+
+    }
+
+    void DrawAllBG()
+    {
+      for (uint8_t y = 0; y < 36; y++)
+        for (uint8_t x = 0; x < 28; x++) {
+          Draw(x, y, false);
+        }
+    }
+
+    //  Draw sprites overlayed on cells
+    void DrawAll()
+    {
+      uint8_t* m = _dirty;
+
+      //  Mark sprite old/new positions as dirty
+      for (uint8_t i = 0; i < 5; i++)
+      {
+        Mark(_sprites.lastx[i], _sprites.lasty[i], m);
+        Mark(_sprites.x[i], _sprites.y[i], m);
+        _sprites.lastx[i] = _sprites.x[i];    // last drawn, the ticks in between may have moved it several times
+        _sprites.lasty[i] = _sprites.y[i];
+
+      }
+
+      // Mark BONUS sprite old/new positions as dirty
+      Mark(_sprites.lastx[BONUS], _sprites.lasty[BONUS], m);
+      Mark(_sprites.x[BONUS], _sprites.y[BONUS], m);
+      _sprites.lastx[BONUS] = _sprites.x[BONUS];
+      _sprites.lasty[BONUS] = _sprites.y[BONUS];
+
+
+      //  Animation
+      for (uint8_t i = 0; i < 5; i++)
+        _sprites.SetupDraw(i, _state, _frightenedCount - 1, ACTUALBONUS);
+
+      _sprites.SetupDraw(BONUS, _state, _frightenedCount - 1, ACTUALBONUS);
+
+
+      for (uint8_t tmpY = 0; tmpY < 36; tmpY++) {
+        for (uint8_t tmpX = 0; tmpX < 28; tmpX++) {
+          if (updateMap[tmpY][tmpX] == true) Draw(tmpX, tmpY, true);
+          updateMap[tmpY][tmpX] = false;
+        }
+
+      }
+
+      // everything drawn in this Step goes to the display now
+      flushTiles();
+      latTurnUs = 0;
+    }
+
+
+    //  Distance to target from the neighbor cell in dir, 0x7FFF when it can't be entered
+    int16_t Chase(uint8_t who, uint8_t dir)
+    {
+#if PACMAN_HEADLESS
+      if (tileChase)
+        return ChaseTiles(who, dir);
+#endif
+      int16_t cx = _sprites.cx[who] % 28;  // x = 220..223 is cell 28, the tunnel
+      uint16_t nav = _nav[_sprites.cy[who]][cx];
+      if (!(nav & NAV_OPEN(dir)))
+        return 0x7FFF;
+
+      if (nav & NAV_GATE(dir))
+      {
+        if (who == PACMAN)
+          return 0x7FFF;  // Pacman can't cross this to enter pen
+        if (!(InPen(_sprites.cx[who], _sprites.cy[who]) || _sprites.state[who] == DeadEyesState))
+          return 0x7FFF;  // Can cross if dead or in pen trying to get out
+      }
+
+      cx = (cx + _dirX[dir] + 28) % 28;  //  Tunneling
+      if (_sprites.field[who] != FIELD_NONE)
+        return _field[_sprites.field[who]][(_sprites.cy[who] + _dirY[dir]) * 28 + cx];
+
+      int16_t dx = _sprites.tx[who] - cx;
+      int16_t dy = _sprites.ty[who] - (_sprites.cy[who] + _dirY[dir]);
+      return (dx * dx + dy * dy); // Distance to target
+
+    }
+
+#if PACMAN_HEADLESS
+    //  Chase() as it was before BuildNav(): the tile of the neighbor cell through GetTile()
+    int16_t ChaseTiles(uint8_t who, uint8_t dir)
+    {
+      int16_t cx = _sprites.cx[who] + _dirX[dir];
+      int16_t cy = _sprites.cy[who] + _dirY[dir];
+      while (cx < 0)      //  Tunneling
+        cx += 28;
+      while (cx >= 28)
+        cx -= 28;
+
+      uint8_t t = GetTile(cx, cy);
+      if (!(t == 0 || t == DOT || t == PILL || t == PENGATE))
+        return 0x7FFF;
+
+      if (t == PENGATE)
+      {
+        if (who == PACMAN)
+          return 0x7FFF;
+        if (!(InPen(_sprites.cx[who], _sprites.cy[who]) || _sprites.state[who] == DeadEyesState))
+          return 0x7FFF;
+      }
+
+      if (_sprites.field[who] != FIELD_NONE)
+        return _field[_sprites.field[who]][cy * 28 + cx];
+
+      int16_t dx = _sprites.tx[who] - cx;
+      int16_t dy = _sprites.ty[who] - cy;
+      return (dx * dx + dy * dy);
+    }
+#endif
+
+    void UpdateTimers()
+    {
+      // Update scatter/chase selector, low bit of index indicates scatter
+      if (_scIndex < 8)
+      {
+        if (_scTimer-- == 0)
+        {
+          uint8_t duration = _scatterChase[_scIndex++];
+          _scTimer = duration * FPS;
+        }
+      }
+
+      // BONUS timmer
+      if (ACTIVEBONUS == 0 && _BonusInactiveTimmer-- == 0) {
+        _BonusActiveTimmer = BONUS_ACTIVE_TIME; //5*FPS;
+        ACTIVEBONUS = 1;
+      }
+      if (ACTIVEBONUS == 1 && _BonusActiveTimmer-- == 0) {
+        _BonusInactiveTimmer = BONUS_INACTIVE_TIME; //10*FPS;
+        ACTIVEBONUS = 0;
+      }
+
+
+      //  Release frightened ghosts
+      if (_frightenedTimer && !--_frightenedTimer)
+      {
+        for (uint8_t i = 0; i < 4; i++)
+        {
+          if (_sprites.state[i] == FrightenedState)
+          {
+            _sprites.state[i] = RunState;
+            _sprites.dir[i] = OppositeDirection(_sprites.dir[i]);
+          }
+        }
+      }
+    }
+
+    //  Target closes pill, run from ghosts?
+    void PacmanAI()
+    {
+      //  Chase frightened ghosts
+      //uint8_t closestGhost = NOSPRITE;
+      uint8_t frightenedGhost = NOSPRITE;
+      uint8_t closestAttackingGhost = NOSPRITE;
+      uint8_t DeadEyesStateGhost = NOSPRITE;
+      int16_t dist = 0x7FFF;
+      int16_t closestfrightenedDist = 0x7FFF;
+      int16_t closestAttackingDist = 0x7FFF;
+      for (uint8_t i = 0; i < 4; i++)
+      {
+        int16_t d = _sprites.Distance(i, _sprites.cx[PACMAN], _sprites.cy[PACMAN]);
+        if (d < dist)
+        {
+
+          dist = d;
+          if (_sprites.state[i] == FrightenedState ) {
+            frightenedGhost = i;
+            closestfrightenedDist = d;
+          }
+          else {
+            closestAttackingGhost = i;
+            closestAttackingDist = d;
+          }
+          //closestGhost = i;
+
+          if ( _sprites.state[i] == DeadEyesState ) DeadEyesStateGhost = i;
+
+        }
+      }
+
+      PACMANFALLBACK = 0;
+
+      if (DEMO == 1 && DeadEyesStateGhost == NOSPRITE && frightenedGhost != NOSPRITE )
+      {
+        _sprites.Target(PACMAN, _sprites.cx[frightenedGhost], _sprites.cy[frightenedGhost]);
+        return;
+      }
+
+
+
+      // Under threat; just avoid closest ghost
+      if (DEMO == 1 && DeadEyesStateGhost == NOSPRITE && dist <= 32  && closestAttackingDist < closestfrightenedDist )
+      {
+        if (dist <= 16) {
+          _sprites.Target(PACMAN,  _sprites.cx[PACMAN] * 2 - _sprites.cx[closestAttackingGhost], _sprites.cy[PACMAN] * 2 - _sprites.cy[closestAttackingGhost]);
+          PACMANFALLBACK = 1;
+        } else {
+          _sprites.Target(PACMAN,  _sprites.cx[PACMAN] * 2 - _sprites.cx[closestAttackingGhost], _sprites.cy[PACMAN] * 2 - _sprites.cy[closestAttackingGhost]);
+        }
+        return;
+      }
+
+      if (ACTIVEBONUS == 1) {
+        _sprites.Target(PACMAN, 13, 20);
+        return;
+      }
+
+
+      //  Go for the pill
+      if (GetDot(1, 6))
+        _sprites.Target(PACMAN, 1, 6);
+      else if (GetDot(26, 6))
+        _sprites.Target(PACMAN, 26, 6);
+      else if (GetDot(1, 26))
+        _sprites.Target(PACMAN, 1, 26);
+      else if (GetDot(26, 26))
+        _sprites.Target(PACMAN, 26, 26);
+      else
+        _sprites.Follow(PACMAN, FIELD_DOTS);   // closest dot along the maze
+    }
+
+    void Scatter(uint8_t who)
+    {
+      const uint8_t* st = _scatterTargets + (who << 1);
+      _sprites.Target(who, *st, *(st + 1));
+      _sprites.Follow(who, FIELD_SCATTER + who);
+    }
+
+    void UpdateTargets()
+    {
+      if (_state == ReadyState)
+        return;
+      PacmanAI();
+
+      //  Ghost AI
+      bool scatter = _scIndex & 1;
+      for (uint8_t i = 0; i < 4; i++)
+      {
+
+        //  Deal with returning ghost to pen
+        if (_sprites.state[i] == DeadEyesState)
+        {
+          if (_sprites.cx[i] == 14 && _sprites.cy[i] == 17) // returned to pen
+          {
+            _sprites.state[i] = PenState;        // Revived in pen
+            _sprites.pentimer[i] = 8 * FPS / 3;   // 2.7 s
+          }
+          else
+            _sprites.Follow(i, FIELD_PEN);       // target pen
+          continue;           //
+        }
+
+        //  Release ghost from pen when timer expires
+        if (_sprites.pentimer[i])
+        {
+          if (--_sprites.pentimer[i])  // stay in pen for awhile
+            continue;
+          _sprites.state[i] = RunState;
+        }
+
+        if (InPen(_sprites.cx[i], _sprites.cy[i]))
+        {
+          _sprites.Target(i, 14, 14 - 2); // Get out of pen first
+        } else {
+          if (scatter || _sprites.state[i] == FrightenedState)
+            Scatter(i);
+          else
+          {
+            // Chase mode targeting
+            int8_t tx = _sprites.cx[PACMAN];
+            int8_t ty = _sprites.cy[PACMAN];
+            switch (i)
+            {
+              case PINKY:
+                {
+                  const uint8_t* pto = _pinkyTargetOffset + ((_sprites.dir[PACMAN] - 1) << 1);
+                  tx += *pto;
+                  ty += *(pto + 1);
+                }
+                break;
+              case INKY:
+                {
+                  const uint8_t* pto = _pinkyTargetOffset + ((_sprites.dir[PACMAN] - 1) << 1);
+                  tx += *pto >> 1;
+                  ty += *(pto + 1) >> 1;
+                  tx += tx - _sprites.cx[BINKY];
+                  ty += ty - _sprites.cy[BINKY];
+                }
+                break;
+              case CLYDE:
+                {
+                  if (_sprites.Distance(i, _sprites.cx[PACMAN], _sprites.cy[PACMAN]) < 64)
+                  {
+                    const uint8_t* st = _scatterTargets + CLYDE * 2;
+                    tx = *st;
+                    ty = *(st + 1);
+                  }
+                }
+                break;
+            }
+            _sprites.Target(i, tx, ty);
+          }
+        }
+      }
+    }
+
+    //  Buffered press still in its window
+    bool TurnBuffered(uint8_t dir)
+    {
+      return turnTick[dir] && gameTick - turnTick[dir] <= TURN_BUFFER_TICKS;
+    }
+
+    //  Most recent buffered press among the directions open from the sprite's cell, MStopped when none
+    uint8_t BufferedTurn(uint8_t who)
+    {
+      uint8_t turn = MStopped;
+
+      for (uint8_t d = MRight; d <= MUp; d++) {
+        if (!TurnBuffered(d) || Chase(who, d) >= 0x7FFF) continue;
+        if (turn == MStopped || turnTick[d] > turnTick[turn]) turn = d;
+      }
+      return turn;
+    }
+
+    //  Pacman takes a buffered turn: the buffer is used up, the frame is traced for latency
+    void TakeTurn(uint8_t who, uint8_t dir)
+    {
+      if (dir != _sprites.dir[who]) {
+        latTurnUs = turnUs[dir];
+#if PACMAN_HEADLESS
+        headlessTurn(gameTick - turnTick[dir]);   // press to turn, see headlessLatency()
+#endif
+      }
+      memset(turnTick, 0, sizeof(turnTick));
+    }
+
+    //  Between cells: reverse at once, or turn up to CORNER_PIXELS before the junction
+    void PreTurn(uint8_t who, int16_t x, int16_t y)
+    {
+      uint8_t opposite = OppositeDirection(_sprites.dir[who]);
+      if (_sprites.dir[who] != MStopped && TurnBuffered(opposite)) {
+        // newest press is the way back, always open
+        bool newest = true;
+        for (uint8_t d = MRight; d <= MUp; d++)
+          if (d != opposite && TurnBuffered(d) && turnTick[d] > turnTick[opposite]) newest = false;
+        if (newest) {
+          TakeTurn(who, opposite);
+          _sprites.dir[who] = opposite;
+          return;
+        }
+      }
+
+      int16_t ahead;  // pixels to the next cell center
+      switch (_sprites.dir[who])
+      {
+        case MRight: ahead = (y & 7) ? 0 : (8 - (x & 7)) & 7; break;
+        case MLeft:  ahead = (y & 7) ? 0 : x & 7; break;
+        case MDown:  ahead = (x & 7) ? 0 : (8 - (y & 7)) & 7; break;
+        case MUp:    ahead = (x & 7) ? 0 : y & 7; break;
+        default:     ahead = 0; break;
+      }
+      if (ahead == 0 || ahead > CORNER_PIXELS)
+        return;
+
+      // that close, cx/cy are the junction already
+      uint8_t turn = BufferedTurn(who);
+      if (turn == MStopped || turn == _sprites.dir[who] || turn == opposite)
+        return;
+      TakeTurn(who, turn);
+      _sprites.dir[who] = turn;
+    }
+
+    //  Cornering: one coordinate goes back onto the lane while moving along the other
+    int16_t ToLane(int16_t v)
+    {
+      int16_t r = v & 7;
+      if (r == 0 || r == 4) return v;   // on the lane, or the half cell start position
+      if (r < 4) return v - (r < SPEED ? r : SPEED);
+      return v + ((8 - r) < SPEED ? (8 - r) : SPEED);
+    }
+
+    //  Default to current direction
+    uint8_t ChooseDir(int16_t dir, uint8_t who)
+    {
+      int16_t choice[4];
+      choice[0] = Chase(who, MUp);
+      choice[1] = Chase(who, MLeft);
+      choice[2] = Chase(who, MDown);
+      choice[3] = Chase(who, MRight);
+
+
+      uint8_t turn = (DEMO == 0 && who == PACMAN) ? BufferedTurn(who) : (uint8_t)MStopped;
+
+      if (turn != MStopped) {
+        TakeTurn(who, turn);
+        dir = turn;
+      }
+
+      else if (DEMO == 0 && choice[0] < 0x7FFF && who == PACMAN && dir == MUp) dir = MUp;
+      else if (DEMO == 0 && choice[1] < 0x7FFF && who == PACMAN && dir == MLeft) dir = MLeft;
+      else if (DEMO == 0 && choice[2] < 0x7FFF && who == PACMAN && dir == MDown) dir = MDown;
+      else if (DEMO == 0 && choice[3] < 0x7FFF && who == PACMAN && dir == MRight) dir = MRight;
+      else if ((DEMO == 0 && who != PACMAN) || DEMO == 1 ) {
+
+        // Don't choose opposite of current direction?
+
+        int16_t dist = choice[4 - dir]; // favor current direction
+        uint8_t opposite = OppositeDirection(dir);
+        for (uint8_t i = 0; i < 4; i++)
+        {
+          uint8_t d = 4 - i;
+          if ((d != opposite && choice[i] < dist) || (who == PACMAN && (PACMANFALLBACK || _sprites.field[who] != FIELD_NONE) && choice[i] < dist))
+          {
+            if (who == PACMAN && PACMANFALLBACK) PACMANFALLBACK = 0;
+            dist = choice[i];
+            dir = d;
+          }
+
+        }
+
+      } else  {
+        dir = MStopped;
+      }
+
+      return dir;
+    }
+
+    bool InPen(uint8_t cx, uint8_t cy)
+    {
+      if (cx <= 10 || cx >= 18) return false;
+      if (cy <= 14 || cy >= 18) return false;
+      return true;
+    }
+
+    uint8_t GetSpeed(uint8_t who)
+    {
+      if (who == PACMAN)
+        return _frightenedTimer ? 90 : 80;
+      if (_sprites.state[who] == FrightenedState)
+        return 40;
+      if (_sprites.state[who] == DeadEyesState)
+        return 100;
+      if (_nav[_sprites.cy[who]][_sprites.cx[who] % 28] & NAV_TUNNEL)
+        return 40;  // tunnel
+      return 75;
+    }
+
+    void PackmanDied() {  // Noooo... PACMAN DIED :(
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+      if (DEMO == 0) {
+        GameAudio.PlayWav(&pmDeath, true, 1.0);
+        // wait until done
+        while (GameAudio.IsPlaying());
+      }
+#endif
+      deaths++;
+      if (LIFES <= 0) {
+        if (DEMO == 0 && replay.Recording()) replayDump(replay);  // the whole session, to play the game again
+        GAMEOVER = 1;
+        LEVEL = START_LEVEL;
+        LIFES = START_LIFES;
+        DEMO = 1;
+        Init();
+      } else {
+        LIFES--;
+
+        _inited = true;
+        _state = ReadyState;
+        _stateTimer = FPS / 2;
+        _frightenedCount = 0;
+        _frightenedTimer = 0;
+
+        const uint8_t* s = _initSprites;
+        for (int16_t i = 0; i < 5; i++)
+          InitSprite(i, s + i * 5);
+
+        _scIndex = 0;
+        _scTimer = 1;
+
+        memset(_icons, 0, sizeof(_icons));
+
+        //AND BONUS
+        InitSprite(BONUS, s + 5 * 5);
+        _BonusInactiveTimmer = BONUS_INACTIVE_TIME;
+        _BonusActiveTimmer = 0;
+
+        for (uint8_t i = 0; i < ACTUALBONUS; i++) {
+          _icons[13 - i] = BONUSICON + i;
+        }
+
+        for (uint8_t i = 0; i < LIFES; i++) {
+          _icons[0 + i] = PACMANICON;
+        }
+
+        //Draw LIFE and BONUS Icons
+        for (uint8_t y = 34; y < 36; y++)
+          for (uint8_t x = 0; x < 28; x++) {
+            Draw(x, y, false);
+          }
+
+        DrawAllBG();
+      }
+    }
+
+
+    void MoveAll()
+    {
+      UpdateTimers();
+      UpdateTargets();
+
+
+      //  Update game state
+      if (_stateTimer)
+      {
+        if (--_stateTimer <= 0)
+        {
+          switch (_state)
+          {
+            case ReadyState:
+              _state = PlayState;
+              _dirty[20 * 4 + 1] |= 0x1F; // Clear 'READY!'
+              _dirty[20 * 4 + 2] |= 0x80;
+
+              for (uint8_t tmpX = 11; tmpX < 17; tmpX++) Draw(tmpX, 20, false); // ReDraw (clear) 'READY' position
+
+              break;
+            case DeadGhostState:
+              _state = PlayState;
+              for (uint8_t i = 0; i < 4; i++)
+              {
+                if (_sprites.state[i] == DeadNumberState)
+                  _sprites.state[i] = DeadEyesState;
+              }
+              break;
+            default:
+              ;
+          }
+        } else {
+          if (_state == ReadyState)
+            return;
+        }
+      }
+
+      //  Speed (in DeadGhostState, only eyes move), direction and step. A direction only depends on
+      //  the sprite's own cell and target, so a sprite can move before the next one has chosen.
+      _sprites.Advance(5, SPEED, [this](uint16_t i) {
+        return (_state == DeadGhostState && _sprites.state[i] != DeadEyesState) ? 0 : GetSpeed(i);
+      }, [this](uint16_t i) {
+        int16_t x = _sprites.x[i];
+        int16_t y = _sprites.y[i];
+        if ((x & 0x7) == 0 && (y & 0x7) == 0)   // cell aligned
+          return ChooseDir(_sprites.dir[i], i);  // time to choose another direction
+        if (DEMO == 0 && i == PACMAN)
+          PreTurn(i, x, y);                   // buffered press before the junction
+        return _sprites.dir[i];
+      });
+
+      if (_sprites.moves[PACMAN])
+      {
+        //  Finish a pre-turn diagonally
+        uint8_t dir = _sprites.dir[PACMAN];
+        if (dir == MUp || dir == MDown) _sprites.x[PACMAN] = ToLane(_sprites.x[PACMAN]);
+        else if (dir == MLeft || dir == MRight) _sprites.y[PACMAN] = ToLane(_sprites.y[PACMAN]);
+        _sprites.cx[PACMAN] = (_sprites.x[PACMAN] + 4) >> 3;
+        _sprites.cy[PACMAN] = (_sprites.y[PACMAN] + 4) >> 3;
+        EatDot(_sprites.cx[PACMAN], _sprites.cy[PACMAN]);
+      }
+
+      //  Collide with BONUS
+      if (ACTIVEBONUS == 1 && _sprites.cx[BONUS] == _sprites.cx[PACMAN] && _sprites.cy[BONUS] == _sprites.cy[PACMAN])
+      {
+        Score(ACTUALBONUS * 50);
+        ACTUALBONUS++;
+        if (ACTUALBONUS > 7) {
+          ACTUALBONUS = 0;
+          if (LIFES < MAXLIFES) LIFES++;
+
+          //reset all icons
+          memset(_icons, 0, sizeof(_icons));
+
+          for (uint8_t i = 0; i < LIFES; i++) {
+            _icons[0 + i] = PACMANICON;
+          }
+
+        }
+
+        for (uint8_t i = 0; i < ACTUALBONUS; i++) {
+          _icons[13 - i] = BONUSICON + i;
+        }
+
+        //REDRAW LIFE and BONUS icons
+        for (uint8_t y = 34; y < 36; y++)
+          for (uint8_t x = 0; x < 28; x++) {
+            Draw(x, y, false);
+          }
+
+        ACTIVEBONUS = 0;
+        _BonusInactiveTimmer = BONUS_INACTIVE_TIME;
+      }
+
+      _sprites.Touching(4, _sprites.x[PACMAN], _sprites.y[PACMAN], SPEED);
+      for (uint8_t i = 0; i < 4; i++)
+      {
+        if (_sprites.hit[i])
+        {
+          if (_sprites.state[i] == FrightenedState)
+          {
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+            if (DEMO == 0) {
+              GameAudio.PlayWav(&pmEatGhost, true, 1.0);
+            }
+#endif
+            _sprites.state[i] = DeadNumberState;     // Killed a ghost
+            _frightenedCount++;
+            _state = DeadGhostState;
+            _stateTimer = FPS / 3;
+            Score((1 << _frightenedCount) * 100);
+          }
+          else {               // pacman died
+            if (_sprites.state[i] == DeadNumberState || _sprites.state[i] == FrightenedState || _sprites.state[i] == DeadEyesState) {
+            } else {
+              PackmanDied();
+              break;    // everyone is back at the start
+            }
+          }
+        }
+      }
+    }
+
+    //  Mark a position dirty
+    void Mark(int16_t pos)
+    {
+      for (uint8_t tmp = 0; tmp < 28; tmp++)
+        updateMap[1][tmp] = true;
+
+    }
+
+    void SetScoreChar(uint8_t i, int8_t c)
+    {
+      if (_scoreStr[i] == c)
+        return;
+      _scoreStr[i] = c;
+      Mark(i + 32);  //Score
+      //Mark(i+32+10); //HiScore
+
+    }
+
+    void SetHiScoreChar(uint8_t i, int8_t c)
+    {
+      if (_hiscoreStr[i] == c)
+        return;
+      _hiscoreStr[i] = c;
+      //Mark(i+32);    //Score
+      Mark(i + 32 + 10); //HiScore
+    }
+
+    void Score(int16_t delta)
+    {
+      char str[8];
+      _score += delta;
+      if (DEMO == 0 && _score > _hiscore) _hiscore = _score;
+
+      if (_score > _lifescore && _score % 10000 > 0) {
+        _lifescore = (_score / 10000 + 1) * 10000;
+
+        LIFES++; // EVERY 10000 points = 1UP
+
+        for (uint8_t i = 0; i < LIFES; i++) {
+          _icons[0 + i] = PACMANICON;
+        }
+
+        //REDRAW LIFE and BONUS icons
+        for (uint8_t y = 34; y < 36; y++)
+          for (uint8_t x = 0; x < 28; x++) {
+            Draw(x, y, false);
+          }
+        _score = _score + 100;
+      }
+
+      sprintf(str, "%ld", _score);
+      uint8_t i = 7 - strlen(str);
+      uint8_t j = 0;
+      while (i < 7)
+        SetScoreChar(i++, str[j++]);
+      sprintf(str, "%ld", _hiscore);
+      i = 7 - strlen(str);
+      j = 0;
+      while (i < 7)
+        SetHiScoreChar(i++, str[j++]);
+    }
+
+    bool GetDot(uint8_t cx, uint8_t cy)
+    {
+      return (_dotRows[cy - 3] >> cx) & 1;
+    }
+
+    void EatDot(uint8_t cx, uint8_t cy)
+    {
+      if (!GetDot(cx, cy))
+        return;
+      _dotRows[cy - 3] &= ~(1UL << cx);
+      if (--_dotsLeft == 0)
+        GAMEWIN = 1; // No dots, GAME WIN!
+#if PACMAN_HEADLESS
+      uint64_t t0 = headlessNs();
+      RemoveDotSource(cy * 28 + cx);
+      dotNs += headlessNs() - t0;
+      dotsEaten++;
+      if (checkDots)
+        CheckDotField();
+#else
+      RemoveDotSource(cy * 28 + cx);
+#endif
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+      if (DEMO == 0) {
+        GameAudio.PlayWav(&pmChomp, false, 1.0);
+      }
+#endif
+      uint8_t t = GetTile(cx, cy);
+      if (t == PILL)
+      {
+        _frightenedTimer = 10 * FPS;
+        _frightenedCount = 0;
+        for (uint8_t i = 0; i < 4; i++)
+        {
+          if (_sprites.state[i] == RunState)
+          {
+            _sprites.state[i] = FrightenedState;
+            _sprites.dir[i] = OppositeDirection(_sprites.dir[i]);
+          }
+        }
+        Score(50);
+      }
+      else
+        Score(10);
+    }
+
+    void Init()
+    {
+      drawButtonFace(4, DEMO == 1 || GAMEPAUSED == 1);  // START / PAUSE
+
+      if (GAMEWIN == 1) {
+        GAMEWIN = 0;
+      } else {
+        LEVEL = START_LEVEL;
+        LIFES = START_LIFES;
+        ACTUALBONUS = 0; //actual bonus icon
+        ACTIVEBONUS = 0; //status of bonus
+
+        _score = 0;
+        _lifescore = 10000;
+
+        memset(_scoreStr, 0, sizeof(_scoreStr));
+        _scoreStr[5] = _scoreStr[6] = '0';
+      }
+
+
+      _inited = true;
+      _state = ReadyState;
+      _stateTimer = FPS / 2;
+      _frightenedCount = 0;
+      _frightenedTimer = 0;
+
+      const uint8_t* s = _initSprites;
+      for (int16_t i = 0; i < 5; i++)
+        InitSprite(i, s + i * 5);
+
+      //AND BONUS
+      InitSprite(BONUS, s + 5 * 5);
+      _BonusInactiveTimmer = BONUS_INACTIVE_TIME;
+      _BonusActiveTimmer = 0;
+
+      _scIndex = 0;
+      _scTimer = 1;
+
+      memset(_icons, 0, sizeof(_icons));
+
+      // SET BONUS icons
+      for (uint8_t i = 0; i < ACTUALBONUS; i++) {
+        _icons[13 - i] = BONUSICON + i;
+      }
+
+      // SET Lifes icons
+      for (uint8_t i = 0; i < LIFES; i++) {
+        _icons[0 + i] = PACMANICON;
+      }
+
+      //Draw LIFE and BONUS Icons
+      for (uint8_t y = 34; y < 36; y++)
+        for (uint8_t x = 0; x < 28; x++) {
+          Draw(x, y, false);
+        }
+
+      BuildNav();
+
+      //  Init dots from rom
+      _dotsLeft = 0;
+      for (uint8_t y = 3; y < 36 - 3; y++) // 30 interior lines
+      {
+        uint32_t row = 0;
+        for (uint8_t x = 0; x < 28; x++)
+        {
+          uint8_t t = GetTile(x, y);
+          if (t == 7 || t == 14)
+            row |= 1UL << x;
+        }
+        _dotRows[y - 3] = row;
+        _dotsLeft += __builtin_popcount(row);
+      }
+      BuildFields();
+      DrawAllBG();
+    }
+
+    // One simulation tick (1 / FPS s): input, game state and movement. Drawing is left to Render().
+    void Update()
+    {
+      // button events from the touch task since the previous tick, or from the replay
+      gameTick++;
+      _tickInput = 0;
+      DrainInput();
+      if (replay.Playing()) _tickInput = replay.Next();
+      replay.Record(_tickInput);
+      ApplyInput(_tickInput);
+
+      if (GAMEWIN == 1) {
+        levelsWon++;
+        LEVEL++;
+        Init();
+      }
+
+      // Start GAME
+      if (but_A && DEMO == 1 && GAMEPAUSED == 0) {
+        but_A = false;
+        DEMO = 0;
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+        GameAudio.PlayWav(&pmWav, false, 1.0);
+        // wait until done
+        //while(GameAudio.IsPlaying()){ }
+#endif
+        Init();
+      } else if (but_A && DEMO == 0 && GAMEPAUSED == 0) { // Or PAUSE GAME
+        but_A = false;
+        GAMEPAUSED = 1;
+        drawButtonFace(4, DEMO == 1 || GAMEPAUSED == 1);  // START / PAUSE
+      }
+
+      if (GAMEPAUSED && but_A && DEMO == 0) {
+        but_A = false;
+        GAMEPAUSED = 0;
+        drawButtonFace(4, DEMO == 1 || GAMEPAUSED == 1);  // START / PAUSE
+        if (!HUDONI2C) for (uint8_t tmpX = 11; tmpX < 17; tmpX++) Draw(tmpX, 20, false);
+      }
+
+      // Reset / Start GAME
+      if (but_B) {
+        but_B = false;
+        DEMO = 0;
+        Init();
+      } else if (!_inited) {
+        but_B = false;
+        DEMO = 1;
+        Init();
+      }
+
+      // Bitmap of dirty tiles, kept until the next Render()
+      _dirty = _dirtyBits;
+
+#if PACMAN_HEADLESS
+      if (!GAMEPAUSED) {
+        uint64_t t0 = headlessNs();
+        MoveAll();
+        moveNs += headlessNs() - t0;
+        moves++;
+      }
+#else
+      if (!GAMEPAUSED) MoveAll(); // IF GAME is PAUSED STOP ALL
+#endif
+    }
+
+    // Draws the state left by the Update() ticks since the previous call
+    void Render()
+    {
+      _dirty = _dirtyBits;
+
+      if (!HUDONI2C && ((ACTIVEBONUS == 0 && DEMO == 1) || GAMEPAUSED == 1)) for (uint8_t tmpX = 11; tmpX < 17; tmpX++) Draw(tmpX, 20, false); // Draw 'PAUSED' or 'DEMO' text
+
+      DrawAll();
+      memset(_dirtyBits, 0, sizeof(_dirtyBits));
+
+      if (HUDONI2C) UpdateHud();
+    }
+
+    // Hand the status over to the HUD task, it redraws the I2C display on its own
+    void UpdateHud()
+    {
+#if !PACMAN_HEADLESS
+      bsp_hud_state_t hud;
+      memset(&hud, 0, sizeof(hud));
+      hud.score = _score;
+      hud.hiscore = _hiscore;
+      hud.lifes = LIFES;
+      hud.level = LEVEL;
+      hud.bonus = ACTUALBONUS;
+      hud.demo = DEMO;
+      hud.paused = GAMEPAUSED;
+      bsp_hud_update(&hud);
+#endif
+    }
+
+    void ClearKeys()
+    {
+      but_A = false;
+      but_B = false;
+      memset(turnTick, 0, sizeof(turnTick));
+    }
+
+    // Presses are collected per tick, ApplyInput() then acts on them. Only the buttons matter
+    // to the game, not their order or time in the tick: that is what the replay keeps.
+    void HandleInput(const input_event_t &ev)
+    {
+      if (ev.button >= INPUT_BUTTON_MAX)
+        return;
+      _tickInput |= 1 << ev.button;
+      if (ev.button <= INPUT_BUTTON_DOWN)
+        turnUs[_buttonDir[ev.button]] = ev.t_us;   // for the latency trace
+    }
+
+    void ApplyInput(uint8_t buttons)
+    {
+      // a direction press goes to its buffer, the other directions keep theirs
+      for (uint8_t b = INPUT_BUTTON_UP; b <= INPUT_BUTTON_DOWN; b++)
+        if (buttons & (1 << b))
+          turnTick[_buttonDir[b]] = gameTick;
+      if (buttons & (1 << INPUT_BUTTON_A))    // debounced by the touch task, remote sends one per press
+        but_A = true;
+      if (buttons & (1 << INPUT_BUTTON_B))
+        but_B = true;
+    }
+
+    // Touch and remote control: everything that arrived since the previous tick, never waits.
+    // Headless games get the synthetic presses of headlessLatency(), or none and play the demo.
+    void DrainInput()
+    {
+      input_event_t ev;
+#if PACMAN_HEADLESS
+      while (headlessInputPop(&ev)) {
+        HandleInput(ev);
+      }
+#else
+      while (input_pop(&ev)) {
+        HandleInput(ev);
+      }
+
+      input_event_t remote[8];
+      int n;
+      do {
+        n = input_remote_poll(remote, 8);
+        for (int i = 0; i < n; i++) {
+          HandleInput(remote[i]);
+        }
+      } while (n == 8);
+#endif
+    }
+
+    // Seeded PRNG (xorshift32) instead of rand(): a seed gives the same game on any build
+    uint32_t Random()
+    {
+      gameSeed ^= gameSeed << 13;
+      gameSeed ^= gameSeed >> 17;
+      gameSeed ^= gameSeed << 5;
+      return gameSeed;
+    }
+
+    void InitSprite(uint8_t who, const uint8_t* s)
+    {
+      ClearKeys();
+      _sprites.Init(who, s);
+      uint8_t x = Random() % 20;
+      _sprites.Target(who, x, Random() % 20);
+    }
+
+    static uint32_t Fnv(const void* p, size_t n, uint32_t h = 2166136261u)
+    {
+      for (size_t i = 0; i < n; i++)
+        h = (h ^ ((const uint8_t*)p)[i]) * 16777619u;
+      return h;
+    }
+
+    // FNV-1a of the simulation state, two runs with the same seed give the same hash every frame
+    uint32_t Hash()
+    {
+      uint32_t h = 2166136261u;
+      auto mix = [&h](const void* p, size_t n) {
+        h = Fnv(p, n, h);
+      };
+      for (uint8_t i = 0; i < 5; i++)
+      {
+        SpriteState state = (SpriteState)_sprites.state[i];   // as wide as it used to be, same hashes
+        mix(&_sprites.x[i], sizeof(_sprites.x[i]));
+        mix(&_sprites.y[i], sizeof(_sprites.y[i]));
+        mix(&_sprites.dir[i], sizeof(_sprites.dir[i]));
+        mix(&state, sizeof(state));
+        mix(&_sprites.pentimer[i], sizeof(_sprites.pentimer[i]));
+        mix(&_sprites.speed[i], sizeof(_sprites.speed[i]));
+      }
+      mix(_dotRows, sizeof(_dotRows));
+      mix(&_score, sizeof(_score));
+      mix(&_state, sizeof(_state));
+      mix(&_stateTimer, sizeof(_stateTimer));
+      mix(&_frightenedTimer, sizeof(_frightenedTimer));
+      mix(&LEVEL, sizeof(LEVEL));
+      mix(&LIFES, sizeof(LIFES));
+      mix(&gameTick, sizeof(gameTick));
+      return h;
+    }
+
+    // Everything a game in progress needs to go on, in snapshot order. The level tables (_nav,
+    // _field, _dotsLeft) follow from it, input and drawing state start over.
+    template <typename F> void SnapshotFields(F io)
+    {
+      io(&LIFES, sizeof(LIFES));
+      io(&GAMEWIN, sizeof(GAMEWIN));
+      io(&GAMEOVER, sizeof(GAMEOVER));
+      io(&DEMO, sizeof(DEMO));
+      io(&LEVEL, sizeof(LEVEL));
+      io(&ACTUALBONUS, sizeof(ACTUALBONUS));
+      io(&ACTIVEBONUS, sizeof(ACTIVEBONUS));
+      io(&GAMEPAUSED, sizeof(GAMEPAUSED));
+      io(&PACMANFALLBACK, sizeof(PACMANFALLBACK));
+      io(&_BonusInactiveTimmer, sizeof(_BonusInactiveTimmer));
+      io(&_BonusActiveTimmer, sizeof(_BonusActiveTimmer));
+      io(&gameTick, sizeof(gameTick));
+      io(&gameSeed, sizeof(gameSeed));
+      io(&deaths, sizeof(deaths));
+      io(&levelsWon, sizeof(levelsWon));
+      io(&_sprites, sizeof(_sprites));
+      io(_dotRows, sizeof(_dotRows));
+      io(&_state, sizeof(_state));
+      io(&_score, sizeof(_score));
+      io(&_hiscore, sizeof(_hiscore));
+      io(&_lifescore, sizeof(_lifescore));
+      io(_scoreStr, sizeof(_scoreStr));
+      io(_hiscoreStr, sizeof(_hiscoreStr));
+      io(_icons, sizeof(_icons));
+      io(&_stateTimer, sizeof(_stateTimer));
+      io(&_frightenedTimer, sizeof(_frightenedTimer));
+      io(&_frightenedCount, sizeof(_frightenedCount));
+      io(&_scIndex, sizeof(_scIndex));
+      io(&_scTimer, sizeof(_scTimer));
+    }
+
+    size_t SnapshotSize()
+    {
+      size_t n = SNAPSHOT_HEADER + sizeof(uint32_t);
+      SnapshotFields([&n](const void* v, size_t size) {
+        n += size;
+      });
+      return n;
+    }
+
+    // The game as it is, returns the bytes written (0 when max is too small)
+    size_t Snapshot(uint8_t* buf, size_t max)
+    {
+      size_t n = SnapshotSize();
+      if (n > max)
+        return 0;
+      const uint8_t header[SNAPSHOT_HEADER] = { 'P', 'M', 'S', SNAPSHOT_VERSION };
+      memcpy(buf, header, SNAPSHOT_HEADER);
+      uint8_t* p = buf + SNAPSHOT_HEADER;
+      SnapshotFields([&p](const void* v, size_t size) {
+        memcpy(p, v, size);
+        p += size;
+      });
+      uint32_t check = Fnv(buf, n - sizeof(check));
+      memcpy(p, &check, sizeof(check));
+      return n;
+    }
+
+    // Goes on with a snapshot of this build, false (and nothing changed) when it is not one.
+    // A player's game comes back paused. The screen is drawn once, all of it.
+    bool Restore(const uint8_t* buf, size_t len)
+    {
+      uint32_t check;
+      if (len != SnapshotSize() || buf[0] != 'P' || buf[1] != 'M' || buf[2] != 'S' || buf[3] != SNAPSHOT_VERSION)
+        return false;
+      memcpy(&check, buf + len - sizeof(check), sizeof(check));
+      if (check != Fnv(buf, len - sizeof(check)))
+        return false;
+
+      const uint8_t* p = buf + SNAPSHOT_HEADER;
+      SnapshotFields([&p](void* v, size_t size) {
+        memcpy(v, p, size);
+        p += size;
+      });
+
+      _dotsLeft = 0;
+      for (uint8_t r = 0; r < 36 - 6; r++)
+        _dotsLeft += __builtin_popcount(_dotRows[r]);
+      BuildNav();
+      BuildFields();
+
+      memcpy(_sprites.lastx, _sprites.x, sizeof(_sprites.x));
+      memcpy(_sprites.lasty, _sprites.y, sizeof(_sprites.y));
+
+      ClearKeys();
+      latTurnUs = 0;
+      replay.Stop();
+      _inited = true;
+      if (DEMO == 0)
+        GAMEPAUSED = 1;
+
+      memset(updateMap, 0, sizeof(updateMap));
+      memset(_dirtyBits, 0, sizeof(_dirtyBits));
+      drawButtonFace(4, DEMO == 1 || GAMEPAUSED == 1);  // START / PAUSE
+      DrawAllBG();
+      return true;
+    }
+};
+
+/******************************************************************************/
+/*   SETUP                                                                    */
+/******************************************************************************/
+
+#define BLACK 0x0000 // 16bit BLACK Color
+
+/******************************************************************************/
+/*   LOOP                                                                     */
+/******************************************************************************/
+
+/*
+  static IRAM_ATTR bool lvgl_read_cb(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
+  {
+    static uint8_t tp_num = 0;
+    static uint16_t x = 0, y = 0;
+
+    touchPadRead(&tp_num, &x, &y);
+
+    if (0 == tp_num) {
+        data->state = LV_INDEV_STATE_REL;
+    } else {
+        // Swap xy order and invert y direction
+        data->point.x = y;
+        data->point.y = LV_VER_RES_MAX - x - 1;
+        data->state = LV_INDEV_STATE_PR;
+    }
+
+    return false;
+  }
+*/
+
+
+#if !PACMAN_HEADLESS
+Playfield _game;
+
+// Tiles are collected and sent to the display in batches, buffers from the DMA pool
+#define TILE_BATCH  16
+static uint16_t *tileBuffers[TILE_BATCH];
+static lcd_rect_t tileRects[TILE_BATCH];
+static void *tilePixels[TILE_BATCH];
+static int tileCount = 0;
+
+bool allocTiles() {
+  for (int i = 0; i < TILE_BATCH; i++) {
+    if (tileBuffers[i] == NULL) tileBuffers[i] = (uint16_t *)lcd_buf_alloc(16 * 16 * sizeof(uint16_t));
+    if (tileBuffers[i] == NULL) return false;
+  }
+  return true;
+}
+
+static uint32_t tileProbeUs = 0;
+
+void flushTiles() {
+  if (tileCount == 0) return;
+  if (tileProbeUs) bsp_lcd_latency_probe(tileProbeUs);
+  tileProbeUs = 0;
+  bsp_lcd_flush_batch(tileRects, tilePixels, tileCount);
+  tileCount = 0;
+}
+
+// Latency probe for the batch being collected
+void probeTiles(uint32_t t_us) {
+  tileProbeUs = t_us;
+}
+
+void drawIndexedmap(uint8_t* indexmap, uint16_t x, uint16_t y) {
+  //x += (240 - 224) / 2;
+  //y += (320 - 288) / 2;
+
+  uint8_t i = 0;
+  if (tileCount == TILE_BATCH) flushTiles();
+  uint16_t *screenBuffer = tileBuffers[tileCount];
+  if (screenBuffer == NULL) return;
+  //memset(screenBuffer, 0, 16*16*2);
+
+  for (uint8_t tmpY = 0; tmpY < 8; tmpY++) {
+    for (uint8_t tmpX = 0; tmpX < 8; tmpX++) {
+      // rotate the screen 90 counterclockwise considering image duplication
+      uint16_t xt = 2 * tmpY;
+      uint16_t yt = 14 - 2 * tmpX;
+
+      // duplicate width and height of the game screen (240x320 ==> 480x640)
+      screenBuffer[xt + yt * 16] =  screenBuffer[xt + 1 + yt * 16] = 
+      screenBuffer[xt + (yt + 1) * 16] = screenBuffer[xt + 1 + (yt + 1) * 16] = _paletteW[indexmap[i]];
+      i++;
+    }
+  }
+  // rotate the screen 90 counterclockwise considering image duplication
+  uint16_t xt = 2 * y;
+  uint16_t yt = SCR_HEIGHT - 2 * (x + 8);
+
+  tileRects[tileCount] = { xt, yt, xt + 16, yt + 16 };
+  tilePixels[tileCount] = (void *) screenBuffer;
+  tileCount++;
+}
+
+// Rotated dimensions based on a SCR_w = 480 and SCR_H = 800
+//#define BUT_W       100
+//#define BUT_H       55
+#define BUT_NUM     5      // removed BUT B = reset
+#define BUT_X       0
+#define BUT_Y       1
+#define BUT_COLOR   2
+#define BUT_W       3
+#define BUT_H       4
+
+const uint16_t buttons[BUT_NUM][5] = {
+  // Using rotated coordintes the same way that the touch sensor does
+  // X0 is 0 .. SCR_HEIGHT -1
+  // Y0 is 0 .. SCR_WIDTH - 1
+  //X0   Y0    color          W    H
+  { 255, 610, _paletteW[15], 100, 55},  // UP
+  { 370, 675, _paletteW[15], 100, 55},  // LEFT
+  { 140, 675, _paletteW[15], 100, 55},  // RIGHT
+  { 255, 740, _paletteW[15], 100, 55},  // DOWN
+  { 0,   620, _paletteW[6],  60,  60},   // A
+  /*
+    { 610, 255, _paletteW[15], 100, 55},  // UP
+    { 675, 370, _paletteW[15], 100, 55},  // LEFT
+    { 675, 140, _paletteW[15], 100, 55},  // RIGHT
+    { 740, 255, _paletteW[15], 100, 55},  // DOWN
+    { 620,   0, _paletteW[6],  60,  60},   // A
+  */
+  //  { 10,  640, _paletteW[6]},   // A
+  //  { 10,  740, _paletteW[1]},   // B
+};
+
+int8_t getTouchedButton(uint16_t x, uint16_t y) {
+  // ft5x06 driver inverts X coordinate and also rotates it
+  uint8_t delta = 15;
+  //x = SCR_HEIGHT - 1 - x;
+  int8_t pressedButton = -1;
+  for (uint8_t b = 0; b < BUT_NUM; b++) {
+    if (b > BUT_NUM - 1) delta = 0; // Buttons A and B are not "expanded" in the touch area
+    if (x >= buttons[b][BUT_X] - delta && x < buttons[b][BUT_X] + buttons[b][BUT_W] + delta
+        && y >= buttons[b][BUT_Y] - delta && y < buttons[b][BUT_Y] + buttons[b][BUT_H] + delta) {
+      pressedButton = b;
+      break;
+    }
+  }
+  return pressedButton;
+}
+
+void drawButtonFace(uint8_t btId, bool play) {
+  // rotate the coordinates by sawpping X & Y
+  uint16_t x0 = buttons[btId][BUT_Y];
+  uint16_t y0 = buttons[btId][BUT_X];
+
+  uint16_t _w = buttons[btId][BUT_H], _h = buttons[btId][BUT_W];
+  uint8_t r = min(_w, _h) / 4; // Corner radius
+  int16_t _x1 = 0, _y1 = 0;
+
+  size_t canvasSize = _w * _h * sizeof(uint16_t);
+  uint16_t *canvas = (uint16_t *)lcd_buf_alloc(canvasSize);
+  if (canvas == NULL) {
+    printf("Memeory Allocation error in drawButtonFace()\n");
+    return;
+  } 
+  memset(canvas, 0, canvasSize);
+  tft16bits.setBuffer(canvas);
+  tft16bits.setWidthHeight(_w, _h);
+
+  tft16bits.fillRoundRect(_x1, _y1, _w, _h, r, buttons[btId][BUT_COLOR]);
+
+  switch (btId) {
+    case 0:   // UP
+      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
+      tft16bits.fillTriangle(_x1 + 10, _y1 + _h / 2, _x1 + _w - 15, _y1 + _h / 2 + 20, _x1 + _w - 15, _y1 + _h / 2 - 20, BLACK);
+      //tft16bits.fillRect(_x1 + 10, _y1 + _h / 2, 4, 4, RED);
+      //tft16bits.fillRect(_x1 + _w - 15, _y1 + _h / 2 + 20, 4, 4, BLUE);
+      //tft16bits.fillRect(_x1 + _w - 15, _y1 + _h / 2 - 20, 4, 4, BLACK);
+      break;
+    case 1:   // LEFT
+      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
+      tft16bits.fillTriangle(_x1 + _w - 15, _y1 + _h / 2 - 15, _x1 + 10, _y1 + _h / 2 - 15, _x1 + _w / 2, _y1 + _h / 2 + 20, BLACK);
+      //tft16bits.fillRect(_x1 + _w - 15, _y1 + _h / 2 - 15, 4, 4, RED);
+      //tft16bits.fillRect(_x1 + 10, _y1 + _h / 2 - 15, 4, 4, BLUE);
+      //tft16bits.fillRect(_x1 + _w / 2, _y1 + _h / 2 + 20, 4, 4, BLACK);
+      break;
+    case 2:   // RIGHT
+      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
+      tft16bits.fillTriangle(_x1 + _w - 15, _y1 + _h / 2 + 15, _x1 + 10, _y1 + _h / 2 + 15, _x1 + _w / 2, _y1 + _h / 2 - 20, BLACK);
+      break;
+    case 3:   // DOWN
+      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, RED);
+      tft16bits.fillTriangle(_x1 + _w - 10, _y1 + _h / 2, _x1 + 15, _y1 + _h / 2 + 20, _x1 + 15, _y1 + _h / 2 - 20, BLACK);
+      break;
+    case 4:   // START/PAUSE
+      tft16bits.drawRoundRect(_x1, _y1, _w, _h, r, CYAN);
+      if (play) {
+        // Button Action is PLAY
+        tft16bits.fillTriangle(_x1 + _w - 10, _y1 + _h / 2 + 15, _x1 + 10, _y1 + _h / 2 + 15, _x1 + _w / 2, _y1 + _h / 2 - 20, RED);
+      } else {
+        // Button Action is PAUSE
+        tft16bits.fillRect(_x1 + 10, _y1 + _h / 2 + 4, 40, 15, RED);
+        tft16bits.fillRect(_x1 + 10, _y1 + 10, 40, 15, RED);
+      }
+      break;
+  }
+  _x1 = x0 + _w;
+  _y1 = y0 + _h;
+  // the canvas goes back to the pool when the flush is done
+  bsp_lcd_flush_owned(x0, y0, _x1, _y1, (void *)canvas);
+}
+
+void drawAllButtons() {
+  for (uint8_t b = 0; b < BUT_NUM; b++) {
+#if 1
+    drawButtonFace(b);
+#else
+    // just rectagles as button - testing
+    for (uint16_t y1 = 0; y1 < buttons[b][BUT_W]; y1++)
+      for (uint16_t x1 = 0; x1 < buttons[b][BUT_H]; x1++) {
+        screenBuffer[x0 + x1 + (y0 + y1) * SCR_WIDTH] = buttons[b][BUT_COLOR];
+      }
+#endif
+  }
+}
+
+// The recording of the session as hex lines on the console, `xxd -r -p` makes it a replay file again
+void replayDump(InputReplay& replay) {
+  size_t len, tailLen;
+  uint8_t tail[6];
+  const uint8_t* data = replay.Recorded(&len, tail, &tailLen);
+  printf("replay: %u bytes%s\n", (unsigned)(len + tailLen), replay.Full() ? ", cut short (buffer full)" : "");
+  for (size_t i = 0; i < len + tailLen; i++)
+    printf("%02x%s", i < len ? data[i] : tail[i - len], (i % 32 == 31 || i == len + tailLen - 1) ? "\n" : "");
+}
+
+// Resume point of a player's game: in RTC memory every SNAPSHOT_TICKS, in NVS too when the game
+// is paused or a level starts. Either survives a reset, NVS also a power loss.
+#define SNAPSHOT_TICKS  FPS
+
+static uint8_t snapshotBuf[BSP_SNAPSHOT_MAX];
+static bool snapshotKept = false;
+
+static void snapshotResume() {
+  for (int persisted = 0; persisted < 2; persisted++) {
+    size_t len = bsp_snapshot_load(snapshotBuf, sizeof(snapshotBuf), persisted);
+    uint32_t t0 = micros();
+    if (len && _game.Restore(snapshotBuf, len)) {
+      printf("snapshot: resumed level %u from %s, %u bytes, restore %lu us\n", _game.LEVEL,
+             persisted ? "NVS" : "RTC", (unsigned)len, (unsigned long)(micros() - t0));
+      snapshotKept = true;
+      return;
+    }
+  }
+}
+
+static void snapshotUpdate() {
+  static uint32_t savedTick = 0;
+  static uint8_t savedPaused = 0, savedLevel = 0;
+
+  if (_game.DEMO) {
+    if (snapshotKept) bsp_snapshot_clear();   // the game is over, nothing to resume
+    snapshotKept = false;
+    return;
+  }
+  bool persist = (_game.GAMEPAUSED && !savedPaused) || _game.LEVEL != savedLevel;
+  if (!persist && _game.gameTick - savedTick < SNAPSHOT_TICKS)
+    return;
+
+  uint32_t t0 = micros();
+  size_t len = _game.Snapshot(snapshotBuf, sizeof(snapshotBuf));
+  uint32_t t1 = micros();
+  bsp_snapshot_save(snapshotBuf, len, persist);
+  snapshotKept = true;
+  if (persist) {
+    printf("snapshot: %u bytes, %lu us, stored in %lu us\n", (unsigned)len, (unsigned long)(t1 - t0),
+           (unsigned long)(micros() - t1));
+  }
+  savedTick = _game.gameTick;
+  savedPaused = _game.GAMEPAUSED;
+  savedLevel = _game.LEVEL;
+}
+
+#ifdef PACMAN_REPLAY
+// const uint8_t replayData[], const size_t replayDataLen: a replay played from boot on
+#include PACMAN_REPLAY
+#endif
+
+void setup() {
+  uint32_t bootStart = micros();
+  lcd_driver_install();
+  if (!allocTiles()) {
+    printf("Memeory Allocation error in allocTiles()\n");
+  }
+#if BOARD_HUD_ON_I2C_DISP
+  HUDONI2C = bsp_hud_start(playTiles);
+#endif
+  
+/*
+// ===> POR ALGUM MOTIVO alocar o PSRAM buffer aqui gera um ERRO no APP todo...
+  if (!tft16bits.createPSRAMFrameBuffer()) {
+    log_e("Can't allocate the screen buffer - check PSRAM.");
+    while (1);
+  }
+  screenBuffer = tft16bits.getBuffer();
+  //tft16bits.setRotation(3);
+*/
+
+#if 0
+  // clear screen with black
+  for (uint32_t i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++)
+    screenBuffer[i] = 0;
+  printf("\n\nCLEAR SCREEN...");
+  bsp_lcd_flush(0, 0, SCR_WIDTH - 1, SCR_HEIGHT - 1, (void *)screenBuffer);
+  printf("\n\nCLEAR SCREEN... DONE!");
+  delay(2000);
+  printf("\nNExT...");
+#endif
+#if 0
+{
+  printf("\n Drawing again...START!\n");
+  uint16_t tile[64];
+  int xs = BOARD_DISP_PARALLEL_HRES / 8;
+  int ys = BOARD_DISP_PARALLEL_VRES / 8;
+  for (int y = 0; y < ys; y++)
+    for (int x = 0; x < xs; x++) {
+       uint16_t color = (y<<5) + (x<<1);
+       memset(tile, color, sizeof(tile));
+       //printf("drawing (%d, %d) color %x in screen\n===============\n", x*8, y*8, color);
+       //bsp_lcd_flush(x * 8, y * 8, 8, 8, (void *)tile);
+       bsp_lcd_flush( x * 8, y * 8, x * 8 + 8, y * 8 + 8, (void *)tile);
+
+    }
+  printf("\n Drawing again...DONE!\n");
+  //delay(3000);
+}
+#endif
+#if 0
+  printf("\n NOVO REDESENHO DA TELA...\n");
+  uint16_t tile[64];
+  memset(tile, 0, sizeof(tile));
+  int xs = SCR_WIDTH / 8;
+  int ys = SCR_HEIGHT / 8;
+  for (int y = 0; y < ys; y++)
+    for (int x = 0; x < xs; x++) {
+       //uint16_t color = (y<<6) + x;
+       //memset(tile, color, sizeof(tile));
+       //printf("\ndrawing (%d, %d) color %x in screen\n===============", x*8, y*8, 0);
+       //lcd_parallel8080_draw(lcd_parallel8080, x * 8, y * 8, x * 8 + 7, y * 8 + 7, (void *)tile);
+       bsp_lcd_flush(x * 8, y * 8, x * 8 + 8, y * 8 + 8, (void *)tile);
+    }
+  printf("\n\nCLEAR SCREEN... DONE ==> using rectangles... !");
+  //delay(5000);
+#endif
+  // Draw touch screen buttons
+  drawAllButtons();
+  bsp_lcd_buf_report();
+  // touch sampling runs on its own task from now on
+  if (!input_start(getTouchedButton)) {
+    printf("input_start failed\n");
+  }
+  input_remote_start();
+#ifndef PACMAN_REPLAY
+  snapshotResume();
+#else
+  uint32_t replaySeed;
+  if (!InputReplay::Seed(replayData, replayDataLen, &replaySeed) || replaySeed != _game.gameSeed ||
+      !_game.replay.Play(replayData, replayDataLen)) {
+    printf("replay: not a replay of seed %u\n", (unsigned)_game.gameSeed);
+  }
+#endif
+  printf("setup: %lu ms\n", (unsigned long)((micros() - bootStart) / 1000));
+  //  drawButton(_paletteW[15], 620, 255);  // UP
+  //  drawButton(_paletteW[15], 680, 370);  // LEFT
+  //  drawButton(_paletteW[15], 680, 140);  // RIGHT
+  //  drawButton(_paletteW[15], 740, 255);  // DOWN
+
+  //  drawButton(_paletteW[6], 640, 10);  // A
+  //  drawButton(_paletteW[1], 720, 10);  // B
+
+  //printf("\n====================\nPacman DEMO -- Starting.\n\n");
+
+#if 0
+#if(BOARD_TYPE == BOARD_TYPE_HMI)
+  // Testing Audio System and Game Snd Fx
+  // Game_Audio_Wav_Class pointer, Shall Interrupt Current sound, float sampleRateMultiplier
+  delay(500); GameAudio.PlayWav(&pmChomp, false, 1.0);
+  while (GameAudio.IsPlaying());  // wait until done
+  delay(500); GameAudio.PlayWav(&pmWav, false, 1.0);
+  while (GameAudio.IsPlaying());  // wait until done
+  delay(500); GameAudio.PlayWav(&pmDeath, true, 1.0);
+  while (GameAudio.IsPlaying());  // wait until done
+  delay(500); GameAudio.PlayWav(&pmEatGhost, true, 1.0);
+  while (GameAudio.IsPlaying());  // wait until done
+#endif
+#endif
+}
+
+// Fixed timestep: the simulation runs FPS ticks per second whatever the render time,
+// a render follows the ticks that were due. A slow render is caught up with MAX_CATCHUP
+// ticks at most, the rest of the time is dropped instead of making the next render slower.
+#define TICK_US       (1000000 / FPS)
+#define MAX_CATCHUP   4
+#define RATE_REPORT_TICKS (10 * FPS)
+
+// Ticks, renders and dropped time every RATE_REPORT_TICKS on the console, to check the timestep
+#ifndef PACMAN_SIM_REPORT
+#define PACMAN_SIM_REPORT 0
+#endif
+
+void loop() {
+  static uint32_t lastUs = micros();
+  static uint32_t lagUs = 0;
+  static uint32_t ticks = 0, renders = 0, droppedUs = 0;
+
+  uint32_t nowUs = micros();
+  lagUs += nowUs - lastUs;
+  lastUs = nowUs;
+  if (lagUs > MAX_CATCHUP * TICK_US) {
+    droppedUs += lagUs - MAX_CATCHUP * TICK_US;
+    lagUs = MAX_CATCHUP * TICK_US;
+  }
+  if (lagUs < TICK_US) {
+    delay(1);   // touch is read by the input task, nothing to do until the next tick
+    return;
+  }
+
+  // calculate next game screen, considering Player interaction and game speed
+  while (lagUs >= TICK_US) {
+    _game.Update();
+    lagUs -= TICK_US;
+    ticks++;
+  }
+  _game.Render();
+  renders++;
+  bsp_lcd_frame_done();
+  snapshotUpdate();
+
+#if PACMAN_SIM_REPORT
+  if (ticks >= RATE_REPORT_TICKS) {
+    printf("sim %u ticks, %u renders, %u ms dropped\n", (unsigned)ticks, (unsigned)renders, (unsigned)(droppedUs / 1000));
+    ticks = renders = droppedUs = 0;
+  }
+#endif
+
+  static uint32_t latReported = 0;
+  if (input_latency_count() - latReported >= LAT_REPORT_TURNS) {
+    latReported = input_latency_count();
+    input_latency_report();
+  }
+  // Player interaction with the TouchScreen comes from the input task, see DrainInput()
+}
+
+#else // PACMAN_HEADLESS
+
+// Tiles are composed as on the device and counted, not sent anywhere. Per thread, games run in parallel.
+static thread_local uint32_t headlessTiles = 0;
+
+void flushTiles() {}
+void probeTiles(uint32_t) {}
+void drawButtonFace(uint8_t, bool) {}
+void replayDump(InputReplay&) {}   // -p compares the whole recording instead
+
+void drawIndexedmap(uint8_t*, uint16_t, uint16_t) {
+  headlessTiles++;
+}
+
+// Presses the game takes in at its next tick, and the press to turn latencies seen, per thread
+static thread_local std::vector<input_event_t> headlessEvents;
+static thread_local std::vector<uint32_t> headlessTurnTicks;
+
+bool headlessInputPop(input_event_t* ev) {
+  if (headlessEvents.empty()) return false;
+  *ev = headlessEvents.front();
+  headlessEvents.erase(headlessEvents.begin());
+  return true;
+}
+
+void headlessTurn(uint32_t ticks) {
+  headlessTurnTicks.push_back(ticks);
+}
+
+static double headlessSeconds() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+uint64_t headlessNs() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
+struct HeadlessResult {
+  uint32_t hash;
+  uint32_t deaths;
+  uint32_t levelsWon;
+};
+
+// One demo game of the given length, hashed every frame
+static HeadlessResult headlessGame(uint32_t seed, uint32_t frames, bool trace) {
+  std::unique_ptr<Playfield> game(new Playfield(seed));
+  uint32_t hash = 0;
+  for (uint32_t f = 0; f < frames; f++) {
+    game->Update();
+    game->Render();
+    uint32_t h = game->Hash();
+    if (trace) printf("%u %08x\n", (unsigned)f, (unsigned)h);
+    hash = (hash ^ h) * 16777619u;
+  }
+  return { hash, game->deaths, game->levelsWon };
+}
+
+// Work stealing: every worker owns a range of games and takes from its front, an idle worker
+// takes the back half of another worker's range. Games differ in cost, nobody waits at the end.
+struct HeadlessWorker {
+  std::mutex lock;
+  uint32_t next, end;
+};
+
+static bool headlessTake(std::vector<HeadlessWorker>& workers, size_t self, uint32_t* game) {
+  {
+    std::lock_guard<std::mutex> guard(workers[self].lock);
+    if (workers[self].next < workers[self].end) {
+      *game = workers[self].next++;
+      return true;
+    }
+  }
+  for (size_t k = 1; k < workers.size(); k++) {
+    HeadlessWorker& victim = workers[(self + k) % workers.size()];
+    uint32_t from, to;
+    {
+      std::lock_guard<std::mutex> guard(victim.lock);
+      if (victim.next >= victim.end) continue;
+      to = victim.end;
+      from = to - (to - victim.next + 1) / 2;
+      victim.end = from;
+    }
+    std::lock_guard<std::mutex> guard(workers[self].lock);
+    workers[self].next = from + 1;
+    workers[self].end = to;
+    *game = from;
+    return true;
+  }
+  return false;   // ranges only shrink: all empty means done
+}
+
+// Games first .. first + count - 1 on the threads, returns the wall time
+static double headlessBatch(std::vector<HeadlessResult>& results, uint32_t first, uint32_t count, uint32_t frames,
+                            uint32_t seed, unsigned threads) {
+  std::vector<HeadlessWorker> workers(threads);
+  for (unsigned t = 0; t < threads; t++) {
+    workers[t].next = first + (uint64_t)count * t / threads;
+    workers[t].end = first + (uint64_t)count * (t + 1) / threads;
+  }
+
+  double start = headlessSeconds();
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; t++) {
+    pool.emplace_back([&, t]() {
+      uint32_t game;
+      while (headlessTake(workers, t, &game))
+        results[game] = headlessGame(seed + game, frames, false);
+    });
+  }
+  for (std::thread& th : pool) th.join();
+  return headlessSeconds() - start;
+}
+
+// pacman_headless [frames] [seed] [-t]
+//   One game. A frame is one simulation tick and its render. -t prints the state hash of every
+//   frame, two runs diff to the first frame that is not the same.
+// Plays a replay file, its length unless frames is given. The game records while it plays:
+// a deterministic game records the same replay again.
+static bool headlessLoad(const char* path, std::vector<uint8_t>& data, uint32_t* seed) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    printf("%s: cannot open\n", path);
+    return false;
+  }
+  int c;
+  while ((c = fgetc(f)) != EOF) data.push_back((uint8_t)c);
+  fclose(f);
+
+  if (!InputReplay::Seed(data.data(), data.size(), seed)) {
+    printf("%s: not a replay\n", path);
+    return false;
+  }
+  return true;
+}
+
+static int headlessReplay(const char* path, uint32_t frames) {
+  std::vector<uint8_t> data;
+  uint32_t seed;
+  if (!headlessLoad(path, data, &seed)) return 1;
+  std::unique_ptr<Playfield> game(new Playfield(seed));
+  game->replay.Play(data.data(), data.size());
+
+  double start = headlessSeconds();
+  uint32_t hash = 0, played = 0;
+  for (; frames ? played < frames : game->replay.Playing(); played++) {
+    game->Update();
+    game->Render();
+    hash = (hash ^ game->Hash()) * 16777619u;
+  }
+  double seconds = headlessSeconds() - start;
+
+  size_t len, tailLen;
+  uint8_t tail[6];
+  const uint8_t* rec = game->replay.Recorded(&len, tail, &tailLen);
+  std::vector<uint8_t> again(rec, rec + len);
+  again.insert(again.end(), tail, tail + tailLen);
+
+  printf("%u bytes, seed %u, %u frames (%.1f min) in %.3f s, %.0f frames/s, %u deaths, %u levels won, hash %08x\n",
+         (unsigned)data.size(), (unsigned)seed, (unsigned)played, played / (60.0 * FPS), seconds, played / seconds,
+         (unsigned)game->deaths, (unsigned)game->levelsWon, (unsigned)hash);
+  printf("recorded again: %s\n", again == data ? "same" : "different");
+  return again == data ? 0 : 2;
+}
+
+// Press to turn latency of Pacman: ticks from the one that takes a direction press in to the one
+// Pacman turns in, the render after it shows the turn. The presses come from a replay, or are
+// synthetic as with INPUT_SYNTHETIC_MS on the device: A while the demo runs, then a direction every
+// `every` ticks, around the maze.
+static int headlessLatency(const char* path, uint32_t frames, uint32_t every, uint32_t seed) {
+  static const uint8_t dirs[] = { INPUT_BUTTON_UP, INPUT_BUTTON_LEFT, INPUT_BUTTON_DOWN, INPUT_BUTTON_RIGHT };
+  std::vector<uint8_t> data;
+  if (path && !headlessLoad(path, data, &seed)) return 1;
+  std::unique_ptr<Playfield> game(new Playfield(seed));
+  if (path) game->replay.Play(data.data(), data.size());
+
+  uint32_t played = 0, presses = 0;
+  headlessEvents.clear();
+  headlessTurnTicks.clear();
+  for (; played < frames && (!path || game->replay.Playing()); played++) {
+    input_event_t ev = { (uint32_t)((uint64_t)played * 1000000 / FPS), INPUT_BUTTON_A };
+    if (!path && game->DEMO == 1) {
+      headlessEvents.push_back(ev);
+    } else if (!path && played % every == 0) {
+      ev.button = dirs[presses++ % 4];
+      headlessEvents.push_back(ev);
+    }
+    game->Update();
+    game->Render();
+  }
+
+  std::vector<uint32_t>& t = headlessTurnTicks;
+  if (path)
+    printf("%u frames of %s: %u turns\n", (unsigned)played, path, (unsigned)t.size());
+  else
+    printf("%u frames, a press every %u ticks: %u presses, %u turns\n", (unsigned)played, (unsigned)every,
+           (unsigned)presses, (unsigned)t.size());
+  if (t.empty()) return 2;
+
+  std::sort(t.begin(), t.end());
+  uint32_t p50 = t[(t.size() * 50 + 99) / 100 - 1], p95 = t[(t.size() * 95 + 99) / 100 - 1], max = t.back();
+  printf("press to turn: p50 %u, p95 %u, max %u ticks (%.0f / %.0f / %.0f ms at %d ticks/s)\n", (unsigned)p50,
+         (unsigned)p95, (unsigned)max, p50 * 1000.0 / FPS, p95 * 1000.0 / FPS, max * 1000.0 / FPS, FPS);
+  for (uint32_t k = 0; k <= max; k++) {
+    size_t n = std::upper_bound(t.begin(), t.end(), k) - std::lower_bound(t.begin(), t.end(), k);
+    if (n) printf("%3u ticks: %u\n", (unsigned)k, (unsigned)n);
+  }
+  return 0;
+}
+
+// Snapshot after frames, then the game goes on for more frames, and so does a second game restored
+// from the snapshot: both must end with the same hash.
+static int headlessSnapshot(uint32_t frames, uint32_t more, uint32_t seed) {
+  const int reps = 1000;
+  std::unique_ptr<Playfield> game(new Playfield(seed));
+  std::unique_ptr<Playfield> copy(new Playfield(seed + 1));
+  for (uint32_t f = 0; f < frames; f++) {
+    game->Update();
+    game->Render();
+  }
+
+  uint8_t buf[512];
+  size_t len = 0;
+  double t0 = headlessSeconds();
+  for (int i = 0; i < reps; i++)
+    len = game->Snapshot(buf, sizeof(buf));
+  double t1 = headlessSeconds();
+  bool ok = true;
+  for (int i = 0; i < reps; i++)
+    ok = copy->Restore(buf, len) && ok;
+  double t2 = headlessSeconds();
+
+  uint32_t hash[2] = { 0, 0 };
+  Playfield* games[2] = { game.get(), copy.get() };
+  for (int g = 0; g < 2; g++)
+    for (uint32_t f = 0; f < more; f++) {
+      games[g]->Update();
+      games[g]->Render();
+      hash[g] = (hash[g] ^ games[g]->Hash()) * 16777619u;
+    }
+
+  printf("snapshot %u bytes at frame %u: %.2f us, restore with full redraw %.2f us\n", (unsigned)len,
+         (unsigned)frames, (t1 - t0) * 1e6 / reps, (t2 - t1) * 1e6 / reps);
+  printf("%u more frames: hash %08x, restored %08x, %s\n", (unsigned)more, (unsigned)hash[0], (unsigned)hash[1],
+         ok && hash[0] == hash[1] ? "same" : "different");
+  return ok && hash[0] == hash[1] ? 0 : 2;
+}
+
+// MoveAll() in a demo game, with Chase() on the _nav table and through GetTile() as before it. The
+// two games must play the same. Best of reps runs each, taken in turns so both see the same machine.
+static int headlessMoveAll(uint32_t frames, uint32_t seed) {
+  const int reps = 5;
+  double best[2] = { 1e9, 1e9 };
+  uint32_t hash[2] = { 0, 0 };
+  for (int r = 0; r < reps; r++)
+    for (int tiles = 0; tiles < 2; tiles++) {
+      std::unique_ptr<Playfield> game(new Playfield(seed));
+      game->tileChase = tiles;
+      hash[tiles] = 0;
+      for (uint32_t f = 0; f < frames; f++) {
+        game->Update();
+        game->Render();
+        hash[tiles] = (hash[tiles] ^ game->Hash()) * 16777619u;
+      }
+      best[tiles] = std::min(best[tiles], (double)game->moveNs / game->moves);
+    }
+
+  printf("MoveAll over %u frames, best of %d: nav table %.1f ns, GetTile %.1f ns, %.2fx, hash %08x %08x, %s\n",
+         (unsigned)frames, reps, best[0], best[1], best[1] / best[0], (unsigned)hash[0], (unsigned)hash[1],
+         hash[0] == hash[1] ? "same" : "different");
+  return hash[0] == hash[1] ? 0 : 2;
+}
+
+// The dots field kept up to date as dots are eaten, against searching it again each time: demo
+// games with every dot checked, the time of both, and of BuildFields() with all the fields.
+static int headlessFields(uint32_t frames, uint32_t games, uint32_t seed) {
+  const int reps = 1000;
+  uint64_t eaten = 0, mismatches = 0, dotNs = 0, fullNs = 0, deaths = 0, levels = 0;
+  double build = 0;
+  for (uint32_t g = 0; g < games; g++) {
+    std::unique_ptr<Playfield> game(new Playfield(seed + g));
+    game->checkDots = true;
+    for (uint32_t f = 0; f < frames; f++) {
+      game->Update();
+      game->Render();
+    }
+    eaten += game->dotsEaten;
+    mismatches += game->dotMismatches;
+    dotNs += game->dotNs;
+    fullNs += game->fullNs;
+    deaths += game->deaths;
+    levels += game->levelsWon;
+
+    double t0 = headlessSeconds();
+    for (int i = 0; i < reps; i++)
+      game->BuildFields();
+    build += headlessSeconds() - t0;
+  }
+  if (eaten == 0) return 2;
+
+  printf("%u games x %u frames: %llu dots, incremental %.2f us, full search %.2f us per dot, %.1fx, %llu different\n",
+         (unsigned)games, (unsigned)frames, (unsigned long long)eaten, dotNs / 1e3 / eaten, fullNs / 1e3 / eaten,
+         (double)fullNs / dotNs, (unsigned long long)mismatches);
+  printf("BuildFields() %.2f us, per game %.2f deaths, %.2f levels won\n", build * 1e6 / reps / games,
+         (double)deaths / games, (double)levels / games);
+  return mismatches ? 2 : 0;
+}
+
+// The movement phases of MoveAll() (speed, step, tunnel wrap, collision) for n sprites, on the
+// SpriteTable and on sprite objects laid out as before it. The sprites run along the rows and turn
+// around now and then, the collisions are with sprite 0.
+struct HeadlessAosSprite {
+  int16_t _x, _y;
+  int16_t lastx, lasty;
+  uint8_t cx, cy;
+  uint8_t tx, ty;
+  uint8_t field;
+  SpriteState state;
+  uint8_t pentimer;
+  uint8_t who;
+  uint16_t _speed;
+  uint8_t dir;
+  uint8_t phase;
+  uint8_t palette2;
+  uint8_t bits;
+  int8_t sy;
+};
+
+static uint8_t headlessGain(uint8_t state) {
+  return state == FrightenedState ? 40 : state == DeadEyesState ? 100 : 75;
+}
+
+template <uint16_t N> static int headlessMoveBench(uint32_t ticks) {
+  const uint16_t n = N;
+  std::unique_ptr<SpriteTable<N>> soa(new SpriteTable<N>());
+  std::vector<HeadlessAosSprite> aos(n);
+  for (uint16_t i = 0; i < n; i++) {
+    HeadlessAosSprite& a = aos[i];
+    memset(&a, 0, sizeof(a));
+    a._x = soa->x[i] = (i * 37) % 28 * 8;
+    a._y = soa->y[i] = (4 + i % 29) * 8;
+    a.dir = soa->dir[i] = (i & 1) ? MLeft : MRight;
+    a.state = (SpriteState)(soa->state[i] = (i % 7 == 3) ? FrightenedState : (i % 11 == 5) ? DeadEyesState : RunState);
+    a._speed = soa->speed[i] = 0;
+  }
+
+  uint64_t hits[2] = { 0, 0 };
+  // the hits are summed in a local, not through the capture: a store per sprite would be timed too
+  auto objects = [&]() {
+    uint64_t h = 0;
+    for (uint32_t t = 0; t < ticks; t++) {
+      if ((t & 255) == 255)
+        for (uint16_t i = 0; i < n; i++) aos[i].dir = OppositeDirection(aos[i].dir);
+      for (uint16_t i = 0; i < n; i++) {
+        HeadlessAosSprite* s = &aos[i];
+        s->_speed += headlessGain(s->state);
+        if (s->_speed < MOVE_COST)
+          continue;
+        s->_speed -= MOVE_COST;
+        s->phase++;
+        int16_t x = s->_x;
+        int16_t y = s->_y;
+        switch (s->dir) {
+          case MLeft:     x -= SPEED; break;
+          case MRight:    x += SPEED; break;
+          case MUp:       y -= SPEED; break;
+          case MDown:     y += SPEED; break;
+        }
+        while (x < 0)
+          x += 224;
+        while (x >= 224)
+          x -= 224;
+        s->_x = x;
+        s->_y = y;
+        s->cx = (x + 4) >> 3;
+        s->cy = (y + 4) >> 3;
+      }
+      HeadlessAosSprite* p = &aos[0];
+      for (uint16_t i = 1; i < n; i++) {
+        HeadlessAosSprite* s = &aos[i];
+        h += s->_x + SPEED >= p->_x && s->_x - SPEED <= p->_x && s->_y + SPEED >= p->_y && s->_y - SPEED <= p->_y;
+      }
+    }
+    hits[0] += h;
+  };
+  auto table = [&]() {
+    SpriteTable<N>& tab = *soa;
+    uint64_t h = 0;
+    for (uint32_t t = 0; t < ticks; t++) {
+      if ((t & 255) == 255)
+        for (uint16_t i = 0; i < n; i++) tab.dir[i] = OppositeDirection(tab.dir[i]);
+      tab.Advance(n, SPEED, [&](uint16_t i) { return headlessGain(tab.state[i]); }, [&](uint16_t i) { return tab.dir[i]; });
+      tab.Touching(n, tab.x[0], tab.y[0], SPEED);
+      for (uint16_t i = 1; i < n; i++)
+        h += tab.hit[i];
+    }
+    hits[1] += h;
+  };
+  // a run of each to warm up caches and branch predictors, then the best of reps, taken in turns
+  const int reps = 5;
+  objects();
+  table();
+  double best[2] = { 1e9, 1e9 };
+  for (int r = 0; r < reps; r++) {
+    double t0 = headlessSeconds();
+    objects();
+    double t1 = headlessSeconds();
+    table();
+    double t2 = headlessSeconds();
+    best[0] = std::min(best[0], t1 - t0);
+    best[1] = std::min(best[1], t2 - t1);
+  }
+
+  bool same = hits[0] == hits[1];
+  for (uint16_t i = 0; i < n; i++)
+    same = same && aos[i]._x == soa->x[i] && aos[i]._y == soa->y[i] && aos[i].cx == soa->cx[i] && aos[i].phase == soa->phase[i];
+  double aosNs = best[0] * 1e9 / ticks, soaNs = best[1] * 1e9 / ticks;
+  printf("%3u sprites: objects %8.1f ns/tick (%5.2f ns/sprite), table %8.1f ns/tick (%5.2f ns/sprite), %.2fx, %s\n",
+         (unsigned)n, aosNs, aosNs / n, soaNs, soaNs / n, aosNs / soaNs, same ? "same" : "DIFFERENT");
+  return same ? 0 : 2;
+}
+
+// pacman_headless -b <games> [frames] [threads] [seed]
+//   Independent demo games (seeds seed .. seed + games - 1) on all cores. With more than one thread
+//   the same games run on one thread too, the scaling efficiency compares the two.
+// pacman_headless -p <replay file> [frames]
+//   Plays a recorded game, see InputReplay.
+// pacman_headless -l [frames] [every] [seed]
+// pacman_headless -l <replay file> [frames]
+//   Press to turn latency with synthetic presses (a direction every `every` ticks), or with the
+//   presses of a recorded game.
+// pacman_headless -s [frames] [more] [seed]
+//   Snapshot and restore time, and a check that the restored game goes on the same.
+// pacman_headless -n [frames] [seed]
+//   MoveAll() per tick with the navigation table and with the tile lookups it replaced.
+// pacman_headless -f [frames] [games] [seed]
+//   The dots field: incremental updates checked against a full search after every dot, and timed.
+// pacman_headless -m [ticks]
+//   Sprite movement per tick with the sprite table and with sprite objects: 6 sprites (the game's
+//   table), 64 and 256.
+int main(int argc, char** argv) {
+  if (argc > 1 && strcmp(argv[1], "-m") == 0) {
+    uint32_t ticks = argc > 2 ? strtoul(argv[2], NULL, 0) : 200000;
+    if (ticks == 0) return 1;
+    return headlessMoveBench<6>(ticks) | headlessMoveBench<64>(ticks) | headlessMoveBench<256>(ticks);
+  }
+
+  if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+    uint32_t frames = argc > 2 ? strtoul(argv[2], NULL, 0) : 20000;
+    if (frames == 0) return 1;
+    return headlessMoveAll(frames, argc > 3 ? strtoul(argv[3], NULL, 0) : 1);
+  }
+
+  if (argc > 1 && strcmp(argv[1], "-f") == 0) {
+    uint32_t frames = argc > 2 ? strtoul(argv[2], NULL, 0) : 20000;
+    uint32_t games = argc > 3 ? strtoul(argv[3], NULL, 0) : 10;
+    if (frames == 0 || games == 0) return 1;
+    return headlessFields(frames, games, argc > 4 ? strtoul(argv[4], NULL, 0) : 1);
+  }
+
+  if (argc > 1 && strcmp(argv[1], "-l") == 0) {
+    char* end = NULL;
+    uint32_t n = argc > 2 ? strtoul(argv[2], &end, 0) : 100000;
+    if (argc > 2 && *end != 0)
+      return headlessLatency(argv[2], argc > 3 ? strtoul(argv[3], NULL, 0) : UINT32_MAX, 1, 0);
+    uint32_t every = argc > 3 ? strtoul(argv[3], NULL, 0) : FPS / 2;
+    if (n == 0 || every == 0) return 1;
+    return headlessLatency(NULL, n, every, argc > 4 ? strtoul(argv[4], NULL, 0) : 1);
+  }
+
+  if (argc > 1 && strcmp(argv[1], "-s") == 0)
+    return headlessSnapshot(argc > 2 ? strtoul(argv[2], NULL, 0) : 10000, argc > 3 ? strtoul(argv[3], NULL, 0) : 10000,
+                            argc > 4 ? strtoul(argv[4], NULL, 0) : 1);
+
+  if (argc > 2 && strcmp(argv[1], "-p") == 0)
+    return headlessReplay(argv[2], argc > 3 ? strtoul(argv[3], NULL, 0) : 0);
+
+  if (argc > 1 && strcmp(argv[1], "-b") == 0) {
+    uint32_t games = argc > 2 ? strtoul(argv[2], NULL, 0) : 1000;
+    uint32_t frames = argc > 3 ? strtoul(argv[3], NULL, 0) : 60 * FPS;
+    unsigned threads = argc > 4 ? strtoul(argv[4], NULL, 0) : std::thread::hardware_concurrency();
+    uint32_t seed = argc > 5 ? strtoul(argv[5], NULL, 0) : 1;
+    if (games == 0 || frames == 0) return 1;
+    if (threads == 0) threads = 1;
+
+    std::vector<HeadlessResult> results(games), single(games);
+    double seconds = headlessBatch(results, 0, games, frames, seed, threads);
+    double seconds1 = threads > 1 ? headlessBatch(single, 0, games, frames, seed, 1) : seconds;
+
+    // folded in game order, the same for any number of threads
+    uint32_t hash = 0;
+    uint64_t deaths = 0, levels = 0;
+    for (const HeadlessResult& r : results) {
+      hash = (hash ^ r.hash) * 16777619u;
+      deaths += r.deaths;
+      levels += r.levelsWon;
+    }
+    // the same games on one thread, for the scaling and as a check that threads change nothing
+    bool same = true;
+    for (uint32_t g = 0; g < games && threads > 1; g++)
+      same = same && single[g].hash == results[g].hash;
+
+    double fps = (double)games * frames / seconds;
+    printf("%u games x %u frames on %u threads in %.3f s: %.0f frames/s", (unsigned)games, (unsigned)frames, threads,
+           seconds, fps);
+    if (threads > 1)
+      printf(", 1 thread %.3f s, scaling %.0f%%, %s", seconds1, 100 * seconds1 / (seconds * threads),
+             same ? "same" : "different");
+    printf("\n");
+    printf("per game: %.2f deaths, %.2f levels won, hash %08x\n",
+           (double)deaths / games, (double)levels / games, (unsigned)hash);
+    return same ? 0 : 2;
+  }
+
+  // anything other than a frame count here is a typo or -h: show how to call it instead of running
+  char* end = NULL;
+  uint32_t frames = argc > 1 ? strtoul(argv[1], &end, 0) : 100000;
+  if ((argc > 1 && (end == argv[1] || *end != 0)) || frames == 0 || (argc > 3 && strcmp(argv[3], "-t") != 0)) {
+    fprintf(stderr,
+            "usage: %s [frames [seed [-t]]] | -b [games [frames [threads [seed]]]] | -m [ticks]\n"
+            "       | -n [frames [seed]] | -f [frames [games [seed]]] | -l [presses [every [seed]]] | -l file [frames]\n"
+            "       | -s [frames [more [seed]]] | -p file [frames]\n",
+            argv[0]);
+    return 1;
+  }
+  uint32_t seed = argc > 2 ? strtoul(argv[2], NULL, 0) : 1;
+  bool trace = argc > 3;
+
+  double start = headlessSeconds();
+  HeadlessResult r = headlessGame(seed, frames, trace);
+  double seconds = headlessSeconds() - start;
+
+  printf("%u frames in %.3f s, %.0f frames/s, %.1f tiles/frame, %u deaths, %u levels won, hash %08x\n",
+         (unsigned)frames, seconds, frames / seconds, (double)headlessTiles / frames,
+         (unsigned)r.deaths, (unsigned)r.levelsWon, (unsigned)r.hash);
+  return 0;
+}
+#endif // PACMAN_HEADLESS